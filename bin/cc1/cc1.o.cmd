@@ -0,0 +1,4 @@
+/root/repo
+source/cc1/cc1.c
+bin/cc1/cc1.o
+cc -std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE   '-DKEFIR_BUILD_CFLAGS=-std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE ' '-DKEFIR_BUILD_SOURCE_ID=r34.60859a684835f92cb8d8c88b94b1e4886c38ed1a' '-DKEFIR_BUILD_TIMESTAMP=1792239667' -I./headers -include ./bin/config.h -Ibin/cc1 -DKEFIR_CC1_HELP_INCLUDE=help.binary.h -c source/cc1/cc1.c -o bin/cc1/cc1.o
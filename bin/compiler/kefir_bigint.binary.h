@@ -0,0 +1,6485 @@
+0x23, 0x20, 0x30, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65,
+0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x2f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68,
+0x22, 0x0a, 0x23, 0x20, 0x30, 0x20, 0x22, 0x3c, 0x62, 0x75, 0x69, 0x6c,
+0x74, 0x2d, 0x69, 0x6e, 0x3e, 0x22, 0x0a, 0x23, 0x20, 0x30, 0x20, 0x22,
+0x3c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x2d, 0x6c, 0x69, 0x6e,
+0x65, 0x3e, 0x22, 0x0a, 0x23, 0x20, 0x31, 0x20, 0x22, 0x2f, 0x75, 0x73,
+0x72, 0x2f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x2f, 0x73, 0x74,
+0x64, 0x63, 0x2d, 0x70, 0x72, 0x65, 0x64, 0x65, 0x66, 0x2e, 0x68, 0x22,
+0x20, 0x31, 0x20, 0x33, 0x20, 0x34, 0x0a, 0x23, 0x20, 0x30, 0x20, 0x22,
+0x3c, 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x2d, 0x6c, 0x69, 0x6e,
+0x65, 0x3e, 0x22, 0x20, 0x32, 0x0a, 0x23, 0x20, 0x31, 0x20, 0x22, 0x2e,
+0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68, 0x22, 0x0a, 0x23, 0x20, 0x33, 0x33,
+0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x2f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68, 0x22, 0x0a, 0x23,
+0x20, 0x31, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x2f, 0x62, 0x61, 0x73, 0x65, 0x2e, 0x68, 0x22, 0x20, 0x31,
+0x0a, 0x23, 0x20, 0x39, 0x32, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61,
+0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x62, 0x61, 0x73, 0x65, 0x2e, 0x68,
+0x22, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x65, 0x6e,
+0x75, 0x6d, 0x20, 0x7b, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52,
+0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x2c, 0x20,
+0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49,
+0x4e, 0x54, 0x5f, 0x44, 0x49, 0x56, 0x49, 0x53, 0x49, 0x4f, 0x4e, 0x5f,
+0x42, 0x59, 0x5f, 0x5a, 0x45, 0x52, 0x4f, 0x20, 0x7d, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x3b, 0x0a, 0x0a,
+0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x61,
+0x74, 0x69, 0x76, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e,
+0x61, 0x74, 0x69, 0x76, 0x65, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x2a, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61,
+0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c,
+0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75,
+0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x2a, 0x29, 0x3b,
+0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x28, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x69, 0x73, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74,
+0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x62, 0x69,
+0x74, 0x73, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69,
+0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f,
+0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b,
+0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72,
+0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x63,
+0x61, 0x73, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73,
+0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73,
+0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74,
+0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65,
+0x67, 0x65, 0x72, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69,
+0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f,
+0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+0x72, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74,
+0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x5f, 0x61,
+0x64, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x7a, 0x65, 0x72,
+0x6f, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75,
+0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x65, 0x67, 0x61,
+0x74, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x61, 0x64, 0x64, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75,
+0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x61, 0x64, 0x64, 0x5f,
+0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x20, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73,
+0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73,
+0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x75, 0x62,
+0x74, 0x72, 0x61, 0x63, 0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29,
+0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x73, 0x75, 0x62, 0x74, 0x72, 0x61, 0x63, 0x74, 0x5f, 0x7a, 0x65, 0x72,
+0x6f, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74,
+0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x74,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x6f, 0x72, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x61, 0x6e, 0x64, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73,
+0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73,
+0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x78, 0x6f, 0x72,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74,
+0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f,
+0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29,
+0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x61, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x65, 0x74, 0x69, 0x63, 0x5f, 0x72,
+0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69,
+0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f,
+0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73,
+0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73,
+0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67,
+0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f,
+0x6c, 0x65, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x61,
+0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c,
+0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29,
+0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x63, 0x6f, 0x70, 0x79, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x73,
+0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73,
+0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70,
+0x6c, 0x79, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a,
+0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65,
+0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c,
+0x79, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b,
+0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x76,
+0x69, 0x64, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75,
+0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 0x28, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29,
+0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x66, 0x6c,
+0x6f, 0x61, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x74, 0x6f, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69,
+0x63, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x74, 0x6f, 0x5f, 0x64, 0x6f,
+0x75, 0x62, 0x6c, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x74, 0x6f, 0x5f, 0x6c,
+0x6f, 0x6e, 0x67, 0x5f, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x61,
+0x74, 0x69, 0x63, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x74, 0x6f,
+0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
+0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x74, 0x6f, 0x5f, 0x64, 0x6f,
+0x75, 0x62, 0x6c, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x74, 0x6f, 0x5f, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x64, 0x6f, 0x75, 0x62,
+0x6c, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x66, 0x72,
+0x6f, 0x6d, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75,
+0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x64, 0x6f, 0x75, 0x62,
+0x6c, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x64, 0x6f, 0x75, 0x62,
+0x6c, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x66,
+0x72, 0x6f, 0x6d, 0x5f, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x64, 0x6f, 0x75,
+0x62, 0x6c, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x66,
+0x72, 0x6f, 0x6d, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+0x2a, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b,
+0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72,
+0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x66, 0x72, 0x6f, 0x6d,
+0x5f, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c,
+0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b,
+0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72,
+0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x66, 0x72, 0x6f, 0x6d,
+0x5f, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64,
+0x6f, 0x75, 0x62, 0x6c, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65,
+0x61, 0x73, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63,
+0x61, 0x6e, 0x74, 0x5f, 0x6e, 0x6f, 0x6e, 0x7a, 0x65, 0x72, 0x6f, 0x28,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69,
+0x63, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x6c, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x5f, 0x7a, 0x65, 0x72, 0x6f,
+0x73, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x74, 0x72,
+0x61, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x73,
+0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65,
+0x64, 0x75, 0x6e, 0x64, 0x61, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e,
+0x5f, 0x62, 0x69, 0x74, 0x73, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x20, 0x2a, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69,
+0x63, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x6e, 0x6f, 0x6e, 0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x63, 0x6f, 0x75, 0x6e,
+0x74, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x70, 0x61, 0x72, 0x69, 0x74, 0x79, 0x28, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2c, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x23, 0x20, 0x33, 0x34, 0x20, 0x22,
+0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68, 0x22, 0x20, 0x32, 0x0a, 0x23,
+0x20, 0x31, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x2f, 0x69, 0x6e, 0x69, 0x74, 0x2e, 0x68, 0x22, 0x20, 0x31,
+0x0a, 0x23, 0x20, 0x33, 0x35, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61,
+0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x69, 0x6e, 0x69, 0x74, 0x2e, 0x68,
+0x22, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x73, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69,
+0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20,
+0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f,
+0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e,
+0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x66, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x20,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x66, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x20, 0x3e, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x66, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20,
+0x3d, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x66, 0x69, 0x74,
+0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73,
+0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30,
+0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x2c,
+0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3e, 0x3e, 0x3d, 0x20, 0x28,
+0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20,
+0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x69, 0x66, 0x20, 0x28, 0x66, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x20, 0x3c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x63, 0x61, 0x73, 0x74, 0x5f,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x20, 0x66, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x2c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
+0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f,
+0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d,
+0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52,
+0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x66, 0x69, 0x74, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x66, 0x69, 0x74,
+0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x69, 0x74, 0x5f,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x69, 0x7a,
+0x65, 0x6f, 0x66, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74,
+0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20,
+0x28, 0x28, 0x28, 0x66, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29,
+0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+0x20, 0x3e, 0x3e, 0x3d, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20,
+0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x66, 0x69,
+0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3c, 0x20, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x66,
+0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49,
+0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x63, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31,
+0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c,
+0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x30, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49,
+0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b,
+0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x69,
+0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73,
+0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x63, 0x6f, 0x70,
+0x79, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x73, 0x74, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x73, 0x72, 0x63, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73,
+0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30,
+0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+0x73, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d,
+0x20, 0x3d, 0x20, 0x73, 0x72, 0x63, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f,
+0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e,
+0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61,
+0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c,
+0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x62,
+0x69, 0x74, 0x73, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2c, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x7c, 0x7c, 0x20, 0x6f, 0x66,
+0x66, 0x73, 0x65, 0x74, 0x20, 0x3e, 0x3d, 0x20, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45,
+0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f,
+0x4b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x74, 0x65,
+0x72, 0x20, 0x3d, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x65,
+0x6e, 0x64, 0x20, 0x3d, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20,
+0x2b, 0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x6e, 0x64, 0x20, 0x3e, 0x20,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x20,
+0x69, 0x74, 0x65, 0x72, 0x20, 0x3c, 0x20, 0x65, 0x6e, 0x64, 0x3b, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x5f,
+0x65, 0x6e, 0x64, 0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20, 0x25,
+0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20,
+0x2a, 0x20, 0x38, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x3f, 0x20, 0x28, 0x69, 0x74, 0x65, 0x72, 0x20, 0x2b, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28,
+0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x3a, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20, 0x2b, 0x20, 0x28, 0x73,
+0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x5f, 0x65, 0x6e, 0x64,
+0x20, 0x3e, 0x20, 0x65, 0x6e, 0x64, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x68,
+0x75, 0x6e, 0x6b, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x65, 0x6e,
+0x64, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x68,
+0x75, 0x6e, 0x6b, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x20,
+0x63, 0x68, 0x75, 0x6e, 0x6b, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x2d, 0x20,
+0x69, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x68, 0x75,
+0x6e, 0x6b, 0x5f, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28, 0x31,
+0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b,
+0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x69, 0x6e, 0x74, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20, 0x3d, 0x20,
+0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x26, 0x20, 0x63, 0x68, 0x75, 0x6e,
+0x6b, 0x5f, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f,
+0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d, 0x20, 0x69, 0x74, 0x65, 0x72,
+0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f,
+0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x69, 0x74, 0x65,
+0x72, 0x20, 0x2d, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x69,
+0x6e, 0x64, 0x65, 0x78, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x20, 0x3c, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x5b, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f,
+0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x20, 0x26, 0x3d, 0x20, 0x7e, 0x28,
+0x63, 0x68, 0x75, 0x6e, 0x6b, 0x5f, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3c,
+0x3c, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x6f, 0x66, 0x66,
+0x73, 0x65, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x5b, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65,
+0x78, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20,
+0x3c, 0x3c, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x6f, 0x66,
+0x66, 0x73, 0x65, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74,
+0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x20, 0x3d, 0x20, 0x63, 0x68,
+0x75, 0x6e, 0x6b, 0x20, 0x3c, 0x3c, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65,
+0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20,
+0x63, 0x68, 0x75, 0x6e, 0x6b, 0x5f, 0x65, 0x6e, 0x64, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+0x20, 0x3e, 0x3e, 0x3d, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x5f, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49,
+0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x23, 0x20, 0x33,
+0x35, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
+0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x2f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68, 0x22, 0x20,
+0x32, 0x0a, 0x23, 0x20, 0x31, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61,
+0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x67, 0x65, 0x74, 0x2e, 0x68, 0x22,
+0x20, 0x31, 0x0a, 0x23, 0x20, 0x33, 0x35, 0x20, 0x22, 0x2e, 0x2f, 0x68,
+0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x67, 0x65, 0x74, 0x2e,
+0x68, 0x22, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x61, 0x74, 0x69,
+0x76, 0x65, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x75, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x29, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28,
+0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x28, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31,
+0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x73, 0x62,
+0x20, 0x3d, 0x20, 0x75, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x26, 0x20,
+0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20,
+0x2b, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+0x20, 0x28, 0x3b, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x3e, 0x20, 0x31,
+0x20, 0x26, 0x26, 0x20, 0x28, 0x75, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+0x26, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x6d,
+0x73, 0x62, 0x3b, 0x20, 0x75, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3c,
+0x3c, 0x3d, 0x20, 0x31, 0x2c, 0x20, 0x62, 0x69, 0x74, 0x73, 0x2d, 0x2d,
+0x29, 0x20, 0x7b, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
+0x75, 0x72, 0x6e, 0x20, 0x62, 0x69, 0x74, 0x73, 0x3b, 0x0a, 0x7d, 0x0a,
+0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x61, 0x74, 0x69, 0x76, 0x65,
+0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20,
+0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+0x20, 0x28, 0x3b, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x21, 0x3d,
+0x20, 0x30, 0x3b, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3e, 0x3e,
+0x3d, 0x20, 0x31, 0x2c, 0x20, 0x62, 0x69, 0x74, 0x73, 0x2b, 0x2b, 0x29,
+0x20, 0x7b, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x62, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x69, 0x74,
+0x73, 0x20, 0x3d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+0x62, 0x69, 0x74, 0x73, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61,
+0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c,
+0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x28,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x2a,
+0x76, 0x61, 0x6c, 0x75, 0x65, 0x5f, 0x70, 0x74, 0x72, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x20, 0x3e, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20,
+0x2a, 0x20, 0x38, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20,
+0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75,
+0x65, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66,
+0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69,
+0x20, 0x3d, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x20, 0x3e, 0x20, 0x30, 0x3b, 0x20,
+0x69, 0x2d, 0x2d, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3c, 0x3c, 0x3d,
+0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20,
+0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x7c, 0x3d, 0x20, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x20, 0x2d, 0x20, 0x31, 0x5d,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3c,
+0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x20,
+0x3d, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30, 0x20,
+0x3f, 0x20, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3e, 0x3e, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29,
+0x20, 0x26, 0x20, 0x31, 0x20, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x61, 0x73, 0x6b,
+0x20, 0x3d, 0x20, 0x7e, 0x28, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c,
+0x3c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2d, 0x20, 0x31,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x7c, 0x3d, 0x20,
+0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c,
+0x20, 0x3c, 0x3c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2d,
+0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x26, 0x3d,
+0x20, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x2a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x5f, 0x70,
+0x74, 0x72, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f,
+0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e,
+0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61,
+0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c,
+0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75,
+0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x2a, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x5f, 0x70, 0x74, 0x72,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x28, 0x73, 0x69, 0x7a,
+0x65, 0x6f, 0x66, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x20, 0x3d, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20,
+0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x20, 0x3e, 0x20,
+0x30, 0x3b, 0x20, 0x69, 0x2d, 0x2d, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+0x3c, 0x3c, 0x3d, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x7c,
+0x3d, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x20, 0x2d,
+0x20, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x20, 0x3c, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28,
+0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x26, 0x3d,
+0x20, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x76, 0x61, 0x6c, 0x75, 0x65,
+0x5f, 0x70, 0x74, 0x72, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47,
+0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73,
+0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65,
+0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d,
+0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6d, 0x73, 0x62, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d,
+0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x29,
+0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6d, 0x73, 0x62, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20,
+0x3d, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x20,
+0x2d, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20,
+0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x5b, 0x6d, 0x73, 0x62, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d,
+0x20, 0x3e, 0x3e, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x6f, 0x66, 0x66, 0x73,
+0x65, 0x74, 0x29, 0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a,
+0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x69,
+0x73, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x3d,
+0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20,
+0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b,
+0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20,
+0x3d, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x69, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3d, 0x3d, 0x20, 0x74, 0x6f,
+0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+0x20, 0x3d, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20,
+0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d,
+0x73, 0x62, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x20,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x20, 0x2d, 0x20,
+0x6d, 0x73, 0x62, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x2a, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20,
+0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c,
+0x20, 0x3c, 0x3c, 0x20, 0x28, 0x6d, 0x73, 0x62, 0x5f, 0x6f, 0x66, 0x66,
+0x73, 0x65, 0x74, 0x20, 0x2b, 0x20, 0x31, 0x29, 0x29, 0x20, 0x2d, 0x20,
+0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x26, 0x3d, 0x20,
+0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x69, 0x66, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+0x6e, 0x20, 0x31, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74,
+0x69, 0x63, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x67, 0x65, 0x74, 0x5f, 0x62, 0x69, 0x74, 0x73, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65,
+0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x6f, 0x66,
+0x66, 0x73, 0x65, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x6f,
+0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x2b, 0x20, 0x6c, 0x65, 0x6e, 0x67,
+0x74, 0x68, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x65, 0x6e, 0x64, 0x20, 0x3e, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65,
+0x6e, 0x64, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20,
+0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+0x20, 0x28, 0x3b, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20, 0x3c, 0x20, 0x65,
+0x6e, 0x64, 0x3b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x68,
+0x75, 0x6e, 0x6b, 0x5f, 0x65, 0x6e, 0x64, 0x20, 0x3d, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x74,
+0x65, 0x72, 0x20, 0x25, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x21, 0x3d, 0x20,
+0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3f, 0x20, 0x28, 0x69, 0x74, 0x65,
+0x72, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29,
+0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20,
+0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x68, 0x75, 0x6e, 0x6b,
+0x5f, 0x65, 0x6e, 0x64, 0x20, 0x3e, 0x20, 0x65, 0x6e, 0x64, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x5f, 0x65, 0x6e, 0x64, 0x20,
+0x3d, 0x20, 0x65, 0x6e, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x5f, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x20, 0x3d, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x5f, 0x65, 0x6e,
+0x64, 0x20, 0x2d, 0x20, 0x69, 0x74, 0x65, 0x72, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x5f, 0x6d, 0x61, 0x73, 0x6b, 0x20,
+0x3d, 0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x63,
+0x68, 0x75, 0x6e, 0x6b, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20,
+0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x64,
+0x65, 0x78, 0x20, 0x3d, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20, 0x2f, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x6f, 0x66, 0x66,
+0x73, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20, 0x2d,
+0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65,
+0x78, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20,
+0x3d, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x74, 0x61,
+0x72, 0x67, 0x65, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x20,
+0x3e, 0x3e, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x5f, 0x6f, 0x66,
+0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x26, 0x20, 0x63, 0x68, 0x75, 0x6e,
+0x6b, 0x5f, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x7c,
+0x3d, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b, 0x20, 0x3c, 0x3c, 0x20, 0x28,
+0x69, 0x74, 0x65, 0x72, 0x20, 0x2d, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65,
+0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x69, 0x74, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x63, 0x68, 0x75, 0x6e, 0x6b,
+0x5f, 0x65, 0x6e, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6d, 0x69, 0x6e, 0x5f, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6d, 0x69, 0x6e, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66,
+0x6f, 0x72, 0x20, 0x28, 0x3b, 0x20, 0x6d, 0x69, 0x6e, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x20, 0x3e, 0x20, 0x30, 0x3b, 0x20,
+0x6d, 0x69, 0x6e, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2d, 0x2d, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69,
+0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x6d, 0x69, 0x6e, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x28,
+0x6d, 0x69, 0x6e, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31,
+0x29, 0x20, 0x2d, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x2a, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75,
+0x65, 0x20, 0x3d, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x6f, 0x66,
+0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61,
+0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6d, 0x69, 0x6e, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x3b, 0x0a, 0x7d, 0x0a, 0x23, 0x20, 0x33, 0x36, 0x20,
+0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68, 0x22, 0x20, 0x32, 0x0a,
+0x23, 0x20, 0x31, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65,
+0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x2f, 0x63, 0x61, 0x73, 0x74, 0x2e, 0x68, 0x22, 0x20,
+0x31, 0x0a, 0x23, 0x20, 0x33, 0x35, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65,
+0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x63, 0x61, 0x73, 0x74, 0x2e,
+0x68, 0x22, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64,
+0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x6c,
+0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x64, 0x65,
+0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20,
+0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x65,
+0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d, 0x20,
+0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f,
+0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2f, 0x20, 0x28,
+0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x73,
+0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74,
+0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65,
+0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69,
+0x6f, 0x6e, 0x20, 0x2d, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64,
+0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69,
+0x6e, 0x64, 0x65, 0x78, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x65, 0x73,
+0x69, 0x72, 0x65, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3c,
+0x3d, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x69, 0x6e, 0x74, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f,
+0x6d, 0x73, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x5b, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73,
+0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65,
+0x78, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65,
+0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x6f, 0x66,
+0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64,
+0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x62, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69,
+0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x7e, 0x28,
+0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x64, 0x65, 0x73,
+0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74,
+0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x31,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x64, 0x65,
+0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x20, 0x7c,
+0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28, 0x31, 0x75,
+0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65,
+0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x6f, 0x66,
+0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65,
+0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f,
+0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x20, 0x26, 0x3d, 0x20, 0x6d, 0x61,
+0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52,
+0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d,
+0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x3d, 0x20, 0x64, 0x65, 0x73,
+0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x20, 0x69, 0x2b,
+0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x69, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x30, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47,
+0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72,
+0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+0x6e, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x72,
+0x72, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x6c, 0x6f, 0x63,
+0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a,
+0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x6f, 0x66,
+0x66, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x6d,
+0x73, 0x62, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+0x2d, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x73,
+0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65,
+0x78, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69,
+0x6e, 0x74, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x6d,
+0x73, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x5b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66,
+0x73, 0x65, 0x74, 0x29, 0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x6f, 0x66,
+0x66, 0x73, 0x65, 0x74, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3c, 0x20, 0x28,
+0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+0x74, 0x5f, 0x6d, 0x73, 0x62, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61,
+0x73, 0x6b, 0x20, 0x3d, 0x20, 0x7e, 0x28, 0x28, 0x31, 0x75, 0x6c, 0x6c,
+0x20, 0x3c, 0x3c, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f,
+0x6d, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73,
+0x65, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x5b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69,
+0x6e, 0x64, 0x65, 0x78, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x6d, 0x61, 0x73,
+0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73,
+0x6b, 0x20, 0x3d, 0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c,
+0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62,
+0x5f, 0x62, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29,
+0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x5b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+0x5d, 0x20, 0x26, 0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20,
+0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20,
+0x2b, 0x20, 0x31, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x3d, 0x20, 0x64, 0x65,
+0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x20, 0x69,
+0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+0x74, 0x5f, 0x6d, 0x73, 0x62, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x7e, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x30, 0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d,
+0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x29, 0x20, 0x30, 0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42,
+0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a,
+0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72,
+0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x63,
+0x61, 0x73, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+0x6e, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64,
+0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d,
+0x73, 0x62, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+0x3d, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73,
+0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65,
+0x78, 0x20, 0x3d, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f,
+0x6d, 0x73, 0x62, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x62,
+0x5f, 0x62, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20,
+0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x65,
+0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20,
+0x2d, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73,
+0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65,
+0x78, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65,
+0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3c, 0x3d, 0x20, 0x63,
+0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28, 0x31, 0x75, 0x6c,
+0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64,
+0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66,
+0x73, 0x65, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x5b, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d, 0x73, 0x62,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+0x5d, 0x20, 0x26, 0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49,
+0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b,
+0x20, 0x69, 0x20, 0x3c, 0x3d, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65,
+0x64, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f,
+0x69, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20,
+0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x30, 0x75, 0x6c, 0x6c, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47,
+0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72,
+0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+0x6e, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x72,
+0x72, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x6c, 0x6f, 0x63,
+0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a,
+0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e,
+0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x6f, 0x66,
+0x66, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65,
+0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29,
+0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63,
+0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x62,
+0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3c, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28,
+0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x63, 0x75, 0x72, 0x72,
+0x65, 0x6e, 0x74, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74, 0x5f,
+0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x5b, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x5f,
+0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e,
+0x64, 0x65, 0x78, 0x5d, 0x20, 0x26, 0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x69, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74,
+0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69,
+0x6e, 0x64, 0x65, 0x78, 0x20, 0x2b, 0x20, 0x31, 0x3b, 0x20, 0x69, 0x20,
+0x3c, 0x3d, 0x20, 0x64, 0x65, 0x73, 0x69, 0x72, 0x65, 0x64, 0x5f, 0x6d,
+0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64,
+0x65, 0x78, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x30,
+0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f,
+0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e,
+0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x23, 0x20, 0x33, 0x37,
+0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x2f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68, 0x22, 0x20, 0x32,
+0x0a, 0x23, 0x20, 0x31, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64,
+0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x2f, 0x62, 0x69, 0x74, 0x77, 0x69, 0x73, 0x65,
+0x2e, 0x68, 0x22, 0x20, 0x31, 0x0a, 0x23, 0x20, 0x33, 0x35, 0x20, 0x22,
+0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x62,
+0x69, 0x74, 0x77, 0x69, 0x73, 0x65, 0x2e, 0x68, 0x22, 0x0a, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x63, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29,
+0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a,
+0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29,
+0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30,
+0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x7e,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
+0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f,
+0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d,
+0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x69, 0x6e, 0x6c,
+0x69, 0x6e, 0x65, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c,
+0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x61, 0x6e, 0x64, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x72, 0x68, 0x73, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31,
+0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20,
+0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+0x74, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20,
+0x3d, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x68, 0x73, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x72, 0x68, 0x73, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x68, 0x73, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20,
+0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x26, 0x20,
+0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52,
+0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a,
+0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x69, 0x6e,
+0x6c, 0x69, 0x6e, 0x65, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75,
+0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6f, 0x72, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x72, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20,
+0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20,
+0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20,
+0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69,
+0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x6c, 0x68,
+0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x7c, 0x20, 0x72, 0x68,
+0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42,
+0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a,
+0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x69, 0x6e, 0x6c, 0x69,
+0x6e, 0x65, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x78, 0x6f, 0x72, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+0x2a, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x72, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29,
+0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c,
+0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d,
+0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x6c,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x5e, 0x20, 0x72,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
+0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f,
+0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d,
+0x0a, 0x23, 0x20, 0x33, 0x38, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61,
+0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x2e, 0x68, 0x22, 0x20, 0x32, 0x0a, 0x23, 0x20, 0x31, 0x20, 0x22, 0x2e,
+0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x2e, 0x68, 0x22, 0x20, 0x31, 0x0a, 0x23, 0x20, 0x33,
+0x35, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
+0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x2f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x2e, 0x68, 0x22, 0x0a, 0x73,
+0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73,
+0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66,
+0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c,
+0x65, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20,
+0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x3b,
+0x20, 0x69, 0x20, 0x3e, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x3b,
+0x20, 0x69, 0x2d, 0x2d, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69,
+0x5d, 0x20, 0x3d, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69,
+0x20, 0x2d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x5d, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f,
+0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20,
+0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x73, 0x68, 0x69,
+0x66, 0x74, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x30,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46,
+0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b,
+0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66,
+0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x68, 0x69, 0x66,
+0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3e, 0x20, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d,
+0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x5f, 0x77,
+0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20,
+0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x2f, 0x20, 0x28, 0x73,
+0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73,
+0x68, 0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3e, 0x20, 0x30, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f,
+0x73, 0x68, 0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f,
+0x6c, 0x65, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x2d, 0x3d, 0x20,
+0x73, 0x68, 0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3e,
+0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x20,
+0x69, 0x20, 0x3e, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x2d, 0x2d, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20,
+0x3d, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d,
+0x20, 0x3c, 0x3c, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 0x20, 0x7c,
+0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x20, 0x2d,
+0x20, 0x31, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x28, 0x28, 0x73, 0x69, 0x7a,
+0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20,
+0x2d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 0x29, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x30, 0x5d, 0x20, 0x3c, 0x3c, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45,
+0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f,
+0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73,
+0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x5f, 0x65, 0x78, 0x74, 0x65,
+0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x67, 0x6e,
+0x20, 0x3f, 0x20, 0x7e, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x30, 0x75, 0x6c, 0x6c,
+0x20, 0x3a, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x30, 0x75, 0x6c, 0x6c, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x68, 0x69,
+0x66, 0x74, 0x20, 0x3e, 0x3d, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20,
+0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b,
+0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x67, 0x6e,
+0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20,
+0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+0x6f, 0x72, 0x20, 0x28, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f,
+0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d,
+0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d,
+0x20, 0x3d, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x20,
+0x2b, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x20, 0x69,
+0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20,
+0x73, 0x69, 0x67, 0x6e, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69,
+0x6f, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45,
+0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f,
+0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3e, 0x20, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3d, 0x20,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73,
+0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x68, 0x69, 0x66,
+0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x20, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x2f,
+0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20,
+0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d,
+0x61, 0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3d,
+0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x28, 0x74, 0x6f,
+0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d,
+0x20, 0x31, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61,
+0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c,
+0x3c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65,
+0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x74, 0x6f, 0x74, 0x61, 0x6c,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x5d,
+0x20, 0x26, 0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x68, 0x69, 0x66, 0x74, 0x5f,
+0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x20, 0x3e, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66,
+0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x73,
+0x68, 0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x2d, 0x3d, 0x20, 0x73,
+0x68, 0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a,
+0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x69, 0x66, 0x20, 0x28, 0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x3e, 0x20,
+0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x20, 0x2d, 0x20, 0x31, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d,
+0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20,
+0x3e, 0x3e, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 0x20, 0x7c, 0x20,
+0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x20, 0x2b, 0x20,
+0x31, 0x5d, 0x20, 0x3c, 0x3c, 0x20, 0x28, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d,
+0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x20, 0x2d, 0x20, 0x31, 0x5d, 0x20, 0x26, 0x3d, 0x20, 0x6d, 0x61, 0x73,
+0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x5d, 0x20,
+0x3e, 0x3e, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
+0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f,
+0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d,
+0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x61, 0x72, 0x69, 0x74, 0x68, 0x6d, 0x65, 0x74, 0x69, 0x63, 0x5f, 0x72,
+0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20,
+0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f,
+0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e,
+0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x68, 0x69, 0x66,
+0x74, 0x20, 0x3e, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69,
+0x66, 0x74, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20,
+0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69,
+0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20,
+0x3d, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31,
+0x29, 0x20, 0x2d, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x2a, 0x20, 0x28, 0x73,
+0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69, 0x67, 0x6e,
+0x20, 0x3d, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x6d,
+0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64,
+0x65, 0x78, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29,
+0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x7e, 0x28, 0x28,
+0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x6d, 0x73, 0x62, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74,
+0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20,
+0x2d, 0x20, 0x31, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d,
+0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x6d, 0x73,
+0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73,
+0x65, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x20, 0x2d, 0x20, 0x31, 0x5d, 0x20, 0x26, 0x3d, 0x20, 0x6d, 0x61, 0x73,
+0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f,
+0x6c, 0x65, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20,
+0x73, 0x68, 0x69, 0x66, 0x74, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a,
+0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x68, 0x69,
+0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x20, 0x3e, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64,
+0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73,
+0x68, 0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x5f, 0x77, 0x68, 0x6f, 0x6c,
+0x65, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x69,
+0x67, 0x6e, 0x2c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x69, 0x66,
+0x74, 0x20, 0x2d, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x5f, 0x77,
+0x68, 0x6f, 0x6c, 0x65, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20,
+0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x20, 0x3e, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30,
+0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x20,
+0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x73, 0x68, 0x69,
+0x66, 0x74, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x5b, 0x69, 0x20, 0x2b, 0x20, 0x31, 0x5d, 0x20, 0x3c, 0x3c, 0x20,
+0x28, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20,
+0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74,
+0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x5d, 0x20,
+0x3e, 0x3e, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x3b, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x61, 0x73,
+0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x6d,
+0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66,
+0x73, 0x65, 0x74, 0x20, 0x3e, 0x3d, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74,
+0x20, 0x3f, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x2d, 0x20, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3a, 0x20, 0x30, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x7e,
+0x28, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x6d, 0x61,
+0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x2d,
+0x20, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x20, 0x2d, 0x20, 0x31, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x6d, 0x61, 0x73,
+0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69,
+0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28, 0x31,
+0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x5f,
+0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x74, 0x6f, 0x74, 0x61,
+0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31,
+0x5d, 0x20, 0x26, 0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49,
+0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x23,
+0x20, 0x33, 0x39, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65,
+0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x2f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68,
+0x22, 0x20, 0x32, 0x0a, 0x23, 0x20, 0x31, 0x20, 0x22, 0x2e, 0x2f, 0x68,
+0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x61, 0x64, 0x64, 0x73,
+0x75, 0x62, 0x2e, 0x68, 0x22, 0x20, 0x31, 0x0a, 0x23, 0x20, 0x33, 0x35,
+0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x2f, 0x61, 0x64, 0x64, 0x73, 0x75, 0x62, 0x2e, 0x68, 0x22, 0x0a, 0x73,
+0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73,
+0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x74, 0x69,
+0x6c, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f,
+0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x65,
+0x64, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x72, 0x68,
+0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74,
+0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20,
+0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28,
+0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x69, 0x6e, 0x74, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x65, 0x78, 0x74, 0x65,
+0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x20, 0x3d,
+0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20,
+0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x69, 0x20, 0x3d,
+0x3d, 0x20, 0x30, 0x20, 0x3f, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x20, 0x3a, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x65, 0x78,
+0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x73, 0x75, 0x6d, 0x20, 0x3d,
+0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x20, 0x2b, 0x20, 0x6c, 0x68, 0x73,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x2b, 0x20, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69,
+0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x5f, 0x73, 0x75, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x20, 0x3d, 0x20, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x5f, 0x73, 0x75, 0x6d, 0x20, 0x3e, 0x3e, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f,
+0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e,
+0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61,
+0x74, 0x69, 0x63, 0x20, 0x69, 0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x28, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x5f, 0x61, 0x64, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x65,
+0x78, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x28, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42,
+0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a,
+0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72,
+0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x61,
+0x64, 0x64, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d,
+0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x20,
+0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d,
+0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61,
+0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b,
+0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x68, 0x73, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x6c, 0x68, 0x73, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+0x74, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20,
+0x3d, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x5f, 0x73, 0x75, 0x6d, 0x20, 0x3d, 0x20, 0x63, 0x61, 0x72,
+0x72, 0x79, 0x20, 0x2b, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x20, 0x2b, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69,
+0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x5f, 0x73, 0x75, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x20, 0x3d, 0x20, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x5f, 0x73, 0x75, 0x6d, 0x20, 0x3e, 0x3e, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f,
+0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e,
+0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61,
+0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c,
+0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x7a,
+0x65, 0x72, 0x6f, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+0x2a, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x68,
+0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x68, 0x73, 0x5f, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x6c, 0x68,
+0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28,
+0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73,
+0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x72, 0x68, 0x73,
+0x5f, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x72, 0x68, 0x73, 0x5f, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a,
+0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20,
+0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b,
+0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x61, 0x72, 0x72, 0x79,
+0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f,
+0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20,
+0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x6c, 0x68, 0x73,
+0x5f, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d,
+0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x69, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3c, 0x20, 0x72, 0x68, 0x73, 0x5f,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x20, 0x3d, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66,
+0x20, 0x28, 0x69, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3d, 0x3d, 0x20, 0x72,
+0x68, 0x73, 0x5f, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d,
+0x61, 0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3d,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x20, 0x2d, 0x20, 0x28, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28,
+0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20,
+0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x6d, 0x61, 0x73,
+0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x2d, 0x20,
+0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x20, 0x26, 0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x5f, 0x73, 0x75, 0x6d, 0x20, 0x3d, 0x20, 0x63, 0x61, 0x72, 0x72,
+0x79, 0x20, 0x2b, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x20, 0x2b, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d,
+0x20, 0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x5f, 0x73, 0x75, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x20, 0x3d, 0x20, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x5f, 0x73, 0x75, 0x6d, 0x20, 0x3e, 0x3e, 0x20, 0x28,
+0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f,
+0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54,
+0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74,
+0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x75, 0x62, 0x74, 0x72, 0x61,
+0x63, 0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x72, 0x68,
+0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31,
+0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x69, 0x6e, 0x74, 0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x20, 0x3d, 0x20,
+0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30,
+0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20,
+0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20,
+0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69,
+0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x5f, 0x64, 0x69, 0x66, 0x66, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x20,
+0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x29, 0x20, 0x2d,
+0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x2d,
+0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x64, 0x69, 0x66, 0x66, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x72, 0x72,
+0x79, 0x20, 0x3d, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x64,
+0x69, 0x66, 0x66, 0x20, 0x3e, 0x3e, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x20,
+0x26, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f,
+0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e,
+0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61,
+0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c,
+0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x75, 0x62, 0x74, 0x72,
+0x61, 0x63, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x65, 0x78, 0x74,
+0x65, 0x6e, 0x64, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x6c, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x72,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x68, 0x73, 0x5f,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d,
+0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x74, 0x6f, 0x74,
+0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20,
+0x28, 0x28, 0x28, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29,
+0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69,
+0x6e, 0x74, 0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x20, 0x3d, 0x20, 0x30,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b,
+0x20, 0x69, 0x20, 0x3c, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x74, 0x6f, 0x74,
+0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69,
+0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x68, 0x73,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x6c, 0x68, 0x73,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x68, 0x73,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x20, 0x2b, 0x20,
+0x31, 0x20, 0x3c, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x74, 0x6f, 0x74, 0x61,
+0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20,
+0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69,
+0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x20,
+0x2b, 0x20, 0x31, 0x20, 0x3d, 0x3d, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x20, 0x3d, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x5f,
+0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d,
+0x20, 0x28, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20,
+0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2a,
+0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20,
+0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28, 0x31, 0x75, 0x6c,
+0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x5f, 0x6f, 0x66,
+0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x26, 0x3d, 0x20,
+0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x30,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x69, 0x6e, 0x74, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x64, 0x69,
+0x66, 0x66, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x29, 0x20, 0x6c, 0x68, 0x73,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x72, 0x68,
+0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x2d, 0x20, 0x63, 0x61,
+0x72, 0x72, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x69, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x5f, 0x64, 0x69, 0x66, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x20, 0x3d,
+0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x64, 0x69, 0x66, 0x66,
+0x20, 0x3e, 0x3e, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x20, 0x26, 0x20, 0x31,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45,
+0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f,
+0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x23, 0x20, 0x34, 0x30, 0x20, 0x22, 0x2e,
+0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68, 0x22, 0x20, 0x32, 0x0a, 0x23, 0x20,
+0x31, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
+0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x2f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x79, 0x2e, 0x68,
+0x22, 0x20, 0x31, 0x0a, 0x23, 0x20, 0x33, 0x35, 0x20, 0x22, 0x2e, 0x2f,
+0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x6d, 0x75, 0x6c,
+0x74, 0x69, 0x70, 0x6c, 0x79, 0x2e, 0x68, 0x22, 0x0a, 0x73, 0x74, 0x61,
+0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c,
+0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x5f, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x79,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x20, 0x2a, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x6c, 0x68, 0x73, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x72, 0x68, 0x73,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x72, 0x65, 0x73, 0x75,
+0x6c, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6f, 0x70, 0x65,
+0x72, 0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x72, 0x65, 0x73,
+0x75, 0x6c, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20,
+0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72,
+0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20,
+0x3d, 0x3d, 0x20, 0x30, 0x20, 0x7c, 0x7c, 0x20, 0x6f, 0x70, 0x65, 0x72,
+0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x3d,
+0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b,
+0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f,
+0x4f, 0x4b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x6f, 0x70,
+0x65, 0x72, 0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20,
+0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x6f, 0x74, 0x61,
+0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28,
+0x28, 0x28, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20,
+0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x6e, 0x64, 0x5f,
+0x6d, 0x61, 0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20,
+0x3d, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x28, 0x74, 0x6f, 0x74, 0x61, 0x6c,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x29,
+0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x6f, 0x70, 0x65, 0x72,
+0x61, 0x6e, 0x64, 0x5f, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28,
+0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x6f, 0x70, 0x65, 0x72,
+0x61, 0x6e, 0x64, 0x5f, 0x6d, 0x61, 0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66,
+0x73, 0x65, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x61,
+0x73, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c,
+0x3c, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6a, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x6a, 0x20, 0x3c, 0x20, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b,
+0x20, 0x6a, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x61, 0x72, 0x72, 0x79, 0x20, 0x3d,
+0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20,
+0x3d, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x5b, 0x6a, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x69, 0x66, 0x20, 0x28, 0x6a, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3d,
+0x3d, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x20, 0x26, 0x3d, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61,
+0x6e, 0x64, 0x5f, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20,
+0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x5f, 0x69, 0x64, 0x78, 0x20,
+0x3d, 0x20, 0x69, 0x20, 0x2b, 0x20, 0x6a, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x5f, 0x69, 0x64, 0x78,
+0x20, 0x3e, 0x3d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+0x20, 0x28, 0x69, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3d, 0x3d, 0x20, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x20, 0x26, 0x3d, 0x20, 0x6f, 0x70, 0x65, 0x72,
+0x61, 0x6e, 0x64, 0x5f, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75,
+0x65, 0x20, 0x3d, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63,
+0x74, 0x5f, 0x69, 0x64, 0x78, 0x5d, 0x20, 0x2b, 0x20, 0x63, 0x61, 0x72,
+0x72, 0x79, 0x20, 0x2b, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x20, 0x2a, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63,
+0x74, 0x5f, 0x69, 0x64, 0x78, 0x5d, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x6c,
+0x75, 0x65, 0x20, 0x25, 0x20, 0x62, 0x61, 0x73, 0x65, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x61, 0x72, 0x72, 0x79, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+0x20, 0x2f, 0x20, 0x62, 0x61, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74,
+0x5f, 0x69, 0x64, 0x78, 0x20, 0x3d, 0x20, 0x6a, 0x20, 0x2b, 0x20, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x5f, 0x69, 0x64, 0x78,
+0x20, 0x3c, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x6f,
+0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x5b, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x5f,
+0x69, 0x64, 0x78, 0x5d, 0x20, 0x3d, 0x20, 0x63, 0x61, 0x72, 0x72, 0x79,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49,
+0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b,
+0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x6d, 0x75, 0x6c,
+0x74, 0x69, 0x70, 0x6c, 0x79, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x72, 0x65, 0x73,
+0x75, 0x6c, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x61, 0x63, 0x63, 0x75, 0x6d, 0x75, 0x6c,
+0x61, 0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f,
+0x28, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x7c, 0x7c, 0x20,
+0x6f, 0x70, 0x65, 0x72, 0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47,
+0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x75, 0x6c, 0x74,
+0x69, 0x70, 0x6c, 0x69, 0x65, 0x72, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x69,
+0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x6f, 0x70, 0x65, 0x72,
+0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20,
+0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69, 0x65,
+0x72, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74,
+0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f,
+0x70, 0x65, 0x72, 0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x20, 0x2d, 0x20, 0x31, 0x20, 0x2d, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69,
+0x70, 0x6c, 0x69, 0x65, 0x72, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x69, 0x6e,
+0x64, 0x65, 0x78, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f,
+0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x61, 0x63, 0x63, 0x75, 0x6d,
+0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x6e, 0x64, 0x5f, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20,
+0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69, 0x65, 0x72, 0x5f, 0x6c,
+0x73, 0x62, 0x5f, 0x70, 0x72, 0x65, 0x76, 0x5f, 0x62, 0x69, 0x74, 0x20,
+0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d,
+0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x6f, 0x70, 0x65, 0x72,
+0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3b, 0x20, 0x69,
+0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x75, 0x6c,
+0x74, 0x69, 0x70, 0x6c, 0x69, 0x65, 0x72, 0x5f, 0x6c, 0x73, 0x62, 0x5f,
+0x62, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x26, 0x20, 0x31, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69, 0x65, 0x72, 0x5f,
+0x6c, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74, 0x20, 0x26, 0x26, 0x20, 0x21,
+0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69, 0x65, 0x72, 0x5f, 0x6c,
+0x73, 0x62, 0x5f, 0x70, 0x72, 0x65, 0x76, 0x5f, 0x62, 0x69, 0x74, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x73, 0x75, 0x62, 0x74, 0x72, 0x61, 0x63, 0x74, 0x28, 0x61, 0x63,
+0x63, 0x75, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x6e,
+0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65,
+0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70,
+0x6c, 0x69, 0x65, 0x72, 0x5f, 0x6c, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74,
+0x20, 0x26, 0x26, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69,
+0x65, 0x72, 0x5f, 0x6c, 0x73, 0x62, 0x5f, 0x70, 0x72, 0x65, 0x76, 0x5f,
+0x62, 0x69, 0x74, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64,
+0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x61, 0x64, 0x64, 0x28, 0x61, 0x63, 0x63,
+0x75, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x6e, 0x64,
+0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69,
+0x65, 0x72, 0x5f, 0x6c, 0x73, 0x62, 0x5f, 0x70, 0x72, 0x65, 0x76, 0x5f,
+0x62, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70,
+0x6c, 0x69, 0x65, 0x72, 0x5f, 0x6c, 0x73, 0x62, 0x5f, 0x62, 0x69, 0x74,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x63, 0x63, 0x75, 0x6d, 0x75, 0x6c,
+0x61, 0x74, 0x6f, 0x72, 0x5f, 0x6c, 0x73, 0x62, 0x20, 0x3d, 0x20, 0x61,
+0x63, 0x63, 0x75, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x26, 0x20, 0x31,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x61, 0x72, 0x69, 0x74,
+0x68, 0x6d, 0x65, 0x74, 0x69, 0x63, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74,
+0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x61, 0x63, 0x63, 0x75, 0x6d,
+0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x6e,
+0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x28, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61,
+0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70,
+0x6c, 0x69, 0x65, 0x72, 0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x69, 0x6e, 0x64,
+0x65, 0x78, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x61, 0x63, 0x63, 0x75, 0x6d,
+0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x6c, 0x73, 0x62, 0x20, 0x3c,
+0x3c, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69, 0x65, 0x72,
+0x5f, 0x6d, 0x73, 0x62, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6f, 0x72,
+0x28, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x61, 0x63, 0x63, 0x75, 0x6d, 0x75, 0x6c, 0x61,
+0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20,
+0x6f, 0x70, 0x65, 0x72, 0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69,
+0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73,
+0x68, 0x69, 0x66, 0x74, 0x28, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x6f, 0x70, 0x65, 0x72,
+0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x72,
+0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x6f, 0x72, 0x28, 0x72, 0x65, 0x73, 0x75, 0x6c,
+0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x6c, 0x68,
+0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x6f, 0x70,
+0x65, 0x72, 0x61, 0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x63, 0x61, 0x73, 0x74, 0x5f, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x28, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61,
+0x6e, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2a, 0x20, 0x32,
+0x2c, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52,
+0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a,
+0x7d, 0x0a, 0x23, 0x20, 0x34, 0x31, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65,
+0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x2e, 0x68, 0x22, 0x20, 0x32, 0x0a, 0x23, 0x20, 0x31, 0x20, 0x22,
+0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x64,
+0x69, 0x76, 0x69, 0x64, 0x65, 0x2e, 0x68, 0x22, 0x20, 0x31, 0x0a, 0x23,
+0x20, 0x33, 0x35, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65,
+0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x2f, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65, 0x2e, 0x68,
+0x22, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x76,
+0x69, 0x64, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x6c, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x61, 0x63, 0x63, 0x75, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x72, 0x68, 0x73, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x61, 0x63, 0x63, 0x75,
+0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x3d,
+0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b,
+0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f,
+0x4f, 0x4b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x69, 0x73, 0x5f,
+0x7a, 0x65, 0x72, 0x6f, 0x28, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f,
+0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54,
+0x5f, 0x44, 0x49, 0x56, 0x49, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x42, 0x59,
+0x5f, 0x5a, 0x45, 0x52, 0x4f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d,
+0x20, 0x28, 0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20,
+0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x20,
+0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20,
+0x31, 0x20, 0x2d, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x2a, 0x20, 0x28, 0x73,
+0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20,
+0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x69, 0x6e, 0x74, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x6d, 0x73, 0x62, 0x20,
+0x3d, 0x20, 0x28, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x5b, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f,
+0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x6d, 0x73,
+0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73,
+0x65, 0x74, 0x29, 0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66,
+0x74, 0x28, 0x61, 0x63, 0x63, 0x75, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f,
+0x72, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x31, 0x2c,
+0x20, 0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f,
+0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x6c, 0x68, 0x73,
+0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x63, 0x75, 0x6d, 0x75, 0x6c,
+0x61, 0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x30, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x6d, 0x73,
+0x62, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x75,
+0x62, 0x74, 0x72, 0x61, 0x63, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x5f,
+0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x28, 0x61, 0x63, 0x63, 0x75, 0x6d,
+0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x2c, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x63, 0x63, 0x5f, 0x6d, 0x73, 0x62,
+0x20, 0x3d, 0x20, 0x28, 0x61, 0x63, 0x63, 0x75, 0x6d, 0x75, 0x6c, 0x61,
+0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x6d,
+0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64,
+0x65, 0x78, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29,
+0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x63, 0x63, 0x5f, 0x6d, 0x73,
+0x62, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x26, 0x3d, 0x20, 0x7e, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61,
+0x72, 0x29, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x7a, 0x65, 0x72, 0x6f,
+0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x28, 0x61, 0x63, 0x63, 0x75,
+0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x2c, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x68, 0x73, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x7c, 0x3d,
+0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45,
+0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f,
+0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64,
+0x69, 0x76, 0x69, 0x64, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x6c, 0x68, 0x73,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x61, 0x63, 0x63, 0x75, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x72,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20,
+0x6c, 0x68, 0x73, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x3d, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x28, 0x6c,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x6c,
+0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x68,
+0x73, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x3d, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x28, 0x72, 0x68, 0x73,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x72, 0x68, 0x73,
+0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x69, 0x73, 0x5f, 0x7a,
+0x65, 0x72, 0x6f, 0x28, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b,
+0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f,
+0x44, 0x49, 0x56, 0x49, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x42, 0x59, 0x5f,
+0x5a, 0x45, 0x52, 0x4f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x68, 0x73,
+0x5f, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x28, 0x6c, 0x68,
+0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x6c, 0x68,
+0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x72, 0x68, 0x73, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69,
+0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65,
+0x28, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c,
+0x20, 0x72, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x76, 0x69, 0x64,
+0x65, 0x28, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x20, 0x61, 0x63, 0x63, 0x75, 0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f,
+0x72, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x72, 0x68,
+0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x6c, 0x68,
+0x73, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x20, 0x72, 0x68, 0x73,
+0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x68, 0x73, 0x5f, 0x73, 0x69, 0x67,
+0x6e, 0x20, 0x5e, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x73, 0x69, 0x67, 0x6e,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x65,
+0x67, 0x61, 0x74, 0x65, 0x28, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x68, 0x73, 0x5f, 0x73,
+0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x28, 0x61, 0x63, 0x63, 0x75,
+0x6d, 0x75, 0x6c, 0x61, 0x74, 0x6f, 0x72, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x6c, 0x68, 0x73, 0x5f, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f,
+0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54,
+0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x23, 0x20, 0x34, 0x32, 0x20,
+0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68, 0x22, 0x20, 0x32, 0x0a,
+0x23, 0x20, 0x31, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65,
+0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x2f, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 0x2e,
+0x68, 0x22, 0x20, 0x31, 0x0a, 0x23, 0x20, 0x33, 0x35, 0x20, 0x22, 0x2e,
+0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x63, 0x6f,
+0x6d, 0x70, 0x61, 0x72, 0x65, 0x2e, 0x68, 0x22, 0x0a, 0x73, 0x74, 0x61,
+0x74, 0x69, 0x63, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65,
+0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x6c, 0x68,
+0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x72, 0x68, 0x73, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x73, 0x69,
+0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29,
+0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a,
+0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x74, 0x6f,
+0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20,
+0x69, 0x20, 0x3e, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x2d, 0x2d, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x6c,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69, 0x20,
+0x2d, 0x20, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69,
+0x6e, 0x74, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x20, 0x3d, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x5b, 0x69, 0x20, 0x2d, 0x20, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x20,
+0x3d, 0x3d, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+0x74, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65,
+0x74, 0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2d, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f,
+0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20,
+0x2a, 0x20, 0x38, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x20,
+0x2b, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20,
+0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3d, 0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c,
+0x20, 0x3c, 0x3c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x5f, 0x6f, 0x66, 0x66,
+0x73, 0x65, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x68,
+0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x26, 0x3d, 0x20, 0x6d,
+0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x20, 0x26, 0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3e, 0x20, 0x72,
+0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65,
+0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x20, 0x3c, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+0x20, 0x2d, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x3b, 0x0a, 0x7d,
+0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6d, 0x70,
+0x61, 0x72, 0x65, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20,
+0x2a, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x72, 0x68, 0x73,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x69, 0x6e, 0x64,
+0x65, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20,
+0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x6f, 0x66, 0x66,
+0x73, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2d, 0x20, 0x6d, 0x73, 0x62, 0x5f,
+0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a,
+0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b,
+0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+0x20, 0x6c, 0x68, 0x73, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x3d, 0x20,
+0x28, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x6d, 0x73, 0x62, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x20, 0x3e,
+0x3e, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74,
+0x29, 0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x73, 0x69,
+0x67, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x5b, 0x6d, 0x73, 0x62, 0x5f, 0x69, 0x6e, 0x64,
+0x65, 0x78, 0x5d, 0x20, 0x3e, 0x3e, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x6f,
+0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x68, 0x73, 0x5f,
+0x73, 0x69, 0x67, 0x6e, 0x20, 0x26, 0x26, 0x20, 0x21, 0x72, 0x68, 0x73,
+0x5f, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+0x2d, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c,
+0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x6c, 0x68, 0x73, 0x5f,
+0x73, 0x69, 0x67, 0x6e, 0x20, 0x26, 0x26, 0x20, 0x72, 0x68, 0x73, 0x5f,
+0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6d, 0x70,
+0x61, 0x72, 0x65, 0x28, 0x6c, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x72, 0x68, 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x3b, 0x0a,
+0x7d, 0x0a, 0x23, 0x20, 0x34, 0x33, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65,
+0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x2e, 0x68, 0x22, 0x20, 0x32, 0x0a, 0x23, 0x20, 0x31, 0x20, 0x22,
+0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x66,
+0x6c, 0x6f, 0x61, 0x74, 0x2e, 0x68, 0x22, 0x20, 0x31, 0x0a, 0x23, 0x20,
+0x39, 0x32, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
+0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x2f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2e, 0x68, 0x22, 0x0a,
+0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x74,
+0x6f, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x74, 0x6d, 0x70, 0x2c, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x69, 0x73, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+0x72, 0x6e, 0x20, 0x30, 0x2e, 0x30, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x20, 0x65, 0x78, 0x70,
+0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69,
+0x73, 0x73, 0x61, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x20,
+0x7b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x31, 0x29, 0x29, 0x20, 0x7b,
+0x20, 0x2a, 0x28, 0x26, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x3d, 0x20,
+0x2d, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e,
+0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x3b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x28, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x7d, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x2a,
+0x28, 0x26, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x3d, 0x20, 0x30, 0x3b,
+0x20, 0x7d, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63,
+0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6d, 0x69, 0x6e, 0x5f,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x2a, 0x28, 0x26, 0x65, 0x78, 0x70,
+0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x67,
+0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3e, 0x20, 0x28, 0x32,
+0x34, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68,
+0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e,
+0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x20, 0x7b, 0x20,
+0x63, 0x61, 0x73, 0x65, 0x20, 0x28, 0x32, 0x34, 0x29, 0x20, 0x2b, 0x20,
+0x31, 0x3a, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28,
+0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b,
+0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x28, 0x32, 0x34, 0x29, 0x20, 0x2b,
+0x20, 0x32, 0x3a, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20, 0x64,
+0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x20, 0x28, 0x76, 0x6f, 0x69,
+0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x2c, 0x20, 0x2d, 0x31, 0x29, 0x3b, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68,
+0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x74, 0x6d, 0x70,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b,
+0x20, 0x28, 0x32, 0x34, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x20, 0x2d, 0x20,
+0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x61, 0x6e, 0x64, 0x28, 0x28, 0x74, 0x6d, 0x70,
+0x29, 0x2c, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x2c, 0x20, 0x21, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x69, 0x73, 0x5f,
+0x7a, 0x65, 0x72, 0x6f, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x29, 0x3b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67,
+0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e,
+0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x28,
+0x28, 0x32, 0x34, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x29, 0x2c, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6f, 0x72, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x62, 0x72, 0x65, 0x61,
+0x6b, 0x3b, 0x20, 0x7d, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x76, 0x61, 0x6c, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20,
+0x26, 0x76, 0x61, 0x6c, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64,
+0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+0x72, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x28, 0x76, 0x61, 0x6c, 0x20, 0x26,
+0x20, 0x34, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x3b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6f, 0x72, 0x28,
+0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x74, 0x69, 0x6c,
+0x5f, 0x61, 0x64, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x7a,
+0x65, 0x72, 0x6f, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64,
+0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64,
+0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73,
+0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x32, 0x2c,
+0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x62, 0x69,
+0x74, 0x73, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x32, 0x34, 0x29,
+0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x29, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69,
+0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x2a, 0x28,
+0x26, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x29, 0x2b,
+0x2b, 0x3b, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20,
+0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63,
+0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x21,
+0x3d, 0x20, 0x28, 0x32, 0x34, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74,
+0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x28, 0x32, 0x34, 0x29, 0x20, 0x2d, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69,
+0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x7d, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x67, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x28, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c,
+0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x28, 0x26,
+0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x29, 0x29, 0x3b, 0x20,
+0x7d, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x30, 0x29, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e,
+0x65, 0x6e, 0x74, 0x20, 0x3e, 0x3d, 0x20, 0x31, 0x32, 0x38, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78,
+0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x38,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61,
+0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x69, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x75, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61,
+0x74, 0x20, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63,
+0x6f, 0x6e, 0x76, 0x20, 0x3d, 0x20, 0x7b, 0x2e, 0x75, 0x20, 0x3d, 0x20,
+0x28, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x26, 0x20, 0x30, 0x78, 0x38, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x28,
+0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x2b, 0x20, 0x31,
+0x32, 0x37, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x33, 0x29, 0x20, 0x7c,
+0x20, 0x28, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x20, 0x26,
+0x20, 0x30, 0x78, 0x30, 0x30, 0x37, 0x66, 0x66, 0x66, 0x66, 0x66, 0x29,
+0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x66, 0x3b, 0x0a, 0x7d, 0x0a,
+0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x64, 0x6f, 0x75, 0x62,
+0x6c, 0x65, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x74, 0x6f, 0x5f, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x74,
+0x6d, 0x70, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x69, 0x73,
+0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x2e,
+0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69, 0x67,
+0x6e, 0x2c, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x2c,
+0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x64, 0x6f, 0x20, 0x7b, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x28, 0x31, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x2a, 0x28, 0x26, 0x73, 0x69,
+0x67, 0x6e, 0x29, 0x20, 0x3d, 0x20, 0x2d, 0x28, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65,
+0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x69, 0x66,
+0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x65, 0x67, 0x61,
+0x74, 0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x65, 0x6c,
+0x73, 0x65, 0x20, 0x7b, 0x20, 0x2a, 0x28, 0x26, 0x73, 0x69, 0x67, 0x6e,
+0x29, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x7d, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69,
+0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65,
+0x74, 0x5f, 0x6d, 0x69, 0x6e, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x2a, 0x28, 0x26, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29,
+0x20, 0x3d, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61,
+0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20,
+0x31, 0x3b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x69,
+0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x20, 0x3e, 0x20, 0x28, 0x35, 0x33, 0x29, 0x29, 0x20, 0x7b, 0x20,
+0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x20, 0x7b, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x28,
+0x35, 0x33, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x3a, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f,
+0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x31,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20,
+0x28, 0x35, 0x33, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x3a, 0x20, 0x62, 0x72,
+0x65, 0x61, 0x6b, 0x3b, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+0x3a, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x73, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69,
+0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x2d,
+0x31, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66,
+0x74, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x35, 0x33, 0x29, 0x20,
+0x2b, 0x20, 0x32, 0x20, 0x2d, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66,
+0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x61, 0x6e,
+0x64, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65,
+0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69,
+0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x21,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x69, 0x73, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x28,
+0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69,
+0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x73, 0x69, 0x67, 0x6e,
+0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x20, 0x2d, 0x20, 0x28, 0x28, 0x35, 0x33, 0x29, 0x20, 0x2b,
+0x20, 0x32, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x6f, 0x72, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x74, 0x6d,
+0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29,
+0x3b, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20, 0x7d, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x3b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74,
+0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76, 0x61,
+0x6c, 0x75, 0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x26, 0x76, 0x61, 0x6c, 0x29, 0x3b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73,
+0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d, 0x70,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20,
+0x28, 0x76, 0x61, 0x6c, 0x20, 0x26, 0x20, 0x34, 0x29, 0x20, 0x21, 0x3d,
+0x20, 0x30, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x6f, 0x72, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28,
+0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x65, 0x78,
+0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72,
+0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x29, 0x2c, 0x20, 0x32, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x3b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x67, 0x65, 0x74, 0x5f, 0x62, 0x69, 0x74, 0x73, 0x28, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x35, 0x33, 0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67,
+0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x29, 0x3b, 0x20, 0x28, 0x2a, 0x28, 0x26, 0x65, 0x78, 0x70, 0x6f, 0x6e,
+0x65, 0x6e, 0x74, 0x29, 0x29, 0x2b, 0x2b, 0x3b, 0x20, 0x7d, 0x20, 0x7d,
+0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x20, 0x21, 0x3d, 0x20, 0x28, 0x35, 0x33, 0x29,
+0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74,
+0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x35, 0x33, 0x29, 0x20, 0x2d,
+0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75,
+0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x2c, 0x20, 0x28, 0x26, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73,
+0x73, 0x61, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x77, 0x68, 0x69, 0x6c,
+0x65, 0x20, 0x28, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x3e, 0x3d,
+0x20, 0x31, 0x30, 0x32, 0x34, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+0x74, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x32, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73,
+0x73, 0x61, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x66,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x6f, 0x6e, 0x76,
+0x20, 0x3d, 0x20, 0x7b, 0x2e, 0x75, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x20, 0x26, 0x20, 0x30, 0x78, 0x38, 0x30, 0x30, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x32, 0x29,
+0x20, 0x7c, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+0x74, 0x20, 0x2b, 0x20, 0x31, 0x30, 0x32, 0x33, 0x29, 0x20, 0x3c, 0x3c,
+0x20, 0x35, 0x32, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x6d, 0x61, 0x6e, 0x74,
+0x69, 0x73, 0x73, 0x61, 0x20, 0x26, 0x20, 0x30, 0x78, 0x30, 0x30, 0x30,
+0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+0x66, 0x75, 0x6c, 0x6c, 0x29, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x2e,
+0x66, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x74,
+0x6f, 0x5f, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x64, 0x6f, 0x75, 0x62, 0x6c,
+0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x74, 0x6d, 0x70, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x69, 0x73, 0x5f,
+0x7a, 0x65, 0x72, 0x6f, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x2e, 0x30,
+0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69, 0x67,
+0x6e, 0x2c, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x2c,
+0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x64, 0x6f, 0x20, 0x7b, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x28, 0x31, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x2a, 0x28, 0x26, 0x73, 0x69,
+0x67, 0x6e, 0x29, 0x20, 0x3d, 0x20, 0x2d, 0x28, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65,
+0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x69, 0x66,
+0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x65, 0x67, 0x61,
+0x74, 0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x65, 0x6c,
+0x73, 0x65, 0x20, 0x7b, 0x20, 0x2a, 0x28, 0x26, 0x73, 0x69, 0x67, 0x6e,
+0x29, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x7d, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69,
+0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65,
+0x74, 0x5f, 0x6d, 0x69, 0x6e, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x2a, 0x28, 0x26, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29,
+0x20, 0x3d, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61,
+0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20,
+0x31, 0x3b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x69,
+0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x20, 0x3e, 0x20, 0x28, 0x36, 0x34, 0x29, 0x29, 0x20, 0x7b, 0x20,
+0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x20, 0x7b, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x28,
+0x36, 0x34, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x3a, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f,
+0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x31,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20,
+0x28, 0x36, 0x34, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x3a, 0x20, 0x62, 0x72,
+0x65, 0x61, 0x6b, 0x3b, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74,
+0x3a, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x73, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69,
+0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x2d,
+0x31, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66,
+0x74, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x36, 0x34, 0x29, 0x20,
+0x2b, 0x20, 0x32, 0x20, 0x2d, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66,
+0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x61, 0x6e,
+0x64, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65,
+0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69,
+0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x21,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x69, 0x73, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x28,
+0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69,
+0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x73, 0x69, 0x67, 0x6e,
+0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x20, 0x2d, 0x20, 0x28, 0x28, 0x36, 0x34, 0x29, 0x20, 0x2b,
+0x20, 0x32, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x6f, 0x72, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x74, 0x6d,
+0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29,
+0x3b, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20, 0x7d, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x3b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74,
+0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76, 0x61,
+0x6c, 0x75, 0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x26, 0x76, 0x61, 0x6c, 0x29, 0x3b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73,
+0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d, 0x70,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20,
+0x28, 0x76, 0x61, 0x6c, 0x20, 0x26, 0x20, 0x34, 0x29, 0x20, 0x21, 0x3d,
+0x20, 0x30, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x6f, 0x72, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28,
+0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x65, 0x78,
+0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72,
+0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x29, 0x2c, 0x20, 0x32, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x3b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x67, 0x65, 0x74, 0x5f, 0x62, 0x69, 0x74, 0x73, 0x28, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x36, 0x34, 0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67,
+0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x29, 0x3b, 0x20, 0x28, 0x2a, 0x28, 0x26, 0x65, 0x78, 0x70, 0x6f, 0x6e,
+0x65, 0x6e, 0x74, 0x29, 0x29, 0x2b, 0x2b, 0x3b, 0x20, 0x7d, 0x20, 0x7d,
+0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x20, 0x21, 0x3d, 0x20, 0x28, 0x36, 0x34, 0x29,
+0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74,
+0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x36, 0x34, 0x29, 0x20, 0x2d,
+0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75,
+0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x2c, 0x20, 0x28, 0x26, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73,
+0x73, 0x61, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x77, 0x68, 0x69, 0x6c,
+0x65, 0x20, 0x28, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x3e, 0x3d,
+0x20, 0x31, 0x36, 0x33, 0x38, 0x34, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65,
+0x6e, 0x74, 0x20, 0x3d, 0x20, 0x31, 0x36, 0x33, 0x38, 0x34, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x6e, 0x74,
+0x69, 0x73, 0x73, 0x61, 0x20, 0x3d, 0x20, 0x31, 0x75, 0x6c, 0x6c, 0x20,
+0x3c, 0x3c, 0x20, 0x36, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x75, 0x5b, 0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64,
+0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x20, 0x3d, 0x20, 0x7b, 0x2e,
+0x75, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69,
+0x73, 0x73, 0x61, 0x2c, 0x20, 0x2e, 0x75, 0x5b, 0x31, 0x5d, 0x20, 0x3d,
+0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x26, 0x20, 0x30, 0x78, 0x38,
+0x30, 0x30, 0x30, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70,
+0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x2b, 0x20, 0x31, 0x36, 0x33, 0x38,
+0x33, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x66, 0x66, 0x66, 0x29,
+0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x66, 0x3b, 0x0a, 0x7d, 0x0a,
+0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x66, 0x6c, 0x6f, 0x61,
+0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x74, 0x6f, 0x5f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x20, 0x2a, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x74,
+0x6d, 0x70, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x69, 0x73,
+0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x2e,
+0x30, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69,
+0x67, 0x6e, 0x2c, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+0x2c, 0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x20, 0x7b, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x28, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x2a, 0x28, 0x26, 0x73,
+0x69, 0x67, 0x6e, 0x29, 0x20, 0x3d, 0x20, 0x2d, 0x28, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67,
+0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x28, 0x28, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c,
+0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x65, 0x67,
+0x61, 0x74, 0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x65,
+0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x2a, 0x28, 0x26, 0x73, 0x69, 0x67,
+0x6e, 0x29, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x7d, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73,
+0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67,
+0x65, 0x74, 0x5f, 0x6d, 0x69, 0x6e, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x2a, 0x28, 0x26, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+0x29, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63,
+0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d,
+0x20, 0x31, 0x3b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x20, 0x3e, 0x20, 0x28, 0x32, 0x34, 0x29, 0x29, 0x20, 0x7b,
+0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x73, 0x69, 0x67,
+0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x20, 0x7b, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20,
+0x28, 0x32, 0x34, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x3a, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74,
+0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20, 0x63, 0x61, 0x73, 0x65,
+0x20, 0x28, 0x32, 0x34, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x3a, 0x20, 0x62,
+0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
+0x74, 0x3a, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x73, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d, 0x70,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20,
+0x2d, 0x31, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69,
+0x66, 0x74, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x32, 0x34, 0x29,
+0x20, 0x2b, 0x20, 0x32, 0x20, 0x2d, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69,
+0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x61,
+0x6e, 0x64, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73,
+0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d, 0x70,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20,
+0x21, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x69, 0x73, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28,
+0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x73, 0x69, 0x67,
+0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x28, 0x28, 0x32, 0x34, 0x29, 0x20,
+0x2b, 0x20, 0x32, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x6f, 0x72, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x74,
+0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x29, 0x3b, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20, 0x7d, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x3b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65,
+0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x26, 0x76, 0x61, 0x6c, 0x29,
+0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d,
+0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c,
+0x20, 0x28, 0x76, 0x61, 0x6c, 0x20, 0x26, 0x20, 0x34, 0x29, 0x20, 0x21,
+0x3d, 0x20, 0x30, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x6f, 0x72, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x5f, 0x61, 0x64, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x65,
+0x78, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x28, 0x28, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c,
+0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29,
+0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28,
+0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x2c, 0x20, 0x32, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x67, 0x65, 0x74, 0x5f, 0x62, 0x69, 0x74, 0x73, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x32, 0x34, 0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x29, 0x20, 0x7b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69,
+0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x3b, 0x20, 0x28, 0x2a, 0x28, 0x26, 0x65, 0x78, 0x70, 0x6f,
+0x6e, 0x65, 0x6e, 0x74, 0x29, 0x29, 0x2b, 0x2b, 0x3b, 0x20, 0x7d, 0x20,
+0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x21, 0x3d, 0x20, 0x28, 0x32, 0x34,
+0x29, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66,
+0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x32, 0x34, 0x29, 0x20,
+0x2d, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e,
+0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76, 0x61, 0x6c,
+0x75, 0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x2c, 0x20, 0x28, 0x26, 0x6d, 0x61, 0x6e, 0x74, 0x69,
+0x73, 0x73, 0x61, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x77, 0x68, 0x69,
+0x6c, 0x65, 0x20, 0x28, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+0x20, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x3e,
+0x3d, 0x20, 0x31, 0x32, 0x38, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+0x74, 0x20, 0x3d, 0x20, 0x31, 0x32, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73,
+0x61, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x66, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x20, 0x3d,
+0x20, 0x7b, 0x2e, 0x75, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x20, 0x26, 0x20, 0x30, 0x78, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+0x30, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e,
+0x65, 0x6e, 0x74, 0x20, 0x2b, 0x20, 0x31, 0x32, 0x37, 0x29, 0x20, 0x3c,
+0x3c, 0x20, 0x32, 0x33, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x6d, 0x61, 0x6e,
+0x74, 0x69, 0x73, 0x73, 0x61, 0x20, 0x26, 0x20, 0x30, 0x78, 0x30, 0x30,
+0x37, 0x66, 0x66, 0x66, 0x66, 0x66, 0x29, 0x7d, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x6f, 0x6e,
+0x76, 0x2e, 0x66, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74,
+0x69, 0x63, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x74, 0x6f,
+0x5f, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x74, 0x6d,
+0x70, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x69,
+0x73, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30,
+0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69,
+0x67, 0x6e, 0x2c, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+0x2c, 0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x20, 0x7b, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x28, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x2a, 0x28, 0x26, 0x73,
+0x69, 0x67, 0x6e, 0x29, 0x20, 0x3d, 0x20, 0x2d, 0x28, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67,
+0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x28, 0x28, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c,
+0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x65, 0x67,
+0x61, 0x74, 0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x65,
+0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x2a, 0x28, 0x26, 0x73, 0x69, 0x67,
+0x6e, 0x29, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x7d, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73,
+0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67,
+0x65, 0x74, 0x5f, 0x6d, 0x69, 0x6e, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x2a, 0x28, 0x26, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+0x29, 0x20, 0x3d, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63,
+0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d,
+0x20, 0x31, 0x3b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x20, 0x3e, 0x20, 0x28, 0x35, 0x33, 0x29, 0x29, 0x20, 0x7b,
+0x20, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x28, 0x73, 0x69, 0x67,
+0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x20, 0x7b, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20,
+0x28, 0x35, 0x33, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x3a, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74,
+0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20, 0x63, 0x61, 0x73, 0x65,
+0x20, 0x28, 0x35, 0x33, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x3a, 0x20, 0x62,
+0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c,
+0x74, 0x3a, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x73, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d, 0x70,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20,
+0x2d, 0x31, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69,
+0x66, 0x74, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x35, 0x33, 0x29,
+0x20, 0x2b, 0x20, 0x32, 0x20, 0x2d, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69,
+0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x61,
+0x6e, 0x64, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73,
+0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d, 0x70,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20,
+0x21, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x69, 0x73, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28,
+0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x73, 0x69, 0x67,
+0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x28, 0x28, 0x35, 0x33, 0x29, 0x20,
+0x2b, 0x20, 0x32, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x6f, 0x72, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x74,
+0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x29, 0x3b, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20, 0x7d, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x76, 0x61, 0x6c, 0x3b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65,
+0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x26, 0x76, 0x61, 0x6c, 0x29,
+0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x74, 0x6d,
+0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c,
+0x20, 0x28, 0x76, 0x61, 0x6c, 0x20, 0x26, 0x20, 0x34, 0x29, 0x20, 0x21,
+0x3d, 0x20, 0x30, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x6f, 0x72, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x5f, 0x61, 0x64, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x65,
+0x78, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x28, 0x28, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c,
+0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29,
+0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28,
+0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x2c, 0x20, 0x32, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x67, 0x65, 0x74, 0x5f, 0x62, 0x69, 0x74, 0x73, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x35, 0x33, 0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x29, 0x20, 0x7b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69,
+0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x3b, 0x20, 0x28, 0x2a, 0x28, 0x26, 0x65, 0x78, 0x70, 0x6f,
+0x6e, 0x65, 0x6e, 0x74, 0x29, 0x29, 0x2b, 0x2b, 0x3b, 0x20, 0x7d, 0x20,
+0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x21, 0x3d, 0x20, 0x28, 0x35, 0x33,
+0x29, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66,
+0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x35, 0x33, 0x29, 0x20,
+0x2d, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e,
+0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76, 0x61, 0x6c,
+0x75, 0x65, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x2c, 0x20, 0x28, 0x26, 0x6d, 0x61, 0x6e, 0x74, 0x69,
+0x73, 0x73, 0x61, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x77, 0x68, 0x69,
+0x6c, 0x65, 0x20, 0x28, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+0x20, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x3e,
+0x3d, 0x20, 0x31, 0x30, 0x32, 0x34, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65,
+0x6e, 0x74, 0x20, 0x3d, 0x20, 0x31, 0x30, 0x32, 0x34, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69,
+0x73, 0x73, 0x61, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x69, 0x6f, 0x6e,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20,
+0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x6f, 0x6e,
+0x76, 0x20, 0x3d, 0x20, 0x7b, 0x2e, 0x75, 0x20, 0x3d, 0x20, 0x28, 0x28,
+0x73, 0x69, 0x67, 0x6e, 0x20, 0x26, 0x20, 0x30, 0x78, 0x38, 0x30, 0x30,
+0x30, 0x30, 0x30, 0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x32,
+0x29, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65,
+0x6e, 0x74, 0x20, 0x2b, 0x20, 0x31, 0x30, 0x32, 0x33, 0x29, 0x20, 0x3c,
+0x3c, 0x20, 0x35, 0x32, 0x29, 0x20, 0x7c, 0x20, 0x28, 0x6d, 0x61, 0x6e,
+0x74, 0x69, 0x73, 0x73, 0x61, 0x20, 0x26, 0x20, 0x30, 0x78, 0x30, 0x30,
+0x30, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+0x66, 0x66, 0x75, 0x6c, 0x6c, 0x29, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x76,
+0x2e, 0x66, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69,
+0x63, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c,
+0x65, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x74, 0x6f, 0x5f, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x64, 0x6f,
+0x75, 0x62, 0x6c, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x74, 0x6d, 0x70, 0x2c, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x69, 0x73, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x2c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
+0x75, 0x72, 0x6e, 0x20, 0x30, 0x2e, 0x30, 0x4c, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x20, 0x65, 0x78,
+0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x2c, 0x20, 0x6d, 0x61, 0x6e, 0x74,
+0x69, 0x73, 0x73, 0x61, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f,
+0x20, 0x7b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x30, 0x29, 0x29, 0x20,
+0x7b, 0x20, 0x2a, 0x28, 0x26, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x3d,
+0x20, 0x2d, 0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x73, 0x69, 0x67,
+0x6e, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x3b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67,
+0x6e, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x7d, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20,
+0x2a, 0x28, 0x26, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x3d, 0x20, 0x30,
+0x3b, 0x20, 0x7d, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69,
+0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20,
+0x3d, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x6d, 0x69, 0x6e,
+0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x2a, 0x28, 0x26, 0x65, 0x78,
+0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3d, 0x20, 0x73, 0x69,
+0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x20, 0x69, 0x66,
+0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e,
+0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3e, 0x20, 0x28,
+0x36, 0x34, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x73, 0x77, 0x69, 0x74, 0x63,
+0x68, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61,
+0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x20, 0x7b,
+0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x28, 0x36, 0x34, 0x29, 0x20, 0x2b,
+0x20, 0x31, 0x3a, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74,
+0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b,
+0x3b, 0x20, 0x63, 0x61, 0x73, 0x65, 0x20, 0x28, 0x36, 0x34, 0x29, 0x20,
+0x2b, 0x20, 0x32, 0x3a, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x20,
+0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x3a, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+0x72, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x2d, 0x31, 0x29, 0x3b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67,
+0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x74, 0x6d,
+0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20,
+0x2b, 0x20, 0x28, 0x36, 0x34, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x20, 0x2d,
+0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64,
+0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x61, 0x6e, 0x64, 0x28, 0x28, 0x74, 0x6d,
+0x70, 0x29, 0x2c, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64,
+0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+0x72, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x21, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x69, 0x73,
+0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c,
+0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x29, 0x3b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69,
+0x67, 0x68, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61,
+0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20,
+0x28, 0x28, 0x36, 0x34, 0x29, 0x20, 0x2b, 0x20, 0x32, 0x29, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6f, 0x72, 0x28, 0x28,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x29, 0x2c, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x62, 0x72, 0x65,
+0x61, 0x6b, 0x3b, 0x20, 0x7d, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x76, 0x61, 0x6c, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x28,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c,
+0x20, 0x26, 0x76, 0x61, 0x6c, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69,
+0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67,
+0x65, 0x72, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x28, 0x76, 0x61, 0x6c, 0x20,
+0x26, 0x20, 0x34, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x3b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6f, 0x72,
+0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x29, 0x2c,
+0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x74, 0x69,
+0x6c, 0x5f, 0x61, 0x64, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f,
+0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x65,
+0x64, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69,
+0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f,
+0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x32,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x69, 0x66, 0x20, 0x28, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x62,
+0x69, 0x74, 0x73, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x36, 0x34,
+0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x68,
+0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x31, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x2a,
+0x28, 0x26, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x29,
+0x2b, 0x2b, 0x3b, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65,
+0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69,
+0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20,
+0x21, 0x3d, 0x20, 0x28, 0x36, 0x34, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66,
+0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c,
+0x20, 0x28, 0x36, 0x34, 0x29, 0x20, 0x2d, 0x20, 0x73, 0x69, 0x67, 0x6e,
+0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29,
+0x3b, 0x20, 0x7d, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x28, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x28,
+0x26, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x29, 0x29, 0x3b,
+0x20, 0x7d, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x30, 0x29,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x65, 0x78, 0x70, 0x6f,
+0x6e, 0x65, 0x6e, 0x74, 0x20, 0x3e, 0x3d, 0x20, 0x31, 0x36, 0x33, 0x38,
+0x34, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20,
+0x31, 0x36, 0x33, 0x38, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x20,
+0x3d, 0x20, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x36, 0x33,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x75,
+0x5b, 0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65,
+0x20, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x6f,
+0x6e, 0x76, 0x20, 0x3d, 0x20, 0x7b, 0x2e, 0x75, 0x5b, 0x30, 0x5d, 0x20,
+0x3d, 0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x2c, 0x20,
+0x2e, 0x75, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x69, 0x67,
+0x6e, 0x20, 0x26, 0x20, 0x30, 0x78, 0x38, 0x30, 0x30, 0x30, 0x29, 0x20,
+0x7c, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+0x20, 0x2b, 0x20, 0x31, 0x36, 0x33, 0x38, 0x33, 0x29, 0x20, 0x26, 0x20,
+0x30, 0x78, 0x37, 0x66, 0x66, 0x66, 0x29, 0x7d, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x6f, 0x6e,
+0x76, 0x2e, 0x66, 0x3b, 0x0a, 0x7d, 0x0a, 0x23, 0x20, 0x32, 0x38, 0x38,
+0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x2f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2e, 0x68, 0x22, 0x0a, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75,
+0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x66, 0x6c, 0x6f, 0x61,
+0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c,
+0x6f, 0x61, 0x74, 0x20, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x75, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x20,
+0x3d, 0x20, 0x7b, 0x2e, 0x66, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75,
+0x65, 0x7d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x6e, 0x76,
+0x2e, 0x75, 0x20, 0x26, 0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c,
+0x3c, 0x20, 0x28, 0x38, 0x20, 0x2b, 0x20, 0x32, 0x33, 0x29, 0x29, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x65, 0x78, 0x70,
+0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x75,
+0x20, 0x3e, 0x3e, 0x20, 0x32, 0x33, 0x29, 0x20, 0x26, 0x20, 0x28, 0x28,
+0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x2d,
+0x20, 0x31, 0x29, 0x29, 0x20, 0x2d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x31, 0x32, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x20, 0x3d, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x63, 0x6f, 0x6e,
+0x76, 0x2e, 0x75, 0x20, 0x26, 0x20, 0x28, 0x28, 0x31, 0x75, 0x6c, 0x6c,
+0x20, 0x3c, 0x3c, 0x20, 0x32, 0x33, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29,
+0x29, 0x20, 0x7c, 0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c,
+0x20, 0x32, 0x33, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64,
+0x6f, 0x20, 0x7b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70,
+0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3c, 0x20, 0x30, 0x29, 0x20,
+0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x7a, 0x65, 0x72, 0x6f, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45,
+0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f,
+0x4b, 0x3b, 0x20, 0x7d, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e,
+0x65, 0x6e, 0x74, 0x29, 0x20, 0x3e, 0x3d, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64,
+0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x31, 0x29, 0x3b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c,
+0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49,
+0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x20, 0x7d, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+0x29, 0x20, 0x3c, 0x20, 0x28, 0x32, 0x33, 0x29, 0x29, 0x20, 0x7b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65,
+0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69,
+0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x2c, 0x20, 0x28, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x29,
+0x20, 0x3e, 0x3e, 0x20, 0x28, 0x28, 0x32, 0x33, 0x29, 0x20, 0x2d, 0x20,
+0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x29, 0x29,
+0x3b, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74,
+0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e,
+0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c,
+0x20, 0x28, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x29, 0x29,
+0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x65, 0x78,
+0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x32,
+0x33, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29,
+0x3b, 0x20, 0x7d, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x28, 0x28, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x77, 0x68, 0x69,
+0x6c, 0x65, 0x20, 0x28, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b,
+0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47,
+0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73,
+0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73,
+0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x66,
+0x6c, 0x6f, 0x61, 0x74, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c,
+0x6f, 0x61, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x66,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x20, 0x3d, 0x20, 0x7b, 0x2e, 0x66,
+0x20, 0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x7d, 0x3b, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69, 0x67, 0x6e,
+0x20, 0x3d, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x75, 0x20, 0x26, 0x20,
+0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x28, 0x38, 0x20,
+0x2b, 0x20, 0x32, 0x33, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+0x28, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x75, 0x20, 0x3e, 0x3e, 0x20, 0x32,
+0x33, 0x29, 0x20, 0x26, 0x20, 0x28, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20,
+0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, 0x20,
+0x2d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x32,
+0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x61, 0x6e, 0x74,
+0x69, 0x73, 0x73, 0x61, 0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x28, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x75, 0x20, 0x26,
+0x20, 0x28, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x32,
+0x33, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, 0x20, 0x7c, 0x20, 0x28,
+0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x33, 0x29, 0x3b,
+0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x20, 0x7b, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+0x29, 0x20, 0x3c, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28,
+0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x72, 0x65, 0x74, 0x75,
+0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42,
+0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x20, 0x7d, 0x20,
+0x69, 0x66, 0x20, 0x28, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29,
+0x20, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20,
+0x3e, 0x3d, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x20,
+0x7b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x29,
+0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x31, 0x29, 0x3b, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74,
+0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x20, 0x2d, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x7a,
+0x65, 0x72, 0x6f, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x7d, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b,
+0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f,
+0x4f, 0x4b, 0x3b, 0x20, 0x7d, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x65,
+0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3c, 0x20, 0x28,
+0x32, 0x33, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64,
+0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x28, 0x6d, 0x61,
+0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x28,
+0x28, 0x32, 0x33, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x65, 0x78, 0x70, 0x6f,
+0x6e, 0x65, 0x6e, 0x74, 0x29, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x65,
+0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x28, 0x6d, 0x61, 0x6e,
+0x74, 0x69, 0x73, 0x73, 0x61, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f,
+0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x29, 0x2c, 0x20, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+0x74, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x32, 0x33, 0x29, 0x2c, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x65, 0x67,
+0x61, 0x74, 0x65, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x7d, 0x20, 0x7d, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x30,
+0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f,
+0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54,
+0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x23, 0x20, 0x33, 0x34, 0x35,
+0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x2f, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2e, 0x68, 0x22, 0x0a, 0x73, 0x74,
+0x61, 0x74, 0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75,
+0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x64, 0x6f, 0x75, 0x62,
+0x6c, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c,
+0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x69, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x66, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20,
+0x63, 0x6f, 0x6e, 0x76, 0x20, 0x3d, 0x20, 0x7b, 0x2e, 0x66, 0x20, 0x3d,
+0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x7d, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x3d,
+0x20, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x75, 0x20, 0x26, 0x20, 0x28, 0x31,
+0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x28, 0x31, 0x31, 0x20, 0x2b,
+0x20, 0x35, 0x32, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20,
+0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28,
+0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x75, 0x20, 0x3e, 0x3e, 0x20, 0x35, 0x32,
+0x29, 0x20, 0x26, 0x20, 0x28, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c,
+0x3c, 0x20, 0x31, 0x31, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, 0x20,
+0x2d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x30,
+0x32, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x61, 0x6e,
+0x74, 0x69, 0x73, 0x73, 0x61, 0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x28, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x75, 0x20,
+0x26, 0x20, 0x28, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20,
+0x35, 0x32, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, 0x20, 0x7c, 0x20,
+0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x35, 0x32, 0x29,
+0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x20, 0x7b, 0x20,
+0x69, 0x66, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+0x74, 0x29, 0x20, 0x3c, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f,
+0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x72, 0x65, 0x74,
+0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f,
+0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x20, 0x7d,
+0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x29, 0x20, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29,
+0x20, 0x3e, 0x3d, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29,
+0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x2c, 0x20, 0x31, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f,
+0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20,
+0x2d, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x29, 0x3b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f,
+0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54,
+0x5f, 0x4f, 0x4b, 0x3b, 0x20, 0x7d, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28,
+0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3c, 0x20,
+0x28, 0x35, 0x32, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69,
+0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67,
+0x65, 0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c,
+0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x28, 0x6d,
+0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x29, 0x20, 0x3e, 0x3e, 0x20,
+0x28, 0x28, 0x35, 0x32, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x65, 0x78, 0x70,
+0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20,
+0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64,
+0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65,
+0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x28, 0x6d, 0x61,
+0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x29, 0x29, 0x3b, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74,
+0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65,
+0x6e, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x35, 0x32, 0x29, 0x2c, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20,
+0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x29, 0x20, 0x7b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x65,
+0x67, 0x61, 0x74, 0x65, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x7d, 0x20, 0x7d, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28,
+0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x0a, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f,
+0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54,
+0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74,
+0x69, 0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+0x5f, 0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x64, 0x6f, 0x75, 0x62,
+0x6c, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x75,
+0x62, 0x6c, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65,
+0x20, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x75, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x20, 0x3d, 0x20, 0x7b,
+0x2e, 0x66, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x7d, 0x3b,
+0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69,
+0x67, 0x6e, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x75, 0x20,
+0x26, 0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x28,
+0x31, 0x31, 0x20, 0x2b, 0x20, 0x35, 0x32, 0x29, 0x29, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e,
+0x65, 0x6e, 0x74, 0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x28, 0x28, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x75, 0x20, 0x3e,
+0x3e, 0x20, 0x35, 0x32, 0x29, 0x20, 0x26, 0x20, 0x28, 0x28, 0x31, 0x75,
+0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x31, 0x29, 0x20, 0x2d, 0x20,
+0x31, 0x29, 0x29, 0x20, 0x2d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x31, 0x30, 0x32, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x20, 0x3d, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x63, 0x6f, 0x6e,
+0x76, 0x2e, 0x75, 0x20, 0x26, 0x20, 0x28, 0x28, 0x31, 0x75, 0x6c, 0x6c,
+0x20, 0x3c, 0x3c, 0x20, 0x35, 0x32, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29,
+0x29, 0x20, 0x7c, 0x20, 0x28, 0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c,
+0x20, 0x35, 0x32, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64,
+0x6f, 0x20, 0x7b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70,
+0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3c, 0x20, 0x30, 0x29, 0x20,
+0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x7a, 0x65, 0x72, 0x6f, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45,
+0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f,
+0x4b, 0x3b, 0x20, 0x7d, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e,
+0x65, 0x6e, 0x74, 0x29, 0x20, 0x3e, 0x3d, 0x20, 0x28, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28,
+0x73, 0x69, 0x67, 0x6e, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65,
+0x67, 0x65, 0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x31,
+0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28,
+0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x2c, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x65,
+0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x28, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49,
+0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x20, 0x7d, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74,
+0x29, 0x20, 0x3c, 0x20, 0x28, 0x35, 0x32, 0x29, 0x29, 0x20, 0x7b, 0x20,
+0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65,
+0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69,
+0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x2c, 0x20, 0x28, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x29,
+0x20, 0x3e, 0x3e, 0x20, 0x28, 0x28, 0x35, 0x32, 0x29, 0x20, 0x2d, 0x20,
+0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x29, 0x29,
+0x3b, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74,
+0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e,
+0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c,
+0x20, 0x28, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x29, 0x29,
+0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x65, 0x78,
+0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x35,
+0x32, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29,
+0x3b, 0x20, 0x7d, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e,
+0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x28, 0x28, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x77, 0x68, 0x69,
+0x6c, 0x65, 0x20, 0x28, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74,
+0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f,
+0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x0a, 0x7d,
+0x0a, 0x23, 0x20, 0x34, 0x30, 0x31, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65,
+0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+0x2e, 0x68, 0x22, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f, 0x74, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x66, 0x72, 0x6f,
+0x6d, 0x5f, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x64, 0x6f, 0x75, 0x62, 0x6c,
+0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x75,
+0x62, 0x6c, 0x65, 0x20, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x75, 0x5b,
+0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x6f,
+0x6e, 0x76, 0x20, 0x3d, 0x20, 0x7b, 0x2e, 0x66, 0x20, 0x3d, 0x20, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x7d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x3d, 0x20, 0x63,
+0x6f, 0x6e, 0x76, 0x2e, 0x75, 0x5b, 0x31, 0x5d, 0x20, 0x26, 0x20, 0x28,
+0x31, 0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x35, 0x29, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x65, 0x78, 0x70,
+0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6e,
+0x76, 0x2e, 0x75, 0x5b, 0x31, 0x5d, 0x20, 0x26, 0x20, 0x28, 0x28, 0x31,
+0x75, 0x6c, 0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x35, 0x29, 0x20, 0x2d,
+0x20, 0x31, 0x29, 0x29, 0x20, 0x2d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x36,
+0x33, 0x38, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x61,
+0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x6e,
+0x76, 0x2e, 0x75, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x64, 0x6f, 0x20, 0x7b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x65,
+0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3c, 0x20, 0x30,
+0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x29, 0x3b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f,
+0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54,
+0x5f, 0x4f, 0x4b, 0x3b, 0x20, 0x7d, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x65, 0x78, 0x70,
+0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3e, 0x3d, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f,
+0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65,
+0x67, 0x65, 0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x31,
+0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28,
+0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x2c, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x72, 0x65, 0x74,
+0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f,
+0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x20, 0x7d,
+0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65,
+0x6e, 0x74, 0x29, 0x20, 0x3c, 0x20, 0x28, 0x36, 0x33, 0x29, 0x29, 0x20,
+0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x2c, 0x20, 0x28, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73,
+0x61, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x28, 0x28, 0x36, 0x33, 0x29, 0x20,
+0x2d, 0x20, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29,
+0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73,
+0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f,
+0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x2c, 0x20, 0x28, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61,
+0x29, 0x29, 0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f,
+0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x5f, 0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74,
+0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28,
+0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x2d, 0x20,
+0x28, 0x36, 0x33, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69,
+0x67, 0x6e, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x28, 0x28,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x77,
+0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b,
+0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f,
+0x4f, 0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69,
+0x63, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x5f,
+0x74, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x5f, 0x66, 0x72, 0x6f, 0x6d, 0x5f, 0x6c, 0x6f, 0x6e, 0x67, 0x5f,
+0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64,
+0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x69,
+0x6f, 0x6e, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65,
+0x20, 0x66, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x75, 0x5b, 0x32, 0x5d, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x20,
+0x3d, 0x20, 0x7b, 0x2e, 0x66, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x6c, 0x75,
+0x65, 0x7d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x6e, 0x76,
+0x2e, 0x75, 0x5b, 0x31, 0x5d, 0x20, 0x26, 0x20, 0x28, 0x31, 0x75, 0x6c,
+0x6c, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65,
+0x6e, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x75,
+0x5b, 0x31, 0x5d, 0x20, 0x26, 0x20, 0x28, 0x28, 0x31, 0x75, 0x6c, 0x6c,
+0x20, 0x3c, 0x3c, 0x20, 0x31, 0x35, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29,
+0x29, 0x20, 0x2d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x36, 0x33, 0x38, 0x33,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x61, 0x6e, 0x74, 0x69,
+0x73, 0x73, 0x61, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x2e, 0x75,
+0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f,
+0x20, 0x7b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x65, 0x78, 0x70, 0x6f,
+0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x3c, 0x20, 0x30, 0x29, 0x20, 0x7b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x7a,
+0x65, 0x72, 0x6f, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29,
+0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20,
+0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46,
+0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b,
+0x3b, 0x20, 0x7d, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x29, 0x20, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65,
+0x6e, 0x74, 0x29, 0x20, 0x3e, 0x3d, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x73,
+0x69, 0x67, 0x6e, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69,
+0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74, 0x65, 0x67,
+0x65, 0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c,
+0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20, 0x31, 0x29,
+0x3b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b,
+0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f,
+0x6c, 0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x2c, 0x20, 0x28, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x65, 0x6c,
+0x73, 0x65, 0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20,
+0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69,
+0x6e, 0x74, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x28, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+0x20, 0x5f, 0x5f, 0x4b, 0x45, 0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47,
+0x49, 0x4e, 0x54, 0x5f, 0x4f, 0x4b, 0x3b, 0x20, 0x7d, 0x20, 0x69, 0x66,
+0x20, 0x28, 0x28, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29,
+0x20, 0x3c, 0x20, 0x28, 0x36, 0x33, 0x29, 0x29, 0x20, 0x7b, 0x20, 0x28,
+0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74,
+0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e,
+0x74, 0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c,
+0x20, 0x28, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x29, 0x20,
+0x3e, 0x3e, 0x20, 0x28, 0x28, 0x36, 0x33, 0x29, 0x20, 0x2d, 0x20, 0x28,
+0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x29, 0x29, 0x3b,
+0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x20, 0x28, 0x76,
+0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x73, 0x65, 0x74, 0x5f,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x69, 0x6e, 0x74,
+0x65, 0x67, 0x65, 0x72, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2c, 0x20,
+0x28, 0x6d, 0x61, 0x6e, 0x74, 0x69, 0x73, 0x73, 0x61, 0x29, 0x29, 0x3b,
+0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f, 0x6b, 0x65,
+0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c,
+0x65, 0x66, 0x74, 0x5f, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x28, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x65, 0x78, 0x70,
+0x6f, 0x6e, 0x65, 0x6e, 0x74, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x36, 0x33,
+0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x29, 0x3b,
+0x20, 0x7d, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x67, 0x6e, 0x29,
+0x20, 0x7b, 0x20, 0x28, 0x76, 0x6f, 0x69, 0x64, 0x29, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x65, 0x28, 0x28, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x29, 0x2c, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x29, 0x3b, 0x20, 0x7d, 0x20, 0x7d, 0x20, 0x77, 0x68, 0x69, 0x6c,
+0x65, 0x20, 0x28, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x4b, 0x45,
+0x46, 0x49, 0x52, 0x5f, 0x42, 0x49, 0x47, 0x49, 0x4e, 0x54, 0x5f, 0x4f,
+0x4b, 0x3b, 0x0a, 0x7d, 0x0a, 0x23, 0x20, 0x34, 0x34, 0x20, 0x22, 0x2e,
+0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66,
+0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68, 0x22, 0x20, 0x32, 0x0a, 0x23, 0x20,
+0x31, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
+0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x2f, 0x62, 0x69, 0x74, 0x73, 0x2e, 0x68, 0x22, 0x20, 0x31, 0x0a,
+0x23, 0x20, 0x33, 0x35, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64,
+0x65, 0x72, 0x73, 0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69,
+0x67, 0x69, 0x6e, 0x74, 0x2f, 0x62, 0x69, 0x74, 0x73, 0x2e, 0x68, 0x22,
+0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62,
+0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6c, 0x65, 0x61, 0x73, 0x74, 0x5f,
+0x73, 0x69, 0x67, 0x6e, 0x69, 0x66, 0x69, 0x63, 0x61, 0x6e, 0x74, 0x5f,
+0x6e, 0x6f, 0x6e, 0x7a, 0x65, 0x72, 0x6f, 0x28, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63,
+0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74, 0x61,
+0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x28,
+0x28, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20, 0x28,
+0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x73,
+0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20,
+0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x20, 0x3d, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69,
+0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x3d, 0x20,
+0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75,
+0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x69, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74,
+0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3f, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x20, 0x3a, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20,
+0x2d, 0x20, 0x28, 0x28, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2a, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6a, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x6a, 0x20, 0x3c,
+0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x3b, 0x20, 0x6a, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x28, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3e, 0x3e, 0x20,
+0x6a, 0x29, 0x20, 0x26, 0x20, 0x31, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x31,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75,
+0x72, 0x6e, 0x20, 0x69, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2b,
+0x20, 0x6a, 0x20, 0x2b, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+0x6e, 0x20, 0x30, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74,
+0x69, 0x63, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f,
+0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74,
+0x5f, 0x6c, 0x65, 0x61, 0x64, 0x69, 0x6e, 0x67, 0x5f, 0x7a, 0x65, 0x72,
+0x6f, 0x73, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x76,
+0x61, 0x6c, 0x75, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x69, 0x66, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x3d,
+0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x64, 0x65, 0x66,
+0x61, 0x75, 0x6c, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29,
+0x20, 0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72,
+0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20,
+0x2f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f,
+0x72, 0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20,
+0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74,
+0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69,
+0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73,
+0x5b, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x73, 0x20, 0x2d, 0x20, 0x69, 0x20, 0x2d, 0x20, 0x31, 0x5d, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+0x20, 0x3e, 0x20, 0x30, 0x20, 0x3f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x3a,
+0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x28, 0x28, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20,
+0x2d, 0x20, 0x31, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65,
+0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6a, 0x20, 0x3d,
+0x20, 0x30, 0x3b, 0x20, 0x6a, 0x20, 0x3c, 0x20, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3b, 0x20, 0x6a, 0x2b, 0x2b,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x62,
+0x69, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20,
+0x3e, 0x3e, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x6a, 0x20, 0x2d, 0x20, 0x31, 0x29,
+0x29, 0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62,
+0x69, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x6f,
+0x75, 0x6e, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20,
+0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2b,
+0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x64, 0x65, 0x66,
+0x61, 0x75, 0x6c, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x0a,
+0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72,
+0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x74, 0x72, 0x61, 0x69,
+0x6c, 0x69, 0x6e, 0x67, 0x5f, 0x7a, 0x65, 0x72, 0x6f, 0x73, 0x28, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x5f, 0x76, 0x61, 0x6c,
+0x75, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x20, 0x30,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75,
+0x6c, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f,
+0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d,
+0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b,
+0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20,
+0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d,
+0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20,
+0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x20, 0x3d, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x69,
+0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3d, 0x3d, 0x20,
+0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x2b,
+0x3d, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69,
+0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x69, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3c, 0x20, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20,
+0x3f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x3a, 0x20, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x20, 0x2d, 0x20, 0x28, 0x28, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20,
+0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6a, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x6a,
+0x20, 0x3c, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x3b, 0x20, 0x6a, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x69, 0x74, 0x20, 0x3d, 0x20,
+0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3e, 0x3e, 0x20, 0x6a, 0x29,
+0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x69,
+0x74, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x6f, 0x75,
+0x6e, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2b, 0x2b,
+0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x64, 0x65, 0x66, 0x61,
+0x75, 0x6c, 0x74, 0x5f, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x3b, 0x0a, 0x7d,
+0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f,
+0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x72, 0x65, 0x64, 0x75, 0x6e,
+0x64, 0x61, 0x6e, 0x74, 0x5f, 0x73, 0x69, 0x67, 0x6e, 0x5f, 0x62, 0x69,
+0x74, 0x73, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x74,
+0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20,
+0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20, 0x2b, 0x20,
+0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a,
+0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f, 0x20, 0x28,
+0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20,
+0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d, 0x73,
+0x62, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65,
+0x78, 0x20, 0x3d, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69,
+0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69,
+0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65,
+0x74, 0x20, 0x3d, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20,
+0x31, 0x20, 0x2d, 0x20, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x2a, 0x20, 0x28, 0x73,
+0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38,
+0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e,
+0x74, 0x20, 0x6d, 0x73, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x73, 0x5b, 0x6d, 0x73, 0x62, 0x5f, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x20, 0x3e, 0x3e, 0x20,
+0x6d, 0x73, 0x62, 0x5f, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x29, 0x20,
+0x26, 0x20, 0x31, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d,
+0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d, 0x20,
+0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c,
+0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b, 0x2b,
+0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x20, 0x3d, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20,
+0x2d, 0x20, 0x69, 0x20, 0x2d, 0x20, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e,
+0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x20, 0x3e,
+0x20, 0x30, 0x20, 0x3f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x3a, 0x20, 0x77,
+0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x28, 0x28, 0x74, 0x6f, 0x74,
+0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20,
+0x31, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68,
+0x61, 0x72, 0x29, 0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6a, 0x20, 0x3d, 0x20,
+0x30, 0x3b, 0x20, 0x6a, 0x20, 0x3c, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74,
+0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3b, 0x20, 0x6a, 0x2b, 0x2b, 0x29,
+0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x69,
+0x74, 0x20, 0x3d, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3e,
+0x3e, 0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64,
+0x74, 0x68, 0x20, 0x2d, 0x20, 0x6a, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29,
+0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x69,
+0x74, 0x20, 0x3d, 0x3d, 0x20, 0x6d, 0x73, 0x62, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2b, 0x2b, 0x3b,
+0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x6f, 0x75,
+0x6e, 0x74, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+0x6e, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x2d, 0x20, 0x31, 0x3b,
+0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x6f, 0x6e,
+0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x28, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+0x66, 0x20, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x3d, 0x20,
+0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x3b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20,
+0x3d, 0x20, 0x28, 0x28, 0x28, 0x77, 0x69, 0x64, 0x74, 0x68, 0x29, 0x20,
+0x2b, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x2f,
+0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e, 0x73,
+0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29, 0x20,
+0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x75,
+0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20,
+0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+0x20, 0x28, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c,
+0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x69, 0x20, 0x3d,
+0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x74, 0x6f, 0x74, 0x61,
+0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x3b, 0x20, 0x69, 0x2b,
+0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67,
+0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x64, 0x69, 0x67,
+0x69, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x5b,
+0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x20, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x69, 0x20, 0x2b, 0x20, 0x31, 0x20, 0x3c, 0x20, 0x74,
+0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20,
+0x3f, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x20, 0x3a, 0x20, 0x77, 0x69, 0x64, 0x74,
+0x68, 0x20, 0x2d, 0x20, 0x28, 0x28, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f,
+0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x20,
+0x2a, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x6f, 0x66, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x29,
+0x20, 0x2a, 0x20, 0x38, 0x29, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x6e,
+0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6a, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20,
+0x6a, 0x20, 0x3c, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x5f, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x3b, 0x20, 0x6a, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x69, 0x74, 0x20, 0x3d,
+0x20, 0x28, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x3e, 0x3e, 0x20, 0x6a,
+0x29, 0x20, 0x26, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62,
+0x69, 0x74, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2b, 0x2b, 0x3b, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b,
+0x0a, 0x7d, 0x0a, 0x0a, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x20, 0x69,
+0x6e, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e,
+0x65, 0x64, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
+0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67,
+0x69, 0x6e, 0x74, 0x5f, 0x70, 0x61, 0x72, 0x69, 0x74, 0x79, 0x28, 0x63,
+0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
+0x64, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x64, 0x69, 0x67, 0x69,
+0x74, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+0x20, 0x20, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x77, 0x69,
+0x64, 0x74, 0x68, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x6b, 0x65, 0x66, 0x69,
+0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x6e, 0x6f, 0x6e,
+0x7a, 0x65, 0x72, 0x6f, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x28, 0x64,
+0x69, 0x67, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68,
+0x29, 0x20, 0x25, 0x20, 0x32, 0x3b, 0x0a, 0x7d, 0x0a, 0x23, 0x20, 0x34,
+0x35, 0x20, 0x22, 0x2e, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73,
+0x2f, 0x6b, 0x65, 0x66, 0x69, 0x72, 0x5f, 0x62, 0x69, 0x67, 0x69, 0x6e,
+0x74, 0x2f, 0x62, 0x69, 0x67, 0x69, 0x6e, 0x74, 0x2e, 0x68, 0x22, 0x20,
+0x32, 0x0a
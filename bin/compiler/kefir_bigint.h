@@ -0,0 +1,1409 @@
+# 0 "./headers/kefir_bigint/bigint.h"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./headers/kefir_bigint/bigint.h"
+# 33 "./headers/kefir_bigint/bigint.h"
+# 1 "./headers/kefir_bigint/base.h" 1
+# 92 "./headers/kefir_bigint/base.h"
+typedef enum { __KEFIR_BIGINT_OK, __KEFIR_BIGINT_DIVISION_BY_ZERO } __kefir_bigint_result_t;
+
+
+
+
+
+
+static unsigned long long __kefir_bigint_native_signed_width(long long);
+static unsigned long long __kefir_bigint_native_unsigned_width(unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_get_signed_value(const unsigned char *, unsigned long long,
+                                                               long long *);
+static __kefir_bigint_result_t __kefir_bigint_get_unsigned_value(const unsigned char *, unsigned long long,
+                                                                 unsigned long long *);
+static unsigned int __kefir_bigint_get_sign(const unsigned char *, unsigned long long);
+static unsigned int __kefir_bigint_is_zero(const unsigned char *, unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_set_bits(unsigned char *, unsigned long long,
+                                                       unsigned long long, unsigned long long,
+                                                       unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_cast_signed(unsigned char *, unsigned long long,
+                                                          unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_cast_unsigned(unsigned char *, unsigned long long,
+                                                            unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_set_signed_integer(unsigned char *, unsigned long long,
+                                                                 unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_set_unsigned_integer(unsigned char *, unsigned long long,
+                                                                   unsigned long long);
+
+static __kefir_bigint_result_t __kefir_bigint_util_add_digit_zero_extended(unsigned char *,
+                                                                           unsigned char,
+                                                                           unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_negate(unsigned char *, unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_add(unsigned char *, const unsigned char *,
+                                                  unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_add_zero_extend(unsigned char *, const unsigned char *,
+                                                              unsigned long long, unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_subtract(unsigned char *, const unsigned char *,
+                                                       unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_subtract_zero_extend(unsigned char *,
+                                                                   const unsigned char *,
+                                                                   unsigned long long, unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_invert(unsigned char *, unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_or(unsigned char *, const unsigned char *,
+                                                 unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_and(unsigned char *, const unsigned char *,
+                                                  unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_xor(unsigned char *, const unsigned char *,
+                                                  unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_left_shift(unsigned char *, unsigned long long,
+                                                         unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_right_shift(unsigned char *, unsigned long long,
+                                                          unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_arithmetic_right_shift(unsigned char *, unsigned long long,
+                                                                     unsigned long long);
+
+static __kefir_bigint_result_t __kefir_bigint_left_shift_whole_digits(unsigned char *,
+                                                                      unsigned long long,
+                                                                      unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_right_shift_whole_digits(unsigned char *,
+                                                                       unsigned long long,
+                                                                       unsigned int, unsigned long long);
+
+static __kefir_bigint_result_t __kefir_bigint_zero(unsigned char *, unsigned long long);
+
+static __kefir_bigint_result_t __kefir_bigint_copy(unsigned char *, const unsigned char *,
+                                                   unsigned long long);
+
+static __kefir_bigint_result_t __kefir_bigint_unsigned_multiply(unsigned char *,
+                                                                const unsigned char *,
+                                                                const unsigned char *, unsigned long long,
+                                                                unsigned long long);
+
+static __kefir_bigint_result_t __kefir_bigint_signed_multiply(unsigned char *, unsigned char *,
+                                                              unsigned char *, const unsigned char *,
+                                                              unsigned long long, unsigned long long);
+
+static __kefir_bigint_result_t __kefir_bigint_unsigned_divide(unsigned char *, unsigned char *,
+                                                              const unsigned char *, unsigned long long,
+                                                              unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_signed_divide(unsigned char *, unsigned char *,
+                                                            unsigned char *, unsigned long long,
+                                                            unsigned long long);
+static unsigned int __kefir_bigint_unsigned_compare(const unsigned char *,
+                                                             const unsigned char *, unsigned long long);
+static unsigned int __kefir_bigint_signed_compare(const unsigned char *,
+                                                           const unsigned char *, unsigned long long);
+
+static float __kefir_bigint_signed_to_float(unsigned char *, unsigned char *,
+                                                             unsigned long long);
+static double __kefir_bigint_signed_to_double(unsigned char *, unsigned char *,
+                                                               unsigned long long);
+static long double __kefir_bigint_signed_to_long_double(unsigned char *,
+                                                                         unsigned char *,
+                                                                         unsigned long long);
+
+static float __kefir_bigint_unsigned_to_float(unsigned char *, unsigned char *,
+                                                               unsigned long long);
+static double __kefir_bigint_unsigned_to_double(unsigned char *, unsigned char *,
+                                                                 unsigned long long);
+static long double __kefir_bigint_unsigned_to_long_double(unsigned char *,
+                                                                           unsigned char *,
+                                                                           unsigned long long);
+
+static __kefir_bigint_result_t __kefir_bigint_signed_from_float(unsigned char *, float,
+                                                                unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_signed_from_double(unsigned char *, double,
+                                                                 unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_signed_from_long_double(unsigned char *,
+                                                                      long double,
+                                                                      unsigned long long);
+
+static __kefir_bigint_result_t __kefir_bigint_unsigned_from_float(unsigned char *, float,
+                                                                  unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_unsigned_from_double(unsigned char *, double,
+                                                                   unsigned long long);
+static __kefir_bigint_result_t __kefir_bigint_unsigned_from_long_double(unsigned char *,
+                                                                        long double,
+                                                                        unsigned long long);
+
+static unsigned long long __kefir_bigint_least_significant_nonzero(const unsigned char *,
+                                                                       unsigned long long);
+static unsigned long long __kefir_bigint_leading_zeros(const unsigned char *, unsigned long long,
+                                                           unsigned long long);
+static unsigned long long __kefir_bigint_trailing_zeros(const unsigned char *, unsigned long long,
+                                                            unsigned long long);
+static unsigned long long __kefir_bigint_redundant_sign_bits(const unsigned char *,
+                                                                 unsigned long long);
+static unsigned long long __kefir_bigint_nonzero_count(const unsigned char *, unsigned long long);
+static unsigned long long __kefir_bigint_parity(const unsigned char *, unsigned long long);
+# 34 "./headers/kefir_bigint/bigint.h" 2
+# 1 "./headers/kefir_bigint/init.h" 1
+# 35 "./headers/kefir_bigint/init.h"
+static __kefir_bigint_result_t __kefir_bigint_set_signed_integer(unsigned char *digits,
+                                                                 unsigned long long width,
+                                                                 unsigned long long value) {
+    if (width == 0) {
+        return __KEFIR_BIGINT_OK;
+    }
+
+    unsigned long long fit_width = width;
+    if (fit_width > (sizeof(long long) * 8)) {
+        fit_width = (sizeof(long long) * 8);
+    }
+
+    const unsigned long long total_digits = (((fit_width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    for (unsigned long long i = 0; i < total_digits; i++, value >>= (sizeof(unsigned char) * 8)) {
+        digits[i] = (unsigned char) value;
+    }
+
+    if (fit_width < width) {
+        (void) __kefir_bigint_cast_signed(digits, fit_width, width);
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_set_unsigned_integer(unsigned char *digits,
+                                                                   unsigned long long width,
+                                                                   unsigned long long value) {
+    if (width == 0) {
+        return __KEFIR_BIGINT_OK;
+    }
+
+    unsigned long long fit_width = width;
+    if (fit_width > (sizeof(long long) * 8)) {
+        fit_width = (sizeof(long long) * 8);
+    }
+
+    const unsigned long long total_digits = (((fit_width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    for (unsigned long long i = 0; i < total_digits; i++, value >>= (sizeof(unsigned char) * 8)) {
+        digits[i] = (unsigned char) value;
+    }
+
+    if (fit_width < width) {
+        (void) __kefir_bigint_cast_unsigned(digits, fit_width, width);
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static inline __kefir_bigint_result_t __kefir_bigint_zero(unsigned char *digits,
+                                                          unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        digits[i] = (unsigned char) 0;
+    }
+    return __KEFIR_BIGINT_OK;
+}
+
+static inline __kefir_bigint_result_t __kefir_bigint_copy(unsigned char *dst_digits,
+                                                          const unsigned char *src_digits,
+                                                          unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        dst_digits[i] = src_digits[i];
+    }
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_set_bits(unsigned char *digits,
+                                                       unsigned long long value,
+                                                       unsigned long long offset, unsigned long long length,
+                                                       unsigned long long width) {
+    if (width == 0 || offset >= width) {
+        return __KEFIR_BIGINT_OK;
+    }
+
+    unsigned long long iter = offset;
+    unsigned long long end = offset + length;
+    if (end > width) {
+        end = width;
+    }
+
+    for (; iter < end;) {
+        unsigned long long chunk_end =
+            iter % (sizeof(unsigned char) * 8) != 0
+                ? (iter + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8) * (sizeof(unsigned char) * 8)
+                : iter + (sizeof(unsigned char) * 8);
+        if (chunk_end > end) {
+            chunk_end = end;
+        }
+        const unsigned long long chunk_width = chunk_end - iter;
+        const unsigned int chunk_mask = (1ull << chunk_width) - 1;
+        const unsigned int chunk = value & chunk_mask;
+        const unsigned long long target_index = iter / (sizeof(unsigned char) * 8);
+        const unsigned long long target_offset = iter - target_index * (sizeof(unsigned char) * 8);
+
+        if (chunk_width < (sizeof(unsigned char) * 8)) {
+            digits[target_index] &= ~(chunk_mask << target_offset);
+            digits[target_index] |= chunk << target_offset;
+        } else {
+            digits[target_index] = chunk << target_offset;
+        }
+
+        iter = chunk_end;
+        value >>= chunk_width;
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+# 35 "./headers/kefir_bigint/bigint.h" 2
+# 1 "./headers/kefir_bigint/get.h" 1
+# 35 "./headers/kefir_bigint/get.h"
+static unsigned long long __kefir_bigint_native_signed_width(long long value) {
+    unsigned long long uvalue = (unsigned long long) value;
+    const unsigned long long mask = (1ull << ((sizeof(long long) * 8) - 1));
+    const unsigned long long msb = uvalue & mask;
+    unsigned long long bits = (sizeof(long long) * 8) + 1;
+    for (; bits > 1 && (uvalue & mask) == msb; uvalue <<= 1, bits--) {}
+    return bits;
+}
+
+static unsigned long long __kefir_bigint_native_unsigned_width(unsigned long long value) {
+    unsigned long long bits = 0;
+    for (; value != 0; value >>= 1, bits++) {}
+    if (bits == 0) {
+        bits = 1;
+    }
+    return bits;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_get_signed_value(const unsigned char *digits,
+                                                               unsigned long long width,
+                                                               long long *value_ptr) {
+    if (width > (sizeof(long long) * 8)) {
+        width = (sizeof(long long) * 8);
+    }
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+
+    unsigned long long value = 0;
+    for (unsigned long long i = total_digits; i > 0; i--) {
+        value <<= (sizeof(unsigned char) * 8);
+        value |= digits[i - 1];
+    }
+
+    if (width < (sizeof(long long) * 8)) {
+        const unsigned int sign = width > 0 ? (value >> (width - 1)) & 1 : 0;
+
+        if (sign) {
+            const unsigned long long mask = ~((1ull << width) - 1);
+            value |= mask;
+        } else {
+            const unsigned long long mask = (1ull << width) - 1;
+            value &= mask;
+        }
+    }
+
+    *value_ptr = value;
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_get_unsigned_value(const unsigned char *digits,
+                                                                 unsigned long long width,
+                                                                 unsigned long long *value_ptr) {
+    if (width > (sizeof(long long) * 8)) {
+        width = (sizeof(long long) * 8);
+    }
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+
+    unsigned long long value = 0;
+    for (unsigned long long i = total_digits; i > 0; i--) {
+        value <<= (sizeof(unsigned char) * 8);
+        value |= digits[i - 1];
+    }
+
+    if (width < (sizeof(long long) * 8)) {
+        const unsigned long long mask = (1ull << width) - 1;
+        value &= mask;
+    }
+
+    *value_ptr = value;
+    return __KEFIR_BIGINT_OK;
+}
+
+static unsigned int __kefir_bigint_get_sign(const unsigned char *digits,
+                                                     unsigned long long width) {
+    if (width == 0) {
+        return 0;
+    }
+
+    const unsigned long long msb_index = (width - 1) / (sizeof(unsigned char) * 8);
+    const unsigned long long msb_offset = width - 1 - msb_index * (sizeof(unsigned char) * 8);
+    return (digits[msb_index] >> msb_offset) & 1;
+}
+
+static unsigned int __kefir_bigint_is_zero(const unsigned char *digits,
+                                                    unsigned long long width) {
+    if (width == 0) {
+        return 1;
+    }
+
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        unsigned char digit = digits[i];
+        if (i + 1 == total_digits) {
+            const unsigned long long msb_index = (width - 1) / (sizeof(unsigned char) * 8);
+            const unsigned long long msb_offset = width - 1 - msb_index * (sizeof(unsigned char) * 8);
+            const unsigned int mask = (1ull << (msb_offset + 1)) - 1;
+            digit &= mask;
+        }
+        if (digit) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static unsigned long long __kefir_bigint_get_bits(unsigned char *digits,
+                                                               unsigned long long offset,
+                                                               unsigned long long length,
+                                                               unsigned long long width) {
+    unsigned long long iter = offset;
+    unsigned long long end = offset + length;
+    if (end > width) {
+        end = width;
+    }
+
+    unsigned long long value = 0;
+    for (; iter < end;) {
+        unsigned long long chunk_end =
+            iter % (sizeof(unsigned char) * 8) != 0
+                ? (iter + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8) * (sizeof(unsigned char) * 8)
+                : iter + (sizeof(unsigned char) * 8);
+        if (chunk_end > end) {
+            chunk_end = end;
+        }
+        const unsigned long long chunk_width = chunk_end - iter;
+        const unsigned int chunk_mask = (1ull << chunk_width) - 1;
+        const unsigned long long target_index = iter / (sizeof(unsigned char) * 8);
+        const unsigned long long target_offset = iter - target_index * (sizeof(unsigned char) * 8);
+        const unsigned long long chunk = (digits[target_index] >> target_offset) & chunk_mask;
+
+        value |= chunk << (iter - offset);
+        iter = chunk_end;
+    }
+
+    return value;
+}
+
+static unsigned long long __kefir_bigint_get_min_unsigned_width(unsigned char *digits,
+                                                                    unsigned long long width) {
+    unsigned long long minwidth = width;
+
+    for (; minwidth - 1 > 0; minwidth--) {
+        const unsigned long long index = (minwidth - 1) / (sizeof(unsigned char) * 8);
+        const unsigned long long offset = (minwidth - 1) - index * (sizeof(unsigned char) * 8);
+        const unsigned int value = (digits[index] >> offset) & 1;
+        if (value) {
+            break;
+        }
+    }
+
+    return minwidth;
+}
+# 36 "./headers/kefir_bigint/bigint.h" 2
+# 1 "./headers/kefir_bigint/cast.h" 1
+# 35 "./headers/kefir_bigint/cast.h"
+static __kefir_bigint_result_t __kefir_bigint_cast_signed(unsigned char *digits,
+                                                          unsigned long long current_width,
+                                                          unsigned long long desired_width) {
+    const unsigned long long desired_msb_location = desired_width - 1;
+    const unsigned long long desired_msb_digit_index = desired_msb_location / (sizeof(unsigned char) * 8);
+    const unsigned long long desired_msb_bit_offset =
+        desired_msb_location - desired_msb_digit_index * (sizeof(unsigned char) * 8);
+
+    if (desired_width <= current_width) {
+        unsigned int desired_msb = (digits[desired_msb_digit_index] >> desired_msb_bit_offset) & 1;
+        if (desired_msb) {
+            unsigned int mask = ~((1ull << desired_msb_bit_offset) - 1);
+            digits[desired_msb_digit_index] |= mask;
+        } else {
+            unsigned int mask = (1ull << desired_msb_bit_offset) - 1;
+            digits[desired_msb_digit_index] &= mask;
+        }
+        return __KEFIR_BIGINT_OK;
+    }
+
+    if (current_width == 0) {
+        for (unsigned long long i = 0; i <= desired_msb_digit_index; i++) {
+            digits[i] = (unsigned char) 0;
+        }
+        return __KEFIR_BIGINT_OK;
+    }
+
+    const unsigned long long current_msb_location = current_width - 1;
+    const unsigned long long current_msb_digit_index = current_msb_location / (sizeof(unsigned char) * 8);
+    const unsigned long long current_msb_bit_offset =
+        current_msb_location - current_msb_digit_index * (sizeof(unsigned char) * 8);
+
+    unsigned int current_msb = (digits[current_msb_digit_index] >> current_msb_bit_offset) & 1;
+    if (current_msb_bit_offset + 1 < (sizeof(unsigned char) * 8)) {
+        if (current_msb) {
+            unsigned int mask = ~((1ull << current_msb_bit_offset) - 1);
+            digits[current_msb_digit_index] |= mask;
+        } else {
+            unsigned int mask = (1ull << current_msb_bit_offset) - 1;
+            digits[current_msb_digit_index] &= mask;
+        }
+    }
+
+    for (unsigned long long i = current_msb_digit_index + 1; i <= desired_msb_digit_index; i++) {
+        if (current_msb) {
+            digits[i] = ~(unsigned char) 0ull;
+        } else {
+            digits[i] = (unsigned char) 0ull;
+        }
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_cast_unsigned(unsigned char *digits,
+                                                            unsigned long long current_width,
+                                                            unsigned long long desired_width) {
+    const unsigned long long desired_msb_location = desired_width - 1;
+    const unsigned long long desired_msb_digit_index = desired_msb_location / (sizeof(unsigned char) * 8);
+    const unsigned long long desired_msb_bit_offset =
+        desired_width - desired_msb_digit_index * (sizeof(unsigned char) * 8);
+
+    if (desired_width <= current_width) {
+        unsigned int mask = (1ull << desired_msb_bit_offset) - 1;
+        digits[desired_msb_digit_index] &= mask;
+        return __KEFIR_BIGINT_OK;
+    }
+
+    if (current_width == 0) {
+        for (unsigned long long i = 0; i <= desired_msb_digit_index; i++) {
+            digits[i] = (unsigned char) 0ull;
+        }
+        return __KEFIR_BIGINT_OK;
+    }
+
+    const unsigned long long current_msb_location = current_width - 1;
+    const unsigned long long current_msb_digit_index = current_msb_location / (sizeof(unsigned char) * 8);
+    const unsigned long long current_msb_bit_offset =
+        current_width - current_msb_digit_index * (sizeof(unsigned char) * 8);
+
+    if (current_msb_bit_offset < (sizeof(unsigned char) * 8)) {
+        unsigned int mask = (1ull << current_msb_bit_offset) - 1;
+        digits[current_msb_digit_index] &= mask;
+    }
+
+    for (unsigned long long i = current_msb_digit_index + 1; i <= desired_msb_digit_index; i++) {
+        digits[i] = (unsigned char) 0ull;
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+# 37 "./headers/kefir_bigint/bigint.h" 2
+# 1 "./headers/kefir_bigint/bitwise.h" 1
+# 35 "./headers/kefir_bigint/bitwise.h"
+static inline __kefir_bigint_result_t __kefir_bigint_invert(unsigned char *digits,
+                                                            unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        digits[i] = ~digits[i];
+    }
+    return __KEFIR_BIGINT_OK;
+}
+
+static inline __kefir_bigint_result_t __kefir_bigint_and(unsigned char *lhs_digits,
+                                                         const unsigned char *rhs_digits,
+                                                         unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        const unsigned int lhs_digit = lhs_digits[i];
+        const unsigned int rhs_digit = rhs_digits[i];
+
+        lhs_digits[i] = lhs_digit & rhs_digit;
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static inline __kefir_bigint_result_t __kefir_bigint_or(unsigned char *lhs_digits,
+                                                        const unsigned char *rhs_digits,
+                                                        unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        const unsigned int lhs_digit = lhs_digits[i];
+        const unsigned int rhs_digit = rhs_digits[i];
+
+        lhs_digits[i] = lhs_digit | rhs_digit;
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static inline __kefir_bigint_result_t __kefir_bigint_xor(unsigned char *lhs_digits,
+                                                         const unsigned char *rhs_digits,
+                                                         unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        const unsigned int lhs_digit = lhs_digits[i];
+        const unsigned int rhs_digit = rhs_digits[i];
+
+        lhs_digits[i] = lhs_digit ^ rhs_digit;
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+# 38 "./headers/kefir_bigint/bigint.h" 2
+# 1 "./headers/kefir_bigint/shift.h" 1
+# 35 "./headers/kefir_bigint/shift.h"
+static __kefir_bigint_result_t __kefir_bigint_left_shift_whole_digits(unsigned char *digits,
+                                                                      unsigned long long shift,
+                                                                      unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    for (unsigned long long i = total_digits - 1; i >= shift; i--) {
+        digits[i] = digits[i - shift];
+    }
+
+    for (unsigned long long i = 0; i < shift; i++) {
+        digits[i] = (unsigned char) 0;
+    }
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_left_shift(unsigned char *digits, unsigned long long shift,
+                                                         unsigned long long width) {
+    if (shift > width) {
+        shift = width;
+    }
+
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    const unsigned long long shift_whole_digits = shift / (sizeof(unsigned char) * 8);
+    if (shift_whole_digits > 0) {
+        (void) __kefir_bigint_left_shift_whole_digits(digits, shift_whole_digits, width);
+        shift -= shift_whole_digits * (sizeof(unsigned char) * 8);
+    }
+
+    if (shift > 0) {
+        for (unsigned long long i = total_digits - 1; i > 0; i--) {
+            digits[i] = (digits[i] << shift) | (digits[i - 1] >> ((sizeof(unsigned char) * 8) - shift));
+        }
+        digits[0] <<= shift;
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_right_shift_whole_digits(unsigned char *digits,
+                                                                       unsigned long long shift,
+                                                                       unsigned int sign,
+                                                                       unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    const unsigned char sign_extension = sign ? ~(unsigned char) 0ull : (unsigned char) 0ull;
+    if (shift >= total_digits) {
+        for (unsigned int i = 0; i < total_digits; i++) {
+            digits[i] = sign_extension;
+        }
+    } else {
+        unsigned int i = 0;
+        for (; i < total_digits - shift; i++) {
+            digits[i] = digits[i + shift];
+        }
+        for (; i < total_digits; i++) {
+            digits[i] = sign_extension;
+        }
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_right_shift(unsigned char *digits, unsigned long long shift,
+                                                          unsigned long long width) {
+    if (shift > width) {
+        shift = width;
+    }
+
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    const unsigned long long shift_whole_digits = shift / (sizeof(unsigned char) * 8);
+    const unsigned long long mask_offset = width - (total_digits - 1) * (sizeof(unsigned char) * 8);
+    const unsigned int mask = (1ull << mask_offset) - 1;
+    digits[total_digits - 1] &= mask;
+    if (shift_whole_digits > 0) {
+        (void) __kefir_bigint_right_shift_whole_digits(digits, shift_whole_digits, 0, width);
+        shift -= shift_whole_digits * (sizeof(unsigned char) * 8);
+    }
+
+    if (shift > 0) {
+        for (unsigned long long i = 0; i < total_digits - 1; i++) {
+            digits[i] = (digits[i] >> shift) | (digits[i + 1] << ((sizeof(unsigned char) * 8) - shift));
+        }
+
+        digits[total_digits - 1] &= mask;
+        digits[total_digits - 1] >>= shift;
+    }
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_arithmetic_right_shift(unsigned char *digits,
+                                                                     unsigned long long shift,
+                                                                     unsigned long long width) {
+    if (width == 0) {
+        return __KEFIR_BIGINT_OK;
+    }
+    if (shift > width) {
+        shift = width;
+    }
+
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    const unsigned long long msb_digit_index = (width - 1) / (sizeof(unsigned char) * 8);
+    const unsigned long long msb_digit_offset = (width - 1) - msb_digit_index * (sizeof(unsigned char) * 8);
+    const unsigned long long sign = (digits[msb_digit_index] >> msb_digit_offset) & 1;
+
+    if (sign) {
+        const unsigned int mask = ~((1ull << msb_digit_offset) - 1);
+        digits[total_digits - 1] |= mask;
+    } else {
+        const unsigned int mask = (1ull << msb_digit_offset) - 1;
+        digits[total_digits - 1] &= mask;
+    }
+
+    const unsigned long long shift_whole_digits = shift / (sizeof(unsigned char) * 8);
+    if (shift_whole_digits > 0) {
+        (void) __kefir_bigint_right_shift_whole_digits(digits, shift_whole_digits, sign, width);
+        shift -= shift_whole_digits * (sizeof(unsigned char) * 8);
+    }
+
+    if (shift > 0) {
+        for (unsigned long long i = 0; i < total_digits - 1; i++) {
+            digits[i] = (digits[i] >> shift) | (digits[i + 1] << ((sizeof(unsigned char) * 8) - shift));
+        }
+
+        digits[total_digits - 1] >>= shift;
+
+        const unsigned long long mask_offset = msb_digit_offset >= shift ? msb_digit_offset - shift + 1 : 0;
+        if (sign) {
+            const unsigned int mask = ~((1ull << mask_offset) - 1);
+            digits[total_digits - 1] |= mask;
+        } else {
+            const unsigned int mask = (1ull << mask_offset) - 1;
+            digits[total_digits - 1] &= mask;
+        }
+    }
+    return __KEFIR_BIGINT_OK;
+}
+# 39 "./headers/kefir_bigint/bigint.h" 2
+# 1 "./headers/kefir_bigint/addsub.h" 1
+# 35 "./headers/kefir_bigint/addsub.h"
+static __kefir_bigint_result_t __kefir_bigint_util_add_digit_zero_extended(unsigned char *lhs_digits,
+                                                                           unsigned char rhs_digit,
+                                                                           unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    const unsigned int rhs_extension = 0;
+
+    unsigned int carry = 0;
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        const unsigned int lhs_digit = lhs_digits[i];
+        const unsigned int digit = i == 0 ? rhs_digit : rhs_extension;
+
+        const unsigned int digit_sum = carry + lhs_digit + digit;
+        lhs_digits[i] = (unsigned char) digit_sum;
+        carry = digit_sum >> (sizeof(unsigned char) * 8);
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static inline __kefir_bigint_result_t __kefir_bigint_negate(unsigned char *digits,
+                                                            unsigned long long width) {
+    (void) __kefir_bigint_invert(digits, width);
+    (void) __kefir_bigint_util_add_digit_zero_extended(digits, 1, width);
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_add(unsigned char *lhs_digits,
+                                                  const unsigned char *rhs_digits,
+                                                  unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+
+    unsigned int carry = 0;
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        const unsigned int lhs_digit = lhs_digits[i];
+        const unsigned int rhs_digit = rhs_digits[i];
+
+        const unsigned int digit_sum = carry + lhs_digit + rhs_digit;
+        lhs_digits[i] = (unsigned char) digit_sum;
+        carry = digit_sum >> (sizeof(unsigned char) * 8);
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_add_zero_extend(unsigned char *lhs_digits,
+                                                              const unsigned char *rhs_digits,
+                                                              unsigned long long lhs_width,
+                                                              unsigned long long rhs_width) {
+    const unsigned long long lhs_total_digits = (((lhs_width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    const unsigned long long rhs_total_digits = (((rhs_width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+
+    unsigned int carry = 0;
+    for (unsigned long long i = 0; i < lhs_total_digits; i++) {
+        const unsigned int lhs_digit = lhs_digits[i];
+        unsigned int rhs_digit;
+        if (i + 1 < rhs_total_digits) {
+            rhs_digit = rhs_digits[i];
+        } else if (i + 1 == rhs_total_digits) {
+            rhs_digit = rhs_digits[i];
+            const unsigned long long mask_offset =
+                rhs_width - (rhs_width - 1) / (sizeof(unsigned char) * 8) * (sizeof(unsigned char) * 8);
+            const unsigned int mask = (1ull << mask_offset) - 1;
+            rhs_digit &= mask;
+        } else {
+            rhs_digit = 0;
+        }
+
+        const unsigned int digit_sum = carry + lhs_digit + rhs_digit;
+        lhs_digits[i] = (unsigned char) digit_sum;
+        carry = digit_sum >> (sizeof(unsigned char) * 8);
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_subtract(unsigned char *lhs_digits,
+                                                       const unsigned char *rhs_digits,
+                                                       unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+
+    unsigned int carry = 0;
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        const unsigned int lhs_digit = lhs_digits[i];
+        const unsigned int rhs_digit = rhs_digits[i];
+
+        const unsigned int digit_diff = ((unsigned int) lhs_digit) - rhs_digit - carry;
+        lhs_digits[i] = (unsigned char) digit_diff;
+        carry = (digit_diff >> (sizeof(unsigned char) * 8)) & 1;
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_subtract_zero_extend(unsigned char *lhs_digits,
+                                                                   const unsigned char *rhs_digits,
+                                                                   unsigned long long lhs_width,
+                                                                   unsigned long long rhs_width) {
+    const unsigned long long lhs_total_digits = (((lhs_width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    const unsigned long long rhs_total_digits = (((rhs_width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+
+    unsigned int carry = 0;
+    for (unsigned long long i = 0; i < lhs_total_digits; i++) {
+        const unsigned int lhs_digit = lhs_digits[i];
+        unsigned int rhs_digit;
+        if (i + 1 < rhs_total_digits) {
+            rhs_digit = rhs_digits[i];
+        } else if (i + 1 == rhs_total_digits) {
+            rhs_digit = rhs_digits[i];
+            const unsigned long long mask_offset =
+                rhs_width - (rhs_width - 1) / (sizeof(unsigned char) * 8) * (sizeof(unsigned char) * 8);
+            const unsigned int mask = (1ull << mask_offset) - 1;
+            rhs_digit &= mask;
+        } else {
+            rhs_digit = 0;
+        }
+
+        const unsigned int digit_diff = ((unsigned int) lhs_digit) - rhs_digit - carry;
+        lhs_digits[i] = (unsigned char) digit_diff;
+        carry = (digit_diff >> (sizeof(unsigned char) * 8)) & 1;
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+# 40 "./headers/kefir_bigint/bigint.h" 2
+# 1 "./headers/kefir_bigint/multiply.h" 1
+# 35 "./headers/kefir_bigint/multiply.h"
+static __kefir_bigint_result_t __kefir_bigint_unsigned_multiply(unsigned char *result_digits,
+                                                                const unsigned char *lhs_digits,
+                                                                const unsigned char *rhs_digits,
+                                                                unsigned long long result_width,
+                                                                unsigned long long operand_width) {
+    (void) __kefir_bigint_zero(result_digits, result_width);
+    if (result_width == 0 || operand_width == 0) {
+        return __KEFIR_BIGINT_OK;
+    }
+
+    const unsigned long long total_digits = (((operand_width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    const unsigned long long result_total_digits = (((result_width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    const unsigned long long operand_mask_offset = operand_width - (total_digits - 1) * (sizeof(unsigned char) * 8);
+    const unsigned char operand_mask = (1ull << operand_mask_offset) - 1;
+
+    const unsigned int base = (1ull << (sizeof(unsigned char) * 8));
+    for (unsigned long long j = 0; j < total_digits; j++) {
+        unsigned int carry = 0;
+        unsigned char rhs_digit = rhs_digits[j];
+        if (j + 1 == total_digits) {
+            rhs_digit &= operand_mask;
+        }
+        for (unsigned long long i = 0; i < total_digits; i++) {
+            const unsigned long long product_idx = i + j;
+            if (product_idx >= result_total_digits) {
+                break;
+            }
+
+            unsigned char lhs_digit = lhs_digits[i];
+            if (i + 1 == total_digits) {
+                lhs_digit &= operand_mask;
+            }
+
+            const unsigned int value = result_digits[product_idx] + carry + lhs_digit * rhs_digit;
+            result_digits[product_idx] = value % base;
+            carry = value / base;
+        }
+
+        const unsigned long long product_idx = j + total_digits;
+        if (product_idx < result_total_digits) {
+            result_digits[product_idx] = carry;
+        }
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_signed_multiply(unsigned char *result_digits,
+                                                              unsigned char *accumulator_digits,
+                                                              unsigned char *lhs_digits,
+                                                              const unsigned char *rhs_digits,
+                                                              unsigned long long result_width,
+                                                              unsigned long long operand_width) {
+    (void) __kefir_bigint_zero(result_digits, result_width);
+    if (result_width == 0 || operand_width == 0) {
+        return __KEFIR_BIGINT_OK;
+    }
+
+    const unsigned long long multiplier_msb_index = (operand_width - 1) / (sizeof(unsigned char) * 8);
+    const unsigned long long multiplier_msb_offset =
+        operand_width - 1 - multiplier_msb_index * (sizeof(unsigned char) * 8);
+
+    (void) __kefir_bigint_zero(accumulator_digits, operand_width);
+    unsigned int multiplier_lsb_prev_bit = 0;
+    for (unsigned long long i = 0; i < operand_width; i++) {
+        const unsigned int multiplier_lsb_bit = lhs_digits[0] & 1;
+        if (multiplier_lsb_bit && !multiplier_lsb_prev_bit) {
+            (void) __kefir_bigint_subtract(accumulator_digits, rhs_digits, operand_width);
+        } else if (!multiplier_lsb_bit && multiplier_lsb_prev_bit) {
+            (void) __kefir_bigint_add(accumulator_digits, rhs_digits, operand_width);
+        }
+
+        multiplier_lsb_prev_bit = multiplier_lsb_bit;
+        const unsigned int accumulator_lsb = accumulator_digits[0] & 1;
+        (void) __kefir_bigint_arithmetic_right_shift(accumulator_digits, 1, operand_width);
+        (void) __kefir_bigint_right_shift(lhs_digits, 1, operand_width);
+        lhs_digits[multiplier_msb_index] |= accumulator_lsb << multiplier_msb_offset;
+    }
+
+    (void) __kefir_bigint_or(result_digits, accumulator_digits, operand_width);
+    (void) __kefir_bigint_left_shift(result_digits, operand_width, result_width);
+    (void) __kefir_bigint_or(result_digits, lhs_digits, operand_width);
+    (void) __kefir_bigint_cast_signed(result_digits, operand_width * 2, result_width);
+
+    return __KEFIR_BIGINT_OK;
+}
+# 41 "./headers/kefir_bigint/bigint.h" 2
+# 1 "./headers/kefir_bigint/divide.h" 1
+# 35 "./headers/kefir_bigint/divide.h"
+static __kefir_bigint_result_t __kefir_bigint_unsigned_divide(unsigned char *lhs_digits,
+                                                              unsigned char *accumulator_digits,
+                                                              const unsigned char *rhs_digits,
+                                                              unsigned long long lhs_width,
+                                                              unsigned long long rhs_width) {
+    (void) __kefir_bigint_zero(accumulator_digits, lhs_width);
+    if (lhs_width == 0) {
+        return __KEFIR_BIGINT_OK;
+    }
+    if (__kefir_bigint_is_zero(rhs_digits, rhs_width)) {
+        return __KEFIR_BIGINT_DIVISION_BY_ZERO;
+    }
+
+    const unsigned long long msb_digit_index = (lhs_width - 1) / (sizeof(unsigned char) * 8);
+    const unsigned long long msb_digit_offset = lhs_width - 1 - msb_digit_index * (sizeof(unsigned char) * 8);
+
+    for (unsigned long long i = 0; i < lhs_width; i++) {
+        const unsigned int lhs_msb = (lhs_digits[msb_digit_index] >> msb_digit_offset) & 1;
+        (void) __kefir_bigint_left_shift(accumulator_digits, 1, lhs_width);
+        (void) __kefir_bigint_left_shift(lhs_digits, 1, lhs_width);
+        accumulator_digits[0] |= lhs_msb;
+
+        (void) __kefir_bigint_subtract_zero_extend(accumulator_digits, rhs_digits, lhs_width, rhs_width);
+        const unsigned int acc_msb = (accumulator_digits[msb_digit_index] >> msb_digit_offset) & 1;
+        if (acc_msb) {
+            lhs_digits[0] &= ~(unsigned char) 1;
+            (void) __kefir_bigint_add_zero_extend(accumulator_digits, rhs_digits, lhs_width, rhs_width);
+        } else {
+            lhs_digits[0] |= 1;
+        }
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_signed_divide(unsigned char *lhs_digits,
+                                                            unsigned char *accumulator_digits,
+                                                            unsigned char *rhs_digits,
+                                                            unsigned long long lhs_width,
+                                                            unsigned long long rhs_width) {
+    const unsigned int lhs_sign = __kefir_bigint_get_sign(lhs_digits, lhs_width);
+    const unsigned int rhs_sign = __kefir_bigint_get_sign(rhs_digits, rhs_width);
+    if (__kefir_bigint_is_zero(rhs_digits, rhs_width)) {
+        return __KEFIR_BIGINT_DIVISION_BY_ZERO;
+    }
+
+    if (lhs_sign) {
+        (void) __kefir_bigint_negate(lhs_digits, lhs_width);
+    }
+    if (rhs_sign) {
+        (void) __kefir_bigint_negate(rhs_digits, rhs_width);
+    }
+
+    (void) __kefir_bigint_unsigned_divide(lhs_digits, accumulator_digits, rhs_digits, lhs_width, rhs_width);
+    if (lhs_sign ^ rhs_sign) {
+        (void) __kefir_bigint_negate(lhs_digits, lhs_width);
+    }
+    if (lhs_sign) {
+        (void) __kefir_bigint_negate(accumulator_digits, lhs_width);
+    }
+
+    return __KEFIR_BIGINT_OK;
+}
+# 42 "./headers/kefir_bigint/bigint.h" 2
+# 1 "./headers/kefir_bigint/compare.h" 1
+# 35 "./headers/kefir_bigint/compare.h"
+static unsigned int __kefir_bigint_unsigned_compare(const unsigned char *lhs_digits,
+                                                             const unsigned char *rhs_digits,
+                                                             unsigned long long width) {
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    for (unsigned long long i = total_digits; i > 0; i--) {
+        unsigned int lhs_digit = lhs_digits[i - 1];
+        unsigned int rhs_digit = rhs_digits[i - 1];
+        if (i == total_digits) {
+            const unsigned int mask_offset =
+                ((width - 1) - (width - 1) / (sizeof(unsigned char) * 8) * (sizeof(unsigned char) * 8)) + 1;
+            const unsigned int mask = (1ull << mask_offset) - 1;
+            lhs_digit &= mask;
+            rhs_digit &= mask;
+        }
+
+        if (lhs_digit > rhs_digit) {
+            return 1;
+        } else if (lhs_digit < rhs_digit) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static unsigned int __kefir_bigint_signed_compare(const unsigned char *lhs_digits,
+                                                           const unsigned char *rhs_digits,
+                                                           unsigned long long width) {
+    const unsigned long long msb_index = (width - 1) / (sizeof(unsigned char) * 8);
+    const unsigned long long msb_offset = (width - 1) - msb_index * (sizeof(unsigned char) * 8);
+
+    const unsigned int lhs_sign = (lhs_digits[msb_index] >> msb_offset) & 1;
+    const unsigned int rhs_sign = (rhs_digits[msb_index] >> msb_offset) & 1;
+    if (lhs_sign && !rhs_sign) {
+        return -1;
+    } else if (!lhs_sign && rhs_sign) {
+        return 1;
+    }
+
+    return __kefir_bigint_unsigned_compare(lhs_digits, rhs_digits, width);
+}
+# 43 "./headers/kefir_bigint/bigint.h" 2
+# 1 "./headers/kefir_bigint/float.h" 1
+# 92 "./headers/kefir_bigint/float.h"
+static float __kefir_bigint_signed_to_float(unsigned char *signed_digits,
+                                                             unsigned char *tmp,
+                                                             unsigned long long width) {
+    if (__kefir_bigint_is_zero(signed_digits, width)) {
+        return 0.0f;
+    }
+
+    unsigned long long sign, exponent, mantissa;
+    do { if ((1)) { *(&sign) = -(long long) __kefir_bigint_get_sign((signed_digits), (width)); if (sign) { (void) __kefir_bigint_negate((signed_digits), (width)); } } else { *(&sign) = 0; } const unsigned long long significant_digits = __kefir_bigint_get_min_unsigned_width((signed_digits), (width)); *(&exponent) = significant_digits - 1; if (significant_digits > (24)) { switch (significant_digits) { case (24) + 1: (void) __kefir_bigint_left_shift((signed_digits), 1, (width)); break; case (24) + 2: break; default: (void) __kefir_bigint_set_signed_integer((tmp), (width), -1); (void) __kefir_bigint_right_shift((tmp), (width) + (24) + 2 - significant_digits, (width)); (void) __kefir_bigint_and((tmp), (signed_digits), (width)); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), !__kefir_bigint_is_zero((tmp), (width))); (void) __kefir_bigint_right_shift((signed_digits), significant_digits - ((24) + 2), (width)); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); break; } unsigned long long val; (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), &val); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), (val & 4) != 0); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); (void) __kefir_bigint_util_add_digit_zero_extended((signed_digits), 1, (width)); (void) __kefir_bigint_right_shift((signed_digits), 2, (width)); if (__kefir_bigint_get_bits((signed_digits), (24), 1, (width))) { (void) __kefir_bigint_right_shift((signed_digits), 1, (width)); (*(&exponent))++; } } else if (significant_digits != (24)) { (void) __kefir_bigint_left_shift((signed_digits), (24) - significant_digits, (width)); } (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), (&mantissa)); } while (0)
+                                             ;
+    if (exponent >= 128) {
+        exponent = 128;
+        mantissa = 0;
+    }
+    union {
+        unsigned long long u;
+        float f;
+    } conv = {.u = (sign & 0x80000000) | ((exponent + 127) << 23) | (mantissa & 0x007fffff)};
+    return conv.f;
+}
+
+static double __kefir_bigint_signed_to_double(unsigned char *signed_digits,
+                                                               unsigned char *tmp,
+                                                               unsigned long long width) {
+    if (__kefir_bigint_is_zero(signed_digits, width)) {
+        return 0.0;
+    }
+
+    unsigned long long sign, exponent, mantissa;
+    do { if ((1)) { *(&sign) = -(long long) __kefir_bigint_get_sign((signed_digits), (width)); if (sign) { (void) __kefir_bigint_negate((signed_digits), (width)); } } else { *(&sign) = 0; } const unsigned long long significant_digits = __kefir_bigint_get_min_unsigned_width((signed_digits), (width)); *(&exponent) = significant_digits - 1; if (significant_digits > (53)) { switch (significant_digits) { case (53) + 1: (void) __kefir_bigint_left_shift((signed_digits), 1, (width)); break; case (53) + 2: break; default: (void) __kefir_bigint_set_signed_integer((tmp), (width), -1); (void) __kefir_bigint_right_shift((tmp), (width) + (53) + 2 - significant_digits, (width)); (void) __kefir_bigint_and((tmp), (signed_digits), (width)); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), !__kefir_bigint_is_zero((tmp), (width))); (void) __kefir_bigint_right_shift((signed_digits), significant_digits - ((53) + 2), (width)); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); break; } unsigned long long val; (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), &val); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), (val & 4) != 0); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); (void) __kefir_bigint_util_add_digit_zero_extended((signed_digits), 1, (width)); (void) __kefir_bigint_right_shift((signed_digits), 2, (width)); if (__kefir_bigint_get_bits((signed_digits), (53), 1, (width))) { (void) __kefir_bigint_right_shift((signed_digits), 1, (width)); (*(&exponent))++; } } else if (significant_digits != (53)) { (void) __kefir_bigint_left_shift((signed_digits), (53) - significant_digits, (width)); } (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), (&mantissa)); } while (0)
+                                             ;
+    if (exponent >= 1024) {
+        exponent = 1024;
+        mantissa = 0;
+    }
+    union {
+        unsigned long long u;
+        double f;
+    } conv = {.u = ((sign & 0x80000000) << 32) | ((exponent + 1023) << 52) | (mantissa & 0x000fffffffffffffull)};
+    return conv.f;
+}
+
+static long double __kefir_bigint_signed_to_long_double(unsigned char *signed_digits,
+                                                                         unsigned char *tmp,
+                                                                         unsigned long long width) {
+    if (__kefir_bigint_is_zero(signed_digits, width)) {
+        return 0.0L;
+    }
+
+    unsigned long long sign, exponent, mantissa;
+    do { if ((1)) { *(&sign) = -(long long) __kefir_bigint_get_sign((signed_digits), (width)); if (sign) { (void) __kefir_bigint_negate((signed_digits), (width)); } } else { *(&sign) = 0; } const unsigned long long significant_digits = __kefir_bigint_get_min_unsigned_width((signed_digits), (width)); *(&exponent) = significant_digits - 1; if (significant_digits > (64)) { switch (significant_digits) { case (64) + 1: (void) __kefir_bigint_left_shift((signed_digits), 1, (width)); break; case (64) + 2: break; default: (void) __kefir_bigint_set_signed_integer((tmp), (width), -1); (void) __kefir_bigint_right_shift((tmp), (width) + (64) + 2 - significant_digits, (width)); (void) __kefir_bigint_and((tmp), (signed_digits), (width)); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), !__kefir_bigint_is_zero((tmp), (width))); (void) __kefir_bigint_right_shift((signed_digits), significant_digits - ((64) + 2), (width)); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); break; } unsigned long long val; (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), &val); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), (val & 4) != 0); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); (void) __kefir_bigint_util_add_digit_zero_extended((signed_digits), 1, (width)); (void) __kefir_bigint_right_shift((signed_digits), 2, (width)); if (__kefir_bigint_get_bits((signed_digits), (64), 1, (width))) { (void) __kefir_bigint_right_shift((signed_digits), 1, (width)); (*(&exponent))++; } } else if (significant_digits != (64)) { (void) __kefir_bigint_left_shift((signed_digits), (64) - significant_digits, (width)); } (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), (&mantissa)); } while (0)
+                                             ;
+    if (exponent >= 16384) {
+        exponent = 16384;
+        mantissa = 1ull << 63;
+    }
+    union {
+        unsigned long long u[2];
+        long double f;
+    } conv = {.u[0] = mantissa, .u[1] = (sign & 0x8000) | ((exponent + 16383) & 0x7fff)};
+    return conv.f;
+}
+
+static float __kefir_bigint_unsigned_to_float(unsigned char *signed_digits,
+                                                               unsigned char *tmp,
+                                                               unsigned long long width) {
+    if (__kefir_bigint_is_zero(signed_digits, width)) {
+        return 0.0f;
+    }
+
+    unsigned long long sign, exponent, mantissa;
+    do { if ((0)) { *(&sign) = -(long long) __kefir_bigint_get_sign((signed_digits), (width)); if (sign) { (void) __kefir_bigint_negate((signed_digits), (width)); } } else { *(&sign) = 0; } const unsigned long long significant_digits = __kefir_bigint_get_min_unsigned_width((signed_digits), (width)); *(&exponent) = significant_digits - 1; if (significant_digits > (24)) { switch (significant_digits) { case (24) + 1: (void) __kefir_bigint_left_shift((signed_digits), 1, (width)); break; case (24) + 2: break; default: (void) __kefir_bigint_set_signed_integer((tmp), (width), -1); (void) __kefir_bigint_right_shift((tmp), (width) + (24) + 2 - significant_digits, (width)); (void) __kefir_bigint_and((tmp), (signed_digits), (width)); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), !__kefir_bigint_is_zero((tmp), (width))); (void) __kefir_bigint_right_shift((signed_digits), significant_digits - ((24) + 2), (width)); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); break; } unsigned long long val; (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), &val); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), (val & 4) != 0); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); (void) __kefir_bigint_util_add_digit_zero_extended((signed_digits), 1, (width)); (void) __kefir_bigint_right_shift((signed_digits), 2, (width)); if (__kefir_bigint_get_bits((signed_digits), (24), 1, (width))) { (void) __kefir_bigint_right_shift((signed_digits), 1, (width)); (*(&exponent))++; } } else if (significant_digits != (24)) { (void) __kefir_bigint_left_shift((signed_digits), (24) - significant_digits, (width)); } (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), (&mantissa)); } while (0)
+                                             ;
+    if (exponent >= 128) {
+        exponent = 128;
+        mantissa = 0;
+    }
+    union {
+        unsigned long long u;
+        float f;
+    } conv = {.u = (sign & 0x80000000) | ((exponent + 127) << 23) | (mantissa & 0x007fffff)};
+    return conv.f;
+}
+
+static double __kefir_bigint_unsigned_to_double(unsigned char *signed_digits,
+                                                                 unsigned char *tmp,
+                                                                 unsigned long long width) {
+    if (__kefir_bigint_is_zero(signed_digits, width)) {
+        return 0.0;
+    }
+
+    unsigned long long sign, exponent, mantissa;
+    do { if ((0)) { *(&sign) = -(long long) __kefir_bigint_get_sign((signed_digits), (width)); if (sign) { (void) __kefir_bigint_negate((signed_digits), (width)); } } else { *(&sign) = 0; } const unsigned long long significant_digits = __kefir_bigint_get_min_unsigned_width((signed_digits), (width)); *(&exponent) = significant_digits - 1; if (significant_digits > (53)) { switch (significant_digits) { case (53) + 1: (void) __kefir_bigint_left_shift((signed_digits), 1, (width)); break; case (53) + 2: break; default: (void) __kefir_bigint_set_signed_integer((tmp), (width), -1); (void) __kefir_bigint_right_shift((tmp), (width) + (53) + 2 - significant_digits, (width)); (void) __kefir_bigint_and((tmp), (signed_digits), (width)); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), !__kefir_bigint_is_zero((tmp), (width))); (void) __kefir_bigint_right_shift((signed_digits), significant_digits - ((53) + 2), (width)); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); break; } unsigned long long val; (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), &val); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), (val & 4) != 0); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); (void) __kefir_bigint_util_add_digit_zero_extended((signed_digits), 1, (width)); (void) __kefir_bigint_right_shift((signed_digits), 2, (width)); if (__kefir_bigint_get_bits((signed_digits), (53), 1, (width))) { (void) __kefir_bigint_right_shift((signed_digits), 1, (width)); (*(&exponent))++; } } else if (significant_digits != (53)) { (void) __kefir_bigint_left_shift((signed_digits), (53) - significant_digits, (width)); } (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), (&mantissa)); } while (0)
+                                             ;
+    if (exponent >= 1024) {
+        exponent = 1024;
+        mantissa = 0;
+    }
+    union {
+        unsigned long long u;
+        double f;
+    } conv = {.u = ((sign & 0x80000000) << 32) | ((exponent + 1023) << 52) | (mantissa & 0x000fffffffffffffull)};
+    return conv.f;
+}
+
+static long double __kefir_bigint_unsigned_to_long_double(unsigned char *signed_digits,
+                                                                           unsigned char *tmp,
+                                                                           unsigned long long width) {
+    if (__kefir_bigint_is_zero(signed_digits, width)) {
+        return 0.0L;
+    }
+
+    unsigned long long sign, exponent, mantissa;
+    do { if ((0)) { *(&sign) = -(long long) __kefir_bigint_get_sign((signed_digits), (width)); if (sign) { (void) __kefir_bigint_negate((signed_digits), (width)); } } else { *(&sign) = 0; } const unsigned long long significant_digits = __kefir_bigint_get_min_unsigned_width((signed_digits), (width)); *(&exponent) = significant_digits - 1; if (significant_digits > (64)) { switch (significant_digits) { case (64) + 1: (void) __kefir_bigint_left_shift((signed_digits), 1, (width)); break; case (64) + 2: break; default: (void) __kefir_bigint_set_signed_integer((tmp), (width), -1); (void) __kefir_bigint_right_shift((tmp), (width) + (64) + 2 - significant_digits, (width)); (void) __kefir_bigint_and((tmp), (signed_digits), (width)); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), !__kefir_bigint_is_zero((tmp), (width))); (void) __kefir_bigint_right_shift((signed_digits), significant_digits - ((64) + 2), (width)); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); break; } unsigned long long val; (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), &val); (void) __kefir_bigint_set_unsigned_integer((tmp), (width), (val & 4) != 0); (void) __kefir_bigint_or((signed_digits), (tmp), (width)); (void) __kefir_bigint_util_add_digit_zero_extended((signed_digits), 1, (width)); (void) __kefir_bigint_right_shift((signed_digits), 2, (width)); if (__kefir_bigint_get_bits((signed_digits), (64), 1, (width))) { (void) __kefir_bigint_right_shift((signed_digits), 1, (width)); (*(&exponent))++; } } else if (significant_digits != (64)) { (void) __kefir_bigint_left_shift((signed_digits), (64) - significant_digits, (width)); } (void) __kefir_bigint_get_unsigned_value((signed_digits), (width), (&mantissa)); } while (0)
+                                             ;
+    if (exponent >= 16384) {
+        exponent = 16384;
+        mantissa = 1ull << 63;
+    }
+    union {
+        unsigned long long u[2];
+        long double f;
+    } conv = {.u[0] = mantissa, .u[1] = (sign & 0x8000) | ((exponent + 16383) & 0x7fff)};
+    return conv.f;
+}
+# 288 "./headers/kefir_bigint/float.h"
+static __kefir_bigint_result_t __kefir_bigint_signed_from_float(unsigned char *digits,
+                                                                float value,
+                                                                unsigned long long width) {
+    union {
+        float f;
+        unsigned long long u;
+    } conv = {.f = value};
+
+    const long long sign = conv.u & (1ull << (8 + 23));
+    const long long exponent =
+        ((conv.u >> 23) & ((1ull << 8) - 1)) -
+        127;
+    const unsigned long long mantissa =
+        (conv.u & ((1ull << 23) - 1)) | (1ull << 23);
+
+    do { if ((exponent) < 0) { (void) __kefir_bigint_zero((digits), (width)); return __KEFIR_BIGINT_OK; } if ((unsigned long long) (exponent) >= (width)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), 1); (void) __kefir_bigint_left_shift((digits), (width) - 1, (width)); return __KEFIR_BIGINT_OK; } if ((exponent) < (23)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa) >> ((23) - (exponent))); } else { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa)); (void) __kefir_bigint_left_shift((digits), (exponent) - (23), (width)); } if (sign) { (void) __kefir_bigint_negate((digits), (width)); } } while (0)
+                                                                                        ;
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_unsigned_from_float(unsigned char *digits,
+                                                                  float value,
+                                                                  unsigned long long width) {
+    union {
+        float f;
+        unsigned long long u;
+    } conv = {.f = value};
+
+    const long long sign = conv.u & (1ull << (8 + 23));
+    const long long exponent =
+        ((conv.u >> 23) & ((1ull << 8) - 1)) -
+        127;
+    const unsigned long long mantissa =
+        (conv.u & ((1ull << 23) - 1)) | (1ull << 23);
+
+    do { if ((exponent) < 0) { (void) __kefir_bigint_zero((digits), (width)); return __KEFIR_BIGINT_OK; } if ((unsigned long long) (exponent) >= (width)) { if ((sign)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), 1); (void) __kefir_bigint_left_shift((digits), (width) - 1, (width)); } else { (void) __kefir_bigint_zero((digits), (width)); } return __KEFIR_BIGINT_OK; } if ((exponent) < (23)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa) >> ((23) - (exponent))); } else { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa)); (void) __kefir_bigint_left_shift((digits), (exponent) - (23), (width)); } if (sign) { (void) __kefir_bigint_negate((digits), (width)); } } while (0)
+                                                                                          ;
+
+    return __KEFIR_BIGINT_OK;
+}
+# 345 "./headers/kefir_bigint/float.h"
+static __kefir_bigint_result_t __kefir_bigint_signed_from_double(unsigned char *digits,
+                                                                 double value,
+                                                                 unsigned long long width) {
+    union {
+        double f;
+        unsigned long long u;
+    } conv = {.f = value};
+
+    const long long sign = conv.u & (1ull << (11 + 52));
+    const long long exponent =
+        ((conv.u >> 52) & ((1ull << 11) - 1)) -
+        1023;
+    const unsigned long long mantissa =
+        (conv.u & ((1ull << 52) - 1)) | (1ull << 52);
+
+    do { if ((exponent) < 0) { (void) __kefir_bigint_zero((digits), (width)); return __KEFIR_BIGINT_OK; } if ((unsigned long long) (exponent) >= (width)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), 1); (void) __kefir_bigint_left_shift((digits), (width) - 1, (width)); return __KEFIR_BIGINT_OK; } if ((exponent) < (52)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa) >> ((52) - (exponent))); } else { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa)); (void) __kefir_bigint_left_shift((digits), (exponent) - (52), (width)); } if (sign) { (void) __kefir_bigint_negate((digits), (width)); } } while (0)
+                                                                                         ;
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_unsigned_from_double(unsigned char *digits,
+                                                                   double value,
+                                                                   unsigned long long width) {
+    union {
+        double f;
+        unsigned long long u;
+    } conv = {.f = value};
+
+    const long long sign = conv.u & (1ull << (11 + 52));
+    const long long exponent =
+        ((conv.u >> 52) & ((1ull << 11) - 1)) -
+        1023;
+    const unsigned long long mantissa =
+        (conv.u & ((1ull << 52) - 1)) | (1ull << 52);
+
+    do { if ((exponent) < 0) { (void) __kefir_bigint_zero((digits), (width)); return __KEFIR_BIGINT_OK; } if ((unsigned long long) (exponent) >= (width)) { if ((sign)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), 1); (void) __kefir_bigint_left_shift((digits), (width) - 1, (width)); } else { (void) __kefir_bigint_zero((digits), (width)); } return __KEFIR_BIGINT_OK; } if ((exponent) < (52)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa) >> ((52) - (exponent))); } else { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa)); (void) __kefir_bigint_left_shift((digits), (exponent) - (52), (width)); } if (sign) { (void) __kefir_bigint_negate((digits), (width)); } } while (0)
+                                                                                           ;
+
+    return __KEFIR_BIGINT_OK;
+}
+# 401 "./headers/kefir_bigint/float.h"
+static __kefir_bigint_result_t __kefir_bigint_signed_from_long_double(unsigned char *digits,
+                                                                      long double value,
+                                                                      unsigned long long width) {
+    union {
+        long double f;
+        unsigned long long u[2];
+    } conv = {.f = value};
+
+    const long long sign = conv.u[1] & (1ull << 15);
+    const long long exponent = (conv.u[1] & ((1ull << 15) - 1)) -
+                                                   16383;
+    const unsigned long long mantissa = conv.u[0];
+
+    do { if ((exponent) < 0) { (void) __kefir_bigint_zero((digits), (width)); return __KEFIR_BIGINT_OK; } if ((unsigned long long) (exponent) >= (width)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), 1); (void) __kefir_bigint_left_shift((digits), (width) - 1, (width)); return __KEFIR_BIGINT_OK; } if ((exponent) < (63)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa) >> ((63) - (exponent))); } else { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa)); (void) __kefir_bigint_left_shift((digits), (exponent) - (63), (width)); } if (sign) { (void) __kefir_bigint_negate((digits), (width)); } } while (0)
+                                                                                              ;
+
+    return __KEFIR_BIGINT_OK;
+}
+
+static __kefir_bigint_result_t __kefir_bigint_unsigned_from_long_double(unsigned char *digits,
+                                                                        long double value,
+                                                                        unsigned long long width) {
+    union {
+        long double f;
+        unsigned long long u[2];
+    } conv = {.f = value};
+
+    const long long sign = conv.u[1] & (1ull << 15);
+    const long long exponent = (conv.u[1] & ((1ull << 15) - 1)) -
+                                                   16383;
+    const unsigned long long mantissa = conv.u[0];
+
+    do { if ((exponent) < 0) { (void) __kefir_bigint_zero((digits), (width)); return __KEFIR_BIGINT_OK; } if ((unsigned long long) (exponent) >= (width)) { if ((sign)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), 1); (void) __kefir_bigint_left_shift((digits), (width) - 1, (width)); } else { (void) __kefir_bigint_zero((digits), (width)); } return __KEFIR_BIGINT_OK; } if ((exponent) < (63)) { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa) >> ((63) - (exponent))); } else { (void) __kefir_bigint_set_unsigned_integer((digits), (width), (mantissa)); (void) __kefir_bigint_left_shift((digits), (exponent) - (63), (width)); } if (sign) { (void) __kefir_bigint_negate((digits), (width)); } } while (0)
+                                                                                                ;
+
+    return __KEFIR_BIGINT_OK;
+}
+# 44 "./headers/kefir_bigint/bigint.h" 2
+# 1 "./headers/kefir_bigint/bits.h" 1
+# 35 "./headers/kefir_bigint/bits.h"
+static unsigned long long __kefir_bigint_least_significant_nonzero(const unsigned char *digits,
+                                                                       unsigned long long width) {
+    if (width == 0) {
+        return 0;
+    }
+
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        const unsigned char digit = digits[i];
+        if (digit == 0) {
+            continue;
+        }
+
+        const unsigned long long digit_width =
+            i + 1 < total_digits ? (sizeof(unsigned char) * 8) : width - ((total_digits - 1) * (sizeof(unsigned char) * 8));
+        for (unsigned long long j = 0; j < digit_width; j++) {
+            if (((digit >> j) & 1) == 1) {
+                return i * (sizeof(unsigned char) * 8) + j + 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+static unsigned long long __kefir_bigint_leading_zeros(const unsigned char *digits,
+                                                           unsigned long long width,
+                                                           unsigned long long default_value) {
+    if (width == 0) {
+        return default_value;
+    }
+
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    unsigned long long count = 0;
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        const unsigned char digit = digits[total_digits - i - 1];
+        const unsigned long long digit_width =
+            i > 0 ? (sizeof(unsigned char) * 8) : width - ((total_digits - 1) * (sizeof(unsigned char) * 8));
+        for (unsigned long long j = 0; j < digit_width; j++) {
+            const unsigned int bit = (digit >> (digit_width - j - 1)) & 1;
+            if (bit == 1) {
+                return count;
+            } else {
+                count++;
+            }
+        }
+    }
+
+    return default_value;
+}
+
+static unsigned long long __kefir_bigint_trailing_zeros(const unsigned char *digits,
+                                                            unsigned long long width,
+                                                            unsigned long long default_value) {
+    if (width == 0) {
+        return default_value;
+    }
+
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    unsigned long long count = 0;
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        const unsigned char digit = digits[i];
+        if (digit == 0) {
+            count += (sizeof(unsigned char) * 8);
+            continue;
+        }
+
+        const unsigned long long digit_width =
+            i + 1 < total_digits ? (sizeof(unsigned char) * 8) : width - ((total_digits - 1) * (sizeof(unsigned char) * 8));
+        for (unsigned long long j = 0; j < digit_width; j++) {
+            const unsigned int bit = (digit >> j) & 1;
+            if (bit == 1) {
+                return count;
+            } else {
+                count++;
+            }
+        }
+    }
+
+    return default_value;
+}
+
+static unsigned long long __kefir_bigint_redundant_sign_bits(const unsigned char *digits,
+                                                                 unsigned long long width) {
+    if (width == 0) {
+        return 0;
+    }
+
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    const unsigned long long msb_digit_index = total_digits - 1;
+    const unsigned long long msb_offset = width - 1 - msb_digit_index * (sizeof(unsigned char) * 8);
+    const unsigned int msb = (digits[msb_digit_index] >> msb_offset) & 1;
+
+    unsigned long long count = 0;
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        const unsigned char digit = digits[total_digits - i - 1];
+        const unsigned long long digit_width =
+            i > 0 ? (sizeof(unsigned char) * 8) : width - ((total_digits - 1) * (sizeof(unsigned char) * 8));
+
+        for (unsigned long long j = 0; j < digit_width; j++) {
+            const unsigned int bit = (digit >> (digit_width - j - 1)) & 1;
+            if (bit == msb) {
+                count++;
+            } else {
+                return count - 1;
+            }
+        }
+    }
+
+    return count - 1;
+}
+
+static unsigned long long __kefir_bigint_nonzero_count(const unsigned char *digits,
+                                                           unsigned long long width) {
+    if (width == 0) {
+        return 0;
+    }
+
+    const unsigned long long total_digits = (((width) + (sizeof(unsigned char) * 8) - 1) / (sizeof(unsigned char) * 8));
+    unsigned long long count = 0;
+    for (unsigned long long i = 0; i < total_digits; i++) {
+        const unsigned char digit = digits[i];
+        const unsigned long long digit_width =
+            i + 1 < total_digits ? (sizeof(unsigned char) * 8) : width - ((total_digits - 1) * (sizeof(unsigned char) * 8));
+
+        for (unsigned long long j = 0; j < digit_width; j++) {
+            const unsigned int bit = (digit >> j) & 1;
+            if (bit == 1) {
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+static inline unsigned long long __kefir_bigint_parity(const unsigned char *digits,
+                                                           unsigned long long width) {
+    return __kefir_bigint_nonzero_count(digits, width) % 2;
+}
+# 45 "./headers/kefir_bigint/bigint.h" 2
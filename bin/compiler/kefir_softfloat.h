@@ -0,0 +1,366 @@
+# 0 "./headers/kefir_softfloat/softfloat.h"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "./headers/kefir_softfloat/softfloat.h"
+# 33 "./headers/kefir_softfloat/softfloat.h"
+# 1 "./headers/kefir_softfloat/base.h" 1
+# 34 "./headers/kefir_softfloat/softfloat.h" 2
+# 1 "./headers/kefir_softfloat/math.h" 1
+# 34 "./headers/kefir_softfloat/math.h"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+
+
+
+
+union __kefir_softfloat_float_repr {
+    float f;
+    long unsigned int uint;
+};
+
+union __kefir_softfloat_double_repr {
+    double d;
+    long unsigned int uint;
+};
+
+static float __kefir_softfloat_fabsf(float value) {
+    union __kefir_softfloat_float_repr rep = {.f = value};
+
+    rep.uint &= (1ull << 31) - 1;
+    return rep.f;
+}
+
+static int __kefir_softfloat_ilogbf(float x) {
+#pragma STDC FENV_ACCESS ON
+
+
+
+
+
+    union __kefir_softfloat_float_repr repr = {.f = x};
+    int exponent = ((repr.uint) >> 23) & 0xff;
+    long unsigned int irepr = repr.uint << 9;
+
+    int res = exponent - 0x7f;
+    if (exponent == 0xff) {
+        volatile float tmp = 0.0 / 0.0;
+        (void) tmp;
+        res = irepr ? (-0x80000000) : (int) ((1u << (32 - 1)) - 1);
+    } else if (exponent == 0) {
+        if (irepr == 0) {
+            volatile float tmp = 0.0 / 0.0;
+            (void) tmp;
+            res = (-0x80000000);
+        } else {
+            res = -0x7f;
+            for (; irepr >> 31 == 0; irepr <<= 1) {
+                res--;
+            }
+        }
+    }
+    return res;
+
+
+
+
+
+}
+
+static float __kefir_softfloat_scalbnf(float x,
+                                                             int n) {
+    union __kefir_softfloat_float_repr rep;
+
+
+
+
+
+
+
+    for (int i = 0; i < 2 && n > 127; i++) {
+        x *= 0x1p127f;
+        n -= 127;
+    }
+    if (n > 127) {
+        n = 127;
+    }
+    for (int i = 0; i < 2 && n < -126; i++) {
+        x *= (0x1p-126f * 0x1p24f);
+        n += 126 - 24;
+    }
+    if (n < -126) {
+        n = -126;
+    }
+
+    rep.uint = ((long unsigned int) (127 + n)) << 23;
+    return x * rep.f;
+
+
+
+
+
+
+}
+
+static float __kefir_softfloat_logbf(float x) {
+    if (!__builtin_isfinite(x)) {
+        return x * x;
+    } else if (x == 0.0) {
+        return -__builtin_inff();
+    } else {
+        return (float) __kefir_softfloat_ilogbf(x);
+    }
+}
+
+static float __kefir_softfloat_fmaximum_numf(float x,
+                                                                   float y) {
+    if (__builtin_isless(x, y)) {
+        return y;
+    } else if (__builtin_isgreater(x, y)) {
+        return x;
+    } else if (x == y) {
+        return __builtin_copysignf(1.0f, x) >= __builtin_copysignf(1.0f, y) ? x : y;
+    }
+
+    return __builtin_isnan(y) ? (__builtin_isnan(x) ? x + y : x) : y;
+}
+
+static double __kefir_softfloat_fabs(double value) {
+    union __kefir_softfloat_double_repr rep = {.d = value};
+
+    rep.uint &= (1ull << 63) - 1;
+    return rep.d;
+}
+
+static int __kefir_softfloat_ilogb(double x) {
+#pragma STDC FENV_ACCESS ON
+
+
+
+
+
+    union __kefir_softfloat_double_repr repr = {.d = x};
+    int exponent = ((repr.uint) >> 52) & 0x7ff;
+    long unsigned int irepr = repr.uint << 12;
+
+    int res = exponent - 0x3ff;
+    if (exponent == 0x7ff) {
+        volatile double tmp = 0.0 / 0.0;
+        (void) tmp;
+        res = irepr ? (-0x80000000) : (int) ((1u << (32 - 1)) - 1);
+    } else if (exponent == 0) {
+        if (irepr == 0) {
+            volatile double tmp = 0.0 / 0.0;
+            (void) tmp;
+            res = (-0x80000000);
+        } else {
+            res = -0x3ff;
+            for (; irepr >> 63 == 0; irepr <<= 1) {
+                res--;
+            }
+        }
+    }
+    return res;
+
+
+
+
+
+}
+
+static double __kefir_softfloat_scalbn(double x,
+                                                             int n) {
+    union __kefir_softfloat_double_repr rep;
+
+
+
+
+
+
+
+    for (int i = 0; i < 2 && n > 1023; i++) {
+        x *= 0x1p1023;
+        n -= 1023;
+    }
+    if (n > 1023) {
+        n = 1023;
+    }
+    for (int i = 0; i < 2 && n < -1022; i++) {
+        x *= (0x1p-1022 * 0x1p53);
+        n += 1022 - 53;
+    }
+    if (n < -1022) {
+        n = -1022;
+    }
+
+    rep.uint = ((long unsigned int) (1023 + n)) << 52;
+    return x * rep.d;
+
+
+
+
+
+
+}
+
+static double __kefir_softfloat_logb(double x) {
+    if (!__builtin_isfinite(x)) {
+        return x * x;
+    } else if (x == 0.0) {
+        return -__builtin_inff();
+    } else {
+        return (double) __kefir_softfloat_ilogb(x);
+    }
+}
+
+static double __kefir_softfloat_fmaximum_num(double x,
+                                                                   double y) {
+    if (__builtin_isless(x, y)) {
+        return y;
+    } else if (__builtin_isgreater(x, y)) {
+        return x;
+    } else if (x == y) {
+        return __builtin_copysign(1.0, x) >= __builtin_copysign(1.0, y) ? x : y;
+    }
+
+    return __builtin_isnan(y) ? (__builtin_isnan(x) ? x + y : x) : y;
+}
+
+
+union __kefir_softfloat_long_double_repr {
+    long double ld;
+    long unsigned int uint[2];
+};
+
+static long double __kefir_softfloat_fabsl(long double value) {
+    union __kefir_softfloat_long_double_repr rep = {.ld = value};
+
+    rep.uint[1] &= 0x7fff;
+    return rep.ld;
+}
+
+static long double __kefir_softfloat_scalbnl(long double x,
+                                                                   int n) {
+    union __kefir_softfloat_long_double_repr rep;
+
+
+
+
+
+
+    rep.ld = 1.0L;
+    for (int i = 0; i < 2 && n > 0x3fff; i++) {
+        x *= 0x1p16383L;
+        n -= 0x3fff;
+    }
+    if (n > 0x3fff) {
+        n = 0x3fff;
+    }
+    for (int i = 0; i < 2 && n < -0x3ffe; i++) {
+        x *= (0x1p-16382L * 0x1p113L);
+        n += 0x3ffe - 0x71;
+    }
+    if (n < -0x3ffe) {
+        n = -0x3ffe;
+    }
+
+    rep.uint[1] = 0x3fff + n;
+
+
+
+
+
+    return x * rep.ld;
+}
+
+static int __kefir_softfloat_ilogbl(long double x) {
+#pragma STDC FENV_ACCESS ON
+    union __kefir_softfloat_long_double_repr rep = {.ld = x};
+
+
+
+
+
+    long unsigned int mantissa = rep.uint[0], exponent = rep.uint[1] & 0x7fff;
+
+    int res = exponent;
+    if (exponent == 0 && mantissa == 0) {
+        volatile long double tmp = 0.0L / 0.0L;
+        (void) tmp;
+        res = (-0x80000000);
+    } else if (exponent == 0) {
+        int i = 0;
+        while (!(mantissa & (1ull << (64 - 1)))) {
+            mantissa <<= 1;
+            i++;
+        }
+        res = -0x3fff + 1 - i;
+    } else if (exponent == 0x7fff) {
+        volatile long double tmp = 0.0L / 0.0L;
+        (void) tmp;
+        res = (mantissa & (1ull << (64 - 1))) ? (-0x80000000) : (int) ((1u << (32 - 1)) - 1);
+    } else {
+        res -= 0x3fff;
+    }
+    return res;
+
+
+
+
+}
+
+static long double __kefir_softfloat_logbl(long double x) {
+    if (!__builtin_isfinite(x)) {
+        return x * x;
+    } else if (x == 0.0L) {
+        return -__builtin_inff();
+    } else {
+        return (long double) __kefir_softfloat_ilogbl(x);
+    }
+}
+# 363 "./headers/kefir_softfloat/math.h"
+static long double __kefir_softfloat_fmaximum_numl(long double x,
+                                                                         long double y) {
+    if (__builtin_isless(x, y)) {
+        return y;
+    } else if (__builtin_isgreater(x, y)) {
+        return x;
+    } else if (x == y) {
+        return __builtin_copysignl(1.0L, x) >= __builtin_copysignl(1.0L, y) ? x : y;
+    }
+
+    return __builtin_isnan(y) ? (__builtin_isnan(x) ? x + y : x) : y;
+}
+
+
+#pragma GCC diagnostic pop
+# 35 "./headers/kefir_softfloat/softfloat.h" 2
+# 1 "./headers/kefir_softfloat/complex.h" 1
+# 94 "./headers/kefir_softfloat/complex.h"
+static _Complex float __kefir_softfloat_complex_float_mul(float a, float b, float c, float d) { float ac = a * c, bd = b * d, ad = a * d, bc = b * c, x = ac - bd, y = ad + bc; if (__builtin_isnan(x) && __builtin_isnan(y)) { _Bool do_recompute = 0; const _Bool a_inf = __builtin_isinf_sign(a); const _Bool b_inf = __builtin_isinf_sign(b); const _Bool c_inf = __builtin_isinf_sign(c); const _Bool d_inf = __builtin_isinf_sign(d); if (a_inf || b_inf) { do { a = __builtin_copysignf(a_inf ? 1.0 : 0.0, a); } while (0); do { b = __builtin_copysignf(b_inf ? 1.0 : 0.0, b); } while (0); do { if (__builtin_isnan(c)) { c = __builtin_copysignf(0.0, c); } } while (0); do { if (__builtin_isnan(d)) { d = __builtin_copysignf(0.0, d); } } while (0); do_recompute = 1; } if (c_inf || d_inf) { do { c = __builtin_copysignf(c_inf ? 1.0 : 0.0, c); } while (0); do { d = __builtin_copysignf(d_inf ? 1.0 : 0.0, d); } while (0); do { if (__builtin_isnan(a)) { a = __builtin_copysignf(0.0, a); } } while (0); do { if (__builtin_isnan(b)) { b = __builtin_copysignf(0.0, b); } } while (0); do_recompute = 1; } if (!do_recompute && (__builtin_isinf_sign(ac) || __builtin_isinf_sign(bd) || __builtin_isinf_sign(ad) || __builtin_isinf_sign(bc))) { do { if (__builtin_isnan(a)) { a = __builtin_copysignf(0.0, a); } } while (0); do { if (__builtin_isnan(b)) { b = __builtin_copysignf(0.0, b); } } while (0); do { if (__builtin_isnan(c)) { c = __builtin_copysignf(0.0, c); } } while (0); do { if (__builtin_isnan(d)) { d = __builtin_copysignf(0.0, d); } } while (0); do_recompute = 1; } if (do_recompute) { x = __builtin_inff() * (a * c - b * d); y = __builtin_inff() * (a * d + b * c); } } return __kefir_builtin_construct_complex_float(x, y); }
+
+
+static _Complex double __kefir_softfloat_complex_double_mul(double a, double b, double c, double d) { double ac = a * c, bd = b * d, ad = a * d, bc = b * c, x = ac - bd, y = ad + bc; if (__builtin_isnan(x) && __builtin_isnan(y)) { _Bool do_recompute = 0; const _Bool a_inf = __builtin_isinf_sign(a); const _Bool b_inf = __builtin_isinf_sign(b); const _Bool c_inf = __builtin_isinf_sign(c); const _Bool d_inf = __builtin_isinf_sign(d); if (a_inf || b_inf) { do { a = __builtin_copysign(a_inf ? 1.0 : 0.0, a); } while (0); do { b = __builtin_copysign(b_inf ? 1.0 : 0.0, b); } while (0); do { if (__builtin_isnan(c)) { c = __builtin_copysign(0.0, c); } } while (0); do { if (__builtin_isnan(d)) { d = __builtin_copysign(0.0, d); } } while (0); do_recompute = 1; } if (c_inf || d_inf) { do { c = __builtin_copysign(c_inf ? 1.0 : 0.0, c); } while (0); do { d = __builtin_copysign(d_inf ? 1.0 : 0.0, d); } while (0); do { if (__builtin_isnan(a)) { a = __builtin_copysign(0.0, a); } } while (0); do { if (__builtin_isnan(b)) { b = __builtin_copysign(0.0, b); } } while (0); do_recompute = 1; } if (!do_recompute && (__builtin_isinf_sign(ac) || __builtin_isinf_sign(bd) || __builtin_isinf_sign(ad) || __builtin_isinf_sign(bc))) { do { if (__builtin_isnan(a)) { a = __builtin_copysign(0.0, a); } } while (0); do { if (__builtin_isnan(b)) { b = __builtin_copysign(0.0, b); } } while (0); do { if (__builtin_isnan(c)) { c = __builtin_copysign(0.0, c); } } while (0); do { if (__builtin_isnan(d)) { d = __builtin_copysign(0.0, d); } } while (0); do_recompute = 1; } if (do_recompute) { x = __builtin_inff() * (a * c - b * d); y = __builtin_inff() * (a * d + b * c); } } return __kefir_builtin_construct_complex_double(x, y); }
+
+
+static _Complex long double __kefir_softfloat_complex_long_double_mul(long double a, long double b, long double c, long double d) { long double ac = a * c, bd = b * d, ad = a * d, bc = b * c, x = ac - bd, y = ad + bc; if (__builtin_isnan(x) && __builtin_isnan(y)) { _Bool do_recompute = 0; const _Bool a_inf = __builtin_isinf_sign(a); const _Bool b_inf = __builtin_isinf_sign(b); const _Bool c_inf = __builtin_isinf_sign(c); const _Bool d_inf = __builtin_isinf_sign(d); if (a_inf || b_inf) { do { a = __builtin_copysignl(a_inf ? 1.0 : 0.0, a); } while (0); do { b = __builtin_copysignl(b_inf ? 1.0 : 0.0, b); } while (0); do { if (__builtin_isnan(c)) { c = __builtin_copysignl(0.0, c); } } while (0); do { if (__builtin_isnan(d)) { d = __builtin_copysignl(0.0, d); } } while (0); do_recompute = 1; } if (c_inf || d_inf) { do { c = __builtin_copysignl(c_inf ? 1.0 : 0.0, c); } while (0); do { d = __builtin_copysignl(d_inf ? 1.0 : 0.0, d); } while (0); do { if (__builtin_isnan(a)) { a = __builtin_copysignl(0.0, a); } } while (0); do { if (__builtin_isnan(b)) { b = __builtin_copysignl(0.0, b); } } while (0); do_recompute = 1; } if (!do_recompute && (__builtin_isinf_sign(ac) || __builtin_isinf_sign(bd) || __builtin_isinf_sign(ad) || __builtin_isinf_sign(bc))) { do { if (__builtin_isnan(a)) { a = __builtin_copysignl(0.0, a); } } while (0); do { if (__builtin_isnan(b)) { b = __builtin_copysignl(0.0, b); } } while (0); do { if (__builtin_isnan(c)) { c = __builtin_copysignl(0.0, c); } } while (0); do { if (__builtin_isnan(d)) { d = __builtin_copysignl(0.0, d); } } while (0); do_recompute = 1; } if (do_recompute) { x = __builtin_inff() * (a * c - b * d); y = __builtin_inff() * (a * d + b * c); } } return __kefir_builtin_construct_complex_long_double(x, y); }
+# 151 "./headers/kefir_softfloat/complex.h"
+static _Complex float __kefir_softfloat_complex_float_div(float a, float b, float c, float d) { const float logbw = __kefir_softfloat_logbf( __kefir_softfloat_fmaximum_numf(__kefir_softfloat_fabsf((c)), __kefir_softfloat_fabsf((d)))); int ilogbw = 0; if (__builtin_isfinite(logbw)) { ilogbw = (int) logbw; c = __kefir_softfloat_scalbnf(c, -ilogbw); d = __kefir_softfloat_scalbnf(d, -ilogbw); } const float denom = c * c + d * d; float x = __kefir_softfloat_scalbnf((a * c + b * d) / denom, -ilogbw); float y = __kefir_softfloat_scalbnf((b * c - a * d) / denom, -ilogbw); if (__builtin_isnan(x) && __builtin_isnan(y)) { if (denom == 0.0L && (!__builtin_isnan(a) || !__builtin_isnan(b))) { x = __builtin_copysignf(__builtin_inff(), c) * a; y = __builtin_copysignf(__builtin_inff(), c) * b; } else if ((__builtin_isinf_sign(a) || __builtin_isinf_sign(b)) && __builtin_isfinite(c) && __builtin_isfinite(d)) { do { *(&a) = __builtin_copysignf(__builtin_isinf_sign(*(&a)) ? 1.0 : 0.0, *(&a)); } while (0); do { *(&b) = __builtin_copysignf(__builtin_isinf_sign(*(&b)) ? 1.0 : 0.0, *(&b)); } while (0); x = __builtin_inff() * (a * c + b * d); y = __builtin_inff() * (b * c - a * d); } else if (__builtin_isinf_sign(logbw) && logbw > 0.0L && __builtin_isfinite(a) && __builtin_isfinite(b)) { do { *(&c) = __builtin_copysignf(__builtin_isinf_sign(*(&c)) ? 1.0 : 0.0, *(&c)); } while (0); do { *(&d) = __builtin_copysignf(__builtin_isinf_sign(*(&d)) ? 1.0 : 0.0, *(&d)); } while (0); x = 0.0 * (a * c + b * d); y = 0.0 * (b * c - a * d); } } return __kefir_builtin_construct_complex_float(x, y); }
+
+
+
+
+
+
+
+static _Complex double __kefir_softfloat_complex_double_div(double a, double b, double c, double d) { const double logbw = __kefir_softfloat_logb( __kefir_softfloat_fmaximum_num(__kefir_softfloat_fabs((c)), __kefir_softfloat_fabs((d)))); int ilogbw = 0; if (__builtin_isfinite(logbw)) { ilogbw = (int) logbw; c = __kefir_softfloat_scalbn(c, -ilogbw); d = __kefir_softfloat_scalbn(d, -ilogbw); } const double denom = c * c + d * d; double x = __kefir_softfloat_scalbn((a * c + b * d) / denom, -ilogbw); double y = __kefir_softfloat_scalbn((b * c - a * d) / denom, -ilogbw); if (__builtin_isnan(x) && __builtin_isnan(y)) { if (denom == 0.0L && (!__builtin_isnan(a) || !__builtin_isnan(b))) { x = __builtin_copysign(__builtin_inff(), c) * a; y = __builtin_copysign(__builtin_inff(), c) * b; } else if ((__builtin_isinf_sign(a) || __builtin_isinf_sign(b)) && __builtin_isfinite(c) && __builtin_isfinite(d)) { do { *(&a) = __builtin_copysign(__builtin_isinf_sign(*(&a)) ? 1.0 : 0.0, *(&a)); } while (0); do { *(&b) = __builtin_copysign(__builtin_isinf_sign(*(&b)) ? 1.0 : 0.0, *(&b)); } while (0); x = __builtin_inff() * (a * c + b * d); y = __builtin_inff() * (b * c - a * d); } else if (__builtin_isinf_sign(logbw) && logbw > 0.0L && __builtin_isfinite(a) && __builtin_isfinite(b)) { do { *(&c) = __builtin_copysign(__builtin_isinf_sign(*(&c)) ? 1.0 : 0.0, *(&c)); } while (0); do { *(&d) = __builtin_copysign(__builtin_isinf_sign(*(&d)) ? 1.0 : 0.0, *(&d)); } while (0); x = 0.0 * (a * c + b * d); y = 0.0 * (b * c - a * d); } } return __kefir_builtin_construct_complex_double(x, y); }
+
+
+
+
+
+
+
+static _Complex long double __kefir_softfloat_complex_long_double_div(long double a, long double b, long double c, long double d) { const long double logbw = __kefir_softfloat_logbl( __kefir_softfloat_fmaximum_numl(__kefir_softfloat_fabsl((c)), __kefir_softfloat_fabsl((d)))); int ilogbw = 0; if (__builtin_isfinite(logbw)) { ilogbw = (int) logbw; c = __kefir_softfloat_scalbnl(c, -ilogbw); d = __kefir_softfloat_scalbnl(d, -ilogbw); } const long double denom = c * c + d * d; long double x = __kefir_softfloat_scalbnl((a * c + b * d) / denom, -ilogbw); long double y = __kefir_softfloat_scalbnl((b * c - a * d) / denom, -ilogbw); if (__builtin_isnan(x) && __builtin_isnan(y)) { if (denom == 0.0L && (!__builtin_isnan(a) || !__builtin_isnan(b))) { x = __builtin_copysignl(__builtin_inff(), c) * a; y = __builtin_copysignl(__builtin_inff(), c) * b; } else if ((__builtin_isinf_sign(a) || __builtin_isinf_sign(b)) && __builtin_isfinite(c) && __builtin_isfinite(d)) { do { *(&a) = __builtin_copysignl(__builtin_isinf_sign(*(&a)) ? 1.0 : 0.0, *(&a)); } while (0); do { *(&b) = __builtin_copysignl(__builtin_isinf_sign(*(&b)) ? 1.0 : 0.0, *(&b)); } while (0); x = __builtin_inff() * (a * c + b * d); y = __builtin_inff() * (b * c - a * d); } else if (__builtin_isinf_sign(logbw) && logbw > 0.0L && __builtin_isfinite(a) && __builtin_isfinite(b)) { do { *(&c) = __builtin_copysignl(__builtin_isinf_sign(*(&c)) ? 1.0 : 0.0, *(&c)); } while (0); do { *(&d) = __builtin_copysignl(__builtin_isinf_sign(*(&d)) ? 1.0 : 0.0, *(&d)); } while (0); x = 0.0 * (a * c + b * d); y = 0.0 * (b * c - a * d); } } return __kefir_builtin_construct_complex_long_double(x, y); }
+# 36 "./headers/kefir_softfloat/softfloat.h" 2
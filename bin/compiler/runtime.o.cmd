@@ -0,0 +1,5 @@
+/root/repo
+source/compiler/runtime.c
+bin/compiler/runtime.o
+cc -std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE   '-DKEFIR_BUILD_CFLAGS=-std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE ' '-DKEFIR_BUILD_SOURCE_ID=r34.60859a684835f92cb8d8c88b94b1e4886c38ed1a' '-DKEFIR_BUILD_TIMESTAMP=1792239529' -I./headers -include ./bin/config.h -Ibin/compiler -DKEFIR_COMPILER_RUNTIME_KEFIR_BIGINT_INCLUDE=kefir_bigint.binary.h
+-Ibin/compiler -DKEFIR_COMPILER_RUNTIME_KEFIR_SOFTFLOAT_INCLUDE=kefir_softfloat.binary.h -c source/compiler/runtime.c -o bin/compiler/runtime.o
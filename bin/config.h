@@ -0,0 +1,8 @@
+#define KEFIR_CONFIG_HOST_TARGET "x86_64-linux-gnu"
+#define KEFIR_CONFIG_HOST_AS "as"
+#define KEFIR_CONFIG_HOST_LD "ld"
+#define KEFIR_CONFIG_HOST_PLATFORM KEFIR_DRIVER_TARGET_PLATFORM_LINUX
+#define KEFIR_CONFIG_HOST_VARIANT KEFIR_DRIVER_TARGET_VARIANT_GNU
+#define KEFIR_CONFIG_HOST_LINUX_GNU_INCLUDE_PATH "/usr/lib/gcc/x86_64-linux-gnu/12/include;/usr/local/include;/usr/include/x86_64-linux-gnu;/usr/include"
+#define KEFIR_CONFIG_HOST_LINUX_GNU_LIBRARY_PATH "/usr/lib/gcc/x86_64-linux-gnu/12/;/usr/lib/gcc/x86_64-linux-gnu/12/../../../../x86_64-linux-gnu/lib/x86_64-linux-gnu/12/;/usr/lib/gcc/x86_64-linux-gnu/12/../../../../x86_64-linux-gnu/lib/x86_64-linux-gnu/;/usr/lib/gcc/x86_64-linux-gnu/12/../../../../x86_64-linux-gnu/lib/../lib/;/usr/lib/gcc/x86_64-linux-gnu/12/../../../x86_64-linux-gnu/12/;/usr/lib/gcc/x86_64-linux-gnu/12/../../../x86_64-linux-gnu/;/usr/lib/gcc/x86_64-linux-gnu/12/../../../../lib/;/lib/x86_64-linux-gnu/12/;/lib/x86_64-linux-gnu/;/lib/../lib/;/usr/lib/x86_64-linux-gnu/12/;/usr/lib/x86_64-linux-gnu/;/usr/lib/../lib/;/usr/lib/gcc/x86_64-linux-gnu/12/../../../../x86_64-linux-gnu/lib/;/usr/lib/gcc/x86_64-linux-gnu/12/../../../;/lib/;/usr/lib/"
+#define KEFIR_CONFIG_HOST_LINUX_GNU_DYNAMIC_LINKER "/lib64/ld-linux-x86-64.so.2"
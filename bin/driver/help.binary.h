@@ -0,0 +1 @@
+0x00
@@ -0,0 +1,451 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 1 1 0 0 0 0 0 0 1 x86_64-att -
+optimizer 5 10 20 0 0 inline-asm-untie inline-func phi-removal constant-fold mem2reg dead-alloc local-alloc-sink phi-removal constant-fold op-simplify memory-ssa sroa gvn licm gvn memory-ssa dead-code-elimination merge-blocks lowering dead-alloc phi-removal constant-fold op-simplify canonicalize gvn phi-removal loop-removal merge-blocks dead-code-elimination tail-calls
+entry function __kefir_bigint_signed_multiply
+requires function __kefir_bigint_cast_signed
+requires function __kefir_bigint_left_shift
+content 13526
+__kefir_bigint_signed_multiply:
+.L__kefir_runtime_text_func___kefir_bigint_signed_multiply_begin:
+    push %rbp
+    mov %rsp, %rbp
+    push %rbx
+    push %r12
+    push %r13
+    push %r14
+    push %r15
+    sub $88, %rsp
+    mov %r9, %rbx
+    mov %r8, -96(%rbp)
+    mov %rcx, -128(%rbp)
+    mov %rdx, %r13
+    mov %rdi, -80(%rbp)
+    mov -96(%rbp), %rcx
+    sub $-7, %rcx
+    shr $3, %rcx
+    xor %edx, %edx
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label2:
+    cmp $0, %rbx
+    sete %dil
+    cmpq $0, -96(%rbp)
+    sete %r8b
+    cmp %rcx, %rdx
+    jb .L__kefir_runtime_func___kefir_bigint_signed_multiply_label81
+    or %dil, %r8b
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label80
+    lea -1(%rbx), %rcx
+    mov %rcx, %rdx
+    shr $3, %rdx
+    mov %rdx, -88(%rbp)
+    shl $3, %rdx
+    mov %rcx, %rax
+    sub %rdx, %rax
+    mov %rax, %rdx
+    lea 7(%rbx), %rcx
+    mov %rcx, %r15
+    shr $3, %r15
+    xor %ecx, %ecx
+    mov %rcx, %r8
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label5:
+    mov $1, %ecx
+    mov $1, %rax
+    cmp %rbx, %rax
+    mov %rcx, -72(%rbp)
+    movq -72(%rbp), %rax
+    cmova %rbx, %rax
+    movq %rax, -72(%rbp)
+    lea -1(%r15), %rcx
+    mov %rcx, -120(%rbp)
+    shl $3, %rcx
+    mov %rbx, %rax
+    sub %rcx, %rax
+    mov %rax, %rcx
+    mov $1, %r11d
+    shl %cl, %r11
+    mov %r11, -104(%rbp)
+    subb $1, -104(%rbp)
+    cmp %r15, %r8
+    jb .L__kefir_runtime_func___kefir_bigint_signed_multiply_label79
+    xor %ecx, %ecx
+    xor %eax, %eax
+    mov %rcx, -64(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label7:
+    cmpq %rbx, -64(%rbp)
+    jb .L__kefir_runtime_func___kefir_bigint_signed_multiply_label9
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label71:
+    cmp %r15, %rax
+    jb .L__kefir_runtime_func___kefir_bigint_signed_multiply_label73
+    mov -80(%rbp), %rdi
+    mov %rbx, %rsi
+    mov -96(%rbp), %rdx
+    call __kefir_bigint_left_shift
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label75:
+    cmp %r15, %rax
+    jb .L__kefir_runtime_func___kefir_bigint_signed_multiply_label77
+    shl $1, %rbx
+    mov -80(%rbp), %rdi
+    mov %rbx, %rsi
+    mov -96(%rbp), %rdx
+    call __kefir_bigint_cast_signed
+    xor %eax, %eax
+    lea -40(%rbp), %rsp
+    pop %r15
+    pop %r14
+    pop %r13
+    pop %r12
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label77:
+    mov -80(%rbp), %rdx
+    movb (%rdx, %rax, 1), %cl
+    movb (%r13, %rax, 1), %sil
+    or %sil, %cl
+    movb %cl, (%rdx, %rax, 1)
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label75
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label73:
+    mov -80(%rbp), %rdx
+    movb (%rdx, %rax, 1), %cl
+    movb (%rsi, %rax, 1), %dil
+    or %dil, %cl
+    movb %cl, (%rdx, %rax, 1)
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label71
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label9:
+    movzxb (%r13), %rcx
+    mov %rcx, %r10
+    and $1, %r10d
+    test %eax, %eax
+    setne %cl
+    movzx %cl, %rcx
+    test %r10d, %r10d
+    mov -112(%rbp), %r11
+    setne %r11b
+    xor %r12d, %r12d
+    test %r10d, %r10d
+    sete %r12b
+    test %eax, %eax
+    sete %al
+    test %r10d, %r10d
+    mov -112(%rbp), %rdi
+    setne %dil
+    and %al, %dil
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label11
+    test %r11b, %r11b
+    cmovz %rcx, %r12
+    test %r12d, %r12d
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label66
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label13:
+    movzxb (%rsi), %rax
+    mov %rax, -112(%rbp)
+    andl $1, -112(%rbp)
+    cmp $0, %rbx
+    je .L__kefir_runtime_func___kefir_bigint_signed_multiply_label28
+    movq -88(%rbp), %r9
+    movzxb (%rsi, %r9, 1), %rdi
+    mov $1, %r11d
+    mov %rdx, %rcx
+    shl %cl, %r11
+    sub $1, %r11b
+    mov %rdx, %rcx
+    sar %cl, %edi
+    and $1, %edi
+    mov $1, %ecx
+    mov $1, %r9
+    cmp %rbx, %r9
+    cmova %rbx, %rcx
+    test %rdi, %rdi
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label62
+    andb %r11b, -1(%rsi, %r15, 1)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label16:
+    mov %rcx, %r11
+    shr $3, %r11
+    cmp $0, %r11
+    ja .L__kefir_runtime_func___kefir_bigint_signed_multiply_label18
+    mov %rcx, %r11
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label25:
+    mov $8, %ecx
+    mov %rcx, %r12
+    sub %r11, %r12
+    cmp $0, %r11
+    ja .L__kefir_runtime_func___kefir_bigint_signed_multiply_label27
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label28:
+    movb -1(%r13, %r15, 1), %r9b
+    andb -104(%rbp), %r9b
+    movb %r9b, -1(%r13, %r15, 1)
+    mov -72(%rbp), %rcx
+    shr $3, %rcx
+    cmp $0, %rcx
+    ja .L__kefir_runtime_func___kefir_bigint_signed_multiply_label30
+    mov -72(%rbp), %rdi
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label35:
+    mov $8, %ecx
+    mov %rcx, %r11
+    sub %rdi, %r11
+    cmp $0, %rdi
+    ja .L__kefir_runtime_func___kefir_bigint_signed_multiply_label37
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label38:
+    mov %rax, %rdi
+    movq -88(%rbp), %r9
+    movb (%r13, %r9, 1), %dil
+    mov %rdx, %rcx
+    movl -112(%rbp), %eax
+    shl %cl, %eax
+    or %al, %dil
+    movq -88(%rbp), %r9
+    movb %dil, (%r13, %r9, 1)
+    mov -64(%rbp), %r8
+    add $1, %r8
+    mov %r8, -64(%rbp)
+    mov %r10d, %eax
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label7
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label37:
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label39:
+    movq -120(%rbp), %r9
+    cmp %r9, %rax
+    jb .L__kefir_runtime_func___kefir_bigint_signed_multiply_label41
+    movb -1(%r13, %r15, 1), %r9b
+    andb -104(%rbp), %r9b
+    movb %r9b, -1(%r13, %r15, 1)
+    movb -1(%r13, %r15, 1), %al
+    mov %rdi, %rcx
+    shr %cl, %al
+    movb %al, -1(%r13, %r15, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label38
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label41:
+    movzxb (%r13, %rax, 1), %r8
+    lea 1(%rax), %r9
+    movzxb 1(%r13, %rax, 1), %r12
+    mov %rdi, %rcx
+    sar %cl, %r8d
+    mov %r11, %rcx
+    shl %cl, %r12d
+    or %r12b, %r8b
+    movb %r8b, (%r13, %rax, 1)
+    mov %r9, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label39
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label30:
+    mov $-1, %rdi
+    xor %r11d, %r11d
+    mov $0, %r9b
+    test $0, %r9b
+    mov %rdi, %r9
+    cmovz %r11, %r9
+    mov %r9, %r11
+    mov %rcx, %rdi
+    shl $3, %rdi
+    mov -72(%rbp), %r9
+    sub %rdi, %r9
+    mov %r9, %rdi
+    mov %r15, %r12
+    sub %rcx, %r12
+    cmp %r15, %rcx
+    jae .L__kefir_runtime_func___kefir_bigint_signed_multiply_label32
+    xor %eax, %eax
+    xor %r14d, %r14d
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label44:
+    mov %r14d, %r9d
+    cmp %r12, %rax
+    jb .L__kefir_runtime_func___kefir_bigint_signed_multiply_label46
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label47:
+    cmp %r15, %r9
+    jae .L__kefir_runtime_func___kefir_bigint_signed_multiply_label35
+    mov %r14d, %eax
+    movb %r11b, (%r13, %rax, 1)
+    add $1, %r14d
+    mov %r14d, %r9d
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label47
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label46:
+    mov %r14d, %eax
+    mov %eax, %r8d
+    add %rcx, %r8
+    movb (%r13, %r8, 1), %r9b
+    movb %r9b, (%r13, %rax, 1)
+    lea 1(%r14d), %eax
+    mov %eax, %r14d
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label44
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label32:
+    xor %eax, %eax
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label33:
+    cmp %r15, %rax
+    jae .L__kefir_runtime_func___kefir_bigint_signed_multiply_label35
+    mov %ecx, %eax
+    movb %r11b, (%r13, %rax, 1)
+    lea 1(%ecx), %eax
+    mov %eax, %ecx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label33
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label27:
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label50:
+    movq %rcx, -56(%rbp)
+    movq -120(%rbp), %rcx
+    cmp %rcx, %rax
+    movq -56(%rbp), %rcx
+    jb .L__kefir_runtime_func___kefir_bigint_signed_multiply_label56
+    movb -1(%rsi, %r15, 1), %al
+    mov %r11, %rcx
+    shr %cl, %al
+    movb %al, -1(%rsi, %r15, 1)
+    mov %rdx, %rax
+    sub %r11, %rax
+    add $1, %rax
+    xor %ecx, %ecx
+    cmp %r11, %rdx
+    cmovb %rcx, %rax
+    mov $1, %r8d
+    mov %rax, %rcx
+    shl %cl, %r8
+    sub $1, %r8b
+    test %rdi, %rdi
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label53
+    andb %r8b, -1(%rsi, %r15, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label28
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label53:
+    movb -1(%rsi, %r15, 1), %al
+    not %r8b
+    or %r8b, %al
+    movb %al, -1(%rsi, %r15, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label28
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label56:
+    movzxb (%rsi, %rax, 1), %r8
+    lea 1(%rax), %r9
+    movzxb 1(%rsi, %rax, 1), %r14
+    mov %r11, %rcx
+    sar %cl, %r8d
+    mov %r12, %rcx
+    shl %cl, %r14d
+    or %r14b, %r8b
+    movb %r8b, (%rsi, %rax, 1)
+    mov %r9, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label50
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label18:
+    mov %r11, %r12
+    shl $3, %r12
+    sub %r12, %rcx
+    mov %r15, %r12
+    sub %r11, %r12
+    mov $-1, %rax
+    xor %r14d, %r14d
+    test %edi, %edi
+    cmovz %r14, %rax
+    cmp %r15, %r11
+    jae .L__kefir_runtime_func___kefir_bigint_signed_multiply_label20
+    xor %r14d, %r14d
+    xor %r9d, %r9d
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label21:
+    mov %r9d, %r8d
+    cmp %r12, %r14
+    jb .L__kefir_runtime_func___kefir_bigint_signed_multiply_label58
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label23:
+    cmp %r15, %r8
+    jb .L__kefir_runtime_func___kefir_bigint_signed_multiply_label57
+    mov %rcx, %r11
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label25
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label57:
+    mov %r9d, %r8d
+    movb %al, (%rsi, %r8, 1)
+    add $1, %r9d
+    mov %r9d, %r8d
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label23
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label58:
+    mov %r9d, %r8d
+    mov %r8d, %r14d
+    add %r11, %r14
+    movq %rax, -48(%rbp)
+    mov -56(%rbp), %rax
+    movb (%rsi, %r14, 1), %al
+    mov %rax, %r14
+    movq -48(%rbp), %rax
+    movb %r14b, (%rsi, %r8, 1)
+    add $1, %r9d
+    mov %r9d, %r14d
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label21
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label20:
+    xor %r11d, %r11d
+    xor %r12d, %r12d
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label59:
+    cmp %r15, %r11
+    jb .L__kefir_runtime_func___kefir_bigint_signed_multiply_label61
+    mov %rcx, %r11
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label25
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label61:
+    mov %r12d, %r8d
+    movb %al, (%rsi, %r8, 1)
+    lea 1(%r12d), %r11d
+    mov %r11d, %r12d
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label59
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label62:
+    movb -1(%rsi, %r15, 1), %r12b
+    not %r11b
+    or %r11b, %r12b
+    movb %r12b, -1(%rsi, %r15, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label16
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label66:
+    xor %eax, %eax
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label67:
+    cmp %r15, %rax
+    jae .L__kefir_runtime_func___kefir_bigint_signed_multiply_label13
+    movzxb (%rsi, %rax, 1), %rdi
+    movq %rcx, -56(%rbp)
+    movq -128(%rbp), %rcx
+    movzxb (%rcx, %rax, 1), %r11
+    movq -56(%rbp), %rcx
+    add %edi, %ecx
+    add %r11d, %ecx
+    movb %cl, (%rsi, %rax, 1)
+    add $1, %rax
+    shr $8, %ecx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label67
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label11:
+    xor %eax, %eax
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label12:
+    cmp %r15, %rax
+    jae .L__kefir_runtime_func___kefir_bigint_signed_multiply_label13
+    movzxb (%rsi, %rax, 1), %rdi
+    movq %rcx, -56(%rbp)
+    movq -128(%rbp), %rcx
+    movzxb (%rcx, %rax, 1), %r11
+    movq -56(%rbp), %rcx
+    sub %r11d, %edi
+    movq %rax, -56(%rbp)
+    mov %edi, %eax
+    sub %ecx, %eax
+    mov %rax, %rcx
+    movq -56(%rbp), %rax
+    movb %cl, (%rsi, %rax, 1)
+    add $1, %rax
+    shr $8, %ecx
+    and $1, %ecx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label12
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label79:
+    movb $0, (%rsi, %r8, 1)
+    add $1, %r8
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label5
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label80:
+    xor %eax, %eax
+    lea -40(%rbp), %rsp
+    pop %r15
+    pop %r14
+    pop %r13
+    pop %r12
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label81:
+    movq %rax, -56(%rbp)
+    movq -80(%rbp), %rax
+    movb $0, (%rax, %rdx, 1)
+    movq -56(%rbp), %rax
+    add $1, %rdx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label2
+.L__kefir_runtime_text_func___kefir_bigint_signed_multiply_end:
+# runtime cache hit
@@ -0,0 +1,74 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 1 1 0 0 0 0 0 0 1 x86_64-att -
+optimizer 5 10 20 0 0 inline-asm-untie inline-func phi-removal constant-fold mem2reg dead-alloc local-alloc-sink phi-removal constant-fold op-simplify memory-ssa sroa gvn licm gvn memory-ssa dead-code-elimination merge-blocks lowering dead-alloc phi-removal constant-fold op-simplify canonicalize gvn phi-removal loop-removal merge-blocks dead-code-elimination tail-calls
+entry function __kefir_bigint_left_shift
+content 2194
+__kefir_bigint_left_shift:
+.L__kefir_runtime_text_func___kefir_bigint_left_shift_begin:
+    cmp %rdx, %rsi
+    cmova %rdx, %rsi
+    sub $-7, %rdx
+    shr $3, %rdx
+    sub $1, %rdx
+    mov %rsi, %rcx
+    shr $3, %rcx
+    cmp $0, %rcx
+    ja .L__kefir_runtime_func___kefir_bigint_left_shift_label3
+.L__kefir_runtime_func___kefir_bigint_left_shift_label4:
+    mov $8, %eax
+    sub %rsi, %rax
+    cmp $0, %rsi
+    ja .L__kefir_runtime_func___kefir_bigint_left_shift_label8
+.L__kefir_runtime_func___kefir_bigint_left_shift_label7:
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_left_shift_label8:
+    cmp $0, %rdx
+    ja .L__kefir_runtime_func___kefir_bigint_left_shift_label10
+    movb (%rdi), %al
+    mov %rsi, %rcx
+    shl %cl, %al
+    movb %al, (%rdi)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label7
+.L__kefir_runtime_func___kefir_bigint_left_shift_label10:
+    movzxb (%rdi, %rdx, 1), %r8
+    movzxb -1(%rdi, %rdx, 1), %r9
+    mov %rsi, %rcx
+    shl %cl, %r8d
+    mov %rax, %rcx
+    sar %cl, %r9d
+    or %r9b, %r8b
+    movb %r8b, (%rdi, %rdx, 1)
+    add $-1, %rdx
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label8
+.L__kefir_runtime_func___kefir_bigint_left_shift_label3:
+    mov %rdx, %rax
+.L__kefir_runtime_func___kefir_bigint_left_shift_label11:
+    cmp %rcx, %rax
+    jae .L__kefir_runtime_func___kefir_bigint_left_shift_label16
+    xor %eax, %eax
+    mov %rax, %r8
+.L__kefir_runtime_func___kefir_bigint_left_shift_label13:
+    mov %rcx, %rax
+    shl $3, %rax
+    mov %rsi, %r9
+    sub %rax, %r9
+    mov %r9, %rax
+    cmp %rcx, %r8
+    jb .L__kefir_runtime_func___kefir_bigint_left_shift_label15
+    mov %rax, %rsi
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label4
+.L__kefir_runtime_func___kefir_bigint_left_shift_label15:
+    movb $0, (%rdi, %r8, 1)
+    add $1, %r8
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label13
+.L__kefir_runtime_func___kefir_bigint_left_shift_label16:
+    mov %rax, %r8
+    sub %rcx, %r8
+    movb (%rdi, %r8, 1), %r9b
+    movb %r9b, (%rdi, %rax, 1)
+    add $-1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label11
+.L__kefir_runtime_text_func___kefir_bigint_left_shift_end:
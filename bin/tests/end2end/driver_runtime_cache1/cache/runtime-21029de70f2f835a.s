@@ -0,0 +1,45 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 1 1 0 0 0 0 0 0 1 x86_64-att -
+optimizer 5 10 20 0 0 inline-asm-untie inline-func phi-removal constant-fold mem2reg dead-alloc local-alloc-sink phi-removal constant-fold op-simplify memory-ssa sroa gvn licm gvn memory-ssa dead-code-elimination merge-blocks lowering dead-alloc phi-removal constant-fold op-simplify canonicalize gvn phi-removal loop-removal merge-blocks dead-code-elimination tail-calls
+entry function __kefir_bigint_set_signed_integer
+requires function __kefir_bigint_cast_signed
+content 1294
+__kefir_bigint_set_signed_integer:
+.L__kefir_runtime_text_func___kefir_bigint_set_signed_integer_begin:
+    push %rbp
+    mov %rsp, %rbp
+    mov %rsi, %rax
+    cmp $0, %rax
+    je .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label3
+    mov $64, %ecx
+    cmp $64, %rax
+    mov %rax, %rsi
+    cmova %rcx, %rsi
+    lea 7(%rsi), %rcx
+    shr $3, %rcx
+    xor %r8d, %r8d
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label5:
+    cmp %rcx, %r8
+    jb .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label7
+    cmp %rax, %rsi
+    jb .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label10
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label11:
+    xor %eax, %eax
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label10:
+    mov %rax, %rdx
+    call __kefir_bigint_cast_signed
+    jmp .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label11
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label7:
+    movb %dl, (%rdi, %r8, 1)
+    add $1, %r8
+    shr $8, %rdx
+    jmp .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label5
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label3:
+    xor %eax, %eax
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_set_signed_integer_end:
@@ -0,0 +1,138 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry function __kefir_bigint_is_zero
+content 3067
+__kefir_bigint_is_zero:
+.L__kefir_runtime_text_func___kefir_bigint_is_zero_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $64, %rsp
+    movq %rsi, -48(%rbp)
+    movq %rdi, -56(%rbp)
+    movq -48(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_is_zero_label15
+    movq -48(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -40(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_is_zero_label3:
+    movq -8(%rbp), %rax
+    movq -40(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_is_zero_label5
+    mov $1, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_is_zero_label5:
+    movq -56(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movb %cl, -32(%rbp)
+    movq -8(%rbp), %rax
+    movq -40(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    add %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_is_zero_label7
+.L__kefir_runtime_func___kefir_bigint_is_zero_label8:
+    movb -32(%rbp), %al
+    test %al, %al
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_is_zero_label10
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_is_zero_label3
+.L__kefir_runtime_func___kefir_bigint_is_zero_label10:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_is_zero_label7:
+    movq -48(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -24(%rbp)
+    movq -48(%rbp), %rax
+    movq -24(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -16(%rbp)
+    movq -16(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    add %rcx, %rax
+    mov $1, %edx
+    mov %rax, %rcx
+    shl %cl, %rdx
+    mov $1, %ecx
+    movsx %ecx, %rax
+    sub %rax, %rdx
+    movl %edx, -28(%rbp)
+    movl -28(%rbp), %eax
+    movb -32(%rbp), %cl
+    movzx %cl, %ecx
+    and %eax, %ecx
+    movb %cl, -32(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_is_zero_label8
+.L__kefir_runtime_func___kefir_bigint_is_zero_label15:
+    mov $1, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_is_zero_end:
@@ -0,0 +1,67 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry function __kefir_bigint_get_sign
+content 1313
+__kefir_bigint_get_sign:
+.L__kefir_runtime_text_func___kefir_bigint_get_sign_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $32, %rsp
+    movq %rsi, -8(%rbp)
+    movq %rdi, -32(%rbp)
+    movq -8(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_get_sign_label5
+    movq -8(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -16(%rbp)
+    movq -8(%rbp), %rax
+    movq -16(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -24(%rbp)
+    movq -32(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -24(%rbp), %rdx
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    and $1, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_get_sign_label5:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_get_sign_end:
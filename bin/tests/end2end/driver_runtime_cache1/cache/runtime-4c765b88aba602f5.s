@@ -0,0 +1,33 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 1 1 0 0 0 0 0 0 1 x86_64-att -
+optimizer 5 10 20 0 0 inline-asm-untie inline-func phi-removal constant-fold mem2reg dead-alloc local-alloc-sink phi-removal constant-fold op-simplify memory-ssa sroa gvn licm gvn memory-ssa dead-code-elimination merge-blocks lowering dead-alloc phi-removal constant-fold op-simplify canonicalize gvn phi-removal loop-removal merge-blocks dead-code-elimination tail-calls
+entry function __kefir_bigint_util_add_digit_zero_extended
+content 880
+__kefir_bigint_util_add_digit_zero_extended:
+.L__kefir_runtime_text_func___kefir_bigint_util_add_digit_zero_extended_begin:
+    movzx %sil, %rax
+    sub $-7, %rdx
+    shr $3, %rdx
+    xor %ecx, %ecx
+    xor %esi, %esi
+.L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label2:
+    cmp %rdx, %rcx
+    jb .L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label4
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label4:
+    movzxb (%rdi, %rcx, 1), %r8
+    add %r8d, %esi
+    xor %r8d, %r8d
+    cmp $0, %rcx
+    mov %rax, %r9
+    cmovne %r8, %r9
+    mov %r9, %r8
+    add %r8d, %esi
+    movb %sil, (%rdi, %rcx, 1)
+    add $1, %rcx
+    shr $8, %esi
+    jmp .L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label2
+.L__kefir_runtime_text_func___kefir_bigint_util_add_digit_zero_extended_end:
@@ -0,0 +1,414 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry function __kefir_bigint_signed_multiply
+requires function __kefir_bigint_cast_signed
+requires function __kefir_bigint_right_shift
+requires function __kefir_bigint_arithmetic_right_shift
+requires function __kefir_bigint_left_shift
+requires function __kefir_bigint_add
+requires function __kefir_bigint_subtract
+content 10375
+__kefir_bigint_signed_multiply:
+.L__kefir_runtime_text_func___kefir_bigint_signed_multiply_begin:
+    push %rbp
+    mov %rsp, %rbp
+    push %rbx
+    sub $120, %rsp
+    movq %r9, -112(%rbp)
+    movq %r8, -88(%rbp)
+    movq %rcx, -64(%rbp)
+    movq %rdx, -80(%rbp)
+    movq %rsi, -96(%rbp)
+    movq %rdi, -128(%rbp)
+    movq -128(%rbp), %rax
+    movq -88(%rbp), %rcx
+    mov $0, %edx
+    movsx %edx, %rsi
+    movq %rcx, -40(%rbp)
+    movq %rax, -48(%rbp)
+    movq -40(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -56(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -32(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label3:
+    movq -32(%rbp), %rax
+    movq -56(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label5
+    movq -88(%rbp), %rax
+    xor %ecx, %ecx
+    cmp %rsi, %rax
+    sete %cl
+    test %cl, %cl
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label41
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label8:
+    test %ecx, %ecx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label40
+    movq -112(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -72(%rbp)
+    movq -112(%rbp), %rax
+    movq -72(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -120(%rbp)
+    movq -96(%rbp), %rax
+    movq -112(%rbp), %rcx
+    mov $0, %edx
+    movsx %edx, %rsi
+    movq %rcx, -48(%rbp)
+    movq %rax, -56(%rbp)
+    movq -48(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -40(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -32(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label11:
+    movq -32(%rbp), %rax
+    movq -40(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label39
+    movl $0, -104(%rbp)
+    movq %rsi, -56(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label13:
+    movq -56(%rbp), %rax
+    movq -112(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label15
+    movq -128(%rbp), %rax
+    movq -96(%rbp), %rcx
+    movq -112(%rbp), %rdx
+    mov $2, %esi
+    movsx %esi, %rbx
+    movq %rdx, -32(%rbp)
+    movq %rcx, -40(%rbp)
+    movq %rax, -48(%rbp)
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -56(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -24(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label31:
+    movq -24(%rbp), %rax
+    movq -56(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label33
+    movq -128(%rbp), %rdi
+    movq -112(%rbp), %rsi
+    movq -88(%rbp), %rdx
+    call __kefir_bigint_left_shift
+    movq -128(%rbp), %rax
+    movq -80(%rbp), %rcx
+    movq -112(%rbp), %rdx
+    movq %rdx, -56(%rbp)
+    movq %rcx, -40(%rbp)
+    movq %rax, -48(%rbp)
+    movq -56(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -32(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -24(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label36:
+    movq -24(%rbp), %rax
+    movq -32(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label38
+    movq -128(%rbp), %rdi
+    movq -112(%rbp), %rax
+    movq -88(%rbp), %rdx
+    imul %rbx, %rax
+    mov %rax, %rsi
+    call __kefir_bigint_cast_signed
+    xor %eax, %eax
+    lea -8(%rbp), %rsp
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label38:
+    movq -48(%rbp), %rax
+    movq -24(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -16(%rbp)
+    movq -40(%rbp), %rax
+    movq -24(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -100(%rbp)
+    movl -16(%rbp), %eax
+    movl -100(%rbp), %ecx
+    movq -48(%rbp), %rdx
+    movq -24(%rbp), %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rdx
+    or %ecx, %eax
+    movb %al, (%rdx)
+    movq -24(%rbp), %rax
+    add $1, %rax
+    movq %rax, -24(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label36
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label33:
+    movq -48(%rbp), %rax
+    movq -24(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -100(%rbp)
+    movq -40(%rbp), %rax
+    movq -24(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -16(%rbp)
+    movl -100(%rbp), %eax
+    movl -16(%rbp), %ecx
+    movq -48(%rbp), %rdx
+    movq -24(%rbp), %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rdx
+    or %ecx, %eax
+    movb %al, (%rdx)
+    movq -24(%rbp), %rax
+    add $1, %rax
+    movq %rax, -24(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label31
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label15:
+    movq -80(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    and $1, %ecx
+    movl %ecx, -100(%rbp)
+    movl -100(%rbp), %eax
+    test %eax, %eax
+    setne %al
+    movzx %al, %rax
+    test %al, %al
+    sete %cl
+    test %cl, %cl
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label28
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label17:
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label19
+    movl -100(%rbp), %eax
+    xor %ecx, %ecx
+    test %eax, %eax
+    sete %cl
+    test %cl, %cl
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label23
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label24:
+    test %ecx, %ecx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label26
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label20:
+    movl -100(%rbp), %eax
+    movl %eax, -104(%rbp)
+    movq -96(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    and $1, %ecx
+    movl %ecx, -48(%rbp)
+    movq -96(%rbp), %rdi
+    movq -112(%rbp), %rdx
+    mov $1, %eax
+    movsx %eax, %rsi
+    call __kefir_bigint_arithmetic_right_shift
+    movq -80(%rbp), %rdi
+    movq -112(%rbp), %rdx
+    mov $1, %eax
+    movsx %eax, %rsi
+    call __kefir_bigint_right_shift
+    movl -48(%rbp), %eax
+    movq -120(%rbp), %rcx
+    movq -80(%rbp), %rdx
+    movq -72(%rbp), %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rdx
+    movb (%rdx), %sil
+    movzx %sil, %esi
+    shl %cl, %eax
+    or %eax, %esi
+    movb %sil, (%rdx)
+    movq -56(%rbp), %rax
+    add $1, %rax
+    movq %rax, -56(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label13
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label26:
+    movq -96(%rbp), %rdi
+    movq -64(%rbp), %rsi
+    movq -112(%rbp), %rdx
+    call __kefir_bigint_add
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label20
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label23:
+    movl -104(%rbp), %eax
+    test %eax, %eax
+    setne %al
+    movzx %al, %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label24
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label19:
+    movq -96(%rbp), %rdi
+    movq -64(%rbp), %rsi
+    movq -112(%rbp), %rdx
+    call __kefir_bigint_subtract
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label20
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label28:
+    movl -104(%rbp), %ecx
+    xor %eax, %eax
+    test %ecx, %ecx
+    sete %al
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label17
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label39:
+    movq -56(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb $0, (%rax)
+    movq -32(%rbp), %rax
+    add $1, %rax
+    movq %rax, -32(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label11
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label40:
+    xor %eax, %eax
+    lea -8(%rbp), %rsp
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label41:
+    movq -112(%rbp), %rax
+    mov $0, %edi
+    movsx %edi, %rdx
+    xor %ecx, %ecx
+    cmp %rdx, %rax
+    sete %cl
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label8
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label5:
+    movq -48(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb $0, (%rax)
+    movq -32(%rbp), %rax
+    add $1, %rax
+    movq %rax, -32(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label3
+.L__kefir_runtime_text_func___kefir_bigint_signed_multiply_end:
@@ -0,0 +1,12 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 1 1 0 0 0 0 0 0 1 x86_64-att -
+optimizer 5 10 20 0 0 inline-asm-untie inline-func phi-removal constant-fold mem2reg dead-alloc local-alloc-sink phi-removal constant-fold op-simplify memory-ssa sroa gvn licm gvn memory-ssa dead-code-elimination merge-blocks lowering dead-alloc phi-removal constant-fold op-simplify canonicalize gvn phi-removal loop-removal merge-blocks dead-code-elimination tail-calls
+entry prologue
+content 67
+.att_syntax
+.section .note.GNU-stack,"",%progbits
+
+
+.section .text
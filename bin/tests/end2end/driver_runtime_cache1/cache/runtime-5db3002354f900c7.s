@@ -0,0 +1,335 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry function __kefir_bigint_arithmetic_right_shift
+requires function __kefir_bigint_right_shift_whole_digits
+content 8273
+__kefir_bigint_arithmetic_right_shift:
+.L__kefir_runtime_text_func___kefir_bigint_arithmetic_right_shift_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $80, %rsp
+    movq %rdx, -80(%rbp)
+    movq %rsi, -56(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -80(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label35
+    movq -56(%rbp), %rax
+    movq -80(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label4
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label5:
+    movq -80(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -40(%rbp)
+    movq -80(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -48(%rbp)
+    movq -80(%rbp), %rax
+    movq -48(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -64(%rbp)
+    movq -24(%rbp), %rax
+    movq -48(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -64(%rbp), %rdx
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    and $1, %eax
+    movsx %eax, %rax
+    movq %rax, -32(%rbp)
+    movq -32(%rbp), %rax
+    test %rax, %rax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label7
+    movq -64(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movl %eax, -16(%rbp)
+    movl -16(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -40(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    and %eax, %edx
+    movb %dl, (%rcx)
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label8:
+    movq -56(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -72(%rbp)
+    movq -72(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label10
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label11:
+    movq -56(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label13
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label24:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label13:
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -16(%rbp)
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label14:
+    movq -16(%rbp), %rax
+    movq -40(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label16
+    movq -56(%rbp), %rcx
+    movq -24(%rbp), %rax
+    movq -40(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movb (%rax), %dl
+    shr %cl, %dl
+    movb %dl, (%rax)
+    movq -64(%rbp), %rax
+    movq -56(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    xor %esi, %esi
+    cmp %rax, %rcx
+    sete %sil
+    or %rsi, %rdx
+    setne %dl
+    movzx %dl, %rax
+    test %eax, %eax
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label30
+    movq -64(%rbp), %rcx
+    movq -56(%rbp), %rax
+    sub %rax, %rcx
+    mov $1, %edx
+    movsx %edx, %rax
+    add %rax, %rcx
+    lea -8(%rbp), %rax
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label21:
+    movq %rcx, (%rax)
+    movq -32(%rbp), %rax
+    test %rax, %rax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label23
+    movq -8(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movl %eax, -16(%rbp)
+    movl -16(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -40(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    and %eax, %edx
+    movb %dl, (%rcx)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label24
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label23:
+    movq -8(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    not %rax
+    movl %eax, -16(%rbp)
+    movl -16(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -40(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    or %eax, %edx
+    movb %dl, (%rcx)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label24
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label30:
+    mov $0, %eax
+    movsx %eax, %rcx
+    lea -8(%rbp), %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label21
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label16:
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -56(%rbp), %rdx
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %rsi
+    mov $1, %r8d
+    movsx %r8d, %rdi
+    add %rdi, %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rax
+    movb (%rax), %sil
+    movq -56(%rbp), %rdi
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %r8
+    imul $1, %r8, %r8
+    add %rax, %r8
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    movzx %sil, %esi
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    mov %rdx, %rcx
+    sub %rdi, %rcx
+    shl %cl, %esi
+    or %esi, %eax
+    movb %al, (%r8)
+    movq -16(%rbp), %rax
+    add $1, %rax
+    movq %rax, -16(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label14
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label10:
+    movq -24(%rbp), %rdi
+    movq -72(%rbp), %rsi
+    movq -32(%rbp), %rdx
+    movq -80(%rbp), %rcx
+    call __kefir_bigint_right_shift_whole_digits
+    movq -72(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rax
+    sub %rax, %rcx
+    movq %rcx, -56(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label11
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label7:
+    movq -64(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    not %rax
+    movl %eax, -16(%rbp)
+    movl -16(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -40(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    or %eax, %edx
+    movb %dl, (%rcx)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label8
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label4:
+    movq -80(%rbp), %rax
+    movq %rax, -56(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label5
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label35:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_arithmetic_right_shift_end:
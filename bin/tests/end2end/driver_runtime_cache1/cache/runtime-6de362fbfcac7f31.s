@@ -0,0 +1,89 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry function __kefir_bigint_subtract
+content 1924
+__kefir_bigint_subtract:
+.L__kefir_runtime_text_func___kefir_bigint_subtract_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $64, %rsp
+    movq %rdx, -40(%rbp)
+    movq %rsi, -56(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -40(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -32(%rbp)
+    movl $0, -48(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -16(%rbp)
+.L__kefir_runtime_func___kefir_bigint_subtract_label2:
+    movq -16(%rbp), %rax
+    movq -32(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_subtract_label4
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_subtract_label4:
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -44(%rbp)
+    movq -56(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -4(%rbp)
+    movl -44(%rbp), %eax
+    movl -4(%rbp), %ecx
+    movl -48(%rbp), %edx
+    sub %ecx, %eax
+    sub %edx, %eax
+    movl %eax, -8(%rbp)
+    movl -8(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -16(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movl -8(%rbp), %eax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    shr %cl, %eax
+    and $1, %eax
+    movl %eax, -48(%rbp)
+    movq -16(%rbp), %rax
+    add $1, %rax
+    movq %rax, -16(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_subtract_label2
+.L__kefir_runtime_text_func___kefir_bigint_subtract_end:
@@ -0,0 +1,12 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry prologue
+content 67
+.att_syntax
+.section .note.GNU-stack,"",%progbits
+
+
+.section .text
@@ -0,0 +1,173 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry function __kefir_bigint_subtract_zero_extend
+content 4053
+__kefir_bigint_subtract_zero_extend:
+.L__kefir_runtime_text_func___kefir_bigint_subtract_zero_extend_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $96, %rsp
+    movq %rcx, -88(%rbp)
+    movq %rdx, -64(%rbp)
+    movq %rsi, -40(%rbp)
+    movq %rdi, -48(%rbp)
+    movq -64(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -72(%rbp)
+    movq -88(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -56(%rbp)
+    movl $0, -80(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -32(%rbp)
+.L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label2:
+    movq -32(%rbp), %rax
+    movq -72(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label4
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label4:
+    movq -48(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -8(%rbp)
+    movl $0, -12(%rbp)
+    movq -32(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    add %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label10
+    movq -32(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    add %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label7
+    movl $0, -12(%rbp)
+.L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label8:
+    movl -8(%rbp), %eax
+    movl -12(%rbp), %ecx
+    movl -80(%rbp), %edx
+    sub %ecx, %eax
+    sub %edx, %eax
+    movl %eax, -16(%rbp)
+    movl -16(%rbp), %eax
+    movq -48(%rbp), %rcx
+    movq -32(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movl -16(%rbp), %eax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    shr %cl, %eax
+    and $1, %eax
+    movl %eax, -80(%rbp)
+    movq -32(%rbp), %rax
+    add $1, %rax
+    movq %rax, -32(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label2
+.L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label7:
+    movq -40(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -12(%rbp)
+    movq -88(%rbp), %rcx
+    movq -88(%rbp), %rax
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    xor %edx, %edx
+    div %rsi
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rax
+    sub %rax, %rcx
+    movq %rcx, -24(%rbp)
+    movq -24(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movl %eax, -76(%rbp)
+    movl -76(%rbp), %eax
+    movl -12(%rbp), %ecx
+    and %eax, %ecx
+    movl %ecx, -12(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label8
+.L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label10:
+    movq -40(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -12(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label8
+.L__kefir_runtime_text_func___kefir_bigint_subtract_zero_extend_end:
@@ -0,0 +1,161 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry function __kefir_bigint_left_shift
+requires function __kefir_bigint_left_shift_whole_digits
+content 3822
+__kefir_bigint_left_shift:
+.L__kefir_runtime_text_func___kefir_bigint_left_shift_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $48, %rsp
+    movq %rdx, -32(%rbp)
+    movq %rsi, -48(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -48(%rbp), %rax
+    movq -32(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_left_shift_label15
+.L__kefir_runtime_func___kefir_bigint_left_shift_label2:
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -40(%rbp)
+    movq -48(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -16(%rbp)
+    movq -16(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_left_shift_label9
+.L__kefir_runtime_func___kefir_bigint_left_shift_label3:
+    movq -48(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_left_shift_label5
+.L__kefir_runtime_func___kefir_bigint_left_shift_label4:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_left_shift_label5:
+    movq -40(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_left_shift_label6:
+    movq -8(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_left_shift_label8
+    movq -48(%rbp), %rcx
+    movq -24(%rbp), %rax
+    mov $0, %esi
+    movsx %esi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movb (%rax), %dl
+    shl %cl, %dl
+    movb %dl, (%rax)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label4
+.L__kefir_runtime_func___kefir_bigint_left_shift_label8:
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -48(%rbp), %rdx
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rsi
+    mov $1, %r8d
+    movsx %r8d, %rdi
+    sub %rdi, %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rax
+    movb (%rax), %sil
+    movq -48(%rbp), %rdi
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %r8
+    imul $1, %r8, %r8
+    add %rax, %r8
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    shl %cl, %eax
+    movzx %sil, %esi
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    mov %rdx, %rcx
+    sub %rdi, %rcx
+    sar %cl, %esi
+    or %esi, %eax
+    movb %al, (%r8)
+    movq -8(%rbp), %rax
+    add $-1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label6
+.L__kefir_runtime_func___kefir_bigint_left_shift_label9:
+    movq -24(%rbp), %rdi
+    movq -16(%rbp), %rsi
+    movq -32(%rbp), %rdx
+    call __kefir_bigint_left_shift_whole_digits
+    movq -16(%rbp), %rax
+    movq -48(%rbp), %rcx
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rax
+    sub %rax, %rcx
+    movq %rcx, -48(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label3
+.L__kefir_runtime_func___kefir_bigint_left_shift_label15:
+    movq -32(%rbp), %rax
+    movq %rax, -48(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label2
+.L__kefir_runtime_text_func___kefir_bigint_left_shift_end:
@@ -0,0 +1,26 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 1 1 0 0 0 0 0 0 1 x86_64-att -
+optimizer 5 10 20 0 0 inline-asm-untie inline-func phi-removal constant-fold mem2reg dead-alloc local-alloc-sink phi-removal constant-fold op-simplify memory-ssa sroa gvn licm gvn memory-ssa dead-code-elimination merge-blocks lowering dead-alloc phi-removal constant-fold op-simplify canonicalize gvn phi-removal loop-removal merge-blocks dead-code-elimination tail-calls
+entry function __kefir_bigint_get_sign
+content 504
+__kefir_bigint_get_sign:
+.L__kefir_runtime_text_func___kefir_bigint_get_sign_begin:
+    cmp $0, %rsi
+    je .L__kefir_runtime_func___kefir_bigint_get_sign_label3
+    sub $1, %rsi
+    mov %rsi, %rax
+    shr $3, %rax
+    movzxb (%rdi, %rax, 1), %rdx
+    shl $3, %rax
+    mov %rsi, %rcx
+    sub %rax, %rcx
+    sar %cl, %edx
+    mov %edx, %eax
+    and $1, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_get_sign_label3:
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_get_sign_end:
@@ -0,0 +1,220 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry function __kefir_bigint_unsigned_divide
+requires function __kefir_bigint_is_zero
+requires function __kefir_bigint_subtract_zero_extend
+requires function __kefir_bigint_left_shift
+requires function __kefir_bigint_add_zero_extend
+content 5160
+__kefir_bigint_unsigned_divide:
+.L__kefir_runtime_text_func___kefir_bigint_unsigned_divide_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $96, %rsp
+    movq %r8, -80(%rbp)
+    movq %rcx, -56(%rbp)
+    movq %rdx, -40(%rbp)
+    movq %rsi, -48(%rbp)
+    movq %rdi, -64(%rbp)
+    movq -48(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $0, %edx
+    movsx %edx, %rsi
+    movq %rcx, -24(%rbp)
+    movq %rax, -32(%rbp)
+    movq -24(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -16(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label3:
+    movq -8(%rbp), %rax
+    movq -16(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label17
+    movq -56(%rbp), %rax
+    xor %ecx, %ecx
+    cmp %rsi, %rax
+    sete %cl
+    test %ecx, %ecx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label16
+    movq -40(%rbp), %rdi
+    movq -80(%rbp), %rsi
+    call __kefir_bigint_is_zero
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label7
+    movq -56(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -72(%rbp)
+    movq -56(%rbp), %rax
+    movq -72(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -88(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -24(%rbp)
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label9:
+    movq -24(%rbp), %rax
+    movq -56(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label11
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label11:
+    movq -64(%rbp), %rax
+    movq -72(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -88(%rbp), %rdx
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    and $1, %eax
+    movl %eax, -32(%rbp)
+    movq -48(%rbp), %rdi
+    movq -56(%rbp), %rdx
+    mov $1, %eax
+    movsx %eax, %rsi
+    call __kefir_bigint_left_shift
+    movq -64(%rbp), %rdi
+    movq -56(%rbp), %rdx
+    mov $1, %eax
+    movsx %eax, %rsi
+    call __kefir_bigint_left_shift
+    movl -32(%rbp), %eax
+    movq -48(%rbp), %rcx
+    mov $0, %esi
+    movsx %esi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    or %eax, %edx
+    movb %dl, (%rcx)
+    movq -48(%rbp), %rdi
+    movq -40(%rbp), %rsi
+    movq -56(%rbp), %rdx
+    movq -80(%rbp), %rcx
+    call __kefir_bigint_subtract_zero_extend
+    movq -48(%rbp), %rax
+    movq -72(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -88(%rbp), %rdx
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    and $1, %eax
+    movl %eax, -28(%rbp)
+    movl -28(%rbp), %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label13
+    movq -64(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    or $1, %ecx
+    movb %cl, (%rax)
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label14:
+    movq -24(%rbp), %rax
+    add $1, %rax
+    movq %rax, -24(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label9
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label13:
+    movq -64(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    mov $1, %edx
+    movzx %dl, %edx
+    not %edx
+    and %edx, %ecx
+    movb %cl, (%rax)
+    movq -48(%rbp), %rdi
+    movq -40(%rbp), %rsi
+    movq -56(%rbp), %rdx
+    movq -80(%rbp), %rcx
+    call __kefir_bigint_add_zero_extend
+    jmp .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label14
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label7:
+    mov $1, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label16:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label17:
+    movq -32(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb $0, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label3
+.L__kefir_runtime_text_func___kefir_bigint_unsigned_divide_end:
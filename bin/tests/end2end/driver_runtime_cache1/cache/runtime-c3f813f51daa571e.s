@@ -0,0 +1,207 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry function __kefir_bigint_right_shift
+requires function __kefir_bigint_right_shift_whole_digits
+content 4804
+__kefir_bigint_right_shift:
+.L__kefir_runtime_text_func___kefir_bigint_right_shift_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $64, %rsp
+    movq %rdx, -64(%rbp)
+    movq %rsi, -24(%rbp)
+    movq %rdi, -16(%rbp)
+    movq -24(%rbp), %rax
+    movq -64(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_label15
+.L__kefir_runtime_func___kefir_bigint_right_shift_label2:
+    movq -64(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -56(%rbp)
+    movq -24(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -32(%rbp)
+    movq -64(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rcx
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -48(%rbp)
+    movq -48(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movl %eax, -40(%rbp)
+    movl -40(%rbp), %eax
+    movq -16(%rbp), %rcx
+    movq -56(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    and %eax, %edx
+    movb %dl, (%rcx)
+    movq -32(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_label9
+.L__kefir_runtime_func___kefir_bigint_right_shift_label3:
+    movq -24(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_label5
+.L__kefir_runtime_func___kefir_bigint_right_shift_label4:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_right_shift_label5:
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_right_shift_label6:
+    movq -8(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_label8
+    movl -40(%rbp), %eax
+    movq -16(%rbp), %rcx
+    movq -56(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    and %eax, %edx
+    movb %dl, (%rcx)
+    movq -24(%rbp), %rcx
+    movq -16(%rbp), %rax
+    movq -56(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movb (%rax), %dl
+    shr %cl, %dl
+    movb %dl, (%rax)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_label4
+.L__kefir_runtime_func___kefir_bigint_right_shift_label8:
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -24(%rbp), %rdx
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rsi
+    mov $1, %r8d
+    movsx %r8d, %rdi
+    add %rdi, %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rax
+    movb (%rax), %sil
+    movq -24(%rbp), %rdi
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %r8
+    imul $1, %r8, %r8
+    add %rax, %r8
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    movzx %sil, %esi
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    mov %rdx, %rcx
+    sub %rdi, %rcx
+    shl %cl, %esi
+    or %esi, %eax
+    movb %al, (%r8)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_label6
+.L__kefir_runtime_func___kefir_bigint_right_shift_label9:
+    movq -16(%rbp), %rdi
+    movq -32(%rbp), %rsi
+    movq -64(%rbp), %rcx
+    xor %edx, %edx
+    call __kefir_bigint_right_shift_whole_digits
+    movq -32(%rbp), %rax
+    movq -24(%rbp), %rcx
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rax
+    sub %rax, %rcx
+    movq %rcx, -24(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_label3
+.L__kefir_runtime_func___kefir_bigint_right_shift_label15:
+    movq -64(%rbp), %rax
+    movq %rax, -24(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_label2
+.L__kefir_runtime_text_func___kefir_bigint_right_shift_end:
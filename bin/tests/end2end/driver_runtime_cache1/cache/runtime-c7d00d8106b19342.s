@@ -0,0 +1,96 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 1 1 0 0 0 0 0 0 1 x86_64-att -
+optimizer 5 10 20 0 0 inline-asm-untie inline-func phi-removal constant-fold mem2reg dead-alloc local-alloc-sink phi-removal constant-fold op-simplify memory-ssa sroa gvn licm gvn memory-ssa dead-code-elimination merge-blocks lowering dead-alloc phi-removal constant-fold op-simplify canonicalize gvn phi-removal loop-removal merge-blocks dead-code-elimination tail-calls
+entry function __kefir_bigint_cast_signed
+content 2995
+__kefir_bigint_cast_signed:
+.L__kefir_runtime_text_func___kefir_bigint_cast_signed_begin:
+    lea -1(%rdx), %rax
+    mov %rax, %r8
+    shr $3, %r8
+    mov %r8, %rcx
+    shl $3, %rcx
+    sub %rcx, %rax
+    cmp %rsi, %rdx
+    jbe .L__kefir_runtime_func___kefir_bigint_cast_signed_label22
+    cmp $0, %rsi
+    je .L__kefir_runtime_func___kefir_bigint_cast_signed_label4
+    sub $1, %rsi
+    mov %rsi, %rax
+    shr $3, %rax
+    movzxb (%rdi, %rax, 1), %rdx
+    mov %rax, %rcx
+    shl $3, %rcx
+    sub %rcx, %rsi
+    mov %rsi, %rcx
+    sar %cl, %edx
+    and $1, %edx
+    lea 1(%rsi), %rcx
+    cmp $8, %rcx
+    jb .L__kefir_runtime_func___kefir_bigint_cast_signed_label7
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label10:
+    add $1, %rax
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label11:
+    cmp %r8, %rax
+    jbe .L__kefir_runtime_func___kefir_bigint_cast_signed_label13
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label13:
+    test %edx, %edx
+    jnz .L__kefir_runtime_func___kefir_bigint_cast_signed_label16
+    movb $0, (%rdi, %rax, 1)
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label15:
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label11
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label16:
+    movb $-1, (%rdi, %rax, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label15
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label7:
+    mov $1, %r9d
+    mov %rsi, %rcx
+    shl %cl, %r9
+    sub $1, %r9b
+    test %edx, %edx
+    jnz .L__kefir_runtime_func___kefir_bigint_cast_signed_label9
+    andb %r9b, (%rdi, %rax, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label10
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label9:
+    movb (%rdi, %rax, 1), %cl
+    not %r9b
+    or %r9b, %cl
+    movb %cl, (%rdi, %rax, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label10
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label4:
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label18:
+    cmp %r8, %rax
+    jbe .L__kefir_runtime_func___kefir_bigint_cast_signed_label20
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label20:
+    movb $0, (%rdi, %rax, 1)
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label18
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label22:
+    movzxb (%rdi, %r8, 1), %rdx
+    mov $1, %esi
+    mov %rax, %rcx
+    shl %cl, %rsi
+    sub $1, %sil
+    mov %rax, %rcx
+    sar %cl, %edx
+    and $1, %edx
+    jnz .L__kefir_runtime_func___kefir_bigint_cast_signed_label25
+    andb %sil, (%rdi, %r8, 1)
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label24:
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label25:
+    movb (%rdi, %r8, 1), %al
+    not %sil
+    or %sil, %al
+    movb %al, (%rdi, %r8, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label24
+.L__kefir_runtime_text_func___kefir_bigint_cast_signed_end:
@@ -0,0 +1,318 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry function __kefir_bigint_signed_divide
+requires function __kefir_bigint_is_zero
+requires function __kefir_bigint_unsigned_divide
+requires function __kefir_bigint_get_sign
+requires function __kefir_bigint_util_add_digit_zero_extended
+content 8150
+__kefir_bigint_signed_divide:
+.L__kefir_runtime_text_func___kefir_bigint_signed_divide_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $96, %rsp
+    movq %r8, -88(%rbp)
+    movq %rcx, -72(%rbp)
+    movq %rdx, -56(%rbp)
+    movq %rsi, -64(%rbp)
+    movq %rdi, -80(%rbp)
+    movq -80(%rbp), %rdi
+    movq -72(%rbp), %rsi
+    call __kefir_bigint_get_sign
+    movl %eax, -96(%rbp)
+    movq -56(%rbp), %rdi
+    movq -88(%rbp), %rsi
+    call __kefir_bigint_get_sign
+    movl %eax, -92(%rbp)
+    movq -56(%rbp), %rdi
+    movq -88(%rbp), %rsi
+    call __kefir_bigint_is_zero
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label40
+    movl -96(%rbp), %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label4
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label9:
+    movl -92(%rbp), %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label11
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label16:
+    movq -80(%rbp), %rdi
+    movq -64(%rbp), %rsi
+    movq -56(%rbp), %rdx
+    movq -72(%rbp), %rcx
+    movq -88(%rbp), %r8
+    call __kefir_bigint_unsigned_divide
+    movl -96(%rbp), %eax
+    movl -92(%rbp), %ecx
+    xor %ecx, %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label27
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label17:
+    movl -96(%rbp), %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label19
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label26:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label19:
+    movq -64(%rbp), %rax
+    movq -72(%rbp), %rcx
+    movq %rcx, -48(%rbp)
+    movq %rax, -40(%rbp)
+    movq -40(%rbp), %rax
+    movq -48(%rbp), %rcx
+    movq %rcx, -24(%rbp)
+    movq %rax, -16(%rbp)
+    movq -24(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -32(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label22:
+    movq -8(%rbp), %rax
+    movq -32(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label24
+    movq -40(%rbp), %rdi
+    movq -48(%rbp), %rdx
+    mov $1, %esi
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label26
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label24:
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movzx %cl, %ecx
+    not %ecx
+    movb %cl, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label22
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label27:
+    movq -80(%rbp), %rax
+    movq -72(%rbp), %rcx
+    movq %rcx, -48(%rbp)
+    movq %rax, -40(%rbp)
+    movq -40(%rbp), %rax
+    movq -48(%rbp), %rcx
+    movq %rcx, -32(%rbp)
+    movq %rax, -16(%rbp)
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -24(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label30:
+    movq -8(%rbp), %rax
+    movq -24(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label32
+    movq -40(%rbp), %rdi
+    movq -48(%rbp), %rdx
+    mov $1, %esi
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label17
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label32:
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movzx %cl, %ecx
+    not %ecx
+    movb %cl, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label30
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label11:
+    movq -56(%rbp), %rax
+    movq -88(%rbp), %rcx
+    movq %rcx, -40(%rbp)
+    movq %rax, -48(%rbp)
+    movq -48(%rbp), %rax
+    movq -40(%rbp), %rcx
+    movq %rcx, -32(%rbp)
+    movq %rax, -16(%rbp)
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -24(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label14:
+    movq -8(%rbp), %rax
+    movq -24(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label35
+    movq -48(%rbp), %rdi
+    movq -40(%rbp), %rdx
+    mov $1, %esi
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label16
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label35:
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movzx %cl, %ecx
+    not %ecx
+    movb %cl, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label14
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label4:
+    movq -80(%rbp), %rax
+    movq -72(%rbp), %rcx
+    movq %rcx, -40(%rbp)
+    movq %rax, -48(%rbp)
+    movq -48(%rbp), %rax
+    movq -40(%rbp), %rcx
+    movq %rcx, -32(%rbp)
+    movq %rax, -24(%rbp)
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -16(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label7:
+    movq -8(%rbp), %rax
+    movq -16(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label36
+    movq -48(%rbp), %rdi
+    movq -40(%rbp), %rdx
+    mov $1, %esi
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label9
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label36:
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movzx %cl, %ecx
+    not %ecx
+    movb %cl, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label7
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label40:
+    mov $1, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_signed_divide_end:
@@ -0,0 +1,289 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 1 1 0 0 0 0 0 0 1 x86_64-att -
+optimizer 5 10 20 0 0 inline-asm-untie inline-func phi-removal constant-fold mem2reg dead-alloc local-alloc-sink phi-removal constant-fold op-simplify memory-ssa sroa gvn licm gvn memory-ssa dead-code-elimination merge-blocks lowering dead-alloc phi-removal constant-fold op-simplify canonicalize gvn phi-removal loop-removal merge-blocks dead-code-elimination tail-calls
+entry function __kefir_bigint_signed_divide
+requires function __kefir_bigint_is_zero
+requires function __kefir_bigint_left_shift
+requires function __kefir_bigint_get_sign
+requires function __kefir_bigint_util_add_digit_zero_extended
+content 8928
+__kefir_bigint_signed_divide:
+.L__kefir_runtime_text_func___kefir_bigint_signed_divide_begin:
+    push %rbp
+    mov %rsp, %rbp
+    push %rbx
+    push %r12
+    push %r13
+    push %r14
+    push %r15
+    sub $72, %rsp
+    mov %r8, %rbx
+    mov %rcx, %r12
+    mov %rdx, %r13
+    mov %rsi, %r14
+    mov %rdi, %r15
+    mov %r15, %rdi
+    mov %r12, %rsi
+    call __kefir_bigint_get_sign
+    mov %rax, -112(%rbp)
+    mov %r13, %rdi
+    mov %rbx, %rsi
+    call __kefir_bigint_get_sign
+    mov %rax, -104(%rbp)
+    mov %r13, %rdi
+    mov %rbx, %rsi
+    call __kefir_bigint_is_zero
+    test %eax, %eax
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label61
+    movl -112(%rbp), %eax
+    movl -112(%rbp), %ecx
+    test %ecx, %eax
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label4
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label7:
+    movl -104(%rbp), %eax
+    movl -104(%rbp), %ecx
+    test %ecx, %eax
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label9
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label14:
+    lea 7(%r12), %rax
+    mov %rax, -96(%rbp)
+    shrq $3, -96(%rbp)
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label15:
+    movq -96(%rbp), %rcx
+    cmp %rcx, %rax
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label17
+    cmp $0, %r12
+    je .L__kefir_runtime_func___kefir_bigint_signed_divide_label22
+    mov %r13, %rdi
+    mov %rbx, %rsi
+    call __kefir_bigint_is_zero
+    test %eax, %eax
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label22
+    lea -1(%r12), %rax
+    mov %rax, -80(%rbp)
+    shrq $3, -80(%rbp)
+    mov -80(%rbp), %rcx
+    shl $3, %rcx
+    mov %rax, -88(%rbp)
+    subq %rcx, -88(%rbp)
+    xor %eax, %eax
+    mov %rax, -72(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label21:
+    cmpq %r12, -72(%rbp)
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label37
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label22:
+    mov -112(%rbp), %rax
+    xorl -104(%rbp), %eax
+    test %eax, %eax
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label24
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label25:
+    movl -112(%rbp), %ecx
+    movl -112(%rbp), %edx
+    test %edx, %ecx
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label27
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label28:
+    xor %eax, %eax
+    lea -40(%rbp), %rsp
+    pop %r15
+    pop %r14
+    pop %r13
+    pop %r12
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label27:
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label29:
+    movq -96(%rbp), %rcx
+    cmp %rcx, %rax
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label31
+    mov %r14, %rdi
+    mov $1, %esi
+    mov %r12, %rdx
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label28
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label31:
+    notb (%r14, %rax, 1)
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label29
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label24:
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label33:
+    movq -96(%rbp), %rcx
+    cmp %rcx, %rax
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label35
+    mov %r15, %rdi
+    mov $1, %esi
+    mov %r12, %rdx
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label25
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label35:
+    notb (%r15, %rax, 1)
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label33
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label37:
+    movq -80(%rbp), %rcx
+    movzxb (%r15, %rcx, 1), %rdx
+    movq %rdx, -64(%rbp)
+    mov %r14, %rdi
+    mov $1, %esi
+    mov %r12, %rdx
+    call __kefir_bigint_left_shift
+    mov %r15, %rdi
+    mov $1, %esi
+    mov %r12, %rdx
+    call __kefir_bigint_left_shift
+    mov %rax, %rdx
+    movb (%r14), %dl
+    mov -88(%rbp), %rcx
+    mov -64(%rbp), %rax
+    sar %cl, %eax
+    and $1, %al
+    or %al, %dl
+    movb %dl, (%r14)
+    lea 7(%rbx), %rax
+    shr $3, %rax
+    xor %ecx, %ecx
+    xor %edx, %edx
+    mov %rdx, %rsi
+    mov %rcx, %rdx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label38:
+    lea -1(%rbx), %r8
+    movq -96(%rbp), %rcx
+    cmp %rcx, %rdx
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label40
+    movq -80(%rbp), %rcx
+    movzxb (%r14, %rcx, 1), %rdx
+    mov -88(%rbp), %rcx
+    sar %cl, %edx
+    and $1, %edx
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label49
+    orb $1, (%r15)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label51:
+    addq $1, -72(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label21
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label49:
+    andb $-2, (%r15)
+    xor %ecx, %ecx
+    xor %esi, %esi
+    mov %rcx, %rdx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label50:
+    movq -96(%rbp), %rcx
+    cmp %rcx, %rdx
+    jae .L__kefir_runtime_func___kefir_bigint_signed_divide_label51
+    movzxb (%r14, %rdx, 1), %rdi
+    lea 1(%rdx), %r9
+    cmp %rax, %r9
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label58
+    cmp %rax, %r9
+    je .L__kefir_runtime_func___kefir_bigint_signed_divide_label55
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label57:
+    add %edi, %esi
+    add %ecx, %esi
+    movb %sil, (%r14, %rdx, 1)
+    shr $8, %esi
+    mov %r9, %rdx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label50
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label55:
+    movzxb (%r13, %rdx, 1), %r10
+    mov %r8, %rcx
+    shr $3, %rcx
+    shl $3, %rcx
+    mov %rbx, %r11
+    sub %rcx, %r11
+    mov %r11, %rcx
+    mov $1, %r11d
+    shl %cl, %r11
+    sub $1, %r11d
+    mov %r10, %rcx
+    and %r11d, %ecx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label57
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label58:
+    movzxb (%r13, %rdx, 1), %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label57
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label40:
+    movzxb (%r14, %rdx, 1), %rdi
+    lea 1(%rdx), %r9
+    cmp %rax, %r9
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label46
+    cmp %rax, %r9
+    je .L__kefir_runtime_func___kefir_bigint_signed_divide_label43
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label45:
+    mov %rdi, %r10
+    sub %ecx, %r10d
+    mov %r10, %rcx
+    mov %ecx, %r10d
+    sub %esi, %r10d
+    mov %r10, %rsi
+    movb %sil, (%r14, %rdx, 1)
+    shr $8, %esi
+    and $1, %esi
+    mov %r9, %rdx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label38
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label43:
+    movzxb (%r13, %rdx, 1), %r10
+    shr $3, %r8
+    shl $3, %r8
+    mov %rbx, %rcx
+    sub %r8, %rcx
+    mov $1, %r8d
+    shl %cl, %r8
+    sub $1, %r8d
+    mov %r10, %rcx
+    and %r8d, %ecx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label45
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label46:
+    movzxb (%r13, %rdx, 1), %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label45
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label17:
+    movb $0, (%r14, %rax, 1)
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label15
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label9:
+    lea 7(%rbx), %rax
+    shr $3, %rax
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label10:
+    cmp %rax, %rcx
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label12
+    mov %r13, %rdi
+    mov $1, %esi
+    mov %rbx, %rdx
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label14
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label12:
+    notb (%r13, %rcx, 1)
+    add $1, %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label10
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label4:
+    lea 7(%r12), %rax
+    shr $3, %rax
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label5:
+    cmp %rax, %rcx
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label60
+    mov %r15, %rdi
+    mov $1, %esi
+    mov %r12, %rdx
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label7
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label60:
+    notb (%r15, %rcx, 1)
+    add $1, %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label5
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label61:
+    mov $1, %eax
+    lea -40(%rbp), %rsp
+    pop %r15
+    pop %r14
+    pop %r13
+    pop %r12
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_signed_divide_end:
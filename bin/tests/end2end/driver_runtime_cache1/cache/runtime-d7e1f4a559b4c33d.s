@@ -0,0 +1,156 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 0 1 0 0 0 0 0 0 0 x86_64-att -
+optimizer 5 10 0 0 0 inline-asm-untie inline-func local-alloc-sink dead-code-elimination dead-alloc lowering
+entry function __kefir_bigint_right_shift_whole_digits
+content 4285
+__kefir_bigint_right_shift_whole_digits:
+.L__kefir_runtime_text_func___kefir_bigint_right_shift_whole_digits_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $48, %rsp
+    movq %rcx, -40(%rbp)
+    movl %edx, -32(%rbp)
+    movq %rsi, -16(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -40(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -48(%rbp)
+    movl -32(%rbp), %eax
+    test %eax, %eax
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label22
+    xor %ecx, %ecx
+    movzx %cl, %ecx
+    not %ecx
+    lea -28(%rbp), %rax
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label5:
+    movb %cl, (%rax)
+    movq -16(%rbp), %rax
+    movq -48(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    xor %esi, %esi
+    cmp %rax, %rcx
+    sete %sil
+    or %rsi, %rdx
+    setne %dl
+    movzx %dl, %rax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label7
+    movl $0, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label13:
+    movl -8(%rbp), %eax
+    movq -48(%rbp), %rcx
+    movq -16(%rbp), %rdx
+    movabs $4294967295, %rsi
+    and %rsi, %rax
+    sub %rdx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label15
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label16:
+    movl -8(%rbp), %eax
+    movq -48(%rbp), %rcx
+    movabs $4294967295, %rdx
+    and %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label18
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label11:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label18:
+    movb -28(%rbp), %al
+    movq -24(%rbp), %rcx
+    movl -8(%rbp), %edx
+    movabs $4294967295, %rsi
+    and %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movl -8(%rbp), %eax
+    add $1, %eax
+    movl %eax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label16
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label15:
+    movq -24(%rbp), %rax
+    movl -8(%rbp), %ecx
+    movq -16(%rbp), %rdx
+    movabs $4294967295, %rsi
+    and %rsi, %rcx
+    add %rdx, %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -24(%rbp), %rax
+    movl -8(%rbp), %edx
+    movabs $4294967295, %rsi
+    and %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movb %cl, (%rax)
+    movl -8(%rbp), %eax
+    add $1, %eax
+    movl %eax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label13
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label7:
+    movl $0, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label8:
+    movl -8(%rbp), %eax
+    movq -48(%rbp), %rcx
+    movabs $4294967295, %rdx
+    and %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label10
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label11
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label10:
+    movb -28(%rbp), %al
+    movq -24(%rbp), %rcx
+    movl -8(%rbp), %edx
+    movabs $4294967295, %rsi
+    and %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movl -8(%rbp), %eax
+    add $1, %eax
+    movl %eax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label8
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label22:
+    xor %ecx, %ecx
+    movzx %cl, %ecx
+    lea -28(%rbp), %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label5
+.L__kefir_runtime_text_func___kefir_bigint_right_shift_whole_digits_end:
@@ -0,0 +1,50 @@
+kefir 0.5.1
+runtime bfb754cd67a32c98
+data-model 3 1
+codegen 0 1 1 1 0 0 0 0 0 0 1 x86_64-att -
+optimizer 5 10 20 0 0 inline-asm-untie inline-func phi-removal constant-fold mem2reg dead-alloc local-alloc-sink phi-removal constant-fold op-simplify memory-ssa sroa gvn licm gvn memory-ssa dead-code-elimination merge-blocks lowering dead-alloc phi-removal constant-fold op-simplify canonicalize gvn phi-removal loop-removal merge-blocks dead-code-elimination tail-calls
+entry function __kefir_bigint_is_zero
+content 1327
+__kefir_bigint_is_zero:
+.L__kefir_runtime_text_func___kefir_bigint_is_zero_begin:
+    cmp $0, %rsi
+    je .L__kefir_runtime_func___kefir_bigint_is_zero_label12
+    lea 7(%rsi), %rax
+    shr $3, %rax
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_is_zero_label3:
+    cmp %rax, %rcx
+    jb .L__kefir_runtime_func___kefir_bigint_is_zero_label5
+    mov $1, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_is_zero_label5:
+    mov %rdx, %r8
+    movb (%rdi, %rcx, 1), %r8b
+    lea 1(%rcx), %rdx
+    cmp %rax, %rdx
+    je .L__kefir_runtime_func___kefir_bigint_is_zero_label7
+.L__kefir_runtime_func___kefir_bigint_is_zero_label8:
+    test %r8b, %r8b
+    jnz .L__kefir_runtime_func___kefir_bigint_is_zero_label10
+    mov %rdx, %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_is_zero_label3
+.L__kefir_runtime_func___kefir_bigint_is_zero_label10:
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_is_zero_label7:
+    movzx %r8b, %r8
+    lea -1(%rsi), %rcx
+    mov %rcx, %r9
+    shr $3, %r9
+    shl $3, %r9
+    sub %r9, %rcx
+    add $1, %rcx
+    mov $1, %r9d
+    shl %cl, %r9
+    sub $1, %r9d
+    and %r9d, %r8d
+    jmp .L__kefir_runtime_func___kefir_bigint_is_zero_label8
+.L__kefir_runtime_func___kefir_bigint_is_zero_label12:
+    mov $1, %eax
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_is_zero_end:
@@ -0,0 +1,3116 @@
+.att_syntax
+.section .note.GNU-stack,"",%progbits
+
+.global unit1_muldiv
+.type unit1_muldiv, @function
+
+.section .text
+.L__kefir_text_section_begin:
+unit1_muldiv:
+.L__kefir_text_func_unit1_muldiv_begin:
+    push %rbp
+    mov %rsp, %rbp
+    push %rbx
+    sub $248, %rsp
+    movq %rdx, -56(%rbp)
+    movq %rsi, -64(%rbp)
+    movq %rdi, -16(%rbp)
+    movq -16(%rbp), %rdx
+    movq -64(%rbp), %rbx
+    lea -256(%rbp), %rdi
+    mov $200, %esi
+    call __kefir_bigint_set_signed_integer
+    movdqu -256(%rbp), %xmm0
+    movdqu %xmm0, -224(%rbp)
+    movdqu -240(%rbp), %xmm0
+    movdqu %xmm0, -208(%rbp)
+    lea -256(%rbp), %rdi
+    mov $200, %esi
+    mov %rbx, %rdx
+    call __kefir_bigint_set_signed_integer
+    lea -192(%rbp), %rdi
+    lea -160(%rbp), %rsi
+    lea -224(%rbp), %rdx
+    lea -256(%rbp), %rcx
+    mov $200, %r8d
+    mov $200, %r9d
+    call __kefir_bigint_signed_multiply
+    movdqu -192(%rbp), %xmm0
+    movdqu %xmm0, -48(%rbp)
+    movdqu -176(%rbp), %xmm0
+    movdqu %xmm0, -32(%rbp)
+    movdqu -48(%rbp), %xmm0
+    movdqu %xmm0, -256(%rbp)
+    movdqu -32(%rbp), %xmm0
+    movdqu %xmm0, -240(%rbp)
+    movq -56(%rbp), %rbx
+    movdqu -256(%rbp), %xmm0
+    movdqu %xmm0, -224(%rbp)
+    movdqu -240(%rbp), %xmm0
+    movdqu %xmm0, -208(%rbp)
+    lea -224(%rbp), %rdi
+    mov $200, %esi
+    mov $400, %edx
+    call __kefir_bigint_cast_signed
+    lea -256(%rbp), %rdi
+    mov $200, %esi
+    mov %rbx, %rdx
+    call __kefir_bigint_set_signed_integer
+    movdqu -256(%rbp), %xmm0
+    movdqu %xmm0, -168(%rbp)
+    movdqu -240(%rbp), %xmm0
+    movdqu %xmm0, -152(%rbp)
+    lea -224(%rbp), %rdi
+    lea -128(%rbp), %rsi
+    lea -168(%rbp), %rdx
+    mov $400, %ecx
+    mov $200, %r8d
+    call __kefir_bigint_signed_divide
+    movq -224(%rbp), %rax
+    lea -8(%rbp), %rsp
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_text_func_unit1_muldiv_end:
+
+.L__kefir_text_section_end:
+
+.att_syntax
+.section .note.GNU-stack,"",%progbits
+
+
+.section .text
+__kefir_bigint_is_zero:
+.L__kefir_runtime_text_func___kefir_bigint_is_zero_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $64, %rsp
+    movq %rsi, -48(%rbp)
+    movq %rdi, -56(%rbp)
+    movq -48(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_is_zero_label15
+    movq -48(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -40(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_is_zero_label3:
+    movq -8(%rbp), %rax
+    movq -40(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_is_zero_label5
+    mov $1, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_is_zero_label5:
+    movq -56(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movb %cl, -32(%rbp)
+    movq -8(%rbp), %rax
+    movq -40(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    add %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_is_zero_label7
+.L__kefir_runtime_func___kefir_bigint_is_zero_label8:
+    movb -32(%rbp), %al
+    test %al, %al
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_is_zero_label10
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_is_zero_label3
+.L__kefir_runtime_func___kefir_bigint_is_zero_label10:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_is_zero_label7:
+    movq -48(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -24(%rbp)
+    movq -48(%rbp), %rax
+    movq -24(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -16(%rbp)
+    movq -16(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    add %rcx, %rax
+    mov $1, %edx
+    mov %rax, %rcx
+    shl %cl, %rdx
+    mov $1, %ecx
+    movsx %ecx, %rax
+    sub %rax, %rdx
+    movl %edx, -28(%rbp)
+    movl -28(%rbp), %eax
+    movb -32(%rbp), %cl
+    movzx %cl, %ecx
+    and %eax, %ecx
+    movb %cl, -32(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_is_zero_label8
+.L__kefir_runtime_func___kefir_bigint_is_zero_label15:
+    mov $1, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_is_zero_end:
+
+__kefir_bigint_right_shift_whole_digits:
+.L__kefir_runtime_text_func___kefir_bigint_right_shift_whole_digits_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $48, %rsp
+    movq %rcx, -40(%rbp)
+    movl %edx, -32(%rbp)
+    movq %rsi, -16(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -40(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -48(%rbp)
+    movl -32(%rbp), %eax
+    test %eax, %eax
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label22
+    xor %ecx, %ecx
+    movzx %cl, %ecx
+    not %ecx
+    lea -28(%rbp), %rax
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label5:
+    movb %cl, (%rax)
+    movq -16(%rbp), %rax
+    movq -48(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    xor %esi, %esi
+    cmp %rax, %rcx
+    sete %sil
+    or %rsi, %rdx
+    setne %dl
+    movzx %dl, %rax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label7
+    movl $0, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label13:
+    movl -8(%rbp), %eax
+    movq -48(%rbp), %rcx
+    movq -16(%rbp), %rdx
+    movabs $4294967295, %rsi
+    and %rsi, %rax
+    sub %rdx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label15
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label16:
+    movl -8(%rbp), %eax
+    movq -48(%rbp), %rcx
+    movabs $4294967295, %rdx
+    and %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label18
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label11:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label18:
+    movb -28(%rbp), %al
+    movq -24(%rbp), %rcx
+    movl -8(%rbp), %edx
+    movabs $4294967295, %rsi
+    and %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movl -8(%rbp), %eax
+    add $1, %eax
+    movl %eax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label16
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label15:
+    movq -24(%rbp), %rax
+    movl -8(%rbp), %ecx
+    movq -16(%rbp), %rdx
+    movabs $4294967295, %rsi
+    and %rsi, %rcx
+    add %rdx, %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -24(%rbp), %rax
+    movl -8(%rbp), %edx
+    movabs $4294967295, %rsi
+    and %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movb %cl, (%rax)
+    movl -8(%rbp), %eax
+    add $1, %eax
+    movl %eax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label13
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label7:
+    movl $0, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label8:
+    movl -8(%rbp), %eax
+    movq -48(%rbp), %rcx
+    movabs $4294967295, %rdx
+    and %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label10
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label11
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label10:
+    movb -28(%rbp), %al
+    movq -24(%rbp), %rcx
+    movl -8(%rbp), %edx
+    movabs $4294967295, %rsi
+    and %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movl -8(%rbp), %eax
+    add $1, %eax
+    movl %eax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label8
+.L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label22:
+    xor %ecx, %ecx
+    movzx %cl, %ecx
+    lea -28(%rbp), %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_whole_digits_label5
+.L__kefir_runtime_text_func___kefir_bigint_right_shift_whole_digits_end:
+
+__kefir_bigint_unsigned_divide:
+.L__kefir_runtime_text_func___kefir_bigint_unsigned_divide_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $96, %rsp
+    movq %r8, -80(%rbp)
+    movq %rcx, -56(%rbp)
+    movq %rdx, -40(%rbp)
+    movq %rsi, -48(%rbp)
+    movq %rdi, -64(%rbp)
+    movq -48(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $0, %edx
+    movsx %edx, %rsi
+    movq %rcx, -24(%rbp)
+    movq %rax, -32(%rbp)
+    movq -24(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -16(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label3:
+    movq -8(%rbp), %rax
+    movq -16(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label17
+    movq -56(%rbp), %rax
+    xor %ecx, %ecx
+    cmp %rsi, %rax
+    sete %cl
+    test %ecx, %ecx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label16
+    movq -40(%rbp), %rdi
+    movq -80(%rbp), %rsi
+    call __kefir_bigint_is_zero
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label7
+    movq -56(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -72(%rbp)
+    movq -56(%rbp), %rax
+    movq -72(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -88(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -24(%rbp)
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label9:
+    movq -24(%rbp), %rax
+    movq -56(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label11
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label11:
+    movq -64(%rbp), %rax
+    movq -72(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -88(%rbp), %rdx
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    and $1, %eax
+    movl %eax, -32(%rbp)
+    movq -48(%rbp), %rdi
+    movq -56(%rbp), %rdx
+    mov $1, %eax
+    movsx %eax, %rsi
+    call __kefir_bigint_left_shift
+    movq -64(%rbp), %rdi
+    movq -56(%rbp), %rdx
+    mov $1, %eax
+    movsx %eax, %rsi
+    call __kefir_bigint_left_shift
+    movl -32(%rbp), %eax
+    movq -48(%rbp), %rcx
+    mov $0, %esi
+    movsx %esi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    or %eax, %edx
+    movb %dl, (%rcx)
+    movq -48(%rbp), %rdi
+    movq -40(%rbp), %rsi
+    movq -56(%rbp), %rdx
+    movq -80(%rbp), %rcx
+    call __kefir_bigint_subtract_zero_extend
+    movq -48(%rbp), %rax
+    movq -72(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -88(%rbp), %rdx
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    and $1, %eax
+    movl %eax, -28(%rbp)
+    movl -28(%rbp), %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label13
+    movq -64(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    or $1, %ecx
+    movb %cl, (%rax)
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label14:
+    movq -24(%rbp), %rax
+    add $1, %rax
+    movq %rax, -24(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label9
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label13:
+    movq -64(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    mov $1, %edx
+    movzx %dl, %edx
+    not %edx
+    and %edx, %ecx
+    movb %cl, (%rax)
+    movq -48(%rbp), %rdi
+    movq -40(%rbp), %rsi
+    movq -56(%rbp), %rdx
+    movq -80(%rbp), %rcx
+    call __kefir_bigint_add_zero_extend
+    jmp .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label14
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label7:
+    mov $1, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label16:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_unsigned_divide_label17:
+    movq -32(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb $0, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_unsigned_divide_label3
+.L__kefir_runtime_text_func___kefir_bigint_unsigned_divide_end:
+
+__kefir_bigint_cast_signed:
+.L__kefir_runtime_text_func___kefir_bigint_cast_signed_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $96, %rsp
+    movq %rdx, -80(%rbp)
+    movq %rsi, -64(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -80(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movq %rax, -32(%rbp)
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -88(%rbp)
+    movq -32(%rbp), %rax
+    movq -88(%rbp), %rcx
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -40(%rbp)
+    movq -80(%rbp), %rax
+    movq -64(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    xor %esi, %esi
+    cmp %rax, %rcx
+    sete %sil
+    or %rsi, %rdx
+    setne %dl
+    movzx %dl, %rax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_cast_signed_label28
+    movq -64(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_cast_signed_label16
+    movq -64(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movq %rax, -72(%rbp)
+    movq -72(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -16(%rbp)
+    movq -72(%rbp), %rax
+    movq -16(%rbp), %rcx
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -48(%rbp)
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -48(%rbp), %rdx
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    and $1, %eax
+    movl %eax, -56(%rbp)
+    movq -48(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    add %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    xor %ecx, %ecx
+    cmp %rdx, %rax
+    setb %cl
+    test %ecx, %ecx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_cast_signed_label5
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label8:
+    movq -16(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    add %rcx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label9:
+    movq -8(%rbp), %rax
+    movq -88(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    xor %esi, %esi
+    cmp %rax, %rcx
+    sete %sil
+    or %rsi, %rdx
+    setne %dl
+    movzx %dl, %rax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_cast_signed_label11
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label11:
+    movl -56(%rbp), %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_cast_signed_label14
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb $0, (%rax)
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label13:
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label9
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label14:
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    xor %ecx, %ecx
+    movzx %cl, %ecx
+    not %ecx
+    movb %cl, (%rax)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label13
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label5:
+    movl -56(%rbp), %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_cast_signed_label7
+    movq -48(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movl %eax, -52(%rbp)
+    movl -52(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -16(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    and %eax, %edx
+    movb %dl, (%rcx)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label8
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label7:
+    movq -48(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    not %rax
+    movl %eax, -52(%rbp)
+    movl -52(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -16(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    or %eax, %edx
+    movb %dl, (%rcx)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label8
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label16:
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label17:
+    movq -8(%rbp), %rax
+    movq -88(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    xor %esi, %esi
+    cmp %rax, %rcx
+    sete %sil
+    or %rsi, %rdx
+    setne %dl
+    movzx %dl, %rax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_cast_signed_label19
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label19:
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb $0, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label17
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label28:
+    movq -24(%rbp), %rax
+    movq -88(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -40(%rbp), %rdx
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    and $1, %eax
+    movl %eax, -52(%rbp)
+    movl -52(%rbp), %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_cast_signed_label24
+    movq -40(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movl %eax, -8(%rbp)
+    movl -8(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -88(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    and %eax, %edx
+    movb %dl, (%rcx)
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label23:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label24:
+    movq -40(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    not %rax
+    movl %eax, -8(%rbp)
+    movl -8(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -88(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    or %eax, %edx
+    movb %dl, (%rcx)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label23
+.L__kefir_runtime_text_func___kefir_bigint_cast_signed_end:
+
+__kefir_bigint_subtract_zero_extend:
+.L__kefir_runtime_text_func___kefir_bigint_subtract_zero_extend_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $96, %rsp
+    movq %rcx, -88(%rbp)
+    movq %rdx, -64(%rbp)
+    movq %rsi, -40(%rbp)
+    movq %rdi, -48(%rbp)
+    movq -64(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -72(%rbp)
+    movq -88(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -56(%rbp)
+    movl $0, -80(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -32(%rbp)
+.L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label2:
+    movq -32(%rbp), %rax
+    movq -72(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label4
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label4:
+    movq -48(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -8(%rbp)
+    movl $0, -12(%rbp)
+    movq -32(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    add %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label10
+    movq -32(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    add %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label7
+    movl $0, -12(%rbp)
+.L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label8:
+    movl -8(%rbp), %eax
+    movl -12(%rbp), %ecx
+    movl -80(%rbp), %edx
+    sub %ecx, %eax
+    sub %edx, %eax
+    movl %eax, -16(%rbp)
+    movl -16(%rbp), %eax
+    movq -48(%rbp), %rcx
+    movq -32(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movl -16(%rbp), %eax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    shr %cl, %eax
+    and $1, %eax
+    movl %eax, -80(%rbp)
+    movq -32(%rbp), %rax
+    add $1, %rax
+    movq %rax, -32(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label2
+.L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label7:
+    movq -40(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -12(%rbp)
+    movq -88(%rbp), %rcx
+    movq -88(%rbp), %rax
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    xor %edx, %edx
+    div %rsi
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rax
+    sub %rax, %rcx
+    movq %rcx, -24(%rbp)
+    movq -24(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movl %eax, -76(%rbp)
+    movl -76(%rbp), %eax
+    movl -12(%rbp), %ecx
+    and %eax, %ecx
+    movl %ecx, -12(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label8
+.L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label10:
+    movq -40(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -12(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_subtract_zero_extend_label8
+.L__kefir_runtime_text_func___kefir_bigint_subtract_zero_extend_end:
+
+__kefir_bigint_right_shift:
+.L__kefir_runtime_text_func___kefir_bigint_right_shift_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $64, %rsp
+    movq %rdx, -64(%rbp)
+    movq %rsi, -24(%rbp)
+    movq %rdi, -16(%rbp)
+    movq -24(%rbp), %rax
+    movq -64(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_label15
+.L__kefir_runtime_func___kefir_bigint_right_shift_label2:
+    movq -64(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -56(%rbp)
+    movq -24(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -32(%rbp)
+    movq -64(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rcx
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -48(%rbp)
+    movq -48(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movl %eax, -40(%rbp)
+    movl -40(%rbp), %eax
+    movq -16(%rbp), %rcx
+    movq -56(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    and %eax, %edx
+    movb %dl, (%rcx)
+    movq -32(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_label9
+.L__kefir_runtime_func___kefir_bigint_right_shift_label3:
+    movq -24(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_label5
+.L__kefir_runtime_func___kefir_bigint_right_shift_label4:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_right_shift_label5:
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_right_shift_label6:
+    movq -8(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_right_shift_label8
+    movl -40(%rbp), %eax
+    movq -16(%rbp), %rcx
+    movq -56(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    and %eax, %edx
+    movb %dl, (%rcx)
+    movq -24(%rbp), %rcx
+    movq -16(%rbp), %rax
+    movq -56(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movb (%rax), %dl
+    shr %cl, %dl
+    movb %dl, (%rax)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_label4
+.L__kefir_runtime_func___kefir_bigint_right_shift_label8:
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -24(%rbp), %rdx
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rsi
+    mov $1, %r8d
+    movsx %r8d, %rdi
+    add %rdi, %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rax
+    movb (%rax), %sil
+    movq -24(%rbp), %rdi
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %r8
+    imul $1, %r8, %r8
+    add %rax, %r8
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    movzx %sil, %esi
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    mov %rdx, %rcx
+    sub %rdi, %rcx
+    shl %cl, %esi
+    or %esi, %eax
+    movb %al, (%r8)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_label6
+.L__kefir_runtime_func___kefir_bigint_right_shift_label9:
+    movq -16(%rbp), %rdi
+    movq -32(%rbp), %rsi
+    movq -64(%rbp), %rcx
+    xor %edx, %edx
+    call __kefir_bigint_right_shift_whole_digits
+    movq -32(%rbp), %rax
+    movq -24(%rbp), %rcx
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rax
+    sub %rax, %rcx
+    movq %rcx, -24(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_label3
+.L__kefir_runtime_func___kefir_bigint_right_shift_label15:
+    movq -64(%rbp), %rax
+    movq %rax, -24(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_right_shift_label2
+.L__kefir_runtime_text_func___kefir_bigint_right_shift_end:
+
+__kefir_bigint_signed_divide:
+.L__kefir_runtime_text_func___kefir_bigint_signed_divide_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $96, %rsp
+    movq %r8, -88(%rbp)
+    movq %rcx, -72(%rbp)
+    movq %rdx, -56(%rbp)
+    movq %rsi, -64(%rbp)
+    movq %rdi, -80(%rbp)
+    movq -80(%rbp), %rdi
+    movq -72(%rbp), %rsi
+    call __kefir_bigint_get_sign
+    movl %eax, -96(%rbp)
+    movq -56(%rbp), %rdi
+    movq -88(%rbp), %rsi
+    call __kefir_bigint_get_sign
+    movl %eax, -92(%rbp)
+    movq -56(%rbp), %rdi
+    movq -88(%rbp), %rsi
+    call __kefir_bigint_is_zero
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label40
+    movl -96(%rbp), %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label4
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label9:
+    movl -92(%rbp), %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label11
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label16:
+    movq -80(%rbp), %rdi
+    movq -64(%rbp), %rsi
+    movq -56(%rbp), %rdx
+    movq -72(%rbp), %rcx
+    movq -88(%rbp), %r8
+    call __kefir_bigint_unsigned_divide
+    movl -96(%rbp), %eax
+    movl -92(%rbp), %ecx
+    xor %ecx, %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label27
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label17:
+    movl -96(%rbp), %eax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label19
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label26:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label19:
+    movq -64(%rbp), %rax
+    movq -72(%rbp), %rcx
+    movq %rcx, -48(%rbp)
+    movq %rax, -40(%rbp)
+    movq -40(%rbp), %rax
+    movq -48(%rbp), %rcx
+    movq %rcx, -24(%rbp)
+    movq %rax, -16(%rbp)
+    movq -24(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -32(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label22:
+    movq -8(%rbp), %rax
+    movq -32(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label24
+    movq -40(%rbp), %rdi
+    movq -48(%rbp), %rdx
+    mov $1, %esi
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label26
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label24:
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movzx %cl, %ecx
+    not %ecx
+    movb %cl, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label22
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label27:
+    movq -80(%rbp), %rax
+    movq -72(%rbp), %rcx
+    movq %rcx, -48(%rbp)
+    movq %rax, -40(%rbp)
+    movq -40(%rbp), %rax
+    movq -48(%rbp), %rcx
+    movq %rcx, -32(%rbp)
+    movq %rax, -16(%rbp)
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -24(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label30:
+    movq -8(%rbp), %rax
+    movq -24(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label32
+    movq -40(%rbp), %rdi
+    movq -48(%rbp), %rdx
+    mov $1, %esi
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label17
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label32:
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movzx %cl, %ecx
+    not %ecx
+    movb %cl, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label30
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label11:
+    movq -56(%rbp), %rax
+    movq -88(%rbp), %rcx
+    movq %rcx, -40(%rbp)
+    movq %rax, -48(%rbp)
+    movq -48(%rbp), %rax
+    movq -40(%rbp), %rcx
+    movq %rcx, -32(%rbp)
+    movq %rax, -16(%rbp)
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -24(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label14:
+    movq -8(%rbp), %rax
+    movq -24(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label35
+    movq -48(%rbp), %rdi
+    movq -40(%rbp), %rdx
+    mov $1, %esi
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label16
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label35:
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -16(%rbp), %rax
+    movq -8(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movzx %cl, %ecx
+    not %ecx
+    movb %cl, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label14
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label4:
+    movq -80(%rbp), %rax
+    movq -72(%rbp), %rcx
+    movq %rcx, -40(%rbp)
+    movq %rax, -48(%rbp)
+    movq -48(%rbp), %rax
+    movq -40(%rbp), %rcx
+    movq %rcx, -32(%rbp)
+    movq %rax, -24(%rbp)
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -16(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label7:
+    movq -8(%rbp), %rax
+    movq -16(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_divide_label36
+    movq -48(%rbp), %rdi
+    movq -40(%rbp), %rdx
+    mov $1, %esi
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label9
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label36:
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movzx %cl, %ecx
+    not %ecx
+    movb %cl, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label7
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label40:
+    mov $1, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_signed_divide_end:
+
+__kefir_bigint_arithmetic_right_shift:
+.L__kefir_runtime_text_func___kefir_bigint_arithmetic_right_shift_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $80, %rsp
+    movq %rdx, -80(%rbp)
+    movq %rsi, -56(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -80(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label35
+    movq -56(%rbp), %rax
+    movq -80(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label4
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label5:
+    movq -80(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -40(%rbp)
+    movq -80(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -48(%rbp)
+    movq -80(%rbp), %rax
+    movq -48(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -64(%rbp)
+    movq -24(%rbp), %rax
+    movq -48(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -64(%rbp), %rdx
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    and $1, %eax
+    movsx %eax, %rax
+    movq %rax, -32(%rbp)
+    movq -32(%rbp), %rax
+    test %rax, %rax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label7
+    movq -64(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movl %eax, -16(%rbp)
+    movl -16(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -40(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    and %eax, %edx
+    movb %dl, (%rcx)
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label8:
+    movq -56(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -72(%rbp)
+    movq -72(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label10
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label11:
+    movq -56(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label13
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label24:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label13:
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -16(%rbp)
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label14:
+    movq -16(%rbp), %rax
+    movq -40(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label16
+    movq -56(%rbp), %rcx
+    movq -24(%rbp), %rax
+    movq -40(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movb (%rax), %dl
+    shr %cl, %dl
+    movb %dl, (%rax)
+    movq -64(%rbp), %rax
+    movq -56(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    xor %esi, %esi
+    cmp %rax, %rcx
+    sete %sil
+    or %rsi, %rdx
+    setne %dl
+    movzx %dl, %rax
+    test %eax, %eax
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label30
+    movq -64(%rbp), %rcx
+    movq -56(%rbp), %rax
+    sub %rax, %rcx
+    mov $1, %edx
+    movsx %edx, %rax
+    add %rax, %rcx
+    lea -8(%rbp), %rax
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label21:
+    movq %rcx, (%rax)
+    movq -32(%rbp), %rax
+    test %rax, %rax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label23
+    movq -8(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movl %eax, -16(%rbp)
+    movl -16(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -40(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    and %eax, %edx
+    movb %dl, (%rcx)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label24
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label23:
+    movq -8(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    not %rax
+    movl %eax, -16(%rbp)
+    movl -16(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -40(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    or %eax, %edx
+    movb %dl, (%rcx)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label24
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label30:
+    mov $0, %eax
+    movsx %eax, %rcx
+    lea -8(%rbp), %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label21
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label16:
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -56(%rbp), %rdx
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %rsi
+    mov $1, %r8d
+    movsx %r8d, %rdi
+    add %rdi, %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rax
+    movb (%rax), %sil
+    movq -56(%rbp), %rdi
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %r8
+    imul $1, %r8, %r8
+    add %rax, %r8
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    movzx %sil, %esi
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    mov %rdx, %rcx
+    sub %rdi, %rcx
+    shl %cl, %esi
+    or %esi, %eax
+    movb %al, (%r8)
+    movq -16(%rbp), %rax
+    add $1, %rax
+    movq %rax, -16(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label14
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label10:
+    movq -24(%rbp), %rdi
+    movq -72(%rbp), %rsi
+    movq -32(%rbp), %rdx
+    movq -80(%rbp), %rcx
+    call __kefir_bigint_right_shift_whole_digits
+    movq -72(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rax
+    sub %rax, %rcx
+    movq %rcx, -56(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label11
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label7:
+    movq -64(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    not %rax
+    movl %eax, -16(%rbp)
+    movl -16(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -40(%rbp), %rdx
+    mov $1, %edi
+    movsx %edi, %rsi
+    sub %rsi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb (%rcx), %dl
+    movzx %dl, %edx
+    or %eax, %edx
+    movb %dl, (%rcx)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label8
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label4:
+    movq -80(%rbp), %rax
+    movq %rax, -56(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label5
+.L__kefir_runtime_func___kefir_bigint_arithmetic_right_shift_label35:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_arithmetic_right_shift_end:
+
+__kefir_bigint_left_shift:
+.L__kefir_runtime_text_func___kefir_bigint_left_shift_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $48, %rsp
+    movq %rdx, -32(%rbp)
+    movq %rsi, -48(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -48(%rbp), %rax
+    movq -32(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_left_shift_label15
+.L__kefir_runtime_func___kefir_bigint_left_shift_label2:
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -40(%rbp)
+    movq -48(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -16(%rbp)
+    movq -16(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_left_shift_label9
+.L__kefir_runtime_func___kefir_bigint_left_shift_label3:
+    movq -48(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_left_shift_label5
+.L__kefir_runtime_func___kefir_bigint_left_shift_label4:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_left_shift_label5:
+    movq -40(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_left_shift_label6:
+    movq -8(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_left_shift_label8
+    movq -48(%rbp), %rcx
+    movq -24(%rbp), %rax
+    mov $0, %esi
+    movsx %esi, %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movb (%rax), %dl
+    shl %cl, %dl
+    movb %dl, (%rax)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label4
+.L__kefir_runtime_func___kefir_bigint_left_shift_label8:
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -48(%rbp), %rdx
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rsi
+    mov $1, %r8d
+    movsx %r8d, %rdi
+    sub %rdi, %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rax
+    movb (%rax), %sil
+    movq -48(%rbp), %rdi
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %r8
+    imul $1, %r8, %r8
+    add %rax, %r8
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    shl %cl, %eax
+    movzx %sil, %esi
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    mov %rdx, %rcx
+    sub %rdi, %rcx
+    sar %cl, %esi
+    or %esi, %eax
+    movb %al, (%r8)
+    movq -8(%rbp), %rax
+    add $-1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label6
+.L__kefir_runtime_func___kefir_bigint_left_shift_label9:
+    movq -24(%rbp), %rdi
+    movq -16(%rbp), %rsi
+    movq -32(%rbp), %rdx
+    call __kefir_bigint_left_shift_whole_digits
+    movq -16(%rbp), %rax
+    movq -48(%rbp), %rcx
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rax
+    sub %rax, %rcx
+    movq %rcx, -48(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label3
+.L__kefir_runtime_func___kefir_bigint_left_shift_label15:
+    movq -32(%rbp), %rax
+    movq %rax, -48(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label2
+.L__kefir_runtime_text_func___kefir_bigint_left_shift_end:
+
+__kefir_bigint_add:
+.L__kefir_runtime_text_func___kefir_bigint_add_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $64, %rsp
+    movq %rdx, -40(%rbp)
+    movq %rsi, -56(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -40(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -32(%rbp)
+    movl $0, -48(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -16(%rbp)
+.L__kefir_runtime_func___kefir_bigint_add_label2:
+    movq -16(%rbp), %rax
+    movq -32(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_add_label4
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_add_label4:
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -8(%rbp)
+    movq -56(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -4(%rbp)
+    movl -48(%rbp), %eax
+    movl -8(%rbp), %ecx
+    movl -4(%rbp), %edx
+    add %ecx, %eax
+    add %edx, %eax
+    movl %eax, -44(%rbp)
+    movl -44(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -16(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movl -44(%rbp), %eax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    shr %cl, %eax
+    movl %eax, -48(%rbp)
+    movq -16(%rbp), %rax
+    add $1, %rax
+    movq %rax, -16(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_add_label2
+.L__kefir_runtime_text_func___kefir_bigint_add_end:
+
+__kefir_bigint_get_sign:
+.L__kefir_runtime_text_func___kefir_bigint_get_sign_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $32, %rsp
+    movq %rsi, -8(%rbp)
+    movq %rdi, -32(%rbp)
+    movq -8(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_get_sign_label5
+    movq -8(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -16(%rbp)
+    movq -8(%rbp), %rax
+    movq -16(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -24(%rbp)
+    movq -32(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -24(%rbp), %rdx
+    mov %rcx, %rax
+    and $255, %rax
+    mov %rdx, %rcx
+    sar %cl, %eax
+    and $1, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_get_sign_label5:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_get_sign_end:
+
+__kefir_bigint_subtract:
+.L__kefir_runtime_text_func___kefir_bigint_subtract_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $64, %rsp
+    movq %rdx, -40(%rbp)
+    movq %rsi, -56(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -40(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -32(%rbp)
+    movl $0, -48(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -16(%rbp)
+.L__kefir_runtime_func___kefir_bigint_subtract_label2:
+    movq -16(%rbp), %rax
+    movq -32(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_subtract_label4
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_subtract_label4:
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -44(%rbp)
+    movq -56(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -4(%rbp)
+    movl -44(%rbp), %eax
+    movl -4(%rbp), %ecx
+    movl -48(%rbp), %edx
+    sub %ecx, %eax
+    sub %edx, %eax
+    movl %eax, -8(%rbp)
+    movl -8(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -16(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movl -8(%rbp), %eax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    shr %cl, %eax
+    and $1, %eax
+    movl %eax, -48(%rbp)
+    movq -16(%rbp), %rax
+    add $1, %rax
+    movq %rax, -16(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_subtract_label2
+.L__kefir_runtime_text_func___kefir_bigint_subtract_end:
+
+__kefir_bigint_add_zero_extend:
+.L__kefir_runtime_text_func___kefir_bigint_add_zero_extend_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $96, %rsp
+    movq %rcx, -88(%rbp)
+    movq %rdx, -64(%rbp)
+    movq %rsi, -40(%rbp)
+    movq %rdi, -48(%rbp)
+    movq -64(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -72(%rbp)
+    movq -88(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -56(%rbp)
+    movl $0, -80(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -32(%rbp)
+.L__kefir_runtime_func___kefir_bigint_add_zero_extend_label2:
+    movq -32(%rbp), %rax
+    movq -72(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_add_zero_extend_label4
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_add_zero_extend_label4:
+    movq -48(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -12(%rbp)
+    movl $0, -16(%rbp)
+    movq -32(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    add %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_add_zero_extend_label10
+    movq -32(%rbp), %rax
+    movq -56(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    add %rdx, %rax
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_add_zero_extend_label7
+    movl $0, -16(%rbp)
+.L__kefir_runtime_func___kefir_bigint_add_zero_extend_label8:
+    movl -80(%rbp), %eax
+    movl -12(%rbp), %ecx
+    movl -16(%rbp), %edx
+    add %ecx, %eax
+    add %edx, %eax
+    movl %eax, -8(%rbp)
+    movl -8(%rbp), %eax
+    movq -48(%rbp), %rcx
+    movq -32(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movl -8(%rbp), %eax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    shr %cl, %eax
+    movl %eax, -80(%rbp)
+    movq -32(%rbp), %rax
+    add $1, %rax
+    movq %rax, -32(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_add_zero_extend_label2
+.L__kefir_runtime_func___kefir_bigint_add_zero_extend_label7:
+    movq -40(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -16(%rbp)
+    movq -88(%rbp), %rcx
+    movq -88(%rbp), %rax
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    xor %edx, %edx
+    div %rsi
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rax
+    sub %rax, %rcx
+    movq %rcx, -24(%rbp)
+    movq -24(%rbp), %rcx
+    mov $1, %eax
+    shl %cl, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movl %eax, -76(%rbp)
+    movl -76(%rbp), %eax
+    movl -16(%rbp), %ecx
+    and %eax, %ecx
+    movl %ecx, -16(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_add_zero_extend_label8
+.L__kefir_runtime_func___kefir_bigint_add_zero_extend_label10:
+    movq -40(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -16(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_add_zero_extend_label8
+.L__kefir_runtime_text_func___kefir_bigint_add_zero_extend_end:
+
+__kefir_bigint_util_add_digit_zero_extended:
+.L__kefir_runtime_text_func___kefir_bigint_util_add_digit_zero_extended_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $64, %rsp
+    movq %rdx, -48(%rbp)
+    movb %sil, -52(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -48(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -32(%rbp)
+    movl $0, -56(%rbp)
+    movl $0, -40(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -16(%rbp)
+.L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label2:
+    movq -16(%rbp), %rax
+    movq -32(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label4
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label4:
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -36(%rbp)
+    movq -16(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    jz .L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label12
+    movb -52(%rbp), %cl
+    movzx %cl, %ecx
+    lea -4(%rbp), %rax
+.L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label8:
+    movl %ecx, (%rax)
+    movl -40(%rbp), %eax
+    movl -36(%rbp), %ecx
+    movl -4(%rbp), %edx
+    add %ecx, %eax
+    add %edx, %eax
+    movl %eax, -8(%rbp)
+    movl -8(%rbp), %eax
+    movq -24(%rbp), %rcx
+    movq -16(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movl -8(%rbp), %eax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    shr %cl, %eax
+    movl %eax, -40(%rbp)
+    movq -16(%rbp), %rax
+    add $1, %rax
+    movq %rax, -16(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label2
+.L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label12:
+    movl -56(%rbp), %ecx
+    lea -4(%rbp), %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label8
+.L__kefir_runtime_text_func___kefir_bigint_util_add_digit_zero_extended_end:
+
+__kefir_bigint_set_signed_integer:
+.L__kefir_runtime_text_func___kefir_bigint_set_signed_integer_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $48, %rsp
+    movq %rdx, -40(%rbp)
+    movq %rsi, -48(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -48(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    sete %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label16
+    movq -48(%rbp), %rax
+    movq %rax, -32(%rbp)
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $8, %edx
+    imul %rcx, %rdx
+    xor %ecx, %ecx
+    cmp %rdx, %rax
+    seta %cl
+    test %ecx, %ecx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label4
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label5:
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -16(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label6:
+    movq -8(%rbp), %rax
+    movq -16(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label8
+    movq -32(%rbp), %rax
+    movq -48(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label11
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label12:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label11:
+    movq -24(%rbp), %rdi
+    movq -32(%rbp), %rsi
+    movq -48(%rbp), %rdx
+    call __kefir_bigint_cast_signed
+    jmp .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label12
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label8:
+    movq -40(%rbp), %rax
+    movq -24(%rbp), %rcx
+    movq -8(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rcx
+    movb %al, (%rcx)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    movq -40(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    shr %cl, %rax
+    movq %rax, -40(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label6
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label4:
+    mov $8, %ecx
+    movsx %ecx, %rax
+    mov $8, %ecx
+    imul %rax, %rcx
+    movq %rcx, -32(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label5
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label16:
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_set_signed_integer_end:
+
+__kefir_bigint_left_shift_whole_digits:
+.L__kefir_runtime_text_func___kefir_bigint_left_shift_whole_digits_begin:
+    push %rbp
+    mov %rsp, %rbp
+    sub $48, %rsp
+    movq %rdx, -40(%rbp)
+    movq %rsi, -48(%rbp)
+    movq %rdi, -24(%rbp)
+    movq -40(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -32(%rbp)
+    movq -32(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    movq %rax, -16(%rbp)
+.L__kefir_runtime_func___kefir_bigint_left_shift_whole_digits_label2:
+    movq -16(%rbp), %rax
+    movq -48(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    seta %dl
+    xor %esi, %esi
+    cmp %rax, %rcx
+    sete %sil
+    or %rsi, %rdx
+    setne %dl
+    movzx %dl, %rax
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_left_shift_whole_digits_label8
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -8(%rbp)
+.L__kefir_runtime_func___kefir_bigint_left_shift_whole_digits_label4:
+    movq -8(%rbp), %rax
+    movq -48(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_left_shift_whole_digits_label6
+    xor %eax, %eax
+    lea (%rbp), %rsp
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_left_shift_whole_digits_label6:
+    movq -24(%rbp), %rax
+    movq -8(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb $0, (%rax)
+    movq -8(%rbp), %rax
+    add $1, %rax
+    movq %rax, -8(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_whole_digits_label4
+.L__kefir_runtime_func___kefir_bigint_left_shift_whole_digits_label8:
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %rcx
+    movq -48(%rbp), %rdx
+    sub %rdx, %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movq -24(%rbp), %rax
+    movq -16(%rbp), %rdx
+    imul $1, %rdx, %rdx
+    add %rdx, %rax
+    movb %cl, (%rax)
+    movq -16(%rbp), %rax
+    add $-1, %rax
+    movq %rax, -16(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_whole_digits_label2
+.L__kefir_runtime_text_func___kefir_bigint_left_shift_whole_digits_end:
+
+__kefir_bigint_signed_multiply:
+.L__kefir_runtime_text_func___kefir_bigint_signed_multiply_begin:
+    push %rbp
+    mov %rsp, %rbp
+    push %rbx
+    sub $120, %rsp
+    movq %r9, -112(%rbp)
+    movq %r8, -88(%rbp)
+    movq %rcx, -64(%rbp)
+    movq %rdx, -80(%rbp)
+    movq %rsi, -96(%rbp)
+    movq %rdi, -128(%rbp)
+    movq -128(%rbp), %rax
+    movq -88(%rbp), %rcx
+    mov $0, %edx
+    movsx %edx, %rsi
+    movq %rcx, -40(%rbp)
+    movq %rax, -48(%rbp)
+    movq -40(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -56(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -32(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label3:
+    movq -32(%rbp), %rax
+    movq -56(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label5
+    movq -88(%rbp), %rax
+    xor %ecx, %ecx
+    cmp %rsi, %rax
+    sete %cl
+    test %cl, %cl
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label41
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label8:
+    test %ecx, %ecx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label40
+    movq -112(%rbp), %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -72(%rbp)
+    movq -112(%rbp), %rax
+    movq -72(%rbp), %rcx
+    mov $1, %esi
+    movsx %esi, %rdx
+    sub %rdx, %rax
+    mov $8, %esi
+    movsx %esi, %rdx
+    mov $1, %esi
+    imul %rdx, %rsi
+    imul %rsi, %rcx
+    sub %rcx, %rax
+    movq %rax, -120(%rbp)
+    movq -96(%rbp), %rax
+    movq -112(%rbp), %rcx
+    mov $0, %edx
+    movsx %edx, %rsi
+    movq %rcx, -48(%rbp)
+    movq %rax, -56(%rbp)
+    movq -48(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -40(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -32(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label11:
+    movq -32(%rbp), %rax
+    movq -40(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label39
+    movl $0, -104(%rbp)
+    movq %rsi, -56(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label13:
+    movq -56(%rbp), %rax
+    movq -112(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label15
+    movq -128(%rbp), %rax
+    movq -96(%rbp), %rcx
+    movq -112(%rbp), %rdx
+    mov $2, %esi
+    movsx %esi, %rbx
+    movq %rdx, -32(%rbp)
+    movq %rcx, -40(%rbp)
+    movq %rax, -48(%rbp)
+    movq -32(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -56(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -24(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label31:
+    movq -24(%rbp), %rax
+    movq -56(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label33
+    movq -128(%rbp), %rdi
+    movq -112(%rbp), %rsi
+    movq -88(%rbp), %rdx
+    call __kefir_bigint_left_shift
+    movq -128(%rbp), %rax
+    movq -80(%rbp), %rcx
+    movq -112(%rbp), %rdx
+    movq %rdx, -56(%rbp)
+    movq %rcx, -40(%rbp)
+    movq %rax, -48(%rbp)
+    movq -56(%rbp), %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rcx, %rdx
+    add %rdx, %rax
+    mov $1, %edx
+    movsx %edx, %rcx
+    sub %rcx, %rax
+    mov $8, %edx
+    movsx %edx, %rcx
+    mov $1, %edx
+    imul %rdx, %rcx
+    xor %edx, %edx
+    div %rcx
+    movq %rax, -32(%rbp)
+    mov $0, %ecx
+    movsx %ecx, %rax
+    movq %rax, -24(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label36:
+    movq -24(%rbp), %rax
+    movq -32(%rbp), %rcx
+    xor %edx, %edx
+    cmp %rcx, %rax
+    setb %dl
+    test %edx, %edx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label38
+    movq -128(%rbp), %rdi
+    movq -112(%rbp), %rax
+    movq -88(%rbp), %rdx
+    imul %rbx, %rax
+    mov %rax, %rsi
+    call __kefir_bigint_cast_signed
+    xor %eax, %eax
+    lea -8(%rbp), %rsp
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label38:
+    movq -48(%rbp), %rax
+    movq -24(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -16(%rbp)
+    movq -40(%rbp), %rax
+    movq -24(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -100(%rbp)
+    movl -16(%rbp), %eax
+    movl -100(%rbp), %ecx
+    movq -48(%rbp), %rdx
+    movq -24(%rbp), %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rdx
+    or %ecx, %eax
+    movb %al, (%rdx)
+    movq -24(%rbp), %rax
+    add $1, %rax
+    movq %rax, -24(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label36
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label33:
+    movq -48(%rbp), %rax
+    movq -24(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -100(%rbp)
+    movq -40(%rbp), %rax
+    movq -24(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    movl %ecx, -16(%rbp)
+    movl -100(%rbp), %eax
+    movl -16(%rbp), %ecx
+    movq -48(%rbp), %rdx
+    movq -24(%rbp), %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rdx
+    or %ecx, %eax
+    movb %al, (%rdx)
+    movq -24(%rbp), %rax
+    add $1, %rax
+    movq %rax, -24(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label31
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label15:
+    movq -80(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    and $1, %ecx
+    movl %ecx, -100(%rbp)
+    movl -100(%rbp), %eax
+    test %eax, %eax
+    setne %al
+    movzx %al, %rax
+    test %al, %al
+    sete %cl
+    test %cl, %cl
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label28
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label17:
+    test %eax, %eax
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label19
+    movl -100(%rbp), %eax
+    xor %ecx, %ecx
+    test %eax, %eax
+    sete %cl
+    test %cl, %cl
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label23
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label24:
+    test %ecx, %ecx
+    sete %al
+    test %al, %al
+    jz .L__kefir_runtime_func___kefir_bigint_signed_multiply_label26
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label20:
+    movl -100(%rbp), %eax
+    movl %eax, -104(%rbp)
+    movq -96(%rbp), %rax
+    mov $0, %edx
+    movsx %edx, %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb (%rax), %cl
+    movzx %cl, %ecx
+    and $1, %ecx
+    movl %ecx, -48(%rbp)
+    movq -96(%rbp), %rdi
+    movq -112(%rbp), %rdx
+    mov $1, %eax
+    movsx %eax, %rsi
+    call __kefir_bigint_arithmetic_right_shift
+    movq -80(%rbp), %rdi
+    movq -112(%rbp), %rdx
+    mov $1, %eax
+    movsx %eax, %rsi
+    call __kefir_bigint_right_shift
+    movl -48(%rbp), %eax
+    movq -120(%rbp), %rcx
+    movq -80(%rbp), %rdx
+    movq -72(%rbp), %rsi
+    imul $1, %rsi, %rsi
+    add %rsi, %rdx
+    movb (%rdx), %sil
+    movzx %sil, %esi
+    shl %cl, %eax
+    or %eax, %esi
+    movb %sil, (%rdx)
+    movq -56(%rbp), %rax
+    add $1, %rax
+    movq %rax, -56(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label13
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label26:
+    movq -96(%rbp), %rdi
+    movq -64(%rbp), %rsi
+    movq -112(%rbp), %rdx
+    call __kefir_bigint_add
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label20
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label23:
+    movl -104(%rbp), %eax
+    test %eax, %eax
+    setne %al
+    movzx %al, %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label24
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label19:
+    movq -96(%rbp), %rdi
+    movq -64(%rbp), %rsi
+    movq -112(%rbp), %rdx
+    call __kefir_bigint_subtract
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label20
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label28:
+    movl -104(%rbp), %ecx
+    xor %eax, %eax
+    test %ecx, %ecx
+    sete %al
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label17
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label39:
+    movq -56(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb $0, (%rax)
+    movq -32(%rbp), %rax
+    add $1, %rax
+    movq %rax, -32(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label11
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label40:
+    xor %eax, %eax
+    lea -8(%rbp), %rsp
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label41:
+    movq -112(%rbp), %rax
+    mov $0, %edi
+    movsx %edi, %rdx
+    xor %ecx, %ecx
+    cmp %rdx, %rax
+    sete %cl
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label8
+.L__kefir_runtime_func___kefir_bigint_signed_multiply_label5:
+    movq -48(%rbp), %rax
+    movq -32(%rbp), %rcx
+    imul $1, %rcx, %rcx
+    add %rcx, %rax
+    movb $0, (%rax)
+    movq -32(%rbp), %rax
+    add $1, %rax
+    movq %rax, -32(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_multiply_label3
+.L__kefir_runtime_text_func___kefir_bigint_signed_multiply_end:
+
+
@@ -0,0 +1,622 @@
+.att_syntax
+.section .note.GNU-stack,"",%progbits
+
+.global unit2_div
+.type unit2_div, @function
+
+.section .text
+.L__kefir_text_section_begin:
+unit2_div:
+.L__kefir_text_func_unit2_div_begin:
+    push %rbp
+    mov %rsp, %rbp
+    push %rbx
+    sub $184, %rsp
+    mov %rsi, %rbx
+    mov %rdi, %rdx
+    lea -192(%rbp), %rdi
+    mov $200, %esi
+    call __kefir_bigint_set_signed_integer
+    movdqu -192(%rbp), %xmm0
+    movdqu %xmm0, -160(%rbp)
+    movdqu -176(%rbp), %xmm0
+    movdqu %xmm0, -144(%rbp)
+    lea -160(%rbp), %rdi
+    mov $200, %esi
+    mov $400, %edx
+    call __kefir_bigint_cast_signed
+    lea -192(%rbp), %rdi
+    mov $200, %esi
+    mov %rbx, %rdx
+    call __kefir_bigint_set_signed_integer
+    movdqu -192(%rbp), %xmm0
+    movdqu %xmm0, -104(%rbp)
+    movdqu -176(%rbp), %xmm0
+    movdqu %xmm0, -88(%rbp)
+    lea -160(%rbp), %rdi
+    lea -72(%rbp), %rsi
+    lea -104(%rbp), %rdx
+    mov $400, %ecx
+    mov $200, %r8d
+    call __kefir_bigint_signed_divide
+    movq -160(%rbp), %rax
+    lea -8(%rbp), %rsp
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_text_func_unit2_div_end:
+
+.L__kefir_text_section_end:
+
+.att_syntax
+.section .note.GNU-stack,"",%progbits
+
+
+.section .text
+__kefir_bigint_is_zero:
+.L__kefir_runtime_text_func___kefir_bigint_is_zero_begin:
+    cmp $0, %rsi
+    je .L__kefir_runtime_func___kefir_bigint_is_zero_label12
+    lea 7(%rsi), %rax
+    shr $3, %rax
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_is_zero_label3:
+    cmp %rax, %rcx
+    jb .L__kefir_runtime_func___kefir_bigint_is_zero_label5
+    mov $1, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_is_zero_label5:
+    mov %rdx, %r8
+    movb (%rdi, %rcx, 1), %r8b
+    lea 1(%rcx), %rdx
+    cmp %rax, %rdx
+    je .L__kefir_runtime_func___kefir_bigint_is_zero_label7
+.L__kefir_runtime_func___kefir_bigint_is_zero_label8:
+    test %r8b, %r8b
+    jnz .L__kefir_runtime_func___kefir_bigint_is_zero_label10
+    mov %rdx, %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_is_zero_label3
+.L__kefir_runtime_func___kefir_bigint_is_zero_label10:
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_is_zero_label7:
+    movzx %r8b, %r8
+    lea -1(%rsi), %rcx
+    mov %rcx, %r9
+    shr $3, %r9
+    shl $3, %r9
+    sub %r9, %rcx
+    add $1, %rcx
+    mov $1, %r9d
+    shl %cl, %r9
+    sub $1, %r9d
+    and %r9d, %r8d
+    jmp .L__kefir_runtime_func___kefir_bigint_is_zero_label8
+.L__kefir_runtime_func___kefir_bigint_is_zero_label12:
+    mov $1, %eax
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_is_zero_end:
+
+__kefir_bigint_cast_signed:
+.L__kefir_runtime_text_func___kefir_bigint_cast_signed_begin:
+    lea -1(%rdx), %rax
+    mov %rax, %r8
+    shr $3, %r8
+    mov %r8, %rcx
+    shl $3, %rcx
+    sub %rcx, %rax
+    cmp %rsi, %rdx
+    jbe .L__kefir_runtime_func___kefir_bigint_cast_signed_label22
+    cmp $0, %rsi
+    je .L__kefir_runtime_func___kefir_bigint_cast_signed_label4
+    sub $1, %rsi
+    mov %rsi, %rax
+    shr $3, %rax
+    movzxb (%rdi, %rax, 1), %rdx
+    mov %rax, %rcx
+    shl $3, %rcx
+    sub %rcx, %rsi
+    mov %rsi, %rcx
+    sar %cl, %edx
+    and $1, %edx
+    lea 1(%rsi), %rcx
+    cmp $8, %rcx
+    jb .L__kefir_runtime_func___kefir_bigint_cast_signed_label7
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label10:
+    add $1, %rax
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label11:
+    cmp %r8, %rax
+    jbe .L__kefir_runtime_func___kefir_bigint_cast_signed_label13
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label13:
+    test %edx, %edx
+    jnz .L__kefir_runtime_func___kefir_bigint_cast_signed_label16
+    movb $0, (%rdi, %rax, 1)
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label15:
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label11
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label16:
+    movb $-1, (%rdi, %rax, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label15
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label7:
+    mov $1, %r9d
+    mov %rsi, %rcx
+    shl %cl, %r9
+    sub $1, %r9b
+    test %edx, %edx
+    jnz .L__kefir_runtime_func___kefir_bigint_cast_signed_label9
+    andb %r9b, (%rdi, %rax, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label10
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label9:
+    movb (%rdi, %rax, 1), %cl
+    not %r9b
+    or %r9b, %cl
+    movb %cl, (%rdi, %rax, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label10
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label4:
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label18:
+    cmp %r8, %rax
+    jbe .L__kefir_runtime_func___kefir_bigint_cast_signed_label20
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label20:
+    movb $0, (%rdi, %rax, 1)
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label18
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label22:
+    movzxb (%rdi, %r8, 1), %rdx
+    mov $1, %esi
+    mov %rax, %rcx
+    shl %cl, %rsi
+    sub $1, %sil
+    mov %rax, %rcx
+    sar %cl, %edx
+    and $1, %edx
+    jnz .L__kefir_runtime_func___kefir_bigint_cast_signed_label25
+    andb %sil, (%rdi, %r8, 1)
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label24:
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_cast_signed_label25:
+    movb (%rdi, %r8, 1), %al
+    not %sil
+    or %sil, %al
+    movb %al, (%rdi, %r8, 1)
+    jmp .L__kefir_runtime_func___kefir_bigint_cast_signed_label24
+.L__kefir_runtime_text_func___kefir_bigint_cast_signed_end:
+
+__kefir_bigint_signed_divide:
+.L__kefir_runtime_text_func___kefir_bigint_signed_divide_begin:
+    push %rbp
+    mov %rsp, %rbp
+    push %rbx
+    push %r12
+    push %r13
+    push %r14
+    push %r15
+    sub $72, %rsp
+    mov %r8, %rbx
+    mov %rcx, %r12
+    mov %rdx, %r13
+    mov %rsi, %r14
+    mov %rdi, %r15
+    mov %r15, %rdi
+    mov %r12, %rsi
+    call __kefir_bigint_get_sign
+    mov %rax, -112(%rbp)
+    mov %r13, %rdi
+    mov %rbx, %rsi
+    call __kefir_bigint_get_sign
+    mov %rax, -104(%rbp)
+    mov %r13, %rdi
+    mov %rbx, %rsi
+    call __kefir_bigint_is_zero
+    test %eax, %eax
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label61
+    movl -112(%rbp), %eax
+    movl -112(%rbp), %ecx
+    test %ecx, %eax
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label4
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label7:
+    movl -104(%rbp), %eax
+    movl -104(%rbp), %ecx
+    test %ecx, %eax
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label9
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label14:
+    lea 7(%r12), %rax
+    mov %rax, -96(%rbp)
+    shrq $3, -96(%rbp)
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label15:
+    movq -96(%rbp), %rcx
+    cmp %rcx, %rax
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label17
+    cmp $0, %r12
+    je .L__kefir_runtime_func___kefir_bigint_signed_divide_label22
+    mov %r13, %rdi
+    mov %rbx, %rsi
+    call __kefir_bigint_is_zero
+    test %eax, %eax
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label22
+    lea -1(%r12), %rax
+    mov %rax, -80(%rbp)
+    shrq $3, -80(%rbp)
+    mov -80(%rbp), %rcx
+    shl $3, %rcx
+    mov %rax, -88(%rbp)
+    subq %rcx, -88(%rbp)
+    xor %eax, %eax
+    mov %rax, -72(%rbp)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label21:
+    cmpq %r12, -72(%rbp)
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label37
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label22:
+    mov -112(%rbp), %rax
+    xorl -104(%rbp), %eax
+    test %eax, %eax
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label24
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label25:
+    movl -112(%rbp), %ecx
+    movl -112(%rbp), %edx
+    test %edx, %ecx
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label27
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label28:
+    xor %eax, %eax
+    lea -40(%rbp), %rsp
+    pop %r15
+    pop %r14
+    pop %r13
+    pop %r12
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label27:
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label29:
+    movq -96(%rbp), %rcx
+    cmp %rcx, %rax
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label31
+    mov %r14, %rdi
+    mov $1, %esi
+    mov %r12, %rdx
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label28
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label31:
+    notb (%r14, %rax, 1)
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label29
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label24:
+    xor %eax, %eax
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label33:
+    movq -96(%rbp), %rcx
+    cmp %rcx, %rax
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label35
+    mov %r15, %rdi
+    mov $1, %esi
+    mov %r12, %rdx
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label25
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label35:
+    notb (%r15, %rax, 1)
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label33
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label37:
+    movq -80(%rbp), %rcx
+    movzxb (%r15, %rcx, 1), %rdx
+    movq %rdx, -64(%rbp)
+    mov %r14, %rdi
+    mov $1, %esi
+    mov %r12, %rdx
+    call __kefir_bigint_left_shift
+    mov %r15, %rdi
+    mov $1, %esi
+    mov %r12, %rdx
+    call __kefir_bigint_left_shift
+    mov %rax, %rdx
+    movb (%r14), %dl
+    mov -88(%rbp), %rcx
+    mov -64(%rbp), %rax
+    sar %cl, %eax
+    and $1, %al
+    or %al, %dl
+    movb %dl, (%r14)
+    lea 7(%rbx), %rax
+    shr $3, %rax
+    xor %ecx, %ecx
+    xor %edx, %edx
+    mov %rdx, %rsi
+    mov %rcx, %rdx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label38:
+    lea -1(%rbx), %r8
+    movq -96(%rbp), %rcx
+    cmp %rcx, %rdx
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label40
+    movq -80(%rbp), %rcx
+    movzxb (%r14, %rcx, 1), %rdx
+    mov -88(%rbp), %rcx
+    sar %cl, %edx
+    and $1, %edx
+    jnz .L__kefir_runtime_func___kefir_bigint_signed_divide_label49
+    orb $1, (%r15)
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label51:
+    addq $1, -72(%rbp)
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label21
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label49:
+    andb $-2, (%r15)
+    xor %ecx, %ecx
+    xor %esi, %esi
+    mov %rcx, %rdx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label50:
+    movq -96(%rbp), %rcx
+    cmp %rcx, %rdx
+    jae .L__kefir_runtime_func___kefir_bigint_signed_divide_label51
+    movzxb (%r14, %rdx, 1), %rdi
+    lea 1(%rdx), %r9
+    cmp %rax, %r9
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label58
+    cmp %rax, %r9
+    je .L__kefir_runtime_func___kefir_bigint_signed_divide_label55
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label57:
+    add %edi, %esi
+    add %ecx, %esi
+    movb %sil, (%r14, %rdx, 1)
+    shr $8, %esi
+    mov %r9, %rdx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label50
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label55:
+    movzxb (%r13, %rdx, 1), %r10
+    mov %r8, %rcx
+    shr $3, %rcx
+    shl $3, %rcx
+    mov %rbx, %r11
+    sub %rcx, %r11
+    mov %r11, %rcx
+    mov $1, %r11d
+    shl %cl, %r11
+    sub $1, %r11d
+    mov %r10, %rcx
+    and %r11d, %ecx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label57
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label58:
+    movzxb (%r13, %rdx, 1), %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label57
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label40:
+    movzxb (%r14, %rdx, 1), %rdi
+    lea 1(%rdx), %r9
+    cmp %rax, %r9
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label46
+    cmp %rax, %r9
+    je .L__kefir_runtime_func___kefir_bigint_signed_divide_label43
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label45:
+    mov %rdi, %r10
+    sub %ecx, %r10d
+    mov %r10, %rcx
+    mov %ecx, %r10d
+    sub %esi, %r10d
+    mov %r10, %rsi
+    movb %sil, (%r14, %rdx, 1)
+    shr $8, %esi
+    and $1, %esi
+    mov %r9, %rdx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label38
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label43:
+    movzxb (%r13, %rdx, 1), %r10
+    shr $3, %r8
+    shl $3, %r8
+    mov %rbx, %rcx
+    sub %r8, %rcx
+    mov $1, %r8d
+    shl %cl, %r8
+    sub $1, %r8d
+    mov %r10, %rcx
+    and %r8d, %ecx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label45
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label46:
+    movzxb (%r13, %rdx, 1), %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label45
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label17:
+    movb $0, (%r14, %rax, 1)
+    add $1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label15
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label9:
+    lea 7(%rbx), %rax
+    shr $3, %rax
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label10:
+    cmp %rax, %rcx
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label12
+    mov %r13, %rdi
+    mov $1, %esi
+    mov %rbx, %rdx
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label14
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label12:
+    notb (%r13, %rcx, 1)
+    add $1, %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label10
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label4:
+    lea 7(%r12), %rax
+    shr $3, %rax
+    xor %ecx, %ecx
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label5:
+    cmp %rax, %rcx
+    jb .L__kefir_runtime_func___kefir_bigint_signed_divide_label60
+    mov %r15, %rdi
+    mov $1, %esi
+    mov %r12, %rdx
+    call __kefir_bigint_util_add_digit_zero_extended
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label7
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label60:
+    notb (%r15, %rcx, 1)
+    add $1, %rcx
+    jmp .L__kefir_runtime_func___kefir_bigint_signed_divide_label5
+.L__kefir_runtime_func___kefir_bigint_signed_divide_label61:
+    mov $1, %eax
+    lea -40(%rbp), %rsp
+    pop %r15
+    pop %r14
+    pop %r13
+    pop %r12
+    pop %rbx
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_signed_divide_end:
+
+__kefir_bigint_left_shift:
+.L__kefir_runtime_text_func___kefir_bigint_left_shift_begin:
+    cmp %rdx, %rsi
+    cmova %rdx, %rsi
+    sub $-7, %rdx
+    shr $3, %rdx
+    sub $1, %rdx
+    mov %rsi, %rcx
+    shr $3, %rcx
+    cmp $0, %rcx
+    ja .L__kefir_runtime_func___kefir_bigint_left_shift_label3
+.L__kefir_runtime_func___kefir_bigint_left_shift_label4:
+    mov $8, %eax
+    sub %rsi, %rax
+    cmp $0, %rsi
+    ja .L__kefir_runtime_func___kefir_bigint_left_shift_label8
+.L__kefir_runtime_func___kefir_bigint_left_shift_label7:
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_left_shift_label8:
+    cmp $0, %rdx
+    ja .L__kefir_runtime_func___kefir_bigint_left_shift_label10
+    movb (%rdi), %al
+    mov %rsi, %rcx
+    shl %cl, %al
+    movb %al, (%rdi)
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label7
+.L__kefir_runtime_func___kefir_bigint_left_shift_label10:
+    movzxb (%rdi, %rdx, 1), %r8
+    movzxb -1(%rdi, %rdx, 1), %r9
+    mov %rsi, %rcx
+    shl %cl, %r8d
+    mov %rax, %rcx
+    sar %cl, %r9d
+    or %r9b, %r8b
+    movb %r8b, (%rdi, %rdx, 1)
+    add $-1, %rdx
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label8
+.L__kefir_runtime_func___kefir_bigint_left_shift_label3:
+    mov %rdx, %rax
+.L__kefir_runtime_func___kefir_bigint_left_shift_label11:
+    cmp %rcx, %rax
+    jae .L__kefir_runtime_func___kefir_bigint_left_shift_label16
+    xor %eax, %eax
+    mov %rax, %r8
+.L__kefir_runtime_func___kefir_bigint_left_shift_label13:
+    mov %rcx, %rax
+    shl $3, %rax
+    mov %rsi, %r9
+    sub %rax, %r9
+    mov %r9, %rax
+    cmp %rcx, %r8
+    jb .L__kefir_runtime_func___kefir_bigint_left_shift_label15
+    mov %rax, %rsi
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label4
+.L__kefir_runtime_func___kefir_bigint_left_shift_label15:
+    movb $0, (%rdi, %r8, 1)
+    add $1, %r8
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label13
+.L__kefir_runtime_func___kefir_bigint_left_shift_label16:
+    mov %rax, %r8
+    sub %rcx, %r8
+    movb (%rdi, %r8, 1), %r9b
+    movb %r9b, (%rdi, %rax, 1)
+    add $-1, %rax
+    jmp .L__kefir_runtime_func___kefir_bigint_left_shift_label11
+.L__kefir_runtime_text_func___kefir_bigint_left_shift_end:
+
+__kefir_bigint_get_sign:
+.L__kefir_runtime_text_func___kefir_bigint_get_sign_begin:
+    cmp $0, %rsi
+    je .L__kefir_runtime_func___kefir_bigint_get_sign_label3
+    sub $1, %rsi
+    mov %rsi, %rax
+    shr $3, %rax
+    movzxb (%rdi, %rax, 1), %rdx
+    shl $3, %rax
+    mov %rsi, %rcx
+    sub %rax, %rcx
+    sar %cl, %edx
+    mov %edx, %eax
+    and $1, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_get_sign_label3:
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_get_sign_end:
+
+__kefir_bigint_util_add_digit_zero_extended:
+.L__kefir_runtime_text_func___kefir_bigint_util_add_digit_zero_extended_begin:
+    movzx %sil, %rax
+    sub $-7, %rdx
+    shr $3, %rdx
+    xor %ecx, %ecx
+    xor %esi, %esi
+.L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label2:
+    cmp %rdx, %rcx
+    jb .L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label4
+    xor %eax, %eax
+    ret
+.L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label4:
+    movzxb (%rdi, %rcx, 1), %r8
+    add %r8d, %esi
+    xor %r8d, %r8d
+    cmp $0, %rcx
+    mov %rax, %r9
+    cmovne %r8, %r9
+    mov %r9, %r8
+    add %r8d, %esi
+    movb %sil, (%rdi, %rcx, 1)
+    add $1, %rcx
+    shr $8, %esi
+    jmp .L__kefir_runtime_func___kefir_bigint_util_add_digit_zero_extended_label2
+.L__kefir_runtime_text_func___kefir_bigint_util_add_digit_zero_extended_end:
+
+__kefir_bigint_set_signed_integer:
+.L__kefir_runtime_text_func___kefir_bigint_set_signed_integer_begin:
+    push %rbp
+    mov %rsp, %rbp
+    mov %rsi, %rax
+    cmp $0, %rax
+    je .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label3
+    mov $64, %ecx
+    cmp $64, %rax
+    mov %rax, %rsi
+    cmova %rcx, %rsi
+    lea 7(%rsi), %rcx
+    shr $3, %rcx
+    xor %r8d, %r8d
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label5:
+    cmp %rcx, %r8
+    jb .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label7
+    cmp %rax, %rsi
+    jb .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label10
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label11:
+    xor %eax, %eax
+    pop %rbp
+    ret
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label10:
+    mov %rax, %rdx
+    call __kefir_bigint_cast_signed
+    jmp .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label11
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label7:
+    movb %dl, (%rdi, %r8, 1)
+    add $1, %r8
+    shr $8, %rdx
+    jmp .L__kefir_runtime_func___kefir_bigint_set_signed_integer_label5
+.L__kefir_runtime_func___kefir_bigint_set_signed_integer_label3:
+    xor %eax, %eax
+    pop %rbp
+    ret
+.L__kefir_runtime_text_func___kefir_bigint_set_signed_integer_end:
+
+
@@ -0,0 +1,4 @@
+/root/repo
+source/tests/end2end/embed_blob1/main.host.c
+bin/tests/end2end/embed_blob1/main.host.o
+cc -std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE   '-DKEFIR_BUILD_CFLAGS=-std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE ' '-DKEFIR_BUILD_SOURCE_ID=r29.83463ffaed34ec4a0bb7350d4ac015f622856c73' '-DKEFIR_BUILD_TIMESTAMP=1792233951' -Wno-int-in-bool-context -UNDEBUG -I./headers -include ./bin/config.h  -c source/tests/end2end/embed_blob1/main.host.c -o bin/tests/end2end/embed_blob1/main.host.o
@@ -0,0 +1,4 @@
+/root/repo
+source/tests/end2end/live_range_split1/main.host.c
+bin/tests/end2end/live_range_split1/main.host.o
+cc -std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE   '-DKEFIR_BUILD_CFLAGS=-std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE ' '-DKEFIR_BUILD_SOURCE_ID=r31.537501aeb92e76be35497be8d13a9cee1b07db30' '-DKEFIR_BUILD_TIMESTAMP=1792236101' -Wno-int-in-bool-context -UNDEBUG -I./headers -include ./bin/config.h  -c source/tests/end2end/live_range_split1/main.host.c -o bin/tests/end2end/live_range_split1/main.host.o
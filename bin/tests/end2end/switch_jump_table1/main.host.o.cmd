@@ -0,0 +1,4 @@
+/root/repo
+source/tests/end2end/switch_jump_table1/main.host.c
+bin/tests/end2end/switch_jump_table1/main.host.o
+cc -std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE   '-DKEFIR_BUILD_CFLAGS=-std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE ' '-DKEFIR_BUILD_SOURCE_ID=r30.9abf8abed8093969586039038c8b9943c5fc8e61' '-DKEFIR_BUILD_TIMESTAMP=1792235572' -Wno-int-in-bool-context -UNDEBUG -I./headers -include ./bin/config.h  -c source/tests/end2end/switch_jump_table1/main.host.c -o bin/tests/end2end/switch_jump_table1/main.host.o
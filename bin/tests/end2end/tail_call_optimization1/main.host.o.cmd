@@ -0,0 +1,4 @@
+/root/repo
+source/tests/end2end/tail_call_optimization1/main.host.c
+bin/tests/end2end/tail_call_optimization1/main.host.o
+cc -std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE   '-DKEFIR_BUILD_CFLAGS=-std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE ' '-DKEFIR_BUILD_SOURCE_ID=r23.6e07e7251661ad0cf01c93c022984bf2b5cf524b' '-DKEFIR_BUILD_TIMESTAMP=1792224951' -Wno-int-in-bool-context -UNDEBUG -I./headers -include ./bin/config.h  -c source/tests/end2end/tail_call_optimization1/main.host.c -o bin/tests/end2end/tail_call_optimization1/main.host.o
@@ -0,0 +1,4 @@
+/root/repo
+source/tests/integration/ast/translate_expression_function_call2.test.c
+bin/tests/integration/ast/translate_expression_function_call2.test.o
+cc -std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE   '-DKEFIR_BUILD_CFLAGS=-std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE ' '-DKEFIR_BUILD_SOURCE_ID=r33.99d5366b19ae2358a8c3637f1a81ef3eaeafa01d' '-DKEFIR_BUILD_TIMESTAMP=1792238821' -I./headers -include ./bin/config.h  -c source/tests/integration/ast/translate_expression_function_call2.test.c -o bin/tests/integration/ast/translate_expression_function_call2.test.o
@@ -0,0 +1,4 @@
+/root/repo
+source/tests/system/translator/struct_member_bitfields3.gen.c
+bin/tests/system/translator/struct_member_bitfields3.gen.o
+cc -std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE   '-DKEFIR_BUILD_CFLAGS=-std=c11 -fno-common -fPIC -O3 -DNDEBUG -DKEFIR_BUILD_RELEASE ' '-DKEFIR_BUILD_SOURCE_ID=r33.99d5366b19ae2358a8c3637f1a81ef3eaeafa01d' '-DKEFIR_BUILD_TIMESTAMP=1792238821' -I./headers -include ./bin/config.h  -c source/tests/system/translator/struct_member_bitfields3.gen.c -o bin/tests/system/translator/struct_member_bitfields3.gen.o
@@ -31,6 +31,7 @@ typedef struct kefir_ast_translator_configuration {
     kefir_bool_t precise_bitfield_load_store;
     kefir_bool_t optimize_stack_frame;
     kefir_bool_t cx_limited_range;
+    kefir_bool_t strict_aliasing;
 } kefir_ast_translator_configuration_t;
 
 typedef struct kefir_ast_translator_environment_type {
@@ -28,6 +28,8 @@ typedef struct kefir_ast_initializer_traversal {
     kefir_result_t (*visit_value)(const struct kefir_ast_designator *, struct kefir_ast_node_base *, void *);
     kefir_result_t (*visit_string_literal)(const struct kefir_ast_designator *, struct kefir_ast_node_base *,
                                            kefir_ast_string_literal_type_t, const void *, kefir_size_t, void *);
+    kefir_result_t (*visit_embed_value)(const struct kefir_ast_designator *, struct kefir_ast_node_base *,
+                                        kefir_uint8_t, void *);
     kefir_result_t (*begin_struct_union)(const struct kefir_ast_designator *, const struct kefir_ast_initializer *,
                                          void *);
     kefir_result_t (*begin_array)(const struct kefir_ast_designator *, const struct kefir_ast_initializer *, void *);
@@ -40,6 +42,7 @@ typedef struct kefir_ast_initializer_traversal {
     do {                                                 \
         (_traversal)->visit_value = NULL;                \
         (_traversal)->visit_string_literal = NULL;       \
+        (_traversal)->visit_embed_value = NULL;          \
         (_traversal)->begin_struct_union = NULL;         \
         (_traversal)->begin_array = NULL;                \
         (_traversal)->visit_initializer_list = NULL;     \
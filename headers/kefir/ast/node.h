@@ -73,6 +73,7 @@ KEFIR_AST_NODE_STRUCT(kefir_ast_string_literal, {
     kefir_ast_string_literal_type_t type;
     void *literal;
     kefir_size_t length;
+    kefir_bool_t embed;
 });
 
 typedef struct kefir_ast_type_declaration {
@@ -377,6 +378,8 @@ struct kefir_ast_string_literal *kefir_ast_new_string_literal_wide(struct kefir_
                                                                    kefir_size_t);
 struct kefir_ast_string_literal *kefir_ast_new_string_literal(struct kefir_mem *, const void *, kefir_size_t,
                                                               kefir_ast_string_literal_type_t);
+struct kefir_ast_string_literal *kefir_ast_new_string_literal_embed(struct kefir_mem *, const kefir_uint8_t *,
+                                                                    kefir_size_t);
 
 #define KEFIR_AST_MAKE_STRING_LITERAL_MULTIBYTE(_mem, _string) \
     (kefir_ast_new_string_literal_multibyte((_mem), (_string), strlen((_string)) + 1))
@@ -55,6 +55,7 @@ typedef struct kefir_ast_node_properties {
             kefir_ast_string_literal_type_t type;
             void *content;
             kefir_size_t length;
+            kefir_bool_t embed;
         } string_literal;
         const struct kefir_ast_scoped_identifier *scoped_id;
         struct kefir_ast_temporary_identifier temporary_identifier;
@@ -70,7 +70,8 @@ typedef struct kefir_codegen_amd64_stack_frame kefir_codegen_amd64_stack_frame_t
     KEFIR_ASMCMP_AMD64_VIRTUAL_OPCODE_HELPER(_instr0, tail_call) _separator \
     KEFIR_ASMCMP_AMD64_VIRTUAL_OPCODE_HELPER(_instr0, noop) _separator \
     KEFIR_ASMCMP_AMD64_VIRTUAL_OPCODE_HELPER(_instr0, inline_assembly) _separator \
-    KEFIR_ASMCMP_AMD64_VIRTUAL_OPCODE_HELPER(_instr0, data_word)
+    KEFIR_ASMCMP_AMD64_VIRTUAL_OPCODE_HELPER(_instr0, data_word) _separator \
+    KEFIR_ASMCMP_AMD64_VIRTUAL_OPCODE_HELPER(_instr0, align)
 // clang-format on
 
 #define KEFIR_ASMCMP_AMD64_OPCODE(_opcode) KEFIR_ASMCMP_AMD64_##_opcode
@@ -208,6 +209,10 @@ kefir_result_t kefir_asmcmp_amd64_data_word(struct kefir_mem *, struct kefir_asm
                                             kefir_asmcmp_instruction_index_t, kefir_uint16_t,
                                             kefir_asmcmp_instruction_index_t *);
 
+kefir_result_t kefir_asmcmp_amd64_align(struct kefir_mem *, struct kefir_asmcmp_amd64 *,
+                                        kefir_asmcmp_instruction_index_t, kefir_size_t,
+                                        kefir_asmcmp_instruction_index_t *);
+
 kefir_result_t kefir_asmcmp_amd64_generate_code(struct kefir_mem *, struct kefir_amd64_xasmgen *,
                                                 kefir_amd64_xasmgen_debug_info_tracker_t,
                                                 const struct kefir_asmcmp_amd64 *,
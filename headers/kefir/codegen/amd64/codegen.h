@@ -30,6 +30,9 @@ typedef struct kefir_codegen_amd64 {
     struct kefir_codegen codegen;
     const struct kefir_codegen_configuration *config;
     kefir_abi_amd64_variant_t abi_variant;
+    FILE *output;
+    kefir_asm_amd64_xasmgen_syntax_t syntax;
+    kefir_bool_t xasmgen_initialized;
     struct kefir_amd64_xasmgen xasmgen;
     struct kefir_asm_amd64_xasmgen_helpers xasmgen_helpers;
     kefir_amd64_xasmgen_debug_info_tracker_t debug_info_tracker;
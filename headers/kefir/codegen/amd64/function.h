@@ -146,6 +146,7 @@ kefir_result_t kefir_codegen_amd64_get_argument_register(struct kefir_mem *, str
     _def(branch, KEFIR_OPT_OPCODE_BRANCH) _separator \
     _def(branch_compare, KEFIR_OPT_OPCODE_BRANCH_COMPARE) _separator \
     _def(ijump, KEFIR_OPT_OPCODE_IJUMP) _separator \
+    _def(switch_jump, KEFIR_OPT_OPCODE_SWITCH) _separator \
     _def(int8_store, KEFIR_OPT_OPCODE_INT8_STORE) _separator \
     _def(int16_store, KEFIR_OPT_OPCODE_INT16_STORE) _separator \
     _def(int32_store, KEFIR_OPT_OPCODE_INT32_STORE) _separator \
@@ -603,10 +604,16 @@ kefir_result_t kefir_codegen_amd64_copy_memory(struct kefir_mem *, struct kefir_
                                                kefir_asmcmp_virtual_register_index_t, kefir_size_t);
 kefir_result_t kefir_codegen_amd64_zero_memory(struct kefir_mem *, struct kefir_codegen_amd64_function *,
                                                kefir_asmcmp_virtual_register_index_t, kefir_size_t);
+kefir_result_t kefir_codegen_amd64_fill_memory(struct kefir_mem *, struct kefir_codegen_amd64_function *,
+                                               kefir_asmcmp_virtual_register_index_t, kefir_uint8_t, kefir_size_t);
 
 kefir_result_t kefir_codegen_amd64_translate_builtin(struct kefir_mem *, struct kefir_codegen_amd64_function *,
                                                      const struct kefir_opt_instruction *, kefir_bool_t *,
                                                      kefir_asmcmp_virtual_register_index_t *);
+kefir_result_t kefir_codegen_amd64_translate_memory_builtin(struct kefir_mem *,
+                                                            struct kefir_codegen_amd64_function *,
+                                                            const struct kefir_opt_instruction *, kefir_bool_t *,
+                                                            kefir_asmcmp_virtual_register_index_t *);
 
 kefir_result_t kefir_codegen_amd64_load_general_purpose_register(struct kefir_mem *,
                                                                  struct kefir_codegen_amd64_function *,
@@ -58,6 +58,8 @@ kefir_result_t kefir_codegen_amd64_module_insert_function(struct kefir_mem *, st
                                                           const struct kefir_opt_function *,
                                                           struct kefir_codegen_amd64_function **);
 
+kefir_result_t kefir_codegen_amd64_module_drop_function(struct kefir_mem *, struct kefir_codegen_amd64_module *,
+                                                        const char *);
 kefir_result_t kefir_codegen_amd64_module_function(const struct kefir_codegen_amd64_module *, const char *,
                                                    struct kefir_codegen_amd64_function **);
 
@@ -57,8 +57,11 @@ typedef struct kefir_codegen_amd64_stack_frame {
         kefir_bool_t mxcsr_save;
         kefir_bool_t frame_pointer;
         kefir_size_t extra_alignment;
+        kefir_bool_t red_zone;
     } requirements;
 
+    kefir_bool_t use_red_zone;
+
     const struct kefir_codegen_local_variable_allocator *local_variables;
     struct {
         kefir_asmcmp_virtual_register_index_t return_space_vreg;
@@ -83,6 +86,7 @@ kefir_result_t kefir_codegen_amd64_stack_frame_preserve_mxcsr(struct kefir_codeg
 kefir_result_t kefir_codegen_amd64_stack_frame_require_frame_pointer(struct kefir_codegen_amd64_stack_frame *);
 kefir_result_t kefir_codegen_amd64_stack_frame_require_alignment(struct kefir_codegen_amd64_stack_frame *,
                                                                  kefir_size_t);
+kefir_result_t kefir_codegen_amd64_stack_frame_allow_red_zone(struct kefir_codegen_amd64_stack_frame *);
 kefir_bool_t kefir_codegen_amd64_stack_frame_has_extra_alignment(const struct kefir_codegen_amd64_stack_frame *);
 
 kefir_result_t kefir_codegen_amd64_stack_frame_local_variable_offset(const struct kefir_codegen_amd64_stack_frame *,
@@ -36,6 +36,7 @@
 
 #define KEFIR_AMD64_STRING_LITERAL "%s_string_literal%" KEFIR_ID_FMT
 #define KEFIR_AMD64_LABEL "%s_func_%s_label%" KEFIR_SIZE_FMT
+#define KEFIR_AMD64_SWITCH_TARGET "%s_func_%s_switch%" KEFIR_ID_FMT "_block%" KEFIR_ID_FMT
 #define KEFIR_AMD64_CONSTANT_FLOAT32_TO_UINT "%s_constant_float32_to_uint"
 #define KEFIR_AMD64_CONSTANT_FLOAT64_TO_UINT "%s_constant_float64_to_uint"
 #define KEFIR_AMD64_CONSTANT_LONG_DOUBLE_TO_UINT "%s_constant_long_double_to_uint"
@@ -25,6 +25,8 @@
 #include "kefir/core/mem.h"
 #include "kefir/core/basic-types.h"
 #include "kefir/optimizer/module.h"
+#include "kefir/optimizer/configuration.h"
+#include "kefir/platform/time_report.h"
 
 typedef struct kefir_codegen_runtime_hooks {
     kefir_result_t (*generate_runtime_functions)(struct kefir_mem *, FILE *, const struct kefir_hashtreeset *, void *);
@@ -46,13 +48,29 @@ typedef struct kefir_codegen_configuration {
     kefir_bool_t debug_info;
     kefir_bool_t valgrind_compatible_x87;
     kefir_bool_t runtime_function_generator_mode;
+    kefir_bool_t integrated_assembler;
+    kefir_bool_t code_layout;
+    kefir_bool_t red_zone;
+    kefir_bool_t shrink_wrap;
+    kefir_bool_t live_range_split;
+    kefir_bool_t inline_memory_builtins;
+    kefir_bool_t streaming;
     kefir_codegen_optimization_level_t optimization;
+    struct kefir_time_report *time_report;
 } kefir_codegen_configuration_t;
 
+typedef enum kefir_codegen_output_kind {
+    KEFIR_CODEGEN_OUTPUT_ASSEMBLY,
+    KEFIR_CODEGEN_OUTPUT_OBJECT
+} kefir_codegen_output_kind_t;
+
 typedef struct kefir_codegen {
     kefir_result_t (*translate_optimized)(struct kefir_mem *, struct kefir_codegen *, struct kefir_opt_module *);
+    kefir_result_t (*translate_streaming)(struct kefir_mem *, struct kefir_codegen *, struct kefir_opt_module *,
+                                          const struct kefir_optimizer_configuration *);
     kefir_result_t (*close)(struct kefir_mem *, struct kefir_codegen *);
 
+    kefir_codegen_output_kind_t output_kind;
     void *data;
     void *self;
 } kefir_codegen_t;
@@ -62,6 +80,8 @@ kefir_result_t kefir_codegen_translate_ir(struct kefir_mem *, struct kefir_codeg
 #define KEFIR_CODEGEN_TRANSLATE(mem, codegen, module) (kefir_codegen_translate_ir((mem), (codegen), (module)))
 #define KEFIR_CODEGEN_TRANSLATE_OPTIMIZED(mem, codegen, module) \
     ((codegen)->translate_optimized((mem), (codegen), (module)))
+#define KEFIR_CODEGEN_TRANSLATE_STREAMING(mem, codegen, module, config) \
+    ((codegen)->translate_streaming((mem), (codegen), (module), (config)))
 #define KEFIR_CODEGEN_CLOSE(mem, codegen) ((codegen)->close((mem), (codegen)))
 
 extern const struct kefir_codegen_configuration KefirCodegenDefaultConfiguration;
@@ -24,6 +24,8 @@
 #include "kefir/codegen/target-ir/destructor_ops.h"
 #include "kefir/codegen/amd64/function.h"
 
+#define KEFIR_CODEGEN_TARGET_IR_AMD64_LOOP_ALIGNMENT 16
+
 typedef struct kefir_codegen_target_ir_destructor_amd64_ops {
     struct kefir_codegen_target_ir_destructor_ops ops;
     const struct kefir_codegen_amd64_function *function;
@@ -24,7 +24,13 @@
 #include "kefir/codegen/target-ir/schedule.h"
 #include "kefir/codegen/target-ir/control_flow.h"
 
+typedef struct kefir_codegen_target_ir_amd64_topological_scheduler {
+    const struct kefir_codegen_target_ir_control_flow *control_flow;
+    kefir_bool_t sink_cold_blocks;
+} kefir_codegen_target_ir_amd64_topological_scheduler_t;
+
 kefir_result_t kefir_codegen_target_ir_amd64_topological_scheduler_init(
-    const struct kefir_codegen_target_ir_control_flow *, struct kefir_codegen_target_ir_code_scheduler *);
+    const struct kefir_codegen_target_ir_amd64_topological_scheduler *,
+    struct kefir_codegen_target_ir_code_scheduler *);
 
 #endif
@@ -28,6 +28,8 @@
 typedef struct kefir_codegen_target_ir_destructor_ops {
     kefir_asmcmp_instruction_opcode_t unreachable_opcode;
     kefir_asmcmp_instruction_opcode_t noop_opcode;
+    kefir_asmcmp_instruction_opcode_t align_opcode;
+    kefir_size_t loop_alignment;
     kefir_result_t (*bind_native_id)(struct kefir_mem *, kefir_asmcmp_label_index_t,
                                      kefir_codegen_target_ir_native_id_t, void *);
     kefir_result_t (*new_inline_asm)(struct kefir_mem *, kefir_asmcmp_instruction_index_t,
@@ -23,6 +23,11 @@
 
 #include "kefir/codegen/target-ir/control_flow.h"
 #include "kefir/codegen/target-ir/numbering.h"
+#include "kefir/core/bitset.h"
+
+// Functions with fewer values propagate liveness per value, larger ones -- via bit set dataflow over the CFG
+#define KEFIR_CODEGEN_TARGET_IR_LIVENESS_DENSE_THRESHOLD 512
+#define KEFIR_CODEGEN_TARGET_IR_LIVENESS_DENSE_MAX_BITS (1ull << 26)
 
 typedef struct kefir_codegen_target_ir_liveness_entry {
     kefir_codegen_target_ir_value_ref_t *content;
@@ -43,6 +48,8 @@ typedef struct kefir_codegen_target_ir_liveness_value_block_ranges {
 typedef struct kefir_codegen_target_ir_block_liveness {
     struct kefir_codegen_target_ir_liveness_entry live_in;
     struct kefir_codegen_target_ir_liveness_entry live_out;
+    struct kefir_bitset live_in_values;
+    struct kefir_bitset live_out_values;
     kefir_bool_t value_liveness_ranges_ready;
     struct kefir_codegen_target_ir_liveness_value_block_ranges value_liveness_ranges;
 } kefir_codegen_target_ir_block_liveness_t;
@@ -56,6 +63,7 @@ typedef struct kefir_codegen_target_ir_liveness {
     struct kefir_codegen_target_ir_numbering numbering;
     struct kefir_codegen_target_ir_block_liveness *blocks;
     struct kefir_hashtable values;
+    kefir_bool_t dense;
 } kefir_codegen_target_ir_liveness_t;
 
 kefir_result_t kefir_codegen_target_ir_liveness_init(struct kefir_codegen_target_ir_liveness *);
@@ -28,6 +28,12 @@ typedef struct kefir_codegen_target_ir_numbering {
     kefir_uint32_t *instruction_seq_nums;
     kefir_size_t block_count;
     kefir_size_t length;
+
+    kefir_codegen_target_ir_value_ref_t *values;
+    kefir_uint32_t *block_value_offsets;
+    kefir_uint32_t *block_value_lengths;
+    kefir_size_t values_length;
+    kefir_size_t values_capacity;
 } kefir_codegen_target_ir_numbering_t;
 
 kefir_result_t kefir_codegen_target_ir_numbering_init(struct kefir_codegen_target_ir_numbering *);
@@ -42,5 +48,10 @@ kefir_result_t kefir_codegen_target_ir_numbering_block_length(const struct kefir
 kefir_result_t kefir_codegen_target_ir_numbering_instruction_seq_index(const struct kefir_codegen_target_ir_numbering *,
                                                                        kefir_codegen_target_ir_instruction_ref_t,
                                                                        kefir_size_t *);
+kefir_result_t kefir_codegen_target_ir_numbering_block_values(const struct kefir_codegen_target_ir_numbering *,
+                                                              kefir_codegen_target_ir_block_ref_t, kefir_size_t *,
+                                                              kefir_size_t *);
+kefir_result_t kefir_codegen_target_ir_numbering_value(const struct kefir_codegen_target_ir_numbering *, kefir_size_t,
+                                                       kefir_codegen_target_ir_value_ref_t *);
 
 #endif
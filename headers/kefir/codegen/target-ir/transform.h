@@ -45,5 +45,8 @@ kefir_result_t kefir_codegen_target_ir_transform_preserve_virtual_regs(struct ke
 kefir_result_t kefir_codegen_target_ir_transform_insert_local_hot_copy(
     struct kefir_mem *, struct kefir_codegen_target_ir_code *, const struct kefir_codegen_target_ir_liveness *,
     const struct kefir_codegen_target_ir_interference *, struct kefir_codegen_target_ir_regalloc *);
+kefir_result_t kefir_codegen_target_ir_transform_split_loop_live_ranges(
+    struct kefir_mem *, struct kefir_codegen_target_ir_code *, const struct kefir_codegen_target_ir_control_flow *,
+    const struct kefir_codegen_target_ir_liveness *, const struct kefir_codegen_target_ir_regalloc *);
 
 #endif
@@ -71,6 +71,9 @@ typedef struct kefir_compiler_context {
     struct kefir_ast_translator_configuration translator_configuration;
     struct kefir_optimizer_configuration optimizer_configuration;
     struct kefir_codegen_configuration codegen_configuration;
+    kefir_codegen_output_kind_t codegen_output_kind;
+    const char *runtime_cache_directory;
+    struct kefir_time_report *time_report;
     struct kefir_parser_scope parser_scope;
     const struct kefir_compiler_extensions *extensions;
     void *extension_payload;
@@ -117,5 +120,7 @@ kefir_result_t kefir_compiler_codegen(struct kefir_mem *, struct kefir_compiler_
                                       FILE *);
 kefir_result_t kefir_compiler_codegen_optimized(struct kefir_mem *, struct kefir_compiler_context *,
                                                 struct kefir_opt_module *, FILE *);
+kefir_result_t kefir_compiler_codegen_streaming(struct kefir_mem *, struct kefir_compiler_context *,
+                                                struct kefir_opt_module *, FILE *);
 
 #endif
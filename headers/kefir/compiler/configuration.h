@@ -45,6 +45,12 @@ typedef enum kefir_compiler_runner_error_report_type {
     KEFIR_COMPILER_RUNNER_ERROR_REPORT_JSON
 } kefir_compiler_runner_error_report_type_t;
 
+typedef enum kefir_compiler_runner_time_report {
+    KEFIR_COMPILER_RUNNER_TIME_REPORT_NONE,
+    KEFIR_COMPILER_RUNNER_TIME_REPORT_TABULAR,
+    KEFIR_COMPILER_RUNNER_TIME_REPORT_JSON
+} kefir_compiler_runner_time_report_t;
+
 typedef enum kefir_compiler_runner_decimal_encoding {
     KEFIR_COMPILER_RUNNER_DECIMAL_ENCODING_DEFAULT,
     KEFIR_COMPILER_RUNNER_DECIMAL_ENCODING_BID,
@@ -55,9 +61,11 @@ typedef struct kefir_compiler_runner_configuration {
     kefir_compiler_runner_action_t action;
     const char *input_filepath;
     const char *output_filepath;
+    const char *output_kind_filepath;
     const char *target_profile;
     const char *source_id;
     kefir_compiler_runner_error_report_type_t error_report_type;
+    kefir_compiler_runner_time_report_t time_report;
     kefir_bool_t debug_info;
     kefir_bool_t skip_preprocessor;
     struct kefir_list include_path;
@@ -90,8 +98,10 @@ typedef struct kefir_compiler_runner_configuration {
     struct {
         kefir_size_t max_inline_depth;
         kefir_size_t max_inlines_per_function;
+        kefir_size_t max_inline_cost;
         kefir_bool_t disable_lowering;
         kefir_bool_t cx_limited_range;
+        kefir_bool_t strict_aliasing;
     } optimizer;
 
     struct {
@@ -135,11 +145,19 @@ typedef struct kefir_compiler_runner_configuration {
         kefir_bool_t omit_frame_pointer;
         kefir_bool_t valgrind_compatible_x87;
         kefir_bool_t imprecise_decimal_bitint_conv;
+        kefir_bool_t integrated_assembler;
+        kefir_bool_t code_layout;
+        kefir_bool_t red_zone;
+        kefir_bool_t shrink_wrap;
+        kefir_bool_t live_range_split;
+        kefir_bool_t inline_memory_builtins;
+        kefir_bool_t streaming;
         kefir_ast_context_tentative_definition_placement_t tentative_definition_placement;
         kefir_ast_declarator_visibility_attr_t symbol_visibility;
         kefir_compiler_runner_decimal_encoding_t decimal_encoding;
         const char *syntax;
         const char *print_details;
+        const char *runtime_cache_directory;
         kefir_codegen_optimization_level_t optimization;
     } codegen;
 } kefir_compiler_runner_configuration_t;
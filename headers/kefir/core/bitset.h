@@ -44,6 +44,8 @@ kefir_result_t kefir_bitset_set_consecutive(const struct kefir_bitset *, kefir_s
 kefir_result_t kefir_bitset_find_consecutive(const struct kefir_bitset *, kefir_bool_t, kefir_size_t, kefir_size_t,
                                              kefir_size_t *);
 kefir_result_t kefir_bitset_clear(const struct kefir_bitset *);
+kefir_result_t kefir_bitset_union(const struct kefir_bitset *, const struct kefir_bitset *, kefir_bool_t *);
+kefir_result_t kefir_bitset_subtract(const struct kefir_bitset *, const struct kefir_bitset *);
 
 kefir_result_t kefir_bitset_length(const struct kefir_bitset *, kefir_size_t *);
 kefir_result_t kefir_bitset_resize(struct kefir_mem *, struct kefir_bitset *, kefir_size_t);
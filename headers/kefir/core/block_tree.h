@@ -59,6 +59,7 @@ kefir_result_t kefir_block_tree_get_block_offset(const struct kefir_block_tree *
                                                  kefir_size_t *);
 kefir_result_t kefir_block_tree_get_block(const struct kefir_block_tree *, kefir_size_t, void **);
 kefir_result_t kefir_block_tree_block(struct kefir_mem *, struct kefir_block_tree *, kefir_size_t, void **);
+kefir_result_t kefir_block_tree_drop_block(struct kefir_mem *, struct kefir_block_tree *, kefir_size_t);
 
 kefir_result_t kefir_block_tree_iter(const struct kefir_block_tree *, struct kefir_block_tree_iterator *);
 kefir_result_t kefir_block_tree_next(struct kefir_block_tree_iterator *);
@@ -37,6 +37,7 @@ typedef enum kefir_driver_assembler_target {
 typedef struct kefir_driver_assembler_configuration {
     kefir_driver_assembler_target_t target;
     kefir_bool_t verbose;
+    kefir_bool_t integrated;
     struct kefir_list arguments;
 } kefir_driver_assembler_configuration_t;
 
@@ -114,6 +115,12 @@ typedef enum kefir_driver_frame_pointer_omission {
     KEFIR_DRIVER_FRAME_POINTER_OMISSION_UNSPECIFIED
 } kefir_driver_frame_pointer_omission_t;
 
+typedef enum kefir_driver_time_report {
+    KEFIR_DRIVER_TIME_REPORT_NONE,
+    KEFIR_DRIVER_TIME_REPORT_TABULAR,
+    KEFIR_DRIVER_TIME_REPORT_JSON
+} kefir_driver_time_report_t;
+
 typedef enum kefir_driver_char_signedness {
     KEFIR_DRIVER_CHAR_SIGNEDNESS_DEFAULT,
     KEFIR_DRIVER_CHAR_SIGNED,
@@ -150,6 +157,7 @@ typedef struct kefir_driver_configuration {
     struct kefir_list include_files;
     struct kefir_driver_target target;
     kefir_c_language_standard_version_t standard_version;
+    kefir_size_t parallel_jobs;
 
     struct {
         kefir_int_t optimization_level;
@@ -183,7 +191,10 @@ typedef struct kefir_driver_configuration {
         kefir_bool_t preprocessor_linemarkers;
         kefir_bool_t fast_math;
         kefir_bool_t cx_limited_range;
+        kefir_bool_t strict_aliasing;
         kefir_bool_t freestanding;
+        kefir_bool_t integrated_assembler;
+        kefir_driver_time_report_t time_report;
     } flags;
 
     struct {
@@ -234,4 +245,6 @@ kefir_result_t kefir_driver_configuration_add_embed_directory(struct kefir_mem *
 kefir_result_t kefir_driver_configuration_add_include_file(struct kefir_mem *, struct kefir_string_pool *,
                                                            struct kefir_driver_configuration *, const char *);
 
+kefir_result_t kefir_driver_parse_parallel_jobs(const char *, kefir_size_t *);
+
 #endif
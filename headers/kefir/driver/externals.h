@@ -36,6 +36,7 @@ typedef struct kefir_driver_external_resources {
 
     // Driver
     kefir_bool_t driver_cli_quiet;
+    kefir_size_t parallel_jobs;
 
     // Tools
     kefir_bool_t assembler_path_explicit;
@@ -44,6 +45,7 @@ typedef struct kefir_driver_external_resources {
 
     // Libraries
     const char *runtime_include;
+    const char *runtime_cache_directory;
 
     struct {
         kefir_bool_t present;
@@ -66,7 +66,8 @@ typedef enum kefir_ir_data_value_type {
     KEFIR_IR_DATA_VALUE_STRING_POINTER,
     KEFIR_IR_DATA_VALUE_RAW,
     KEFIR_IR_DATA_VALUE_AGGREGATE,
-    KEFIR_IR_DATA_VALUE_BITS
+    KEFIR_IR_DATA_VALUE_BITS,
+    KEFIR_IR_DATA_VALUE_PACKED
 } kefir_ir_data_value_type_t;
 
 typedef struct kefir_ir_data_value {
@@ -24,6 +24,7 @@
 #include <stdbool.h>
 #include "kefir/core/basic-types.h"
 #include "kefir/core/util.h"
+#include "kefir/core/hashtreeset.h"
 #include "kefir/ir/type.h"
 #include "kefir/ir/instr.h"
 #include "kefir/ir/debug.h"
@@ -53,10 +54,12 @@ typedef struct kefir_ir_function {
         kefir_bool_t constructor;
         kefir_bool_t destructor;
         kefir_bool_t inline_function;
+        kefir_bool_t no_inline;
         kefir_bool_t enable_fenv_access;
         kefir_bool_t disallow_fp_contract;
         kefir_bool_t cx_limited_range;
     } flags;
+    struct kefir_hashtreeset restrict_parameters;
     struct kefir_ir_function_debug_info debug_info;
 } kefir_ir_function_t;
 
@@ -30,9 +30,34 @@
 
 #define KEFIR_IR_MEMORY_FLAG_NONE 0
 #define KEFIR_IR_MEMORY_FLAG_VOLATILE 1
+#define KEFIR_IR_MEMORY_FLAG_ALIAS_TAG_SHIFT 8
+#define KEFIR_IR_MEMORY_FLAG_ALIAS_TAG_MASK 0xffull
+#define KEFIR_IR_MEMORY_FLAG_ALIAS_TAG(_tag) \
+    ((((kefir_uint64_t) (_tag)) & KEFIR_IR_MEMORY_FLAG_ALIAS_TAG_MASK) << KEFIR_IR_MEMORY_FLAG_ALIAS_TAG_SHIFT)
+#define KEFIR_IR_MEMORY_FLAGS_ALIAS_TAG(_flags)                                               \
+    ((kefir_uint8_t) ((((kefir_uint64_t) (_flags)) >> KEFIR_IR_MEMORY_FLAG_ALIAS_TAG_SHIFT) & \
+                      KEFIR_IR_MEMORY_FLAG_ALIAS_TAG_MASK))
 
 #define KEFIR_IR_MEMORY_ORDER_SEQ_CST 1
 
+// Type-based alias tags of scalar memory accesses. Accesses carrying different non-any tags
+// are assumed not to alias under C effective type rules.
+typedef enum kefir_ir_memory_alias_tag {
+    KEFIR_IR_MEMORY_ALIAS_TAG_ANY = 0,
+    KEFIR_IR_MEMORY_ALIAS_TAG_BOOL,
+    KEFIR_IR_MEMORY_ALIAS_TAG_SHORT,
+    KEFIR_IR_MEMORY_ALIAS_TAG_INT,
+    KEFIR_IR_MEMORY_ALIAS_TAG_LONG,
+    KEFIR_IR_MEMORY_ALIAS_TAG_INT128,
+    KEFIR_IR_MEMORY_ALIAS_TAG_FLOAT,
+    KEFIR_IR_MEMORY_ALIAS_TAG_DOUBLE,
+    KEFIR_IR_MEMORY_ALIAS_TAG_LONG_DOUBLE,
+    KEFIR_IR_MEMORY_ALIAS_TAG_DECIMAL32,
+    KEFIR_IR_MEMORY_ALIAS_TAG_DECIMAL64,
+    KEFIR_IR_MEMORY_ALIAS_TAG_DECIMAL128,
+    KEFIR_IR_MEMORY_ALIAS_TAG_POINTER
+} kefir_ir_memory_alias_tag_t;
+
 enum {
     KEFIR_IR_BRANCH_CONDITION_8BIT,
     KEFIR_IR_BRANCH_CONDITION_16BIT,
@@ -33,7 +33,8 @@
     OPCODE(NULL_REF, "null_ref", none) SEPARATOR \
     OPCODE(VSTACK_POP, "vstack_pop", none) SEPARATOR \
     OPCODE(VSTACK_PICK, "vstack_pick", u64) SEPARATOR \
-    OPCODE(VSTACK_EXCHANGE, "vstack_exchange", u64)
+    OPCODE(VSTACK_EXCHANGE, "vstack_exchange", u64) SEPARATOR \
+    OPCODE(SWITCH_TARGET, "switch_target", u64)
 // clang-format on
 
 #endif
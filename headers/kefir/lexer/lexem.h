@@ -27,6 +27,7 @@
 #include "kefir/core/string_pool.h"
 #include "kefir/core/source_location.h"
 #include "kefir/core/hashtree.h"
+#include "kefir/core/hashtable.h"
 #include "kefir/util/bigint.h"
 #include "kefir/util/dfp.h"
 #include <stdio.h>
@@ -42,6 +43,7 @@ typedef enum kefir_token_class {
     KEFIR_TOKEN_STRING_LITERAL,
     KEFIR_TOKEN_PUNCTUATOR,
     KEFIR_TOKEN_PRAGMA,
+    KEFIR_TOKEN_EMBED,
 
     // Preprocessing tokens
     KEFIR_TOKEN_PP_WHITESPACE,
@@ -328,15 +330,32 @@ typedef struct kefir_token_extension {
     void *payload;
 } kefir_token_extension_t;
 
+typedef struct kefir_token_macro_expansions_pool kefir_token_macro_expansions_pool_t;
+
 typedef struct kefir_token_macro_expansions {
-    struct kefir_hashtree macro_expansions;
+    struct kefir_token_macro_expansions_pool *pool;
+    kefir_size_t refcount;
+    kefir_hashtable_hash_t hash;
+    kefir_size_t length;
+    const char *identifiers[];
 } kefir_token_macro_expansions_t;
 
+typedef struct kefir_token_macro_expansions_pool {
+    struct kefir_hashtable macro_expansions;
+    struct kefir_token_macro_expansions *scratch;
+    kefir_size_t scratch_capacity;
+} kefir_token_macro_expansions_pool_t;
+
 typedef struct kefir_pragma_token {
     kefir_pragma_token_type_t pragma;
     struct kefir_pragma_token_parameter pragma_param;
 } kefir_pragma_token_t;
 
+typedef struct kefir_embed_token {
+    kefir_size_t length;
+    kefir_uint8_t content[];
+} kefir_embed_token_t;
+
 typedef struct kefir_token {
     kefir_token_class_t klass;
     struct kefir_token_macro_expansions *macro_expansions;
@@ -350,6 +369,7 @@ typedef struct kefir_token {
         struct kefir_string_literal_token *string_literal;
         kefir_punctuator_token_t punctuator;
         struct kefir_pragma_token *pragma;
+        struct kefir_embed_token *embed;
         struct kefir_pptoken_pp_whitespace pp_whitespace;
         struct kefir_pptoken_pp_number pp_number;
         struct kefir_pptoken_pp_header_name *pp_header_name;
@@ -359,12 +379,14 @@ typedef struct kefir_token {
     struct kefir_source_location source_location;
 } kefir_token_t;
 
-kefir_result_t kefir_token_macro_expansions_init(struct kefir_token_macro_expansions *);
-kefir_result_t kefir_token_macro_expansions_free(struct kefir_mem *, struct kefir_token_macro_expansions *);
-kefir_result_t kefir_token_macro_expansions_add(struct kefir_mem *, struct kefir_token_macro_expansions **,
-                                                const char *);
-kefir_result_t kefir_token_macro_expansions_merge(struct kefir_mem *, struct kefir_token_macro_expansions **,
-                                                  const struct kefir_token_macro_expansions *);
+kefir_result_t kefir_token_macro_expansions_pool_init(struct kefir_token_macro_expansions_pool *);
+kefir_result_t kefir_token_macro_expansions_pool_free(struct kefir_mem *, struct kefir_token_macro_expansions_pool *);
+kefir_result_t kefir_token_macro_expansions_pool_union(struct kefir_mem *, struct kefir_token_macro_expansions_pool *,
+                                                       const struct kefir_token_macro_expansions *,
+                                                       const struct kefir_token_macro_expansions *, const char *,
+                                                       struct kefir_token_macro_expansions **);
+struct kefir_token_macro_expansions *kefir_token_macro_expansions_retain(struct kefir_token_macro_expansions *);
+kefir_result_t kefir_token_macro_expansions_release(struct kefir_mem *, struct kefir_token_macro_expansions *);
 kefir_bool_t kefir_token_macro_expansions_has(const struct kefir_token_macro_expansions *, const char *);
 
 kefir_result_t kefir_token_new_sentinel(struct kefir_token *);
@@ -432,6 +454,7 @@ kefir_bool_t kefir_token_string_literal_type_concat(kefir_string_literal_token_t
 kefir_result_t kefir_token_new_punctuator(kefir_punctuator_token_t, struct kefir_token *);
 kefir_result_t kefir_token_new_pragma(struct kefir_mem *, kefir_pragma_token_type_t, kefir_pragma_token_parameter_t,
                                       struct kefir_token *);
+kefir_result_t kefir_token_new_embed(struct kefir_mem *, const kefir_uint8_t *, kefir_size_t, struct kefir_token *);
 kefir_result_t kefir_token_new_pp_whitespace(kefir_bool_t, struct kefir_token *);
 kefir_result_t kefir_token_new_pp_number(struct kefir_mem *, const char *, kefir_size_t, struct kefir_token *);
 kefir_result_t kefir_token_new_pp_header_name(struct kefir_mem *, kefir_bool_t, const char *, kefir_size_t,
@@ -27,7 +27,6 @@
 #include "kefir/lexer/source_cursor.h"
 #include "kefir/core/mem.h"
 #include "kefir/core/string_pool.h"
-#include "kefir/core/trie.h"
 #include "kefir/core/list.h"
 #include "kefir/core/string_buffer.h"
 #include "kefir/lexer/context.h"
@@ -53,9 +52,6 @@ typedef struct kefir_lexer {
     kefir_lexer_mode_t mode;
     kefir_c_language_standard_version_t standard_version;
 
-    struct kefir_trie punctuators;
-    struct kefir_trie keywords;
-
     const struct kefir_lexer_extensions *extensions;
     void *extension_payload;
 } kefir_lexer_t;
@@ -74,14 +70,13 @@ kefir_result_t kefir_lexer_cursor_match_whitespace(struct kefir_mem *, struct ke
 kefir_result_t kefir_lexer_cursor_next_universal_character(struct kefir_lexer_source_cursor *, kefir_char32_t *);
 kefir_result_t kefir_lexer_cursor_next_escape_sequence(struct kefir_lexer_source_cursor *, kefir_char32_t *);
 
-kefir_result_t kefir_lexer_init_punctuators(struct kefir_mem *, struct kefir_lexer *);
 kefir_result_t kefir_lexer_match_punctuator(struct kefir_mem *, struct kefir_lexer *, struct kefir_token *);
 
-kefir_result_t kefir_lexer_init_keywords(struct kefir_mem *, struct kefir_lexer *);
-kefir_result_t kefir_lexer_get_keyword(const struct kefir_trie *, const kefir_char32_t *, kefir_keyword_token_t *);
+kefir_result_t kefir_lexer_get_keyword(kefir_c_language_standard_version_t, const kefir_char32_t *,
+                                       kefir_keyword_token_t *);
 kefir_result_t kefir_lexer_scan_identifier_or_keyword(struct kefir_mem *, struct kefir_lexer_source_cursor *,
-                                                      kefir_lexer_mode_t, struct kefir_string_pool *,
-                                                      const struct kefir_trie *, struct kefir_token *);
+                                                      kefir_lexer_mode_t, struct kefir_string_pool *, kefir_bool_t,
+                                                      kefir_c_language_standard_version_t, struct kefir_token *);
 kefir_result_t kefir_lexer_match_identifier_or_keyword(struct kefir_mem *, struct kefir_lexer *, struct kefir_token *);
 kefir_result_t kefir_lexer_match_identifier(struct kefir_mem *, struct kefir_lexer *, struct kefir_token *);
 
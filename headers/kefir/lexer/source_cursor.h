@@ -66,6 +66,18 @@ kefir_result_t kefir_lexer_source_cursor_save(const struct kefir_lexer_source_cu
                                               struct kefir_lexer_source_cursor_state *);
 kefir_result_t kefir_lexer_source_cursor_restore(struct kefir_lexer_source_cursor *,
                                                  const struct kefir_lexer_source_cursor_state *);
+typedef enum kefir_lexer_source_cursor_ascii_class {
+    KEFIR_LEXER_SOURCE_CURSOR_ASCII_IDENTIFIER,
+    KEFIR_LEXER_SOURCE_CURSOR_ASCII_HORIZONTAL_WHITESPACE
+} kefir_lexer_source_cursor_ascii_class_t;
+
+kefir_result_t kefir_lexer_source_cursor_consume_ascii_run(struct kefir_lexer_source_cursor *,
+                                                           kefir_lexer_source_cursor_ascii_class_t, kefir_char32_t *,
+                                                           kefir_size_t, kefir_size_t *);
+kefir_size_t kefir_lexer_source_cursor_find_ascii(const struct kefir_lexer_source_cursor *, const char *);
+kefir_bool_t kefir_lexer_source_cursor_ascii_contains(const struct kefir_lexer_source_cursor *, kefir_size_t,
+                                                     const char *);
+
 kefir_result_t kefir_lexer_cursor_match_string(const struct kefir_lexer_source_cursor *, const kefir_char32_t *);
 
 kefir_result_t kefir_lexer_cursor_set_source_location(struct kefir_lexer_source_cursor *,
@@ -32,5 +32,7 @@ kefir_result_t kefir_opt_code_may_alias(const struct kefir_opt_code_container *,
 kefir_result_t kefir_opt_code_must_alias(const struct kefir_opt_code_container *, const struct kefir_ir_module *,
                                          kefir_opt_instruction_ref_t, kefir_size_t, kefir_int64_t,
                                          kefir_opt_instruction_ref_t, kefir_size_t, kefir_int64_t, kefir_bool_t *);
+kefir_result_t kefir_opt_code_may_alias_by_type(const struct kefir_opt_instruction *,
+                                                const struct kefir_opt_instruction *, kefir_bool_t *);
 
 #endif
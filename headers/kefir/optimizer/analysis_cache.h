@@ -0,0 +1,59 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef KEFIR_OPTIMIZER_ANALYSIS_CACHE_H_
+#define KEFIR_OPTIMIZER_ANALYSIS_CACHE_H_
+
+#include "kefir/optimizer/control_flow.h"
+#include "kefir/optimizer/liveness.h"
+
+// Analysis results are stamped with code container revisions at construction time and rebuilt lazily once the
+// container has been mutated in a way that affects them
+typedef struct kefir_opt_code_analysis_revision {
+    kefir_bool_t valid;
+    kefir_size_t code;
+    kefir_size_t control_flow;
+} kefir_opt_code_analysis_revision_t;
+
+typedef struct kefir_opt_code_analysis_cache {
+    const struct kefir_opt_code_container *code;
+
+    struct {
+        struct kefir_opt_code_analysis_revision revision;
+        struct kefir_opt_code_control_flow control_flow;
+    } control_flow;
+
+    struct {
+        struct kefir_opt_code_analysis_revision revision;
+        struct kefir_opt_code_liveness liveness;
+    } liveness;
+} kefir_opt_code_analysis_cache_t;
+
+kefir_result_t kefir_opt_code_analysis_cache_init(struct kefir_opt_code_analysis_cache *,
+                                                  const struct kefir_opt_code_container *);
+kefir_result_t kefir_opt_code_analysis_cache_free(struct kefir_mem *, struct kefir_opt_code_analysis_cache *);
+kefir_result_t kefir_opt_code_analysis_cache_invalidate(struct kefir_opt_code_analysis_cache *);
+
+kefir_result_t kefir_opt_code_analysis_cache_control_flow(struct kefir_mem *, struct kefir_opt_code_analysis_cache *,
+                                                          struct kefir_opt_code_control_flow **);
+kefir_result_t kefir_opt_code_analysis_cache_liveness(struct kefir_mem *, struct kefir_opt_code_analysis_cache *,
+                                                      struct kefir_opt_code_liveness **);
+
+#endif
@@ -47,6 +47,10 @@ kefir_result_t kefir_opt_code_builder_finalize_branch_compare(struct kefir_mem *
                                                               kefir_opt_instruction_ref_t, kefir_opt_instruction_ref_t,
                                                               kefir_opt_block_id_t, kefir_opt_block_id_t,
                                                               kefir_opt_instruction_ref_t *);
+kefir_result_t kefir_opt_code_builder_finalize_switch(struct kefir_mem *, struct kefir_opt_code_container *,
+                                                      kefir_opt_block_id_t, kefir_opt_instruction_ref_t,
+                                                      kefir_opt_block_id_t, kefir_opt_switch_table_id_t,
+                                                      kefir_opt_instruction_ref_t *);
 kefir_result_t kefir_opt_code_builder_finalize_return(struct kefir_mem *, struct kefir_opt_code_container *,
                                                       kefir_opt_block_id_t, kefir_opt_instruction_ref_t,
                                                       kefir_opt_instruction_ref_t *);
@@ -54,7 +58,8 @@ kefir_result_t kefir_opt_code_builder_finalize_unreachable(struct kefir_mem *, s
                                                            kefir_opt_block_id_t, kefir_opt_instruction_ref_t *);
 
 kefir_result_t kefir_opt_code_builder_get_argument(struct kefir_mem *, struct kefir_opt_code_container *,
-                                                   kefir_opt_block_id_t, kefir_size_t, kefir_opt_instruction_ref_t *);
+                                                   kefir_opt_block_id_t, kefir_size_t, kefir_bool_t,
+                                                   kefir_opt_instruction_ref_t *);
 kefir_result_t kefir_opt_code_builder_local_lifetime_mark(struct kefir_mem *, struct kefir_opt_code_container *,
                                                           kefir_opt_block_id_t, kefir_opt_instruction_ref_t,
                                                           kefir_opt_instruction_ref_t *);
@@ -40,6 +40,7 @@ typedef kefir_id_t kefir_opt_instruction_ref_t;
 typedef kefir_id_t kefir_opt_phi_id_t;
 typedef kefir_id_t kefir_opt_call_id_t;
 typedef kefir_id_t kefir_opt_inline_assembly_id_t;
+typedef kefir_id_t kefir_opt_switch_table_id_t;
 
 typedef enum kefir_opt_memory_load_extension {
     KEFIR_OPT_MEMORY_LOAD_NOEXTEND,
@@ -50,6 +51,7 @@ typedef enum kefir_opt_memory_load_extension {
 typedef struct kefir_opt_memory_access_flags {
     kefir_opt_memory_load_extension_t load_extension;
     kefir_bool_t volatile_access;
+    kefir_uint8_t alias_tag;
 } kefir_opt_memory_access_flags_t;
 
 typedef enum kefir_opt_memory_order {
@@ -198,6 +200,10 @@ typedef struct kefir_opt_operation_parameters {
         kefir_opt_inline_assembly_id_t inline_asm_ref;
         kefir_size_t index;
         kefir_size_t index_pair[2];
+        struct {
+            kefir_size_t index;
+            kefir_bool_t restrict_pointer;
+        } argument;
         struct {
             kefir_size_t bitwidth;
             union {
@@ -237,6 +243,8 @@ typedef struct kefir_opt_operation_parameters {
                 struct {
                     kefir_opt_comparison_operation_t operation;
                 } comparison;
+
+                kefir_opt_switch_table_id_t switch_table_ref;
             };
         } branch;
 
@@ -292,6 +300,17 @@ typedef struct kefir_opt_instruction_link {
     kefir_opt_instruction_ref_t next;
 } kefir_opt_instruction_link_t;
 
+#define KEFIR_OPT_INSTRUCTION_USES_INLINE_CAPACITY 2
+
+typedef struct kefir_opt_instruction_uses {
+    kefir_uint32_t length;
+    kefir_uint32_t capacity;
+    union {
+        kefir_opt_instruction_ref_t inline_refs[KEFIR_OPT_INSTRUCTION_USES_INLINE_CAPACITY];
+        kefir_opt_instruction_ref_t *refs;
+    };
+} kefir_opt_instruction_uses_t;
+
 typedef struct kefir_opt_instruction {
     kefir_opt_instruction_ref_t id;
     kefir_opt_block_id_t block_id;
@@ -300,9 +319,7 @@ typedef struct kefir_opt_instruction {
     struct kefir_opt_instruction_link siblings;
     struct kefir_opt_instruction_link control_flow;
 
-    struct {
-        struct kefir_hashtreeset instruction;
-    } uses;
+    struct kefir_opt_instruction_uses uses;
 } kefir_opt_instruction_t;
 
 typedef struct kefir_opt_code_instruction_list {
@@ -386,6 +403,12 @@ typedef struct kefir_opt_inline_assembly_node {
     } siblings;
 } kefir_opt_inline_assembly_node_t;
 
+typedef struct kefir_opt_switch_table {
+    kefir_opt_switch_table_id_t node_id;
+    kefir_size_t length;
+    kefir_opt_block_id_t *targets;
+} kefir_opt_switch_table_t;
+
 typedef struct kefir_opt_code_event_listener {
     kefir_result_t (*on_new_instruction)(struct kefir_mem *, const struct kefir_opt_code_container *,
                                          kefir_opt_instruction_ref_t, void *);
@@ -415,9 +438,18 @@ typedef struct kefir_opt_code_container {
     struct kefir_hashtree inline_assembly;
     kefir_opt_call_id_t next_inline_assembly_id;
 
+    struct kefir_hashtree switch_tables;
+    kefir_opt_switch_table_id_t next_switch_table_id;
+
     kefir_opt_block_id_t entry_point;
     kefir_opt_block_id_t gate_block;
 
+    struct {
+        kefir_size_t code;
+        kefir_size_t control_flow;
+        kefir_bool_t has_block_labels;
+    } revision;
+
     const struct kefir_opt_code_event_listener *event_listener;
 } kefir_opt_code_container_t;
 
@@ -526,6 +558,14 @@ kefir_result_t kefir_opt_code_container_inline_assembly_jump_target(const struct
                                                                     kefir_opt_instruction_ref_t, kefir_id_t,
                                                                     kefir_opt_block_id_t *);
 
+kefir_result_t kefir_opt_code_container_new_switch_table(struct kefir_mem *, struct kefir_opt_code_container *,
+                                                        kefir_size_t, kefir_opt_switch_table_id_t *);
+kefir_result_t kefir_opt_code_container_switch_table(const struct kefir_opt_code_container *,
+                                                    kefir_opt_switch_table_id_t, const struct kefir_opt_switch_table **);
+kefir_result_t kefir_opt_code_container_switch_table_set_target(const struct kefir_opt_code_container *,
+                                                               kefir_opt_switch_table_id_t, kefir_size_t,
+                                                               kefir_opt_block_id_t);
+
 kefir_result_t kefir_opt_code_block_instr_head(const struct kefir_opt_code_container *, kefir_opt_block_id_t,
                                                kefir_opt_instruction_ref_t *);
 kefir_result_t kefir_opt_code_block_instr_tail(const struct kefir_opt_code_container *, kefir_opt_block_id_t,
@@ -598,7 +638,8 @@ kefir_result_t kefir_opt_phi_node_link_next(struct kefir_opt_phi_node_link_itera
                                             kefir_opt_instruction_ref_t *);
 
 typedef struct kefir_opt_instruction_use_iterator {
-    struct kefir_hashtreeset_iterator iter;
+    const struct kefir_opt_code_container *code;
+    kefir_opt_instruction_ref_t instr_ref;
     kefir_opt_instruction_ref_t use_instr_ref;
 } kefir_opt_instruction_use_iterator_t;
 
@@ -23,6 +23,7 @@
 
 #include "kefir/optimizer/code.h"
 #include "kefir/optimizer/control_flow.h"
+#include "kefir/optimizer/analysis_cache.h"
 #include "kefir/optimizer/sequencing.h"
 #include "kefir/optimizer/debug.h"
 
@@ -51,7 +52,7 @@ kefir_result_t kefir_opt_code_block_redirect_phi_links(struct kefir_mem *, struc
                                                        kefir_opt_block_id_t);
 kefir_result_t kefir_opt_code_split_block_after(struct kefir_mem *, struct kefir_opt_code_container *,
                                                 struct kefir_opt_code_debug_info *,
-                                                struct kefir_opt_code_control_flow *,
+                                                struct kefir_opt_code_analysis_cache *,
                                                 struct kefir_opt_code_sequencing *, kefir_opt_instruction_ref_t,
                                                 kefir_opt_block_id_t *);
 
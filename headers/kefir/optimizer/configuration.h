@@ -24,6 +24,7 @@
 #include "kefir/optimizer/pipeline.h"
 #include "kefir/ir/platform.h"
 #include "kefir/core/data_model.h"
+#include "kefir/platform/time_report.h"
 
 typedef struct kefir_optimizer_configuration {
     struct kefir_optimizer_pipeline pipeline;
@@ -31,10 +32,12 @@ typedef struct kefir_optimizer_configuration {
     kefir_bool_t debug_info;
     kefir_size_t max_inline_depth;
     kefir_size_t max_inlines_per_function;
+    kefir_size_t max_inline_cost;
     kefir_size_t imprecise_decimal_bitint_conv;
     kefir_data_model_decimal_encoding_t decimal_encoding;
     const struct kefir_optimizer_target_lowering *target_lowering;
     const struct kefir_ir_target_platform *target_platform;
+    struct kefir_time_report *time_report;
 } kefir_optimizer_configuration_t;
 
 kefir_result_t kefir_optimizer_configuration_init(struct kefir_optimizer_configuration *,
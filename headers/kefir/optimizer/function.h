@@ -22,6 +22,7 @@
 #define KEFIR_OPTIMIZER_FUNCTION_H_
 
 #include "kefir/optimizer/code.h"
+#include "kefir/optimizer/analysis_cache.h"
 #include "kefir/optimizer/debug.h"
 #include "kefir/optimizer/type.h"
 #include "kefir/ir/function.h"
@@ -31,6 +32,7 @@ typedef struct kefir_opt_module kefir_opt_module_t;  // Forward declaration
 typedef struct kefir_opt_function {
     const struct kefir_ir_function *ir_func;
     struct kefir_opt_code_container code;
+    struct kefir_opt_code_analysis_cache analysis;
     struct kefir_opt_code_debug_info debug_info;
     struct {
         kefir_size_t ir_code_length;
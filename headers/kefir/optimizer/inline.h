@@ -29,12 +29,16 @@
 typedef struct kefir_opt_try_inline_function_call_parameters {
     kefir_size_t max_inline_depth;
     kefir_size_t max_inlines_per_function;
+    kefir_size_t max_inline_cost;
+    kefir_size_t call_site_loop_depth;
+    const struct kefir_hashtree *external_call_sites;
 } kefir_opt_try_inline_function_call_parameters_t;
 
 kefir_result_t kefir_opt_try_inline_function_call(struct kefir_mem *, const struct kefir_opt_module *,
-                                                  struct kefir_opt_function *, struct kefir_opt_code_control_flow *,
-                                                  struct kefir_opt_code_sequencing *,
+                                                  struct kefir_opt_function *, struct kefir_opt_code_sequencing *,
                                                   const struct kefir_opt_try_inline_function_call_parameters *,
                                                   kefir_opt_instruction_ref_t, kefir_bool_t *);
+kefir_result_t kefir_opt_inline_collect_call_sites(struct kefir_mem *, const struct kefir_opt_module *,
+                                                   const struct kefir_opt_function *, struct kefir_hashtree *);
 
 #endif
@@ -23,6 +23,12 @@
 
 #include "kefir/optimizer/control_flow.h"
 #include "kefir/core/hashset.h"
+#include "kefir/core/bitset.h"
+
+// Liveness of functions with fewer traced instructions is computed over sparse per-block hash sets, larger ones are
+// processed with dense bit sets
+#define KEFIR_OPT_CODE_LIVENESS_DENSE_THRESHOLD 512
+#define KEFIR_OPT_CODE_LIVENESS_DENSE_MAX_BITS (1ull << 28)
 
 typedef struct kefir_opt_code_liveness_block {
     struct kefir_hashset alive_instr;
@@ -43,5 +49,18 @@ kefir_result_t kefir_opt_code_liveness_build(struct kefir_mem *, struct kefir_op
 
 kefir_result_t kefir_opt_code_liveness_instruction_is_alive(const struct kefir_opt_code_liveness *,
                                                             kefir_opt_instruction_ref_t, kefir_bool_t *);
+kefir_result_t kefir_opt_code_liveness_instruction_is_alive_in_block(const struct kefir_opt_code_liveness *,
+                                                                     kefir_opt_block_id_t, kefir_opt_instruction_ref_t,
+                                                                     kefir_bool_t *);
+
+typedef struct kefir_opt_code_liveness_block_iterator {
+    struct kefir_hashset_iterator iter;
+} kefir_opt_code_liveness_block_iterator_t;
+
+kefir_result_t kefir_opt_code_liveness_block_iter(const struct kefir_opt_code_liveness *,
+                                                  struct kefir_opt_code_liveness_block_iterator *,
+                                                  kefir_opt_block_id_t, kefir_opt_instruction_ref_t *);
+kefir_result_t kefir_opt_code_liveness_block_next(struct kefir_opt_code_liveness_block_iterator *,
+                                                  kefir_opt_instruction_ref_t *);
 
 #endif
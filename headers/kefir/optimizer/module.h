@@ -36,6 +36,11 @@ typedef struct kefir_opt_module {
 kefir_result_t kefir_opt_module_init(struct kefir_mem *, struct kefir_ir_module *, struct kefir_opt_module *);
 kefir_result_t kefir_opt_module_construct(struct kefir_mem *, const struct kefir_ir_target_platform *,
                                           struct kefir_opt_module *);
+kefir_result_t kefir_opt_module_construct_types(struct kefir_mem *, const struct kefir_ir_target_platform *,
+                                                struct kefir_opt_module *);
+kefir_result_t kefir_opt_module_construct_function(struct kefir_mem *, struct kefir_opt_module *,
+                                                   const struct kefir_ir_function *, struct kefir_opt_function **);
+kefir_result_t kefir_opt_module_drop_function(struct kefir_mem *, struct kefir_opt_module *, kefir_id_t);
 kefir_result_t kefir_opt_module_free(struct kefir_mem *, struct kefir_opt_module *);
 
 kefir_result_t kefir_opt_module_get_type(const struct kefir_opt_module *, kefir_id_t,
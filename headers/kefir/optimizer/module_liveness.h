@@ -23,9 +23,16 @@
 
 #include "kefir/optimizer/module.h"
 
+typedef struct kefir_opt_module_liveness_function_summary {
+    struct kefir_hashtreeset symbols;
+    struct kefir_hashtreeset string_literals;
+} kefir_opt_module_liveness_function_summary_t;
+
 typedef struct kefir_opt_module_liveness {
     struct kefir_hashtreeset symbols;
     struct kefir_hashtreeset string_literals;
+    struct kefir_hashtree function_summaries;
+    struct kefir_hashtreeset roots;
 } kefir_opt_module_liveness_t;
 
 kefir_result_t kefir_opt_module_liveness_init(struct kefir_opt_module_liveness *);
@@ -34,6 +41,13 @@ kefir_result_t kefir_opt_module_liveness_free(struct kefir_mem *, struct kefir_o
 kefir_result_t kefir_opt_module_liveness_trace(struct kefir_mem *, struct kefir_opt_module_liveness *,
                                                const struct kefir_opt_module *);
 
+kefir_result_t kefir_opt_module_liveness_summarize_function(struct kefir_mem *, struct kefir_opt_module_liveness *,
+                                                            const struct kefir_opt_module *,
+                                                            const struct kefir_opt_function *);
+kefir_result_t kefir_opt_module_liveness_function_summary(const struct kefir_opt_module_liveness *, const char *,
+                                                          const struct kefir_opt_module_liveness_function_summary **);
+kefir_result_t kefir_opt_module_liveness_add_root(struct kefir_mem *, struct kefir_opt_module_liveness *, const char *);
+
 kefir_bool_t kefir_opt_module_is_symbol_alive(const struct kefir_opt_module_liveness *, const char *);
 kefir_bool_t kefir_opt_module_is_string_literal_alive(const struct kefir_opt_module_liveness *, kefir_id_t);
 
@@ -0,0 +1,63 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef KEFIR_OPTIMIZER_MODULE_STREAM_H_
+#define KEFIR_OPTIMIZER_MODULE_STREAM_H_
+
+#include "kefir/optimizer/module_liveness.h"
+#include "kefir/core/list.h"
+
+typedef struct kefir_opt_module_stream_function {
+    const struct kefir_ir_function *ir_func;
+    kefir_size_t pending_callers;
+    kefir_bool_t pinned;
+    kefir_bool_t constructed;
+    kefir_bool_t ready;
+    kefir_bool_t dead;
+    struct kefir_hashtreeset callers;
+    struct kefir_hashtreeset callees;
+} kefir_opt_module_stream_function_t;
+
+typedef struct kefir_opt_module_stream {
+    const struct kefir_ir_module *ir_module;
+    struct kefir_opt_module_liveness ir_liveness;
+    struct kefir_hashtree functions;
+    struct kefir_list construction_queue;
+    struct kefir_list ready_queue;
+} kefir_opt_module_stream_t;
+
+kefir_result_t kefir_opt_module_stream_init(struct kefir_mem *, struct kefir_opt_module_stream *,
+                                            const struct kefir_ir_module *);
+kefir_result_t kefir_opt_module_stream_free(struct kefir_mem *, struct kefir_opt_module_stream *);
+
+kefir_result_t kefir_opt_module_stream_next_construction(struct kefir_mem *, struct kefir_opt_module_stream *,
+                                                         const struct kefir_ir_function **);
+kefir_result_t kefir_opt_module_stream_constructed(struct kefir_mem *, struct kefir_opt_module_stream *,
+                                                   const struct kefir_ir_function *);
+kefir_result_t kefir_opt_module_stream_next_ready(struct kefir_mem *, struct kefir_opt_module_stream *,
+                                                  const struct kefir_ir_function **);
+
+kefir_result_t kefir_opt_module_stream_is_alive(const struct kefir_opt_module_stream *,
+                                                const struct kefir_opt_module_liveness *,
+                                                const struct kefir_ir_function *, kefir_bool_t *);
+kefir_result_t kefir_opt_module_stream_mark_dead(struct kefir_opt_module_stream *, const struct kefir_ir_function *);
+
+#endif
@@ -40,6 +40,7 @@
     OPCODE(IJUMP, "indirect_jump", branch) SEPARATOR \
     OPCODE(BRANCH, "branch", branch) SEPARATOR \
     OPCODE(BRANCH_COMPARE, "branch_compare", branch_compare) SEPARATOR \
+    OPCODE(SWITCH, "switch", switch) SEPARATOR \
     OPCODE(RETURN, "return", ref1) SEPARATOR \
     OPCODE(UNREACHABLE, "unreachable", none) SEPARATOR \
     OPCODE(INVOKE, "invoke", call_ref) SEPARATOR \
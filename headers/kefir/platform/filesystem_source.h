@@ -25,6 +25,7 @@
 #include "kefir/core/list.h"
 #include "kefir/core/string_pool.h"
 #include "kefir/core/hashtreeset.h"
+#include "kefir/core/hashtable.h"
 
 typedef struct kefir_preprocessor_filesystem_source_locator {
     struct kefir_preprocessor_source_locator locator;
@@ -33,6 +34,10 @@ typedef struct kefir_preprocessor_filesystem_source_locator {
     struct kefir_hashtreeset include_root_set;
     struct kefir_hashtreeset embed_root_set;
     struct kefir_string_pool *symbols;
+
+    struct kefir_string_pool cache_strings;
+    struct kefir_hashtable include_resolutions;
+    struct kefir_hashtable directory_listings;
 } kefir_preprocessor_filesystem_source_locator_t;
 
 kefir_result_t kefir_preprocessor_filesystem_source_locator_init(struct kefir_preprocessor_filesystem_source_locator *,
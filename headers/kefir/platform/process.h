@@ -44,6 +44,7 @@ typedef struct kefir_process {
 kefir_result_t kefir_process_init(struct kefir_process *);
 kefir_result_t kefir_process_close(struct kefir_process *);
 kefir_result_t kefir_process_wait(struct kefir_process *);
+kefir_result_t kefir_process_wait_any(struct kefir_process *const *, kefir_size_t, kefir_size_t *);
 kefir_result_t kefir_process_kill(struct kefir_process *);
 
 kefir_result_t kefir_process_run(struct kefir_process *, int (*)(void *), void *);
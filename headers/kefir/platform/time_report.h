@@ -0,0 +1,100 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef KEFIR_PLATFORM_TIME_REPORT_H_
+#define KEFIR_PLATFORM_TIME_REPORT_H_
+
+#include "kefir/core/basic-types.h"
+#include "kefir/core/mem.h"
+#include "kefir/core/list.h"
+#include "kefir/core/hashtree.h"
+#include "kefir/core/string_pool.h"
+#include "kefir/util/json.h"
+#include <stdio.h>
+
+typedef enum kefir_time_report_category {
+    KEFIR_TIME_REPORT_PHASE,
+    KEFIR_TIME_REPORT_OPTIMIZER_PASS,
+    KEFIR_TIME_REPORT_CODEGEN_STAGE
+} kefir_time_report_category_t;
+
+typedef struct kefir_time_report_metrics {
+    kefir_uint64_t wall_time_ns;
+    kefir_uint64_t cpu_time_ns;
+    kefir_size_t allocations;
+    kefir_size_t allocated_bytes;
+    kefir_size_t peak_bytes;
+} kefir_time_report_metrics_t;
+
+typedef struct kefir_time_report_entry {
+    kefir_time_report_category_t category;
+    const char *name;
+    struct kefir_time_report_metrics metrics;
+} kefir_time_report_entry_t;
+
+typedef struct kefir_time_report_function {
+    const char *name;
+    struct kefir_list entries;
+} kefir_time_report_function_t;
+
+typedef struct kefir_time_report_span {
+    kefir_uint64_t wall_time_ns;
+    kefir_uint64_t cpu_time_ns;
+    kefir_size_t allocations;
+    kefir_size_t allocated_bytes;
+    kefir_size_t live_bytes;
+    kefir_size_t watermark;
+} kefir_time_report_span_t;
+
+// Time report wraps an underlying memory allocator and accounts every allocation performed through the wrapper
+// (available as the allocator field). Measurements are taken between matching begin/end calls; spans may nest, in
+// which case peak memory of a span is the maximum amount of live memory above its starting level. Report bookkeeping
+// itself is allocated from the underlying allocator and is not accounted. Begin/end calls on NULL report are no-ops.
+typedef struct kefir_time_report {
+    struct kefir_mem allocator;
+    struct kefir_mem *underlying_mem;
+
+    struct {
+        kefir_size_t allocations;
+        kefir_size_t allocated_bytes;
+        kefir_size_t live_bytes;
+        kefir_size_t peak_live_bytes;
+        kefir_size_t watermark;
+    } memory;
+
+    struct kefir_time_report_span total;
+    struct kefir_string_pool names;
+    struct kefir_list entries;
+    struct kefir_list functions;
+    struct kefir_hashtree function_index;
+} kefir_time_report_t;
+
+kefir_result_t kefir_time_report_init(struct kefir_mem *, struct kefir_time_report *);
+kefir_result_t kefir_time_report_free(struct kefir_mem *, struct kefir_time_report *);
+
+kefir_result_t kefir_time_report_begin(struct kefir_time_report *, struct kefir_time_report_span *);
+kefir_result_t kefir_time_report_end(struct kefir_time_report *, const struct kefir_time_report_span *,
+                                     kefir_time_report_category_t, const char *, const char *);
+
+kefir_result_t kefir_time_report_format(const struct kefir_time_report *, FILE *);
+kefir_result_t kefir_time_report_format_json(const struct kefir_time_report *, struct kefir_json_output *);
+
+#endif
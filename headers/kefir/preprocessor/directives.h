@@ -63,6 +63,14 @@ typedef struct kefir_preprocessor_ifdef_directive {
     const char *identifier;
 } kefir_preprocessor_ifdef_directive_t;
 
+typedef struct kefir_preprocessor_deferred_replacement {
+    kefir_bool_t pending;
+    const char *content;
+    kefir_size_t length;
+    struct kefir_lexer_source_cursor_state cursor_state;
+    struct kefir_token_allocator *token_allocator;
+} kefir_preprocessor_deferred_replacement_t;
+
 typedef struct kefir_preprocessor_define_directive {
     kefir_bool_t object;
     const char *identifier;
@@ -70,6 +78,7 @@ typedef struct kefir_preprocessor_define_directive {
     kefir_bool_t vararg;
     const char *vararg_parameter;
     struct kefir_token_buffer replacement;
+    struct kefir_preprocessor_deferred_replacement deferred_replacement;
 } kefir_preprocessor_define_directive_t;
 
 typedef struct kefir_preprocessor_undef_directive {
@@ -128,4 +137,8 @@ kefir_result_t kefir_preprocessor_directive_scanner_next(struct kefir_mem *,
                                                          struct kefir_preprocessor_directive *);
 kefir_result_t kefir_preprocessor_directive_free(struct kefir_mem *, struct kefir_preprocessor_directive *);
 
+kefir_result_t kefir_preprocessor_deferred_replacement_load(struct kefir_mem *, struct kefir_lexer *,
+                                                            struct kefir_preprocessor_deferred_replacement *,
+                                                            struct kefir_token_buffer *);
+
 #endif
@@ -103,6 +103,8 @@ typedef struct kefir_preprocessor_context {
     struct kefir_preprocessor_user_macro_scope user_macros;
     struct kefir_hashtree undefined_macros;
     struct kefir_hashtreeset include_once;
+    struct kefir_hashtree include_guards;
+    struct kefir_token_macro_expansions_pool macro_expansions;
     const struct kefir_preprocessor_source_locator *source_locator;
     struct kefir_ast_context *ast_context;
     const struct kefir_preprocessor_configuration *preprocessor_config;
@@ -111,6 +113,7 @@ typedef struct kefir_preprocessor_context {
     const struct kefir_preprocessor_context_extensions *extensions;
     struct kefir_parser_scope *parser_scope;
     FILE *warning_output;
+    kefir_bool_t defer_macro_replacement;
     struct {
         kefir_uint_t counter;
     } state;
@@ -128,6 +131,13 @@ typedef enum kefir_preprocessor_mode {
     KEFIR_PREPROCESSOR_MODE_MINIMAL
 } kefir_preprocessor_mode_t;
 
+typedef enum kefir_preprocessor_include_guard_state {
+    KEFIR_PREPROCESSOR_INCLUDE_GUARD_START,
+    KEFIR_PREPROCESSOR_INCLUDE_GUARD_OPEN,
+    KEFIR_PREPROCESSOR_INCLUDE_GUARD_CLOSED,
+    KEFIR_PREPROCESSOR_INCLUDE_GUARD_NONE
+} kefir_preprocessor_include_guard_state_t;
+
 typedef struct kefir_preprocessor {
     const struct kefir_preprocessor_source_file_info *current_file;
     struct kefir_lexer lexer;
@@ -140,6 +150,10 @@ typedef struct kefir_preprocessor {
     const struct kefir_preprocessor *parent;
     const struct kefir_preprocessor_extensions *extensions;
     kefir_preprocessor_mode_t mode;
+    struct {
+        kefir_preprocessor_include_guard_state_t state;
+        const char *macro;
+    } include_guard;
     void *extension_payload;
 } kefir_preprocessor_t;
 
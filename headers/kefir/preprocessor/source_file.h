@@ -42,6 +42,8 @@ typedef struct kefir_preprocessor_embed_file {
     struct kefir_preprocessor_source_file_info info;
     kefir_result_t (*read_next)(struct kefir_mem *, struct kefir_preprocessor_embed_file *, kefir_uint8_t *,
                                 kefir_bool_t *);
+    kefir_result_t (*read_bulk)(struct kefir_mem *, struct kefir_preprocessor_embed_file *, kefir_size_t,
+                                const kefir_uint8_t **, kefir_size_t *);
     kefir_result_t (*close)(struct kefir_mem *, struct kefir_preprocessor_embed_file *);
     void *payload;
 } kefir_preprocessor_embed_file_t;
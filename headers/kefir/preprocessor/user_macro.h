@@ -22,6 +22,7 @@
 #define KEFIR_PREPROCESSOR_USER_MACRO_H_
 
 #include "kefir/preprocessor/macro.h"
+#include "kefir/preprocessor/directives.h"
 #include "kefir/core/hashtreeset.h"
 
 typedef struct kefir_preprocessor_user_macro {
@@ -30,6 +31,7 @@ typedef struct kefir_preprocessor_user_macro {
     kefir_bool_t vararg;
     const char *vararg_parameter;
     struct kefir_token_buffer replacement;
+    struct kefir_preprocessor_deferred_replacement deferred_replacement;
 } kefir_preprocessor_user_macro_t;
 
 struct kefir_preprocessor_user_macro *kefir_preprocessor_user_macro_new_object(struct kefir_mem *,
@@ -39,6 +41,8 @@ struct kefir_preprocessor_user_macro *kefir_preprocessor_user_macro_new_function
                                                                                  struct kefir_string_pool *,
                                                                                  const char *);
 kefir_result_t kefir_preprocessor_user_macro_free(struct kefir_mem *, struct kefir_preprocessor_user_macro *);
+kefir_result_t kefir_preprocessor_user_macro_load_replacement(struct kefir_mem *, struct kefir_lexer *,
+                                                              struct kefir_preprocessor_user_macro *);
 
 typedef struct kefir_preprocessor_user_macro_scope {
     struct kefir_preprocessor_macro_scope scope;
@@ -59,5 +63,7 @@ kefir_result_t kefir_preprocessor_user_macro_scope_at(const struct kefir_preproc
 kefir_bool_t kefir_preprocessor_user_macro_scope_has(const struct kefir_preprocessor_user_macro_scope *, const char *);
 kefir_result_t kefir_preprocessor_user_macro_scope_remove(struct kefir_mem *,
                                                           struct kefir_preprocessor_user_macro_scope *, const char *);
+kefir_result_t kefir_preprocessor_user_macro_scope_load_replacements(struct kefir_mem *, struct kefir_lexer *,
+                                                                     struct kefir_preprocessor_user_macro_scope *);
 
 #endif
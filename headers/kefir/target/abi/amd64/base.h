@@ -26,5 +26,6 @@
 typedef enum kefir_abi_amd64_variant { KEFIR_ABI_AMD64_VARIANT_SYSTEM_V } kefir_abi_amd64_variant_t;
 
 #define KEFIR_AMD64_ABI_QWORD 8
+#define KEFIR_AMD64_ABI_RED_ZONE_SIZE 128
 
 #endif
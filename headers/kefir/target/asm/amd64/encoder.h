@@ -0,0 +1,84 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef KEFIR_TARGET_ASM_AMD64_ENCODER_H_
+#define KEFIR_TARGET_ASM_AMD64_ENCODER_H_
+
+#include "kefir/target/asm/amd64/xasmgen.h"
+
+#define KEFIR_AMD64_ENCODER_MAX_INSTRUCTION_LENGTH 16
+#define KEFIR_AMD64_ENCODER_MAX_FIXUPS 2
+
+#define KEFIR_AMD64_ENCODER_OPCODE(_opcode) KEFIR_AMD64_ENCODER_OPCODE_##_opcode
+typedef enum kefir_asm_amd64_encoder_opcode {
+#define DEF_OPCODE(_opcode, ...) KEFIR_AMD64_ENCODER_OPCODE(_opcode)
+    KEFIR_AMD64_INSTRUCTION_DATABASE(DEF_OPCODE, DEF_OPCODE, DEF_OPCODE, DEF_OPCODE, COMMA)
+#undef DEF_OPCODE
+} kefir_asm_amd64_encoder_opcode_t;
+
+typedef enum kefir_asm_amd64_encoder_fixup_kind {
+    // Sign-extended 32-bit absolute value (displacement or immediate)
+    KEFIR_AMD64_ENCODER_FIXUP_ABSOLUTE32S,
+    // 64-bit absolute value
+    KEFIR_AMD64_ENCODER_FIXUP_ABSOLUTE64,
+    // 32-bit value relative to the fixup location (RIP-relative displacement)
+    KEFIR_AMD64_ENCODER_FIXUP_RELATIVE32,
+    // 32-bit branch target relative to the fixup location
+    KEFIR_AMD64_ENCODER_FIXUP_BRANCH32
+} kefir_asm_amd64_encoder_fixup_kind_t;
+
+typedef enum kefir_asm_amd64_encoder_fixup_relaxation {
+    KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_NONE,
+    KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_GOTPCRELX,
+    KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_REX_GOTPCRELX
+} kefir_asm_amd64_encoder_fixup_relaxation_t;
+
+typedef struct kefir_asm_amd64_encoder_fixup {
+    kefir_asm_amd64_encoder_fixup_kind_t kind;
+    kefir_size_t offset;
+    const char *symbol;
+    kefir_asm_amd64_xasmgen_symbol_relocation_t relocation;
+    kefir_asm_amd64_encoder_fixup_relaxation_t relaxation;
+    // Relative fixup addends are adjusted to be relative to the fixup location
+    kefir_int64_t addend;
+} kefir_asm_amd64_encoder_fixup_t;
+
+typedef struct kefir_asm_amd64_encoded_instruction {
+    kefir_uint8_t bytes[KEFIR_AMD64_ENCODER_MAX_INSTRUCTION_LENGTH];
+    kefir_size_t length;
+
+    struct kefir_asm_amd64_encoder_fixup fixups[KEFIR_AMD64_ENCODER_MAX_FIXUPS];
+    kefir_size_t fixup_count;
+
+    struct {
+        // Direct jump to a label, which the assembler may shorten
+        kefir_bool_t relaxable;
+        kefir_bool_t conditional;
+        kefir_uint8_t condition;
+    } branch;
+} kefir_asm_amd64_encoded_instruction_t;
+
+kefir_result_t kefir_asm_amd64_encode_instruction(kefir_asm_amd64_encoder_opcode_t, kefir_bool_t,
+                                                  const struct kefir_asm_amd64_xasmgen_operand *,
+                                                  const struct kefir_asm_amd64_xasmgen_operand *,
+                                                  const struct kefir_asm_amd64_xasmgen_operand *,
+                                                  struct kefir_asm_amd64_encoded_instruction *);
+
+#endif
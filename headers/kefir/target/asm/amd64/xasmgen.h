@@ -335,6 +335,10 @@ typedef struct kefir_amd64_xasmgen {
 kefir_result_t kefir_asm_amd64_xasmgen_init(struct kefir_mem *, struct kefir_amd64_xasmgen *, FILE *,
                                             kefir_asm_amd64_xasmgen_syntax_t);
 
+kefir_result_t kefir_asm_amd64_xasmgen_elf_init(struct kefir_mem *, struct kefir_amd64_xasmgen *, FILE *,
+                                                kefir_asm_amd64_xasmgen_syntax_t);
+kefir_bool_t kefir_asm_amd64_xasmgen_is_elf(const struct kefir_amd64_xasmgen *);
+
 FILE *kefir_asm_amd64_xasmgen_get_output(const struct kefir_amd64_xasmgen *);
 kefir_result_t kefir_asm_amd64_xasmgen_line_comment_prefix(const struct kefir_amd64_xasmgen *, const char **);
 
@@ -0,0 +1,113 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef KEFIR_TARGET_ELF_ELF_H_
+#define KEFIR_TARGET_ELF_ELF_H_
+
+#define KEFIR_ELF(_id) kefir_elf_##_id
+
+#define KEFIR_ELF64_EHDR_SIZE 64
+#define KEFIR_ELF64_SHDR_SIZE 64
+#define KEFIR_ELF64_SYM_SIZE 24
+#define KEFIR_ELF64_RELA_SIZE 24
+
+#define KEFIR_ELF64_R_INFO(_sym, _type) ((((kefir_uint64_t) (_sym)) << 32) + (kefir_uint64_t) (_type))
+#define KEFIR_ELF64_ST_INFO(_bind, _type) ((kefir_uint8_t) ((((_bind) & 0xf) << 4) | ((_type) & 0xf)))
+
+enum {
+    KEFIR_ELF(ELFCLASS64) = 2,
+    KEFIR_ELF(ELFDATA2LSB) = 1,
+    KEFIR_ELF(EV_CURRENT) = 1,
+    KEFIR_ELF(ELFOSABI_SYSV) = 0,
+    KEFIR_ELF(ET_REL) = 1,
+    KEFIR_ELF(EM_X86_64) = 62
+};
+
+typedef enum kefir_elf_section_index {
+    KEFIR_ELF(SHN_UNDEF) = 0,
+    KEFIR_ELF(SHN_ABS) = 0xfff1,
+    KEFIR_ELF(SHN_COMMON) = 0xfff2
+} kefir_elf_section_index_t;
+
+typedef enum kefir_elf_section_type {
+    KEFIR_ELF(SHT_NULL) = 0,
+    KEFIR_ELF(SHT_PROGBITS) = 1,
+    KEFIR_ELF(SHT_SYMTAB) = 2,
+    KEFIR_ELF(SHT_STRTAB) = 3,
+    KEFIR_ELF(SHT_RELA) = 4,
+    KEFIR_ELF(SHT_NOBITS) = 8,
+    KEFIR_ELF(SHT_INIT_ARRAY) = 14,
+    KEFIR_ELF(SHT_FINI_ARRAY) = 15
+} kefir_elf_section_type_t;
+
+typedef enum kefir_elf_section_flag {
+    KEFIR_ELF(SHF_WRITE) = 0x1,
+    KEFIR_ELF(SHF_ALLOC) = 0x2,
+    KEFIR_ELF(SHF_EXECINSTR) = 0x4,
+    KEFIR_ELF(SHF_MERGE) = 0x10,
+    KEFIR_ELF(SHF_STRINGS) = 0x20,
+    KEFIR_ELF(SHF_INFO_LINK) = 0x40,
+    KEFIR_ELF(SHF_TLS) = 0x400
+} kefir_elf_section_flag_t;
+
+typedef enum kefir_elf_symbol_binding {
+    KEFIR_ELF(STB_LOCAL) = 0,
+    KEFIR_ELF(STB_GLOBAL) = 1,
+    KEFIR_ELF(STB_WEAK) = 2
+} kefir_elf_symbol_binding_t;
+
+typedef enum kefir_elf_symbol_type {
+    KEFIR_ELF(STT_NOTYPE) = 0,
+    KEFIR_ELF(STT_OBJECT) = 1,
+    KEFIR_ELF(STT_FUNC) = 2,
+    KEFIR_ELF(STT_SECTION) = 3,
+    KEFIR_ELF(STT_FILE) = 4,
+    KEFIR_ELF(STT_COMMON) = 5,
+    KEFIR_ELF(STT_TLS) = 6
+} kefir_elf_symbol_type_t;
+
+typedef enum kefir_elf_symbol_visibility {
+    KEFIR_ELF(STV_DEFAULT) = 0,
+    KEFIR_ELF(STV_INTERNAL) = 1,
+    KEFIR_ELF(STV_HIDDEN) = 2,
+    KEFIR_ELF(STV_PROTECTED) = 3
+} kefir_elf_symbol_visibility_t;
+
+typedef enum kefir_elf_amd64_relocation {
+    KEFIR_ELF(R_X86_64_NONE) = 0,
+    KEFIR_ELF(R_X86_64_64) = 1,
+    KEFIR_ELF(R_X86_64_PC32) = 2,
+    KEFIR_ELF(R_X86_64_PLT32) = 4,
+    KEFIR_ELF(R_X86_64_GOTPCREL) = 9,
+    KEFIR_ELF(R_X86_64_32) = 10,
+    KEFIR_ELF(R_X86_64_32S) = 11,
+    KEFIR_ELF(R_X86_64_16) = 12,
+    KEFIR_ELF(R_X86_64_8) = 14,
+    KEFIR_ELF(R_X86_64_DTPOFF64) = 17,
+    KEFIR_ELF(R_X86_64_TLSGD) = 19,
+    KEFIR_ELF(R_X86_64_DTPOFF32) = 21,
+    KEFIR_ELF(R_X86_64_GOTTPOFF) = 22,
+    KEFIR_ELF(R_X86_64_TPOFF32) = 23,
+    KEFIR_ELF(R_X86_64_PC64) = 24,
+    KEFIR_ELF(R_X86_64_GOTPCRELX) = 41,
+    KEFIR_ELF(R_X86_64_REX_GOTPCRELX) = 42
+} kefir_elf_amd64_relocation_t;
+
+#endif
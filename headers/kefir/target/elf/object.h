@@ -0,0 +1,114 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef KEFIR_TARGET_ELF_OBJECT_H_
+#define KEFIR_TARGET_ELF_OBJECT_H_
+
+#include "kefir/core/basic-types.h"
+#include "kefir/core/mem.h"
+#include "kefir/target/elf/elf.h"
+#include <stdio.h>
+
+typedef struct kefir_elf_buffer {
+    kefir_uint8_t *content;
+    kefir_size_t length;
+    kefir_size_t capacity;
+} kefir_elf_buffer_t;
+
+kefir_result_t kefir_elf_buffer_init(struct kefir_elf_buffer *);
+kefir_result_t kefir_elf_buffer_free(struct kefir_mem *, struct kefir_elf_buffer *);
+kefir_result_t kefir_elf_buffer_reserve(struct kefir_mem *, struct kefir_elf_buffer *, kefir_size_t);
+kefir_result_t kefir_elf_buffer_append(struct kefir_mem *, struct kefir_elf_buffer *, const void *, kefir_size_t);
+kefir_result_t kefir_elf_buffer_append_byte(struct kefir_mem *, struct kefir_elf_buffer *, kefir_uint8_t);
+kefir_result_t kefir_elf_buffer_append_zeros(struct kefir_mem *, struct kefir_elf_buffer *, kefir_size_t);
+kefir_result_t kefir_elf_buffer_append_uleb128(struct kefir_mem *, struct kefir_elf_buffer *, kefir_uint64_t);
+kefir_result_t kefir_elf_buffer_append_sleb128(struct kefir_mem *, struct kefir_elf_buffer *, kefir_int64_t);
+kefir_result_t kefir_elf_buffer_append_le(struct kefir_mem *, struct kefir_elf_buffer *, kefir_uint64_t,
+                                          kefir_size_t);
+void kefir_elf_buffer_write_le(struct kefir_elf_buffer *, kefir_size_t, kefir_uint64_t, kefir_size_t);
+
+typedef struct kefir_elf_object_relocation {
+    kefir_uint64_t offset;
+    kefir_uint32_t type;
+    kefir_size_t symbol;
+    kefir_int64_t addend;
+} kefir_elf_object_relocation_t;
+
+typedef struct kefir_elf_object_section {
+    char *name;
+    kefir_uint32_t type;
+    kefir_uint64_t flags;
+    kefir_uint64_t alignment;
+    kefir_uint64_t entry_size;
+    struct kefir_elf_buffer content;
+    kefir_uint64_t size;
+
+    struct kefir_elf_object_relocation *relocations;
+    kefir_size_t relocation_count;
+    kefir_size_t relocation_capacity;
+
+    kefir_bool_t has_symbol;
+    kefir_size_t symbol;
+} kefir_elf_object_section_t;
+
+typedef struct kefir_elf_object_symbol {
+    char *name;
+    kefir_uint8_t binding;
+    kefir_uint8_t type;
+    kefir_uint8_t visibility;
+    kefir_uint16_t section_index;
+    kefir_bool_t in_section;
+    kefir_size_t section;
+    kefir_uint64_t value;
+    kefir_uint64_t size;
+    kefir_size_t order;
+} kefir_elf_object_symbol_t;
+
+typedef struct kefir_elf_object {
+    struct kefir_elf_object_section *sections;
+    kefir_size_t section_count;
+    kefir_size_t section_capacity;
+
+    struct kefir_elf_object_symbol *symbols;
+    kefir_size_t symbol_count;
+    kefir_size_t symbol_capacity;
+} kefir_elf_object_t;
+
+kefir_result_t kefir_elf_object_init(struct kefir_elf_object *);
+kefir_result_t kefir_elf_object_free(struct kefir_mem *, struct kefir_elf_object *);
+
+kefir_result_t kefir_elf_object_new_section(struct kefir_mem *, struct kefir_elf_object *, const char *,
+                                            kefir_uint32_t, kefir_uint64_t, kefir_uint64_t, kefir_uint64_t,
+                                            kefir_size_t *);
+kefir_result_t kefir_elf_object_section_symbol(struct kefir_mem *, struct kefir_elf_object *, kefir_size_t,
+                                               kefir_size_t *);
+kefir_result_t kefir_elf_object_new_symbol(struct kefir_mem *, struct kefir_elf_object *, const char *,
+                                           kefir_uint8_t, kefir_uint8_t, kefir_uint8_t, kefir_size_t *);
+kefir_result_t kefir_elf_object_define_symbol(struct kefir_elf_object *, kefir_size_t, kefir_size_t, kefir_uint64_t,
+                                              kefir_uint64_t);
+kefir_result_t kefir_elf_object_define_special_symbol(struct kefir_elf_object *, kefir_size_t, kefir_uint16_t,
+                                                      kefir_uint64_t, kefir_uint64_t);
+kefir_result_t kefir_elf_object_set_symbol_order(struct kefir_elf_object *, kefir_size_t, kefir_size_t);
+kefir_result_t kefir_elf_object_add_relocation(struct kefir_mem *, struct kefir_elf_object *, kefir_size_t,
+                                               kefir_uint64_t, kefir_uint32_t, kefir_size_t, kefir_int64_t);
+
+kefir_result_t kefir_elf_object_write(struct kefir_mem *, const struct kefir_elf_object *, FILE *);
+
+#endif
@@ -30,7 +30,8 @@
 static struct kefir_ast_translator_configuration DefaultConfiguration = {.empty_structs = false,
                                                                          .precise_bitfield_load_store = true,
                                                                          .optimize_stack_frame = true,
-                                                                         .cx_limited_range = false};
+                                                                         .cx_limited_range = false,
+                                                                         .strict_aliasing = true};
 
 kefir_result_t kefir_ast_translator_environment_new_type(struct kefir_mem *mem, const struct kefir_ast_context *context,
                                                          const struct kefir_ast_translator_environment *env,
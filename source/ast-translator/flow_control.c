@@ -92,10 +92,12 @@ static kefir_result_t patch_command(struct kefir_irblock *block, kefir_size_t in
     switch (instr->opcode) {
         case KEFIR_IR_OPCODE_JUMP:
         case KEFIR_IR_OPCODE_BLOCK_LABEL:
+        case KEFIR_IR_OPCODE_SWITCH_TARGET:
             instr->arg.u64 = value;
             break;
 
         case KEFIR_IR_OPCODE_BRANCH:
+        case KEFIR_IR_OPCODE_SWITCH:
             instr->arg.u64_2[0] = value;
             break;
 
@@ -235,6 +235,7 @@ kefir_result_t kefir_ast_translator_function_context_init(struct kefir_mem *mem,
          function_scoped_id->function.specifier == KEFIR_AST_FUNCTION_SPECIFIER_INLINE_NORETURN ||
          function_scoped_id->function.flags.gnu_inline || function_scoped_id->function.flags.always_inline) &&
         !function_scoped_id->function.flags.noinline;
+    ctx->ir_func->flags.no_inline = function_scoped_id->function.flags.noinline;
     ctx->ir_func->flags.enable_fenv_access =
         function->base.properties.function_definition.pragma_stats.enable_fenv_access;
     ctx->ir_func->flags.disallow_fp_contract =
@@ -286,6 +287,15 @@ static kefir_result_t xchg_param_address(struct kefir_irbuilder_block *builder)
     return KEFIR_OK;
 }
 
+static kefir_result_t mark_restrict_parameter(struct kefir_mem *mem, struct kefir_ir_function *ir_func,
+                                              kefir_size_t parameter_id, const struct kefir_ast_type *type) {
+    if (type->tag == KEFIR_AST_TYPE_QUALIFIED && type->qualified_type.qualification.restricted) {
+        REQUIRE_OK(
+            kefir_hashtreeset_add(mem, &ir_func->restrict_parameters, (kefir_hashtreeset_entry_t) parameter_id));
+    }
+    return KEFIR_OK;
+}
+
 struct vl_modified_param {
     struct kefir_mem *mem;
     struct kefir_irbuilder_block *builder;
@@ -431,6 +441,8 @@ kefir_result_t kefir_ast_translator_function_context_translate(
                     REQUIRE_OK(
                         kefir_ast_translator_store_value(mem, scoped_id->object.type, context, builder,
                                                          &function_context->function_definition->base.source_location));
+                    REQUIRE_OK(
+                        mark_restrict_parameter(mem, function_context->ir_func, parameter_id, scoped_id->object.type));
                 } else {
                     REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_POP, 0));
                 }
@@ -455,6 +467,7 @@ kefir_result_t kefir_ast_translator_function_context_translate(
 
             REQUIRE_OK(kefir_ast_translator_store_value(mem, scoped_id->object.type, context, builder,
                                                         &function_context->function_definition->base.source_location));
+            REQUIRE_OK(mark_restrict_parameter(mem, function_context->ir_func, parameter_id, scoped_id->object.type));
         } else {
             return KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR,
                                    "Expected function parameter to be either AST declaration or identifier");
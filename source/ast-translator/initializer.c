@@ -215,6 +215,33 @@ static kefir_result_t traverse_string_literal(const struct kefir_ast_designator
     return KEFIR_OK;
 }
 
+static kefir_result_t traverse_embed_value(const struct kefir_ast_designator *designator,
+                                           struct kefir_ast_node_base *expression, kefir_uint8_t value,
+                                           void *payload) {
+    REQUIRE(expression != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid AST expression node"));
+    REQUIRE(payload != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid payload"));
+    ASSIGN_DECL_CAST(struct traversal_param *, param, payload);
+
+    struct kefir_ast_type_layout *type_layout = NULL;
+    if (designator != NULL) {
+        REQUIRE_OK(
+            kefir_ast_type_layout_resolve(param->translator_type->object.layout, designator, &type_layout, NULL, NULL));
+        REQUIRE_OK(translate_address(param->translator_type, designator, param->builder));
+    } else {
+        type_layout = param->translator_type->object.layout;
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(param->builder, KEFIR_IR_OPCODE_VSTACK_PICK, 0));
+    }
+
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(param->builder, KEFIR_IR_OPCODE_INT_CONST, value));
+    REQUIRE_OK(kefir_ast_translate_typeconv(param->mem, param->context->module, param->builder,
+                                            param->context->ast_context->type_traits, kefir_ast_type_signed_int(),
+                                            type_layout->type));
+    REQUIRE_OK(kefir_ast_translator_store_layout_value(param->mem, param->context, param->builder,
+                                                       param->translator_type->object.ir_type, type_layout,
+                                                       &expression->source_location));
+    return KEFIR_OK;
+}
+
 static kefir_result_t traverse_initializer_list(const struct kefir_ast_designator *designator,
                                                 const struct kefir_ast_initializer *initializer, void *payload) {
     REQUIRE(initializer != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid AST initializer"));
@@ -271,6 +298,7 @@ static kefir_result_t kefir_ast_translate_initializer_impl(
     KEFIR_AST_INITIALIZER_TRAVERSAL_INIT(&initializer_traversal);
     initializer_traversal.visit_value = traverse_scalar;
     initializer_traversal.visit_string_literal = traverse_string_literal;
+    initializer_traversal.visit_embed_value = traverse_embed_value;
     initializer_traversal.visit_initializer_list = traverse_initializer_list;
     initializer_traversal.payload = &param;
 
@@ -37,13 +37,8 @@ kefir_result_t kefir_ast_translate_array_subscript_node(struct kefir_mem *mem,
 
     kefir_bool_t atomic_aggregate_element = false;
     REQUIRE_OK(kefir_ast_translate_array_subscript_lvalue(mem, context, builder, node));
-    if (node->base.properties.expression_props.atomic) {
-        REQUIRE_OK(kefir_ast_translator_atomic_load_value(node->base.properties.type, context->ast_context->type_traits,
-                                                          builder, &atomic_aggregate_element));
-    } else {
-        REQUIRE_OK(
-            kefir_ast_translator_load_value(node->base.properties.type, context->ast_context->type_traits, builder));
-    }
+    REQUIRE_OK(kefir_ast_translator_resolve_lvalue(mem, context, builder, KEFIR_AST_NODE_BASE(node),
+                                                   &atomic_aggregate_element));
 
     if (atomic_aggregate_element) {
         REQUIRE_OK(kefir_ast_translator_load_atomic_aggregate_value(
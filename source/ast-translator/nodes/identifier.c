@@ -53,8 +53,9 @@ static kefir_result_t translate_object_identifier(struct kefir_mem *mem, struct
                     &node->base.properties.expression_props.temporary_identifier, &node->base.source_location));
             }
         } else {
-            REQUIRE_OK(kefir_ast_translator_load_value(scoped_identifier->object.type,
-                                                       context->ast_context->type_traits, builder));
+            kefir_bool_t atomic_aggregate;
+            REQUIRE_OK(kefir_ast_translator_resolve_lvalue(mem, context, builder, KEFIR_AST_NODE_BASE(node),
+                                                           &atomic_aggregate));
         }
     }
     return KEFIR_OK;
@@ -25,34 +25,175 @@
 #include "kefir/ast-translator/typeconv.h"
 #include "kefir/core/util.h"
 #include "kefir/core/error.h"
+#include "kefir/core/sort.h"
+
+struct switch_comparison {
+    kefir_iropcode_t opcode;
+    kefir_int64_t arg;
+};
+
+struct switch_comparisons {
+    struct switch_comparison equals;
+    struct switch_comparison greater;
+    struct switch_comparison less;
+};
+
+static kefir_result_t switch_comparisons_of(const struct kefir_ast_translator_context *context,
+                                            const struct kefir_ast_flow_control_structure *flow_control_stmt,
+                                            struct switch_comparisons *comparisons) {
+    const struct kefir_ast_type *controlling_expr_type =
+        flow_control_stmt->value.switchStatement.controlling_expression_type;
+    kefir_ast_type_data_model_classification_t controlling_expr_type_classification;
+    REQUIRE_OK(kefir_ast_type_data_model_classify(context->ast_context->type_traits, controlling_expr_type,
+                                                  &controlling_expr_type_classification));
+    kefir_bool_t signed_controlling_expr;
+    REQUIRE_OK(
+        kefir_ast_type_is_signed(context->ast_context->type_traits, controlling_expr_type, &signed_controlling_expr));
+
+#define SCALAR_COMPARISONS(_width)                                                                                   \
+    do {                                                                                                             \
+        comparisons->equals.opcode = KEFIR_IR_OPCODE_SCALAR_COMPARE;                                                 \
+        comparisons->equals.arg = KEFIR_IR_COMPARE_INT##_width##_EQUALS;                                             \
+        comparisons->greater.opcode = KEFIR_IR_OPCODE_SCALAR_COMPARE;                                                \
+        comparisons->greater.arg =                                                                                   \
+            signed_controlling_expr ? KEFIR_IR_COMPARE_INT##_width##_GREATER : KEFIR_IR_COMPARE_INT##_width##_ABOVE; \
+        comparisons->less.opcode = KEFIR_IR_OPCODE_SCALAR_COMPARE;                                                   \
+        comparisons->less.arg =                                                                                      \
+            signed_controlling_expr ? KEFIR_IR_COMPARE_INT##_width##_LESSER : KEFIR_IR_COMPARE_INT##_width##_BELOW;  \
+    } while (0)
+    switch (controlling_expr_type_classification) {
+        case KEFIR_AST_TYPE_DATA_MODEL_INT8:
+            SCALAR_COMPARISONS(8);
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_INT16:
+            SCALAR_COMPARISONS(16);
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_INT32:
+            SCALAR_COMPARISONS(32);
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_INT64:
+            SCALAR_COMPARISONS(64);
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_INT128:
+            comparisons->equals = (struct switch_comparison) {KEFIR_IR_OPCODE_INT128_EQUAL, 0};
+            comparisons->greater = (struct switch_comparison) {
+                signed_controlling_expr ? KEFIR_IR_OPCODE_INT128_GREATER : KEFIR_IR_OPCODE_INT128_ABOVE, 0};
+            comparisons->less = (struct switch_comparison) {
+                signed_controlling_expr ? KEFIR_IR_OPCODE_INT128_LESS : KEFIR_IR_OPCODE_INT128_BELOW, 0};
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_BITINT:
+            comparisons->equals =
+                (struct switch_comparison) {KEFIR_IR_OPCODE_BITINT_EQUAL, controlling_expr_type->bitprecise.width};
+            comparisons->greater = (struct switch_comparison) {
+                signed_controlling_expr ? KEFIR_IR_OPCODE_BITINT_GREATER : KEFIR_IR_OPCODE_BITINT_ABOVE,
+                controlling_expr_type->bitprecise.width};
+            comparisons->less = (struct switch_comparison) {
+                signed_controlling_expr ? KEFIR_IR_OPCODE_BITINT_LESS : KEFIR_IR_OPCODE_BITINT_BELOW,
+                controlling_expr_type->bitprecise.width};
+            break;
+
+        default:
+            return KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected value of an integral type");
+    }
+#undef SCALAR_COMPARISONS
+    return KEFIR_OK;
+}
 
-kefir_result_t kefir_ast_translate_switch_statement_node(struct kefir_mem *mem,
-                                                         struct kefir_ast_translator_context *context,
-                                                         struct kefir_irbuilder_block *builder,
-                                                         const struct kefir_ast_switch_statement *node) {
-    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
-    REQUIRE(context != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST translation context"));
-    REQUIRE(builder != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR block builder"));
-    REQUIRE(node != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST switch statement node"));
+#define APPEND_COMPARISON(_builder, _comparison) \
+    KEFIR_IRBUILDER_BLOCK_APPENDI64((_builder), (_comparison).opcode, (_comparison).arg)
 
-    const kefir_size_t statement_begin_index = KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder);
-    kefir_ir_debug_entry_id_t lexical_block_entry_id;
-    REQUIRE_OK(kefir_ast_translator_context_push_debug_hierarchy_entry(mem, context, KEFIR_IR_DEBUG_ENTRY_LEXICAL_BLOCK,
-                                                                       &lexical_block_entry_id));
-    REQUIRE_OK(kefir_ir_debug_entry_add_attribute(mem, &context->module->debug_info.entries, &context->module->symbols,
-                                                  lexical_block_entry_id,
-                                                  &KEFIR_IR_DEBUG_ENTRY_ATTR_CODE_BEGIN(statement_begin_index)));
+static kefir_result_t translate_case_value(struct kefir_mem *mem, struct kefir_ast_translator_context *context,
+                                           struct kefir_irbuilder_block *builder,
+                                           struct kefir_ast_flow_control_structure *flow_control_stmt,
+                                           const struct kefir_ast_node_base *value_node) {
+    REQUIRE_OK(kefir_ast_translate_expression(mem, value_node, builder, context));
+    REQUIRE_OK(kefir_ast_translate_typeconv(mem, context->module, builder, context->ast_context->type_traits,
+                                            value_node->properties.type,
+                                            flow_control_stmt->value.switchStatement.controlling_expression_type));
+    return KEFIR_OK;
+}
 
-    REQUIRE_OK(kefir_ast_translator_mark_associated_scope_objects_lifetime(
-        mem, context, builder, node->base.properties.statement_props.flow_control_statement));
+static kefir_result_t translate_case_condition(struct kefir_mem *mem, struct kefir_ast_translator_context *context,
+                                               struct kefir_irbuilder_block *builder,
+                                               struct kefir_ast_flow_control_structure *flow_control_stmt,
+                                               const struct kefir_ast_node_base *value_node,
+                                               const struct kefir_ast_node_base *range_end_node) {
+    struct switch_comparisons comparisons;
+    REQUIRE_OK(switch_comparisons_of(context, flow_control_stmt, &comparisons));
+
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 0));
+    REQUIRE_OK(translate_case_value(mem, context, builder, flow_control_stmt, value_node));
+    if (range_end_node == NULL) {
+        REQUIRE_OK(APPEND_COMPARISON(builder, comparisons.equals));
+    } else {
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
+        REQUIRE_OK(APPEND_COMPARISON(builder, comparisons.greater));
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
+        REQUIRE_OK(APPEND_COMPARISON(builder, comparisons.equals));
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_OR, 0));
+
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
+        REQUIRE_OK(translate_case_value(mem, context, builder, flow_control_stmt, range_end_node));
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
+        REQUIRE_OK(APPEND_COMPARISON(builder, comparisons.less));
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
+        REQUIRE_OK(APPEND_COMPARISON(builder, comparisons.equals));
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_OR, 0));
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_AND, 0));
+    }
+    return KEFIR_OK;
+}
 
-    REQUIRE_OK(kefir_ast_translate_expression(mem, node->expression, builder, context));
+static kefir_result_t translate_case_jump(struct kefir_mem *mem, struct kefir_ast_translator_context *context,
+                                          struct kefir_irbuilder_block *builder,
+                                          struct kefir_ast_flow_control_structure *flow_control_stmt,
+                                          const struct kefir_ast_node_base *value_node,
+                                          const struct kefir_ast_node_base *range_end_node,
+                                          struct kefir_ast_flow_control_point *point) {
+    REQUIRE_OK(translate_case_condition(mem, context, builder, flow_control_stmt, value_node, range_end_node));
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_NOT, 0));
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDU64_2(builder, KEFIR_IR_OPCODE_BRANCH,
+                                                 KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder) + 3,
+                                                 KEFIR_IR_BRANCH_CONDITION_8BIT));
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_POP, 0));
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_JUMP, 0));
+    REQUIRE_OK(kefir_ast_translator_flow_control_point_reference(mem, point, builder->block,
+                                                                 KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder) - 1));
+    return KEFIR_OK;
+}
 
-    struct kefir_ast_flow_control_structure *flow_control_stmt =
-        node->base.properties.statement_props.flow_control_statement;
-    REQUIRE_OK(kefir_ast_translate_typeconv(mem, context->module, builder, context->ast_context->type_traits,
-                                            node->expression->properties.type,
-                                            flow_control_stmt->value.switchStatement.controlling_expression_type));
+static kefir_result_t translate_default_reference(struct kefir_mem *mem, struct kefir_irbuilder_block *builder,
+                                                  struct kefir_ast_flow_control_structure *flow_control_stmt,
+                                                  kefir_size_t index) {
+    if (flow_control_stmt->value.switchStatement.defaultCase != NULL) {
+        REQUIRE_OK(kefir_ast_translator_flow_control_point_reference(
+            mem, flow_control_stmt->value.switchStatement.defaultCase, builder->block, index));
+    } else {
+        REQUIRE_OK(kefir_ast_translator_flow_control_point_reference(mem, flow_control_stmt->value.switchStatement.end,
+                                                                     builder->block, index));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t translate_default_jump(struct kefir_mem *mem, struct kefir_irbuilder_block *builder,
+                                             struct kefir_ast_flow_control_structure *flow_control_stmt) {
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_POP, 0));
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_JUMP, 0));
+    REQUIRE_OK(
+        translate_default_reference(mem, builder, flow_control_stmt, KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder) - 1));
+    return KEFIR_OK;
+}
+
+static kefir_result_t translate_linear_dispatch(struct kefir_mem *mem, struct kefir_ast_translator_context *context,
+                                                struct kefir_irbuilder_block *builder,
+                                                struct kefir_ast_flow_control_structure *flow_control_stmt) {
     struct kefir_hashtree_node_iterator iter;
     for (const struct kefir_hashtree_node *switchCase =
              kefir_hashtree_iter(&flow_control_stmt->value.switchStatement.case_flow_control_points, &iter);
@@ -82,249 +223,326 @@ kefir_result_t kefir_ast_translate_switch_statement_node(struct kefir_mem *mem,
                 KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected integral constant expression"));
         }
 
-        if (range_end_node == NULL) {
-            REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 0));
-            REQUIRE_OK(kefir_ast_translate_expression(mem, value_node, builder, context));
-            REQUIRE_OK(kefir_ast_translate_typeconv(
-                mem, context->module, builder, context->ast_context->type_traits, value_node->properties.type,
-                flow_control_stmt->value.switchStatement.controlling_expression_type));
-            kefir_ast_type_data_model_classification_t controlling_expr_type_classification;
-            REQUIRE_OK(kefir_ast_type_data_model_classify(
-                context->ast_context->type_traits, flow_control_stmt->value.switchStatement.controlling_expression_type,
-                &controlling_expr_type_classification));
-            switch (controlling_expr_type_classification) {
-                case KEFIR_AST_TYPE_DATA_MODEL_INT8:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT8_EQUALS));
-                    break;
-
-                case KEFIR_AST_TYPE_DATA_MODEL_INT16:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT16_EQUALS));
-                    break;
-
-                case KEFIR_AST_TYPE_DATA_MODEL_INT32:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT32_EQUALS));
-                    break;
-
-                case KEFIR_AST_TYPE_DATA_MODEL_INT64:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT64_EQUALS));
-                    break;
-
-                case KEFIR_AST_TYPE_DATA_MODEL_INT128:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT128_EQUAL, 0));
-                    break;
-
-                case KEFIR_AST_TYPE_DATA_MODEL_BITINT:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, KEFIR_IR_OPCODE_BITINT_EQUAL,
-                        flow_control_stmt->value.switchStatement.controlling_expression_type->bitprecise.width));
-                    break;
-
-                default:
-                    return KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected value of an integral type");
-            }
-        } else {
-            REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 0));
-            REQUIRE_OK(kefir_ast_translate_expression(mem, value_node, builder, context));
-            REQUIRE_OK(kefir_ast_translate_typeconv(
-                mem, context->module, builder, context->ast_context->type_traits, value_node->properties.type,
-                flow_control_stmt->value.switchStatement.controlling_expression_type));
-            REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-            REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-            kefir_ast_type_data_model_classification_t controlling_expr_type_classification;
-            REQUIRE_OK(kefir_ast_type_data_model_classify(
-                context->ast_context->type_traits, flow_control_stmt->value.switchStatement.controlling_expression_type,
-                &controlling_expr_type_classification));
-
-            kefir_bool_t signed_controlling_expr;
-            REQUIRE_OK(kefir_ast_type_is_signed(context->ast_context->type_traits,
-                                                flow_control_stmt->value.switchStatement.controlling_expression_type,
-                                                &signed_controlling_expr));
-
-            switch (controlling_expr_type_classification) {
-                case KEFIR_AST_TYPE_DATA_MODEL_INT8:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                        signed_controlling_expr ? KEFIR_IR_COMPARE_INT8_GREATER : KEFIR_IR_COMPARE_INT8_ABOVE));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT8_EQUALS));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_OR, 0));
-
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(kefir_ast_translate_expression(mem, range_end_node, builder, context));
-                    REQUIRE_OK(kefir_ast_translate_typeconv(
-                        mem, context->module, builder, context->ast_context->type_traits,
-                        range_end_node->properties.type,
-                        flow_control_stmt->value.switchStatement.controlling_expression_type));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                        signed_controlling_expr ? KEFIR_IR_COMPARE_INT8_LESSER : KEFIR_IR_COMPARE_INT8_BELOW));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT8_EQUALS));
-                    break;
-
-                case KEFIR_AST_TYPE_DATA_MODEL_INT16:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                        signed_controlling_expr ? KEFIR_IR_COMPARE_INT16_GREATER : KEFIR_IR_COMPARE_INT16_ABOVE));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT16_EQUALS));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_OR, 0));
-
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(kefir_ast_translate_expression(mem, range_end_node, builder, context));
-                    REQUIRE_OK(kefir_ast_translate_typeconv(
-                        mem, context->module, builder, context->ast_context->type_traits,
-                        range_end_node->properties.type,
-                        flow_control_stmt->value.switchStatement.controlling_expression_type));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                        signed_controlling_expr ? KEFIR_IR_COMPARE_INT16_LESSER : KEFIR_IR_COMPARE_INT16_BELOW));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT16_EQUALS));
-                    break;
-
-                case KEFIR_AST_TYPE_DATA_MODEL_INT32:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                        signed_controlling_expr ? KEFIR_IR_COMPARE_INT32_GREATER : KEFIR_IR_COMPARE_INT32_ABOVE));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT32_EQUALS));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_OR, 0));
-
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(kefir_ast_translate_expression(mem, range_end_node, builder, context));
-                    REQUIRE_OK(kefir_ast_translate_typeconv(
-                        mem, context->module, builder, context->ast_context->type_traits,
-                        range_end_node->properties.type,
-                        flow_control_stmt->value.switchStatement.controlling_expression_type));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                        signed_controlling_expr ? KEFIR_IR_COMPARE_INT32_LESSER : KEFIR_IR_COMPARE_INT32_BELOW));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT32_EQUALS));
-                    break;
-
-                case KEFIR_AST_TYPE_DATA_MODEL_INT64:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                        signed_controlling_expr ? KEFIR_IR_COMPARE_INT64_GREATER : KEFIR_IR_COMPARE_INT64_ABOVE));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT64_EQUALS));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_OR, 0));
-
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(kefir_ast_translate_expression(mem, range_end_node, builder, context));
-                    REQUIRE_OK(kefir_ast_translate_typeconv(
-                        mem, context->module, builder, context->ast_context->type_traits,
-                        range_end_node->properties.type,
-                        flow_control_stmt->value.switchStatement.controlling_expression_type));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                        signed_controlling_expr ? KEFIR_IR_COMPARE_INT64_LESSER : KEFIR_IR_COMPARE_INT64_BELOW));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SCALAR_COMPARE,
-                                                               KEFIR_IR_COMPARE_INT64_EQUALS));
-                    break;
-
-                case KEFIR_AST_TYPE_DATA_MODEL_INT128:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder,
-                        signed_controlling_expr ? KEFIR_IR_OPCODE_INT128_GREATER : KEFIR_IR_OPCODE_INT128_ABOVE, 0));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT128_EQUAL, 0));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_OR, 0));
-
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(kefir_ast_translate_expression(mem, range_end_node, builder, context));
-                    REQUIRE_OK(kefir_ast_translate_typeconv(
-                        mem, context->module, builder, context->ast_context->type_traits,
-                        range_end_node->properties.type,
-                        flow_control_stmt->value.switchStatement.controlling_expression_type));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, signed_controlling_expr ? KEFIR_IR_OPCODE_INT128_LESS : KEFIR_IR_OPCODE_INT128_BELOW,
-                        0));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT128_EQUAL, 0));
-                    break;
-
-                case KEFIR_AST_TYPE_DATA_MODEL_BITINT:
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder,
-                        signed_controlling_expr ? KEFIR_IR_OPCODE_BITINT_GREATER : KEFIR_IR_OPCODE_BITINT_ABOVE,
-                        flow_control_stmt->value.switchStatement.controlling_expression_type->bitprecise.width));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, KEFIR_IR_OPCODE_BITINT_EQUAL,
-                        flow_control_stmt->value.switchStatement.controlling_expression_type->bitprecise.width));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_OR, 0));
-
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(kefir_ast_translate_expression(mem, range_end_node, builder, context));
-                    REQUIRE_OK(kefir_ast_translate_typeconv(
-                        mem, context->module, builder, context->ast_context->type_traits,
-                        range_end_node->properties.type,
-                        flow_control_stmt->value.switchStatement.controlling_expression_type));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 1));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, signed_controlling_expr ? KEFIR_IR_OPCODE_BITINT_LESS : KEFIR_IR_OPCODE_BITINT_BELOW,
-                        flow_control_stmt->value.switchStatement.controlling_expression_type->bitprecise.width));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 2));
-                    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(
-                        builder, KEFIR_IR_OPCODE_BITINT_EQUAL,
-                        flow_control_stmt->value.switchStatement.controlling_expression_type->bitprecise.width));
-                    break;
-
-                default:
-                    return KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected value of an integral type");
+        REQUIRE_OK(translate_case_jump(mem, context, builder, flow_control_stmt, value_node, range_end_node, point));
+    }
+
+    REQUIRE_OK(translate_default_jump(mem, builder, flow_control_stmt));
+    return KEFIR_OK;
+}
+
+// Switch statements with many case labels are dispatched via binary search over sorted case ranges rather than
+// sequential comparison of each case label. Sufficiently dense runs of case labels are dispatched via jump table.
+#define SWITCH_BINARY_SEARCH_MIN_CASES 8
+#define SWITCH_BINARY_SEARCH_LEAF_CASES 4
+#define SWITCH_JUMP_TABLE_MIN_CASES 8
+#define SWITCH_JUMP_TABLE_MAX_LENGTH 4096
+#define SWITCH_JUMP_TABLE_MIN_DENSITY_PERCENT 40
+
+struct switch_case {
+    kefir_uint64_t begin_key;
+    kefir_uint64_t end_key;
+    kefir_int64_t begin_value;
+    const struct kefir_ast_node_base *value_node;
+    const struct kefir_ast_node_base *range_end_node;
+    struct kefir_ast_flow_control_point *point;
+};
+
+struct switch_dispatch {
+    struct switch_case *cases;
+    kefir_size_t num_of_cases;
+    kefir_size_t width;
+    kefir_bool_t signedness;
+    kefir_iropcode_t extend_opcode;
+    struct switch_comparisons comparisons;
+};
+
+static kefir_result_t case_value_of(const struct kefir_ast_translator_context *context,
+                                    const struct switch_dispatch *dispatch, const struct kefir_ast_node_base *node,
+                                    kefir_bool_t *supported, kefir_int64_t *value_ptr, kefir_uint64_t *key_ptr) {
+    kefir_ast_type_data_model_classification_t classification;
+    REQUIRE_OK(kefir_ast_type_data_model_classify(context->ast_context->type_traits,
+                                                  kefir_ast_unqualified_type(node->properties.type), &classification));
+    switch (classification) {
+        case KEFIR_AST_TYPE_DATA_MODEL_INT8:
+        case KEFIR_AST_TYPE_DATA_MODEL_INT16:
+        case KEFIR_AST_TYPE_DATA_MODEL_INT32:
+        case KEFIR_AST_TYPE_DATA_MODEL_INT64:
+            break;
+
+        default:
+            *supported = false;
+            return KEFIR_OK;
+    }
+
+    kefir_uint64_t value = KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(node)->uinteger;
+    if (dispatch->width < 64) {
+        const kefir_uint64_t mask = (1ull << dispatch->width) - 1;
+        value &= mask;
+        if (dispatch->signedness && ((value >> (dispatch->width - 1)) & 1) != 0) {
+            value |= ~mask;
+        }
+    }
+
+    *value_ptr = (kefir_int64_t) value;
+    // Keys preserve ordering of controlling expression type under unsigned comparison
+    *key_ptr = dispatch->signedness ? value ^ (1ull << 63) : value;
+    return KEFIR_OK;
+}
+
+static kefir_result_t switch_case_comparator(void *ptr1, void *ptr2, kefir_int_t *cmp, void *payload) {
+    UNUSED(payload);
+    REQUIRE(ptr1 != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid first switch case pointer"));
+    REQUIRE(ptr2 != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid second switch case pointer"));
+    REQUIRE(cmp != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to comparison result"));
+    ASSIGN_DECL_CAST(const struct switch_case *, case1, ptr1);
+    ASSIGN_DECL_CAST(const struct switch_case *, case2, ptr2);
+
+    if (case1->begin_key < case2->begin_key) {
+        *cmp = -1;
+    } else if (case1->begin_key == case2->begin_key) {
+        *cmp = 0;
+    } else {
+        *cmp = 1;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t collect_switch_cases(struct kefir_mem *mem, struct kefir_ast_translator_context *context,
+                                           struct kefir_ast_flow_control_structure *flow_control_stmt,
+                                           struct switch_dispatch *dispatch, kefir_bool_t *supported) {
+    kefir_size_t index = 0;
+    struct kefir_hashtree_node_iterator iter;
+    for (const struct kefir_hashtree_node *switchCase =
+             kefir_hashtree_iter(&flow_control_stmt->value.switchStatement.case_flow_control_points, &iter);
+         switchCase != NULL && *supported; switchCase = kefir_hashtree_next(&iter), index++) {
+        ASSIGN_DECL_CAST(kefir_size_t, cast_identifier, iter.node->key);
+        ASSIGN_DECL_CAST(struct kefir_ast_flow_control_point *, point, iter.node->value);
+        struct switch_case *switch_case = &dispatch->cases[index];
+
+        struct kefir_hashtree_node *node;
+        REQUIRE_OK(kefir_hashtree_at(&flow_control_stmt->value.switchStatement.case_label_nodes,
+                                     (kefir_hashtree_key_t) cast_identifier, &node));
+        switch_case->value_node = (const struct kefir_ast_node_base *) node->value;
+        switch_case->range_end_node = NULL;
+        switch_case->point = point;
+        REQUIRE(KEFIR_AST_NODE_IS_CONSTANT_EXPRESSION_OF(switch_case->value_node,
+                                                         KEFIR_AST_CONSTANT_EXPRESSION_CLASS_INTEGER),
+                KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected integral constant expression"));
+        REQUIRE_OK(case_value_of(context, dispatch, switch_case->value_node, supported, &switch_case->begin_value,
+                                 &switch_case->begin_key));
+        switch_case->end_key = switch_case->begin_key;
+
+        kefir_result_t res = kefir_hashtree_at(&flow_control_stmt->value.switchStatement.case_range_end_nodes,
+                                               (kefir_hashtree_key_t) cast_identifier, &node);
+        if (res != KEFIR_NOT_FOUND && *supported) {
+            REQUIRE_OK(res);
+            switch_case->range_end_node = (const struct kefir_ast_node_base *) node->value;
+            REQUIRE(KEFIR_AST_NODE_IS_CONSTANT_EXPRESSION_OF(switch_case->range_end_node,
+                                                             KEFIR_AST_CONSTANT_EXPRESSION_CLASS_INTEGER),
+                    KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected integral constant expression"));
+            kefir_int64_t end_value;
+            REQUIRE_OK(case_value_of(context, dispatch, switch_case->range_end_node, supported, &end_value,
+                                     &switch_case->end_key));
+            // Ranges that are not ordered within controlling expression type are left for sequential comparison
+            if (*supported && switch_case->end_key < switch_case->begin_key) {
+                *supported = false;
             }
-            REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_OR, 0));
-            REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_AND, 0));
         }
-        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT8_BOOL_NOT, 0));
-        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDU64_2(builder, KEFIR_IR_OPCODE_BRANCH,
-                                                     KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder) + 3,
-                                                     KEFIR_IR_BRANCH_CONDITION_8BIT));
-        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_POP, 0));
-        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_JUMP, 0));
-        REQUIRE_OK(kefir_ast_translator_flow_control_point_reference(mem, point, builder->block,
-                                                                     KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder) - 1));
+    }
+    REQUIRE(*supported, KEFIR_OK);
+
+    REQUIRE_OK(kefir_mergesort(mem, dispatch->cases, sizeof(struct switch_case), dispatch->num_of_cases,
+                               switch_case_comparator, NULL));
+    for (kefir_size_t i = 1; i < dispatch->num_of_cases && *supported; i++) {
+        if (dispatch->cases[i - 1].end_key >= dispatch->cases[i].begin_key) {
+            // Overlapping case labels depend on the order of comparison
+            *supported = false;
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_bool_t jump_table_applicable(const struct switch_dispatch *dispatch, kefir_size_t begin,
+                                          kefir_size_t end, kefir_size_t *length_ptr) {
+    if (end - begin < SWITCH_JUMP_TABLE_MIN_CASES) {
+        return false;
+    }
+
+    const kefir_uint64_t span = dispatch->cases[end - 1].end_key - dispatch->cases[begin].begin_key;
+    if (span >= SWITCH_JUMP_TABLE_MAX_LENGTH) {
+        return false;
     }
 
+    kefir_uint64_t covered = 0;
+    for (kefir_size_t i = begin; i < end; i++) {
+        covered += dispatch->cases[i].end_key - dispatch->cases[i].begin_key + 1;
+    }
+    *length_ptr = span + 1;
+    return covered * 100 >= *length_ptr * SWITCH_JUMP_TABLE_MIN_DENSITY_PERCENT;
+}
+
+static kefir_result_t translate_jump_table_dispatch(struct kefir_mem *mem, struct kefir_irbuilder_block *builder,
+                                                    struct kefir_ast_flow_control_structure *flow_control_stmt,
+                                                    const struct switch_dispatch *dispatch, kefir_size_t begin,
+                                                    kefir_size_t end, kefir_size_t length) {
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 0));
+    if (dispatch->extend_opcode != KEFIR_IR_OPCODE_NOP) {
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, dispatch->extend_opcode, 0));
+    }
+    REQUIRE_OK(
+        KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT_CONST, dispatch->cases[begin].begin_value));
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT64_SUB, 0));
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_EXCHANGE, 1));
     REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_POP, 0));
-    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_JUMP, 0));
-    if (flow_control_stmt->value.switchStatement.defaultCase != NULL) {
-        REQUIRE_OK(kefir_ast_translator_flow_control_point_reference(
-            mem, flow_control_stmt->value.switchStatement.defaultCase, builder->block,
-            KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder) - 1));
 
-    } else {
-        REQUIRE_OK(kefir_ast_translator_flow_control_point_reference(mem, flow_control_stmt->value.switchStatement.end,
-                                                                     builder->block,
-                                                                     KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder) - 1));
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDU64_2(builder, KEFIR_IR_OPCODE_SWITCH, 0, length));
+    REQUIRE_OK(
+        translate_default_reference(mem, builder, flow_control_stmt, KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder) - 1));
+    const kefir_uint64_t base_key = dispatch->cases[begin].begin_key;
+    for (kefir_size_t i = begin, index = 0; index < length; index++) {
+        REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_SWITCH_TARGET, 0));
+        if (base_key + index >= dispatch->cases[i].begin_key) {
+            REQUIRE_OK(kefir_ast_translator_flow_control_point_reference(
+                mem, dispatch->cases[i].point, builder->block, KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder) - 1));
+            if (base_key + index == dispatch->cases[i].end_key) {
+                i++;
+            }
+        } else {
+            REQUIRE_OK(translate_default_reference(mem, builder, flow_control_stmt,
+                                                   KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder) - 1));
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t translate_binary_search_dispatch(struct kefir_mem *mem,
+                                                       struct kefir_ast_translator_context *context,
+                                                       struct kefir_irbuilder_block *builder,
+                                                       struct kefir_ast_flow_control_structure *flow_control_stmt,
+                                                       const struct switch_dispatch *dispatch, kefir_size_t begin,
+                                                       kefir_size_t end) {
+    kefir_size_t jump_table_length;
+    if (jump_table_applicable(dispatch, begin, end, &jump_table_length)) {
+        REQUIRE_OK(translate_jump_table_dispatch(mem, builder, flow_control_stmt, dispatch, begin, end,
+                                                 jump_table_length));
+        return KEFIR_OK;
+    }
+
+    if (end - begin <= SWITCH_BINARY_SEARCH_LEAF_CASES) {
+        for (kefir_size_t i = begin; i < end; i++) {
+            REQUIRE_OK(translate_case_jump(mem, context, builder, flow_control_stmt, dispatch->cases[i].value_node,
+                                           dispatch->cases[i].range_end_node, dispatch->cases[i].point));
+        }
+        REQUIRE_OK(translate_default_jump(mem, builder, flow_control_stmt));
+        return KEFIR_OK;
+    }
+
+    const kefir_size_t middle = begin + (end - begin) / 2;
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_VSTACK_PICK, 0));
+    REQUIRE_OK(
+        KEFIR_IRBUILDER_BLOCK_APPENDI64(builder, KEFIR_IR_OPCODE_INT_CONST, dispatch->cases[middle].begin_value));
+    REQUIRE_OK(APPEND_COMPARISON(builder, dispatch->comparisons.less));
+    const kefir_size_t branch_index = KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder);
+    REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDU64_2(builder, KEFIR_IR_OPCODE_BRANCH, 0, KEFIR_IR_BRANCH_CONDITION_8BIT));
+    REQUIRE_OK(translate_binary_search_dispatch(mem, context, builder, flow_control_stmt, dispatch, middle, end));
+    KEFIR_IRBUILDER_BLOCK_INSTR_AT(builder, branch_index)->arg.i64 = KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder);
+    REQUIRE_OK(translate_binary_search_dispatch(mem, context, builder, flow_control_stmt, dispatch, begin, middle));
+    return KEFIR_OK;
+}
+
+static kefir_result_t translate_switch_dispatch(struct kefir_mem *mem, struct kefir_ast_translator_context *context,
+                                                struct kefir_irbuilder_block *builder,
+                                                struct kefir_ast_flow_control_structure *flow_control_stmt) {
+    struct switch_dispatch dispatch = {
+        .cases = NULL, .num_of_cases = flow_control_stmt->value.switchStatement.num_of_cases};
+
+    kefir_bool_t supported = dispatch.num_of_cases >= SWITCH_BINARY_SEARCH_MIN_CASES;
+    if (supported) {
+        kefir_ast_type_data_model_classification_t classification;
+        REQUIRE_OK(kefir_ast_type_data_model_classify(
+            context->ast_context->type_traits, flow_control_stmt->value.switchStatement.controlling_expression_type,
+            &classification));
+        REQUIRE_OK(kefir_ast_type_is_signed(context->ast_context->type_traits,
+                                            flow_control_stmt->value.switchStatement.controlling_expression_type,
+                                            &dispatch.signedness));
+        switch (classification) {
+            case KEFIR_AST_TYPE_DATA_MODEL_INT8:
+                dispatch.width = 8;
+                dispatch.extend_opcode = dispatch.signedness ? KEFIR_IR_OPCODE_INT64_SIGN_EXTEND_8BITS
+                                                             : KEFIR_IR_OPCODE_INT64_ZERO_EXTEND_8BITS;
+                break;
+
+            case KEFIR_AST_TYPE_DATA_MODEL_INT16:
+                dispatch.width = 16;
+                dispatch.extend_opcode = dispatch.signedness ? KEFIR_IR_OPCODE_INT64_SIGN_EXTEND_16BITS
+                                                             : KEFIR_IR_OPCODE_INT64_ZERO_EXTEND_16BITS;
+                break;
+
+            case KEFIR_AST_TYPE_DATA_MODEL_INT32:
+                dispatch.width = 32;
+                dispatch.extend_opcode = dispatch.signedness ? KEFIR_IR_OPCODE_INT64_SIGN_EXTEND_32BITS
+                                                             : KEFIR_IR_OPCODE_INT64_ZERO_EXTEND_32BITS;
+                break;
+
+            case KEFIR_AST_TYPE_DATA_MODEL_INT64:
+                dispatch.width = 64;
+                dispatch.extend_opcode = KEFIR_IR_OPCODE_NOP;
+                break;
+
+            default:
+                supported = false;
+                break;
+        }
+    }
+
+    if (supported) {
+        REQUIRE_OK(switch_comparisons_of(context, flow_control_stmt, &dispatch.comparisons));
+        dispatch.cases = KEFIR_MALLOC(mem, sizeof(struct switch_case) * dispatch.num_of_cases);
+        REQUIRE(dispatch.cases != NULL,
+                KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate switch statement case table"));
+        kefir_result_t res = collect_switch_cases(mem, context, flow_control_stmt, &dispatch, &supported);
+        REQUIRE_CHAIN(&res, supported ? translate_binary_search_dispatch(mem, context, builder, flow_control_stmt,
+                                                                         &dispatch, 0, dispatch.num_of_cases)
+                                      : KEFIR_OK);
+        KEFIR_FREE(mem, dispatch.cases);
+        REQUIRE_OK(res);
     }
 
+    if (!supported) {
+        REQUIRE_OK(translate_linear_dispatch(mem, context, builder, flow_control_stmt));
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_ast_translate_switch_statement_node(struct kefir_mem *mem,
+                                                         struct kefir_ast_translator_context *context,
+                                                         struct kefir_irbuilder_block *builder,
+                                                         const struct kefir_ast_switch_statement *node) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(context != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST translation context"));
+    REQUIRE(builder != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR block builder"));
+    REQUIRE(node != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST switch statement node"));
+
+    const kefir_size_t statement_begin_index = KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder);
+    kefir_ir_debug_entry_id_t lexical_block_entry_id;
+    REQUIRE_OK(kefir_ast_translator_context_push_debug_hierarchy_entry(mem, context, KEFIR_IR_DEBUG_ENTRY_LEXICAL_BLOCK,
+                                                                       &lexical_block_entry_id));
+    REQUIRE_OK(kefir_ir_debug_entry_add_attribute(mem, &context->module->debug_info.entries, &context->module->symbols,
+                                                  lexical_block_entry_id,
+                                                  &KEFIR_IR_DEBUG_ENTRY_ATTR_CODE_BEGIN(statement_begin_index)));
+
+    REQUIRE_OK(kefir_ast_translator_mark_associated_scope_objects_lifetime(
+        mem, context, builder, node->base.properties.statement_props.flow_control_statement));
+
+    REQUIRE_OK(kefir_ast_translate_expression(mem, node->expression, builder, context));
+
+    struct kefir_ast_flow_control_structure *flow_control_stmt =
+        node->base.properties.statement_props.flow_control_statement;
+    REQUIRE_OK(kefir_ast_translate_typeconv(mem, context->module, builder, context->ast_context->type_traits,
+                                            node->expression->properties.type,
+                                            flow_control_stmt->value.switchStatement.controlling_expression_type));
+    REQUIRE_OK(translate_switch_dispatch(mem, context, builder, flow_control_stmt));
+
     REQUIRE_OK(kefir_ast_translate_statement(mem, node->statement, builder, context));
     REQUIRE_OK(kefir_ast_translator_flow_control_point_resolve(mem, flow_control_stmt->value.switchStatement.end,
                                                                KEFIR_IRBUILDER_BLOCK_CURRENT_INDEX(builder)));
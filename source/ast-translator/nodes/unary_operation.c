@@ -372,18 +372,13 @@ static kefir_result_t translate_indirection(struct kefir_mem *mem, struct kefir_
     const struct kefir_ast_type *normalized_type = kefir_ast_translator_normalize_type(node->base.properties.type);
     REQUIRE_OK(kefir_ast_translate_expression(mem, node->arg, builder, context));
     if (normalized_type->tag != KEFIR_AST_TYPE_VOID) {
-        if (node->base.properties.expression_props.atomic) {
-            kefir_bool_t atomic_aggregate;
-            REQUIRE_OK(kefir_ast_translator_atomic_load_value(
-                node->base.properties.type, context->ast_context->type_traits, builder, &atomic_aggregate));
-            if (atomic_aggregate) {
-                REQUIRE_OK(kefir_ast_translator_load_atomic_aggregate_value(
-                    mem, node->base.properties.type, context, builder,
-                    &node->base.properties.expression_props.temporary_identifier, &node->base.source_location));
-            }
-        } else {
-            REQUIRE_OK(kefir_ast_translator_load_value(node->base.properties.type, context->ast_context->type_traits,
-                                                       builder));
+        kefir_bool_t atomic_aggregate;
+        REQUIRE_OK(
+            kefir_ast_translator_resolve_lvalue(mem, context, builder, KEFIR_AST_NODE_BASE(node), &atomic_aggregate));
+        if (atomic_aggregate) {
+            REQUIRE_OK(kefir_ast_translator_load_atomic_aggregate_value(
+                mem, node->base.properties.type, context, builder,
+                &node->base.properties.expression_props.temporary_identifier, &node->base.source_location));
         }
     } else {
         REQUIRE_OK(KEFIR_IRBUILDER_BLOCK_APPENDU64(builder, KEFIR_IR_OPCODE_VSTACK_POP, 0));
@@ -56,7 +56,7 @@ static kefir_result_t local_static_identifier(struct kefir_mem *mem, struct kefi
 }
 
 static kefir_result_t translate_pointer_to_identifier(struct kefir_mem *mem,
-                                                      struct kefir_ast_constant_expression_value *value,
+                                                      const struct kefir_ast_constant_expression_value *value,
                                                       struct kefir_ir_module *module, struct kefir_ir_data *data,
                                                       kefir_size_t base_slot) {
     if (value->pointer.scoped_id == NULL) {
@@ -184,36 +184,11 @@ const kefir_ir_string_literal_type_t KefirAstIrStringLiteralTypes[] = {
     [KEFIR_AST_STRING_LITERAL_UNICODE32] = KEFIR_IR_STRING_LITERAL_UNICODE32,
     [KEFIR_AST_STRING_LITERAL_WIDE] = KEFIR_IR_STRING_LITERAL_UNICODE32};
 
-static kefir_result_t visit_value(const struct kefir_ast_designator *designator, struct kefir_ast_node_base *expression,
-                                  void *payload) {
-    REQUIRE(expression != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid AST expression node"));
-    REQUIRE(payload != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid payload"));
-    ASSIGN_DECL_CAST(struct traversal_param *, param, payload);
-
-    struct kefir_ast_type_layout *resolved_layout = NULL;
-    kefir_size_t slot = 0;
-    REQUIRE_OK(resolve_designated_slot(param->type_layout, designator, &param->ir_type_tree, param->base_slot,
-                                       &resolved_layout, &slot, &expression->source_location));
-
-    struct kefir_ast_constant_expression_value value;
-    REQUIRE(KEFIR_AST_NODE_IS_CONSTANT_EXPRESSION(expression),
-            KEFIR_SET_SOURCE_ERROR(KEFIR_NOT_CONSTANT, &expression->source_location,
-                                   "Unable to evaluate constant expression"));
-    if (KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(expression)->klass == KEFIR_AST_CONSTANT_EXPRESSION_CLASS_COMPOUND) {
-        const struct kefir_ast_type *expr_type =
-            kefir_ast_unqualified_type(KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(expression)->compound.type);
-        REQUIRE(KEFIR_AST_TYPE_COMPATIBLE(param->context->type_traits, resolved_layout->type, expr_type),
-                KEFIR_SET_SOURCE_ERROR(KEFIR_ANALYSIS_ERROR, &expression->source_location,
-                                       "Compound literal type mismatch"));
-        value = *KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(expression);
-    } else {
-        REQUIRE_OK(kefir_ast_constant_expression_value_cast(
-            param->mem, param->context, &value, KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(expression), expression,
-            resolved_layout->type, expression->properties.type));
-    }
+static kefir_result_t set_value(struct traversal_param *param, struct kefir_ast_type_layout *resolved_layout,
+                                kefir_size_t slot, const struct kefir_ast_constant_expression_value *value) {
     struct kefir_ir_typeentry *target_typeentry = kefir_ir_type_at(param->type, resolved_layout->value);
     REQUIRE(target_typeentry != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Cannot obtain target IR type entry"));
-    switch (value.klass) {
+    switch (value->klass) {
         case KEFIR_AST_CONSTANT_EXPRESSION_CLASS_NONE:
             return KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Unexpected constant expression value type");
 
@@ -226,15 +201,15 @@ static kefir_result_t visit_value(const struct kefir_ast_designator *designator,
                 case KEFIR_IR_TYPE_BITINT:
                 case KEFIR_IR_TYPE_BITFIELD:
                 case KEFIR_IR_TYPE_INT128:
-                    if (value.bitprecise != NULL) {
-                        kefir_size_t bitwidth = value.bitprecise->bitwidth;
+                    if (value->bitprecise != NULL) {
+                        kefir_size_t bitwidth = value->bitprecise->bitwidth;
                         if (resolved_layout->bitfield) {
                             bitwidth = MIN(bitwidth, resolved_layout->bitfield_props.width);
                         }
                         for (kefir_size_t i = 0; i < bitwidth; i += sizeof(kefir_uint64_t)) {
                             const kefir_size_t width = MIN(bitwidth - i, sizeof(kefir_uint64_t));
                             kefir_uint64_t part;
-                            REQUIRE_OK(kefir_bigint_get_bits(value.bitprecise, i, width, &part));
+                            REQUIRE_OK(kefir_bigint_get_bits(value->bitprecise, i, width, &part));
                             if (resolved_layout->bitfield) {
                                 REQUIRE_OK(kefir_ir_data_set_bitfield(param->mem, param->data, slot, part,
                                                                       i + resolved_layout->bitfield_props.offset,
@@ -244,45 +219,45 @@ static kefir_result_t visit_value(const struct kefir_ast_designator *designator,
                             }
                         }
                     } else if (resolved_layout->bitfield) {
-                        REQUIRE_OK(kefir_ir_data_set_bitfield(param->mem, param->data, slot, value.integer,
+                        REQUIRE_OK(kefir_ir_data_set_bitfield(param->mem, param->data, slot, value->integer,
                                                               resolved_layout->bitfield_props.offset,
                                                               resolved_layout->bitfield_props.width));
                     } else {
-                        REQUIRE_OK(kefir_ir_data_set_integer(param->mem, param->data, slot, value.integer));
+                        REQUIRE_OK(kefir_ir_data_set_integer(param->mem, param->data, slot, value->integer));
                     }
                     break;
 
                 case KEFIR_IR_TYPE_FLOAT32:
                     REQUIRE_OK(
-                        kefir_ir_data_set_float32(param->mem, param->data, slot, (kefir_float32_t) value.integer));
+                        kefir_ir_data_set_float32(param->mem, param->data, slot, (kefir_float32_t) value->integer));
                     break;
 
                 case KEFIR_IR_TYPE_FLOAT64:
                     REQUIRE_OK(
-                        kefir_ir_data_set_float64(param->mem, param->data, slot, (kefir_float64_t) value.integer));
+                        kefir_ir_data_set_float64(param->mem, param->data, slot, (kefir_float64_t) value->integer));
                     break;
 
                 case KEFIR_IR_TYPE_LONG_DOUBLE:
                     REQUIRE_OK(kefir_ir_data_set_long_double(param->mem, param->data, slot,
-                                                             (kefir_long_double_t) value.integer));
+                                                             (kefir_long_double_t) value->integer));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL32:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_decimal32(param->mem, param->data, slot,
-                                                           kefir_dfp_decimal32_from_int64(value.integer)));
+                                                           kefir_dfp_decimal32_from_int64(value->integer)));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL64:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_decimal64(param->mem, param->data, slot,
-                                                           kefir_dfp_decimal64_from_int64(value.integer)));
+                                                           kefir_dfp_decimal64_from_int64(value->integer)));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL128:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_decimal128(param->mem, param->data, slot,
-                                                            kefir_dfp_decimal128_from_int64(value.integer)));
+                                                            kefir_dfp_decimal128_from_int64(value->integer)));
                     break;
 
                 default:
@@ -297,52 +272,52 @@ static kefir_result_t visit_value(const struct kefir_ast_designator *designator,
                 case KEFIR_IR_TYPE_INT32:
                 case KEFIR_IR_TYPE_INT64:
                     REQUIRE_OK(
-                        kefir_ir_data_set_integer(param->mem, param->data, slot, (kefir_int64_t) value.floating_point));
+                        kefir_ir_data_set_integer(param->mem, param->data, slot, (kefir_int64_t) value->floating_point));
                     break;
 
                 case KEFIR_IR_TYPE_FLOAT32:
-                    REQUIRE_OK(kefir_ir_data_set_float32(param->mem, param->data, slot, value.floating_point));
+                    REQUIRE_OK(kefir_ir_data_set_float32(param->mem, param->data, slot, value->floating_point));
                     break;
 
                 case KEFIR_IR_TYPE_FLOAT64:
-                    REQUIRE_OK(kefir_ir_data_set_float64(param->mem, param->data, slot, value.floating_point));
+                    REQUIRE_OK(kefir_ir_data_set_float64(param->mem, param->data, slot, value->floating_point));
                     break;
 
                 case KEFIR_IR_TYPE_LONG_DOUBLE:
-                    REQUIRE_OK(kefir_ir_data_set_long_double(param->mem, param->data, slot, value.floating_point));
+                    REQUIRE_OK(kefir_ir_data_set_long_double(param->mem, param->data, slot, value->floating_point));
                     break;
 
                 case KEFIR_IR_TYPE_COMPLEX_FLOAT32:
                     REQUIRE_OK(
-                        kefir_ir_data_set_complex_float32(param->mem, param->data, slot, value.floating_point, 0.0f));
+                        kefir_ir_data_set_complex_float32(param->mem, param->data, slot, value->floating_point, 0.0f));
                     break;
 
                 case KEFIR_IR_TYPE_COMPLEX_FLOAT64:
                     REQUIRE_OK(
-                        kefir_ir_data_set_complex_float64(param->mem, param->data, slot, value.floating_point, 0.0));
+                        kefir_ir_data_set_complex_float64(param->mem, param->data, slot, value->floating_point, 0.0));
                     break;
 
                 case KEFIR_IR_TYPE_COMPLEX_LONG_DOUBLE:
                     REQUIRE_OK(kefir_ir_data_set_complex_long_double(param->mem, param->data, slot,
-                                                                     value.floating_point, 0.0L));
+                                                                     value->floating_point, 0.0L));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL32:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_decimal32(param->mem, param->data, slot,
-                                                           kefir_dfp_decimal32_from_long_double(value.floating_point)));
+                                                           kefir_dfp_decimal32_from_long_double(value->floating_point)));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL64:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_decimal64(param->mem, param->data, slot,
-                                                           kefir_dfp_decimal64_from_long_double(value.floating_point)));
+                                                           kefir_dfp_decimal64_from_long_double(value->floating_point)));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL128:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_decimal128(
-                        param->mem, param->data, slot, kefir_dfp_decimal128_from_long_double(value.floating_point)));
+                        param->mem, param->data, slot, kefir_dfp_decimal128_from_long_double(value->floating_point)));
                     break;
 
                 default:
@@ -358,59 +333,59 @@ static kefir_result_t visit_value(const struct kefir_ast_designator *designator,
                 case KEFIR_IR_TYPE_INT64:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_integer(param->mem, param->data, slot,
-                                                         kefir_dfp_decimal128_to_int64(value.decimal)));
+                                                         kefir_dfp_decimal128_to_int64(value->decimal)));
                     break;
 
                 case KEFIR_IR_TYPE_FLOAT32:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_float32(param->mem, param->data, slot,
-                                                         kefir_dfp_decimal128_to_float(value.decimal)));
+                                                         kefir_dfp_decimal128_to_float(value->decimal)));
                     break;
 
                 case KEFIR_IR_TYPE_FLOAT64:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_float64(param->mem, param->data, slot,
-                                                         kefir_dfp_decimal128_to_double(value.decimal)));
+                                                         kefir_dfp_decimal128_to_double(value->decimal)));
                     break;
 
                 case KEFIR_IR_TYPE_LONG_DOUBLE:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_long_double(param->mem, param->data, slot,
-                                                             kefir_dfp_decimal128_to_double(value.decimal)));
+                                                             kefir_dfp_decimal128_to_double(value->decimal)));
                     break;
 
                 case KEFIR_IR_TYPE_COMPLEX_FLOAT32:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_complex_float32(param->mem, param->data, slot,
-                                                                 kefir_dfp_decimal128_to_float(value.decimal), 0.0f));
+                                                                 kefir_dfp_decimal128_to_float(value->decimal), 0.0f));
                     break;
 
                 case KEFIR_IR_TYPE_COMPLEX_FLOAT64:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_complex_float64(param->mem, param->data, slot,
-                                                                 kefir_dfp_decimal128_to_double(value.decimal), 0.0));
+                                                                 kefir_dfp_decimal128_to_double(value->decimal), 0.0));
                     break;
 
                 case KEFIR_IR_TYPE_COMPLEX_LONG_DOUBLE:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_complex_long_double(
-                        param->mem, param->data, slot, kefir_dfp_decimal128_to_long_double(value.decimal), 0.0L));
+                        param->mem, param->data, slot, kefir_dfp_decimal128_to_long_double(value->decimal), 0.0L));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL32:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_decimal32(param->mem, param->data, slot,
-                                                           kefir_dfp_decimal32_from_decimal128(value.decimal)));
+                                                           kefir_dfp_decimal32_from_decimal128(value->decimal)));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL64:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_decimal64(param->mem, param->data, slot,
-                                                           kefir_dfp_decimal64_from_decimal128(value.decimal)));
+                                                           kefir_dfp_decimal64_from_decimal128(value->decimal)));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL128:
-                    REQUIRE_OK(kefir_ir_data_set_decimal128(param->mem, param->data, slot, value.decimal));
+                    REQUIRE_OK(kefir_ir_data_set_decimal128(param->mem, param->data, slot, value->decimal));
                     break;
 
                 default:
@@ -425,61 +400,61 @@ static kefir_result_t visit_value(const struct kefir_ast_designator *designator,
                 case KEFIR_IR_TYPE_INT32:
                 case KEFIR_IR_TYPE_INT64:
                     REQUIRE_OK(kefir_ir_data_set_integer(param->mem, param->data, slot,
-                                                         (kefir_int64_t) value.complex_floating_point.real));
+                                                         (kefir_int64_t) value->complex_floating_point.real));
                     break;
 
                 case KEFIR_IR_TYPE_FLOAT32:
                     REQUIRE_OK(
-                        kefir_ir_data_set_float32(param->mem, param->data, slot, value.complex_floating_point.real));
+                        kefir_ir_data_set_float32(param->mem, param->data, slot, value->complex_floating_point.real));
                     break;
 
                 case KEFIR_IR_TYPE_FLOAT64:
                     REQUIRE_OK(
-                        kefir_ir_data_set_float64(param->mem, param->data, slot, value.complex_floating_point.real));
+                        kefir_ir_data_set_float64(param->mem, param->data, slot, value->complex_floating_point.real));
                     break;
 
                 case KEFIR_IR_TYPE_LONG_DOUBLE:
                     REQUIRE_OK(kefir_ir_data_set_long_double(param->mem, param->data, slot,
-                                                             value.complex_floating_point.real));
+                                                             value->complex_floating_point.real));
                     break;
 
                 case KEFIR_IR_TYPE_COMPLEX_FLOAT32:
                     REQUIRE_OK(kefir_ir_data_set_complex_float32(param->mem, param->data, slot,
-                                                                 value.complex_floating_point.real,
-                                                                 value.complex_floating_point.imaginary));
+                                                                 value->complex_floating_point.real,
+                                                                 value->complex_floating_point.imaginary));
                     break;
 
                 case KEFIR_IR_TYPE_COMPLEX_FLOAT64:
                     REQUIRE_OK(kefir_ir_data_set_complex_float64(param->mem, param->data, slot,
-                                                                 value.complex_floating_point.real,
-                                                                 value.complex_floating_point.imaginary));
+                                                                 value->complex_floating_point.real,
+                                                                 value->complex_floating_point.imaginary));
                     break;
 
                 case KEFIR_IR_TYPE_COMPLEX_LONG_DOUBLE:
                     REQUIRE_OK(kefir_ir_data_set_complex_long_double(param->mem, param->data, slot,
-                                                                     value.complex_floating_point.real,
-                                                                     value.complex_floating_point.imaginary));
+                                                                     value->complex_floating_point.real,
+                                                                     value->complex_floating_point.imaginary));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL32:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_decimal32(
                         param->mem, param->data, slot,
-                        kefir_dfp_decimal32_from_long_double(value.complex_floating_point.real)));
+                        kefir_dfp_decimal32_from_long_double(value->complex_floating_point.real)));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL64:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_decimal64(
                         param->mem, param->data, slot,
-                        kefir_dfp_decimal64_from_long_double(value.complex_floating_point.real)));
+                        kefir_dfp_decimal64_from_long_double(value->complex_floating_point.real)));
                     break;
 
                 case KEFIR_IR_TYPE_DECIMAL128:
                     REQUIRE_OK(kefir_dfp_require_supported(NULL));
                     REQUIRE_OK(kefir_ir_data_set_decimal128(
                         param->mem, param->data, slot,
-                        kefir_dfp_decimal128_from_long_double(value.complex_floating_point.real)));
+                        kefir_dfp_decimal128_from_long_double(value->complex_floating_point.real)));
                     break;
 
                 default:
@@ -488,30 +463,30 @@ static kefir_result_t visit_value(const struct kefir_ast_designator *designator,
             break;
 
         case KEFIR_AST_CONSTANT_EXPRESSION_CLASS_ADDRESS:
-            switch (value.pointer.type) {
+            switch (value->pointer.type) {
                 case KEFIR_AST_CONSTANT_EXPRESSION_POINTER_IDENTIFER:
-                    REQUIRE_OK(translate_pointer_to_identifier(param->mem, &value, param->module, param->data, slot));
+                    REQUIRE_OK(translate_pointer_to_identifier(param->mem, value, param->module, param->data, slot));
                     break;
 
                 case KEFIR_AST_CONSTANT_EXPRESSION_POINTER_INTEGER:
                     REQUIRE_OK(kefir_ir_data_set_integer(param->mem, param->data, slot,
-                                                         value.pointer.base.integral + value.pointer.offset));
+                                                         value->pointer.base.integral + value->pointer.offset));
                     break;
 
                 case KEFIR_AST_CONSTANT_EXPRESSION_POINTER_LITERAL: {
                     kefir_id_t id;
                     REQUIRE_OK(kefir_ir_module_string_literal(
-                        param->mem, param->module, KefirAstIrStringLiteralTypes[value.pointer.base.string.type], true,
-                        value.pointer.base.string.content, value.pointer.base.string.length, &id));
+                        param->mem, param->module, KefirAstIrStringLiteralTypes[value->pointer.base.string.type], true,
+                        value->pointer.base.string.content, value->pointer.base.string.length, &id));
                     REQUIRE_OK(
-                        kefir_ir_data_set_string_pointer(param->mem, param->data, slot, id, value.pointer.offset));
+                        kefir_ir_data_set_string_pointer(param->mem, param->data, slot, id, value->pointer.offset));
                 } break;
             }
             break;
 
         case KEFIR_AST_CONSTANT_EXPRESSION_CLASS_COMPOUND:
             REQUIRE_OK(kefir_ast_translate_data_initializer(param->mem, param->context, param->module, resolved_layout,
-                                                            param->type, value.compound.initializer, param->data,
+                                                            param->type, value->compound.initializer, param->data,
                                                             slot));
             break;
     }
@@ -519,6 +494,59 @@ static kefir_result_t visit_value(const struct kefir_ast_designator *designator,
     return KEFIR_OK;
 }
 
+static kefir_result_t visit_value(const struct kefir_ast_designator *designator, struct kefir_ast_node_base *expression,
+                                  void *payload) {
+    REQUIRE(expression != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid AST expression node"));
+    REQUIRE(payload != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid payload"));
+    ASSIGN_DECL_CAST(struct traversal_param *, param, payload);
+
+    struct kefir_ast_type_layout *resolved_layout = NULL;
+    kefir_size_t slot = 0;
+    REQUIRE_OK(resolve_designated_slot(param->type_layout, designator, &param->ir_type_tree, param->base_slot,
+                                       &resolved_layout, &slot, &expression->source_location));
+
+    struct kefir_ast_constant_expression_value value;
+    REQUIRE(KEFIR_AST_NODE_IS_CONSTANT_EXPRESSION(expression),
+            KEFIR_SET_SOURCE_ERROR(KEFIR_NOT_CONSTANT, &expression->source_location,
+                                   "Unable to evaluate constant expression"));
+    if (KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(expression)->klass == KEFIR_AST_CONSTANT_EXPRESSION_CLASS_COMPOUND) {
+        const struct kefir_ast_type *expr_type =
+            kefir_ast_unqualified_type(KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(expression)->compound.type);
+        REQUIRE(KEFIR_AST_TYPE_COMPATIBLE(param->context->type_traits, resolved_layout->type, expr_type),
+                KEFIR_SET_SOURCE_ERROR(KEFIR_ANALYSIS_ERROR, &expression->source_location,
+                                       "Compound literal type mismatch"));
+        value = *KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(expression);
+    } else {
+        REQUIRE_OK(kefir_ast_constant_expression_value_cast(
+            param->mem, param->context, &value, KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(expression), expression,
+            resolved_layout->type, expression->properties.type));
+    }
+    REQUIRE_OK(set_value(param, resolved_layout, slot, &value));
+    return KEFIR_OK;
+}
+
+static kefir_result_t visit_embed_value(const struct kefir_ast_designator *designator,
+                                        struct kefir_ast_node_base *expression, kefir_uint8_t embed_value,
+                                        void *payload) {
+    REQUIRE(expression != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid AST expression node"));
+    REQUIRE(payload != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid payload"));
+    ASSIGN_DECL_CAST(struct traversal_param *, param, payload);
+
+    struct kefir_ast_type_layout *resolved_layout = NULL;
+    kefir_size_t slot = 0;
+    REQUIRE_OK(resolve_designated_slot(param->type_layout, designator, &param->ir_type_tree, param->base_slot,
+                                       &resolved_layout, &slot, &expression->source_location));
+
+    struct kefir_ast_constant_expression_value value;
+    const struct kefir_ast_constant_expression_value embed_constant = {
+        .klass = KEFIR_AST_CONSTANT_EXPRESSION_CLASS_INTEGER, .integer = embed_value};
+    REQUIRE_OK(kefir_ast_constant_expression_value_cast(param->mem, param->context, &value, &embed_constant,
+                                                        expression, resolved_layout->type,
+                                                        kefir_ast_type_signed_int()));
+    REQUIRE_OK(set_value(param, resolved_layout, slot, &value));
+    return KEFIR_OK;
+}
+
 static kefir_result_t visit_string_literal(const struct kefir_ast_designator *designator,
                                            struct kefir_ast_node_base *expression, kefir_ast_string_literal_type_t type,
                                            const void *string, kefir_size_t length, void *payload) {
@@ -596,6 +624,7 @@ kefir_result_t kefir_ast_translate_data_initializer(struct kefir_mem *mem, const
     KEFIR_AST_INITIALIZER_TRAVERSAL_INIT(&initializer_traversal);
     initializer_traversal.visit_value = visit_value;
     initializer_traversal.visit_string_literal = visit_string_literal;
+    initializer_traversal.visit_embed_value = visit_embed_value;
     initializer_traversal.visit_initializer_list = visit_initializer_list;
     initializer_traversal.payload = &param;
 
@@ -111,6 +111,18 @@ static kefir_result_t resolve_flexible_array_member_visit_value(const struct kef
     return KEFIR_OK;
 }
 
+static kefir_result_t resolve_flexible_array_member_visit_embed_value(const struct kefir_ast_designator *designator,
+                                                                      struct kefir_ast_node_base *expression,
+                                                                      kefir_uint8_t value, void *payload) {
+    UNUSED(value);
+    REQUIRE(expression != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST expression"));
+    REQUIRE(payload != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid flexible array member resolution params"));
+
+    REQUIRE_OK(kefir_ast_designator_unroll(designator, resolve_flexible_array_member_designator_callback, payload));
+    return KEFIR_OK;
+}
+
 static kefir_result_t resolve_flexible_array_member_visit_initializer_list(
     const struct kefir_ast_designator *designator, const struct kefir_ast_initializer *initializer, void *payload) {
     REQUIRE(initializer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST initializer"));
@@ -152,6 +164,7 @@ static kefir_result_t resolve_flexible_array_member(struct kefir_mem *mem, const
     struct kefir_ast_initializer_traversal initializer_traversal;
     KEFIR_AST_INITIALIZER_TRAVERSAL_INIT(&initializer_traversal);
     initializer_traversal.visit_value = resolve_flexible_array_member_visit_value;
+    initializer_traversal.visit_embed_value = resolve_flexible_array_member_visit_embed_value;
     initializer_traversal.visit_initializer_list = resolve_flexible_array_member_visit_initializer_list;
     initializer_traversal.payload = &payload;
     REQUIRE_OK(kefir_ast_traverse_initializer(mem, context, initializer, object_type, &initializer_traversal));
@@ -421,6 +421,128 @@ static kefir_result_t store_bitfield(struct kefir_irbuilder_block *builder, cons
     return KEFIR_OK;
 }
 
+static kefir_result_t load_value_impl(const struct kefir_ast_type *, const struct kefir_ast_type_traits *,
+                                      struct kefir_irbuilder_block *, kefir_uint64_t);
+static kefir_result_t store_value_impl(struct kefir_mem *, const struct kefir_ast_type *,
+                                       struct kefir_ast_translator_context *, struct kefir_irbuilder_block *,
+                                       const struct kefir_source_location *, kefir_uint64_t);
+
+static kefir_bool_t is_union_member_lvalue(const struct kefir_ast_node_base *node) {
+    for (;;) {
+        if (node->klass->type == KEFIR_AST_STRUCTURE_MEMBER ||
+            node->klass->type == KEFIR_AST_STRUCTURE_INDIRECT_MEMBER) {
+            ASSIGN_DECL_CAST(const struct kefir_ast_struct_member *, struct_member, node->self);
+            const struct kefir_ast_type *structure_type =
+                kefir_ast_unqualified_type(struct_member->structure->properties.type);
+            if (node->klass->type == KEFIR_AST_STRUCTURE_INDIRECT_MEMBER) {
+                if (structure_type->tag != KEFIR_AST_TYPE_SCALAR_POINTER) {
+                    return false;
+                }
+                structure_type = kefir_ast_unqualified_type(structure_type->referenced_type);
+            }
+            if (structure_type->tag == KEFIR_AST_TYPE_UNION) {
+                return true;
+            }
+            if (node->klass->type == KEFIR_AST_STRUCTURE_INDIRECT_MEMBER) {
+                return false;
+            }
+            node = struct_member->structure;
+        } else if (node->klass->type == KEFIR_AST_ARRAY_SUBSCRIPT) {
+            ASSIGN_DECL_CAST(const struct kefir_ast_array_subscript *, subscript, node->self);
+            if (kefir_ast_unqualified_type(subscript->array->properties.type)->tag == KEFIR_AST_TYPE_ARRAY) {
+                node = subscript->array;
+            } else if (kefir_ast_unqualified_type(subscript->subscript->properties.type)->tag == KEFIR_AST_TYPE_ARRAY) {
+                node = subscript->subscript;
+            } else {
+                return false;
+            }
+        } else {
+            return false;
+        }
+    }
+}
+
+static kefir_result_t type_alias_tag(const struct kefir_ast_type_traits *type_traits, const struct kefir_ast_type *type,
+                                     kefir_ir_memory_alias_tag_t *tag) {
+    const struct kefir_ast_type *normalizer = kefir_ast_translator_normalize_type(type);
+    *tag = KEFIR_IR_MEMORY_ALIAS_TAG_ANY;
+    if (normalizer->tag == KEFIR_AST_TYPE_SCALAR_BOOL) {
+        *tag = KEFIR_IR_MEMORY_ALIAS_TAG_BOOL;
+        return KEFIR_OK;
+    } else if (normalizer->tag == KEFIR_AST_TYPE_SCALAR_POINTER) {
+        *tag = KEFIR_IR_MEMORY_ALIAS_TAG_POINTER;
+        return KEFIR_OK;
+    } else if (normalizer->tag == KEFIR_AST_TYPE_SCALAR_NULL_POINTER) {
+        return KEFIR_OK;
+    }
+
+    // Types sharing the same representation (signed and unsigned variants, enumerations and their underlying
+    // types, complex numbers and their components) share the alias tag. Character types alias anything.
+    kefir_ast_type_data_model_classification_t data_model;
+    REQUIRE_OK(kefir_ast_type_data_model_classify(type_traits, normalizer, &data_model));
+    switch (data_model) {
+        case KEFIR_AST_TYPE_DATA_MODEL_INT16:
+            *tag = KEFIR_IR_MEMORY_ALIAS_TAG_SHORT;
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_INT32:
+            *tag = KEFIR_IR_MEMORY_ALIAS_TAG_INT;
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_INT64:
+            *tag = KEFIR_IR_MEMORY_ALIAS_TAG_LONG;
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_INT128:
+            *tag = KEFIR_IR_MEMORY_ALIAS_TAG_INT128;
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_FLOAT:
+        case KEFIR_AST_TYPE_DATA_MODEL_COMPLEX_FLOAT:
+            *tag = KEFIR_IR_MEMORY_ALIAS_TAG_FLOAT;
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_DOUBLE:
+        case KEFIR_AST_TYPE_DATA_MODEL_COMPLEX_DOUBLE:
+            *tag = KEFIR_IR_MEMORY_ALIAS_TAG_DOUBLE;
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_LONG_DOUBLE:
+        case KEFIR_AST_TYPE_DATA_MODEL_COMPLEX_LONG_DOUBLE:
+            *tag = KEFIR_IR_MEMORY_ALIAS_TAG_LONG_DOUBLE;
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_DECIMAL32:
+            *tag = KEFIR_IR_MEMORY_ALIAS_TAG_DECIMAL32;
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_DECIMAL64:
+            *tag = KEFIR_IR_MEMORY_ALIAS_TAG_DECIMAL64;
+            break;
+
+        case KEFIR_AST_TYPE_DATA_MODEL_DECIMAL128:
+            *tag = KEFIR_IR_MEMORY_ALIAS_TAG_DECIMAL128;
+            break;
+
+        default:
+            // Intentionally left blank
+            break;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t retrieve_lvalue_alias_flags(struct kefir_ast_translator_context *context,
+                                                  const struct kefir_ast_node_base *node, kefir_uint64_t *alias_flags) {
+    *alias_flags = KEFIR_IR_MEMORY_FLAG_NONE;
+    REQUIRE(context->environment->configuration->strict_aliasing, KEFIR_OK);
+    REQUIRE(!is_union_member_lvalue(node), KEFIR_OK);
+
+    kefir_ir_memory_alias_tag_t tag;
+    REQUIRE_OK(type_alias_tag(context->ast_context->type_traits, node->properties.type, &tag));
+    *alias_flags = KEFIR_IR_MEMORY_FLAG_ALIAS_TAG(tag);
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_ast_translator_resolve_lvalue(struct kefir_mem *mem, struct kefir_ast_translator_context *context,
                                                    struct kefir_irbuilder_block *builder,
                                                    const struct kefir_ast_node_base *node,
@@ -444,7 +566,9 @@ kefir_result_t kefir_ast_translator_resolve_lvalue(struct kefir_mem *mem, struct
         REQUIRE_OK(kefir_ast_translator_atomic_load_value(node->properties.type, context->ast_context->type_traits,
                                                           builder, atomic_aggregate));
     } else {
-        REQUIRE_OK(kefir_ast_translator_load_value(node->properties.type, context->ast_context->type_traits, builder));
+        kefir_uint64_t alias_flags;
+        REQUIRE_OK(retrieve_lvalue_alias_flags(context, node, &alias_flags));
+        REQUIRE_OK(load_value_impl(node->properties.type, context->ast_context->type_traits, builder, alias_flags));
     }
     return KEFIR_OK;
 }
@@ -497,23 +621,20 @@ kefir_result_t kefir_ast_translator_store_lvalue(struct kefir_mem *mem, struct k
     } else if (node->properties.expression_props.atomic) {
         REQUIRE_OK(atomic_store_value(mem, node->properties.type, context, builder, &node->source_location));
     } else {
-        REQUIRE_OK(
-            kefir_ast_translator_store_value(mem, node->properties.type, context, builder, &node->source_location));
+        kefir_uint64_t alias_flags;
+        REQUIRE_OK(retrieve_lvalue_alias_flags(context, node, &alias_flags));
+        REQUIRE_OK(store_value_impl(mem, node->properties.type, context, builder, &node->source_location, alias_flags));
     }
     return KEFIR_OK;
 }
 
-kefir_result_t kefir_ast_translator_load_value(const struct kefir_ast_type *type,
-                                               const struct kefir_ast_type_traits *type_traits,
-                                               struct kefir_irbuilder_block *builder) {
-    UNUSED(type_traits);
-    REQUIRE(type != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST type"));
-    REQUIRE(builder != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR block builder"));
-
+static kefir_result_t load_value_impl(const struct kefir_ast_type *type,
+                                      const struct kefir_ast_type_traits *type_traits,
+                                      struct kefir_irbuilder_block *builder, kefir_uint64_t alias_flags) {
     REQUIRE(!KEFIR_AST_TYPE_IS_ATOMIC(type),
             KEFIR_SET_ERROR(KEFIR_INVALID_REQUEST, "Atomic value loads shall use specialized function"));
 
-    const kefir_uint64_t mem_flags = retrieve_memflags(type);
+    const kefir_uint64_t mem_flags = retrieve_memflags(type) | alias_flags;
     const struct kefir_ast_type *normalizer = kefir_ast_translator_normalize_type(type);
 
     kefir_ast_type_data_model_classification_t normalized_data_model;
@@ -596,6 +717,16 @@ kefir_result_t kefir_ast_translator_load_value(const struct kefir_ast_type *type
     return KEFIR_OK;
 }
 
+kefir_result_t kefir_ast_translator_load_value(const struct kefir_ast_type *type,
+                                               const struct kefir_ast_type_traits *type_traits,
+                                               struct kefir_irbuilder_block *builder) {
+    REQUIRE(type != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST type"));
+    REQUIRE(builder != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR block builder"));
+
+    REQUIRE_OK(load_value_impl(type, type_traits, builder, KEFIR_IR_MEMORY_FLAG_NONE));
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_ast_translator_atomic_load_value(const struct kefir_ast_type *type,
                                                       const struct kefir_ast_type_traits *type_traits,
                                                       struct kefir_irbuilder_block *builder,
@@ -835,22 +966,18 @@ static kefir_result_t atomic_store_value(struct kefir_mem *mem, const struct kef
     return KEFIR_OK;
 }
 
-kefir_result_t kefir_ast_translator_store_value(struct kefir_mem *mem, const struct kefir_ast_type *type,
-                                                struct kefir_ast_translator_context *context,
-                                                struct kefir_irbuilder_block *builder,
-                                                const struct kefir_source_location *source_location) {
-    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
-    REQUIRE(type != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST type"));
-    REQUIRE(context != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST translator context"));
-    REQUIRE(builder != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR block builder"));
-
+static kefir_result_t store_value_impl(struct kefir_mem *mem, const struct kefir_ast_type *type,
+                                       struct kefir_ast_translator_context *context,
+                                       struct kefir_irbuilder_block *builder,
+                                       const struct kefir_source_location *source_location,
+                                       kefir_uint64_t alias_flags) {
     if (KEFIR_AST_TYPE_IS_ATOMIC(type)) {
         REQUIRE_OK(atomic_store_value(mem, type, context, builder, source_location));
         return KEFIR_OK;
     }
 
     const struct kefir_ast_type *normalizer = kefir_ast_translator_normalize_type(type);
-    const kefir_uint64_t mem_flags = retrieve_memflags(type);
+    const kefir_uint64_t mem_flags = retrieve_memflags(type) | alias_flags;
 
     kefir_ast_type_data_model_classification_t normalized_data_model;
     REQUIRE_OK(
@@ -939,6 +1066,19 @@ kefir_result_t kefir_ast_translator_store_value(struct kefir_mem *mem, const str
     return KEFIR_OK;
 }
 
+kefir_result_t kefir_ast_translator_store_value(struct kefir_mem *mem, const struct kefir_ast_type *type,
+                                                struct kefir_ast_translator_context *context,
+                                                struct kefir_irbuilder_block *builder,
+                                                const struct kefir_source_location *source_location) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(type != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST type"));
+    REQUIRE(context != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST translator context"));
+    REQUIRE(builder != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR block builder"));
+
+    REQUIRE_OK(store_value_impl(mem, type, context, builder, source_location, KEFIR_IR_MEMORY_FLAG_NONE));
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_ast_translator_atomic_compare_exchange_value(struct kefir_mem *mem,
                                                                   const struct kefir_ast_type *type,
                                                                   struct kefir_ast_translator_context *context,
@@ -67,7 +67,11 @@ static kefir_result_t analyze_scalar(struct kefir_mem *mem, const struct kefir_a
                                      const struct kefir_ast_type *type, const struct kefir_ast_initializer *initializer,
                                      struct kefir_ast_initializer_properties *properties) {
     struct kefir_ast_node_base *expr = kefir_ast_initializer_head(initializer);
-    if (expr != NULL) {
+    if (expr != NULL && expr->properties.expression_props.string_literal.embed) {
+        REQUIRE(KEFIR_AST_TYPE_IS_ARITHMETIC_TYPE(kefir_ast_unqualified_type(type)),
+                KEFIR_SET_SOURCE_ERROR(KEFIR_ANALYSIS_ERROR, &expr->source_location,
+                                       "Embedded resource shall initialize objects of arithmetic type"));
+    } else if (expr != NULL) {
         kefir_result_t res;
         REQUIRE_MATCH_OK(&res, kefir_ast_node_assignable(mem, context, expr, type),
                          KEFIR_SET_SOURCE_ERROR(KEFIR_ANALYSIS_ERROR, &expr->source_location,
@@ -152,6 +156,25 @@ static kefir_result_t traverse_aggregate_union_string_literal(struct kefir_mem *
     return KEFIR_OK;
 }
 
+static kefir_result_t traverse_aggregate_union_embed(struct kefir_mem *mem, struct kefir_ast_type_traversal *traversal,
+                                                     struct kefir_ast_initializer_list_entry *entry) {
+    // Embedded resource initializes subsequent scalar subobjects one byte at a time, as if it were expanded into a
+    // comma-separated sequence of integral constants
+    const kefir_size_t length = entry->value->expression->properties.expression_props.string_literal.length;
+    for (kefir_size_t i = 0; i < length; i++) {
+        if (i > 0 && kefir_ast_type_traversal_empty(traversal)) {
+            break;
+        }
+
+        const struct kefir_ast_type *type = NULL;
+        REQUIRE_OK(kefir_ast_type_traversal_next_recursive(mem, traversal, &type, NULL));
+        REQUIRE(KEFIR_AST_TYPE_IS_ARITHMETIC_TYPE(kefir_ast_unqualified_type(type)),
+                KEFIR_SET_SOURCE_ERROR(KEFIR_ANALYSIS_ERROR, &entry->value->expression->source_location,
+                                       "Embedded resource shall initialize objects of arithmetic type"));
+    }
+    return KEFIR_OK;
+}
+
 struct traverse_aggregate_union_param {
     struct kefir_mem *mem;
     const struct kefir_ast_context *context;
@@ -178,6 +201,8 @@ static kefir_result_t traverse_aggregate_union_impl(struct kefir_ast_designator
         const struct kefir_ast_type *type = NULL;
         REQUIRE_OK(kefir_ast_type_traversal_next(mem, traversal, &type, NULL));
         REQUIRE_OK(kefir_ast_analyze_initializer(mem, context, type, entry->value, NULL));
+    } else if (entry->value->expression->properties.expression_props.string_literal.embed) {
+        REQUIRE_OK(traverse_aggregate_union_embed(mem, traversal, entry));
     } else if (entry->value->expression->properties.expression_props.string_literal.content != NULL) {
         REQUIRE_OK(traverse_aggregate_union_string_literal(mem, context, traversal, entry));
     } else if (KEFIR_AST_TYPE_IS_SCALAR_TYPE(entry->value->expression->properties.type)) {
@@ -63,5 +63,6 @@ kefir_result_t kefir_ast_analyze_string_literal_node(struct kefir_mem *mem, cons
     base->properties.expression_props.string_literal.type = node->type;
     base->properties.expression_props.string_literal.content = node->literal;
     base->properties.expression_props.string_literal.length = node->length;
+    base->properties.expression_props.string_literal.embed = node->embed;
     return KEFIR_OK;
 }
@@ -56,6 +56,8 @@ struct compound_traversal_param {
     const struct kefir_ast_context *context;
     const char *member_name;
     struct kefir_ast_node_base **initializer_expr;
+    kefir_bool_t *has_embed_value;
+    kefir_uint8_t *embed_value;
 };
 
 static kefir_result_t retrieve_scalar_initializer_visit_value(const struct kefir_ast_designator *designator,
@@ -74,6 +76,24 @@ static kefir_result_t retrieve_scalar_initializer_visit_value(const struct kefir
     return KEFIR_OK;
 }
 
+static kefir_result_t retrieve_scalar_initializer_visit_embed_value(const struct kefir_ast_designator *designator,
+                                                                    struct kefir_ast_node_base *expression,
+                                                                    kefir_uint8_t value, void *payload) {
+    REQUIRE(designator != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid AST designator"));
+    REQUIRE(expression != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid AST expression node"));
+    REQUIRE(payload != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid payload"));
+    ASSIGN_DECL_CAST(struct compound_traversal_param *, param, payload);
+
+    if (designator->next == NULL && designator->type == KEFIR_AST_DESIGNATOR_MEMBER &&
+        strcmp(designator->member, param->member_name) == 0) {
+        *param->has_embed_value = true;
+        *param->embed_value = value;
+        return KEFIR_YIELD;
+    }
+
+    return KEFIR_OK;
+}
+
 static kefir_result_t get_initializer_list(const struct kefir_ast_type_traits *type_traits,
                                            const struct kefir_ast_initializer *initializer,
                                            const struct kefir_ast_type *type,
@@ -96,7 +116,8 @@ static kefir_result_t get_initializer_list(const struct kefir_ast_type_traits *t
 static kefir_result_t retrieve_scalar_initializer(struct kefir_mem *mem, const struct kefir_ast_context *context,
                                                   const char *member_name, const struct kefir_ast_type *type,
                                                   const struct kefir_ast_initializer *initializer,
-                                                  struct kefir_ast_node_base **initializer_expr) {
+                                                  struct kefir_ast_node_base **initializer_expr,
+                                                  kefir_bool_t *has_embed_value, kefir_uint8_t *embed_value) {
     struct kefir_ast_initializer_traversal initializer_traversal;
     KEFIR_AST_INITIALIZER_TRAVERSAL_INIT(&initializer_traversal);
 
@@ -107,13 +128,19 @@ static kefir_result_t retrieve_scalar_initializer(struct kefir_mem *mem, const s
     }
     REQUIRE_OK(res);
 
-    struct compound_traversal_param param = {
-        .mem = mem, .context = context, .member_name = member_name, .initializer_expr = initializer_expr};
+    struct compound_traversal_param param = {.mem = mem,
+                                             .context = context,
+                                             .member_name = member_name,
+                                             .initializer_expr = initializer_expr,
+                                             .has_embed_value = has_embed_value,
+                                             .embed_value = embed_value};
 
     initializer_traversal.visit_value = retrieve_scalar_initializer_visit_value;
+    initializer_traversal.visit_embed_value = retrieve_scalar_initializer_visit_embed_value;
     initializer_traversal.payload = &param;
 
     *initializer_expr = NULL;
+    *has_embed_value = false;
     res = kefir_ast_traverse_initializer(mem, context, initializer, type, &initializer_traversal);
     if (res == KEFIR_YIELD) {
         res = KEFIR_OK;
@@ -317,6 +344,48 @@ static kefir_result_t retrieve_subobject_initializer_visit_string_literal(const
     return KEFIR_OK;
 }
 
+static kefir_result_t retrieve_subobject_initializer_visit_embed_value(const struct kefir_ast_designator *designator,
+                                                                       struct kefir_ast_node_base *expression,
+                                                                       kefir_uint8_t value, void *payload) {
+    REQUIRE(designator != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid AST designator"));
+    REQUIRE(expression != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid AST expression node"));
+    REQUIRE(payload != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid payload"));
+    ASSIGN_DECL_CAST(struct subobject_retrieval_traversal_param *, param, payload);
+
+    if (is_designator_base(designator, param->member_name)) {
+        struct kefir_ast_initializer_designation *designation;
+        REQUIRE_OK(derive_desgination_with_base(param->mem, param->context->symbols, designator, &designation));
+        REQUIRE(designation != NULL, KEFIR_SET_SOURCE_ERRORF(KEFIR_NOT_CONSTANT, &expression->source_location,
+                                                             "Unable to retrieve member '%s' in constant expression "
+                                                             "evaluation",
+                                                             param->member_name));
+
+        struct kefir_ast_constant *constant = kefir_ast_new_constant_int(param->mem, value);
+        REQUIRE_ELSE(constant != NULL, {
+            kefir_ast_initializer_designation_free(param->mem, designation);
+            return KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to allocate AST constant");
+        });
+        constant->base.source_location = expression->source_location;
+
+        struct kefir_ast_initializer *expr_init =
+            kefir_ast_new_expression_initializer(param->mem, KEFIR_AST_NODE_BASE(constant));
+        REQUIRE_ELSE(expr_init != NULL, {
+            KEFIR_AST_NODE_FREE(param->mem, KEFIR_AST_NODE_BASE(constant));
+            kefir_ast_initializer_designation_free(param->mem, designation);
+            return KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to allocate expression initializer");
+        });
+
+        kefir_result_t res =
+            kefir_ast_initializer_list_append(param->mem, &param->subobj_initializer->list, designation, expr_init);
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            kefir_ast_initializer_free(param->mem, expr_init);
+            kefir_ast_initializer_designation_free(param->mem, designation);
+            return res;
+        });
+    }
+    return KEFIR_OK;
+}
+
 static kefir_result_t retrieve_subobject_initializer_visit_initializer_list(
     const struct kefir_ast_designator *designator, const struct kefir_ast_initializer *initializer, void *payload) {
     REQUIRE(initializer != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid AST initializer"));
@@ -394,10 +463,19 @@ kefir_result_t kefir_ast_evaluate_struct_member_node(struct kefir_mem *mem, cons
                                        "Expected compound constant expression"));
 
         struct kefir_ast_node_base *initializer_expr = NULL;
+        kefir_bool_t has_embed_value = false;
+        kefir_uint8_t embed_value = 0;
         REQUIRE_OK(retrieve_scalar_initializer(
             mem, context, node->member, KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(node->structure)->compound.type,
-            KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(node->structure)->compound.initializer, &initializer_expr));
-        if (initializer_expr != NULL) {
+            KEFIR_AST_NODE_CONSTANT_EXPRESSION_VALUE(node->structure)->compound.initializer, &initializer_expr,
+            &has_embed_value, &embed_value));
+        if (has_embed_value) {
+            struct kefir_ast_constant_expression_value embed_constant = {
+                .klass = KEFIR_AST_CONSTANT_EXPRESSION_CLASS_INTEGER, .integer = embed_value};
+            REQUIRE_OK(kefir_ast_constant_expression_value_cast(mem, context, value, &embed_constant,
+                                                                KEFIR_AST_NODE_BASE(node), node->base.properties.type,
+                                                                kefir_ast_type_signed_int()));
+        } else if (initializer_expr != NULL) {
             REQUIRE(KEFIR_AST_NODE_IS_CONSTANT_EXPRESSION(initializer_expr),
                     KEFIR_SET_SOURCE_ERROR(KEFIR_NOT_CONSTANT, &initializer_expr->source_location,
                                            "Expected constant expression"));
@@ -435,6 +513,7 @@ kefir_result_t kefir_ast_evaluate_struct_member_node(struct kefir_mem *mem, cons
 
         initializer_traversal.visit_value = retrieve_subobject_initializer_visit_value;
         initializer_traversal.visit_string_literal = retrieve_subobject_initializer_visit_string_literal;
+        initializer_traversal.visit_embed_value = retrieve_subobject_initializer_visit_embed_value;
         initializer_traversal.visit_initializer_list = retrieve_subobject_initializer_visit_initializer_list;
         initializer_traversal.payload = &param;
 
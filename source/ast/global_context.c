@@ -1592,6 +1592,8 @@ kefir_result_t kefir_ast_global_context_define_static_function(
             KEFIR_AST_CONTEXT_MERGE_BOOL(&ordinary_id->function.flags.weak, attributes->weak);
             KEFIR_AST_CONTEXT_MERGE_BOOL(&ordinary_id->function.flags.constructor, attributes->constructor);
             KEFIR_AST_CONTEXT_MERGE_BOOL(&ordinary_id->function.flags.destructor, attributes->destructor);
+            KEFIR_AST_CONTEXT_MERGE_BOOL(&ordinary_id->function.flags.noinline, attributes->no_inline);
+            KEFIR_AST_CONTEXT_MERGE_BOOL(&ordinary_id->function.flags.noinline, attributes->no_ipa);
             KEFIR_AST_CONTEXT_MERGE_FUNCTION_ALIAS_ATTR(ordinary_id, attributes);
             KEFIR_AST_CONTEXT_MERGE_FUNCTION_ASM_LABEL(ordinary_id, attributes);
             KEFIR_AST_CONTEXT_MERGE_DEPRECATED(&ordinary_id->function.flags.deprecated,
@@ -1617,6 +1619,8 @@ kefir_result_t kefir_ast_global_context_define_static_function(
         ordinary_id->function.flags.weak = KEFIR_AST_CONTEXT_GET_ATTR(attributes, weak, false);
         ordinary_id->function.flags.constructor = KEFIR_AST_CONTEXT_GET_ATTR(attributes, constructor, false);
         ordinary_id->function.flags.destructor = KEFIR_AST_CONTEXT_GET_ATTR(attributes, destructor, false);
+        ordinary_id->function.flags.noinline = KEFIR_AST_CONTEXT_GET_ATTR(attributes, no_inline, false) ||
+                                               KEFIR_AST_CONTEXT_GET_ATTR(attributes, no_ipa, false);
     }
 
     REQUIRE_OK(insert_ordinary_identifier(mem, context, identifier, ordinary_id));
@@ -53,7 +53,12 @@ static kefir_result_t traverse_scalar(const struct kefir_ast_designator *designa
                                       const struct kefir_ast_initializer_traversal *traversal) {
     struct kefir_ast_node_base *expr = kefir_ast_initializer_head(initializer);
     REQUIRE(expr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Scalar initializer list cannot be empty"));
-    INVOKE_TRAVERSAL(traversal, visit_value, designator, expr);
+    if (expr->properties.expression_props.string_literal.embed) {
+        const kefir_uint8_t *content = expr->properties.expression_props.string_literal.content;
+        INVOKE_TRAVERSAL(traversal, visit_embed_value, designator, expr, content[0]);
+    } else {
+        INVOKE_TRAVERSAL(traversal, visit_value, designator, expr);
+    }
     return KEFIR_OK;
 }
 
@@ -143,6 +148,36 @@ static kefir_result_t assign_string(struct kefir_mem *mem, const struct kefir_as
     return KEFIR_OK;
 }
 
+static kefir_result_t assign_embed(struct kefir_mem *mem, const struct kefir_ast_context *context,
+                                   struct kefir_ast_initializer_list_entry *entry,
+                                   struct kefir_ast_type_traversal *traversal,
+                                   const struct kefir_ast_initializer_traversal *initializer_traversal) {
+    struct kefir_ast_node_base *node = entry->value->expression;
+    const kefir_uint8_t *content = node->properties.expression_props.string_literal.content;
+    const kefir_size_t length = node->properties.expression_props.string_literal.length;
+    for (kefir_size_t i = 0; i < length; i++) {
+        if (i > 0 && kefir_ast_type_traversal_empty(traversal)) {
+            break;
+        }
+
+        const struct kefir_ast_type *type = NULL;
+        const struct kefir_ast_type_traversal_layer *layer = NULL;
+        REQUIRE_OK(kefir_ast_type_traversal_next_recursive(mem, traversal, &type, &layer));
+        struct kefir_ast_designator *designator_layer =
+            kefir_ast_type_traversal_layer_designator(mem, context->symbols, layer);
+        REQUIRE(designator_layer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Unable to derive a designator"));
+
+        kefir_result_t res = KEFIR_OK;
+        INVOKE_TRAVERSAL_CHAIN(&res, initializer_traversal, visit_embed_value, designator_layer, node, content[i]);
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            kefir_ast_designator_free(mem, designator_layer);
+            return res;
+        });
+        REQUIRE_OK(kefir_ast_designator_free(mem, designator_layer));
+    }
+    return KEFIR_OK;
+}
+
 struct traverse_aggregate_union_param {
     struct kefir_mem *mem;
     const struct kefir_ast_context *context;
@@ -201,6 +236,8 @@ static kefir_result_t traverse_aggregate_union_impl(struct kefir_ast_designator
 
             INVOKE_TRAVERSAL_CHAIN(&res, initializer_traversal, visit_initializer_list, designator_layer, entry->value);
         }
+    } else if (entry->value->expression->properties.expression_props.string_literal.embed) {
+        REQUIRE_OK(assign_embed(mem, context, entry, traversal, initializer_traversal));
     } else if (entry->value->expression->properties.expression_props.string_literal.content != NULL) {
         REQUIRE_OK(assign_string(mem, context, entry, traversal, initializer_traversal));
     } else {
@@ -92,6 +92,7 @@ struct kefir_ast_string_literal *kefir_ast_new_string_literal(struct kefir_mem *
     string_literal->type = type;
     string_literal->literal = literal_copy;
     string_literal->length = length;
+    string_literal->embed = false;
     return string_literal;
 }
 
@@ -121,3 +122,12 @@ struct kefir_ast_string_literal *kefir_ast_new_string_literal_wide(struct kefir_
                                                                    kefir_size_t length) {
     return kefir_ast_new_string_literal(mem, literal, length, KEFIR_AST_STRING_LITERAL_WIDE);
 }
+
+struct kefir_ast_string_literal *kefir_ast_new_string_literal_embed(struct kefir_mem *mem, const kefir_uint8_t *content,
+                                                                    kefir_size_t length) {
+    struct kefir_ast_string_literal *string_literal =
+        kefir_ast_new_string_literal(mem, content, length, KEFIR_AST_STRING_LITERAL_MULTIBYTE);
+    REQUIRE(string_literal != NULL, NULL);
+    string_literal->embed = true;
+    return string_literal;
+}
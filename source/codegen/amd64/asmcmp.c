@@ -551,3 +551,21 @@ kefir_result_t kefir_asmcmp_amd64_data_word(struct kefir_mem *mem, struct kefir_
         idx_ptr));
     return KEFIR_OK;
 }
+
+kefir_result_t kefir_asmcmp_amd64_align(struct kefir_mem *mem, struct kefir_asmcmp_amd64 *target,
+                                        kefir_asmcmp_instruction_index_t after_index, kefir_size_t alignment,
+                                        kefir_asmcmp_instruction_index_t *idx_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(target != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid asmgen amd64 target"));
+    REQUIRE(alignment > 0 && (alignment & (alignment - 1)) == 0,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected code alignment to be a power of two"));
+    REQUIRE_OK(kefir_asmcmp_context_instr_insert_after(
+        mem, &target->context, after_index,
+        &(const struct kefir_asmcmp_instruction) {
+            .opcode = KEFIR_ASMCMP_AMD64_OPCODE(align),
+            .args[0] = {.type = KEFIR_ASMCMP_VALUE_TYPE_INTEGER, .uint_immediate = alignment},
+            .args[1].type = KEFIR_ASMCMP_VALUE_TYPE_NONE,
+            .args[2].type = KEFIR_ASMCMP_VALUE_TYPE_NONE},
+        idx_ptr));
+    return KEFIR_OK;
+}
@@ -2486,3 +2486,77 @@ kefir_result_t kefir_codegen_amd64_translate_builtin(struct kefir_mem *mem,
     }
     return KEFIR_OK;
 }
+
+#define MEMORY_BUILTIN_INLINE_LIMIT 256
+
+static kefir_result_t memory_builtin_constant_argument(struct kefir_codegen_amd64_function *function,
+                                                       kefir_opt_instruction_ref_t argument_ref, kefir_bool_t *found,
+                                                       kefir_uint64_t *value_ptr) {
+    const struct kefir_opt_instruction *argument_instr;
+    REQUIRE_OK(kefir_opt_code_container_instr(&function->function->code, argument_ref, &argument_instr));
+    if (argument_instr->operation.opcode == KEFIR_OPT_OPCODE_INT_CONST) {
+        *found = true;
+        *value_ptr = (kefir_uint64_t) argument_instr->operation.parameters.imm.integer;
+    } else if (argument_instr->operation.opcode == KEFIR_OPT_OPCODE_UINT_CONST) {
+        *found = true;
+        *value_ptr = argument_instr->operation.parameters.imm.uinteger;
+    } else {
+        *found = false;
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_codegen_amd64_translate_memory_builtin(struct kefir_mem *mem,
+                                                            struct kefir_codegen_amd64_function *function,
+                                                            const struct kefir_opt_instruction *instruction,
+                                                            kefir_bool_t *found_builtin,
+                                                            kefir_asmcmp_virtual_register_index_t *result_vreg_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(function != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid codegen amd64 function"));
+    REQUIRE(instruction != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer instruction"));
+    REQUIRE(found_builtin != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to boolean flag"));
+    REQUIRE(result_vreg_ptr != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to result virtual register"));
+
+    *found_builtin = false;
+    const struct kefir_opt_call_node *call_node = NULL;
+    REQUIRE_OK(kefir_opt_code_container_call(&function->function->code,
+                                             instruction->operation.parameters.function_call.call_ref, &call_node));
+    const struct kefir_ir_function_decl *ir_func_decl =
+        kefir_ir_module_get_declaration(function->module->ir_module, call_node->function_declaration_id);
+    REQUIRE(ir_func_decl != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unable to find IR function declaration"));
+    REQUIRE(ir_func_decl->name != NULL && call_node->argument_count == 3, KEFIR_OK);
+
+    const kefir_bool_t is_memcpy = strcmp(ir_func_decl->name, "memcpy") == 0;
+    const kefir_bool_t is_memset = strcmp(ir_func_decl->name, "memset") == 0;
+    REQUIRE(is_memcpy || is_memset, KEFIR_OK);
+
+    // Only calls with small constant size (and constant fill value for memset) are expanded, everything else is left
+    // to the library.
+    kefir_bool_t constant_size, constant_value = true;
+    kefir_uint64_t size, value = 0;
+    REQUIRE_OK(memory_builtin_constant_argument(function, call_node->arguments[2], &constant_size, &size));
+    REQUIRE(constant_size && size <= MEMORY_BUILTIN_INLINE_LIMIT, KEFIR_OK);
+    if (is_memset) {
+        REQUIRE_OK(memory_builtin_constant_argument(function, call_node->arguments[1], &constant_value, &value));
+        REQUIRE(constant_value, KEFIR_OK);
+    }
+
+    kefir_asmcmp_virtual_register_index_t target_vreg, source_vreg, result_vreg;
+    REQUIRE_OK(kefir_codegen_amd64_function_vreg_of(function, call_node->arguments[0], &target_vreg));
+    if (is_memcpy) {
+        REQUIRE_OK(kefir_codegen_amd64_function_vreg_of(function, call_node->arguments[1], &source_vreg));
+        REQUIRE_OK(kefir_codegen_amd64_copy_memory(mem, function, target_vreg, source_vreg, size));
+    } else {
+        REQUIRE_OK(kefir_codegen_amd64_fill_memory(mem, function, target_vreg, (kefir_uint8_t) value, size));
+    }
+
+    REQUIRE_OK(kefir_asmcmp_virtual_register_new(mem, &function->code.context,
+                                                 KEFIR_ASMCMP_VIRTUAL_REGISTER_GENERAL_PURPOSE, &result_vreg));
+    REQUIRE_OK(kefir_asmcmp_amd64_link_virtual_registers(mem, &function->code,
+                                                         kefir_asmcmp_context_instr_tail(&function->code.context),
+                                                         result_vreg, target_vreg, NULL));
+    *found_builtin = true;
+    *result_vreg_ptr = result_vreg;
+    return KEFIR_OK;
+}
@@ -1395,6 +1395,12 @@ static kefir_result_t do_invoke(struct kefir_mem *mem, struct kefir_codegen_amd6
         REQUIRE_OK(kefir_codegen_amd64_translate_builtin(mem, function, instruction, &found_builtin, result_vreg_ptr));
         REQUIRE(!found_builtin, KEFIR_OK);
     }
+    if (function->codegen->config->inline_memory_builtins) {
+        kefir_bool_t found_builtin = false;
+        REQUIRE_OK(
+            kefir_codegen_amd64_translate_memory_builtin(mem, function, instruction, &found_builtin, result_vreg_ptr));
+        REQUIRE(!found_builtin, KEFIR_OK);
+    }
 
     struct kefir_abi_amd64_function_decl abi_func_decl;
     REQUIRE_OK(kefir_abi_amd64_function_decl_alloc(mem, function->codegen->abi_variant, ir_func_decl, &abi_func_decl));
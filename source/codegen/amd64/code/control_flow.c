@@ -173,10 +173,11 @@ static kefir_result_t map_phi_outputs_impl(struct kefir_mem *mem, struct kefir_c
             }
         }
 
+        kefir_bool_t target_alive_in_source = false;
+        REQUIRE_OK(kefir_opt_code_liveness_instruction_is_alive_in_block(&function->liveness, source_block_ref,
+                                                                         target_ref, &target_alive_in_source));
         if (deferred_target_vreg_idx != KEFIR_ASMCMP_INDEX_NONE ||
-            (source_block_ref != target_block_ref && source_vreg_idx != target_vreg_idx &&
-             !kefir_hashset_has(&function->liveness.blocks[source_block_ref].alive_instr,
-                                (kefir_hashset_key_t) target_ref) &&
+            (source_block_ref != target_block_ref && source_vreg_idx != target_vreg_idx && !target_alive_in_source &&
              !kefir_hashtreeset_has(used_source_vregs, (kefir_hashtreeset_entry_t) target_vreg_idx))) {
             REQUIRE_OK(kefir_hashtreeset_add(mem, used_target_vregs, (kefir_hashtreeset_entry_t) target_vreg_idx));
         }
@@ -905,6 +906,143 @@ kefir_result_t KEFIR_CODEGEN_AMD64_INSTRUCTION_IMPL(ijump)(struct kefir_mem *mem
     return KEFIR_OK;
 }
 
+kefir_result_t KEFIR_CODEGEN_AMD64_INSTRUCTION_IMPL(switch_jump)(struct kefir_mem *mem,
+                                                                 struct kefir_codegen_amd64_function *function,
+                                                                 const struct kefir_opt_instruction *instruction) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(function != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid codegen amd64 function"));
+    REQUIRE(instruction != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer instruction"));
+
+    REQUIRE_OK(kefir_codegen_amd64_function_x87_flush(mem, function));
+
+    const struct kefir_opt_switch_table *switch_table;
+    const struct kefir_opt_code_block *default_block;
+    REQUIRE_OK(kefir_opt_code_container_switch_table(
+        &function->function->code, instruction->operation.parameters.branch.switch_table_ref, &switch_table));
+    REQUIRE_OK(kefir_opt_code_container_block(&function->function->code,
+                                              instruction->operation.parameters.branch.target_block, &default_block));
+
+    kefir_asmcmp_virtual_register_index_t index_vreg, length_vreg, base_vreg, entry_vreg, target_vreg;
+    REQUIRE_OK(kefir_codegen_amd64_function_vreg_of(function, instruction->operation.parameters.refs[0], &index_vreg));
+    REQUIRE_OK(kefir_asmcmp_virtual_register_new(mem, &function->code.context,
+                                                 KEFIR_ASMCMP_VIRTUAL_REGISTER_GENERAL_PURPOSE, &base_vreg));
+    REQUIRE_OK(kefir_asmcmp_virtual_register_new(mem, &function->code.context,
+                                                 KEFIR_ASMCMP_VIRTUAL_REGISTER_GENERAL_PURPOSE, &entry_vreg));
+    REQUIRE_OK(kefir_asmcmp_virtual_register_new(mem, &function->code.context,
+                                                 KEFIR_ASMCMP_VIRTUAL_REGISTER_GENERAL_PURPOSE, &target_vreg));
+
+    kefir_bool_t default_phi_outputs;
+    kefir_asmcmp_label_index_t default_label;
+    REQUIRE_OK(has_phi_outputs(function, default_block, &default_phi_outputs));
+    if (default_phi_outputs) {
+        REQUIRE_OK(
+            kefir_asmcmp_context_new_label(mem, &function->code.context, KEFIR_ASMCMP_INDEX_NONE, &default_label));
+    } else {
+        struct kefir_hashtree_node *label_node;
+        REQUIRE_OK(kefir_hashtree_at(&function->labels, (kefir_hashtree_key_t) default_block->id, &label_node));
+        default_label = (kefir_asmcmp_label_index_t) label_node->value;
+    }
+
+    // Indices outside of the table are dispatched to the default block
+    if (switch_table->length <= KEFIR_INT32_MAX) {
+        REQUIRE_OK(kefir_asmcmp_amd64_cmp(mem, &function->code,
+                                          kefir_asmcmp_context_instr_tail(&function->code.context),
+                                          &KEFIR_ASMCMP_MAKE_VREG64(index_vreg),
+                                          &KEFIR_ASMCMP_MAKE_INT(switch_table->length), NULL));
+    } else {
+        REQUIRE_OK(kefir_asmcmp_virtual_register_new(mem, &function->code.context,
+                                                     KEFIR_ASMCMP_VIRTUAL_REGISTER_GENERAL_PURPOSE, &length_vreg));
+        REQUIRE_OK(kefir_asmcmp_amd64_movabs(mem, &function->code,
+                                             kefir_asmcmp_context_instr_tail(&function->code.context),
+                                             &KEFIR_ASMCMP_MAKE_VREG64(length_vreg),
+                                             &KEFIR_ASMCMP_MAKE_INT(switch_table->length), NULL));
+        REQUIRE_OK(kefir_asmcmp_amd64_cmp(mem, &function->code,
+                                          kefir_asmcmp_context_instr_tail(&function->code.context),
+                                          &KEFIR_ASMCMP_MAKE_VREG64(index_vreg),
+                                          &KEFIR_ASMCMP_MAKE_VREG64(length_vreg), NULL));
+    }
+    REQUIRE_OK(kefir_asmcmp_amd64_jae(mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+                                      &KEFIR_ASMCMP_MAKE_INTERNAL_LABEL(default_label), NULL));
+
+    // Jump table contains 32-bit offsets of the switch targets relative to the table itself
+    kefir_asmcmp_label_index_t table_label;
+    REQUIRE_OK(kefir_asmcmp_context_new_label(mem, &function->code.context, KEFIR_ASMCMP_INDEX_NONE, &table_label));
+    REQUIRE_OK(kefir_hashtree_insert(mem, &function->constants, (kefir_hashtree_key_t) table_label,
+                                     (kefir_hashtree_value_t) instruction->id));
+
+    REQUIRE_OK(kefir_asmcmp_amd64_lea(
+        mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+        &KEFIR_ASMCMP_MAKE_VREG64(base_vreg),
+        &KEFIR_ASMCMP_MAKE_RIP_INDIRECT_INTERNAL(table_label, KEFIR_ASMCMP_OPERAND_VARIANT_DEFAULT), NULL));
+    REQUIRE_OK(kefir_asmcmp_amd64_mov(mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+                                      &KEFIR_ASMCMP_MAKE_VREG64(entry_vreg), &KEFIR_ASMCMP_MAKE_VREG64(index_vreg),
+                                      NULL));
+    REQUIRE_OK(kefir_asmcmp_amd64_shl(mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+                                      &KEFIR_ASMCMP_MAKE_VREG64(entry_vreg), &KEFIR_ASMCMP_MAKE_INT(2), NULL));
+    REQUIRE_OK(kefir_asmcmp_amd64_add(mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+                                      &KEFIR_ASMCMP_MAKE_VREG64(entry_vreg), &KEFIR_ASMCMP_MAKE_VREG64(base_vreg),
+                                      NULL));
+    REQUIRE_OK(kefir_asmcmp_amd64_movsx(
+        mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+        &KEFIR_ASMCMP_MAKE_VREG64(target_vreg),
+        &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(entry_vreg, 0, KEFIR_ASMCMP_OPERAND_VARIANT_32BIT), NULL));
+    REQUIRE_OK(kefir_asmcmp_amd64_add(mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+                                      &KEFIR_ASMCMP_MAKE_VREG64(target_vreg), &KEFIR_ASMCMP_MAKE_VREG64(base_vreg),
+                                      NULL));
+    REQUIRE_OK(kefir_asmcmp_amd64_jmp(mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+                                      &KEFIR_ASMCMP_MAKE_VREG(target_vreg), NULL));
+
+    struct kefir_hashtree_node *label_node;
+    if (default_phi_outputs) {
+        REQUIRE_OK(kefir_asmcmp_context_bind_label_after_tail(mem, &function->code.context, default_label));
+        REQUIRE_OK(
+            kefir_codegen_amd64_function_map_phi_outputs(mem, function, default_block->id, instruction->block_id));
+        REQUIRE_OK(kefir_hashtree_at(&function->labels, (kefir_hashtree_key_t) default_block->id, &label_node));
+        ASSIGN_DECL_CAST(kefir_asmcmp_label_index_t, target_label, label_node->value);
+        REQUIRE_OK(kefir_asmcmp_amd64_jmp(mem, &function->code,
+                                          kefir_asmcmp_context_instr_tail(&function->code.context),
+                                          &KEFIR_ASMCMP_MAKE_INTERNAL_LABEL(target_label), NULL));
+    }
+
+    // Each distinct switch target is reached through a publicly labelled trampoline which the table refers to
+    struct kefir_hashtreeset visited_targets;
+    REQUIRE_OK(kefir_hashtreeset_init(&visited_targets, &kefir_hashtree_uint_ops));
+    kefir_result_t res = KEFIR_OK;
+    for (kefir_size_t i = 0; res == KEFIR_OK && i < switch_table->length; i++) {
+        const kefir_opt_block_id_t target_block_id = switch_table->targets[i];
+        if (kefir_hashtreeset_has(&visited_targets, (kefir_hashtreeset_entry_t) target_block_id)) {
+            continue;
+        }
+        REQUIRE_CHAIN(&res, kefir_hashtreeset_add(mem, &visited_targets, (kefir_hashtreeset_entry_t) target_block_id));
+
+        kefir_asmcmp_label_index_t trampoline_label;
+        REQUIRE_CHAIN(&res, kefir_asmcmp_context_new_label(mem, &function->code.context, KEFIR_ASMCMP_INDEX_NONE,
+                                                           &trampoline_label));
+        REQUIRE_CHAIN(&res,
+                      kefir_asmcmp_context_bind_label_after_tail(mem, &function->code.context, trampoline_label));
+        REQUIRE_CHAIN(&res, kefir_asmcmp_context_label_add_public_name(
+                                mem, &function->code.context, trampoline_label,
+                                kefir_asm_amd64_xasmgen_helpers_format(
+                                    &function->codegen->xasmgen_helpers, KEFIR_AMD64_SWITCH_TARGET,
+                                    function->codegen->symbol_prefix, function->code.function_name,
+                                    instruction->id, target_block_id)));
+        REQUIRE_CHAIN(&res, kefir_codegen_amd64_function_map_phi_outputs(mem, function, target_block_id,
+                                                                        instruction->block_id));
+        REQUIRE_CHAIN(&res, kefir_hashtree_at(&function->labels, (kefir_hashtree_key_t) target_block_id, &label_node));
+        REQUIRE_CHAIN(&res, kefir_asmcmp_amd64_jmp(
+                                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+                                &KEFIR_ASMCMP_MAKE_INTERNAL_LABEL((kefir_asmcmp_label_index_t) label_node->value),
+                                NULL));
+    }
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_hashtreeset_free(mem, &visited_targets);
+        return res;
+    });
+    REQUIRE_OK(kefir_hashtreeset_free(mem, &visited_targets));
+
+    return KEFIR_OK;
+}
+
 kefir_result_t KEFIR_CODEGEN_AMD64_INSTRUCTION_IMPL(select_compare)(struct kefir_mem *mem,
                                                                     struct kefir_codegen_amd64_function *function,
                                                                     const struct kefir_opt_instruction *instruction) {
@@ -23,76 +23,84 @@
 #include "kefir/core/error.h"
 #include "kefir/core/util.h"
 
-#define COPY_UNROLL_LIMIT 64
-#define ROUND_DOWN_TO(_val, _factor) ((_val) / (_factor) * (_factor))
+#define COPY_UNROLL_LIMIT 256
+#define COPY_VECTOR_CHUNK (2 * KEFIR_AMD64_ABI_QWORD)
+
+static kefir_asmcmp_operand_variant_t chunk_variant(kefir_size_t chunk) {
+    switch (chunk) {
+        case 1:
+            return KEFIR_ASMCMP_OPERAND_VARIANT_8BIT;
+
+        case 2:
+            return KEFIR_ASMCMP_OPERAND_VARIANT_16BIT;
+
+        case 4:
+            return KEFIR_ASMCMP_OPERAND_VARIANT_32BIT;
+
+        case 8:
+            return KEFIR_ASMCMP_OPERAND_VARIANT_64BIT;
+
+        default:
+            return KEFIR_ASMCMP_OPERAND_VARIANT_DEFAULT;
+    }
+}
+
+static kefir_result_t copy_chunk(struct kefir_mem *mem, struct kefir_codegen_amd64_function *function,
+                                 kefir_asmcmp_virtual_register_index_t target_vreg,
+                                 kefir_asmcmp_virtual_register_index_t source_vreg,
+                                 kefir_asmcmp_virtual_register_index_t tmp_vreg, kefir_size_t chunk,
+                                 kefir_size_t offset) {
+    const kefir_asmcmp_operand_variant_t variant = chunk_variant(chunk);
+    const struct kefir_asmcmp_value tmp_value = {.type = KEFIR_ASMCMP_VALUE_TYPE_VIRTUAL_REGISTER,
+                                                 .vreg = {.index = tmp_vreg, .variant = variant}};
+    if (chunk == COPY_VECTOR_CHUNK) {
+        REQUIRE_OK(kefir_asmcmp_amd64_movdqu(
+            mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context), &tmp_value,
+            &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(source_vreg, offset, variant), NULL));
+        REQUIRE_OK(kefir_asmcmp_amd64_movdqu(
+            mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+            &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, offset, variant), &tmp_value, NULL));
+    } else {
+        REQUIRE_OK(kefir_asmcmp_amd64_mov(mem, &function->code,
+                                          kefir_asmcmp_context_instr_tail(&function->code.context), &tmp_value,
+                                          &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(source_vreg, offset, variant), NULL));
+        REQUIRE_OK(kefir_asmcmp_amd64_mov(mem, &function->code,
+                                          kefir_asmcmp_context_instr_tail(&function->code.context),
+                                          &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, offset, variant),
+                                          &tmp_value, NULL));
+    }
+    return KEFIR_OK;
+}
 
 static kefir_result_t unrolled_copy(struct kefir_mem *mem, struct kefir_codegen_amd64_function *function,
                                     kefir_asmcmp_virtual_register_index_t target_vreg,
                                     kefir_asmcmp_virtual_register_index_t source_vreg, kefir_size_t size) {
+    // Copies of at least 16 bytes are done in 16-byte vector chunks, smaller copies use the widest general purpose
+    // move that fits. Any remainder is covered by a final chunk which overlaps the preceding one, so that no copy
+    // needs more than one chunk width.
     kefir_asmcmp_virtual_register_index_t tmp_vreg;
-    if (size % (2 * KEFIR_AMD64_ABI_QWORD) == 0) {
+    if (size >= COPY_VECTOR_CHUNK) {
         REQUIRE_OK(kefir_asmcmp_virtual_register_new(mem, &function->code.context,
                                                      KEFIR_ASMCMP_VIRTUAL_REGISTER_FLOATING_POINT, &tmp_vreg));
-        for (kefir_size_t i = 0; i < size; i += 2 * KEFIR_AMD64_ABI_QWORD) {
-            REQUIRE_OK(kefir_asmcmp_amd64_movdqu(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_VREG(tmp_vreg),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(source_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_DEFAULT), NULL));
-            REQUIRE_OK(kefir_asmcmp_amd64_movdqu(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_DEFAULT),
-                &KEFIR_ASMCMP_MAKE_VREG(tmp_vreg), NULL));
+        kefir_size_t i = 0;
+        for (; i + COPY_VECTOR_CHUNK <= size; i += COPY_VECTOR_CHUNK) {
+            REQUIRE_OK(copy_chunk(mem, function, target_vreg, source_vreg, tmp_vreg, COPY_VECTOR_CHUNK, i));
         }
-    } else {
+        if (i < size) {
+            REQUIRE_OK(copy_chunk(mem, function, target_vreg, source_vreg, tmp_vreg, COPY_VECTOR_CHUNK,
+                                  size - COPY_VECTOR_CHUNK));
+        }
+    } else if (size > 0) {
         REQUIRE_OK(kefir_asmcmp_virtual_register_new(mem, &function->code.context,
                                                      KEFIR_ASMCMP_VIRTUAL_REGISTER_GENERAL_PURPOSE, &tmp_vreg));
         REQUIRE_OK(kefir_asmcmp_amd64_produce_virtual_register(
             mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context), tmp_vreg, NULL));
-        kefir_size_t i = 0;
-        for (; i < ROUND_DOWN_TO(size, KEFIR_AMD64_ABI_QWORD); i += KEFIR_AMD64_ABI_QWORD) {
-            REQUIRE_OK(kefir_asmcmp_amd64_mov(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_VREG64(tmp_vreg),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(source_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_64BIT), NULL));
-            REQUIRE_OK(kefir_asmcmp_amd64_mov(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_64BIT),
-                &KEFIR_ASMCMP_MAKE_VREG64(tmp_vreg), NULL));
-        }
-
-        const kefir_size_t dword_size = KEFIR_AMD64_ABI_QWORD / 2;
-        for (; i < ROUND_DOWN_TO(size, dword_size); i += dword_size) {
-            REQUIRE_OK(kefir_asmcmp_amd64_mov(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_VREG32(tmp_vreg),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(source_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_32BIT), NULL));
-            REQUIRE_OK(kefir_asmcmp_amd64_mov(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_32BIT),
-                &KEFIR_ASMCMP_MAKE_VREG32(tmp_vreg), NULL));
-        }
-
-        const kefir_size_t word_size = KEFIR_AMD64_ABI_QWORD / 4;
-        for (; i < ROUND_DOWN_TO(size, word_size); i += word_size) {
-            REQUIRE_OK(kefir_asmcmp_amd64_mov(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_VREG16(tmp_vreg),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(source_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_16BIT), NULL));
-            REQUIRE_OK(kefir_asmcmp_amd64_mov(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_16BIT),
-                &KEFIR_ASMCMP_MAKE_VREG16(tmp_vreg), NULL));
-        }
-
-        for (; i < size; i++) {
-            REQUIRE_OK(kefir_asmcmp_amd64_mov(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_VREG8(tmp_vreg),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(source_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_8BIT), NULL));
-            REQUIRE_OK(kefir_asmcmp_amd64_mov(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_8BIT),
-                &KEFIR_ASMCMP_MAKE_VREG8(tmp_vreg), NULL));
+        kefir_size_t chunk = KEFIR_AMD64_ABI_QWORD;
+        for (; chunk > size; chunk /= 2)
+            ;
+        REQUIRE_OK(copy_chunk(mem, function, target_vreg, source_vreg, tmp_vreg, chunk, 0));
+        if (chunk < size) {
+            REQUIRE_OK(copy_chunk(mem, function, target_vreg, source_vreg, tmp_vreg, chunk, size - chunk));
         }
     }
 
@@ -23,13 +23,57 @@
 #include "kefir/core/error.h"
 #include "kefir/core/util.h"
 
-#define COPY_UNROLL_LIMIT 64
-#define ROUND_DOWN_TO(_val, _factor) ((_val) / (_factor) * (_factor))
+#define FILL_UNROLL_LIMIT 256
+#define FILL_VECTOR_CHUNK (2 * KEFIR_AMD64_ABI_QWORD)
 
-static kefir_result_t unrolled_zero(struct kefir_mem *mem, struct kefir_codegen_amd64_function *function,
-                                    kefir_asmcmp_virtual_register_index_t target_vreg, kefir_size_t size) {
+static kefir_asmcmp_operand_variant_t chunk_variant(kefir_size_t chunk) {
+    switch (chunk) {
+        case 1:
+            return KEFIR_ASMCMP_OPERAND_VARIANT_8BIT;
+
+        case 2:
+            return KEFIR_ASMCMP_OPERAND_VARIANT_16BIT;
+
+        case 4:
+            return KEFIR_ASMCMP_OPERAND_VARIANT_32BIT;
+
+        case 8:
+            return KEFIR_ASMCMP_OPERAND_VARIANT_64BIT;
+
+        default:
+            return KEFIR_ASMCMP_OPERAND_VARIANT_DEFAULT;
+    }
+}
+
+static kefir_result_t fill_chunk(struct kefir_mem *mem, struct kefir_codegen_amd64_function *function,
+                                 kefir_asmcmp_virtual_register_index_t target_vreg,
+                                 kefir_asmcmp_virtual_register_index_t tmp_vreg, kefir_size_t chunk,
+                                 kefir_size_t offset) {
+    const kefir_asmcmp_operand_variant_t variant = chunk_variant(chunk);
+    const struct kefir_asmcmp_value tmp_value = {.type = KEFIR_ASMCMP_VALUE_TYPE_VIRTUAL_REGISTER,
+                                                 .vreg = {.index = tmp_vreg, .variant = variant}};
+    if (chunk == FILL_VECTOR_CHUNK) {
+        REQUIRE_OK(kefir_asmcmp_amd64_movdqu(
+            mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+            &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, offset, variant), &tmp_value, NULL));
+    } else {
+        REQUIRE_OK(kefir_asmcmp_amd64_mov(mem, &function->code,
+                                          kefir_asmcmp_context_instr_tail(&function->code.context),
+                                          &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, offset, variant),
+                                          &tmp_value, NULL));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t unrolled_fill(struct kefir_mem *mem, struct kefir_codegen_amd64_function *function,
+                                    kefir_asmcmp_virtual_register_index_t target_vreg, kefir_uint8_t value,
+                                    kefir_size_t size) {
+    // Zeroing of at least 16 bytes is done in 16-byte vector chunks, other fills use the widest general purpose
+    // store that fits. Any remainder is covered by a final store which overlaps the preceding one.
     kefir_asmcmp_virtual_register_index_t tmp_vreg;
-    if (size % (2 * KEFIR_AMD64_ABI_QWORD) == 0) {
+    kefir_size_t chunk;
+    if (value == 0 && size >= FILL_VECTOR_CHUNK) {
+        chunk = FILL_VECTOR_CHUNK;
         REQUIRE_OK(kefir_asmcmp_virtual_register_new(mem, &function->code.context,
                                                      KEFIR_ASMCMP_VIRTUAL_REGISTER_FLOATING_POINT, &tmp_vreg));
         REQUIRE_OK(kefir_asmcmp_amd64_produce_virtual_register(
@@ -37,50 +81,34 @@ static kefir_result_t unrolled_zero(struct kefir_mem *mem, struct kefir_codegen_
         REQUIRE_OK(
             kefir_asmcmp_amd64_xorps(mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
                                      &KEFIR_ASMCMP_MAKE_VREG(tmp_vreg), &KEFIR_ASMCMP_MAKE_VREG(tmp_vreg), NULL));
-        for (kefir_size_t i = 0; i < size; i += 2 * KEFIR_AMD64_ABI_QWORD) {
-            REQUIRE_OK(kefir_asmcmp_amd64_movdqu(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_DEFAULT),
-                &KEFIR_ASMCMP_MAKE_VREG(tmp_vreg), NULL));
-        }
     } else {
+        for (chunk = KEFIR_AMD64_ABI_QWORD; chunk > size; chunk /= 2)
+            ;
         REQUIRE_OK(kefir_asmcmp_virtual_register_new(mem, &function->code.context,
                                                      KEFIR_ASMCMP_VIRTUAL_REGISTER_GENERAL_PURPOSE, &tmp_vreg));
         REQUIRE_OK(kefir_asmcmp_amd64_produce_virtual_register(
             mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context), tmp_vreg, NULL));
-        REQUIRE_OK(
-            kefir_asmcmp_amd64_xor(mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                                   &KEFIR_ASMCMP_MAKE_VREG32(tmp_vreg), &KEFIR_ASMCMP_MAKE_VREG32(tmp_vreg), NULL));
-        kefir_size_t i = 0;
-        for (; i < ROUND_DOWN_TO(size, KEFIR_AMD64_ABI_QWORD); i += KEFIR_AMD64_ABI_QWORD) {
-            REQUIRE_OK(kefir_asmcmp_amd64_mov(
+        if (value == 0) {
+            REQUIRE_OK(kefir_asmcmp_amd64_xor(
                 mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_64BIT),
-                &KEFIR_ASMCMP_MAKE_VREG64(tmp_vreg), NULL));
-        }
-
-        const kefir_size_t dword_size = KEFIR_AMD64_ABI_QWORD / 2;
-        for (; i < ROUND_DOWN_TO(size, dword_size); i += dword_size) {
-            REQUIRE_OK(kefir_asmcmp_amd64_mov(
+                &KEFIR_ASMCMP_MAKE_VREG32(tmp_vreg), &KEFIR_ASMCMP_MAKE_VREG32(tmp_vreg), NULL));
+        } else if (chunk == KEFIR_AMD64_ABI_QWORD) {
+            REQUIRE_OK(kefir_asmcmp_amd64_movabs(
                 mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_32BIT),
-                &KEFIR_ASMCMP_MAKE_VREG32(tmp_vreg), NULL));
-        }
-
-        const kefir_size_t word_size = KEFIR_AMD64_ABI_QWORD / 4;
-        for (; i < ROUND_DOWN_TO(size, word_size); i += word_size) {
+                &KEFIR_ASMCMP_MAKE_VREG64(tmp_vreg), &KEFIR_ASMCMP_MAKE_INT((kefir_int64_t) (0x0101010101010101ull * value)), NULL));
+        } else {
             REQUIRE_OK(kefir_asmcmp_amd64_mov(
                 mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_16BIT),
-                &KEFIR_ASMCMP_MAKE_VREG16(tmp_vreg), NULL));
+                &KEFIR_ASMCMP_MAKE_VREG32(tmp_vreg), &KEFIR_ASMCMP_MAKE_INT((kefir_int32_t) (0x01010101u * value)), NULL));
         }
+    }
 
-        for (; i < size; i++) {
-            REQUIRE_OK(kefir_asmcmp_amd64_mov(
-                mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                &KEFIR_ASMCMP_MAKE_INDIRECT_VIRTUAL(target_vreg, i, KEFIR_ASMCMP_OPERAND_VARIANT_8BIT),
-                &KEFIR_ASMCMP_MAKE_VREG8(tmp_vreg), NULL));
-        }
+    kefir_size_t i = 0;
+    for (; i + chunk <= size; i += chunk) {
+        REQUIRE_OK(fill_chunk(mem, function, target_vreg, tmp_vreg, chunk, i));
+    }
+    if (i < size) {
+        REQUIRE_OK(fill_chunk(mem, function, target_vreg, tmp_vreg, chunk, size - chunk));
     }
 
     REQUIRE_OK(kefir_asmcmp_amd64_weak_touch_virtual_register(
@@ -89,8 +117,9 @@ static kefir_result_t unrolled_zero(struct kefir_mem *mem, struct kefir_codegen_
     return KEFIR_OK;
 }
 
-static kefir_result_t full_zero(struct kefir_mem *mem, struct kefir_codegen_amd64_function *function,
-                                kefir_asmcmp_virtual_register_index_t target_vreg, kefir_size_t size) {
+static kefir_result_t full_fill(struct kefir_mem *mem, struct kefir_codegen_amd64_function *function,
+                                kefir_asmcmp_virtual_register_index_t target_vreg, kefir_uint8_t value,
+                                kefir_size_t size) {
     kefir_asmcmp_virtual_register_index_t destination_placement_vreg, source_placement_vreg, count_placement_vreg;
     REQUIRE_OK(kefir_asmcmp_virtual_register_new(
         mem, &function->code.context, KEFIR_ASMCMP_VIRTUAL_REGISTER_GENERAL_PURPOSE, &destination_placement_vreg));
@@ -109,9 +138,16 @@ static kefir_result_t full_zero(struct kefir_mem *mem, struct kefir_codegen_amd6
     REQUIRE_OK(kefir_asmcmp_amd64_link_virtual_registers(mem, &function->code,
                                                          kefir_asmcmp_context_instr_tail(&function->code.context),
                                                          destination_placement_vreg, target_vreg, NULL));
-    REQUIRE_OK(kefir_asmcmp_amd64_mov(mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
-                                      &KEFIR_ASMCMP_MAKE_VREG64(source_placement_vreg), &KEFIR_ASMCMP_MAKE_INT(0),
-                                      NULL));
+    if (value == 0) {
+        REQUIRE_OK(kefir_asmcmp_amd64_mov(
+            mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+            &KEFIR_ASMCMP_MAKE_VREG64(source_placement_vreg), &KEFIR_ASMCMP_MAKE_INT(0), NULL));
+    } else {
+        REQUIRE_OK(kefir_asmcmp_amd64_movabs(
+            mem, &function->code, kefir_asmcmp_context_instr_tail(&function->code.context),
+            &KEFIR_ASMCMP_MAKE_VREG64(source_placement_vreg),
+            &KEFIR_ASMCMP_MAKE_INT((kefir_int64_t) (0x0101010101010101ull * value)), NULL));
+    }
 
     if (size % 8 == 0) {
         REQUIRE_OK(kefir_asmcmp_amd64_mov(
@@ -157,14 +193,26 @@ kefir_result_t kefir_codegen_amd64_zero_memory(struct kefir_mem *mem, struct kef
                                                kefir_asmcmp_virtual_register_index_t target_vreg, kefir_size_t size) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(function != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid codegen amd64 function"));
+    REQUIRE(target_vreg != KEFIR_ASMCMP_INDEX_NONE,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expectd valid target virtual register"));
+
+    REQUIRE_OK(kefir_codegen_amd64_fill_memory(mem, function, target_vreg, 0, size));
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_codegen_amd64_fill_memory(struct kefir_mem *mem, struct kefir_codegen_amd64_function *function,
+                                               kefir_asmcmp_virtual_register_index_t target_vreg, kefir_uint8_t value,
+                                               kefir_size_t size) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(function != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid codegen amd64 function"));
     REQUIRE(target_vreg != KEFIR_ASMCMP_INDEX_NONE,
             KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expectd valid target virtual register"));
     REQUIRE(size > 0, KEFIR_OK);
 
-    if (size <= COPY_UNROLL_LIMIT) {
-        REQUIRE_OK(unrolled_zero(mem, function, target_vreg, size));
+    if (size <= FILL_UNROLL_LIMIT) {
+        REQUIRE_OK(unrolled_fill(mem, function, target_vreg, value, size));
     } else {
-        REQUIRE_OK(full_zero(mem, function, target_vreg, size));
+        REQUIRE_OK(full_fill(mem, function, target_vreg, value, size));
     }
     return KEFIR_OK;
 }
@@ -27,6 +27,8 @@
 #include "kefir/codegen/amd64/module.h"
 #include "kefir/codegen/amd64/lowering.h"
 #include "kefir/optimizer/module_liveness.h"
+#include "kefir/optimizer/module_stream.h"
+#include "kefir/optimizer/trace.h"
 #include "kefir/target/abi/amd64/type_layout.h"
 #include "kefir/core/error.h"
 #include "kefir/core/util.h"
@@ -747,51 +749,136 @@ static kefir_result_t generate_fini_array(struct kefir_codegen_amd64_module *cod
     return KEFIR_OK;
 }
 
-static kefir_result_t translate_impl(struct kefir_mem *mem, struct kefir_codegen_amd64_module *codegen_module) {
-    REQUIRE_OK(kefir_opt_module_liveness_trace(mem, codegen_module->liveness, codegen_module->module));
-    REQUIRE_OK(KEFIR_AMD64_XASMGEN_PROLOGUE(&codegen_module->codegen->xasmgen));
-    REQUIRE_OK(translate_module_identifiers(codegen_module->module->ir_module, codegen_module->codegen,
-                                            codegen_module->liveness));
+struct function_callees_payload {
+    struct kefir_mem *mem;
+    const struct kefir_ir_module *ir_module;
+    const struct kefir_opt_function *function;
+    struct kefir_list *callees;
+};
+
+static kefir_result_t trace_function_callee(kefir_opt_instruction_ref_t instr_ref, void *payload) {
+    ASSIGN_DECL_CAST(struct function_callees_payload *, param, payload);
+    REQUIRE(param != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid function callees payload"));
+
+    const struct kefir_opt_instruction *instr;
+    REQUIRE_OK(kefir_opt_code_container_instr(&param->function->code, instr_ref, &instr));
+    REQUIRE(
+        instr->operation.opcode == KEFIR_OPT_OPCODE_INVOKE || instr->operation.opcode == KEFIR_OPT_OPCODE_TAIL_INVOKE,
+        KEFIR_OK);
+
+    const struct kefir_opt_call_node *call;
+    REQUIRE_OK(kefir_opt_code_container_call(&param->function->code,
+                                             instr->operation.parameters.function_call.call_ref, &call));
+    const struct kefir_ir_function_decl *decl =
+        kefir_ir_module_get_declaration(param->ir_module, call->function_declaration_id);
+    REQUIRE(decl != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unable to find IR function declaration"));
+    if (decl->name != NULL && kefir_ir_module_get_function(param->ir_module, decl->name) != NULL) {
+        REQUIRE_OK(kefir_list_insert_after(param->mem, param->callees, kefir_list_tail(param->callees),
+                                           (void *) decl->name));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t translate_function(struct kefir_mem *mem, struct kefir_codegen_amd64_module *codegen_module,
+                                         const struct kefir_ir_function *ir_func, kefir_bool_t *has_constructors,
+                                         kefir_bool_t *has_destructors, struct kefir_list *callees) {
+    struct kefir_opt_function *func = NULL;
+    REQUIRE_OK(kefir_opt_module_get_function(codegen_module->module, ir_func->declaration->id, &func));
+
+    struct kefir_codegen_amd64_function *codegen_func;
+    REQUIRE_OK(kefir_codegen_amd64_module_insert_function(mem, codegen_module, func, &codegen_func));
+    REQUIRE_OK(kefir_codegen_amd64_function_translate(mem, codegen_func));
     REQUIRE_OK(KEFIR_AMD64_XASMGEN_NEWLINE(&codegen_module->codegen->xasmgen, 1));
 
-    REQUIRE_OK(
-        KEFIR_AMD64_XASMGEN_SECTION(&codegen_module->codegen->xasmgen, ".text", KEFIR_AMD64_XASMGEN_SECTION_NOATTR));
-    if (!codegen_module->codegen->config->runtime_function_generator_mode) {
-        REQUIRE_OK(KEFIR_AMD64_XASMGEN_LABEL(&codegen_module->codegen->xasmgen, KEFIR_AMD64_TEXT_SECTION_BEGIN,
-                                             codegen_module->codegen->symbol_prefix));
+    if (ir_func->flags.constructor) {
+        *has_constructors = true;
+    }
+    if (ir_func->flags.destructor) {
+        *has_destructors = true;
     }
 
-    kefir_bool_t has_constructors = false;
-    kefir_bool_t has_destructors = false;
-    struct kefir_hashtree_node_iterator iter;
-    for (const struct kefir_ir_function *ir_func =
-             kefir_ir_module_function_iter(codegen_module->module->ir_module, &iter);
-         ir_func != NULL; ir_func = kefir_ir_module_function_next(&iter)) {
-        if (!kefir_opt_module_is_symbol_alive(codegen_module->liveness, (const char *) iter.node->key)) {
-            continue;
-        }
-        struct kefir_opt_function *func = NULL;
-        REQUIRE_OK(kefir_opt_module_get_function(codegen_module->module, ir_func->declaration->id, &func));
-
-        struct kefir_codegen_amd64_function *codegen_func;
-        REQUIRE_OK(kefir_codegen_amd64_module_insert_function(mem, codegen_module, func, &codegen_func));
-        REQUIRE_OK(kefir_codegen_amd64_function_translate(mem, codegen_func));
-        REQUIRE_OK(KEFIR_AMD64_XASMGEN_NEWLINE(&codegen_module->codegen->xasmgen, 1));
+    if (callees != NULL) {
+        struct function_callees_payload payload = {
+            .mem = mem, .ir_module = codegen_module->module->ir_module, .function = func, .callees = callees};
+        struct kefir_opt_code_container_tracer tracer = {.trace_instruction = trace_function_callee,
+                                                         .payload = &payload};
+        REQUIRE_OK(kefir_opt_code_container_trace(mem, &func->code, &tracer));
+    }
+    return KEFIR_OK;
+}
 
-        if (ir_func->flags.constructor) {
-            has_constructors = true;
-        }
-        if (ir_func->flags.destructor) {
-            has_destructors = true;
+static kefir_result_t translate_functions_in_call_order_impl(struct kefir_mem *mem,
+                                                             struct kefir_codegen_amd64_module *codegen_module,
+                                                             kefir_bool_t *has_constructors,
+                                                             kefir_bool_t *has_destructors,
+                                                             struct kefir_hashtreeset *translated,
+                                                             struct kefir_list *stack, struct kefir_list *callees) {
+    const struct kefir_ir_module *ir_module = codegen_module->module->ir_module;
+    struct kefir_hashtree_node_iterator iter;
+    for (const struct kefir_ir_function *root_func = kefir_ir_module_function_iter(ir_module, &iter);
+         root_func != NULL; root_func = kefir_ir_module_function_next(&iter)) {
+        REQUIRE_OK(kefir_list_insert_after(mem, stack, kefir_list_tail(stack), (void *) iter.node->key));
+
+        // Depth-first walk over the call graph: each function is immediately followed by its yet untranslated
+        // callees in the order of calls, so that callers and callees share instruction cache lines and pages.
+        for (struct kefir_list_entry *stack_iter = kefir_list_tail(stack); stack_iter != NULL;
+             stack_iter = kefir_list_tail(stack)) {
+            ASSIGN_DECL_CAST(const char *, function_name, stack_iter->value);
+            REQUIRE_OK(kefir_list_pop(mem, stack, stack_iter));
+            if (kefir_hashtreeset_has(translated, (kefir_hashtreeset_entry_t) function_name)) {
+                continue;
+            }
+            REQUIRE_OK(kefir_hashtreeset_add(mem, translated, (kefir_hashtreeset_entry_t) function_name));
+            if (!kefir_opt_module_is_symbol_alive(codegen_module->liveness, function_name)) {
+                continue;
+            }
+
+            const struct kefir_ir_function *ir_func = kefir_ir_module_get_function(ir_module, function_name);
+            REQUIRE(ir_func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unable to find IR function"));
+            REQUIRE_OK(translate_function(mem, codegen_module, ir_func, has_constructors, has_destructors, callees));
+
+            for (struct kefir_list_entry *callee_iter = kefir_list_tail(callees); callee_iter != NULL;
+                 callee_iter = callee_iter->prev) {
+                if (!kefir_hashtreeset_has(translated, (kefir_hashtreeset_entry_t) callee_iter->value)) {
+                    REQUIRE_OK(kefir_list_insert_after(mem, stack, kefir_list_tail(stack), callee_iter->value));
+                }
+            }
+            REQUIRE_OK(kefir_list_clear(mem, callees));
         }
     }
+    return KEFIR_OK;
+}
 
-    REQUIRE_OK(translate_global_inline_assembly(codegen_module->codegen, codegen_module->module));
-    if (!codegen_module->codegen->config->runtime_function_generator_mode) {
-        REQUIRE_OK(KEFIR_AMD64_XASMGEN_LABEL(&codegen_module->codegen->xasmgen, KEFIR_AMD64_TEXT_SECTION_END,
-                                             codegen_module->codegen->symbol_prefix));
-    }
+static kefir_result_t translate_functions_in_call_order(struct kefir_mem *mem,
+                                                        struct kefir_codegen_amd64_module *codegen_module,
+                                                        kefir_bool_t *has_constructors,
+                                                        kefir_bool_t *has_destructors) {
+    struct kefir_hashtreeset translated;
+    struct kefir_list stack, callees;
+    REQUIRE_OK(kefir_hashtreeset_init(&translated, &kefir_hashtree_str_ops));
+    REQUIRE_OK(kefir_list_init(&stack));
+    REQUIRE_OK(kefir_list_init(&callees));
+
+    kefir_result_t res = translate_functions_in_call_order_impl(mem, codegen_module, has_constructors,
+                                                                has_destructors, &translated, &stack, &callees);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_list_free(mem, &callees);
+        kefir_list_free(mem, &stack);
+        kefir_hashtreeset_free(mem, &translated);
+        return res;
+    });
+    res = kefir_list_free(mem, &callees);
+    REQUIRE_CHAIN(&res, kefir_list_free(mem, &stack));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_hashtreeset_free(mem, &translated);
+        return res;
+    });
+    REQUIRE_OK(kefir_hashtreeset_free(mem, &translated));
+    return KEFIR_OK;
+}
 
+static kefir_result_t translate_module_tail(struct kefir_mem *mem, struct kefir_codegen_amd64_module *codegen_module,
+                                            kefir_bool_t has_constructors, kefir_bool_t has_destructors) {
     REQUIRE_OK(KEFIR_AMD64_XASMGEN_NEWLINE(&codegen_module->codegen->xasmgen, 1));
     REQUIRE_OK(translate_data(mem, codegen_module));
 
@@ -822,11 +909,93 @@ static kefir_result_t translate_impl(struct kefir_mem *mem, struct kefir_codegen
     return KEFIR_OK;
 }
 
+static kefir_result_t translate_impl(struct kefir_mem *mem, struct kefir_codegen_amd64_module *codegen_module) {
+    REQUIRE_OK(kefir_opt_module_liveness_trace(mem, codegen_module->liveness, codegen_module->module));
+    REQUIRE_OK(KEFIR_AMD64_XASMGEN_PROLOGUE(&codegen_module->codegen->xasmgen));
+    REQUIRE_OK(translate_module_identifiers(codegen_module->module->ir_module, codegen_module->codegen,
+                                            codegen_module->liveness));
+    REQUIRE_OK(KEFIR_AMD64_XASMGEN_NEWLINE(&codegen_module->codegen->xasmgen, 1));
+
+    REQUIRE_OK(
+        KEFIR_AMD64_XASMGEN_SECTION(&codegen_module->codegen->xasmgen, ".text", KEFIR_AMD64_XASMGEN_SECTION_NOATTR));
+    if (!codegen_module->codegen->config->runtime_function_generator_mode) {
+        REQUIRE_OK(KEFIR_AMD64_XASMGEN_LABEL(&codegen_module->codegen->xasmgen, KEFIR_AMD64_TEXT_SECTION_BEGIN,
+                                             codegen_module->codegen->symbol_prefix));
+    }
+
+    kefir_bool_t has_constructors = false;
+    kefir_bool_t has_destructors = false;
+    if (codegen_module->codegen->config->code_layout) {
+        REQUIRE_OK(translate_functions_in_call_order(mem, codegen_module, &has_constructors, &has_destructors));
+    } else {
+        struct kefir_hashtree_node_iterator iter;
+        for (const struct kefir_ir_function *ir_func =
+                 kefir_ir_module_function_iter(codegen_module->module->ir_module, &iter);
+             ir_func != NULL; ir_func = kefir_ir_module_function_next(&iter)) {
+            if (kefir_opt_module_is_symbol_alive(codegen_module->liveness, (const char *) iter.node->key)) {
+                REQUIRE_OK(
+                    translate_function(mem, codegen_module, ir_func, &has_constructors, &has_destructors, NULL));
+            }
+        }
+    }
+
+    REQUIRE_OK(translate_global_inline_assembly(codegen_module->codegen, codegen_module->module));
+    if (!codegen_module->codegen->config->runtime_function_generator_mode) {
+        REQUIRE_OK(KEFIR_AMD64_XASMGEN_LABEL(&codegen_module->codegen->xasmgen, KEFIR_AMD64_TEXT_SECTION_END,
+                                             codegen_module->codegen->symbol_prefix));
+    }
+
+    REQUIRE_OK(translate_module_tail(mem, codegen_module, has_constructors, has_destructors));
+    return KEFIR_OK;
+}
+
+static kefir_result_t init_xasmgen(struct kefir_mem *mem, struct kefir_codegen_amd64 *codegen,
+                                   kefir_codegen_output_kind_t output_kind) {
+    switch (output_kind) {
+        case KEFIR_CODEGEN_OUTPUT_ASSEMBLY:
+            REQUIRE_OK(kefir_asm_amd64_xasmgen_init(mem, &codegen->xasmgen, codegen->output, codegen->syntax));
+            break;
+
+        case KEFIR_CODEGEN_OUTPUT_OBJECT:
+            REQUIRE_OK(kefir_asm_amd64_xasmgen_elf_init(mem, &codegen->xasmgen, codegen->output, codegen->syntax));
+            break;
+    }
+    codegen->xasmgen_initialized = true;
+    codegen->codegen.output_kind = output_kind;
+
+    if (codegen->config->debug_info) {
+        REQUIRE_OK(KEFIR_AMD64_XASMGEN_NEW_DEBUG_INFO_TRACKER(mem, &codegen->xasmgen, &codegen->debug_info_tracker));
+    }
+    return KEFIR_OK;
+}
+
+// Integrated assembler is only used for modules that can be encoded completely. Inline assembly, textual runtime
+// functions and detailed output require textual assembly. In streaming mode the required runtime functions are known
+// only after the code has been emitted, thus streaming translation always produces textual assembly when runtime
+// functions might be necessary.
+static kefir_result_t select_output_kind(struct kefir_mem *mem, struct kefir_codegen_amd64 *codegen,
+                                         const struct kefir_opt_module *module, kefir_bool_t streaming) {
+    REQUIRE(!codegen->xasmgen_initialized, KEFIR_OK);
+
+    const kefir_bool_t generates_runtime_functions =
+        !codegen->config->runtime_function_generator_mode && codegen->runtime_hooks != NULL;
+    kefir_codegen_output_kind_t output_kind = KEFIR_CODEGEN_OUTPUT_OBJECT;
+    if (codegen->syntax == KEFIR_AMD64_XASMGEN_SYNTAX_YASM || codegen->config->print_details != NULL ||
+        !kefir_hashtree_empty(&module->ir_module->inline_assembly) ||
+        !kefir_hashtree_empty(&module->ir_module->global_inline_asm) ||
+        (generates_runtime_functions && (streaming || !kefir_hashtreeset_empty(&module->runtime_functions)))) {
+        output_kind = KEFIR_CODEGEN_OUTPUT_ASSEMBLY;
+    }
+    REQUIRE_OK(init_xasmgen(mem, codegen, output_kind));
+    return KEFIR_OK;
+}
+
 static kefir_result_t translate_fn(struct kefir_mem *mem, struct kefir_codegen *cg, struct kefir_opt_module *module) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(cg != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid amd64 codegen"));
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
     ASSIGN_DECL_CAST(struct kefir_codegen_amd64 *, codegen, cg->data);
+    REQUIRE_OK(select_output_kind(mem, codegen, module, false));
 
     struct kefir_codegen_amd64_module codegen_module;
     struct kefir_opt_module_liveness liveness;
@@ -848,12 +1017,133 @@ static kefir_result_t translate_fn(struct kefir_mem *mem, struct kefir_codegen *
     return res;
 }
 
+static kefir_result_t translate_streaming_function(struct kefir_mem *mem,
+                                                   struct kefir_codegen_amd64_module *codegen_module,
+                                                   struct kefir_opt_module_stream *stream,
+                                                   const struct kefir_ir_function *ir_func,
+                                                   kefir_bool_t *has_constructors, kefir_bool_t *has_destructors) {
+    kefir_bool_t alive;
+    REQUIRE_OK(kefir_opt_module_stream_is_alive(stream, codegen_module->liveness, ir_func, &alive));
+    if (alive) {
+        REQUIRE_OK(translate_function(mem, codegen_module, ir_func, has_constructors, has_destructors, NULL));
+        REQUIRE_OK(kefir_opt_module_liveness_add_root(mem, codegen_module->liveness, ir_func->name));
+    } else {
+        REQUIRE_OK(kefir_opt_module_stream_mark_dead(stream, ir_func));
+    }
+
+    // Debug information generation refers to both optimizer and code generator functions, thus these are retained
+    // until the end of module translation. IR function body is not needed past construction of the function.
+    if (!codegen_module->codegen->config->debug_info) {
+        if (alive) {
+            REQUIRE_OK(kefir_codegen_amd64_module_drop_function(mem, codegen_module, ir_func->name));
+        }
+        REQUIRE_OK(kefir_opt_module_drop_function(mem, codegen_module->module, ir_func->declaration->id));
+        REQUIRE_OK(kefir_ir_module_release_function_body(mem, codegen_module->module->ir_module, ir_func->name));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t translate_streaming_impl(struct kefir_mem *mem, struct kefir_codegen_amd64_module *codegen_module,
+                                               struct kefir_opt_module_stream *stream,
+                                               const struct kefir_optimizer_configuration *config) {
+    REQUIRE_OK(KEFIR_AMD64_XASMGEN_PROLOGUE(&codegen_module->codegen->xasmgen));
+    REQUIRE_OK(
+        KEFIR_AMD64_XASMGEN_SECTION(&codegen_module->codegen->xasmgen, ".text", KEFIR_AMD64_XASMGEN_SECTION_NOATTR));
+    if (!codegen_module->codegen->config->runtime_function_generator_mode) {
+        REQUIRE_OK(KEFIR_AMD64_XASMGEN_LABEL(&codegen_module->codegen->xasmgen, KEFIR_AMD64_TEXT_SECTION_BEGIN,
+                                             codegen_module->codegen->symbol_prefix));
+    }
+
+    // Functions are constructed and optimized callees first. Once all callers of a function have been optimized, the
+    // function is either translated or discarded, and its optimizer and code generator state is released.
+    kefir_bool_t has_constructors = false;
+    kefir_bool_t has_destructors = false;
+    for (;;) {
+        const struct kefir_ir_function *ir_func;
+        REQUIRE_OK(kefir_opt_module_stream_next_construction(mem, stream, &ir_func));
+        if (ir_func == NULL) {
+            break;
+        }
+
+        struct kefir_opt_function *func;
+        REQUIRE_OK(kefir_opt_module_construct_function(mem, codegen_module->module, ir_func, &func));
+        func->debug_info.record_debug_info = config->debug_info;
+        REQUIRE_OK(kefir_optimizer_pipeline_apply_function(mem, codegen_module->module, ir_func->declaration->id,
+                                                           config));
+        REQUIRE_OK(
+            kefir_opt_module_liveness_summarize_function(mem, codegen_module->liveness, codegen_module->module, func));
+        REQUIRE_OK(kefir_opt_module_stream_constructed(mem, stream, ir_func));
+
+        for (;;) {
+            REQUIRE_OK(kefir_opt_module_stream_next_ready(mem, stream, &ir_func));
+            if (ir_func == NULL) {
+                break;
+            }
+            REQUIRE_OK(translate_streaming_function(mem, codegen_module, stream, ir_func, &has_constructors,
+                                                    &has_destructors));
+        }
+    }
+
+    REQUIRE_OK(kefir_opt_module_liveness_trace(mem, codegen_module->liveness, codegen_module->module));
+    REQUIRE_OK(translate_global_inline_assembly(codegen_module->codegen, codegen_module->module));
+    if (!codegen_module->codegen->config->runtime_function_generator_mode) {
+        REQUIRE_OK(KEFIR_AMD64_XASMGEN_LABEL(&codegen_module->codegen->xasmgen, KEFIR_AMD64_TEXT_SECTION_END,
+                                             codegen_module->codegen->symbol_prefix));
+    }
+
+    // Module identifiers are emitted after the code, as lowering might introduce new identifiers and exact liveness
+    // information is available only at this point.
+    REQUIRE_OK(KEFIR_AMD64_XASMGEN_NEWLINE(&codegen_module->codegen->xasmgen, 1));
+    REQUIRE_OK(translate_module_identifiers(codegen_module->module->ir_module, codegen_module->codegen,
+                                            codegen_module->liveness));
+    REQUIRE_OK(translate_module_tail(mem, codegen_module, has_constructors, has_destructors));
+    return KEFIR_OK;
+}
+
+static kefir_result_t translate_streaming_fn(struct kefir_mem *mem, struct kefir_codegen *cg,
+                                             struct kefir_opt_module *module,
+                                             const struct kefir_optimizer_configuration *config) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(cg != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid amd64 codegen"));
+    REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
+    REQUIRE(config != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer configuration"));
+    ASSIGN_DECL_CAST(struct kefir_codegen_amd64 *, codegen, cg->data);
+    REQUIRE_OK(select_output_kind(mem, codegen, module, true));
+
+    struct kefir_codegen_amd64_module codegen_module;
+    struct kefir_opt_module_liveness liveness;
+    struct kefir_opt_module_stream stream;
+    REQUIRE_OK(kefir_opt_module_stream_init(mem, &stream, module->ir_module));
+    kefir_result_t res = kefir_opt_module_liveness_init(&liveness);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_opt_module_stream_free(mem, &stream);
+        return res;
+    });
+    REQUIRE_OK(kefir_codegen_amd64_module_init(&codegen_module, codegen, module, &liveness));
+    REQUIRE_CHAIN(&res, translate_streaming_impl(mem, &codegen_module, &stream, config));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_codegen_amd64_module_free(mem, &codegen_module);
+        kefir_opt_module_liveness_free(mem, &liveness);
+        kefir_opt_module_stream_free(mem, &stream);
+        return res;
+    });
+    res = kefir_codegen_amd64_module_free(mem, &codegen_module);
+    REQUIRE_CHAIN(&res, kefir_opt_module_liveness_free(mem, &liveness));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_opt_module_stream_free(mem, &stream);
+        return res;
+    });
+    REQUIRE_OK(kefir_opt_module_stream_free(mem, &stream));
+    return KEFIR_OK;
+}
+
 static kefir_result_t close_impl(struct kefir_mem *mem, struct kefir_codegen *cg) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(cg != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid code generator interface"));
     REQUIRE(cg->data != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 code generator"));
     ASSIGN_DECL_CAST(struct kefir_codegen_amd64 *, codegen, cg->data);
     KEFIR_FREE(mem, (char *) codegen->symbol_prefix);
+    REQUIRE(codegen->xasmgen_initialized, KEFIR_OK);
     if (codegen->debug_info_tracker != NULL) {
         REQUIRE_OK(KEFIR_AMD64_XASMGEN_FREE_DEBUG_INFO_TRACKER(mem, &codegen->xasmgen, codegen->debug_info_tracker));
     }
@@ -875,14 +1165,19 @@ kefir_result_t kefir_codegen_amd64_init(struct kefir_mem *mem, struct kefir_code
 
     kefir_asm_amd64_xasmgen_syntax_t syntax = KEFIR_AMD64_XASMGEN_SYNTAX_ATT;
     REQUIRE_OK(kefir_codegen_match_syntax(config->syntax, &syntax));
-    REQUIRE_OK(kefir_asm_amd64_xasmgen_init(mem, &codegen->xasmgen, output, syntax));
     codegen->codegen.translate_optimized = translate_fn;
+    codegen->codegen.translate_streaming = translate_streaming_fn;
     codegen->codegen.close = close_impl;
+    codegen->codegen.output_kind = KEFIR_CODEGEN_OUTPUT_ASSEMBLY;
     codegen->codegen.data = codegen;
     codegen->codegen.self = codegen;
     codegen->config = config;
     codegen->abi_variant = abi_variant;
     codegen->runtime_hooks = runtime_hooks;
+    codegen->output = output;
+    codegen->syntax = syntax;
+    codegen->xasmgen_initialized = false;
+    codegen->debug_info_tracker = NULL;
     char symbol_prefix[128];
     int prefix_length = 0;
     switch (syntax) {
@@ -896,10 +1191,10 @@ kefir_result_t kefir_codegen_amd64_init(struct kefir_mem *mem, struct kefir_code
             prefix_length = snprintf(symbol_prefix, sizeof(symbol_prefix), "%s", config->symbol_prefix);
             break;
     }
-    if (config->debug_info) {
-        REQUIRE_OK(KEFIR_AMD64_XASMGEN_NEW_DEBUG_INFO_TRACKER(mem, &codegen->xasmgen, &codegen->debug_info_tracker));
-    } else {
-        codegen->debug_info_tracker = NULL;
+    // Output kind of the integrated assembler depends on the module contents, thus the choice is deferred until
+    // translation
+    if (!config->integrated_assembler) {
+        REQUIRE_OK(init_xasmgen(mem, codegen, KEFIR_CODEGEN_OUTPUT_ASSEMBLY));
     }
 
     char *prefix_copy = KEFIR_MALLOC(mem, sizeof(char) * (prefix_length + 1));
@@ -0,0 +1,722 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "kefir/codegen/amd64/frame_placement.h"
+#include "kefir/target/abi/amd64/function.h"
+#include "kefir/core/hashtable.h"
+#include "kefir/core/error.h"
+#include "kefir/core/util.h"
+
+#define MAX_DEFERRED_COPIES 8
+
+typedef enum register_class {
+    REGISTER_CLASS_SCRATCH,
+    REGISTER_CLASS_CALLEE_PRESERVED,
+    REGISTER_CLASS_STACK
+} register_class_t;
+
+static kefir_result_t classify_register(kefir_abi_amd64_variant_t abi_variant, kefir_asm_amd64_xasmgen_register_t reg,
+                                        register_class_t *klass, kefir_asm_amd64_xasmgen_register_t *reg64_ptr) {
+    *klass = REGISTER_CLASS_SCRATCH;
+    ASSIGN_PTR(reg64_ptr, reg);
+    REQUIRE(!kefir_asm_amd64_xasmgen_register_is_floating_point(reg), KEFIR_OK);
+
+    kefir_asm_amd64_xasmgen_register_t reg64;
+    REQUIRE_OK(kefir_asm_amd64_xasmgen_register64(reg, &reg64));
+    ASSIGN_PTR(reg64_ptr, reg64);
+    if (reg64 == KEFIR_AMD64_XASMGEN_REGISTER_RSP || reg64 == KEFIR_AMD64_XASMGEN_REGISTER_RBP) {
+        *klass = REGISTER_CLASS_STACK;
+        return KEFIR_OK;
+    }
+
+    for (kefir_size_t i = 0; i < kefir_abi_amd64_num_of_callee_preserved_general_purpose_registers(abi_variant); i++) {
+        kefir_asm_amd64_xasmgen_register_t preserved_reg;
+        REQUIRE_OK(kefir_abi_amd64_get_callee_preserved_general_purpose_register(abi_variant, i, &preserved_reg));
+        if (reg64 == preserved_reg) {
+            *klass = REGISTER_CLASS_CALLEE_PRESERVED;
+            break;
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_bool_t is_stack_pointer(kefir_asmcmp_physical_register_index_t reg) {
+    if (kefir_asm_amd64_xasmgen_register_is_floating_point((kefir_asm_amd64_xasmgen_register_t) reg)) {
+        return false;
+    }
+    kefir_asm_amd64_xasmgen_register_t reg64;
+    return kefir_asm_amd64_xasmgen_register64((kefir_asm_amd64_xasmgen_register_t) reg, &reg64) == KEFIR_OK &&
+           reg64 == KEFIR_AMD64_XASMGEN_REGISTER_RSP;
+}
+
+static kefir_bool_t value_uses_stack_pointer(const struct kefir_asmcmp_value *value) {
+    switch (value->type) {
+        case KEFIR_ASMCMP_VALUE_TYPE_PHYSICAL_REGISTER:
+            return is_stack_pointer(value->phreg);
+
+        case KEFIR_ASMCMP_VALUE_TYPE_INDIRECT:
+            return (value->indirect.type == KEFIR_ASMCMP_INDIRECT_PHYSICAL_BASIS &&
+                    is_stack_pointer(value->indirect.base.phreg)) ||
+                   (value->indirect.index_type == KEFIR_ASMCMP_INDIRECT_INDEX_PHYSICAL &&
+                    is_stack_pointer(value->indirect.index.phreg));
+
+        default:
+            return false;
+    }
+}
+
+kefir_result_t kefir_codegen_amd64_frame_red_zone_eligible(const struct kefir_asmcmp_amd64 *target,
+                                                           kefir_bool_t *eligible) {
+    REQUIRE(target != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid asmcmp amd64 target"));
+    REQUIRE(eligible != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to boolean flag"));
+
+    *eligible = false;
+    for (kefir_asmcmp_instruction_index_t instr_index = kefir_asmcmp_context_instr_head(&target->context);
+         instr_index != KEFIR_ASMCMP_INDEX_NONE;
+         instr_index = kefir_asmcmp_context_instr_next(&target->context, instr_index)) {
+
+        struct kefir_asmcmp_instruction *instr;
+        REQUIRE_OK(kefir_asmcmp_context_instr_at(&target->context, instr_index, &instr));
+        switch (instr->opcode) {
+            case KEFIR_ASMCMP_AMD64_OPCODE(call):
+            case KEFIR_ASMCMP_AMD64_OPCODE(push):
+            case KEFIR_ASMCMP_AMD64_OPCODE(pop):
+            case KEFIR_ASMCMP_AMD64_OPCODE(pushfq):
+            case KEFIR_ASMCMP_AMD64_OPCODE(popfq):
+            case KEFIR_ASMCMP_AMD64_OPCODE(inline_assembly):
+                return KEFIR_OK;
+
+            default:
+                if (value_uses_stack_pointer(&instr->args[0]) || value_uses_stack_pointer(&instr->args[1]) ||
+                    value_uses_stack_pointer(&instr->args[2])) {
+                    return KEFIR_OK;
+                }
+                break;
+        }
+    }
+
+    *eligible = true;
+    return KEFIR_OK;
+}
+
+static kefir_bool_t is_conditional_jump(kefir_asmcmp_instruction_opcode_t opcode) {
+    switch (opcode) {
+        case KEFIR_ASMCMP_AMD64_OPCODE(jz):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jnz):
+        case KEFIR_ASMCMP_AMD64_OPCODE(je):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jo):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jne):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jc):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jnc):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jno):
+        case KEFIR_ASMCMP_AMD64_OPCODE(js):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jns):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jp):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jnp):
+        case KEFIR_ASMCMP_AMD64_OPCODE(ja):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jae):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jb):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jnb):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jbe):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jg):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jge):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jl):
+        case KEFIR_ASMCMP_AMD64_OPCODE(jle):
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static kefir_bool_t reads_flags(kefir_asmcmp_instruction_opcode_t opcode) {
+    switch (opcode) {
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovl):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovle):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovg):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovge):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmove):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovbe):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovb):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmova):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovae):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovne):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovs):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovns):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovz):
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmovnz):
+        case KEFIR_ASMCMP_AMD64_OPCODE(sete):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setne):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setnp):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setp):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setg):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setge):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setl):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setle):
+        case KEFIR_ASMCMP_AMD64_OPCODE(seta):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setae):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setb):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setnb):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setbe):
+        case KEFIR_ASMCMP_AMD64_OPCODE(seto):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setno):
+        case KEFIR_ASMCMP_AMD64_OPCODE(sets):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setns):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setc):
+        case KEFIR_ASMCMP_AMD64_OPCODE(setnc):
+        case KEFIR_ASMCMP_AMD64_OPCODE(adc):
+        case KEFIR_ASMCMP_AMD64_OPCODE(sbb):
+        case KEFIR_ASMCMP_AMD64_OPCODE(pushfq):
+        case KEFIR_ASMCMP_AMD64_OPCODE(fcmove):
+            return true;
+
+        default:
+            return is_conditional_jump(opcode);
+    }
+}
+
+static kefir_bool_t overwrites_flags(kefir_asmcmp_instruction_opcode_t opcode) {
+    switch (opcode) {
+        case KEFIR_ASMCMP_AMD64_OPCODE(cmp):
+        case KEFIR_ASMCMP_AMD64_OPCODE(test):
+        case KEFIR_ASMCMP_AMD64_OPCODE(add):
+        case KEFIR_ASMCMP_AMD64_OPCODE(sub):
+        case KEFIR_ASMCMP_AMD64_OPCODE(and):
+        case KEFIR_ASMCMP_AMD64_OPCODE(or):
+        case KEFIR_ASMCMP_AMD64_OPCODE(xor):
+        case KEFIR_ASMCMP_AMD64_OPCODE(ucomiss):
+        case KEFIR_ASMCMP_AMD64_OPCODE(ucomisd):
+        case KEFIR_ASMCMP_AMD64_OPCODE(comiss):
+        case KEFIR_ASMCMP_AMD64_OPCODE(comisd):
+        case KEFIR_ASMCMP_AMD64_OPCODE(call):
+        case KEFIR_ASMCMP_AMD64_OPCODE(ret):
+        case KEFIR_ASMCMP_AMD64_OPCODE(ud2):
+        case KEFIR_ASMCMP_AMD64_OPCODE(tail_call):
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static kefir_bool_t is_terminator(kefir_asmcmp_instruction_opcode_t opcode) {
+    switch (opcode) {
+        case KEFIR_ASMCMP_AMD64_OPCODE(jmp):
+        case KEFIR_ASMCMP_AMD64_OPCODE(ret):
+        case KEFIR_ASMCMP_AMD64_OPCODE(ud2):
+        case KEFIR_ASMCMP_AMD64_OPCODE(tail_call):
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+struct deferred_copy {
+    kefir_asmcmp_instruction_index_t instr_index;
+    struct kefir_asmcmp_instruction instr;
+    kefir_asm_amd64_xasmgen_register_t target;
+    kefir_asm_amd64_xasmgen_register_t source;
+};
+
+struct shrink_wrap_state {
+    struct kefir_asmcmp_amd64 *target;
+    struct kefir_hashtable label_refs;
+    struct deferred_copy copies[MAX_DEFERRED_COPIES];
+    kefir_size_t num_of_copies;
+};
+
+static kefir_result_t count_label_reference(struct kefir_mem *mem, struct shrink_wrap_state *state,
+                                            kefir_asmcmp_label_index_t label) {
+    kefir_hashtable_value_t *refs;
+    kefir_result_t res = kefir_hashtable_at_mut(&state->label_refs, (kefir_hashtable_key_t) label, &refs);
+    if (res == KEFIR_NOT_FOUND) {
+        REQUIRE_OK(kefir_hashtable_insert(mem, &state->label_refs, (kefir_hashtable_key_t) label,
+                                          (kefir_hashtable_value_t) 1));
+    } else {
+        REQUIRE_OK(res);
+        (*refs)++;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t count_value_label_references(struct kefir_mem *mem, struct shrink_wrap_state *state,
+                                                   const struct kefir_asmcmp_value *value) {
+    switch (value->type) {
+        case KEFIR_ASMCMP_VALUE_TYPE_INTERNAL_LABEL:
+            REQUIRE_OK(count_label_reference(mem, state, value->internal_label));
+            break;
+
+        case KEFIR_ASMCMP_VALUE_TYPE_RIP_INDIRECT_INTERNAL:
+            REQUIRE_OK(count_label_reference(mem, state, value->rip_indirection.internal));
+            break;
+
+        case KEFIR_ASMCMP_VALUE_TYPE_INDIRECT:
+            if (value->indirect.type == KEFIR_ASMCMP_INDIRECT_INTERNAL_LABEL_BASIS) {
+                REQUIRE_OK(count_label_reference(mem, state, value->indirect.base.internal_label));
+            }
+            break;
+
+        default:
+            // Intentionally left blank
+            break;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t label_references(const struct shrink_wrap_state *state,
+                                       kefir_asmcmp_instruction_index_t instr_index, kefir_size_t *refs) {
+    *refs = 0;
+    for (kefir_asmcmp_label_index_t label_index =
+             kefir_asmcmp_context_instr_label_head(&state->target->context, instr_index);
+         label_index != KEFIR_ASMCMP_INDEX_NONE;
+         label_index = kefir_asmcmp_context_instr_label_next(&state->target->context, label_index)) {
+        const struct kefir_asmcmp_label *label;
+        REQUIRE_OK(kefir_asmcmp_context_get_label(&state->target->context, label_index, &label));
+        if (label->external_dependencies || !kefir_hashtreeset_empty(&label->public_labels)) {
+            *refs = KEFIR_SIZE_MAX;
+            return KEFIR_OK;
+        }
+
+        kefir_hashtable_value_t label_refs;
+        kefir_result_t res = kefir_hashtable_at(&state->label_refs, (kefir_hashtable_key_t) label_index, &label_refs);
+        if (res != KEFIR_NOT_FOUND) {
+            REQUIRE_OK(res);
+            *refs += (kefir_size_t) label_refs;
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t falls_through(const struct shrink_wrap_state *state,
+                                    kefir_asmcmp_instruction_index_t instr_index, kefir_bool_t *fallthrough) {
+    *fallthrough = true;
+    for (kefir_asmcmp_instruction_index_t prev_index =
+             kefir_asmcmp_context_instr_prev(&state->target->context, instr_index);
+         prev_index != KEFIR_ASMCMP_INDEX_NONE;
+         prev_index = kefir_asmcmp_context_instr_prev(&state->target->context, prev_index)) {
+        struct kefir_asmcmp_instruction *instr;
+        REQUIRE_OK(kefir_asmcmp_context_instr_at(&state->target->context, prev_index, &instr));
+        if (instr->opcode != KEFIR_ASMCMP_AMD64_OPCODE(align)) {
+            *fallthrough = !is_terminator(instr->opcode);
+            break;
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t entry_register(const struct shrink_wrap_state *state,
+                                     kefir_asmcmp_physical_register_index_t *reg, kefir_bool_t apply,
+                                     kefir_bool_t *valid) {
+    register_class_t klass;
+    kefir_asm_amd64_xasmgen_register_t reg64;
+    REQUIRE_OK(classify_register(state->target->abi_variant, (kefir_asm_amd64_xasmgen_register_t) *reg, &klass,
+                                 &reg64));
+    switch (klass) {
+        case REGISTER_CLASS_SCRATCH:
+            return KEFIR_OK;
+
+        case REGISTER_CLASS_STACK:
+            *valid = false;
+            return KEFIR_OK;
+
+        case REGISTER_CLASS_CALLEE_PRESERVED:
+            break;
+    }
+
+    // Callee-preserved registers are only allowed in the entry region as aliases of deferred copies
+    const struct deferred_copy *copy = NULL;
+    for (kefir_size_t i = 0; copy == NULL && i < state->num_of_copies; i++) {
+        if (state->copies[i].target == reg64) {
+            copy = &state->copies[i];
+        }
+    }
+    if (copy == NULL || kefir_asm_amd64_xasmgen_register_is_high((kefir_asm_amd64_xasmgen_register_t) *reg)) {
+        *valid = false;
+        return KEFIR_OK;
+    }
+    REQUIRE(apply, KEFIR_OK);
+
+    kefir_asm_amd64_xasmgen_register_t replacement = copy->source;
+    if (kefir_asm_amd64_xasmgen_register_is_wide((kefir_asm_amd64_xasmgen_register_t) *reg, 32)) {
+        REQUIRE_OK(kefir_asm_amd64_xasmgen_register32(copy->source, &replacement));
+    } else if (kefir_asm_amd64_xasmgen_register_is_wide((kefir_asm_amd64_xasmgen_register_t) *reg, 16)) {
+        REQUIRE_OK(kefir_asm_amd64_xasmgen_register16(copy->source, &replacement));
+    } else if (kefir_asm_amd64_xasmgen_register_is_wide((kefir_asm_amd64_xasmgen_register_t) *reg, 8)) {
+        REQUIRE_OK(kefir_asm_amd64_xasmgen_register8(copy->source, &replacement));
+    }
+    *reg = (kefir_asmcmp_physical_register_index_t) replacement;
+    return KEFIR_OK;
+}
+
+static kefir_result_t entry_value(const struct shrink_wrap_state *state, struct kefir_asmcmp_value *value,
+                                  kefir_bool_t apply, kefir_bool_t *valid) {
+    switch (value->type) {
+        case KEFIR_ASMCMP_VALUE_TYPE_NONE:
+        case KEFIR_ASMCMP_VALUE_TYPE_INTEGER:
+            break;
+
+        case KEFIR_ASMCMP_VALUE_TYPE_PHYSICAL_REGISTER:
+            REQUIRE_OK(entry_register(state, &value->phreg, apply, valid));
+            break;
+
+        case KEFIR_ASMCMP_VALUE_TYPE_INDIRECT:
+            if (value->indirect.type != KEFIR_ASMCMP_INDIRECT_PHYSICAL_BASIS) {
+                *valid = false;
+                return KEFIR_OK;
+            }
+            REQUIRE_OK(entry_register(state, &value->indirect.base.phreg, apply, valid));
+            if (value->indirect.index_type == KEFIR_ASMCMP_INDIRECT_INDEX_PHYSICAL) {
+                REQUIRE_OK(entry_register(state, &value->indirect.index.phreg, apply, valid));
+            }
+            break;
+
+        default:
+            *valid = false;
+            break;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t frame_free_register(const struct shrink_wrap_state *state,
+                                          kefir_asmcmp_physical_register_index_t reg, kefir_bool_t *valid) {
+    register_class_t klass;
+    REQUIRE_OK(
+        classify_register(state->target->abi_variant, (kefir_asm_amd64_xasmgen_register_t) reg, &klass, NULL));
+    if (klass != REGISTER_CLASS_SCRATCH) {
+        *valid = false;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t frame_free_value(const struct shrink_wrap_state *state, const struct kefir_asmcmp_value *value,
+                                       kefir_bool_t *valid) {
+    switch (value->type) {
+        case KEFIR_ASMCMP_VALUE_TYPE_NONE:
+        case KEFIR_ASMCMP_VALUE_TYPE_INTEGER:
+        case KEFIR_ASMCMP_VALUE_TYPE_INTERNAL_LABEL:
+        case KEFIR_ASMCMP_VALUE_TYPE_EXTERNAL_LABEL:
+        case KEFIR_ASMCMP_VALUE_TYPE_RIP_INDIRECT_INTERNAL:
+        case KEFIR_ASMCMP_VALUE_TYPE_RIP_INDIRECT_EXTERNAL:
+        case KEFIR_ASMCMP_VALUE_TYPE_X87:
+            break;
+
+        case KEFIR_ASMCMP_VALUE_TYPE_PHYSICAL_REGISTER:
+            REQUIRE_OK(frame_free_register(state, value->phreg, valid));
+            break;
+
+        case KEFIR_ASMCMP_VALUE_TYPE_INDIRECT:
+            switch (value->indirect.type) {
+                case KEFIR_ASMCMP_INDIRECT_PHYSICAL_BASIS:
+                    REQUIRE_OK(frame_free_register(state, value->indirect.base.phreg, valid));
+                    break;
+
+                case KEFIR_ASMCMP_INDIRECT_INTERNAL_LABEL_BASIS:
+                case KEFIR_ASMCMP_INDIRECT_EXTERNAL_LABEL_BASIS:
+                    break;
+
+                case KEFIR_ASMCMP_INDIRECT_VIRTUAL_BASIS:
+                case KEFIR_ASMCMP_INDIRECT_LOCAL_AREA_BASIS:
+                case KEFIR_ASMCMP_INDIRECT_SPILL_AREA_BASIS:
+                    *valid = false;
+                    break;
+            }
+            if (value->indirect.index_type == KEFIR_ASMCMP_INDIRECT_INDEX_PHYSICAL) {
+                REQUIRE_OK(frame_free_register(state, value->indirect.index.phreg, valid));
+            }
+            break;
+
+        case KEFIR_ASMCMP_VALUE_TYPE_VIRTUAL_REGISTER:
+        case KEFIR_ASMCMP_VALUE_TYPE_INLINE_ASSEMBLY_INDEX:
+            *valid = false;
+            break;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t match_fast_path(const struct shrink_wrap_state *state, kefir_asmcmp_instruction_index_t begin,
+                                      kefir_asmcmp_instruction_index_t *terminator) {
+    *terminator = KEFIR_ASMCMP_INDEX_NONE;
+    for (kefir_asmcmp_instruction_index_t instr_index = begin; instr_index != KEFIR_ASMCMP_INDEX_NONE;
+         instr_index = kefir_asmcmp_context_instr_next(&state->target->context, instr_index)) {
+        kefir_size_t refs;
+        REQUIRE_OK(label_references(state, instr_index, &refs));
+        REQUIRE(instr_index == begin || refs == 0, KEFIR_OK);
+
+        struct kefir_asmcmp_instruction *instr;
+        REQUIRE_OK(kefir_asmcmp_context_instr_at(&state->target->context, instr_index, &instr));
+
+        kefir_bool_t valid = true;
+        REQUIRE_OK(frame_free_value(state, &instr->args[0], &valid));
+        REQUIRE_OK(frame_free_value(state, &instr->args[1], &valid));
+        REQUIRE_OK(frame_free_value(state, &instr->args[2], &valid));
+        REQUIRE(valid, KEFIR_OK);
+
+        switch (instr->opcode) {
+            case KEFIR_ASMCMP_AMD64_OPCODE(function_epilogue): {
+                const kefir_asmcmp_instruction_index_t next_index =
+                    kefir_asmcmp_context_instr_next(&state->target->context, instr_index);
+                REQUIRE(next_index != KEFIR_ASMCMP_INDEX_NONE, KEFIR_OK);
+                REQUIRE_OK(label_references(state, next_index, &refs));
+                REQUIRE(refs == 0, KEFIR_OK);
+                struct kefir_asmcmp_instruction *next_instr;
+                REQUIRE_OK(kefir_asmcmp_context_instr_at(&state->target->context, next_index, &next_instr));
+                REQUIRE(next_instr->opcode == KEFIR_ASMCMP_AMD64_OPCODE(ret), KEFIR_OK);
+                *terminator = instr_index;
+                return KEFIR_OK;
+            }
+
+            case KEFIR_ASMCMP_AMD64_OPCODE(tail_call):
+                *terminator = instr_index;
+                return KEFIR_OK;
+
+            case KEFIR_ASMCMP_AMD64_OPCODE(call):
+            case KEFIR_ASMCMP_AMD64_OPCODE(push):
+            case KEFIR_ASMCMP_AMD64_OPCODE(pop):
+            case KEFIR_ASMCMP_AMD64_OPCODE(pushfq):
+            case KEFIR_ASMCMP_AMD64_OPCODE(popfq):
+            case KEFIR_ASMCMP_AMD64_OPCODE(jmp):
+            case KEFIR_ASMCMP_AMD64_OPCODE(ret):
+            case KEFIR_ASMCMP_AMD64_OPCODE(ud2):
+            case KEFIR_ASMCMP_AMD64_OPCODE(function_prologue):
+            case KEFIR_ASMCMP_AMD64_OPCODE(inline_assembly):
+            case KEFIR_ASMCMP_AMD64_OPCODE(data_word):
+            case KEFIR_ASMCMP_AMD64_OPCODE(align):
+                return KEFIR_OK;
+
+            default:
+                REQUIRE(!is_conditional_jump(instr->opcode), KEFIR_OK);
+                break;
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t flags_dead_at(const struct shrink_wrap_state *state, kefir_asmcmp_instruction_index_t begin,
+                                    kefir_bool_t *dead) {
+    *dead = false;
+    for (kefir_asmcmp_instruction_index_t instr_index = begin; instr_index != KEFIR_ASMCMP_INDEX_NONE;
+         instr_index = kefir_asmcmp_context_instr_next(&state->target->context, instr_index)) {
+        struct kefir_asmcmp_instruction *instr;
+        REQUIRE_OK(kefir_asmcmp_context_instr_at(&state->target->context, instr_index, &instr));
+        if (reads_flags(instr->opcode) || instr->opcode == KEFIR_ASMCMP_AMD64_OPCODE(jmp) ||
+            instr->opcode == KEFIR_ASMCMP_AMD64_OPCODE(inline_assembly) ||
+            instr->opcode == KEFIR_ASMCMP_AMD64_OPCODE(data_word)) {
+            return KEFIR_OK;
+        }
+        if (overwrites_flags(instr->opcode)) {
+            break;
+        }
+    }
+    *dead = true;
+    return KEFIR_OK;
+}
+
+static kefir_result_t drop_instruction(struct kefir_mem *mem, struct kefir_asmcmp_context *context,
+                                       kefir_asmcmp_instruction_index_t instr_index) {
+    const kefir_asmcmp_instruction_index_t next_index = kefir_asmcmp_context_instr_next(context, instr_index);
+    REQUIRE(next_index != KEFIR_ASMCMP_INDEX_NONE,
+            KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected asmcmp instruction to have a successor"));
+    REQUIRE_OK(kefir_asmcmp_context_move_labels(mem, context, next_index, instr_index));
+    REQUIRE_OK(kefir_asmcmp_context_instr_drop(context, instr_index));
+    return KEFIR_OK;
+}
+
+static kefir_result_t shrink_wrap_impl(struct kefir_mem *mem, struct shrink_wrap_state *state) {
+    struct kefir_asmcmp_context *context = &state->target->context;
+    for (kefir_asmcmp_instruction_index_t instr_index = kefir_asmcmp_context_instr_head(context);
+         instr_index != KEFIR_ASMCMP_INDEX_NONE; instr_index = kefir_asmcmp_context_instr_next(context, instr_index)) {
+        struct kefir_asmcmp_instruction *instr;
+        REQUIRE_OK(kefir_asmcmp_context_instr_at(context, instr_index, &instr));
+        REQUIRE(instr->opcode != KEFIR_ASMCMP_AMD64_OPCODE(inline_assembly), KEFIR_OK);
+        REQUIRE_OK(count_value_label_references(mem, state, &instr->args[0]));
+        REQUIRE_OK(count_value_label_references(mem, state, &instr->args[1]));
+        REQUIRE_OK(count_value_label_references(mem, state, &instr->args[2]));
+    }
+
+    const kefir_asmcmp_instruction_index_t prologue_index = kefir_asmcmp_context_instr_head(context);
+    REQUIRE(prologue_index != KEFIR_ASMCMP_INDEX_NONE, KEFIR_OK);
+    struct kefir_asmcmp_instruction *instr;
+    REQUIRE_OK(kefir_asmcmp_context_instr_at(context, prologue_index, &instr));
+    REQUIRE(instr->opcode == KEFIR_ASMCMP_AMD64_OPCODE(function_prologue), KEFIR_OK);
+    const struct kefir_asmcmp_instruction prologue_instr = *instr;
+    kefir_size_t refs;
+    REQUIRE_OK(label_references(state, prologue_index, &refs));
+    REQUIRE(refs == 0, KEFIR_OK);
+
+    // Entry region consists of copies of arguments into callee-preserved registers, comparisons and a conditional
+    // branch. Copies are deferred to the slow path, comparisons are rewritten to use copy sources.
+    kefir_asmcmp_instruction_index_t branch_index = KEFIR_ASMCMP_INDEX_NONE;
+    for (kefir_asmcmp_instruction_index_t instr_index = kefir_asmcmp_context_instr_next(context, prologue_index);
+         instr_index != KEFIR_ASMCMP_INDEX_NONE && branch_index == KEFIR_ASMCMP_INDEX_NONE;
+         instr_index = kefir_asmcmp_context_instr_next(context, instr_index)) {
+        REQUIRE_OK(label_references(state, instr_index, &refs));
+        REQUIRE(refs == 0, KEFIR_OK);
+        REQUIRE_OK(kefir_asmcmp_context_instr_at(context, instr_index, &instr));
+
+        kefir_bool_t valid = true;
+        switch (instr->opcode) {
+            case KEFIR_ASMCMP_AMD64_OPCODE(mov):
+            case KEFIR_ASMCMP_AMD64_OPCODE(virtual_register_link): {
+                REQUIRE(instr->args[0].type == KEFIR_ASMCMP_VALUE_TYPE_PHYSICAL_REGISTER, KEFIR_OK);
+                const kefir_asm_amd64_xasmgen_register_t target = instr->args[0].phreg;
+                register_class_t target_class;
+                kefir_asm_amd64_xasmgen_register_t target64;
+                REQUIRE_OK(classify_register(state->target->abi_variant, target, &target_class, &target64));
+                for (kefir_size_t i = 0; i < state->num_of_copies; i++) {
+                    REQUIRE(state->copies[i].target != target64 && state->copies[i].source != target64, KEFIR_OK);
+                }
+
+                if (target_class == REGISTER_CLASS_SCRATCH) {
+                    // Scratch register moves are executed on both paths and stay in place
+                    if (instr->args[1].type == KEFIR_ASMCMP_VALUE_TYPE_PHYSICAL_REGISTER) {
+                        REQUIRE_OK(frame_free_register(state, instr->args[1].phreg, &valid));
+                    } else {
+                        valid = instr->args[1].type == KEFIR_ASMCMP_VALUE_TYPE_INTEGER;
+                    }
+                    REQUIRE(valid, KEFIR_OK);
+                    break;
+                }
+
+                REQUIRE(instr->args[1].type == KEFIR_ASMCMP_VALUE_TYPE_PHYSICAL_REGISTER &&
+                            state->num_of_copies < MAX_DEFERRED_COPIES,
+                        KEFIR_OK);
+                const kefir_asm_amd64_xasmgen_register_t source = instr->args[1].phreg;
+                register_class_t source_class;
+                kefir_asm_amd64_xasmgen_register_t source64;
+                REQUIRE_OK(classify_register(state->target->abi_variant, source, &source_class, &source64));
+                REQUIRE(target_class == REGISTER_CLASS_CALLEE_PRESERVED && target == target64 &&
+                            source_class == REGISTER_CLASS_SCRATCH && source == source64 &&
+                            !kefir_asm_amd64_xasmgen_register_is_floating_point(source),
+                        KEFIR_OK);
+                state->copies[state->num_of_copies++] = (struct deferred_copy) {
+                    .instr_index = instr_index, .instr = *instr, .target = target, .source = source};
+            } break;
+
+            case KEFIR_ASMCMP_AMD64_OPCODE(test):
+            case KEFIR_ASMCMP_AMD64_OPCODE(cmp):
+                REQUIRE_OK(entry_value(state, &instr->args[0], false, &valid));
+                REQUIRE_OK(entry_value(state, &instr->args[1], false, &valid));
+                REQUIRE_OK(entry_value(state, &instr->args[2], false, &valid));
+                REQUIRE(valid, KEFIR_OK);
+                break;
+
+            default:
+                REQUIRE(is_conditional_jump(instr->opcode) &&
+                            instr->args[0].type == KEFIR_ASMCMP_VALUE_TYPE_INTERNAL_LABEL,
+                        KEFIR_OK);
+                branch_index = instr_index;
+                break;
+        }
+    }
+    REQUIRE(branch_index != KEFIR_ASMCMP_INDEX_NONE, KEFIR_OK);
+
+    REQUIRE_OK(kefir_asmcmp_context_instr_at(context, branch_index, &instr));
+    kefir_asmcmp_instruction_index_t target_index;
+    REQUIRE_OK(kefir_asmcmp_context_label_at(context, instr->args[0].internal_label, &target_index));
+    const kefir_asmcmp_instruction_index_t fallthrough_index = kefir_asmcmp_context_instr_next(context, branch_index);
+    REQUIRE(target_index != KEFIR_ASMCMP_INDEX_NONE && fallthrough_index != KEFIR_ASMCMP_INDEX_NONE &&
+                target_index != fallthrough_index,
+            KEFIR_OK);
+
+    kefir_size_t target_refs, fallthrough_refs;
+    kefir_bool_t target_fallthrough, flags_dead;
+    REQUIRE_OK(label_references(state, target_index, &target_refs));
+    REQUIRE_OK(label_references(state, fallthrough_index, &fallthrough_refs));
+    REQUIRE_OK(falls_through(state, target_index, &target_fallthrough));
+    REQUIRE(target_refs == 1 && !target_fallthrough, KEFIR_OK);
+
+    // Either the branch target or the fallthrough must be a frame-free return path
+    kefir_asmcmp_instruction_index_t fast_path_terminator, slow_path_index = KEFIR_ASMCMP_INDEX_NONE;
+    REQUIRE_OK(match_fast_path(state, target_index, &fast_path_terminator));
+    if (fast_path_terminator != KEFIR_ASMCMP_INDEX_NONE) {
+        REQUIRE_OK(flags_dead_at(state, fallthrough_index, &flags_dead));
+        if (flags_dead) {
+            slow_path_index = fallthrough_index;
+        }
+    }
+    if (slow_path_index == KEFIR_ASMCMP_INDEX_NONE && fallthrough_refs == 0) {
+        REQUIRE_OK(match_fast_path(state, fallthrough_index, &fast_path_terminator));
+        if (fast_path_terminator != KEFIR_ASMCMP_INDEX_NONE) {
+            REQUIRE_OK(flags_dead_at(state, target_index, &flags_dead));
+            if (flags_dead) {
+                slow_path_index = target_index;
+            }
+        }
+    }
+    REQUIRE(slow_path_index != KEFIR_ASMCMP_INDEX_NONE, KEFIR_OK);
+
+    for (kefir_asmcmp_instruction_index_t instr_index = kefir_asmcmp_context_instr_next(context, prologue_index);
+         instr_index != branch_index; instr_index = kefir_asmcmp_context_instr_next(context, instr_index)) {
+        REQUIRE_OK(kefir_asmcmp_context_instr_at(context, instr_index, &instr));
+        if (instr->opcode == KEFIR_ASMCMP_AMD64_OPCODE(test) || instr->opcode == KEFIR_ASMCMP_AMD64_OPCODE(cmp)) {
+            kefir_bool_t valid = true;
+            REQUIRE_OK(entry_value(state, &instr->args[0], true, &valid));
+            REQUIRE_OK(entry_value(state, &instr->args[1], true, &valid));
+            REQUIRE_OK(entry_value(state, &instr->args[2], true, &valid));
+        }
+    }
+
+    kefir_asmcmp_instruction_index_t anchor_index =
+        slow_path_index == fallthrough_index ? branch_index : kefir_asmcmp_context_instr_prev(context, target_index);
+    REQUIRE(anchor_index != KEFIR_ASMCMP_INDEX_NONE,
+            KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected slow path to be preceded by an instruction"));
+    REQUIRE_OK(kefir_asmcmp_context_instr_insert_after(mem, context, anchor_index, &prologue_instr, &anchor_index));
+    if (slow_path_index == target_index) {
+        REQUIRE_OK(kefir_asmcmp_context_move_labels(mem, context, anchor_index, target_index));
+    }
+    for (kefir_size_t i = 0; i < state->num_of_copies; i++) {
+        REQUIRE_OK(kefir_asmcmp_context_instr_insert_after(mem, context, anchor_index, &state->copies[i].instr,
+                                                           &anchor_index));
+        REQUIRE_OK(drop_instruction(mem, context, state->copies[i].instr_index));
+    }
+    REQUIRE_OK(drop_instruction(mem, context, prologue_index));
+
+    REQUIRE_OK(kefir_asmcmp_context_instr_at(context, fast_path_terminator, &instr));
+    if (instr->opcode == KEFIR_ASMCMP_AMD64_OPCODE(tail_call)) {
+        instr->opcode = KEFIR_ASMCMP_AMD64_OPCODE(jmp);
+    } else {
+        REQUIRE_OK(drop_instruction(mem, context, fast_path_terminator));
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_codegen_amd64_frame_shrink_wrap(struct kefir_mem *mem, struct kefir_asmcmp_amd64 *target,
+                                                     const struct kefir_codegen_amd64_stack_frame *frame) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(target != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid asmcmp amd64 target"));
+    REQUIRE(frame != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid amd64 stack frame"));
+
+    // Prologue parts that are not plain register saves and stack allocation are kept in the entry block
+    REQUIRE(!frame->requirements.x87_control_word_save &&
+                !frame->requirements.mxcsr_save && frame->requirements.extra_alignment == 0 &&
+                frame->local_variables->total_alignment <= 2 * KEFIR_AMD64_ABI_QWORD,
+            KEFIR_OK);
+
+    struct shrink_wrap_state state = {.target = target, .num_of_copies = 0};
+    REQUIRE_OK(kefir_hashtable_init(&state.label_refs, &kefir_hashtable_uint_ops));
+    kefir_result_t res = shrink_wrap_impl(mem, &state);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_hashtable_free(mem, &state.label_refs);
+        return res;
+    });
+    REQUIRE_OK(kefir_hashtable_free(mem, &state.label_refs));
+    return KEFIR_OK;
+}
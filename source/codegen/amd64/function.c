@@ -22,6 +22,7 @@
 #include "kefir/codegen/asmcmp/context.h"
 #define KEFIR_CODEGEN_AMD64_FUNCTION_INTERNAL
 #include "kefir/codegen/amd64/function.h"
+#include "kefir/codegen/amd64/frame_placement.h"
 #include "kefir/codegen/amd64/module.h"
 #include "kefir/codegen/amd64/symbolic_labels.h"
 #include "kefir/codegen/asmcmp/transform.h"
@@ -995,6 +996,36 @@ static kefir_result_t generate_constants(struct kefir_mem *mem, struct kefir_cod
                                                          instr->operation.parameters.imm.decimal128.uvalue[1])));
             } break;
 
+            case KEFIR_OPT_OPCODE_SWITCH: {
+                const struct kefir_opt_switch_table *switch_table;
+                REQUIRE_OK(kefir_opt_code_container_switch_table(
+                    &func->function->code, instr->operation.parameters.branch.switch_table_ref, &switch_table));
+
+                REQUIRE_OK(KEFIR_AMD64_XASMGEN_ALIGN(&func->codegen->xasmgen, 4));
+                REQUIRE_OK(KEFIR_AMD64_XASMGEN_LABEL(&func->codegen->xasmgen, KEFIR_AMD64_LABEL,
+                                                     func->codegen->symbol_prefix, ir_identifier->symbol,
+                                                     constant_label));
+
+                struct kefir_asm_amd64_xasmgen_helpers table_label_helpers;
+                const char *table_label = kefir_asm_amd64_xasmgen_helpers_format(
+                    &table_label_helpers, KEFIR_AMD64_LABEL, func->codegen->symbol_prefix, ir_identifier->symbol,
+                    constant_label);
+                for (kefir_size_t i = 0; i < switch_table->length; i++) {
+                    REQUIRE_OK(KEFIR_AMD64_XASMGEN_DATA(
+                        &func->codegen->xasmgen, KEFIR_AMD64_XASMGEN_DATA_DOUBLE, 1,
+                        kefir_asm_amd64_xasmgen_operand_subtract(
+                            &func->codegen->xasmgen_helpers.operands[0],
+                            kefir_asm_amd64_xasmgen_operand_label(
+                                &func->codegen->xasmgen_helpers.operands[1], KEFIR_AMD64_XASMGEN_SYMBOL_ABSOLUTE,
+                                kefir_asm_amd64_xasmgen_helpers_format(
+                                    &func->codegen->xasmgen_helpers, KEFIR_AMD64_SWITCH_TARGET,
+                                    func->codegen->symbol_prefix, ir_identifier->symbol, instr->id,
+                                    switch_table->targets[i])),
+                            kefir_asm_amd64_xasmgen_operand_label(&func->codegen->xasmgen_helpers.operands[2],
+                                                                  KEFIR_AMD64_XASMGEN_SYMBOL_ABSOLUTE, table_label))));
+                }
+            } break;
+
             default:
                 return KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unexpected optimizer instruction opcode");
         }
@@ -1185,6 +1216,10 @@ static kefir_result_t construct_target_ir(struct kefir_mem *mem, struct kefir_co
         .preallocation_match = construct_target_ir_preallocation_match,
         .get_native_id_by_label = construct_target_ir_get_native_id_by_label,
         .payload = func};
+    struct kefir_time_report *time_report = codegen->config->time_report;
+    const char *function_name = func->function->ir_func->name;
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(time_report, &time_report_span));
     REQUIRE_OK(
         kefir_codegen_target_ir_code_construct(mem, code, &func->code.context, &func->debug.target_ir_metadata, &ops));
     REQUIRE_OK(kefir_codegen_target_ir_transform_copy_elision(mem, code));
@@ -1203,7 +1238,10 @@ static kefir_result_t construct_target_ir(struct kefir_mem *mem, struct kefir_co
     REQUIRE_OK(kefir_codegen_target_ir_transform_preserve_virtual_regs(
         mem, code, KEFIR_TARGET_IR_AMD64_OPCODE(preserve_active_virtual_registers)));
     REQUIRE_OK(kefir_codegen_target_ir_transform_insert_upsilons(mem, code));
+    REQUIRE_OK(kefir_time_report_end(time_report, &time_report_span, KEFIR_TIME_REPORT_CODEGEN_STAGE, function_name,
+                                     "target-ir"));
 
+    REQUIRE_OK(kefir_time_report_begin(time_report, &time_report_span));
     REQUIRE_OK(kefir_codegen_target_ir_control_flow_build(mem, &func->target_ir.control_flow));
     REQUIRE_OK(kefir_codegen_target_ir_liveness_build(mem, &func->target_ir.control_flow, &func->target_ir.liveness));
     REQUIRE_OK(kefir_codegen_target_ir_interference_build(mem, &func->target_ir.interference,
@@ -1227,6 +1265,11 @@ static kefir_result_t construct_target_ir(struct kefir_mem *mem, struct kefir_co
                             &func->target_ir.interference, &func->target_ir.coalesce, &stack_frame));
 
     if (codegen->config->optimization == KEFIR_CODEGEN_OPTIMIZATION_FULL) {
+        if (codegen->config->live_range_split) {
+            REQUIRE_CHAIN(&res, kefir_codegen_target_ir_transform_split_loop_live_ranges(
+                                    mem, code, &func->target_ir.control_flow, &func->target_ir.liveness,
+                                    &func->target_ir.regalloc));
+        }
         REQUIRE_CHAIN(&res, kefir_codegen_target_ir_transform_remove_upsilons(mem, code));
         REQUIRE_CHAIN(&res, kefir_codegen_target_ir_transform_insert_local_hot_copy(
                                 mem, &func->target_ir.code, &func->target_ir.liveness, &func->target_ir.interference,
@@ -1260,7 +1303,10 @@ static kefir_result_t construct_target_ir(struct kefir_mem *mem, struct kefir_co
         REQUIRE_CHAIN(&res, kefir_codegen_target_ir_numbering_reset(mem, &func->target_ir.liveness.numbering));
         REQUIRE_CHAIN(&res, kefir_codegen_target_ir_numbering_build(mem, &func->target_ir.liveness.numbering, code));
     }
+    REQUIRE_CHAIN(&res, kefir_time_report_end(time_report, &time_report_span, KEFIR_TIME_REPORT_CODEGEN_STAGE,
+                                              function_name, "regalloc"));
 
+    REQUIRE_CHAIN(&res, kefir_time_report_begin(time_report, &time_report_span));
     REQUIRE_CHAIN(&res,
                   kefir_codegen_target_ir_amd64_destruct(
                       mem, code, asmcmp_code, &stack_frame, &func->target_ir.control_flow, &func->target_ir.liveness,
@@ -1302,6 +1348,8 @@ static kefir_result_t construct_target_ir(struct kefir_mem *mem, struct kefir_co
         return res;
     });
     REQUIRE_OK(kefir_codegen_target_ir_destructor_amd64_ops_free(mem, &destructor_ops));
+    REQUIRE_OK(kefir_time_report_end(time_report, &time_report_span, KEFIR_TIME_REPORT_CODEGEN_STAGE, function_name,
+                                     "target-ir"));
 
     if (codegen->config->print_details != NULL && strcmp(codegen->config->print_details, "target_ir") == 0) {
         const char *comment_prefix;
@@ -1370,6 +1418,11 @@ static kefir_result_t kefir_codegen_amd64_function_translate_impl(struct kefir_m
     if (!codegen->config->omit_frame_pointer) {
         REQUIRE_OK(kefir_codegen_amd64_stack_frame_require_frame_pointer(&func->stack_frame));
     }
+
+    struct kefir_time_report *time_report = codegen->config->time_report;
+    const char *function_name = func->function->ir_func->name;
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(time_report, &time_report_span));
     REQUIRE_OK(kefir_opt_code_control_flow_build(mem, &func->control_flow, &func->function->code));
     REQUIRE_OK(kefir_opt_code_liveness_build(mem, &func->liveness, &func->control_flow));
     REQUIRE_OK(kefir_opt_code_variable_scopes_build(mem, &func->variable_scopes, &func->liveness));
@@ -1386,6 +1439,8 @@ static kefir_result_t kefir_codegen_amd64_function_translate_impl(struct kefir_m
     REQUIRE_OK(kefir_opt_code_control_flow_init(&func->control_flow));
     REQUIRE_OK(kefir_opt_code_liveness_init(&func->liveness));
     REQUIRE_OK(propagate_virtual_register_hints(mem, func));
+    REQUIRE_OK(kefir_time_report_end(time_report, &time_report_span, KEFIR_TIME_REPORT_CODEGEN_STAGE, function_name,
+                                     "instruction-selection"));
 
     if (codegen->config->print_details != NULL && strcmp(codegen->config->print_details, "vasm") == 0) {
         REQUIRE_OK(output_asm(codegen, &func->code.context, codegen->config->debug_info));
@@ -1401,10 +1456,22 @@ static kefir_result_t kefir_codegen_amd64_function_translate_impl(struct kefir_m
     });
     REQUIRE_OK(kefir_asmcmp_amd64_free(mem, &asmcmp_code));
 
+    REQUIRE_OK(kefir_time_report_begin(time_report, &time_report_span));
     REQUIRE_OK(kefir_asmcmp_drop_virtual_instructions(mem, &func->code.context));
     REQUIRE_OK(kefir_asmcmp_compact_labels(mem, &func->code.context));
     REQUIRE_OK(kefir_asmcmp_code_map_coalesce(mem, &func->code.context.debug_info.code_map));
 
+    if (codegen->config->shrink_wrap && codegen->config->omit_frame_pointer && !codegen->config->debug_info) {
+        REQUIRE_OK(kefir_codegen_amd64_frame_shrink_wrap(mem, &func->code, &func->stack_frame));
+    }
+    if (codegen->config->red_zone) {
+        kefir_bool_t red_zone_eligible;
+        REQUIRE_OK(kefir_codegen_amd64_frame_red_zone_eligible(&func->code, &red_zone_eligible));
+        if (red_zone_eligible) {
+            REQUIRE_OK(kefir_codegen_amd64_stack_frame_allow_red_zone(&func->stack_frame));
+        }
+    }
+
     if (codegen->config->print_details != NULL && strcmp(codegen->config->print_details, "devasm") == 0) {
         REQUIRE_OK(output_asm(codegen, &func->code.context, codegen->config->debug_info));
     }
@@ -1417,6 +1484,8 @@ static kefir_result_t kefir_codegen_amd64_function_translate_impl(struct kefir_m
     REQUIRE_OK(KEFIR_AMD64_XASMGEN_LABEL(&func->codegen->xasmgen, KEFIR_AMD64_FUNCTION_END, codegen->symbol_prefix,
                                          ir_identifier->symbol));
     REQUIRE_OK(generate_constants(mem, func));
+    REQUIRE_OK(kefir_time_report_end(time_report, &time_report_span, KEFIR_TIME_REPORT_CODEGEN_STAGE, function_name,
+                                     "emission"));
 
     REQUIRE_OK(kefir_asmcmp_context_instr_drop_code(mem, &func->code.context));
     REQUIRE_OK(kefir_opt_code_schedule_clear(mem, &func->schedule));
@@ -579,6 +579,10 @@ static kefir_result_t generate_instr(struct kefir_mem *mem, struct kefir_amd64_x
                 kefir_asm_amd64_xasmgen_operand_immu(&arg_state[0].base_operands[0], instr->args[0].uint_immediate)));
             break;
 
+        case KEFIR_ASMCMP_AMD64_OPCODE(align):
+            REQUIRE_OK(KEFIR_AMD64_XASMGEN_ALIGN(xasmgen, instr->args[0].uint_immediate));
+            break;
+
         case KEFIR_ASMCMP_AMD64_OPCODE(inline_assembly):
             REQUIRE_OK(format_inline_assembly(mem, xasmgen, target, stack_frame, symbol_prefix,
                                               instr->args[0].inline_asm_idx));
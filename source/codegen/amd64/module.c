@@ -100,6 +100,20 @@ kefir_result_t kefir_codegen_amd64_module_insert_function(struct kefir_mem *mem,
     return KEFIR_OK;
 }
 
+kefir_result_t kefir_codegen_amd64_module_drop_function(struct kefir_mem *mem, struct kefir_codegen_amd64_module *module,
+                                                        const char *function_name) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 codegen module"));
+    REQUIRE(function_name != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid function name"));
+
+    kefir_result_t res = kefir_hashtree_delete(mem, &module->functions, (kefir_hashtree_key_t) function_name);
+    if (res == KEFIR_NOT_FOUND) {
+        res = KEFIR_SET_ERROR(KEFIR_NOT_FOUND, "Unable to find requested AMD64 codegen function");
+    }
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_codegen_amd64_module_function(const struct kefir_codegen_amd64_module *module,
                                                    const char *function_name,
                                                    struct kefir_codegen_amd64_function **function_ptr) {
@@ -110,6 +110,13 @@ kefir_result_t kefir_codegen_amd64_stack_frame_require_alignment(struct kefir_co
     return KEFIR_OK;
 }
 
+kefir_result_t kefir_codegen_amd64_stack_frame_allow_red_zone(struct kefir_codegen_amd64_stack_frame *frame) {
+    REQUIRE(frame != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid amd64 stack frame"));
+
+    frame->requirements.red_zone = true;
+    return KEFIR_OK;
+}
+
 kefir_bool_t kefir_codegen_amd64_stack_frame_has_extra_alignment(const struct kefir_codegen_amd64_stack_frame *frame) {
     return frame->requirements.extra_alignment > 0;
 }
@@ -164,6 +171,10 @@ static kefir_result_t calculate_offsets(struct kefir_codegen_amd64_stack_frame *
     frame->sizes.total_size = -frame->offsets.top_of_frame;
     frame->sizes.total_alignment = kefir_target_abi_pad_aligned(
         MAX(frame->sizes.local_area_alignment, frame->requirements.extra_alignment), 2 * KEFIR_AMD64_ABI_QWORD);
+    // Leaf functions keep small frames below the stack pointer without adjusting it
+    frame->use_red_zone = frame->requirements.red_zone && !frame->requirements.reset_stack_pointer &&
+                          frame->sizes.total_alignment <= 2 * KEFIR_AMD64_ABI_QWORD &&
+                          frame->sizes.allocated_size <= KEFIR_AMD64_ABI_RED_ZONE_SIZE;
     return KEFIR_OK;
 }
 
@@ -227,7 +238,7 @@ kefir_result_t kefir_codegen_amd64_stack_frame_prologue(struct kefir_amd64_xasmg
         }
     }
 
-    if (frame->sizes.allocated_size > 0) {
+    if (frame->sizes.allocated_size > 0 && !frame->use_red_zone) {
         REQUIRE_OK(KEFIR_AMD64_XASMGEN_INSTR_SUB(
             xasmgen, kefir_asm_amd64_xasmgen_operand_reg(KEFIR_AMD64_XASMGEN_REGISTER_RSP),
             kefir_asm_amd64_xasmgen_operand_immu(&operands[0], frame->sizes.allocated_size)));
@@ -271,7 +282,7 @@ kefir_result_t kefir_codegen_amd64_stack_frame_epilogue(struct kefir_amd64_xasmg
                          (struct kefir_asm_amd64_xasmgen_indirection_index) {0}, frame->offsets.x87_control_word)));
     }
 
-    if (frame->sizes.allocated_size > 0 || frame->requirements.reset_stack_pointer) {
+    if ((frame->sizes.allocated_size > 0 && !frame->use_red_zone) || frame->requirements.reset_stack_pointer) {
         REQUIRE_OK(KEFIR_AMD64_XASMGEN_INSTR_LEA(
             xasmgen, kefir_asm_amd64_xasmgen_operand_reg(KEFIR_AMD64_XASMGEN_REGISTER_RSP),
             kefir_asm_amd64_xasmgen_operand_indirect(
@@ -648,6 +648,45 @@ static kefir_result_t dump_binary(struct static_data_param *param, const char *r
     return KEFIR_OK;
 }
 
+#define PACKED_ELEMENTS_PER_LINE 16
+
+static kefir_result_t dump_packed(struct static_data_param *param, kefir_size_t element_index, const void *raw,
+                                  kefir_size_t length) {
+    const struct kefir_abi_amd64_typeentry_layout *element_layout = NULL;
+    REQUIRE_OK(kefir_abi_amd64_type_layout_at(&param->layout, element_index, &element_layout));
+
+    kefir_asm_amd64_xasmgen_data_type_t data_type;
+    switch (element_layout->size) {
+        case 1:
+            data_type = KEFIR_AMD64_XASMGEN_DATA_BYTE;
+            break;
+
+        case 2:
+            data_type = KEFIR_AMD64_XASMGEN_DATA_WORD;
+            break;
+
+        case 4:
+            data_type = KEFIR_AMD64_XASMGEN_DATA_DOUBLE;
+            break;
+
+        case 8:
+            data_type = KEFIR_AMD64_XASMGEN_DATA_QUAD;
+            break;
+
+        default:
+            return KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unexpected packed IR data element size");
+    }
+
+    const kefir_size_t num_of_elements = length / element_layout->size;
+    for (kefir_size_t i = 0; i < num_of_elements; i += PACKED_ELEMENTS_PER_LINE) {
+        REQUIRE_OK(KEFIR_AMD64_XASMGEN_BINDATA(&param->codegen->xasmgen, data_type,
+                                               (const kefir_uint8_t *) raw + i * element_layout->size,
+                                               MIN(num_of_elements - i, PACKED_ELEMENTS_PER_LINE)));
+    }
+    param->offset += length;
+    return KEFIR_OK;
+}
+
 static kefir_result_t array_static_data(const struct kefir_ir_type *type, kefir_size_t index,
                                         const struct kefir_ir_typeentry *typeentry, void *payload) {
     REQUIRE(type != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid IR type"));
@@ -709,6 +748,11 @@ static kefir_result_t array_static_data(const struct kefir_ir_type *type, kefir_
             param->slot += array_content_slots;
         } break;
 
+        case KEFIR_IR_DATA_VALUE_PACKED:
+            REQUIRE_OK(dump_packed(param, index + 1, entry->value.raw.data, entry->value.raw.length));
+            param->slot += array_content_slots;
+            break;
+
         default:
             return KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Unexpected array data type");
     }
@@ -33,7 +33,15 @@ const struct kefir_codegen_configuration KefirCodegenDefaultConfiguration = {
     .debug_info = false,
     .valgrind_compatible_x87 = true,
     .runtime_function_generator_mode = false,
-    .optimization = KEFIR_CODEGEN_OPTIMIZATION_FULL};
+    .integrated_assembler = false,
+    .code_layout = false,
+    .red_zone = false,
+    .shrink_wrap = false,
+    .live_range_split = false,
+    .inline_memory_builtins = false,
+    .streaming = false,
+    .optimization = KEFIR_CODEGEN_OPTIMIZATION_FULL,
+    .time_report = NULL};
 
 kefir_result_t kefir_codegen_translate_ir(struct kefir_mem *mem, struct kefir_codegen *codegen,
                                           struct kefir_ir_module *ir_module) {
@@ -2800,6 +2800,7 @@ devirtualize_label:
         case KEFIR_ASMCMP_AMD64_OPCODE(function_epilogue):
         case KEFIR_ASMCMP_AMD64_OPCODE(noop):
         case KEFIR_ASMCMP_AMD64_OPCODE(data_word):
+        case KEFIR_ASMCMP_AMD64_OPCODE(align):
             // Intentionally left blank
             break;
     }
@@ -2996,9 +2997,49 @@ static kefir_result_t translate_block(struct destructor_state *state, kefir_code
     return KEFIR_OK;
 }
 
+static kefir_result_t is_loop_header(struct destructor_state *state, kefir_codegen_target_ir_block_ref_t block_ref,
+                                     kefir_bool_t *loop_header) {
+    *loop_header = false;
+    kefir_result_t res;
+    struct kefir_hashset_iterator iter;
+    kefir_hashset_key_t key;
+    for (res = kefir_hashset_iter(&state->control_flow->blocks[block_ref].predecessors, &iter, &key);
+         res == KEFIR_OK && !*loop_header; res = kefir_hashset_next(&iter, &key)) {
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, pred_block_ref, key);
+        REQUIRE_OK(kefir_codegen_target_ir_control_flow_is_dominator(state->control_flow, pred_block_ref, block_ref,
+                                                                     loop_header));
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t align_loop_header(struct destructor_state *state) {
+    struct kefir_asmcmp_instruction *instr;
+    REQUIRE_OK(kefir_asmcmp_context_instr_alloc_inplace(state->mem, &state->asmcmp_ctx->context, &instr));
+    instr->opcode = state->destructor_ops->align_opcode;
+    instr->args[0].type = KEFIR_ASMCMP_VALUE_TYPE_INTEGER;
+    instr->args[0].uint_immediate = state->destructor_ops->loop_alignment;
+    instr->args[1].type = KEFIR_ASMCMP_VALUE_TYPE_NONE;
+    instr->args[2].type = KEFIR_ASMCMP_VALUE_TYPE_NONE;
+    REQUIRE_OK(kefir_asmcmp_context_instr_inplace_insert_after(
+        state->mem, &state->asmcmp_ctx->context, kefir_asmcmp_context_instr_tail(&state->asmcmp_ctx->context), instr,
+        NULL));
+    return KEFIR_OK;
+}
+
 static kefir_result_t translate_blocks(struct destructor_state *state) {
     for (kefir_size_t i = 0; i < state->schedule.schedule_length; i++) {
-        REQUIRE_OK(translate_block(state, state->schedule.block_schedule[i].block_ref));
+        const kefir_codegen_target_ir_block_ref_t block_ref = state->schedule.block_schedule[i].block_ref;
+        if (i > 0 && state->destructor_ops->loop_alignment > 1) {
+            kefir_bool_t loop_header;
+            REQUIRE_OK(is_loop_header(state, block_ref, &loop_header));
+            if (loop_header) {
+                REQUIRE_OK(align_loop_header(state));
+            }
+        }
+        REQUIRE_OK(translate_block(state, block_ref));
     }
 
     kefir_result_t res;
@@ -112,10 +112,13 @@ static kefir_result_t schedule_code(struct kefir_mem *mem,
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(control_flow != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR control flow"));
     REQUIRE(schedule != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR schedule"));
-    UNUSED(payload);
+    ASSIGN_DECL_CAST(struct kefir_codegen_target_ir_destructor_amd64_ops *, ops, payload);
+    REQUIRE(ops != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected vaid target IR destructor amd64 ops"));
 
+    const struct kefir_codegen_target_ir_amd64_topological_scheduler topological_scheduler = {
+        .control_flow = control_flow, .sink_cold_blocks = ops->function->codegen->config->code_layout};
     struct kefir_codegen_target_ir_code_scheduler scheduler;
-    REQUIRE_OK(kefir_codegen_target_ir_amd64_topological_scheduler_init(control_flow, &scheduler));
+    REQUIRE_OK(kefir_codegen_target_ir_amd64_topological_scheduler_init(&topological_scheduler, &scheduler));
     REQUIRE_OK(kefir_codegen_target_ir_code_schedule_build(mem, schedule, &scheduler));
     return KEFIR_OK;
 }
@@ -132,6 +135,8 @@ kefir_result_t kefir_codegen_target_ir_destructor_amd64_ops_init(
     ops->code = code;
     ops->ops.unreachable_opcode = KEFIR_ASMCMP_AMD64_OPCODE(ud2);
     ops->ops.noop_opcode = KEFIR_ASMCMP_AMD64_OPCODE(noop);
+    ops->ops.align_opcode = KEFIR_ASMCMP_AMD64_OPCODE(align);
+    ops->ops.loop_alignment = function->codegen->config->code_layout ? KEFIR_CODEGEN_TARGET_IR_AMD64_LOOP_ALIGNMENT : 0;
     ops->ops.bind_native_id = bind_native_id;
     ops->ops.new_inline_asm = new_inline_asm;
     ops->ops.materialize_attribute = materialize_attribute;
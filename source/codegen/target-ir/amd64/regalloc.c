@@ -669,8 +669,8 @@ kefir_result_t kefir_codegen_target_ir_amd64_regalloc_class_init(
     REQUIRE_OK(kefir_mergesort(mem, klass->sse_registers, sizeof(kefir_asm_amd64_xasmgen_register_t),
                                klass->num_of_sse_registers, abi_register_comparator, klass));
 
-    static const struct kefir_codegen_target_ir_regalloc_transforms TRANSFORMS = {.hot_copy_locality = 4,
-                                                                                  .rematerialization_locality = 32};
+    static const struct kefir_codegen_target_ir_regalloc_transforms TRANSFORMS = {
+        .hot_copy_locality = 4, .rematerialization_locality = 32, .loop_split_use_weight = 8};
     klass->klass.transforms = &TRANSFORMS;
 
     klass->klass.do_allocate = do_allocate;
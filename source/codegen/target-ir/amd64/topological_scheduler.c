@@ -19,14 +19,98 @@
 */
 
 #include "kefir/codegen/target-ir/amd64/topological_scheduler.h"
+#include "kefir/codegen/target-ir/amd64/code.h"
 #include "kefir/core/error.h"
 #include "kefir/core/util.h"
+#include <string.h>
+
+static kefir_result_t is_unreachable_block(const struct kefir_codegen_target_ir_control_flow *control_flow,
+                                           kefir_codegen_target_ir_block_ref_t block_ref, kefir_bool_t *result) {
+    *result = false;
+    kefir_codegen_target_ir_instruction_ref_t block_tail_ref =
+        kefir_codegen_target_ir_code_block_control_tail(control_flow->code, block_ref);
+    if (block_tail_ref != KEFIR_ID_NONE) {
+        const struct kefir_codegen_target_ir_instruction *block_tail;
+        REQUIRE_OK(kefir_codegen_target_ir_code_instruction(control_flow->code, block_tail_ref, &block_tail));
+        *result = block_tail->operation.opcode == KEFIR_TARGET_IR_AMD64_OPCODE(ud2);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t mark_cold_blocks_impl(struct kefir_mem *mem,
+                                            const struct kefir_codegen_target_ir_control_flow *control_flow,
+                                            kefir_bool_t *cold_blocks, struct kefir_list *queue) {
+    // Blocks that end with unreachable code (failed assertions, traps, calls to noreturn functions) are cold. A block
+    // all of whose successors are cold is cold as well, thus cold region extends backwards up to the nearest branch
+    // that still has a hot alternative.
+    for (kefir_size_t i = 0; i < control_flow->blocks_length; i++) {
+        if (i != control_flow->code->entry_block &&
+            kefir_codegen_target_ir_control_flow_is_reachable(control_flow, (kefir_codegen_target_ir_block_ref_t) i)) {
+            REQUIRE_OK(is_unreachable_block(control_flow, (kefir_codegen_target_ir_block_ref_t) i, &cold_blocks[i]));
+            if (cold_blocks[i]) {
+                REQUIRE_OK(kefir_list_insert_after(mem, queue, kefir_list_tail(queue), (void *) (kefir_uptr_t) i));
+            }
+        }
+    }
+
+    for (struct kefir_list_entry *iter = kefir_list_head(queue); iter != NULL; iter = kefir_list_head(queue)) {
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, block_ref, (kefir_uptr_t) iter->value);
+        REQUIRE_OK(kefir_list_pop(mem, queue, iter));
+
+        kefir_result_t res;
+        struct kefir_hashset_iterator pred_iter;
+        kefir_hashset_key_t pred_key;
+        for (res = kefir_hashset_iter(&control_flow->blocks[block_ref].predecessors, &pred_iter, &pred_key);
+             res == KEFIR_OK; res = kefir_hashset_next(&pred_iter, &pred_key)) {
+            ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, pred_block_ref, pred_key);
+            if (cold_blocks[pred_block_ref] || pred_block_ref == control_flow->code->entry_block) {
+                continue;
+            }
+
+            kefir_bool_t all_successors_cold = true;
+            struct kefir_hashset_iterator succ_iter;
+            kefir_hashset_key_t succ_key;
+            for (res = kefir_hashset_iter(&control_flow->blocks[pred_block_ref].successors, &succ_iter, &succ_key);
+                 res == KEFIR_OK && all_successors_cold; res = kefir_hashset_next(&succ_iter, &succ_key)) {
+                all_successors_cold = cold_blocks[(kefir_codegen_target_ir_block_ref_t) succ_key];
+            }
+            if (res != KEFIR_ITERATOR_END) {
+                REQUIRE_OK(res);
+            }
+
+            if (all_successors_cold) {
+                cold_blocks[pred_block_ref] = true;
+                REQUIRE_OK(kefir_list_insert_after(mem, queue, kefir_list_tail(queue),
+                                                   (void *) (kefir_uptr_t) pred_block_ref));
+            }
+        }
+        if (res != KEFIR_ITERATOR_END) {
+            REQUIRE_OK(res);
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t mark_cold_blocks(struct kefir_mem *mem,
+                                       const struct kefir_codegen_target_ir_control_flow *control_flow,
+                                       kefir_bool_t *cold_blocks) {
+    struct kefir_list queue;
+    REQUIRE_OK(kefir_list_init(&queue));
+    kefir_result_t res = mark_cold_blocks_impl(mem, control_flow, cold_blocks, &queue);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_list_free(mem, &queue);
+        return res;
+    });
+    REQUIRE_OK(kefir_list_free(mem, &queue));
+    return KEFIR_OK;
+}
 
 static kefir_result_t do_schedule_impl(struct kefir_mem *mem,
                                        const struct kefir_codegen_target_ir_code_schedule *schedule,
                                        struct kefir_codegen_target_ir_code_schedule_builder *schedule_builder,
                                        const struct kefir_codegen_target_ir_control_flow *control_flow,
-                                       struct kefir_list *queue) {
+                                       const kefir_bool_t *cold_blocks, struct kefir_list *queue,
+                                       struct kefir_list *cold_queue) {
 
     for (struct kefir_list_entry *iter = kefir_list_head(queue); iter != NULL; iter = kefir_list_head(queue)) {
         ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, block_ref, (kefir_uptr_t) iter->value);
@@ -34,6 +118,11 @@ static kefir_result_t do_schedule_impl(struct kefir_mem *mem,
         if (kefir_codegen_target_ir_code_schedule_has_block(schedule, block_ref)) {
             continue;
         }
+        if (cold_queue != NULL && cold_blocks != NULL && cold_blocks[block_ref]) {
+            REQUIRE_OK(kefir_list_insert_after(mem, cold_queue, kefir_list_tail(cold_queue),
+                                               (void *) (kefir_uptr_t) block_ref));
+            continue;
+        }
         if (!kefir_codegen_target_ir_code_is_gate_block(schedule->code, block_ref)) {
             REQUIRE_OK(schedule_builder->schedule_block(mem, block_ref, schedule_builder->payload));
         }
@@ -85,13 +174,46 @@ static kefir_result_t do_schedule(struct kefir_mem *mem, const struct kefir_code
     REQUIRE(
         entry_point_ref != KEFIR_ID_NONE && entry_point_ref < kefir_codegen_target_ir_code_block_count(schedule->code),
         KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR schedule entry point"));
-    ASSIGN_DECL_CAST(const struct kefir_codegen_target_ir_control_flow *, control_flow, payload);
+    ASSIGN_DECL_CAST(const struct kefir_codegen_target_ir_amd64_topological_scheduler *, topological_scheduler,
+                     payload);
+    const struct kefir_codegen_target_ir_control_flow *control_flow = topological_scheduler->control_flow;
+
+    kefir_bool_t *cold_blocks = NULL;
+    if (topological_scheduler->sink_cold_blocks && control_flow->blocks_length > 0) {
+        cold_blocks = KEFIR_MALLOC(mem, sizeof(kefir_bool_t) * control_flow->blocks_length);
+        REQUIRE(cold_blocks != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate cold block flags"));
+        memset(cold_blocks, 0, sizeof(kefir_bool_t) * control_flow->blocks_length);
+    }
 
-    struct kefir_list queue;
+    struct kefir_list queue, cold_queue;
     REQUIRE_OK(kefir_list_init(&queue));
-    kefir_result_t res =
-        kefir_list_insert_after(mem, &queue, kefir_list_tail(&queue), (void *) (kefir_uptr_t) entry_point_ref);
-    REQUIRE_CHAIN(&res, do_schedule_impl(mem, schedule, schedule_builder, control_flow, &queue));
+    REQUIRE_OK(kefir_list_init(&cold_queue));
+    kefir_result_t res = KEFIR_OK;
+    if (cold_blocks != NULL) {
+        REQUIRE_CHAIN(&res, mark_cold_blocks(mem, control_flow, cold_blocks));
+    }
+    REQUIRE_CHAIN(&res, kefir_list_insert_after(mem, &queue, kefir_list_tail(&queue),
+                                                (void *) (kefir_uptr_t) entry_point_ref));
+    REQUIRE_CHAIN(&res, do_schedule_impl(mem, schedule, schedule_builder, control_flow, cold_blocks, &queue,
+                                         cold_blocks != NULL ? &cold_queue : NULL));
+
+    // Cold blocks are deferred to the tail of the function in the order they were encountered. All successors of a
+    // cold block are cold as well, so scheduling them never pulls a hot block out of the hot part of the function.
+    for (struct kefir_list_entry *iter = kefir_list_head(&cold_queue); res == KEFIR_OK && iter != NULL;
+         iter = kefir_list_head(&cold_queue)) {
+        void *block_ref = iter->value;
+        REQUIRE_CHAIN(&res, kefir_list_pop(mem, &cold_queue, iter));
+        REQUIRE_CHAIN(&res, kefir_list_insert_after(mem, &queue, kefir_list_tail(&queue), block_ref));
+        REQUIRE_CHAIN(&res, do_schedule_impl(mem, schedule, schedule_builder, control_flow, cold_blocks, &queue, NULL));
+    }
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(mem, cold_blocks);
+        kefir_list_free(mem, &cold_queue);
+        kefir_list_free(mem, &queue);
+        return res;
+    });
+    KEFIR_FREE(mem, cold_blocks);
+    res = kefir_list_free(mem, &cold_queue);
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_list_free(mem, &queue);
         return res;
@@ -101,12 +223,15 @@ static kefir_result_t do_schedule(struct kefir_mem *mem, const struct kefir_code
 }
 
 kefir_result_t kefir_codegen_target_ir_amd64_topological_scheduler_init(
-    const struct kefir_codegen_target_ir_control_flow *control_flow,
+    const struct kefir_codegen_target_ir_amd64_topological_scheduler *topological_scheduler,
     struct kefir_codegen_target_ir_code_scheduler *scheduler) {
-    REQUIRE(control_flow != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR control flow"));
+    REQUIRE(topological_scheduler != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR amd64 topological scheduler"));
+    REQUIRE(topological_scheduler->control_flow != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR control flow"));
     REQUIRE(scheduler != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR scheduler"));
 
     scheduler->do_schedule = do_schedule;
-    scheduler->payload = (void *) control_flow;
+    scheduler->payload = (void *) topological_scheduler;
     return KEFIR_OK;
 }
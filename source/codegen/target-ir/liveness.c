@@ -21,6 +21,7 @@
 #include "kefir/codegen/target-ir/liveness.h"
 #include "kefir/core/error.h"
 #include "kefir/core/util.h"
+#include "kefir/core/queue.h"
 #include <string.h>
 
 static kefir_result_t free_value_liveness(struct kefir_mem *mem, struct kefir_hashtable *table,
@@ -42,6 +43,7 @@ kefir_result_t kefir_codegen_target_ir_liveness_init(struct kefir_codegen_target
 
     liveness->code = NULL;
     liveness->blocks = NULL;
+    liveness->dense = false;
     REQUIRE_OK(kefir_hashtable_init(&liveness->values, &kefir_hashtable_uint_ops));
     REQUIRE_OK(kefir_hashtable_on_removal(&liveness->values, free_value_liveness, NULL));
     REQUIRE_OK(kefir_codegen_target_ir_numbering_init(&liveness->numbering));
@@ -53,6 +55,8 @@ static kefir_result_t free_blocks(struct kefir_mem *mem, struct kefir_codegen_ta
         kefir_codegen_target_ir_block_ref_t block_ref = kefir_codegen_target_ir_code_block_by_index(liveness->code, i);
         KEFIR_FREE(mem, liveness->blocks[block_ref].live_in.content);
         KEFIR_FREE(mem, liveness->blocks[block_ref].live_out.content);
+        REQUIRE_OK(kefir_bitset_free(mem, &liveness->blocks[block_ref].live_in_values));
+        REQUIRE_OK(kefir_bitset_free(mem, &liveness->blocks[block_ref].live_out_values));
         if (liveness->blocks[block_ref].value_liveness_ranges_ready) {
             for (kefir_size_t j = 0; j < liveness->blocks[block_ref].value_liveness_ranges.length; j++) {
                 REQUIRE_OK(kefir_hashset_free(
@@ -94,6 +98,7 @@ kefir_result_t kefir_codegen_target_ir_liveness_reset(struct kefir_mem *mem,
     if (liveness->blocks != NULL) {
         free_blocks(mem, liveness);
     }
+    liveness->dense = false;
     REQUIRE_OK(kefir_codegen_target_ir_numbering_reset(mem, &liveness->numbering));
     return KEFIR_OK;
 }
@@ -250,13 +255,28 @@ static kefir_result_t has_upsilon_for(const struct kefir_codegen_target_ir_code
     return KEFIR_OK;
 }
 
+static kefir_result_t mark_live_in(struct kefir_mem *mem, struct kefir_codegen_target_ir_liveness *liveness,
+                                   kefir_codegen_target_ir_value_ref_t value_ref, kefir_size_t value_index,
+                                   kefir_codegen_target_ir_block_ref_t block_ref, struct kefir_list *queue) {
+    if (liveness->dense) {
+        REQUIRE_OK(kefir_bitset_set(&liveness->blocks[block_ref].live_in_values, value_index, true));
+    } else {
+        REQUIRE_OK(kefir_list_insert_after(mem, queue, kefir_list_tail(queue), (void *) (kefir_uptr_t) block_ref));
+        REQUIRE_OK(add_to_entry(mem, &liveness->blocks[block_ref].live_in, value_ref));
+    }
+    return KEFIR_OK;
+}
+
 static kefir_result_t propagate_instr_liveness(struct kefir_mem *mem,
                                                const struct kefir_codegen_target_ir_control_flow *control_flow,
                                                struct kefir_codegen_target_ir_liveness *liveness,
-                                               kefir_codegen_target_ir_value_ref_t value_ref, struct kefir_list *queue,
+                                               kefir_codegen_target_ir_value_ref_t value_ref, kefir_size_t value_index,
+                                               struct kefir_bitset *phi_out, struct kefir_list *queue,
                                                kefir_uint8_t *visited_map) {
-    REQUIRE_OK(kefir_list_clear(mem, queue));
-    memset(visited_map, 0, sizeof(kefir_uint8_t) * kefir_codegen_target_ir_code_block_count(control_flow->code));
+    if (!liveness->dense) {
+        REQUIRE_OK(kefir_list_clear(mem, queue));
+        memset(visited_map, 0, sizeof(kefir_uint8_t) * kefir_codegen_target_ir_code_block_count(control_flow->code));
+    }
     const struct kefir_codegen_target_ir_instruction *instr;
     REQUIRE_OK(kefir_codegen_target_ir_code_instruction(control_flow->code, value_ref.instr_ref, &instr));
     if (instr->operation.opcode == control_flow->code->klass->placeholder_opcode) {
@@ -299,15 +319,18 @@ static kefir_result_t propagate_instr_liveness(struct kefir_mem *mem,
                 REQUIRE_OK(add_value_liveness(mem, liveness, value_ref, user_instr->block_ref,
                                               KEFIR_CODEGEN_TARGET_IR_LIVENESS_UPSILON, user_instr->instr_ref,
                                               KEFIR_ID_NONE));
-                REQUIRE_OK(add_to_entry(mem, &liveness->blocks[user_instr->block_ref].live_out, value_ref));
+                if (liveness->dense) {
+                    REQUIRE_OK(kefir_bitset_set(&liveness->blocks[user_instr->block_ref].live_out_values,
+                                                value_index, true));
+                } else {
+                    REQUIRE_OK(add_to_entry(mem, &liveness->blocks[user_instr->block_ref].live_out, value_ref));
+                }
             }
 
             if (KEFIR_CODEGEN_TARGET_IR_VALUE_REF_INTO(&user_instr->operation.parameters[1].direct.value_ref) ==
                 KEFIR_CODEGEN_TARGET_IR_VALUE_REF_INTO(&value_ref)) {
                 if (instr->block_ref != user_instr->block_ref) {
-                    REQUIRE_OK(kefir_list_insert_after(mem, queue, kefir_list_tail(queue),
-                                                       (void *) (kefir_uptr_t) user_instr->block_ref));
-                    REQUIRE_OK(add_to_entry(mem, &liveness->blocks[user_instr->block_ref].live_in, value_ref));
+                    REQUIRE_OK(mark_live_in(mem, liveness, value_ref, value_index, user_instr->block_ref, queue));
                     REQUIRE_OK(add_value_liveness(mem, liveness, value_ref, user_instr->block_ref,
                                                   KEFIR_CODEGEN_TARGET_IR_LIVENESS_NORMAL, KEFIR_ID_NONE,
                                                   user_instr->instr_ref));
@@ -329,9 +352,15 @@ static kefir_result_t propagate_instr_liveness(struct kefir_mem *mem,
                     kefir_bool_t has_upsilon = false;
                     REQUIRE_OK(has_upsilon_for(control_flow->code, user_instr_ref, link_block_ref, &has_upsilon));
                     if (!has_upsilon) {
-                        REQUIRE_OK(kefir_list_insert_after(mem, queue, kefir_list_tail(queue),
-                                                           (void *) (kefir_uptr_t) link_block_ref));
-                        REQUIRE_OK(add_to_entry(mem, &liveness->blocks[link_block_ref].live_out, value_ref));
+                        if (liveness->dense) {
+                            REQUIRE_OK(kefir_bitset_set(&phi_out[link_block_ref], value_index, true));
+                            REQUIRE_OK(kefir_bitset_set(&liveness->blocks[link_block_ref].live_out_values,
+                                                        value_index, true));
+                        } else {
+                            REQUIRE_OK(kefir_list_insert_after(mem, queue, kefir_list_tail(queue),
+                                                               (void *) (kefir_uptr_t) link_block_ref));
+                            REQUIRE_OK(add_to_entry(mem, &liveness->blocks[link_block_ref].live_out, value_ref));
+                        }
                         REQUIRE_OK(add_value_liveness(
                             mem, liveness, value_ref, link_block_ref, KEFIR_CODEGEN_TARGET_IR_LIVENESS_NORMAL,
                             kefir_codegen_target_ir_code_block_control_tail(liveness->code, link_block_ref),
@@ -343,9 +372,7 @@ static kefir_result_t propagate_instr_liveness(struct kefir_mem *mem,
                 REQUIRE_OK(res);
             }
         } else if (instr->block_ref != user_instr->block_ref) {
-            REQUIRE_OK(kefir_list_insert_after(mem, queue, kefir_list_tail(queue),
-                                               (void *) (kefir_uptr_t) user_instr->block_ref));
-            REQUIRE_OK(add_to_entry(mem, &liveness->blocks[user_instr->block_ref].live_in, value_ref));
+            REQUIRE_OK(mark_live_in(mem, liveness, value_ref, value_index, user_instr->block_ref, queue));
             REQUIRE_OK(add_value_liveness(mem, liveness, value_ref, user_instr->block_ref,
                                           KEFIR_CODEGEN_TARGET_IR_LIVENESS_NORMAL, KEFIR_ID_NONE,
                                           user_instr->instr_ref));
@@ -359,6 +386,7 @@ static kefir_result_t propagate_instr_liveness(struct kefir_mem *mem,
         REQUIRE_OK(res);
     }
 
+    REQUIRE(!liveness->dense, KEFIR_OK);
     for (struct kefir_list_entry *head = kefir_list_head(queue); head != NULL; head = kefir_list_head(queue)) {
         ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, block_ref, (kefir_uptr_t) head->value);
         REQUIRE_OK(kefir_list_pop(mem, queue, head));
@@ -440,6 +468,23 @@ static kefir_result_t register_liveness_at(
     return KEFIR_OK;
 }
 
+static kefir_result_t register_liveness_set(
+    struct kefir_mem *mem, const struct kefir_codegen_target_ir_liveness *liveness, const struct kefir_bitset *values,
+    kefir_codegen_target_ir_block_ref_t block_ref,
+    struct kefir_codegen_target_ir_liveness_value_block_ranges *per_block_ranges) {
+    kefir_result_t res;
+    kefir_size_t index;
+    for (res = kefir_bitset_find(values, true, 0, &index); res == KEFIR_OK;
+         res = kefir_bitset_find(values, true, index + 1, &index)) {
+        REQUIRE_OK(
+            register_liveness_at(mem, liveness, liveness->numbering.values[index], block_ref, per_block_ranges));
+    }
+    if (res != KEFIR_NOT_FOUND) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
 static kefir_result_t build_per_block_liveness(
     struct kefir_mem *mem, const struct kefir_codegen_target_ir_control_flow *control_flow,
     const struct kefir_codegen_target_ir_liveness *liveness, kefir_codegen_target_ir_block_ref_t block_ref,
@@ -471,13 +516,20 @@ static kefir_result_t build_per_block_liveness(
         return res;
     });
 
-    for (kefir_size_t i = 0; i < liveness->blocks[block_ref].live_in.length; i++) {
-        REQUIRE_OK(register_liveness_at(mem, liveness, liveness->blocks[block_ref].live_in.content[i], block_ref,
-                                        per_block_ranges));
-    }
-    for (kefir_size_t i = 0; i < liveness->blocks[block_ref].live_out.length; i++) {
-        REQUIRE_OK(register_liveness_at(mem, liveness, liveness->blocks[block_ref].live_out.content[i], block_ref,
-                                        per_block_ranges));
+    if (liveness->dense) {
+        REQUIRE_OK(register_liveness_set(mem, liveness, &liveness->blocks[block_ref].live_in_values, block_ref,
+                                         per_block_ranges));
+        REQUIRE_OK(register_liveness_set(mem, liveness, &liveness->blocks[block_ref].live_out_values, block_ref,
+                                         per_block_ranges));
+    } else {
+        for (kefir_size_t i = 0; i < liveness->blocks[block_ref].live_in.length; i++) {
+            REQUIRE_OK(register_liveness_at(mem, liveness, liveness->blocks[block_ref].live_in.content[i], block_ref,
+                                            per_block_ranges));
+        }
+        for (kefir_size_t i = 0; i < liveness->blocks[block_ref].live_out.length; i++) {
+            REQUIRE_OK(register_liveness_at(mem, liveness, liveness->blocks[block_ref].live_out.content[i], block_ref,
+                                            per_block_ranges));
+        }
     }
     for (kefir_codegen_target_ir_instruction_ref_t instr_ref =
              kefir_codegen_target_ir_code_block_control_head(control_flow->code, block_ref);
@@ -497,6 +549,233 @@ static kefir_result_t build_per_block_liveness(
     return KEFIR_OK;
 }
 
+static kefir_result_t compute_dense_live_out(const struct kefir_codegen_target_ir_control_flow *control_flow,
+                                             const struct kefir_codegen_target_ir_liveness *liveness,
+                                             const struct kefir_bitset *phi_out,
+                                             kefir_codegen_target_ir_block_ref_t block_ref,
+                                             struct kefir_bitset *live_out) {
+    REQUIRE_OK(kefir_bitset_clear(live_out));
+    REQUIRE_OK(kefir_bitset_union(live_out, &phi_out[block_ref], NULL));
+
+    kefir_result_t res;
+    struct kefir_hashset_iterator iter;
+    kefir_hashset_key_t key;
+    for (res = kefir_hashset_iter(&control_flow->blocks[block_ref].successors, &iter, &key); res == KEFIR_OK;
+         res = kefir_hashset_next(&iter, &key)) {
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, successor_block_ref, key);
+        REQUIRE_OK(kefir_bitset_union(live_out, &liveness->blocks[successor_block_ref].live_in_values, NULL));
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t propagate_dense_liveness(struct kefir_mem *mem,
+                                               const struct kefir_codegen_target_ir_control_flow *control_flow,
+                                               struct kefir_codegen_target_ir_liveness *liveness,
+                                               const struct kefir_bitset *phi_out, struct kefir_bitset *live_out,
+                                               struct kefir_bitset *queued_blocks, struct kefir_queue *queue) {
+    const kefir_size_t block_count = kefir_codegen_target_ir_code_block_count(liveness->code);
+    REQUIRE_OK(kefir_bitset_ensure(mem, live_out, liveness->numbering.values_length));
+    REQUIRE_OK(kefir_bitset_ensure(mem, queued_blocks, block_count));
+    REQUIRE_OK(kefir_bitset_clear(queued_blocks));
+
+    for (kefir_size_t i = block_count; i > 0; i--) {
+        kefir_codegen_target_ir_block_ref_t block_ref =
+            kefir_codegen_target_ir_code_block_by_index(liveness->code, i - 1);
+        if (kefir_codegen_target_ir_control_flow_is_reachable(control_flow, block_ref)) {
+            REQUIRE_OK(kefir_queue_push(mem, queue, (kefir_queue_entry_t) block_ref));
+            REQUIRE_OK(kefir_bitset_set(queued_blocks, block_ref, true));
+        }
+    }
+
+    // Live-in set of a block gains everything alive on its exit except for values defined by the block itself
+    while (!kefir_queue_is_empty(queue)) {
+        kefir_queue_entry_t entry;
+        REQUIRE_OK(kefir_queue_pop_first(mem, queue, &entry));
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, block_ref, entry);
+        REQUIRE_OK(kefir_bitset_set(queued_blocks, block_ref, false));
+
+        kefir_size_t values_offset, values_length;
+        REQUIRE_OK(
+            kefir_codegen_target_ir_numbering_block_values(&liveness->numbering, block_ref, &values_offset, &values_length));
+        REQUIRE_OK(compute_dense_live_out(control_flow, liveness, phi_out, block_ref, live_out));
+        REQUIRE_OK(kefir_bitset_set_consecutive(live_out, values_offset, values_length, false));
+        kefir_bool_t changed;
+        REQUIRE_OK(kefir_bitset_union(&liveness->blocks[block_ref].live_in_values, live_out, &changed));
+        if (!changed) {
+            continue;
+        }
+
+        kefir_result_t res;
+        struct kefir_hashset_iterator iter;
+        kefir_hashset_key_t key;
+        for (res = kefir_hashset_iter(&control_flow->blocks[block_ref].predecessors, &iter, &key); res == KEFIR_OK;
+             res = kefir_hashset_next(&iter, &key)) {
+            ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, predecessor_block_ref, key);
+            kefir_bool_t queued;
+            REQUIRE_OK(kefir_bitset_get(queued_blocks, predecessor_block_ref, &queued));
+            if (!queued && kefir_codegen_target_ir_control_flow_is_reachable(control_flow, predecessor_block_ref)) {
+                REQUIRE_OK(kefir_queue_push(mem, queue, (kefir_queue_entry_t) predecessor_block_ref));
+                REQUIRE_OK(kefir_bitset_set(queued_blocks, predecessor_block_ref, true));
+            }
+        }
+        if (res != KEFIR_ITERATOR_END) {
+            REQUIRE_OK(res);
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t finalize_dense_liveness(struct kefir_mem *mem,
+                                              const struct kefir_codegen_target_ir_control_flow *control_flow,
+                                              struct kefir_codegen_target_ir_liveness *liveness,
+                                              const struct kefir_bitset *phi_out, struct kefir_bitset *live_out) {
+    for (kefir_size_t i = 0; i < kefir_codegen_target_ir_code_block_count(liveness->code); i++) {
+        kefir_codegen_target_ir_block_ref_t block_ref = kefir_codegen_target_ir_code_block_by_index(liveness->code, i);
+        if (!kefir_codegen_target_ir_control_flow_is_reachable(control_flow, block_ref)) {
+            continue;
+        }
+
+        const kefir_codegen_target_ir_instruction_ref_t head_ref =
+            kefir_codegen_target_ir_code_block_control_head(liveness->code, block_ref);
+        const kefir_codegen_target_ir_instruction_ref_t tail_ref =
+            kefir_codegen_target_ir_code_block_control_tail(liveness->code, block_ref);
+        kefir_size_t values_offset, values_length;
+        REQUIRE_OK(
+            kefir_codegen_target_ir_numbering_block_values(&liveness->numbering, block_ref, &values_offset, &values_length));
+
+        kefir_result_t res;
+        kefir_size_t index;
+        const struct kefir_bitset *live_in = &liveness->blocks[block_ref].live_in_values;
+        for (res = kefir_bitset_find(live_in, true, 0, &index); res == KEFIR_OK;
+             res = kefir_bitset_find(live_in, true, index + 1, &index)) {
+            REQUIRE_OK(add_value_liveness(mem, liveness, liveness->numbering.values[index], block_ref,
+                                          KEFIR_CODEGEN_TARGET_IR_LIVENESS_NORMAL, KEFIR_ID_NONE, head_ref));
+        }
+        if (res != KEFIR_NOT_FOUND) {
+            REQUIRE_OK(res);
+        }
+
+        REQUIRE_OK(compute_dense_live_out(control_flow, liveness, phi_out, block_ref, live_out));
+        for (res = kefir_bitset_find(live_out, true, 0, &index); res == KEFIR_OK;
+             res = kefir_bitset_find(live_out, true, index + 1, &index)) {
+            const kefir_codegen_target_ir_value_ref_t value_ref = liveness->numbering.values[index];
+            REQUIRE_OK(add_value_liveness(mem, liveness, value_ref, block_ref, KEFIR_CODEGEN_TARGET_IR_LIVENESS_NORMAL,
+                                          tail_ref, KEFIR_ID_NONE));
+            if (index >= values_offset && index < values_offset + values_length) {
+                REQUIRE_OK(add_value_liveness(mem, liveness, value_ref, block_ref,
+                                              KEFIR_CODEGEN_TARGET_IR_LIVENESS_NORMAL, value_ref.instr_ref,
+                                              KEFIR_ID_NONE));
+            }
+        }
+        if (res != KEFIR_NOT_FOUND) {
+            REQUIRE_OK(res);
+        }
+        REQUIRE_OK(kefir_bitset_union(&liveness->blocks[block_ref].live_out_values, live_out, NULL));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t build_dense_liveness_impl(struct kefir_mem *mem,
+                                                const struct kefir_codegen_target_ir_control_flow *control_flow,
+                                                struct kefir_codegen_target_ir_liveness *liveness,
+                                                struct kefir_bitset *phi_out) {
+    const kefir_size_t block_count = kefir_codegen_target_ir_code_block_count(liveness->code);
+    for (kefir_size_t i = 0; i < block_count; i++) {
+        kefir_codegen_target_ir_block_ref_t block_ref = kefir_codegen_target_ir_code_block_by_index(liveness->code, i);
+        REQUIRE_OK(kefir_bitset_ensure(mem, &liveness->blocks[block_ref].live_in_values,
+                                       liveness->numbering.values_length));
+        REQUIRE_OK(kefir_bitset_ensure(mem, &liveness->blocks[block_ref].live_out_values,
+                                       liveness->numbering.values_length));
+        REQUIRE_OK(kefir_bitset_ensure(mem, &phi_out[block_ref], liveness->numbering.values_length));
+    }
+
+    // Use sites are recorded directly into per-block live-in and phi operand sets, without walking the CFG
+    for (kefir_size_t i = 0; i < block_count; i++) {
+        kefir_codegen_target_ir_block_ref_t block_ref = kefir_codegen_target_ir_code_block_by_index(liveness->code, i);
+        if (!kefir_codegen_target_ir_control_flow_is_reachable(control_flow, block_ref)) {
+            continue;
+        }
+
+        kefir_size_t values_offset, values_length;
+        REQUIRE_OK(
+            kefir_codegen_target_ir_numbering_block_values(&liveness->numbering, block_ref, &values_offset, &values_length));
+        for (kefir_size_t j = values_offset; j < values_offset + values_length; j++) {
+            REQUIRE_OK(propagate_instr_liveness(mem, control_flow, liveness, liveness->numbering.values[j], j, phi_out,
+                                                NULL, NULL));
+        }
+    }
+
+    struct kefir_bitset live_out, queued_blocks;
+    struct kefir_queue queue;
+    REQUIRE_OK(kefir_bitset_init(&live_out));
+    REQUIRE_OK(kefir_bitset_init(&queued_blocks));
+    REQUIRE_OK(kefir_queue_init(&queue));
+    kefir_result_t res =
+        propagate_dense_liveness(mem, control_flow, liveness, phi_out, &live_out, &queued_blocks, &queue);
+    REQUIRE_CHAIN(&res, finalize_dense_liveness(mem, control_flow, liveness, phi_out, &live_out));
+    kefir_bitset_free(mem, &live_out);
+    kefir_bitset_free(mem, &queued_blocks);
+    kefir_queue_free(mem, &queue);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
+static kefir_result_t build_dense_liveness(struct kefir_mem *mem,
+                                           const struct kefir_codegen_target_ir_control_flow *control_flow,
+                                           struct kefir_codegen_target_ir_liveness *liveness) {
+    const kefir_size_t block_count = kefir_codegen_target_ir_code_block_count(liveness->code);
+    struct kefir_bitset *phi_out = KEFIR_MALLOC(mem, sizeof(struct kefir_bitset) * MAX(block_count, 1));
+    REQUIRE(phi_out != NULL,
+            KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate target IR liveness phi operand sets"));
+    for (kefir_size_t i = 0; i < block_count; i++) {
+        kefir_bitset_init(&phi_out[i]);
+    }
+
+    kefir_result_t res = build_dense_liveness_impl(mem, control_flow, liveness, phi_out);
+    for (kefir_size_t i = 0; i < block_count; i++) {
+        kefir_bitset_free(mem, &phi_out[i]);
+    }
+    KEFIR_FREE(mem, phi_out);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
+static kefir_result_t build_sparse_liveness(struct kefir_mem *mem,
+                                            const struct kefir_codegen_target_ir_control_flow *control_flow,
+                                            struct kefir_codegen_target_ir_liveness *liveness) {
+    struct kefir_list queue;
+    REQUIRE_OK(kefir_list_init(&queue));
+    kefir_uint8_t *visited_map =
+        KEFIR_MALLOC(mem, sizeof(kefir_uint8_t) * kefir_codegen_target_ir_code_block_count(liveness->code));
+    REQUIRE(visited_map != NULL,
+            KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate target IR liveness visited block map"));
+    for (kefir_size_t i = 0; i < kefir_codegen_target_ir_code_block_count(liveness->code); i++) {
+        kefir_codegen_target_ir_block_ref_t block_ref = kefir_codegen_target_ir_code_block_by_index(liveness->code, i);
+        if (!kefir_codegen_target_ir_control_flow_is_reachable(control_flow, block_ref)) {
+            continue;
+        }
+
+        kefir_size_t values_offset, values_length;
+        kefir_result_t res = kefir_codegen_target_ir_numbering_block_values(&liveness->numbering, block_ref,
+                                                                            &values_offset, &values_length);
+        for (kefir_size_t j = values_offset; res == KEFIR_OK && j < values_offset + values_length; j++) {
+            res = propagate_instr_liveness(mem, control_flow, liveness, liveness->numbering.values[j], j, NULL, &queue,
+                                           visited_map);
+        }
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            KEFIR_FREE(mem, visited_map);
+            kefir_list_free(mem, &queue);
+            return res;
+        });
+    }
+    KEFIR_FREE(mem, visited_map);
+    REQUIRE_OK(kefir_list_free(mem, &queue));
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_codegen_target_ir_liveness_build(struct kefir_mem *mem,
                                                       const struct kefir_codegen_target_ir_control_flow *control_flow,
                                                       struct kefir_codegen_target_ir_liveness *liveness) {
@@ -521,46 +800,23 @@ kefir_result_t kefir_codegen_target_ir_liveness_build(struct kefir_mem *mem,
         liveness->blocks[block_ref].live_out.content = NULL;
         liveness->blocks[block_ref].live_out.length = 0;
         liveness->blocks[block_ref].live_out.capacity = 0;
+        REQUIRE_OK(kefir_bitset_init(&liveness->blocks[block_ref].live_in_values));
+        REQUIRE_OK(kefir_bitset_init(&liveness->blocks[block_ref].live_out_values));
         liveness->blocks[block_ref].value_liveness_ranges_ready = false;
         liveness->blocks[block_ref].value_liveness_ranges.indices = NULL;
         liveness->blocks[block_ref].value_liveness_ranges.length = 0;
     }
     liveness->code = control_flow->code;
 
-    struct kefir_list queue;
-    REQUIRE_OK(kefir_list_init(&queue));
-    kefir_uint8_t *visited_map =
-        KEFIR_MALLOC(mem, sizeof(kefir_uint8_t) * kefir_codegen_target_ir_code_block_count(liveness->code));
-    for (kefir_size_t i = 0; i < kefir_codegen_target_ir_code_block_count(liveness->code); i++) {
-        kefir_codegen_target_ir_block_ref_t block_ref = kefir_codegen_target_ir_code_block_by_index(liveness->code, i);
-        if (!kefir_codegen_target_ir_control_flow_is_reachable(control_flow, block_ref)) {
-            continue;
-        }
-
-        for (kefir_codegen_target_ir_instruction_ref_t instr_ref =
-                 kefir_codegen_target_ir_code_block_control_head(liveness->code, block_ref);
-             instr_ref != KEFIR_ID_NONE;
-             instr_ref = kefir_codegen_target_ir_code_control_next(liveness->code, instr_ref)) {
-            struct kefir_codegen_target_ir_value_iterator value_iter;
-            struct kefir_codegen_target_ir_value_ref value_ref;
-            kefir_result_t res;
-            for (res =
-                     kefir_codegen_target_ir_code_value_iter(liveness->code, &value_iter, instr_ref, &value_ref, NULL);
-                 res == KEFIR_OK; res = kefir_codegen_target_ir_code_value_next(&value_iter, &value_ref, NULL)) {
-                res = propagate_instr_liveness(mem, control_flow, liveness, value_ref, &queue, visited_map);
-                REQUIRE_ELSE(res == KEFIR_OK, {
-                    KEFIR_FREE(mem, visited_map);
-                    kefir_list_free(mem, &queue);
-                    return res;
-                });
-            }
-            if (res != KEFIR_ITERATOR_END) {
-                REQUIRE_OK(res);
-            }
-        }
+    const kefir_size_t num_of_values = liveness->numbering.values_length;
+    liveness->dense = num_of_values >= KEFIR_CODEGEN_TARGET_IR_LIVENESS_DENSE_THRESHOLD &&
+                      num_of_values * kefir_codegen_target_ir_code_block_count(liveness->code) <=
+                          KEFIR_CODEGEN_TARGET_IR_LIVENESS_DENSE_MAX_BITS;
+    if (liveness->dense) {
+        REQUIRE_OK(build_dense_liveness(mem, control_flow, liveness));
+    } else {
+        REQUIRE_OK(build_sparse_liveness(mem, control_flow, liveness));
     }
-    KEFIR_FREE(mem, visited_map);
-    REQUIRE_OK(kefir_list_free(mem, &queue));
     return KEFIR_OK;
 }
 
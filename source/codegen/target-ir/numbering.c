@@ -30,6 +30,11 @@ kefir_result_t kefir_codegen_target_ir_numbering_init(struct kefir_codegen_targe
     numbering->block_lengths = NULL;
     numbering->length = 0;
     numbering->block_count = 0;
+    numbering->values = NULL;
+    numbering->block_value_offsets = NULL;
+    numbering->block_value_lengths = NULL;
+    numbering->values_length = 0;
+    numbering->values_capacity = 0;
     return KEFIR_OK;
 }
 
@@ -40,10 +45,18 @@ kefir_result_t kefir_codegen_target_ir_numbering_free(struct kefir_mem *mem,
 
     KEFIR_FREE(mem, numbering->block_lengths);
     KEFIR_FREE(mem, numbering->instruction_seq_nums);
+    KEFIR_FREE(mem, numbering->values);
+    KEFIR_FREE(mem, numbering->block_value_offsets);
+    KEFIR_FREE(mem, numbering->block_value_lengths);
     numbering->instruction_seq_nums = NULL;
     numbering->block_lengths = NULL;
     numbering->length = 0;
     numbering->block_count = 0;
+    numbering->values = NULL;
+    numbering->block_value_offsets = NULL;
+    numbering->block_value_lengths = NULL;
+    numbering->values_length = 0;
+    numbering->values_capacity = 0;
     return KEFIR_OK;
 }
 
@@ -54,10 +67,33 @@ kefir_result_t kefir_codegen_target_ir_numbering_reset(struct kefir_mem *mem,
 
     KEFIR_FREE(mem, numbering->block_lengths);
     KEFIR_FREE(mem, numbering->instruction_seq_nums);
+    KEFIR_FREE(mem, numbering->values);
+    KEFIR_FREE(mem, numbering->block_value_offsets);
+    KEFIR_FREE(mem, numbering->block_value_lengths);
     numbering->instruction_seq_nums = NULL;
     numbering->block_lengths = NULL;
     numbering->length = 0;
     numbering->block_count = 0;
+    numbering->values = NULL;
+    numbering->block_value_offsets = NULL;
+    numbering->block_value_lengths = NULL;
+    numbering->values_length = 0;
+    numbering->values_capacity = 0;
+    return KEFIR_OK;
+}
+
+static kefir_result_t add_value(struct kefir_mem *mem, struct kefir_codegen_target_ir_numbering *numbering,
+                                kefir_codegen_target_ir_value_ref_t value_ref) {
+    if (numbering->values_length >= numbering->values_capacity) {
+        kefir_size_t new_capacity = MAX(numbering->values_capacity * 2, 128);
+        kefir_codegen_target_ir_value_ref_t *new_values =
+            KEFIR_REALLOC(mem, numbering->values, sizeof(kefir_codegen_target_ir_value_ref_t) * new_capacity);
+        REQUIRE(new_values != NULL,
+                KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate target IR value numbering"));
+        numbering->values = new_values;
+        numbering->values_capacity = new_capacity;
+    }
+    numbering->values[numbering->values_length++] = value_ref;
     return KEFIR_OK;
 }
 
@@ -81,18 +117,40 @@ kefir_result_t kefir_codegen_target_ir_numbering_build(struct kefir_mem *mem,
             KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate target IR numbering"));
     numbering->block_count = kefir_codegen_target_ir_code_block_count(code);
 
+    numbering->block_value_offsets = KEFIR_MALLOC(mem, sizeof(kefir_uint32_t) * numbering->block_count);
+    REQUIRE(numbering->block_value_offsets != NULL,
+            KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate target IR value numbering"));
+    numbering->block_value_lengths = KEFIR_MALLOC(mem, sizeof(kefir_uint32_t) * numbering->block_count);
+    REQUIRE(numbering->block_value_lengths != NULL,
+            KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate target IR value numbering"));
+
     for (kefir_size_t i = 0; i < numbering->block_count; i++) {
         kefir_codegen_target_ir_block_ref_t block_ref = kefir_codegen_target_ir_code_block_by_index(code, i);
 
+        // Values are numbered densely block by block, so that each block defines a contiguous value range
+        numbering->block_value_offsets[block_ref] = numbering->values_length;
         kefir_size_t local_index = 0;
         for (kefir_codegen_target_ir_instruction_ref_t instr_ref =
                  kefir_codegen_target_ir_code_block_control_head(code, block_ref);
              instr_ref != KEFIR_ID_NONE;
              instr_ref = kefir_codegen_target_ir_code_control_next(code, instr_ref), local_index++) {
             numbering->instruction_seq_nums[instr_ref] = local_index;
+
+            kefir_result_t res;
+            struct kefir_codegen_target_ir_value_iterator value_iter;
+            struct kefir_codegen_target_ir_value_ref value_ref;
+            for (res = kefir_codegen_target_ir_code_value_iter(code, &value_iter, instr_ref, &value_ref, NULL);
+                 res == KEFIR_OK; res = kefir_codegen_target_ir_code_value_next(&value_iter, &value_ref, NULL)) {
+                REQUIRE_OK(add_value(mem, numbering, value_ref));
+            }
+            if (res != KEFIR_ITERATOR_END) {
+                REQUIRE_OK(res);
+            }
         }
 
         numbering->block_lengths[block_ref] = local_index;
+        numbering->block_value_lengths[block_ref] =
+            numbering->values_length - numbering->block_value_offsets[block_ref];
     }
     return KEFIR_OK;
 }
@@ -120,3 +178,27 @@ kefir_result_t kefir_codegen_target_ir_numbering_instruction_seq_index(
     *index_ptr = numbering->instruction_seq_nums[instr_ref];
     return KEFIR_OK;
 }
+
+kefir_result_t kefir_codegen_target_ir_numbering_block_values(const struct kefir_codegen_target_ir_numbering *numbering,
+                                                              kefir_codegen_target_ir_block_ref_t block_ref,
+                                                              kefir_size_t *offset_ptr, kefir_size_t *length_ptr) {
+    REQUIRE(numbering != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR numbering"));
+    REQUIRE(block_ref != KEFIR_ID_NONE && block_ref < numbering->block_count,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Block reference is out of numbering bounds"));
+
+    ASSIGN_PTR(offset_ptr, numbering->block_value_offsets[block_ref]);
+    ASSIGN_PTR(length_ptr, numbering->block_value_lengths[block_ref]);
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_codegen_target_ir_numbering_value(const struct kefir_codegen_target_ir_numbering *numbering,
+                                                       kefir_size_t index,
+                                                       kefir_codegen_target_ir_value_ref_t *value_ref_ptr) {
+    REQUIRE(numbering != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR numbering"));
+    REQUIRE(index < numbering->values_length,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Value index is out of numbering bounds"));
+    REQUIRE(value_ref_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to target IR value"));
+
+    *value_ref_ptr = numbering->values[index];
+    return KEFIR_OK;
+}
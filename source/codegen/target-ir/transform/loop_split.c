@@ -0,0 +1,717 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "kefir/codegen/target-ir/transform.h"
+#include "kefir/codegen/target-ir/control_flow.h"
+#include "kefir/codegen/target-ir/hotness.h"
+#include "kefir/codegen/target-ir/regalloc.h"
+#include "kefir/core/error.h"
+#include "kefir/core/util.h"
+
+// Values spilled by the first register allocation pass are split at natural loop boundaries: a value defined
+// before a loop receives a copy in the loop preheader, and a value defined within a loop receives a copy in the
+// loop exit block. Uses on the loop side are rewritten to the copy, so that the second allocation pass may assign
+// a register to the loop fragment while the remaining fragment stays in memory. Loops containing calls that clobber
+// the register class of a value are split further around these calls.
+
+struct split_loop {
+    kefir_codegen_target_ir_block_ref_t header;
+    kefir_codegen_target_ir_block_ref_t preheader;
+    struct kefir_hashset blocks;
+    kefir_size_t length;
+    kefir_bool_t general_purpose_clobber;
+    kefir_bool_t floating_point_clobber;
+};
+
+struct split_state {
+    struct kefir_mem *mem;
+    struct kefir_codegen_target_ir_code *code;
+    const struct kefir_codegen_target_ir_control_flow *control_flow;
+    const struct kefir_codegen_target_ir_liveness *liveness;
+    const struct kefir_codegen_target_ir_regalloc *regalloc;
+    struct kefir_codegen_target_ir_hotness hotness;
+    struct kefir_list loops;
+    struct kefir_list candidates;
+    struct kefir_list queue;
+    struct kefir_hashset users;
+};
+
+static kefir_result_t free_split_loop(struct kefir_mem *mem, struct kefir_list *list, struct kefir_list_entry *entry,
+                                      void *payload) {
+    UNUSED(list);
+    UNUSED(payload);
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(entry != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid list entry"));
+
+    ASSIGN_DECL_CAST(struct split_loop *, loop, entry->value);
+    REQUIRE_OK(kefir_hashset_free(mem, &loop->blocks));
+    KEFIR_FREE(mem, loop);
+    return KEFIR_OK;
+}
+
+static kefir_result_t collect_loop_body(struct split_state *state, struct split_loop *loop,
+                                        kefir_codegen_target_ir_block_ref_t latch_block_ref) {
+    REQUIRE(!kefir_hashset_has(&loop->blocks, (kefir_hashset_key_t) latch_block_ref), KEFIR_OK);
+    REQUIRE_OK(kefir_hashset_add(state->mem, &loop->blocks, (kefir_hashset_key_t) latch_block_ref));
+    REQUIRE_OK(kefir_list_insert_after(state->mem, &state->queue, kefir_list_tail(&state->queue),
+                                       (void *) (kefir_uptr_t) latch_block_ref));
+
+    for (struct kefir_list_entry *head = kefir_list_head(&state->queue); head != NULL;
+         head = kefir_list_head(&state->queue)) {
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, block_ref, (kefir_uptr_t) head->value);
+        REQUIRE_OK(kefir_list_pop(state->mem, &state->queue, head));
+
+        kefir_result_t res;
+        struct kefir_hashset_iterator iter;
+        kefir_hashset_key_t iter_key;
+        for (res = kefir_hashset_iter(&state->control_flow->blocks[block_ref].predecessors, &iter, &iter_key);
+             res == KEFIR_OK; res = kefir_hashset_next(&iter, &iter_key)) {
+            ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, pred_block_ref, iter_key);
+            if (!kefir_codegen_target_ir_control_flow_is_reachable(state->control_flow, pred_block_ref) ||
+                kefir_hashset_has(&loop->blocks, (kefir_hashset_key_t) pred_block_ref)) {
+                continue;
+            }
+
+            REQUIRE_OK(kefir_hashset_add(state->mem, &loop->blocks, (kefir_hashset_key_t) pred_block_ref));
+            REQUIRE_OK(kefir_list_insert_after(state->mem, &state->queue, kefir_list_tail(&state->queue),
+                                               (void *) (kefir_uptr_t) pred_block_ref));
+        }
+        if (res != KEFIR_ITERATOR_END) {
+            REQUIRE_OK(res);
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t is_clobber(struct split_state *state, kefir_codegen_target_ir_instruction_ref_t instr_ref,
+                                 kefir_bool_t *general_purpose_clobber, kefir_bool_t *floating_point_clobber) {
+    *general_purpose_clobber = false;
+    *floating_point_clobber = false;
+
+    const struct kefir_codegen_target_ir_instruction *instr;
+    REQUIRE_OK(kefir_codegen_target_ir_code_instruction(state->code, instr_ref, &instr));
+    REQUIRE(instr->operation.opcode == state->code->klass->placeholder_opcode, KEFIR_OK);
+
+    // Placeholders with physical register requirements denote registers clobbered by calls and similar instructions
+    kefir_result_t res;
+    struct kefir_codegen_target_ir_value_iterator value_iter;
+    kefir_codegen_target_ir_value_ref_t value_ref;
+    const struct kefir_codegen_target_ir_value_type *value_type;
+    for (res = kefir_codegen_target_ir_code_value_iter(state->code, &value_iter, instr_ref, &value_ref, &value_type);
+         res == KEFIR_OK; res = kefir_codegen_target_ir_code_value_next(&value_iter, &value_ref, &value_type)) {
+        if (value_type->constraint.type != KEFIR_CODEGEN_TARGET_IR_ALLOCATION_REQUIREMENT) {
+            continue;
+        }
+        if (value_type->kind == KEFIR_CODEGEN_TARGET_IR_VALUE_TYPE_GENERAL_PURPOSE) {
+            *general_purpose_clobber = true;
+        } else if (value_type->kind == KEFIR_CODEGEN_TARGET_IR_VALUE_TYPE_FLOATING_POINT) {
+            *floating_point_clobber = true;
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t analyze_loop(struct split_state *state, struct split_loop *loop) {
+    kefir_result_t res;
+    struct kefir_hashset_iterator iter;
+    kefir_hashset_key_t iter_key;
+    kefir_size_t num_of_entries = 0;
+    for (res = kefir_hashset_iter(&state->control_flow->blocks[loop->header].predecessors, &iter, &iter_key);
+         res == KEFIR_OK; res = kefir_hashset_next(&iter, &iter_key)) {
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, pred_block_ref, iter_key);
+        if (!kefir_hashset_has(&loop->blocks, (kefir_hashset_key_t) pred_block_ref)) {
+            loop->preheader = pred_block_ref;
+            num_of_entries++;
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+
+    if (num_of_entries != 1 || kefir_codegen_target_ir_code_is_gate_block(state->code, loop->preheader) ||
+        kefir_hashset_size(&state->control_flow->blocks[loop->preheader].successors) != 1) {
+        loop->preheader = KEFIR_ID_NONE;
+    } else {
+        const struct kefir_codegen_target_ir_instruction *tail_instr;
+        REQUIRE_OK(kefir_codegen_target_ir_code_instruction(
+            state->code, kefir_codegen_target_ir_code_block_control_tail(state->code, loop->preheader), &tail_instr));
+        if (tail_instr->operation.opcode == state->code->klass->inline_asm_opcode) {
+            loop->preheader = KEFIR_ID_NONE;
+        }
+    }
+
+    for (res = kefir_hashset_iter(&loop->blocks, &iter, &iter_key); res == KEFIR_OK;
+         res = kefir_hashset_next(&iter, &iter_key)) {
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, block_ref, iter_key);
+        kefir_size_t block_length;
+        REQUIRE_OK(
+            kefir_codegen_target_ir_numbering_block_length(&state->liveness->numbering, block_ref, &block_length));
+        loop->length += block_length;
+
+        for (kefir_codegen_target_ir_instruction_ref_t instr_ref =
+                 kefir_codegen_target_ir_code_block_control_head(state->code, block_ref);
+             instr_ref != KEFIR_ID_NONE;
+             instr_ref = kefir_codegen_target_ir_code_control_next(state->code, instr_ref)) {
+            kefir_bool_t general_purpose_clobber, floating_point_clobber;
+            REQUIRE_OK(is_clobber(state, instr_ref, &general_purpose_clobber, &floating_point_clobber));
+            loop->general_purpose_clobber = loop->general_purpose_clobber || general_purpose_clobber;
+            loop->floating_point_clobber = loop->floating_point_clobber || floating_point_clobber;
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t build_loop(struct split_state *state, struct split_loop *loop) {
+    REQUIRE_OK(kefir_hashset_add(state->mem, &loop->blocks, (kefir_hashset_key_t) loop->header));
+
+    kefir_result_t res;
+    struct kefir_hashset_iterator iter;
+    kefir_hashset_key_t iter_key;
+    for (res = kefir_hashset_iter(&state->control_flow->blocks[loop->header].predecessors, &iter, &iter_key);
+         res == KEFIR_OK; res = kefir_hashset_next(&iter, &iter_key)) {
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, pred_block_ref, iter_key);
+        if (!kefir_codegen_target_ir_control_flow_is_reachable(state->control_flow, pred_block_ref)) {
+            continue;
+        }
+
+        kefir_bool_t is_back_edge;
+        REQUIRE_OK(kefir_codegen_target_ir_control_flow_is_dominator(state->control_flow, pred_block_ref,
+                                                                     loop->header, &is_back_edge));
+        if (is_back_edge) {
+            REQUIRE_OK(collect_loop_body(state, loop, pred_block_ref));
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+
+    REQUIRE_OK(analyze_loop(state, loop));
+    return KEFIR_OK;
+}
+
+static kefir_result_t find_loop(struct split_state *state, kefir_codegen_target_ir_block_ref_t header_block_ref) {
+    kefir_bool_t has_back_edge = false;
+    kefir_result_t res;
+    struct kefir_hashset_iterator iter;
+    kefir_hashset_key_t iter_key;
+    for (res = kefir_hashset_iter(&state->control_flow->blocks[header_block_ref].predecessors, &iter, &iter_key);
+         res == KEFIR_OK && !has_back_edge; res = kefir_hashset_next(&iter, &iter_key)) {
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, pred_block_ref, iter_key);
+        if (kefir_codegen_target_ir_control_flow_is_reachable(state->control_flow, pred_block_ref)) {
+            REQUIRE_OK(kefir_codegen_target_ir_control_flow_is_dominator(state->control_flow, pred_block_ref,
+                                                                         header_block_ref, &has_back_edge));
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    REQUIRE(has_back_edge, KEFIR_OK);
+
+    struct split_loop *loop = KEFIR_MALLOC(state->mem, sizeof(struct split_loop));
+    REQUIRE(loop != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate target IR loop"));
+    loop->header = header_block_ref;
+    loop->preheader = KEFIR_ID_NONE;
+    loop->length = 0;
+    loop->general_purpose_clobber = false;
+    loop->floating_point_clobber = false;
+    res = kefir_hashset_init(&loop->blocks, &kefir_hashtable_uint_ops);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(state->mem, loop);
+        return res;
+    });
+    res = build_loop(state, loop);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_hashset_free(state->mem, &loop->blocks);
+        KEFIR_FREE(state->mem, loop);
+        return res;
+    });
+
+    // Inner loops are processed first, so that their fragments are as short as possible
+    struct kefir_list_entry *insert_after = NULL;
+    for (struct kefir_list_entry *iter = kefir_list_head(&state->loops); iter != NULL; iter = iter->next) {
+        ASSIGN_DECL_CAST(const struct split_loop *, other_loop, iter->value);
+        if (kefir_hashset_size(&other_loop->blocks) <= kefir_hashset_size(&loop->blocks)) {
+            insert_after = iter;
+        }
+    }
+    res = kefir_list_insert_after(state->mem, &state->loops, insert_after, loop);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_hashset_free(state->mem, &loop->blocks);
+        KEFIR_FREE(state->mem, loop);
+        return res;
+    });
+    return KEFIR_OK;
+}
+
+static kefir_result_t collect_candidates(struct split_state *state) {
+    for (kefir_size_t i = 0; i < kefir_codegen_target_ir_code_block_count(state->code); i++) {
+        kefir_codegen_target_ir_block_ref_t block_ref = kefir_codegen_target_ir_code_block_by_index(state->code, i);
+        if (!kefir_codegen_target_ir_control_flow_is_reachable(state->control_flow, block_ref)) {
+            continue;
+        }
+        REQUIRE_OK(find_loop(state, block_ref));
+
+        for (kefir_codegen_target_ir_instruction_ref_t instr_ref =
+                 kefir_codegen_target_ir_code_block_control_head(state->code, block_ref);
+             instr_ref != KEFIR_ID_NONE;
+             instr_ref = kefir_codegen_target_ir_code_control_next(state->code, instr_ref)) {
+            kefir_result_t res;
+            struct kefir_codegen_target_ir_value_iterator value_iter;
+            kefir_codegen_target_ir_value_ref_t value_ref;
+            const struct kefir_codegen_target_ir_value_type *value_type;
+            for (res = kefir_codegen_target_ir_code_value_iter(state->code, &value_iter, instr_ref, &value_ref,
+                                                               &value_type);
+                 res == KEFIR_OK; res = kefir_codegen_target_ir_code_value_next(&value_iter, &value_ref, &value_type)) {
+                if (KEFIR_CODEGEN_TARGET_IR_VALUE_IS_INDIRECT_OUTPUT(value_ref.aspect) ||
+                    KEFIR_CODEGEN_TARGET_IR_VALUE_IS_RESOURCE(value_ref.aspect) ||
+                    value_type->constraint.type == KEFIR_CODEGEN_TARGET_IR_ALLOCATION_REQUIREMENT ||
+                    (value_type->kind != KEFIR_CODEGEN_TARGET_IR_VALUE_TYPE_GENERAL_PURPOSE &&
+                     value_type->kind != KEFIR_CODEGEN_TARGET_IR_VALUE_TYPE_FLOATING_POINT)) {
+                    continue;
+                }
+
+                kefir_codegen_target_ir_regalloc_allocation_t allocation;
+                res = kefir_codegen_target_ir_regalloc_get(state->regalloc, value_ref, &allocation);
+                if (res == KEFIR_NOT_FOUND) {
+                    continue;
+                }
+                REQUIRE_OK(res);
+
+                kefir_bool_t is_evictable, is_rematerializable;
+                REQUIRE_OK(
+                    state->regalloc->klass->is_evictable(allocation, &is_evictable, state->regalloc->klass->payload));
+                REQUIRE_OK(state->regalloc->klass->is_rematerializable(state->code, state->liveness, value_ref,
+                                                                       &is_rematerializable,
+                                                                       state->regalloc->klass->payload));
+                if (is_evictable || is_rematerializable) {
+                    continue;
+                }
+
+                REQUIRE_OK(kefir_list_insert_after(
+                    state->mem, &state->candidates, kefir_list_tail(&state->candidates),
+                    (void *) (kefir_uptr_t) KEFIR_CODEGEN_TARGET_IR_VALUE_REF_INTO(&value_ref)));
+            }
+            if (res != KEFIR_ITERATOR_END) {
+                REQUIRE_OK(res);
+            }
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t find_exit_block(struct split_state *state, const struct split_loop *loop,
+                                      kefir_codegen_target_ir_block_ref_t use_block_ref,
+                                      kefir_codegen_target_ir_block_ref_t *exit_block_ref) {
+    *exit_block_ref = KEFIR_ID_NONE;
+
+    kefir_result_t res;
+    struct kefir_hashset_iterator iter;
+    kefir_hashset_key_t iter_key;
+    for (res = kefir_hashset_iter(&loop->blocks, &iter, &iter_key); res == KEFIR_OK;
+         res = kefir_hashset_next(&iter, &iter_key)) {
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, block_ref, iter_key);
+
+        struct kefir_hashset_iterator succ_iter;
+        kefir_hashset_key_t succ_key;
+        for (res = kefir_hashset_iter(&state->control_flow->blocks[block_ref].successors, &succ_iter, &succ_key);
+             res == KEFIR_OK; res = kefir_hashset_next(&succ_iter, &succ_key)) {
+            ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, succ_block_ref, succ_key);
+            if (kefir_hashset_has(&loop->blocks, (kefir_hashset_key_t) succ_block_ref) ||
+                kefir_hashset_size(&state->control_flow->blocks[succ_block_ref].predecessors) != 1 ||
+                kefir_codegen_target_ir_code_is_gate_block(state->code, succ_block_ref)) {
+                continue;
+            }
+
+            kefir_bool_t is_dominator;
+            REQUIRE_OK(kefir_codegen_target_ir_control_flow_is_dominator(state->control_flow, use_block_ref,
+                                                                         succ_block_ref, &is_dominator));
+            if (is_dominator) {
+                *exit_block_ref = succ_block_ref;
+                return KEFIR_OK;
+            }
+        }
+        if (res != KEFIR_ITERATOR_END) {
+            REQUIRE_OK(res);
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t classify_use(struct split_state *state, const struct split_loop *loop,
+                                   kefir_bool_t defined_in_loop, kefir_codegen_target_ir_block_ref_t use_block_ref,
+                                   kefir_size_t *loop_uses, kefir_codegen_target_ir_block_ref_t *exit_block_ref,
+                                   kefir_bool_t *splittable) {
+    if (kefir_hashset_has(&loop->blocks, (kefir_hashset_key_t) use_block_ref)) {
+        (*loop_uses)++;
+    } else if (defined_in_loop) {
+        if (*exit_block_ref == KEFIR_ID_NONE) {
+            REQUIRE_OK(find_exit_block(state, loop, use_block_ref, exit_block_ref));
+            if (*exit_block_ref == KEFIR_ID_NONE) {
+                *splittable = false;
+            }
+        } else {
+            kefir_bool_t is_dominator;
+            REQUIRE_OK(kefir_codegen_target_ir_control_flow_is_dominator(state->control_flow, use_block_ref,
+                                                                         *exit_block_ref, &is_dominator));
+            if (!is_dominator) {
+                *splittable = false;
+            }
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t is_in_split_scope(struct split_state *state, const struct split_loop *loop,
+                                        kefir_codegen_target_ir_block_ref_t exit_block_ref,
+                                        kefir_codegen_target_ir_block_ref_t use_block_ref, kefir_bool_t *in_scope) {
+    if (exit_block_ref == KEFIR_ID_NONE) {
+        *in_scope = kefir_hashset_has(&loop->blocks, (kefir_hashset_key_t) use_block_ref);
+    } else {
+        REQUIRE_OK(kefir_codegen_target_ir_control_flow_is_dominator(state->control_flow, use_block_ref,
+                                                                     exit_block_ref, in_scope));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t rewrite_phi_links(struct split_state *state, const struct split_loop *loop,
+                                        kefir_codegen_target_ir_block_ref_t exit_block_ref,
+                                        kefir_codegen_target_ir_instruction_ref_t phi_ref,
+                                        kefir_codegen_target_ir_value_ref_t value_ref,
+                                        kefir_codegen_target_ir_value_ref_t copy_value_ref) {
+    for (kefir_bool_t rewritten = true; rewritten;) {
+        rewritten = false;
+
+        kefir_result_t res;
+        struct kefir_codegen_target_ir_value_phi_link_iterator link_iter;
+        kefir_codegen_target_ir_block_ref_t link_block_ref;
+        kefir_codegen_target_ir_value_ref_t link_value_ref;
+        for (res = kefir_codegen_target_ir_code_phi_link_iter(state->code, &link_iter, phi_ref, &link_block_ref,
+                                                              &link_value_ref);
+             res == KEFIR_OK && !rewritten;
+             res = kefir_codegen_target_ir_code_phi_link_next(&link_iter, &link_block_ref, &link_value_ref)) {
+            if (KEFIR_CODEGEN_TARGET_IR_VALUE_REF_INTO(&link_value_ref) !=
+                KEFIR_CODEGEN_TARGET_IR_VALUE_REF_INTO(&value_ref)) {
+                continue;
+            }
+
+            kefir_bool_t in_scope;
+            REQUIRE_OK(is_in_split_scope(state, loop, exit_block_ref, link_block_ref, &in_scope));
+            if (in_scope) {
+                REQUIRE_OK(kefir_codegen_target_ir_code_phi_drop(state->mem, state->code, phi_ref, link_block_ref));
+                REQUIRE_OK(kefir_codegen_target_ir_code_phi_attach(state->mem, state->code, phi_ref, link_block_ref,
+                                                                   copy_value_ref));
+                rewritten = true;
+            }
+        }
+        if (res != KEFIR_ITERATOR_END) {
+            REQUIRE_OK(res);
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t split_value_at_clobbers(struct split_state *state, const struct split_loop *loop,
+                                              kefir_codegen_target_ir_value_ref_t value_ref,
+                                              const struct kefir_codegen_target_ir_value_type *value_type) {
+    // A single loop-wide copy would be live across calls clobbering its register class and thus spilled again.
+    // Instead, each call-free stretch of a loop block receives its own copy: the value is reloaded from its spill
+    // slot after the call, and uses up to the next call refer to the register copy.
+    const struct kefir_codegen_target_ir_value_type copy_value_type = *value_type;
+    kefir_result_t res;
+    struct kefir_hashset_iterator iter;
+    kefir_hashset_key_t iter_key;
+    for (res = kefir_hashset_iter(&loop->blocks, &iter, &iter_key); res == KEFIR_OK;
+         res = kefir_hashset_next(&iter, &iter_key)) {
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_block_ref_t, block_ref, iter_key);
+
+        kefir_codegen_target_ir_value_ref_t copy_value_ref = {.instr_ref = KEFIR_ID_NONE, .aspect = value_ref.aspect};
+        for (kefir_codegen_target_ir_instruction_ref_t instr_ref =
+                 kefir_codegen_target_ir_code_block_control_head(state->code, block_ref);
+             instr_ref != KEFIR_ID_NONE;
+             instr_ref = kefir_codegen_target_ir_code_control_next(state->code, instr_ref)) {
+            kefir_bool_t general_purpose_clobber, floating_point_clobber;
+            REQUIRE_OK(is_clobber(state, instr_ref, &general_purpose_clobber, &floating_point_clobber));
+            if ((value_type->kind == KEFIR_CODEGEN_TARGET_IR_VALUE_TYPE_GENERAL_PURPOSE && general_purpose_clobber) ||
+                (value_type->kind != KEFIR_CODEGEN_TARGET_IR_VALUE_TYPE_GENERAL_PURPOSE && floating_point_clobber)) {
+                copy_value_ref.instr_ref = KEFIR_ID_NONE;
+                continue;
+            }
+
+            const struct kefir_codegen_target_ir_instruction *instr;
+            REQUIRE_OK(kefir_codegen_target_ir_code_instruction(state->code, instr_ref, &instr));
+            if (!kefir_hashset_has(&state->users, (kefir_hashset_key_t) instr_ref) ||
+                instr->operation.opcode == state->code->klass->phi_opcode ||
+                instr->operation.opcode == state->code->klass->upsilon_opcode) {
+                // Phi links refer to the value at the block end and keep using the spilled original
+                continue;
+            }
+
+            if (copy_value_ref.instr_ref == KEFIR_ID_NONE) {
+                REQUIRE_OK(kefir_codegen_target_ir_code_new_instruction(
+                    state->mem, state->code, block_ref,
+                    kefir_codegen_target_ir_code_control_prev(state->code, instr_ref),
+                    &(struct kefir_codegen_target_ir_operation) {
+                        .opcode = state->code->klass->assign_opcode,
+                        .parameters[0] = {.type = KEFIR_CODEGEN_TARGET_IR_OPERAND_TYPE_VALUE_REF,
+                                          .direct.value_ref = value_ref,
+                                          .direct.variant = KEFIR_CODEGEN_TARGET_IR_OPERAND_VARIANT_DEFAULT}},
+                    NULL, &copy_value_ref.instr_ref));
+                REQUIRE_OK(
+                    kefir_codegen_target_ir_code_add_aspect(state->mem, state->code, copy_value_ref, &copy_value_type));
+            }
+            REQUIRE_OK(kefir_codegen_target_ir_code_replace_value_in(state->mem, state->code, instr_ref,
+                                                                     copy_value_ref, value_ref));
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t split_value(struct split_state *state, const struct split_loop *loop,
+                                  kefir_codegen_target_ir_value_ref_t value_ref) {
+    const struct kefir_codegen_target_ir_instruction *def_instr;
+    REQUIRE_OK(kefir_codegen_target_ir_code_instruction(state->code, value_ref.instr_ref, &def_instr));
+    const struct kefir_codegen_target_ir_value_type *value_type;
+    REQUIRE_OK(kefir_codegen_target_ir_code_value_props(state->code, value_ref, &value_type));
+    const kefir_bool_t clobbered_in_loop = value_type->kind == KEFIR_CODEGEN_TARGET_IR_VALUE_TYPE_GENERAL_PURPOSE
+                                               ? loop->general_purpose_clobber
+                                               : loop->floating_point_clobber;
+    const kefir_bool_t defined_in_loop = kefir_hashset_has(&loop->blocks, (kefir_hashset_key_t) def_instr->block_ref);
+    REQUIRE(defined_in_loop || loop->preheader != KEFIR_ID_NONE, KEFIR_OK);
+
+    REQUIRE_OK(kefir_hashset_clear(state->mem, &state->users));
+    kefir_size_t loop_uses = 0;
+    kefir_codegen_target_ir_block_ref_t exit_block_ref = KEFIR_ID_NONE;
+    kefir_bool_t splittable = true;
+
+    kefir_result_t res;
+    struct kefir_codegen_target_ir_use_iterator use_iter;
+    kefir_codegen_target_ir_instruction_ref_t use_instr_ref;
+    kefir_codegen_target_ir_value_ref_t used_value_ref;
+    for (res = kefir_codegen_target_ir_code_use_iter(state->code, &use_iter, value_ref.instr_ref, &use_instr_ref,
+                                                     &used_value_ref);
+         res == KEFIR_OK && splittable;
+         res = kefir_codegen_target_ir_code_use_next(&use_iter, &use_instr_ref, &used_value_ref)) {
+        if (used_value_ref.aspect != value_ref.aspect) {
+            continue;
+        }
+
+        const struct kefir_codegen_target_ir_instruction *user_instr;
+        REQUIRE_OK(kefir_codegen_target_ir_code_instruction(state->code, use_instr_ref, &user_instr));
+        if (user_instr->operation.opcode == state->code->klass->upsilon_opcode &&
+            (user_instr->operation.parameters[1].type != KEFIR_CODEGEN_TARGET_IR_OPERAND_TYPE_VALUE_REF ||
+             KEFIR_CODEGEN_TARGET_IR_VALUE_REF_INTO(&user_instr->operation.parameters[1].direct.value_ref) !=
+                 KEFIR_CODEGEN_TARGET_IR_VALUE_REF_INTO(&value_ref))) {
+            // Upsilons refer to the target phi node, which does not constitute a use of its value
+            continue;
+        }
+        REQUIRE_OK(kefir_hashset_add(state->mem, &state->users, (kefir_hashset_key_t) use_instr_ref));
+        if (user_instr->operation.opcode == state->code->klass->phi_opcode) {
+            struct kefir_codegen_target_ir_value_phi_link_iterator link_iter;
+            kefir_codegen_target_ir_block_ref_t link_block_ref;
+            kefir_codegen_target_ir_value_ref_t link_value_ref;
+            for (res = kefir_codegen_target_ir_code_phi_link_iter(state->code, &link_iter, use_instr_ref,
+                                                                  &link_block_ref, &link_value_ref);
+                 res == KEFIR_OK && splittable;
+                 res = kefir_codegen_target_ir_code_phi_link_next(&link_iter, &link_block_ref, &link_value_ref)) {
+                if (KEFIR_CODEGEN_TARGET_IR_VALUE_REF_INTO(&link_value_ref) ==
+                    KEFIR_CODEGEN_TARGET_IR_VALUE_REF_INTO(&value_ref)) {
+                    REQUIRE_OK(classify_use(state, loop, defined_in_loop, link_block_ref, &loop_uses, &exit_block_ref,
+                                            &splittable));
+                }
+            }
+            if (res != KEFIR_ITERATOR_END) {
+                REQUIRE_OK(res);
+            }
+        } else {
+            REQUIRE_OK(classify_use(state, loop, defined_in_loop, user_instr->block_ref, &loop_uses, &exit_block_ref,
+                                    &splittable));
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    REQUIRE(splittable && loop_uses > 0, KEFIR_OK);
+    REQUIRE(!defined_in_loop || exit_block_ref != KEFIR_ID_NONE, KEFIR_OK);
+
+    // Uses within the loop are weighted to account for repeated execution: the split pays off once the loop
+    // fragment is denser than the whole live range of the value
+    struct kefir_codegen_target_ir_value_hotness_fragment global_fragment;
+    res = kefir_codegen_target_ir_hotness_get_global(&state->hotness, value_ref, &global_fragment);
+    if (res == KEFIR_NOT_FOUND) {
+        return KEFIR_OK;
+    }
+    REQUIRE_OK(res);
+    kefir_uint64_t weighted_uses = loop_uses * state->regalloc->klass->transforms->loop_split_use_weight;
+    struct kefir_codegen_target_ir_value_hotness_fragment loop_fragment = {
+        .uses = (kefir_uint32_t) MIN(weighted_uses, (kefir_uint32_t) -1),
+        .fragment_length = (kefir_uint32_t) MIN(MAX(loop->length, 1), (kefir_uint32_t) -1)};
+    REQUIRE(kefir_codegen_target_ir_value_hotness_compare(loop_fragment, global_fragment) > 0, KEFIR_OK);
+
+    if (!defined_in_loop && clobbered_in_loop) {
+        REQUIRE_OK(split_value_at_clobbers(state, loop, value_ref, value_type));
+        return KEFIR_OK;
+    }
+
+    kefir_codegen_target_ir_block_ref_t copy_block_ref;
+    kefir_codegen_target_ir_instruction_ref_t copy_after_ref;
+    if (!defined_in_loop) {
+        copy_block_ref = loop->preheader;
+        copy_after_ref = kefir_codegen_target_ir_code_control_prev(
+            state->code, kefir_codegen_target_ir_code_block_control_tail(state->code, loop->preheader));
+    } else {
+        copy_block_ref = exit_block_ref;
+        copy_after_ref = KEFIR_ID_NONE;
+        for (kefir_codegen_target_ir_instruction_ref_t instr_ref =
+                 kefir_codegen_target_ir_code_block_control_head(state->code, exit_block_ref);
+             instr_ref != KEFIR_ID_NONE;
+             instr_ref = kefir_codegen_target_ir_code_control_next(state->code, instr_ref)) {
+            const struct kefir_codegen_target_ir_instruction *instr;
+            REQUIRE_OK(kefir_codegen_target_ir_code_instruction(state->code, instr_ref, &instr));
+            if (instr->operation.opcode != state->code->klass->phi_opcode) {
+                break;
+            }
+            copy_after_ref = instr_ref;
+        }
+    }
+
+    struct kefir_codegen_target_ir_value_type copy_value_type = *value_type;
+    kefir_codegen_target_ir_value_ref_t copy_value_ref = {.aspect = value_ref.aspect};
+    REQUIRE_OK(kefir_codegen_target_ir_code_new_instruction(
+        state->mem, state->code, copy_block_ref, copy_after_ref,
+        &(struct kefir_codegen_target_ir_operation) {
+            .opcode = state->code->klass->assign_opcode,
+            .parameters[0] = {.type = KEFIR_CODEGEN_TARGET_IR_OPERAND_TYPE_VALUE_REF,
+                              .direct.value_ref = value_ref,
+                              .direct.variant = KEFIR_CODEGEN_TARGET_IR_OPERAND_VARIANT_DEFAULT}},
+        NULL, &copy_value_ref.instr_ref));
+    REQUIRE_OK(kefir_codegen_target_ir_code_add_aspect(state->mem, state->code, copy_value_ref, &copy_value_type));
+
+    struct kefir_hashset_iterator user_iter;
+    kefir_hashset_key_t user_key;
+    for (res = kefir_hashset_iter(&state->users, &user_iter, &user_key); res == KEFIR_OK;
+         res = kefir_hashset_next(&user_iter, &user_key)) {
+        ASSIGN_DECL_CAST(kefir_codegen_target_ir_instruction_ref_t, user_instr_ref, user_key);
+        const struct kefir_codegen_target_ir_instruction *user_instr;
+        REQUIRE_OK(kefir_codegen_target_ir_code_instruction(state->code, user_instr_ref, &user_instr));
+        if (user_instr->operation.opcode == state->code->klass->phi_opcode) {
+            REQUIRE_OK(rewrite_phi_links(state, loop, defined_in_loop ? exit_block_ref : KEFIR_ID_NONE,
+                                         user_instr_ref, value_ref, copy_value_ref));
+        } else {
+            kefir_bool_t in_scope;
+            REQUIRE_OK(is_in_split_scope(state, loop, defined_in_loop ? exit_block_ref : KEFIR_ID_NONE,
+                                         user_instr->block_ref, &in_scope));
+            if (in_scope) {
+                REQUIRE_OK(kefir_codegen_target_ir_code_replace_value_in(state->mem, state->code, user_instr_ref,
+                                                                         copy_value_ref, value_ref));
+            }
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t split_loop_live_ranges_impl(struct split_state *state) {
+    REQUIRE_OK(collect_candidates(state));
+    REQUIRE(kefir_list_length(&state->loops) > 0 && kefir_list_length(&state->candidates) > 0, KEFIR_OK);
+
+    REQUIRE_OK(
+        kefir_codegen_target_ir_hotness_build(state->mem, &state->hotness, state->control_flow, state->liveness));
+    for (const struct kefir_list_entry *loop_iter = kefir_list_head(&state->loops); loop_iter != NULL;
+         kefir_list_next(&loop_iter)) {
+        ASSIGN_DECL_CAST(const struct split_loop *, loop, loop_iter->value);
+        for (const struct kefir_list_entry *iter = kefir_list_head(&state->candidates); iter != NULL;
+             kefir_list_next(&iter)) {
+            REQUIRE_OK(split_value(state, loop, KEFIR_CODEGEN_TARGET_IR_VALUE_REF_FROM((kefir_uptr_t) iter->value)));
+        }
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_codegen_target_ir_transform_split_loop_live_ranges(
+    struct kefir_mem *mem, struct kefir_codegen_target_ir_code *code,
+    const struct kefir_codegen_target_ir_control_flow *control_flow,
+    const struct kefir_codegen_target_ir_liveness *liveness, const struct kefir_codegen_target_ir_regalloc *regalloc) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(code != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR code"));
+    REQUIRE(control_flow != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR control flow"));
+    REQUIRE(liveness != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR liveness"));
+    REQUIRE(regalloc != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid target IR register allocator"));
+
+    struct split_state state = {
+        .mem = mem, .code = code, .control_flow = control_flow, .liveness = liveness, .regalloc = regalloc};
+    REQUIRE_OK(kefir_codegen_target_ir_hotness_init(&state.hotness));
+    REQUIRE_OK(kefir_list_init(&state.loops));
+    REQUIRE_OK(kefir_list_on_remove(&state.loops, free_split_loop, NULL));
+    REQUIRE_OK(kefir_list_init(&state.candidates));
+    REQUIRE_OK(kefir_list_init(&state.queue));
+    REQUIRE_OK(kefir_hashset_init(&state.users, &kefir_hashtable_uint_ops));
+
+    kefir_result_t res = split_loop_live_ranges_impl(&state);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_hashset_free(mem, &state.users);
+        kefir_list_free(mem, &state.queue);
+        kefir_list_free(mem, &state.candidates);
+        kefir_list_free(mem, &state.loops);
+        kefir_codegen_target_ir_hotness_free(mem, &state.hotness);
+        return res;
+    });
+    res = kefir_hashset_free(mem, &state.users);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_list_free(mem, &state.queue);
+        kefir_list_free(mem, &state.candidates);
+        kefir_list_free(mem, &state.loops);
+        kefir_codegen_target_ir_hotness_free(mem, &state.hotness);
+        return res;
+    });
+    res = kefir_list_free(mem, &state.queue);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_list_free(mem, &state.candidates);
+        kefir_list_free(mem, &state.loops);
+        kefir_codegen_target_ir_hotness_free(mem, &state.hotness);
+        return res;
+    });
+    res = kefir_list_free(mem, &state.candidates);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_list_free(mem, &state.loops);
+        kefir_codegen_target_ir_hotness_free(mem, &state.hotness);
+        return res;
+    });
+    res = kefir_list_free(mem, &state.loops);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_codegen_target_ir_hotness_free(mem, &state.hotness);
+        return res;
+    });
+    REQUIRE_OK(kefir_codegen_target_ir_hotness_free(mem, &state.hotness));
+    return KEFIR_OK;
+}
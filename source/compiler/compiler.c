@@ -82,9 +82,13 @@ kefir_result_t kefir_compiler_context_load_predefined_defs(struct kefir_mem *mem
     REQUIRE_OK(kefir_token_buffer_init(&buffer));
     REQUIRE_OK(kefir_token_buffer_cursor_handle(&buffer, &tokens_handle));
 
+    // Predefined definitions are embedded into the compiler, thus lexing of macro replacement lists can be deferred
+    // until the first use of respective macro
+    context->preprocessor_context.defer_macro_replacement = true;
     kefir_result_t res =
         kefir_compiler_preprocess_lex(mem, context, KEFIR_PREPROCESSOR_MODE_NORMAL, &context->builtin_token_allocator,
                                       &buffer, KefirPredefinedDefs, KefirPredefinedDefsLength, filename, filename);
+    context->preprocessor_context.defer_macro_replacement = false;
     REQUIRE_CHAIN(&res, kefir_compiler_parse(mem, context, &tokens_handle, &defs_unit));
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_token_buffer_free(mem, &buffer);
@@ -148,6 +152,9 @@ kefir_result_t kefir_compiler_context_init(struct kefir_mem *mem, struct kefir_c
     context->preprocessor_context.parser_scope = &context->parser_scope;
     context->preprocessor_context.preprocessor_config = &context->preprocessor_configuration;
     context->codegen_configuration = KefirCodegenDefaultConfiguration;
+    context->codegen_output_kind = KEFIR_CODEGEN_OUTPUT_ASSEMBLY;
+    context->runtime_cache_directory = NULL;
+    context->time_report = NULL;
     context->preprocessor_context.environment.data_model = profile->ir_target_platform.data_model;
     context->profile = profile;
     context->source_locator = source_locator;
@@ -262,6 +269,9 @@ kefir_result_t kefir_compiler_preprocess(struct kefir_mem *mem, struct kefir_com
     REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid token buffer"));
     REQUIRE(content != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid content"));
 
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(context->time_report, &time_report_span));
+
     struct kefir_lexer_source_cursor source_cursor;
     struct kefir_preprocessor preprocessor;
     const struct kefir_preprocessor_source_file_info file_info = {
@@ -281,6 +291,8 @@ kefir_result_t kefir_compiler_preprocess(struct kefir_mem *mem, struct kefir_com
         return res;
     });
     REQUIRE_OK(kefir_preprocessor_free(mem, &preprocessor));
+    REQUIRE_OK(
+        kefir_time_report_end(context->time_report, &time_report_span, KEFIR_TIME_REPORT_PHASE, NULL, "preprocess"));
     return KEFIR_OK;
 }
 
@@ -295,6 +307,9 @@ kefir_result_t kefir_compiler_preprocess_lex(struct kefir_mem *mem, struct kefir
     REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid token buffer"));
     REQUIRE(content != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid content"));
 
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(context->time_report, &time_report_span));
+
     struct kefir_lexer_source_cursor source_cursor;
     struct kefir_preprocessor preprocessor;
     struct kefir_token_buffer pp_tokens;
@@ -328,6 +343,8 @@ kefir_result_t kefir_compiler_preprocess_lex(struct kefir_mem *mem, struct kefir
     });
 
     REQUIRE_OK(kefir_preprocessor_free(mem, &preprocessor));
+    REQUIRE_OK(
+        kefir_time_report_end(context->time_report, &time_report_span, KEFIR_TIME_REPORT_PHASE, NULL, "preprocess"));
     return KEFIR_OK;
 }
 
@@ -374,6 +391,9 @@ kefir_result_t kefir_compiler_lex(struct kefir_mem *mem, struct kefir_compiler_c
     REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid token buffer"));
     REQUIRE(content != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid content"));
 
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(context->time_report, &time_report_span));
+
     struct kefir_lexer_source_cursor source_cursor;
     struct kefir_lexer lexer;
     REQUIRE_OK(kefir_lexer_source_cursor_init(&source_cursor, content, length, source_id));
@@ -388,6 +408,7 @@ kefir_result_t kefir_compiler_lex(struct kefir_mem *mem, struct kefir_compiler_c
         return res;
     });
     REQUIRE_OK(kefir_lexer_free(mem, &lexer));
+    REQUIRE_OK(kefir_time_report_end(context->time_report, &time_report_span, KEFIR_TIME_REPORT_PHASE, NULL, "lex"));
     return KEFIR_OK;
 }
 
@@ -399,6 +420,9 @@ kefir_result_t kefir_compiler_parse(struct kefir_mem *mem, struct kefir_compiler
     REQUIRE(tokens_handle != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid token handle"));
     REQUIRE(unit_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer AST translation unit"));
 
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(context->time_report, &time_report_span));
+
     struct kefir_parser_token_cursor cursor;
     struct kefir_parser parser;
 
@@ -428,6 +452,7 @@ kefir_result_t kefir_compiler_parse(struct kefir_mem *mem, struct kefir_compiler
         *unit_ptr = NULL;
         return res;
     });
+    REQUIRE_OK(kefir_time_report_end(context->time_report, &time_report_span, KEFIR_TIME_REPORT_PHASE, NULL, "parse"));
     return KEFIR_OK;
 }
 
@@ -468,7 +493,12 @@ kefir_result_t kefir_compiler_analyze(struct kefir_mem *mem, struct kefir_compil
                                       struct kefir_ast_node_base *node) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(context != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid compiler context"));
+
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(context->time_report, &time_report_span));
     REQUIRE_OK(kefir_ast_analyze_node(mem, &context->ast_global_context.context, node));
+    REQUIRE_OK(
+        kefir_time_report_end(context->time_report, &time_report_span, KEFIR_TIME_REPORT_PHASE, NULL, "analyze"));
     return KEFIR_OK;
 }
 
@@ -480,6 +510,9 @@ kefir_result_t kefir_compiler_translate(struct kefir_mem *mem, struct kefir_comp
     REQUIRE(unit != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AST translation unit"));
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR module"));
 
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(context->time_report, &time_report_span));
+
     struct kefir_ast_translator_context translator_context;
     REQUIRE_OK(kefir_ast_translator_context_init(mem, &translator_context, &context->ast_global_context.context,
                                                  &context->translator_env, module,
@@ -519,6 +552,8 @@ kefir_result_t kefir_compiler_translate(struct kefir_mem *mem, struct kefir_comp
     if (compaction) {
         REQUIRE_OK(kefir_ir_module_compact(mem, module));
     }
+    REQUIRE_OK(
+        kefir_time_report_end(context->time_report, &time_report_span, KEFIR_TIME_REPORT_PHASE, NULL, "translate"));
     return KEFIR_OK;
 }
 
@@ -529,6 +564,9 @@ kefir_result_t kefir_compiler_optimize(struct kefir_mem *mem, struct kefir_compi
     REQUIRE(ir_module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR module"));
     REQUIRE(opt_module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
 
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(context->time_report, &time_report_span));
+
     REQUIRE_OK(kefir_opt_module_construct(mem, context->translator_env.target_platform, opt_module));
     struct kefir_hashtree_node_iterator iter;
     for (const struct kefir_ir_function *ir_func = kefir_ir_module_function_iter(ir_module, &iter); ir_func != NULL;
@@ -540,6 +578,8 @@ kefir_result_t kefir_compiler_optimize(struct kefir_mem *mem, struct kefir_compi
     }
     REQUIRE_OK(kefir_optimizer_pipeline_apply(mem, opt_module, &context->optimizer_configuration));
 
+    REQUIRE_OK(
+        kefir_time_report_end(context->time_report, &time_report_span, KEFIR_TIME_REPORT_PHASE, NULL, "optimize"));
     return KEFIR_OK;
 }
 
@@ -550,6 +590,9 @@ kefir_result_t kefir_compiler_codegen(struct kefir_mem *mem, struct kefir_compil
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR module"));
     REQUIRE(output != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid FILE"));
 
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(context->time_report, &time_report_span));
+
     struct kefir_compiler_codegen_runtime_hooks runtime_hooks;
     const struct kefir_codegen_runtime_hooks *runtime_hooks_ptr = NULL;
     if (context->profile->runtime_hooks_enabled) {
@@ -565,7 +608,10 @@ kefir_result_t kefir_compiler_codegen(struct kefir_mem *mem, struct kefir_compil
         context->profile->free_codegen(mem, codegen);
         return res;
     });
+    context->codegen_output_kind = codegen->output_kind;
     REQUIRE_OK(context->profile->free_codegen(mem, codegen));
+    REQUIRE_OK(
+        kefir_time_report_end(context->time_report, &time_report_span, KEFIR_TIME_REPORT_PHASE, NULL, "codegen"));
     return KEFIR_OK;
 }
 
@@ -576,6 +622,9 @@ kefir_result_t kefir_compiler_codegen_optimized(struct kefir_mem *mem, struct ke
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
     REQUIRE(output != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid FILE"));
 
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(context->time_report, &time_report_span));
+
     struct kefir_compiler_codegen_runtime_hooks runtime_hooks;
     const struct kefir_codegen_runtime_hooks *runtime_hooks_ptr = NULL;
     if (context->profile->runtime_hooks_enabled) {
@@ -591,6 +640,46 @@ kefir_result_t kefir_compiler_codegen_optimized(struct kefir_mem *mem, struct ke
         context->profile->free_codegen(mem, codegen);
         return res;
     });
+    context->codegen_output_kind = codegen->output_kind;
     REQUIRE_OK(context->profile->free_codegen(mem, codegen));
+    REQUIRE_OK(
+        kefir_time_report_end(context->time_report, &time_report_span, KEFIR_TIME_REPORT_PHASE, NULL, "codegen"));
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_compiler_codegen_streaming(struct kefir_mem *mem, struct kefir_compiler_context *context,
+                                                struct kefir_opt_module *module, FILE *output) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(context != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid compiler context"));
+    REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
+    REQUIRE(output != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid FILE"));
+
+    struct kefir_time_report_span time_report_span;
+    REQUIRE_OK(kefir_time_report_begin(context->time_report, &time_report_span));
+
+    struct kefir_compiler_codegen_runtime_hooks runtime_hooks;
+    const struct kefir_codegen_runtime_hooks *runtime_hooks_ptr = NULL;
+    if (context->profile->runtime_hooks_enabled) {
+        REQUIRE_OK(kefir_compiler_init_runtime_hooks(context, &runtime_hooks));
+        runtime_hooks_ptr = &runtime_hooks.hooks;
+    }
+
+    REQUIRE_OK(kefir_opt_module_construct_types(mem, context->translator_env.target_platform, module));
+
+    struct kefir_codegen *codegen = NULL;
+    REQUIRE_OK(
+        context->profile->new_codegen(mem, output, &context->codegen_configuration, runtime_hooks_ptr, &codegen));
+    kefir_result_t res = KEFIR_OK;
+    REQUIRE_CHAIN_SET(&res, codegen->translate_streaming != NULL,
+                      KEFIR_SET_ERROR(KEFIR_NOT_SUPPORTED, "Code generator does not support streaming translation"));
+    REQUIRE_CHAIN(&res, KEFIR_CODEGEN_TRANSLATE_STREAMING(mem, codegen, module, &context->optimizer_configuration));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        context->profile->free_codegen(mem, codegen);
+        return res;
+    });
+    context->codegen_output_kind = codegen->output_kind;
+    REQUIRE_OK(context->profile->free_codegen(mem, codegen));
+    REQUIRE_OK(
+        kefir_time_report_end(context->time_report, &time_report_span, KEFIR_TIME_REPORT_PHASE, NULL, "codegen"));
     return KEFIR_OK;
 }
@@ -45,6 +45,7 @@ kefir_result_t kefir_compiler_runner_configuration_init(struct kefir_compiler_ru
     *options = (struct kefir_compiler_runner_configuration) {
         .action = KEFIR_COMPILER_RUNNER_ACTION_DUMP_ASSEMBLY,
         .error_report_type = KEFIR_COMPILER_RUNNER_ERROR_REPORT_TABULAR,
+        .time_report = KEFIR_COMPILER_RUNNER_TIME_REPORT_NONE,
         .skip_preprocessor = false,
         .default_pp_timestamp = true,
         .debug_info = false,
@@ -61,16 +62,26 @@ kefir_result_t kefir_compiler_runner_configuration_init(struct kefir_compiler_ru
                     .position_independent_code = false,
                     .omit_frame_pointer = false,
                     .valgrind_compatible_x87 = true,
+                    .integrated_assembler = false,
+                    .code_layout = false,
+                    .red_zone = false,
+                    .shrink_wrap = false,
+                    .live_range_split = false,
+                    .inline_memory_builtins = false,
+                    .streaming = false,
                     .tentative_definition_placement = KEFIR_AST_CONTEXT_TENTATIVE_DEFINITION_PLACEMENT_DEFAULT,
                     .symbol_visibility = KEFIR_AST_DECLARATOR_VISIBILITY_UNSET,
                     .syntax = NULL,
                     .print_details = NULL,
+                    .runtime_cache_directory = NULL,
                     .optimization = KEFIR_CODEGEN_OPTIMIZATION_FULL},
         .optimizer_pipeline_spec = NULL,
         .optimizer = {.max_inline_depth = 5,
                       .max_inlines_per_function = 10,
+                      .max_inline_cost = 0,
                       .disable_lowering = false,
-                      .cx_limited_range = false},
+                      .cx_limited_range = false,
+                      .strict_aliasing = true},
         .dependency_output = {.target_name = NULL,
                               .output_filename = NULL,
                               .output_system_deps = true,
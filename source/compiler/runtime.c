@@ -18,10 +18,21 @@
     along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include "kefir/core/platform.h"
+#if defined(KEFIR_LINUX_HOST_PLATFORM)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "kefir/compiler/compiler.h"
 #include "kefir/codegen/codegen.h"
 #include "kefir/core/error.h"
 #include "kefir/core/util.h"
+#include "kefir/core/os_error.h"
+#include "kefir/core/version.h"
+#include <limits.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 static const char KeifrCodegenInlineRuntime[] = {
 #include STRINGIFY(KEFIR_COMPILER_RUNTIME_KEFIR_BIGINT_INCLUDE)
@@ -30,6 +41,19 @@ static const char KeifrCodegenInlineRuntime[] = {
     , 0};
 static kefir_uint64_t KeifrCodegenInlineRuntimeLength = sizeof(KeifrCodegenInlineRuntime);
 
+#define KEFIR_RUNTIME_SYMBOL_PREFIX "__kefir_runtime"
+#define KEFIR_RUNTIME_FUNCTION_LABEL_PREFIX ".L" KEFIR_RUNTIME_SYMBOL_PREFIX "_text_func_"
+#define KEFIR_RUNTIME_CONSTANT_LABEL_PREFIX ".L" KEFIR_RUNTIME_SYMBOL_PREFIX "_constant_"
+
+#define KEFIR_RUNTIME_CACHE_HASH_INIT 0xcbf29ce484222325ull
+static kefir_uint64_t cache_hash(kefir_uint64_t hash, const char *content, kefir_size_t length) {
+    for (kefir_size_t i = 0; i < length; i++) {
+        hash ^= (kefir_uint8_t) content[i];
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
 static kefir_result_t source_locator_open(struct kefir_mem *mem,
                                           const struct kefir_preprocessor_source_locator *locator,
                                           const char *include_file, kefir_bool_t system,
@@ -125,14 +149,9 @@ static kefir_result_t generate_runtime_functions_impl(struct kefir_mem *mem, FIL
     return KEFIR_OK;
 }
 
-static kefir_result_t generate_runtime_functions(struct kefir_mem *mem, FILE *output,
-                                                 const struct kefir_hashtreeset *functions, void *payload) {
-    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
-    REQUIRE(output != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid output file"));
-    REQUIRE(functions != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid set of runtime functions"));
-    ASSIGN_DECL_CAST(const struct kefir_compiler_codegen_runtime_hooks *, hooks, payload);
-    REQUIRE(hooks != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid compiler runtime hooks"));
-
+static kefir_result_t compile_runtime_functions(struct kefir_mem *mem, FILE *output,
+                                                const struct kefir_hashtreeset *functions,
+                                                const struct kefir_compiler_codegen_runtime_hooks *hooks) {
     struct kefir_preprocessor_source_locator source_locator;
     source_locator.open = source_locator_open;
     source_locator.payload = NULL;
@@ -147,7 +166,10 @@ static kefir_result_t generate_runtime_functions(struct kefir_mem *mem, FILE *ou
     context.codegen_configuration = hooks->compiler_context->codegen_configuration;
     context.codegen_configuration.debug_info = false;
     context.codegen_configuration.runtime_function_generator_mode = true;
-    context.codegen_configuration.symbol_prefix = "__kefir_runtime";
+    context.codegen_configuration.integrated_assembler = false;
+    context.codegen_configuration.symbol_prefix = KEFIR_RUNTIME_SYMBOL_PREFIX;
+    context.codegen_configuration.time_report = NULL;
+    context.translator_configuration.strict_aliasing = false;
 
     kefir_result_t res = kefir_optimizer_configuration_copy_from(mem, &context.optimizer_configuration,
                                                                  &hooks->compiler_context->optimizer_configuration);
@@ -161,6 +183,682 @@ static kefir_result_t generate_runtime_functions(struct kefir_mem *mem, FILE *ou
     return KEFIR_OK;
 }
 
+static kefir_result_t format_cache_key(FILE *output, const struct kefir_compiler_codegen_runtime_hooks *hooks) {
+    const struct kefir_compiler_context *context = hooks->compiler_context;
+    const struct kefir_codegen_configuration *codegen_config = &context->codegen_configuration;
+    const struct kefir_optimizer_configuration *optimizer_config = &context->optimizer_configuration;
+
+    fprintf(output, "kefir %s\n", KEFIR_VERSION_FULL);
+    fprintf(output, "runtime %016" KEFIR_UINT64_XFMT "\n",
+            cache_hash(KEFIR_RUNTIME_CACHE_HASH_INIT, KeifrCodegenInlineRuntime, KeifrCodegenInlineRuntimeLength));
+    fprintf(output, "data-model %d %d\n", (int) context->profile->type_traits.data_model->model,
+            (int) context->profile->type_traits.character_type_signedness);
+    fprintf(output, "codegen %d %d %d %d %d %d %d %d %d %d %d %s %s\n", (int) codegen_config->emulated_tls,
+            (int) codegen_config->position_independent_code, (int) codegen_config->omit_frame_pointer,
+            (int) codegen_config->valgrind_compatible_x87, (int) codegen_config->code_layout,
+            (int) codegen_config->red_zone, (int) codegen_config->shrink_wrap, (int) codegen_config->live_range_split,
+            (int) codegen_config->inline_memory_builtins, (int) codegen_config->streaming,
+            (int) codegen_config->optimization, codegen_config->syntax != NULL ? codegen_config->syntax : "-",
+            codegen_config->print_details != NULL ? codegen_config->print_details : "-");
+    fprintf(output, "optimizer %" KEFIR_SIZE_FMT " %" KEFIR_SIZE_FMT " %" KEFIR_SIZE_FMT " %" KEFIR_SIZE_FMT " %d",
+            optimizer_config->max_inline_depth, optimizer_config->max_inlines_per_function,
+            optimizer_config->max_inline_cost, optimizer_config->imprecise_decimal_bitint_conv,
+            (int) optimizer_config->decimal_encoding);
+    for (const struct kefir_list_entry *iter = kefir_list_head(&optimizer_config->pipeline.pipeline); iter != NULL;
+         kefir_list_next(&iter)) {
+        ASSIGN_DECL_CAST(const struct kefir_optimizer_pass *, pass, iter->value);
+        fprintf(output, " %s", pass->name);
+    }
+    fprintf(output, "\n");
+    return KEFIR_OK;
+}
+
+// Runtime cache holds separate entries for the assembly prologue, each generated runtime function and each module
+// constant referenced by the functions. Every entry lists entries it requires, thus a set of runtime functions can be
+// assembled from entries populated by different translation units. Entry file consists of the cache key, entry
+// identifier, list of required entries, and content length, followed by the content:
+//
+//      <cache key>
+//      entry <kind> <name>
+//      requires <kind> <name>
+//      content <length>
+//      <content>
+struct runtime_cache {
+    const char *directory;
+    const char *key;
+    kefir_size_t key_length;
+};
+
+struct runtime_cache_entry {
+    char *buffer;
+    const char *requires;
+    kefir_size_t requires_length;
+    const char *content;
+    kefir_size_t content_length;
+};
+
+static kefir_result_t runtime_cache_entry_path(const struct runtime_cache *cache, const char *entry,
+                                               kefir_size_t entry_length, char *filepath, kefir_size_t filepath_size,
+                                               kefir_bool_t *valid) {
+    kefir_uint64_t hash = cache_hash(KEFIR_RUNTIME_CACHE_HASH_INIT, cache->key, cache->key_length);
+    hash = cache_hash(hash, entry, entry_length);
+    int rc = snprintf(filepath, filepath_size, "%s/runtime-%016" KEFIR_UINT64_XFMT ".s", cache->directory, hash);
+    *valid = rc >= 0 && (size_t) rc < filepath_size;
+    return KEFIR_OK;
+}
+
+static kefir_result_t read_cache_file(struct kefir_mem *mem, const char *filepath, char **buffer_ptr,
+                                      kefir_size_t *length_ptr) {
+    *buffer_ptr = NULL;
+    *length_ptr = 0;
+    FILE *cache_file = fopen(filepath, "r");
+    REQUIRE(cache_file != NULL, KEFIR_OK);
+
+    char *buffer = NULL;
+    kefir_size_t length = 0, capacity = 0;
+    for (;;) {
+        if (length == capacity) {
+            capacity = MAX(capacity * 2, 4096);
+            char *new_buffer = KEFIR_REALLOC(mem, buffer, capacity + 1);
+            REQUIRE_ELSE(new_buffer != NULL, {
+                KEFIR_FREE(mem, buffer);
+                fclose(cache_file);
+                return KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate runtime cache entry");
+            });
+            buffer = new_buffer;
+        }
+        const size_t read = fread(buffer + length, 1, capacity - length, cache_file);
+        if (read == 0) {
+            break;
+        }
+        length += read;
+    }
+    const kefir_bool_t failed = ferror(cache_file);
+    fclose(cache_file);
+    REQUIRE_ELSE(!failed, {
+        KEFIR_FREE(mem, buffer);
+        return KEFIR_OK;
+    });
+
+    buffer[length] = '\0';
+    *buffer_ptr = buffer;
+    *length_ptr = length;
+    return KEFIR_OK;
+}
+
+static kefir_bool_t consume_prefix(const char **position, const char *end, const char *prefix,
+                                   kefir_size_t prefix_length) {
+    if ((kefir_size_t) (end - *position) < prefix_length || memcmp(*position, prefix, prefix_length) != 0) {
+        return false;
+    }
+    *position += prefix_length;
+    return true;
+}
+
+static kefir_result_t load_cache_entry(struct kefir_mem *mem, const struct runtime_cache *cache, const char *entry,
+                                       struct runtime_cache_entry *cache_entry, kefir_bool_t *loaded) {
+    *loaded = false;
+    const kefir_size_t entry_length = strlen(entry);
+    char filepath[PATH_MAX + 1];
+    kefir_bool_t valid_path;
+    REQUIRE_OK(runtime_cache_entry_path(cache, entry, entry_length, filepath, sizeof(filepath), &valid_path));
+    REQUIRE(valid_path, KEFIR_OK);
+
+    char *buffer;
+    kefir_size_t length;
+    REQUIRE_OK(read_cache_file(mem, filepath, &buffer, &length));
+    REQUIRE(buffer != NULL, KEFIR_OK);
+
+    // Entries produced by different compiler configuration, colliding entries and truncated or otherwise damaged
+    // entries are treated as absent
+    const char *position = buffer;
+    const char *end = buffer + length;
+    kefir_bool_t valid = consume_prefix(&position, end, cache->key, cache->key_length) &&
+                         consume_prefix(&position, end, "entry ", 6) &&
+                         consume_prefix(&position, end, entry, entry_length) && consume_prefix(&position, end, "\n", 1);
+    const char *requires = position;
+    while (valid && consume_prefix(&position, end, "requires ", 9)) {
+        const char *line_end = memchr(position, '\n', end - position);
+        valid = line_end != NULL;
+        position = valid ? line_end + 1 : end;
+    }
+    const char *requires_end = position;
+    valid = valid && consume_prefix(&position, end, "content ", 8);
+    char *length_end = NULL;
+    const unsigned long long content_length = valid ? strtoull(position, &length_end, 10) : 0;
+    valid = valid && length_end != position && *length_end == '\n' &&
+            content_length == (unsigned long long) (end - length_end - 1);
+    REQUIRE_ELSE(valid, {
+        KEFIR_FREE(mem, buffer);
+        return KEFIR_OK;
+    });
+
+    cache_entry->buffer = buffer;
+    cache_entry->requires = requires;
+    cache_entry->requires_length = requires_end - requires;
+    cache_entry->content = length_end + 1;
+    cache_entry->content_length = content_length;
+    *loaded = true;
+    return KEFIR_OK;
+}
+
+struct runtime_cache_closure {
+    struct kefir_hashtree entries;
+    struct kefir_list order;
+};
+
+static kefir_result_t free_closure_entry(struct kefir_mem *mem, struct kefir_hashtree *tree, kefir_hashtree_key_t key,
+                                         kefir_hashtree_value_t value, void *payload) {
+    UNUSED(tree);
+    UNUSED(payload);
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    ASSIGN_DECL_CAST(char *, entry, key);
+    ASSIGN_DECL_CAST(struct runtime_cache_entry *, cache_entry, value);
+
+    if (cache_entry != NULL) {
+        KEFIR_FREE(mem, cache_entry->buffer);
+        KEFIR_FREE(mem, cache_entry);
+    }
+    KEFIR_FREE(mem, entry);
+    return KEFIR_OK;
+}
+
+static kefir_result_t closure_enqueue(struct kefir_mem *mem, struct runtime_cache_closure *closure,
+                                      const char *entry, kefir_size_t entry_length) {
+    char *entry_copy = KEFIR_MALLOC(mem, entry_length + 1);
+    REQUIRE(entry_copy != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate runtime cache entry"));
+    memcpy(entry_copy, entry, entry_length);
+    entry_copy[entry_length] = '\0';
+    if (kefir_hashtree_has(&closure->entries, (kefir_hashtree_key_t) entry_copy)) {
+        KEFIR_FREE(mem, entry_copy);
+        return KEFIR_OK;
+    }
+
+    kefir_result_t res = kefir_hashtree_insert(mem, &closure->entries, (kefir_hashtree_key_t) entry_copy,
+                                               (kefir_hashtree_value_t) NULL);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(mem, entry_copy);
+        return res;
+    });
+    REQUIRE_OK(kefir_list_insert_after(mem, &closure->order, kefir_list_tail(&closure->order), entry_copy));
+    return KEFIR_OK;
+}
+
+static kefir_result_t load_closure(struct kefir_mem *mem, const struct runtime_cache *cache,
+                                   const struct kefir_hashtreeset *functions, struct runtime_cache_closure *closure,
+                                   kefir_bool_t *loaded) {
+    *loaded = false;
+    REQUIRE_OK(closure_enqueue(mem, closure, "prologue", 8));
+
+    kefir_result_t res;
+    struct kefir_hashtreeset_iterator iter;
+    for (res = kefir_hashtreeset_iter(functions, &iter); res == KEFIR_OK; res = kefir_hashtreeset_next(&iter)) {
+        ASSIGN_DECL_CAST(const char *, function_name, iter.entry);
+        char entry[PATH_MAX + 1];
+        int rc = snprintf(entry, sizeof(entry), "function %s", function_name);
+        REQUIRE(rc >= 0 && (size_t) rc < sizeof(entry), KEFIR_OK);
+        REQUIRE_OK(closure_enqueue(mem, closure, entry, rc));
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+
+    // Order list grows as required entries are discovered
+    for (const struct kefir_list_entry *iter = kefir_list_head(&closure->order); iter != NULL;
+         kefir_list_next(&iter)) {
+        ASSIGN_DECL_CAST(const char *, entry, iter->value);
+        struct kefir_hashtree_node *node;
+        REQUIRE_OK(kefir_hashtree_at(&closure->entries, (kefir_hashtree_key_t) entry, &node));
+
+        struct runtime_cache_entry cache_entry;
+        kefir_bool_t entry_loaded;
+        REQUIRE_OK(load_cache_entry(mem, cache, entry, &cache_entry, &entry_loaded));
+        REQUIRE(entry_loaded, KEFIR_OK);
+        struct runtime_cache_entry *cache_entry_ptr = KEFIR_MALLOC(mem, sizeof(struct runtime_cache_entry));
+        REQUIRE_ELSE(cache_entry_ptr != NULL, {
+            KEFIR_FREE(mem, cache_entry.buffer);
+            return KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate runtime cache entry");
+        });
+        *cache_entry_ptr = cache_entry;
+        node->value = (kefir_hashtree_value_t) cache_entry_ptr;
+
+        const char *position = cache_entry.requires;
+        const char *end = cache_entry.requires + cache_entry.requires_length;
+        while (position < end) {
+            const char *line_end = memchr(position, '\n', end - position);
+            REQUIRE_OK(closure_enqueue(mem, closure, position + 9, line_end - position - 9));
+            position = line_end + 1;
+        }
+    }
+    *loaded = true;
+    return KEFIR_OK;
+}
+
+static kefir_result_t write_closure(const struct runtime_cache_closure *closure, FILE *output,
+                                    kefir_bool_t constants) {
+    for (const struct kefir_list_entry *iter = kefir_list_head(&closure->order); iter != NULL;
+         kefir_list_next(&iter)) {
+        ASSIGN_DECL_CAST(const char *, entry, iter->value);
+        if ((strncmp(entry, "constant ", 9) == 0) != constants) {
+            continue;
+        }
+        struct kefir_hashtree_node *node;
+        REQUIRE_OK(kefir_hashtree_at(&closure->entries, (kefir_hashtree_key_t) entry, &node));
+        ASSIGN_DECL_CAST(const struct runtime_cache_entry *, cache_entry, node->value);
+        REQUIRE(fwrite(cache_entry->content, 1, cache_entry->content_length, output) == cache_entry->content_length,
+                KEFIR_SET_OS_ERROR("Failed to write cached runtime functions"));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t load_cached_runtime(struct kefir_mem *mem, const struct runtime_cache *cache,
+                                          const struct kefir_hashtreeset *functions, FILE *output,
+                                          kefir_bool_t *loaded) {
+    struct runtime_cache_closure closure;
+    REQUIRE_OK(kefir_hashtree_init(&closure.entries, &kefir_hashtree_str_ops));
+    REQUIRE_OK(kefir_hashtree_on_removal(&closure.entries, free_closure_entry, NULL));
+    REQUIRE_OK(kefir_list_init(&closure.order));
+
+    // Constants switch the output into read-only data section, thus these are written after all functions
+    kefir_result_t res = load_closure(mem, cache, functions, &closure, loaded);
+    if (res == KEFIR_OK && *loaded) {
+        REQUIRE_CHAIN(&res, write_closure(&closure, output, false));
+        REQUIRE_CHAIN(&res, write_closure(&closure, output, true));
+    }
+    kefir_list_free(mem, &closure.order);
+    kefir_hashtree_free(mem, &closure.entries);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
+struct runtime_cache_fragment {
+    const char *name;
+    kefir_size_t name_length;
+    const char *begin;
+    const char *end;
+};
+
+struct runtime_cache_fragments {
+    struct runtime_cache_fragment *fragments;
+    kefir_size_t length;
+    kefir_size_t capacity;
+};
+
+struct runtime_cache_layout {
+    const char *prologue_end;
+    const char *section_begin;
+    const char *section_end;
+    struct runtime_cache_fragments functions;
+    struct runtime_cache_fragments constants;
+};
+
+static kefir_result_t fragments_append(struct kefir_mem *mem, struct runtime_cache_fragments *fragments,
+                                       const struct runtime_cache_fragment *fragment) {
+    if (fragments->length == fragments->capacity) {
+        const kefir_size_t new_capacity = MAX(fragments->capacity * 2, 32);
+        struct runtime_cache_fragment *new_fragments =
+            KEFIR_REALLOC(mem, fragments->fragments, sizeof(struct runtime_cache_fragment) * new_capacity);
+        REQUIRE(new_fragments != NULL,
+                KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate runtime cache layout"));
+        fragments->fragments = new_fragments;
+        fragments->capacity = new_capacity;
+    }
+    fragments->fragments[fragments->length++] = *fragment;
+    return KEFIR_OK;
+}
+
+static const char *line_end_of(const char *position, const char *end) {
+    const char *line_end = memchr(position, '\n', end - position);
+    return line_end != NULL ? line_end : end;
+}
+
+static const char *next_line_of(const char *position, const char *end) {
+    const char *line_end = line_end_of(position, end);
+    return line_end < end ? line_end + 1 : end;
+}
+
+static kefir_bool_t is_blank_line(const char *position, const char *end) {
+    return line_end_of(position, end) == position;
+}
+
+static kefir_bool_t is_directive_line(const char *position, const char *end, const char *directive) {
+    const char *line_end = line_end_of(position, end);
+    for (; position < line_end && (*position == ' ' || *position == '\t'); position++)
+        ;
+    return consume_prefix(&position, line_end, directive, strlen(directive));
+}
+
+static kefir_bool_t is_label_line(const char *position, const char *end, const char *prefix, const char *name,
+                                  kefir_size_t name_length, const char *suffix) {
+    const char *line_end = line_end_of(position, end);
+    return consume_prefix(&position, line_end, prefix, strlen(prefix)) &&
+           consume_prefix(&position, line_end, name, name_length) &&
+           consume_prefix(&position, line_end, suffix, strlen(suffix)) && position == line_end;
+}
+
+static kefir_bool_t function_begins_at(const char *position, const char *end,
+                                       struct runtime_cache_fragment *fragment) {
+    const char *line_end = line_end_of(position, end);
+    if (line_end == position || line_end == end || line_end[-1] != ':' || *position == '.' || *position == ' ' ||
+        *position == '\t') {
+        return false;
+    }
+    fragment->name = position;
+    fragment->name_length = line_end - position - 1;
+    return is_label_line(line_end + 1, end, KEFIR_RUNTIME_FUNCTION_LABEL_PREFIX, fragment->name,
+                         fragment->name_length, "_begin:");
+}
+
+static kefir_bool_t constant_begins_at(const char *position, const char *end,
+                                       struct runtime_cache_fragment *fragment) {
+    if (!is_directive_line(position, end, ".align")) {
+        return false;
+    }
+    const char *label = next_line_of(position, end);
+    const char *label_end = line_end_of(label, end);
+    const char *label_position = label;
+    if (label_end == label || label_end[-1] != ':' ||
+        !consume_prefix(&label_position, label_end, KEFIR_RUNTIME_CONSTANT_LABEL_PREFIX,
+                        strlen(KEFIR_RUNTIME_CONSTANT_LABEL_PREFIX))) {
+        return false;
+    }
+    fragment->name = label;
+    fragment->name_length = label_end - label - 1;
+    return true;
+}
+
+static kefir_result_t split_runtime(struct kefir_mem *mem, const char *content, kefir_size_t length,
+                                    struct runtime_cache_layout *layout, kefir_bool_t *split) {
+    // Generated runtime consists of a prologue, code of each function followed by its local read-only data, and
+    // module constants. Output that does not match the layout is not cached.
+    *split = false;
+    const char *position = content;
+    const char *end = content + length;
+    struct runtime_cache_fragment fragment;
+    for (; position < end && !function_begins_at(position, end, &fragment); position = next_line_of(position, end))
+        ;
+    REQUIRE(position < end, KEFIR_OK);
+    layout->prologue_end = position;
+
+    while (position < end && function_begins_at(position, end, &fragment)) {
+        fragment.begin = position;
+        for (; position < end && !is_label_line(position, end, KEFIR_RUNTIME_FUNCTION_LABEL_PREFIX, fragment.name,
+                                                fragment.name_length, "_end:");
+             position = next_line_of(position, end))
+            ;
+        REQUIRE(position < end, KEFIR_OK);
+        position = next_line_of(position, end);
+        if (position < end && is_directive_line(position, end, ".section")) {
+            for (position = next_line_of(position, end);
+                 position < end && !is_directive_line(position, end, ".section");
+                 position = next_line_of(position, end))
+                ;
+            REQUIRE(position < end, KEFIR_OK);
+            position = next_line_of(position, end);
+        }
+        fragment.end = position;
+        REQUIRE_OK(fragments_append(mem, &layout->functions, &fragment));
+        for (; position < end && is_blank_line(position, end); position = next_line_of(position, end))
+            ;
+    }
+
+    if (position < end) {
+        REQUIRE(is_directive_line(position, end, ".section"), KEFIR_OK);
+        layout->section_begin = position;
+        layout->section_end = position = next_line_of(position, end);
+        while (position < end) {
+            REQUIRE(constant_begins_at(position, end, &fragment), KEFIR_OK);
+            fragment.begin = position;
+            for (position = next_line_of(next_line_of(position, end), end);
+                 position < end && !is_blank_line(position, end) &&
+                 !constant_begins_at(position, end, &(struct runtime_cache_fragment) {0});
+                 position = next_line_of(position, end))
+                ;
+            fragment.end = position;
+            REQUIRE_OK(fragments_append(mem, &layout->constants, &fragment));
+            for (; position < end && is_blank_line(position, end); position = next_line_of(position, end))
+                ;
+        }
+    }
+    *split = true;
+    return KEFIR_OK;
+}
+
+static kefir_bool_t is_symbol_char(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '.' ||
+           c == '$';
+}
+
+static kefir_bool_t find_fragment(const struct runtime_cache_fragments *fragments, const char *name,
+                                  kefir_size_t name_length, kefir_size_t *index) {
+    for (kefir_size_t i = 0; i < fragments->length; i++) {
+        if (fragments->fragments[i].name_length == name_length &&
+            memcmp(fragments->fragments[i].name, name, name_length) == 0) {
+            *index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static kefir_result_t collect_requirements(const struct runtime_cache_layout *layout,
+                                           const struct runtime_cache_fragment *function, kefir_bool_t *functions,
+                                           kefir_bool_t *constants, kefir_bool_t *valid) {
+    *valid = false;
+    memset(functions, 0, sizeof(kefir_bool_t) * layout->functions.length);
+    memset(constants, 0, sizeof(kefir_bool_t) * layout->constants.length);
+    for (const char *position = function->begin; position < function->end;) {
+        if (!is_symbol_char(*position)) {
+            position++;
+            continue;
+        }
+        const char *symbol = position;
+        for (; position < function->end && is_symbol_char(*position); position++)
+            ;
+        const kefir_size_t symbol_length = position - symbol;
+
+        kefir_size_t index;
+        const char *symbol_position = symbol;
+        if (consume_prefix(&symbol_position, position, KEFIR_RUNTIME_CONSTANT_LABEL_PREFIX,
+                           strlen(KEFIR_RUNTIME_CONSTANT_LABEL_PREFIX))) {
+            REQUIRE(find_fragment(&layout->constants, symbol, symbol_length, &index), KEFIR_OK);
+            constants[index] = true;
+        } else if (find_fragment(&layout->functions, symbol, symbol_length, &index) &&
+                   &layout->functions.fragments[index] != function) {
+            functions[index] = true;
+        }
+    }
+    *valid = true;
+    return KEFIR_OK;
+}
+
+static void store_cache_file(const char *directory, const char *filepath, const char *content,
+                             kefir_size_t length) {
+    // Cache is populated on the best-effort basis: failures only cause subsequent cache misses
+    mkdir(directory, 0755);
+
+    char tmp_filepath[PATH_MAX + 1];
+    int rc = snprintf(tmp_filepath, sizeof(tmp_filepath), "%s.%ld.tmp", filepath, (long) getpid());
+    if (rc < 0 || (size_t) rc >= sizeof(tmp_filepath)) {
+        return;
+    }
+
+    FILE *cache_file = fopen(tmp_filepath, "w");
+    if (cache_file == NULL) {
+        return;
+    }
+    kefir_bool_t success = fwrite(content, 1, length, cache_file) == length;
+    success = fclose(cache_file) == 0 && success;
+    if (!success || rename(tmp_filepath, filepath) != 0) {
+        remove(tmp_filepath);
+    }
+}
+
+static kefir_result_t store_cache_entry(const struct runtime_cache *cache, const char *entry_kind,
+                                        const struct runtime_cache_fragment *entry_fragment,
+                                        const struct runtime_cache_layout *layout, const kefir_bool_t *functions,
+                                        const kefir_bool_t *constants, const char *section_begin,
+                                        const char *section_end, const char *begin, const char *end) {
+    char *entry = NULL;
+    size_t entry_length = 0;
+    FILE *entry_stream = open_memstream(&entry, &entry_length);
+    REQUIRE(entry_stream != NULL, KEFIR_SET_OS_ERROR("Failed to construct in-memory file"));
+    if (entry_fragment != NULL) {
+        fprintf(entry_stream, "%s %.*s", entry_kind, (int) entry_fragment->name_length, entry_fragment->name);
+    } else {
+        fprintf(entry_stream, "%s", entry_kind);
+    }
+    fclose(entry_stream);
+
+    char *content = NULL;
+    size_t content_length = 0;
+    FILE *content_stream = open_memstream(&content, &content_length);
+    REQUIRE_ELSE(content_stream != NULL, {
+        free(entry);
+        return KEFIR_SET_OS_ERROR("Failed to construct in-memory file");
+    });
+    fwrite(cache->key, 1, cache->key_length, content_stream);
+    fprintf(content_stream, "entry %s\n", entry);
+    for (kefir_size_t i = 0; functions != NULL && i < layout->functions.length; i++) {
+        if (functions[i]) {
+            fprintf(content_stream, "requires function %.*s\n", (int) layout->functions.fragments[i].name_length,
+                    layout->functions.fragments[i].name);
+        }
+    }
+    for (kefir_size_t i = 0; constants != NULL && i < layout->constants.length; i++) {
+        if (constants[i]) {
+            fprintf(content_stream, "requires constant %.*s\n", (int) layout->constants.fragments[i].name_length,
+                    layout->constants.fragments[i].name);
+        }
+    }
+    fprintf(content_stream, "content %" KEFIR_SIZE_FMT "\n",
+            (kefir_size_t) ((section_end - section_begin) + (end - begin)));
+    fwrite(section_begin, 1, section_end - section_begin, content_stream);
+    fwrite(begin, 1, end - begin, content_stream);
+    fclose(content_stream);
+
+    char filepath[PATH_MAX + 1];
+    kefir_bool_t valid_path;
+    kefir_result_t res =
+        runtime_cache_entry_path(cache, entry, entry_length, filepath, sizeof(filepath), &valid_path);
+    if (res == KEFIR_OK && valid_path) {
+        store_cache_file(cache->directory, filepath, content, content_length);
+    }
+    free(entry);
+    free(content);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
+static kefir_result_t store_cached_runtime_impl(struct kefir_mem *mem, const struct runtime_cache *cache,
+                                                const char *content, kefir_size_t length,
+                                                struct runtime_cache_layout *layout) {
+    kefir_bool_t split;
+    REQUIRE_OK(split_runtime(mem, content, length, layout, &split));
+    REQUIRE(split, KEFIR_OK);
+
+    kefir_bool_t *functions = KEFIR_MALLOC(mem, sizeof(kefir_bool_t) * layout->functions.length);
+    kefir_bool_t *constants = KEFIR_MALLOC(mem, sizeof(kefir_bool_t) * (layout->constants.length + 1));
+    kefir_result_t res = KEFIR_OK;
+    if (functions == NULL || constants == NULL) {
+        res = KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate runtime cache requirements");
+    }
+
+    // Requirements of all functions are validated before anything is stored
+    kefir_bool_t valid = true;
+    for (kefir_size_t i = 0; res == KEFIR_OK && valid && i < layout->functions.length; i++) {
+        res = collect_requirements(layout, &layout->functions.fragments[i], functions, constants, &valid);
+    }
+    if (res == KEFIR_OK && valid) {
+        REQUIRE_CHAIN(&res, store_cache_entry(cache, "prologue", NULL, layout, NULL, NULL, content, content, content,
+                                              layout->prologue_end));
+        for (kefir_size_t i = 0; res == KEFIR_OK && i < layout->functions.length; i++) {
+            const struct runtime_cache_fragment *fragment = &layout->functions.fragments[i];
+            REQUIRE_CHAIN(&res, collect_requirements(layout, fragment, functions, constants, &valid));
+            REQUIRE_CHAIN(&res, store_cache_entry(cache, "function", fragment, layout, functions, constants,
+                                                  fragment->begin, fragment->begin, fragment->begin, fragment->end));
+        }
+        for (kefir_size_t i = 0; res == KEFIR_OK && i < layout->constants.length; i++) {
+            const struct runtime_cache_fragment *fragment = &layout->constants.fragments[i];
+            REQUIRE_CHAIN(&res, store_cache_entry(cache, "constant", fragment, layout, NULL, NULL,
+                                                  layout->section_begin, layout->section_end, fragment->begin,
+                                                  fragment->end));
+        }
+    }
+    KEFIR_FREE(mem, functions);
+    KEFIR_FREE(mem, constants);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
+static kefir_result_t store_cached_runtime(struct kefir_mem *mem, const struct runtime_cache *cache,
+                                           const char *content, kefir_size_t length) {
+    struct runtime_cache_layout layout = {0};
+    kefir_result_t res = store_cached_runtime_impl(mem, cache, content, length, &layout);
+    KEFIR_FREE(mem, layout.functions.fragments);
+    KEFIR_FREE(mem, layout.constants.fragments);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
+static kefir_result_t generate_cached_runtime_functions(struct kefir_mem *mem, FILE *output,
+                                                        const struct kefir_hashtreeset *functions,
+                                                        const struct kefir_compiler_codegen_runtime_hooks *hooks,
+                                                        const struct runtime_cache *cache) {
+    kefir_bool_t loaded;
+    REQUIRE_OK(load_cached_runtime(mem, cache, functions, output, &loaded));
+    REQUIRE(!loaded, KEFIR_OK);
+
+    // On cache miss, the whole requested set of functions is generated at once and emitted as is. Generated code is
+    // then split into separate entries for subsequent reuse.
+    char *content = NULL;
+    size_t length = 0;
+    FILE *content_stream = open_memstream(&content, &length);
+    REQUIRE(content_stream != NULL, KEFIR_SET_OS_ERROR("Failed to construct in-memory file"));
+    kefir_result_t res = compile_runtime_functions(mem, content_stream, functions, hooks);
+    fclose(content_stream);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        free(content);
+        return res;
+    });
+
+    REQUIRE_ELSE(fwrite(content, 1, length, output) == length, {
+        free(content);
+        return KEFIR_SET_OS_ERROR("Failed to write runtime functions");
+    });
+    res = store_cached_runtime(mem, cache, content, length);
+    free(content);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
+static kefir_result_t generate_runtime_functions(struct kefir_mem *mem, FILE *output,
+                                                 const struct kefir_hashtreeset *functions, void *payload) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(output != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid output file"));
+    REQUIRE(functions != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid set of runtime functions"));
+    ASSIGN_DECL_CAST(const struct kefir_compiler_codegen_runtime_hooks *, hooks, payload);
+    REQUIRE(hooks != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid compiler runtime hooks"));
+
+    if (hooks->compiler_context->runtime_cache_directory == NULL) {
+        REQUIRE_OK(compile_runtime_functions(mem, output, functions, hooks));
+        return KEFIR_OK;
+    }
+
+    char *key = NULL;
+    size_t key_length = 0;
+    FILE *key_stream = open_memstream(&key, &key_length);
+    REQUIRE(key_stream != NULL, KEFIR_SET_OS_ERROR("Failed to construct in-memory file"));
+    kefir_result_t res = format_cache_key(key_stream, hooks);
+    fclose(key_stream);
+    const struct runtime_cache cache = {
+        .directory = hooks->compiler_context->runtime_cache_directory, .key = key, .key_length = key_length};
+    REQUIRE_CHAIN(&res, generate_cached_runtime_functions(mem, output, functions, hooks, &cache));
+    free(key);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_compiler_init_runtime_hooks(const struct kefir_compiler_context *context,
                                                  struct kefir_compiler_codegen_runtime_hooks *hooks) {
     REQUIRE(context != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid compiler context"));
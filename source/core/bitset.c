@@ -112,13 +112,23 @@ kefir_result_t kefir_bitset_find(const struct kefir_bitset *bitset, kefir_bool_t
                                  kefir_size_t *result_ptr) {
     REQUIRE(bitset != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid bitset"));
 
-    for (kefir_size_t i = begin; i < bitset->length; i++) {
-        kefir_bool_t bit;
-        REQUIRE_OK(kefir_bitset_get(bitset, i, &bit));
-        if (bit == value) {
-            ASSIGN_PTR(result_ptr, i);
-            return KEFIR_OK;
+    const kefir_uint64_t skip_entry = value ? 0ull : ~0ull;
+    for (kefir_size_t i = begin; i < bitset->length;) {
+        const kefir_size_t position = i / BITS_PER_ENTRY;
+        const kefir_size_t offset = i % BITS_PER_ENTRY;
+        kefir_uint64_t entry = (bitset->content[position] ^ skip_entry) >> offset;
+        if (entry != 0) {
+            kefir_size_t index = i;
+            for (; (entry & 1) == 0; entry >>= 1) {
+                index++;
+            }
+            if (index < bitset->length) {
+                ASSIGN_PTR(result_ptr, index);
+                return KEFIR_OK;
+            }
+            break;
         }
+        i += BITS_PER_ENTRY - offset;
     }
     return KEFIR_SET_ERROR(KEFIR_NOT_FOUND, "Unable to find requested bit in bitset");
 }
@@ -173,6 +183,48 @@ kefir_result_t kefir_bitset_clear(const struct kefir_bitset *bitset) {
     return KEFIR_OK;
 }
 
+kefir_result_t kefir_bitset_union(const struct kefir_bitset *dst_bitset, const struct kefir_bitset *src_bitset,
+                                  kefir_bool_t *changed_ptr) {
+    REQUIRE(dst_bitset != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid destination bitset"));
+    REQUIRE(src_bitset != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid source bitset"));
+    REQUIRE(src_bitset->length <= dst_bitset->length,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Source bitset exceeds destination bitset bounds"));
+
+    kefir_uint64_t changed = 0;
+    const kefir_size_t num_of_entries = src_bitset->length / BITS_PER_ENTRY;
+    for (kefir_size_t i = 0; i < num_of_entries; i++) {
+        const kefir_uint64_t entry = dst_bitset->content[i] | src_bitset->content[i];
+        changed |= entry ^ dst_bitset->content[i];
+        dst_bitset->content[i] = entry;
+    }
+    const kefir_size_t tail_bits = src_bitset->length % BITS_PER_ENTRY;
+    if (tail_bits > 0) {
+        const kefir_uint64_t mask = (1ull << tail_bits) - 1;
+        const kefir_uint64_t entry = dst_bitset->content[num_of_entries] | (src_bitset->content[num_of_entries] & mask);
+        changed |= entry ^ dst_bitset->content[num_of_entries];
+        dst_bitset->content[num_of_entries] = entry;
+    }
+    ASSIGN_PTR(changed_ptr, changed != 0);
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_bitset_subtract(const struct kefir_bitset *dst_bitset, const struct kefir_bitset *src_bitset) {
+    REQUIRE(dst_bitset != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid destination bitset"));
+    REQUIRE(src_bitset != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid source bitset"));
+
+    const kefir_size_t length = MIN(dst_bitset->length, src_bitset->length);
+    const kefir_size_t num_of_entries = length / BITS_PER_ENTRY;
+    for (kefir_size_t i = 0; i < num_of_entries; i++) {
+        dst_bitset->content[i] &= ~src_bitset->content[i];
+    }
+    const kefir_size_t tail_bits = length % BITS_PER_ENTRY;
+    if (tail_bits > 0) {
+        const kefir_uint64_t mask = (1ull << tail_bits) - 1;
+        dst_bitset->content[num_of_entries] &= ~(src_bitset->content[num_of_entries] & mask);
+    }
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_bitset_length(const struct kefir_bitset *bitset, kefir_size_t *length_ptr) {
     REQUIRE(bitset != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid bitset"));
     REQUIRE(length_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to bitset length"));
@@ -205,10 +257,15 @@ kefir_result_t kefir_bitset_resize(struct kefir_mem *mem, struct kefir_bitset *b
         bitset->capacity = new_capacity;
     }
 
-    kefir_size_t old_length = bitset->length;
+    const kefir_size_t old_length = bitset->length;
     bitset->length = new_length;
-    for (kefir_size_t i = old_length; i < new_length; i++) {
-        REQUIRE_OK(kefir_bitset_set(bitset, i, false));
+    if (old_length % BITS_PER_ENTRY != 0) {
+        bitset->content[old_length / BITS_PER_ENTRY] &= (1ull << (old_length % BITS_PER_ENTRY)) - 1;
+    }
+    const kefir_size_t first_new_entry = (old_length + BITS_PER_ENTRY - 1) / BITS_PER_ENTRY;
+    const kefir_size_t end_entry = (new_length + BITS_PER_ENTRY - 1) / BITS_PER_ENTRY;
+    if (end_entry > first_new_entry) {
+        memset(&bitset->content[first_new_entry], 0, sizeof(kefir_uint64_t) * (end_entry - first_new_entry));
     }
     return KEFIR_OK;
 }
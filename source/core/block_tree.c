@@ -132,6 +132,17 @@ kefir_result_t kefir_block_tree_block(struct kefir_mem *mem, struct kefir_block_
     return KEFIR_OK;
 }
 
+kefir_result_t kefir_block_tree_drop_block(struct kefir_mem *mem, struct kefir_block_tree *tree, kefir_size_t block_id) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(tree != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid block tree"));
+
+    kefir_result_t res = kefir_hashtree_delete(mem, &tree->tree, (kefir_hashtree_key_t) block_id);
+    if (res != KEFIR_NOT_FOUND) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_block_tree_iter(const struct kefir_block_tree *tree, struct kefir_block_tree_iterator *iter) {
     REQUIRE(tree != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid block tree"));
     REQUIRE(iter != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid block tree iterator"));
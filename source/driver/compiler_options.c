@@ -213,6 +213,7 @@ struct kefir_cli_option KefirCompilerConfigurationOptions[] = {
         SIMPLE(0, "no-codegen-" name, false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, false, field)
 
     SIMPLE('o', "output", true, KEFIR_CLI_OPTION_ACTION_ASSIGN_STRARG, 0, output_filepath),
+    SIMPLE(0, "output-kind", true, KEFIR_CLI_OPTION_ACTION_ASSIGN_STRARG, 0, output_kind_filepath),
     SIMPLE(0, "c17-standard", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, KEFIR_C17_STANDARD_VERSION,
            standard_version),
     SIMPLE(0, "c23-standard", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, KEFIR_C23_STANDARD_VERSION,
@@ -233,6 +234,12 @@ struct kefir_cli_option KefirCompilerConfigurationOptions[] = {
            error_report_type),
     SIMPLE(0, "tabular-errors", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT,
            KEFIR_COMPILER_RUNNER_ERROR_REPORT_TABULAR, error_report_type),
+    SIMPLE(0, "time-report", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, KEFIR_COMPILER_RUNNER_TIME_REPORT_TABULAR,
+           time_report),
+    SIMPLE(0, "time-report-json", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT,
+           KEFIR_COMPILER_RUNNER_TIME_REPORT_JSON, time_report),
+    SIMPLE(0, "no-time-report", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, KEFIR_COMPILER_RUNNER_TIME_REPORT_NONE,
+           time_report),
     SIMPLE(0, "error-compiler-ref", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, true, features.error_compiler_ref),
     SIMPLE(0, "no-error-compiler-ref", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, false,
            features.error_compiler_ref),
@@ -266,6 +273,9 @@ struct kefir_cli_option KefirCompilerConfigurationOptions[] = {
     SIMPLE(0, "opt-cx-limited-range", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, true, optimizer.cx_limited_range),
     SIMPLE(0, "no-opt-cx-limited-range", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, false,
            optimizer.cx_limited_range),
+    SIMPLE(0, "opt-strict-aliasing", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, true, optimizer.strict_aliasing),
+    SIMPLE(0, "no-opt-strict-aliasing", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, false,
+           optimizer.strict_aliasing),
 
     CUSTOM('D', "define", true, define_hook),
     CUSTOM('U', "undefine", true, undefine_hook),
@@ -279,6 +289,7 @@ struct kefir_cli_option KefirCompilerConfigurationOptions[] = {
            optimizer.max_inline_depth),
     SIMPLE(0, "optimizer-max-inlines-per-func", true, KEFIR_CLI_OPTION_ACTION_ASSIGN_UINTARG, 0,
            optimizer.max_inlines_per_function),
+    SIMPLE(0, "optimizer-max-inline-cost", true, KEFIR_CLI_OPTION_ACTION_ASSIGN_UINTARG, 0, optimizer.max_inline_cost),
 
     FEATURE("non-strict-qualifiers", features.non_strict_qualifiers),
     FEATURE("signed-enums", features.signed_enum_type),
@@ -337,6 +348,13 @@ struct kefir_cli_option KefirCompilerConfigurationOptions[] = {
     CODEGEN("omit-frame-pointer", codegen.omit_frame_pointer),
     CODEGEN("valgrind-compatible-x87", codegen.valgrind_compatible_x87),
     CODEGEN("imprecise-decimal-bitint-conv", codegen.imprecise_decimal_bitint_conv),
+    CODEGEN("integrated-as", codegen.integrated_assembler),
+    CODEGEN("code-layout", codegen.code_layout),
+    CODEGEN("red-zone", codegen.red_zone),
+    CODEGEN("shrink-wrap", codegen.shrink_wrap),
+    CODEGEN("live-range-split", codegen.live_range_split),
+    CODEGEN("inline-memory-builtins", codegen.inline_memory_builtins),
+    CODEGEN("streaming", codegen.streaming),
     SIMPLE(0, "codegen-decimal-default", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT,
            KEFIR_COMPILER_RUNNER_DECIMAL_ENCODING_DEFAULT, codegen.decimal_encoding),
     SIMPLE(0, "codegen-decimal-bid", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT,
@@ -357,6 +375,8 @@ struct kefir_cli_option KefirCompilerConfigurationOptions[] = {
            KEFIR_AST_DECLARATOR_VISIBILITY_INTERNAL, codegen.symbol_visibility),
     SIMPLE(0, "codegen-syntax", true, KEFIR_CLI_OPTION_ACTION_ASSIGN_STRARG, 0, codegen.syntax),
     SIMPLE(0, "codegen-details", true, KEFIR_CLI_OPTION_ACTION_ASSIGN_STRARG, 0, codegen.print_details),
+    SIMPLE(0, "codegen-runtime-cache", true, KEFIR_CLI_OPTION_ACTION_ASSIGN_STRARG, 0,
+           codegen.runtime_cache_directory),
     SIMPLE(0, "codegen-optimize", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, KEFIR_CODEGEN_OPTIMIZATION_FULL,
            codegen.optimization),
     SIMPLE(0, "codegen-no-optimize", false, KEFIR_CLI_OPTION_ACTION_ASSIGN_CONSTANT, KEFIR_CODEGEN_OPTIMIZATION_NONE,
@@ -22,6 +22,8 @@
 #include "kefir/core/error.h"
 #include "kefir/core/util.h"
 #include <string.h>
+#include <stdlib.h>
+#include <errno.h>
 
 static kefir_result_t list_entry_free(struct kefir_mem *mem, struct kefir_list *list, struct kefir_list_entry *entry,
                                       void *payload) {
@@ -38,6 +40,7 @@ kefir_result_t kefir_driver_assembler_configuration_init(struct kefir_driver_ass
     REQUIRE(config != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid driver assembler configuration"));
 
     config->verbose = false;
+    config->integrated = false;
     REQUIRE_OK(kefir_list_init(&config->arguments));
     REQUIRE_OK(kefir_list_on_remove(&config->arguments, list_entry_free, NULL));
     return KEFIR_OK;
@@ -118,6 +121,7 @@ kefir_result_t kefir_driver_configuration_init(struct kefir_driver_configuration
     config->stage = KEFIR_DRIVER_STAGE_LINK;
     config->output_file = NULL;
     config->standard_version = KEFIR_DEFAULT_STANDARD_VERSION;
+    config->parallel_jobs = 0;
 
     REQUIRE_OK(kefir_list_init(&config->arguments));
     REQUIRE_OK(kefir_list_on_remove(&config->arguments, list_entry_free, NULL));
@@ -161,7 +165,10 @@ kefir_result_t kefir_driver_configuration_init(struct kefir_driver_configuration
     config->flags.preprocessor_linemarkers = false;
     config->flags.fast_math = false;
     config->flags.cx_limited_range = false;
+    config->flags.strict_aliasing = true;
     config->flags.freestanding = false;
+    config->flags.integrated_assembler = false;
+    config->flags.time_report = KEFIR_DRIVER_TIME_REPORT_NONE;
 
     config->dependency_output.output_dependencies = false;
     config->dependency_output.output_system_deps = true;
@@ -420,3 +427,18 @@ kefir_result_t kefir_driver_configuration_add_include_file(struct kefir_mem *mem
         kefir_list_insert_after(mem, &config->include_files, kefir_list_tail(&config->include_files), (void *) file));
     return KEFIR_OK;
 }
+
+kefir_result_t kefir_driver_parse_parallel_jobs(const char *jobs, kefir_size_t *jobs_ptr) {
+    REQUIRE(jobs_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to number of jobs"));
+    REQUIRE(jobs != NULL && *jobs >= '0' && *jobs <= '9',
+            KEFIR_SET_ERRORF(KEFIR_UI_ERROR, "Expected positive number of parallel jobs, got '%s'",
+                             jobs != NULL ? jobs : ""));
+
+    char *jobs_end = NULL;
+    errno = 0;
+    unsigned long long value = strtoull(jobs, &jobs_end, 10);
+    REQUIRE(errno == 0 && *jobs_end == '\0' && value > 0 && value <= KEFIR_SIZE_MAX,
+            KEFIR_SET_ERRORF(KEFIR_UI_ERROR, "Expected positive number of parallel jobs, got '%s'", jobs));
+    *jobs_ptr = (kefir_size_t) value;
+    return KEFIR_OK;
+}
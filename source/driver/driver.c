@@ -28,11 +28,13 @@
 #include "kefir/core/string_array.h"
 #include "kefir/driver/compiler_options.h"
 #include "kefir/driver/target_configuration.h"
+#include "kefir/driver/runner.h"
 #include <assert.h>
 #include <string.h>
 #include <stdio.h>
 #include <limits.h>
 #include <libgen.h>
+#include <unistd.h>
 
 // clang-format off
 #define KEFIR_OPTIMIZER_PIPELINE_FULL_SPEC                                                                             \
@@ -69,6 +71,8 @@
 #define KEFIR_OPTIMIZER_PIPELINE_MINI_SPEC "inline-asm-untie,inline-func,local-alloc-sink,dead-code-elimination,dead-alloc,lowering"
 // clang-format on
 
+#define KEFIR_OPTIMIZER_MAX_INLINE_COST 20
+
 static kefir_result_t driver_generate_asm_config(struct kefir_mem *mem, struct kefir_string_pool *symbols,
                                                  struct kefir_driver_configuration *config,
                                                  const struct kefir_driver_external_resources *externals,
@@ -83,6 +87,7 @@ static kefir_result_t driver_generate_asm_config(struct kefir_mem *mem, struct k
     }
     assembler_config->verbose = config->flags.verbose;
     assembler_config->target = config->assembler.target;
+    assembler_config->integrated = config->flags.integrated_assembler;
     return KEFIR_OK;
 }
 
@@ -214,6 +219,9 @@ kefir_result_t kefir_driver_generate_compiler_config(struct kefir_mem *mem, stru
         compiler_config->pp_timestamp = externals->source_date_epoch.value;
         compiler_config->default_pp_timestamp = false;
     }
+    if (compiler_config->codegen.runtime_cache_directory == NULL) {
+        compiler_config->codegen.runtime_cache_directory = externals->runtime_cache_directory;
+    }
 
     switch (config->stage) {
         case KEFIR_DRIVER_STAGE_PREPROCESS:
@@ -275,6 +283,21 @@ kefir_result_t kefir_driver_generate_compiler_config(struct kefir_mem *mem, stru
     if (config->flags.cx_limited_range || config->flags.fast_math) {
         compiler_config->optimizer.cx_limited_range = true;
     }
+    compiler_config->optimizer.strict_aliasing = config->flags.strict_aliasing;
+
+    switch (config->flags.time_report) {
+        case KEFIR_DRIVER_TIME_REPORT_NONE:
+            compiler_config->time_report = KEFIR_COMPILER_RUNNER_TIME_REPORT_NONE;
+            break;
+
+        case KEFIR_DRIVER_TIME_REPORT_TABULAR:
+            compiler_config->time_report = KEFIR_COMPILER_RUNNER_TIME_REPORT_TABULAR;
+            break;
+
+        case KEFIR_DRIVER_TIME_REPORT_JSON:
+            compiler_config->time_report = KEFIR_COMPILER_RUNNER_TIME_REPORT_JSON;
+            break;
+    }
 
     switch (config->compiler.tentative_definition_placement) {
         case KEFIR_DRIVER_TENTATIVE_DEFINITION_PLACEMENT_DEFAULT:
@@ -382,6 +405,13 @@ kefir_result_t kefir_driver_generate_compiler_config(struct kefir_mem *mem, stru
             compiler_config->codegen.omit_frame_pointer = true;
         }
         compiler_config->codegen.optimization = true;
+        compiler_config->optimizer.max_inline_cost = KEFIR_OPTIMIZER_MAX_INLINE_COST;
+        compiler_config->codegen.code_layout = config->compiler.optimization_level > 1;
+        compiler_config->codegen.red_zone = config->compiler.optimization_level > 1;
+        compiler_config->codegen.shrink_wrap = config->compiler.optimization_level > 1;
+        compiler_config->codegen.live_range_split = config->compiler.optimization_level > 1;
+        compiler_config->codegen.inline_memory_builtins =
+            config->compiler.optimization_level > 1 && !config->flags.freestanding;
     } else {
         compiler_config->optimizer_pipeline_spec = KEFIR_OPTIMIZER_PIPELINE_MINI_SPEC;
         compiler_config->codegen.optimization = false;
@@ -472,31 +502,26 @@ static kefir_result_t generate_asm_name(struct kefir_mem *mem, const struct kefi
     return KEFIR_OK;
 }
 
-static kefir_result_t driver_compile_and_assemble(struct kefir_mem *mem,
-                                                  const struct kefir_driver_external_resources *externals,
-                                                  struct kefir_driver_assembler_configuration *assembler_config,
-                                                  struct kefir_compiler_runner_configuration *compiler_config,
-                                                  struct kefir_driver_argument *argument, const char *object_filename) {
-    struct kefir_process compiler_process, assembler_process;
-    REQUIRE_OK(driver_update_compiler_config(compiler_config, argument));
+static kefir_bool_t driver_assembler_accepts_pipe(const struct kefir_driver_assembler_configuration *assembler_config) {
+    switch (assembler_config->target) {
+        case KEFIR_DRIVER_ASSEMBLER_GAS_INTEL:
+        case KEFIR_DRIVER_ASSEMBLER_GAS_INTEL_PREFIX:
+        case KEFIR_DRIVER_ASSEMBLER_GAS_ATT:
+            return true;
 
-    const char *asm_filename;
-    REQUIRE_OK(generate_asm_name(mem, externals, &asm_filename));
-    compiler_config->output_filepath = asm_filename;
+        case KEFIR_DRIVER_ASSEMBLER_YASM:
+            return false;
+    }
+    return false;
+}
 
+static kefir_result_t driver_assemble_compiler_output(struct kefir_mem *mem,
+                                                      const struct kefir_driver_external_resources *externals,
+                                                      struct kefir_driver_assembler_configuration *assembler_config,
+                                                      struct kefir_driver_argument *argument,
+                                                      const char *object_filename, const char *asm_filename) {
+    struct kefir_process assembler_process;
     kefir_result_t res = KEFIR_OK;
-    REQUIRE_OK(kefir_process_init(&compiler_process));
-    REQUIRE_CHAIN(&res, kefir_driver_run_compiler(compiler_config, &compiler_process));
-    REQUIRE_CHAIN(&res, kefir_process_wait(&compiler_process));
-    REQUIRE_CHAIN_SET(&res, compiler_process.status.exited && compiler_process.status.exit_code == EXIT_SUCCESS,
-                      KEFIR_INTERRUPT);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_process_kill(&compiler_process);
-        remove(asm_filename);
-        return res;
-    });
-
-    res = KEFIR_OK;
     REQUIRE_OK(kefir_process_init(&assembler_process));
     REQUIRE_CHAIN(&res, kefir_driver_run_assembler(mem, object_filename, asm_filename, assembler_config, externals,
                                                    &assembler_process));
@@ -513,21 +538,80 @@ static kefir_result_t driver_compile_and_assemble(struct kefir_mem *mem,
     return KEFIR_OK;
 }
 
-static kefir_result_t driver_preprocess_and_assemble(struct kefir_mem *mem,
-                                                     const struct kefir_driver_external_resources *externals,
-                                                     struct kefir_driver_assembler_configuration *assembler_config,
-                                                     struct kefir_compiler_runner_configuration *compiler_config,
-                                                     struct kefir_driver_argument *argument,
-                                                     const char *object_filename) {
-    struct kefir_process compiler_process, assembler_process;
-    REQUIRE_OK(driver_update_compiler_config(compiler_config, argument));
+static kefir_result_t driver_run_compiler_and_assembler_via_file(
+    struct kefir_mem *mem, const struct kefir_driver_external_resources *externals,
+    struct kefir_driver_assembler_configuration *assembler_config,
+    struct kefir_compiler_runner_configuration *compiler_config, struct kefir_driver_argument *argument,
+    const char *object_filename, const char *asm_filename) {
+    struct kefir_process compiler_process;
+    compiler_config->output_filepath = asm_filename;
 
-    struct kefir_compiler_runner_configuration local_compiler_config = *compiler_config;
-    local_compiler_config.action = KEFIR_COMPILER_RUNNER_ACTION_PREPROCESS;
+    kefir_result_t res = KEFIR_OK;
+    REQUIRE_OK(kefir_process_init(&compiler_process));
+    REQUIRE_CHAIN(&res, kefir_driver_run_compiler(compiler_config, &compiler_process));
+    REQUIRE_CHAIN(&res, kefir_process_wait(&compiler_process));
+    REQUIRE_CHAIN_SET(&res, compiler_process.status.exited && compiler_process.status.exit_code == EXIT_SUCCESS,
+                      KEFIR_INTERRUPT);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_process_kill(&compiler_process);
+        remove(asm_filename);
+        return res;
+    });
 
-    const char *asm_filename;
-    REQUIRE_OK(generate_asm_name(mem, externals, &asm_filename));
+    REQUIRE_OK(driver_assemble_compiler_output(mem, externals, assembler_config, argument, object_filename,
+                                               asm_filename));
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_read_output_kind(const char *filename, kefir_bool_t *is_object) {
+    FILE *file = fopen(filename, "r");
+    REQUIRE(file != NULL, KEFIR_SET_OS_ERROR("Failed to open compiler output kind file"));
+    char output_kind[32] = {0};
+    const char *line = fgets(output_kind, sizeof(output_kind), file);
+    fclose(file);
+    REQUIRE(line != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Failed to read compiler output kind"));
+    if (strcmp(output_kind, "object\n") == 0) {
+        *is_object = true;
+    } else if (strcmp(output_kind, "assembly\n") == 0) {
+        *is_object = false;
+    } else {
+        return KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unexpected compiler output kind");
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_copy_file(const char *source_filename, const char *target_filename) {
+    FILE *source = fopen(source_filename, "rb");
+    REQUIRE(source != NULL, KEFIR_SET_OS_ERROR("Failed to open compiler output"));
+    FILE *target = fopen(target_filename, "wb");
+    REQUIRE_ELSE(target != NULL, {
+        fclose(source);
+        return KEFIR_SET_OS_ERROR("Failed to open object file");
+    });
+
+    char buffer[4096];
+    kefir_result_t res = KEFIR_OK;
+    for (kefir_size_t length = fread(buffer, 1, sizeof(buffer), source); res == KEFIR_OK && length > 0;
+         length = fread(buffer, 1, sizeof(buffer), source)) {
+        REQUIRE_CHAIN_SET(&res, fwrite(buffer, 1, length, target) == length,
+                          KEFIR_SET_OS_ERROR("Failed to write object file"));
+    }
+    REQUIRE_CHAIN_SET(&res, !ferror(source), KEFIR_SET_OS_ERROR("Failed to read compiler output"));
+    fclose(source);
+    REQUIRE_CHAIN_SET(&res, fclose(target) == 0, KEFIR_SET_OS_ERROR("Failed to write object file"));
+    return res;
+}
+
+static kefir_result_t driver_run_compiler_with_integrated_assembler(
+    struct kefir_mem *mem, const struct kefir_driver_external_resources *externals,
+    struct kefir_driver_assembler_configuration *assembler_config,
+    struct kefir_compiler_runner_configuration *compiler_config, struct kefir_driver_argument *argument,
+    const char *object_filename, const char *asm_filename, const char *output_kind_filename) {
+    struct kefir_process compiler_process;
+    struct kefir_compiler_runner_configuration local_compiler_config = *compiler_config;
+    local_compiler_config.codegen.integrated_assembler = true;
     local_compiler_config.output_filepath = asm_filename;
+    local_compiler_config.output_kind_filepath = output_kind_filename;
 
     kefir_result_t res = KEFIR_OK;
     REQUIRE_OK(kefir_process_init(&compiler_process));
@@ -535,26 +619,148 @@ static kefir_result_t driver_preprocess_and_assemble(struct kefir_mem *mem,
     REQUIRE_CHAIN(&res, kefir_process_wait(&compiler_process));
     REQUIRE_CHAIN_SET(&res, compiler_process.status.exited && compiler_process.status.exit_code == EXIT_SUCCESS,
                       KEFIR_INTERRUPT);
+    kefir_bool_t is_object = false;
+    REQUIRE_CHAIN(&res, driver_read_output_kind(output_kind_filename, &is_object));
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_process_kill(&compiler_process);
         remove(asm_filename);
         return res;
     });
 
-    res = KEFIR_OK;
-    REQUIRE_OK(kefir_process_init(&assembler_process));
-    REQUIRE_CHAIN(&res, kefir_driver_run_assembler(mem, object_filename, asm_filename, assembler_config, externals,
-                                                   &assembler_process));
-    REQUIRE_CHAIN(&res, kefir_process_wait(&assembler_process));
-    REQUIRE_CHAIN_SET(&res, assembler_process.status.exited && assembler_process.status.exit_code == EXIT_SUCCESS,
-                      KEFIR_SET_ERRORF(KEFIR_SUBPROCESS_ERROR, "Failed to assemble '%s'", argument->value));
+    // Compiler reports textual assembly output whenever the module cannot be encoded directly
+    if (!is_object) {
+        REQUIRE_OK(driver_assemble_compiler_output(mem, externals, assembler_config, argument, object_filename,
+                                                   asm_filename));
+        return KEFIR_OK;
+    }
+
+    if (rename(asm_filename, object_filename) != 0) {
+        res = driver_copy_file(asm_filename, object_filename);
+        remove(asm_filename);
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            remove(object_filename);
+            return res;
+        });
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_run_compiler_and_assembler_via_pipe(
+    struct kefir_mem *mem, const struct kefir_driver_external_resources *externals,
+    struct kefir_driver_assembler_configuration *assembler_config,
+    struct kefir_compiler_runner_configuration *compiler_config, struct kefir_driver_argument *argument,
+    const char *object_filename) {
+    struct kefir_process compiler_process, assembler_process;
+    compiler_config->output_filepath = NULL;
+
+    REQUIRE_OK(kefir_process_init(&compiler_process));
+    kefir_result_t res = kefir_process_init(&assembler_process);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_process_close(&compiler_process);
+        return res;
+    });
+    REQUIRE_CHAIN(&res, kefir_process_pipe(&compiler_process, &assembler_process));
+    REQUIRE_CHAIN(&res, kefir_driver_run_compiler(compiler_config, &compiler_process));
     REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_process_close(&compiler_process);
+        kefir_process_close(&assembler_process);
+        return res;
+    });
+    res = kefir_driver_run_assembler(mem, object_filename, NULL, assembler_config, externals, &assembler_process);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_process_kill(&compiler_process);
+        kefir_process_close(&assembler_process);
+        return res;
+    });
+
+    // Driver holds a copy of the pipe write end until the compiler status is known, so that the assembler does not
+    // observe end of input and process partial output of a failed compilation
+    int compiler_output_fd = dup(compiler_process.io.output_fd);
+    REQUIRE_ELSE(compiler_output_fd != -1, {
+        res = KEFIR_SET_OS_ERROR("Failed to duplicate compiler output");
+        kefir_process_kill(&compiler_process);
         kefir_process_kill(&assembler_process);
         remove(object_filename);
-        remove(asm_filename);
         return res;
     });
-    remove(asm_filename);
+
+    struct kefir_process *processes[] = {&compiler_process, &assembler_process};
+    kefir_size_t index;
+    res = kefir_process_wait_any(processes, 2, &index);
+    if (res == KEFIR_OK && index == 0) {
+        REQUIRE_CHAIN_SET(&res,
+                          compiler_process.status.exited && compiler_process.status.exit_code == EXIT_SUCCESS,
+                          KEFIR_INTERRUPT);
+        if (res == KEFIR_OK) {
+            close(compiler_output_fd);
+            compiler_output_fd = -1;
+        }
+        REQUIRE_CHAIN(&res, kefir_process_wait(&assembler_process));
+        REQUIRE_CHAIN_SET(&res,
+                          assembler_process.status.exited && assembler_process.status.exit_code == EXIT_SUCCESS,
+                          KEFIR_SET_ERRORF(KEFIR_SUBPROCESS_ERROR, "Failed to assemble '%s'", argument->value));
+    } else if (res == KEFIR_OK) {
+        // Assembler has terminated before consuming complete compiler output
+        res = KEFIR_SET_ERRORF(KEFIR_SUBPROCESS_ERROR, "Failed to assemble '%s'", argument->value);
+    }
+    if (compiler_output_fd != -1) {
+        close(compiler_output_fd);
+    }
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_process_kill(&compiler_process);
+        kefir_process_kill(&assembler_process);
+        remove(object_filename);
+        return res;
+    });
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_run_compiler_and_assembler(struct kefir_mem *mem,
+                                                        const struct kefir_driver_external_resources *externals,
+                                                        struct kefir_driver_assembler_configuration *assembler_config,
+                                                        struct kefir_compiler_runner_configuration *compiler_config,
+                                                        struct kefir_driver_argument *argument,
+                                                        const char *object_filename, const char *asm_filename) {
+    if (asm_filename != NULL) {
+        REQUIRE_OK(driver_run_compiler_and_assembler_via_file(mem, externals, assembler_config, compiler_config,
+                                                              argument, object_filename, asm_filename));
+    } else {
+        REQUIRE_OK(driver_run_compiler_and_assembler_via_pipe(mem, externals, assembler_config, compiler_config,
+                                                              argument, object_filename));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_compile_and_assemble(struct kefir_mem *mem,
+                                                  const struct kefir_driver_external_resources *externals,
+                                                  struct kefir_driver_assembler_configuration *assembler_config,
+                                                  struct kefir_compiler_runner_configuration *compiler_config,
+                                                  struct kefir_driver_argument *argument, const char *object_filename,
+                                                  const char *asm_filename, const char *output_kind_filename) {
+    REQUIRE_OK(driver_update_compiler_config(compiler_config, argument));
+    if (assembler_config->integrated) {
+        REQUIRE_OK(driver_run_compiler_with_integrated_assembler(mem, externals, assembler_config, compiler_config,
+                                                                 argument, object_filename, asm_filename,
+                                                                 output_kind_filename));
+    } else {
+        REQUIRE_OK(driver_run_compiler_and_assembler(mem, externals, assembler_config, compiler_config, argument,
+                                                     object_filename, asm_filename));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_preprocess_and_assemble(struct kefir_mem *mem,
+                                                     const struct kefir_driver_external_resources *externals,
+                                                     struct kefir_driver_assembler_configuration *assembler_config,
+                                                     struct kefir_compiler_runner_configuration *compiler_config,
+                                                     struct kefir_driver_argument *argument,
+                                                     const char *object_filename, const char *asm_filename) {
+    REQUIRE_OK(driver_update_compiler_config(compiler_config, argument));
+
+    struct kefir_compiler_runner_configuration local_compiler_config = *compiler_config;
+    local_compiler_config.action = KEFIR_COMPILER_RUNNER_ACTION_PREPROCESS;
+    REQUIRE_OK(driver_run_compiler_and_assembler(mem, externals, assembler_config, &local_compiler_config, argument,
+                                                 object_filename, asm_filename));
     return KEFIR_OK;
 }
 
@@ -639,6 +845,287 @@ static kefir_result_t driver_assemble(struct kefir_mem *mem, const struct kefir_
     return KEFIR_OK;
 }
 
+typedef enum driver_job_type {
+    DRIVER_JOB_COMPILE_AND_ASSEMBLE,
+    DRIVER_JOB_PREPROCESS_AND_ASSEMBLE,
+    DRIVER_JOB_ASSEMBLE
+} driver_job_type_t;
+
+struct driver_job {
+    driver_job_type_t type;
+    struct kefir_mem *mem;
+    const struct kefir_driver_external_resources *externals;
+    struct kefir_driver_assembler_configuration *assembler_config;
+    struct kefir_compiler_runner_configuration *compiler_config;
+    struct kefir_driver_argument *argument;
+    const char *object_filename;
+    const char *asm_filename;
+    const char *output_kind_filename;
+    const char *diagnostics_filename;
+    struct kefir_process process;
+    kefir_bool_t running;
+};
+
+struct driver_job_scheduler {
+    kefir_size_t max_jobs;
+    kefir_size_t running_jobs;
+    struct kefir_list jobs;
+};
+
+static kefir_result_t driver_job_run_impl(struct driver_job *job) {
+    switch (job->type) {
+        case DRIVER_JOB_COMPILE_AND_ASSEMBLE:
+            REQUIRE_OK(driver_compile_and_assemble(job->mem, job->externals, job->assembler_config,
+                                                   job->compiler_config, job->argument, job->object_filename,
+                                                   job->asm_filename, job->output_kind_filename));
+            break;
+
+        case DRIVER_JOB_PREPROCESS_AND_ASSEMBLE:
+            REQUIRE_OK(driver_preprocess_and_assemble(job->mem, job->externals, job->assembler_config,
+                                                      job->compiler_config, job->argument, job->object_filename,
+                                                      job->asm_filename));
+            break;
+
+        case DRIVER_JOB_ASSEMBLE:
+            REQUIRE_OK(driver_assemble(job->mem, job->externals, job->assembler_config, job->argument,
+                                       job->object_filename));
+            break;
+    }
+    return KEFIR_OK;
+}
+
+static int driver_job_run(void *payload) {
+    ASSIGN_DECL_CAST(struct driver_job *, job, payload);
+    kefir_result_t res = driver_job_run_impl(job);
+    if (res == KEFIR_INTERRUPT) {
+        return EXIT_FAILURE;
+    }
+    return kefir_report_error(stderr, res, false, true) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static kefir_result_t free_driver_job(struct kefir_mem *mem, struct kefir_list *list, struct kefir_list_entry *entry,
+                                      void *payload) {
+    UNUSED(list);
+    UNUSED(payload);
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(entry != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid list entry"));
+
+    ASSIGN_DECL_CAST(struct driver_job *, job, entry->value);
+    if (job->running) {
+        kefir_process_kill(&job->process);
+        remove(job->object_filename);
+    }
+    KEFIR_FREE(mem, job);
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_job_scheduler_init(struct driver_job_scheduler *scheduler, kefir_size_t max_jobs) {
+    scheduler->max_jobs = MAX(max_jobs, 1);
+    scheduler->running_jobs = 0;
+    REQUIRE_OK(kefir_list_init(&scheduler->jobs));
+    REQUIRE_OK(kefir_list_on_remove(&scheduler->jobs, free_driver_job, NULL));
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_job_scheduler_free(struct kefir_mem *mem, struct driver_job_scheduler *scheduler) {
+    REQUIRE_OK(kefir_list_free(mem, &scheduler->jobs));
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_job_replay_diagnostics(const struct driver_job *job) {
+    FILE *diagnostics = fopen(job->diagnostics_filename, "r");
+    REQUIRE(diagnostics != NULL, KEFIR_SET_OS_ERROR("Failed to open job diagnostics file"));
+
+    char buffer[4096];
+    for (kefir_size_t length = fread(buffer, 1, sizeof(buffer), diagnostics); length > 0;
+         length = fread(buffer, 1, sizeof(buffer), diagnostics)) {
+        fwrite(buffer, 1, length, stderr);
+    }
+    fclose(diagnostics);
+    remove(job->diagnostics_filename);
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_job_scheduler_retire(struct kefir_mem *mem, struct driver_job_scheduler *scheduler) {
+    // Jobs are retired strictly in submission order, so that diagnostics and failures are reported in the same order
+    // as in sequential mode
+    for (struct kefir_list_entry *iter = kefir_list_head(&scheduler->jobs); iter != NULL;
+         iter = kefir_list_head(&scheduler->jobs)) {
+        ASSIGN_DECL_CAST(struct driver_job *, job, iter->value);
+        if (job->running) {
+            break;
+        }
+
+        REQUIRE_OK(driver_job_replay_diagnostics(job));
+        const kefir_bool_t success = job->process.status.exited && job->process.status.exit_code == EXIT_SUCCESS;
+        REQUIRE_OK(kefir_list_pop(mem, &scheduler->jobs, iter));
+        REQUIRE(success, KEFIR_INTERRUPT);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_job_scheduler_wait(struct kefir_mem *mem, struct driver_job_scheduler *scheduler) {
+    REQUIRE(scheduler->running_jobs > 0, KEFIR_OK);
+
+    struct kefir_process **processes = KEFIR_MALLOC(mem, sizeof(struct kefir_process *) * scheduler->running_jobs);
+    REQUIRE(processes != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate driver job processes"));
+    struct driver_job **jobs = KEFIR_MALLOC(mem, sizeof(struct driver_job *) * scheduler->running_jobs);
+    REQUIRE_ELSE(jobs != NULL, {
+        KEFIR_FREE(mem, processes);
+        return KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate driver jobs");
+    });
+
+    kefir_size_t length = 0;
+    for (const struct kefir_list_entry *iter = kefir_list_head(&scheduler->jobs);
+         iter != NULL && length < scheduler->running_jobs; kefir_list_next(&iter)) {
+        ASSIGN_DECL_CAST(struct driver_job *, job, iter->value);
+        if (job->running) {
+            jobs[length] = job;
+            processes[length++] = &job->process;
+        }
+    }
+
+    kefir_size_t index;
+    kefir_result_t res = kefir_process_wait_any(processes, length, &index);
+    if (res == KEFIR_OK) {
+        jobs[index]->running = false;
+        scheduler->running_jobs--;
+    }
+    KEFIR_FREE(mem, processes);
+    KEFIR_FREE(mem, jobs);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_job_scheduler_abort(struct kefir_mem *mem, struct driver_job_scheduler *scheduler) {
+    // Let already running jobs finish, discarding their outputs and diagnostics
+    while (scheduler->running_jobs > 0) {
+        REQUIRE_OK(driver_job_scheduler_wait(mem, scheduler));
+    }
+    for (const struct kefir_list_entry *iter = kefir_list_head(&scheduler->jobs); iter != NULL;
+         kefir_list_next(&iter)) {
+        ASSIGN_DECL_CAST(struct driver_job *, job, iter->value);
+        remove(job->object_filename);
+        remove(job->diagnostics_filename);
+    }
+    REQUIRE_OK(kefir_list_clear(mem, &scheduler->jobs));
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_job_scheduler_finish(struct kefir_mem *mem, struct driver_job_scheduler *scheduler) {
+    kefir_result_t res = KEFIR_OK;
+    while (res == KEFIR_OK && kefir_list_length(&scheduler->jobs) > 0) {
+        REQUIRE_CHAIN(&res, driver_job_scheduler_wait(mem, scheduler));
+        REQUIRE_CHAIN(&res, driver_job_scheduler_retire(mem, scheduler));
+    }
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        if (res == KEFIR_INTERRUPT) {
+            REQUIRE_OK(driver_job_scheduler_abort(mem, scheduler));
+        }
+        return res;
+    });
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_job_scheduler_submit(struct kefir_mem *mem, struct driver_job_scheduler *scheduler,
+                                                  const struct driver_job *job_template) {
+    // Temporary files are allocated before the job is started, as parallel jobs run in separate processes
+    const char *asm_filename = NULL;
+    const char *output_kind_filename = NULL;
+    const kefir_bool_t integrated_assembler =
+        job_template->type == DRIVER_JOB_COMPILE_AND_ASSEMBLE && job_template->assembler_config->integrated;
+    if ((job_template->type != DRIVER_JOB_ASSEMBLE && !driver_assembler_accepts_pipe(job_template->assembler_config)) ||
+        integrated_assembler) {
+        REQUIRE_OK(generate_asm_name(mem, job_template->externals, &asm_filename));
+    }
+    if (integrated_assembler) {
+        REQUIRE_OK(kefir_tempfile_manager_create_file(mem, job_template->externals->tmpfile_manager, "output-kind",
+                                                      &output_kind_filename));
+    }
+
+    if (scheduler->max_jobs == 1) {
+        struct driver_job job = *job_template;
+        job.asm_filename = asm_filename;
+        job.output_kind_filename = output_kind_filename;
+        REQUIRE_OK(driver_job_run_impl(&job));
+        return KEFIR_OK;
+    }
+
+    while (scheduler->running_jobs >= scheduler->max_jobs) {
+        REQUIRE_OK(driver_job_scheduler_wait(mem, scheduler));
+        REQUIRE_OK(driver_job_scheduler_retire(mem, scheduler));
+    }
+
+    struct driver_job *job = KEFIR_MALLOC(mem, sizeof(struct driver_job));
+    REQUIRE(job != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate driver job"));
+    *job = *job_template;
+    job->asm_filename = asm_filename;
+    job->output_kind_filename = output_kind_filename;
+    job->running = false;
+
+    kefir_result_t res = kefir_tempfile_manager_create_file(mem, job->externals->tmpfile_manager, "diagnostics",
+                                                            &job->diagnostics_filename);
+    REQUIRE_CHAIN(&res, kefir_process_init(&job->process));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(mem, job);
+        return res;
+    });
+    res = kefir_process_redirect_stderr_to_file(&job->process, job->diagnostics_filename);
+    REQUIRE_CHAIN(&res, kefir_process_run(&job->process, driver_job_run, job));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_process_close(&job->process);
+        KEFIR_FREE(mem, job);
+        return res;
+    });
+    job->running = true;
+
+    res = kefir_list_insert_after(mem, &scheduler->jobs, kefir_list_tail(&scheduler->jobs), job);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_process_kill(&job->process);
+        remove(job->object_filename);
+        KEFIR_FREE(mem, job);
+        return res;
+    });
+    scheduler->running_jobs++;
+    return KEFIR_OK;
+}
+
+static kefir_result_t driver_schedule_job(struct kefir_mem *mem, struct kefir_string_pool *symbols,
+                                          struct driver_job_scheduler *scheduler, driver_job_type_t type,
+                                          const struct kefir_driver_external_resources *externals,
+                                          struct kefir_driver_assembler_configuration *assembler_config,
+                                          struct kefir_compiler_runner_configuration *compiler_config,
+                                          struct kefir_driver_argument *argument, const char *object_filename) {
+    object_filename = kefir_string_pool_insert(mem, symbols, object_filename, NULL);
+    REQUIRE(object_filename != NULL,
+            KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to insert object file name into string pool"));
+
+    const struct driver_job job = {.type = type,
+                                   .mem = mem,
+                                   .externals = externals,
+                                   .assembler_config = assembler_config,
+                                   .compiler_config = compiler_config,
+                                   .argument = argument,
+                                   .object_filename = object_filename,
+                                   .asm_filename = NULL,
+                                   .output_kind_filename = NULL,
+                                   .diagnostics_filename = NULL,
+                                   .running = false};
+    REQUIRE_OK(driver_job_scheduler_submit(mem, scheduler, &job));
+    return KEFIR_OK;
+}
+
+static kefir_size_t driver_parallel_jobs(const struct kefir_driver_configuration *config,
+                                         const struct kefir_driver_external_resources *externals) {
+    kefir_size_t jobs = config->parallel_jobs != 0 ? config->parallel_jobs : externals->parallel_jobs;
+    if (config->dependency_output.output_dependencies ||
+        (config->stage == KEFIR_DRIVER_STAGE_ASSEMBLE && config->output_file != NULL)) {
+        // Outputs of all inputs would be written into the same file
+        jobs = 1;
+    }
+    return MAX(jobs, 1);
+}
+
 static kefir_result_t generate_object_name(struct kefir_mem *mem,
                                            const struct kefir_driver_external_resources *externals,
                                            const char **output_filename) {
@@ -675,6 +1162,7 @@ static kefir_result_t driver_run_argument(struct kefir_mem *mem, struct kefir_st
                                           struct kefir_driver_assembler_configuration *assembler_config,
                                           struct kefir_driver_linker_configuration *linker_config,
                                           struct kefir_compiler_runner_configuration *compiler_config,
+                                          struct driver_job_scheduler *scheduler,
                                           struct kefir_driver_argument *argument) {
     const char *output_filename = NULL;
 
@@ -707,21 +1195,23 @@ static kefir_result_t driver_run_argument(struct kefir_mem *mem, struct kefir_st
                 case KEFIR_DRIVER_ARGUMENT_INPUT_FILE_CODE:
                 case KEFIR_DRIVER_ARGUMENT_INPUT_FILE_PREPROCESSED:
                     REQUIRE_OK(generate_object_name(mem, externals, &output_filename));
-                    REQUIRE_OK(driver_compile_and_assemble(mem, externals, assembler_config, compiler_config, argument,
-                                                           output_filename));
+                    REQUIRE_OK(driver_schedule_job(mem, symbols, scheduler, DRIVER_JOB_COMPILE_AND_ASSEMBLE, externals,
+                                                   assembler_config, compiler_config, argument, output_filename));
                     REQUIRE_OK(kefir_driver_linker_configuration_add_argument(mem, linker_config, output_filename));
                     break;
 
                 case KEFIR_DRIVER_ARGUMENT_INPUT_FILE_ASSEMBLY:
                     REQUIRE_OK(generate_object_name(mem, externals, &output_filename));
-                    REQUIRE_OK(driver_assemble(mem, externals, assembler_config, argument, output_filename));
+                    REQUIRE_OK(driver_schedule_job(mem, symbols, scheduler, DRIVER_JOB_ASSEMBLE, externals,
+                                                   assembler_config, compiler_config, argument, output_filename));
                     REQUIRE_OK(kefir_driver_linker_configuration_add_argument(mem, linker_config, output_filename));
                     break;
 
                 case KEFIR_DRIVER_ARGUMENT_INPUT_FILE_ASSEMBLY_WITH_PREPROCESSING:
                     REQUIRE_OK(generate_object_name(mem, externals, &output_filename));
-                    REQUIRE_OK(driver_preprocess_and_assemble(mem, externals, assembler_config, compiler_config,
-                                                              argument, output_filename));
+                    REQUIRE_OK(driver_schedule_job(mem, symbols, scheduler, DRIVER_JOB_PREPROCESS_AND_ASSEMBLE,
+                                                   externals, assembler_config, compiler_config, argument,
+                                                   output_filename));
                     REQUIRE_OK(kefir_driver_linker_configuration_add_argument(mem, linker_config, output_filename));
                     break;
 
@@ -759,17 +1249,19 @@ static kefir_result_t driver_run_argument(struct kefir_mem *mem, struct kefir_st
             switch (argument->type) {
                 case KEFIR_DRIVER_ARGUMENT_INPUT_FILE_CODE:
                 case KEFIR_DRIVER_ARGUMENT_INPUT_FILE_PREPROCESSED:
-                    REQUIRE_OK(driver_compile_and_assemble(mem, externals, assembler_config, compiler_config, argument,
-                                                           output_filename));
+                    REQUIRE_OK(driver_schedule_job(mem, symbols, scheduler, DRIVER_JOB_COMPILE_AND_ASSEMBLE, externals,
+                                                   assembler_config, compiler_config, argument, output_filename));
                     break;
 
                 case KEFIR_DRIVER_ARGUMENT_INPUT_FILE_ASSEMBLY:
-                    REQUIRE_OK(driver_assemble(mem, externals, assembler_config, argument, output_filename));
+                    REQUIRE_OK(driver_schedule_job(mem, symbols, scheduler, DRIVER_JOB_ASSEMBLE, externals,
+                                                   assembler_config, compiler_config, argument, output_filename));
                     break;
 
                 case KEFIR_DRIVER_ARGUMENT_INPUT_FILE_ASSEMBLY_WITH_PREPROCESSING:
-                    REQUIRE_OK(driver_preprocess_and_assemble(mem, externals, assembler_config, compiler_config,
-                                                              argument, output_filename));
+                    REQUIRE_OK(driver_schedule_job(mem, symbols, scheduler, DRIVER_JOB_PREPROCESS_AND_ASSEMBLE,
+                                                   externals, assembler_config, compiler_config, argument,
+                                                   output_filename));
                     break;
 
                 case KEFIR_DRIVER_ARGUMENT_INPUT_FILE_OBJECT:
@@ -940,13 +1432,28 @@ static kefir_result_t driver_run_impl(struct kefir_mem *mem, struct kefir_string
             break;
     }
 
-    for (const struct kefir_list_entry *iter = kefir_list_head(&config->arguments); iter != NULL;
+    struct driver_job_scheduler scheduler;
+    REQUIRE_OK(driver_job_scheduler_init(&scheduler, driver_parallel_jobs(config, externals)));
+    kefir_result_t res = KEFIR_OK;
+    for (const struct kefir_list_entry *iter = kefir_list_head(&config->arguments); res == KEFIR_OK && iter != NULL;
          kefir_list_next(&iter)) {
 
         ASSIGN_DECL_CAST(struct kefir_driver_argument *, argument, iter->value);
-        REQUIRE_OK(driver_run_argument(mem, symbols, config, externals, assembler_config, linker_config,
-                                       compiler_config, argument));
+        res = driver_run_argument(mem, symbols, config, externals, assembler_config, linker_config, compiler_config,
+                                  &scheduler, argument);
+    }
+    if (res == KEFIR_INTERRUPT) {
+        // Failure has already been reported, wait for the rest of jobs to finish
+        res = driver_job_scheduler_abort(mem, &scheduler);
+        REQUIRE_CHAIN(&res, KEFIR_INTERRUPT);
+    } else {
+        REQUIRE_CHAIN(&res, driver_job_scheduler_finish(mem, &scheduler));
     }
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        driver_job_scheduler_free(mem, &scheduler);
+        return res;
+    });
+    REQUIRE_OK(driver_job_scheduler_free(mem, &scheduler));
 
     if (config->stage == KEFIR_DRIVER_STAGE_LINK) {
 
@@ -970,7 +1477,7 @@ static kefir_result_t driver_run_impl(struct kefir_mem *mem, struct kefir_string
 
         struct kefir_process process;
         REQUIRE_OK(kefir_process_init(&process));
-        kefir_result_t res = KEFIR_OK;
+        res = KEFIR_OK;
         if (config->flags.verbose) {
             fprintf(stderr, "+ %s", config->output_file);
             for (kefir_size_t i = 1; i < argv.length; i++) {
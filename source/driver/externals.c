@@ -19,6 +19,7 @@
 */
 
 #include "kefir/driver/externals.h"
+#include "kefir/driver/configuration.h"
 #include "kefir/core/error.h"
 #include "kefir/core/util.h"
 #include <string.h>
@@ -53,6 +54,17 @@ kefir_result_t kefir_driver_external_resources_init_from_env(struct kefir_mem *m
     const char *driver_cli_quiet = getenv_nonzero("KEFIR_DRIVER_CLI_QUIET");
     externals->driver_cli_quiet = driver_cli_quiet != NULL && strcmp(driver_cli_quiet, "yes") == 0;
 
+    externals->parallel_jobs = 0;
+    const char *parallel_jobs = getenv_nonzero("KEFIR_JOBS");
+    if (parallel_jobs != NULL) {
+        kefir_result_t res = kefir_driver_parse_parallel_jobs(parallel_jobs, &externals->parallel_jobs);
+        if (res == KEFIR_UI_ERROR) {
+            res = KEFIR_SET_ERRORF(KEFIR_UI_ERROR, "Invalid KEFIR_JOBS environment variable value '%s'",
+                                   parallel_jobs);
+        }
+        REQUIRE_OK(res);
+    }
+
     externals->assembler_path_explicit = false;
     externals->assembler_path = getenv_nonzero("KEFIR_AS");
     if (externals->assembler_path == NULL) {
@@ -87,6 +99,7 @@ kefir_result_t kefir_driver_external_resources_init_from_env(struct kefir_mem *m
     }
 
     externals->runtime_include = getenv_nonzero("KEFIR_RTINC");
+    externals->runtime_cache_directory = getenv_nonzero("KEFIR_RUNTIME_CACHE");
     externals->musl.include_path = getenv_nonzero("KEFIR_MUSL_INCLUDE");
     externals->musl.library_path = getenv_nonzero("KEFIR_MUSL_LIB");
     externals->musl.dynamic_linker = getenv_nonzero("KEFIR_MUSL_DYNAMIC_LINKER");
@@ -221,6 +221,14 @@ kefir_result_t kefir_driver_parse_args(struct kefir_mem *mem, struct kefir_strin
                 res = KEFIR_SET_ERRORF(KEFIR_UI_ERROR, "Unknown target '%s'", target);
             }
             REQUIRE_OK(res);
+        } else if (strcmp("-j", arg) == 0 || strcmp("--jobs", arg) == 0) {
+            // Number of parallel compilation jobs
+            EXPECT_ARG;
+            REQUIRE_OK(kefir_driver_parse_parallel_jobs(argv[++index], &config->parallel_jobs));
+        } else if (STRNCMP("--jobs=", arg) == 0) {
+            REQUIRE_OK(kefir_driver_parse_parallel_jobs(&arg[7], &config->parallel_jobs));
+        } else if (STRNCMP("-j", arg) == 0 && isdigit(arg[2])) {
+            REQUIRE_OK(kefir_driver_parse_parallel_jobs(&arg[2], &config->parallel_jobs));
         } else if (strcmp("--restrictive-c", arg) == 0) {
             // Enable restrictive compiler mode
             config->flags.restrictive_mode = true;
@@ -265,10 +273,24 @@ kefir_result_t kefir_driver_parse_args(struct kefir_mem *mem, struct kefir_strin
             config->flags.omit_frame_pointer = KEFIR_DRIVER_FRAME_POINTER_OMISSION_DISABLE;
         } else if (strcmp("-fomit-frame-pointer", arg) == 0) {
             config->flags.omit_frame_pointer = KEFIR_DRIVER_FRAME_POINTER_OMISSION_ENABLE;
+        } else if (strcmp("-fintegrated-as", arg) == 0) {
+            config->flags.integrated_assembler = true;
+        } else if (strcmp("-fno-integrated-as", arg) == 0) {
+            config->flags.integrated_assembler = false;
         } else if (strcmp("-ffast-math", arg) == 0) {
             config->flags.fast_math = true;
         } else if (strcmp("-fcx-limited-range", arg) == 0) {
             config->flags.cx_limited_range = true;
+        } else if (strcmp("-fstrict-aliasing", arg) == 0) {
+            config->flags.strict_aliasing = true;
+        } else if (strcmp("-fno-strict-aliasing", arg) == 0) {
+            config->flags.strict_aliasing = false;
+        } else if (strcmp("-ftime-report", arg) == 0) {
+            config->flags.time_report = KEFIR_DRIVER_TIME_REPORT_TABULAR;
+        } else if (strcmp("-ftime-report=json", arg) == 0) {
+            config->flags.time_report = KEFIR_DRIVER_TIME_REPORT_JSON;
+        } else if (strcmp("-fno-time-report", arg) == 0) {
+            config->flags.time_report = KEFIR_DRIVER_TIME_REPORT_NONE;
         } else if (strcmp("-g", arg) == 0 || strcmp("-ggdb", arg) == 0) {
             config->flags.debug_info = true;
         } else if (STRNCMP("-ggdb", arg) == 0) {
@@ -145,6 +145,20 @@ static kefir_result_t unload_extension_lib(void *extlib) {
     return KEFIR_OK;
 }
 
+static kefir_result_t output_time_report(const struct kefir_compiler_runner_configuration *options,
+                                         const struct kefir_time_report *time_report) {
+    if (options->time_report == KEFIR_COMPILER_RUNNER_TIME_REPORT_JSON) {
+        struct kefir_json_output json;
+        REQUIRE_OK(kefir_json_output_init(&json, stderr, 4));
+        REQUIRE_OK(kefir_time_report_format_json(time_report, &json));
+        REQUIRE_OK(kefir_json_output_finalize(&json));
+        fprintf(stderr, "\n");
+    } else {
+        REQUIRE_OK(kefir_time_report_format(time_report, stderr));
+    }
+    return KEFIR_OK;
+}
+
 static kefir_result_t dump_action_impl(struct kefir_mem *mem, const struct kefir_compiler_runner_configuration *options,
                                        kefir_result_t (*action)(struct kefir_mem *,
                                                                 const struct kefir_compiler_runner_configuration *,
@@ -157,6 +171,15 @@ static kefir_result_t dump_action_impl(struct kefir_mem *mem, const struct kefir
     struct kefir_compiler_context compiler;
     struct kefir_preprocessor_filesystem_source_locator filesystem_source_locator;
     struct kefir_preprocessor_dependencies_source_locator dependencies_source_locator;
+    struct kefir_time_report time_report;
+    struct kefir_time_report *time_report_ptr = NULL;
+    struct kefir_mem *time_report_mem = mem;
+
+    if (options->time_report != KEFIR_COMPILER_RUNNER_TIME_REPORT_NONE) {
+        REQUIRE_OK(kefir_time_report_init(time_report_mem, &time_report));
+        time_report_ptr = &time_report;
+        mem = &time_report.allocator;
+    }
 
     const char *source_id = NULL;
     if (options->source_id != NULL) {
@@ -268,6 +291,7 @@ static kefir_result_t dump_action_impl(struct kefir_mem *mem, const struct kefir
     compiler.translator_configuration.precise_bitfield_load_store = options->features.precise_bitfield_load_store;
     compiler.translator_configuration.optimize_stack_frame = options->features.optimize_stack_frame;
     compiler.translator_configuration.cx_limited_range = options->optimizer.cx_limited_range;
+    compiler.translator_configuration.strict_aliasing = options->optimizer.strict_aliasing;
 
     compiler.codegen_configuration.emulated_tls = options->codegen.emulated_tls;
     compiler.codegen_configuration.position_independent_code = options->codegen.position_independent_code;
@@ -275,13 +299,25 @@ static kefir_result_t dump_action_impl(struct kefir_mem *mem, const struct kefir
     compiler.codegen_configuration.omit_frame_pointer = options->codegen.omit_frame_pointer;
     compiler.codegen_configuration.valgrind_compatible_x87 = options->codegen.valgrind_compatible_x87;
     compiler.codegen_configuration.syntax = options->codegen.syntax;
+    compiler.codegen_configuration.integrated_assembler = options->codegen.integrated_assembler;
+    compiler.codegen_configuration.code_layout = options->codegen.code_layout;
+    compiler.codegen_configuration.red_zone = options->codegen.red_zone;
+    compiler.codegen_configuration.shrink_wrap = options->codegen.shrink_wrap;
+    compiler.codegen_configuration.live_range_split = options->codegen.live_range_split;
+    compiler.codegen_configuration.inline_memory_builtins = options->codegen.inline_memory_builtins;
+    compiler.codegen_configuration.streaming = options->codegen.streaming;
     compiler.codegen_configuration.print_details = options->codegen.print_details;
     compiler.codegen_configuration.optimization = options->codegen.optimization;
+    compiler.codegen_configuration.time_report = time_report_ptr;
+    compiler.runtime_cache_directory = options->codegen.runtime_cache_directory;
+    compiler.time_report = time_report_ptr;
 
     compiler.optimizer_configuration.imprecise_decimal_bitint_conv = options->codegen.imprecise_decimal_bitint_conv;
     compiler.optimizer_configuration.debug_info = options->debug_info;
     compiler.optimizer_configuration.max_inline_depth = options->optimizer.max_inline_depth;
     compiler.optimizer_configuration.max_inlines_per_function = options->optimizer.max_inlines_per_function;
+    compiler.optimizer_configuration.max_inline_cost = options->optimizer.max_inline_cost;
+    compiler.optimizer_configuration.time_report = time_report_ptr;
     switch (options->codegen.decimal_encoding) {
         case KEFIR_COMPILER_RUNNER_DECIMAL_ENCODING_DEFAULT:
             compiler.optimizer_configuration.decimal_encoding = profile.type_traits.data_model->decimal_encoding;
@@ -349,6 +385,10 @@ static kefir_result_t dump_action_impl(struct kefir_mem *mem, const struct kefir
     REQUIRE_OK(kefir_preprocessor_filesystem_source_locator_free(mem, &filesystem_source_locator));
     REQUIRE_OK(kefir_string_pool_free(mem, &symbols));
     REQUIRE_OK(kefir_cli_input_close(mem, &input));
+    if (time_report_ptr != NULL) {
+        REQUIRE_OK(output_time_report(options, time_report_ptr));
+        REQUIRE_OK(kefir_time_report_free(time_report_mem, time_report_ptr));
+    }
     return KEFIR_OK;
 }
 
@@ -534,14 +574,22 @@ static kefir_result_t format_macro_definition(const struct kefir_preprocessor_ma
     return KEFIR_OK;
 }
 
+struct format_macro_definitions_payload {
+    struct kefir_mem *mem;
+    FILE *output;
+};
+
 static kefir_result_t format_macro_definitions(struct kefir_preprocessor *preprocessor, void *payload) {
     REQUIRE(preprocessor != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid preprocessor"));
-    ASSIGN_DECL_CAST(FILE *, output, payload);
-    REQUIRE(output != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid file output"));
+    ASSIGN_DECL_CAST(struct format_macro_definitions_payload *, format_payload, payload);
+    REQUIRE(format_payload != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid preprocessor macro formatter payload"));
 
+    REQUIRE_OK(kefir_preprocessor_user_macro_scope_load_replacements(format_payload->mem, &preprocessor->lexer,
+                                                                     &preprocessor->context->user_macros));
     REQUIRE_OK(preprocessor->macro_overlay.scope.iterate(
         &preprocessor->macro_overlay.scope, format_macro_definition,
-        &(struct format_macro_definition_payload) {.preprocessor = preprocessor, .output = output}));
+        &(struct format_macro_definition_payload) {.preprocessor = preprocessor, .output = format_payload->output}));
     return KEFIR_OK;
 }
 
@@ -562,7 +610,8 @@ static kefir_result_t dump_preprocessed_impl(struct kefir_mem *mem,
     REQUIRE_OK(kefir_compiler_preprocess(
         mem, compiler, options->skip_preprocessor ? KEFIR_PREPROCESSOR_MODE_MINIMAL : KEFIR_PREPROCESSOR_MODE_NORMAL,
         &token_allocator, &tokens, source, length, source_id, options->input_filepath,
-        options->output_defined_macros ? format_macro_definitions : NULL, output));
+        options->output_defined_macros ? format_macro_definitions : NULL,
+        &(struct format_macro_definitions_payload) {.mem = mem, .output = output}));
     if (output != NULL && !options->output_defined_macros) {
         REQUIRE_OK(kefir_preprocessor_format(output, &tokens, options->features.preprocessor_linemarkers,
                                              KEFIR_PREPROCESSOR_WHITESPACE_FORMAT_ORIGINAL));
@@ -730,6 +779,23 @@ static kefir_result_t action_dump_opt(struct kefir_mem *mem,
     return KEFIR_OK;
 }
 
+static kefir_result_t output_codegen_kind(const struct kefir_compiler_runner_configuration *options,
+                                          const struct kefir_compiler_context *compiler) {
+    FILE *output_kind;
+    REQUIRE_OK(open_output(options->output_kind_filepath, &output_kind));
+    switch (compiler->codegen_output_kind) {
+        case KEFIR_CODEGEN_OUTPUT_ASSEMBLY:
+            fprintf(output_kind, "assembly\n");
+            break;
+
+        case KEFIR_CODEGEN_OUTPUT_OBJECT:
+            fprintf(output_kind, "object\n");
+            break;
+    }
+    REQUIRE(fclose(output_kind) == 0, KEFIR_SET_OS_ERROR("Unable to write output kind file"));
+    return KEFIR_OK;
+}
+
 static kefir_result_t dump_asm_impl(struct kefir_mem *mem, const struct kefir_compiler_runner_configuration *options,
                                     struct kefir_compiler_context *compiler, const char *source_id, const char *source,
                                     kefir_size_t length, FILE *output) {
@@ -758,13 +824,20 @@ static kefir_result_t dump_asm_impl(struct kefir_mem *mem, const struct kefir_co
 
     REQUIRE_OK(kefir_opt_module_init(mem, &module, &opt_module));
     if (compiler->profile->optimizer_enabled) {
-        REQUIRE_OK(kefir_compiler_optimize(mem, compiler, &module, &opt_module));
-        if (output != NULL) {
-            REQUIRE_OK(kefir_compiler_codegen_optimized(mem, compiler, &opt_module, output));
+        if (output != NULL && compiler->codegen_configuration.streaming) {
+            REQUIRE_OK(kefir_compiler_codegen_streaming(mem, compiler, &opt_module, output));
+        } else {
+            REQUIRE_OK(kefir_compiler_optimize(mem, compiler, &module, &opt_module));
+            if (output != NULL) {
+                REQUIRE_OK(kefir_compiler_codegen_optimized(mem, compiler, &opt_module, output));
+            }
         }
     } else if (output != NULL) {
         REQUIRE_OK(kefir_compiler_codegen(mem, compiler, &module, output));
     }
+    if (output != NULL && options->output_kind_filepath != NULL) {
+        REQUIRE_OK(output_codegen_kind(options, compiler));
+    }
 
     REQUIRE_OK(kefir_opt_module_free(mem, &opt_module));
     REQUIRE_OK(kefir_ir_module_free(mem, &module));
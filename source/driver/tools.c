@@ -95,6 +95,9 @@ static kefir_result_t output_compiler_config(FILE *output,
     if (configuration->output_filepath != NULL) {
         fprintf(output, " -o %s", configuration->output_filepath);
     }
+    if (configuration->output_kind_filepath != NULL) {
+        fprintf(output, " --output-kind %s", configuration->output_kind_filepath);
+    }
     if (configuration->target_profile != NULL) {
         fprintf(output, " --target-profile %s", configuration->target_profile);
     }
@@ -112,6 +115,20 @@ static kefir_result_t output_compiler_config(FILE *output,
             break;
     }
 
+    switch (configuration->time_report) {
+        case KEFIR_COMPILER_RUNNER_TIME_REPORT_NONE:
+            // Intentionally left blank
+            break;
+
+        case KEFIR_COMPILER_RUNNER_TIME_REPORT_TABULAR:
+            fprintf(output, " --time-report");
+            break;
+
+        case KEFIR_COMPILER_RUNNER_TIME_REPORT_JSON:
+            fprintf(output, " --time-report-json");
+            break;
+    }
+
     if (configuration->debug_info) {
         fprintf(output, " --debug-info");
     }
@@ -189,6 +206,10 @@ static kefir_result_t output_compiler_config(FILE *output,
         fprintf(output, " --opt-cx-limited-range");
     }
 
+    if (!configuration->optimizer.strict_aliasing) {
+        fprintf(output, " --no-opt-strict-aliasing");
+    }
+
 #define FEATURE(_id, _name)                         \
     if (configuration->features._id) {              \
         fprintf(output, " --feature-%s", _name);    \
@@ -231,6 +252,12 @@ static kefir_result_t output_compiler_config(FILE *output,
     CODEGEN(position_independent_code, "pic")
     CODEGEN(omit_frame_pointer, "omit-frame-pointer")
     CODEGEN(valgrind_compatible_x87, "valgrind-compatible-x87")
+    CODEGEN(code_layout, "code-layout")
+    CODEGEN(red_zone, "red-zone")
+    CODEGEN(shrink_wrap, "shrink-wrap")
+    CODEGEN(live_range_split, "live-range-split")
+    CODEGEN(inline_memory_builtins, "inline-memory-builtins")
+    CODEGEN(streaming, "streaming")
 
 #undef CODEGEN
 
@@ -276,6 +303,9 @@ static kefir_result_t output_compiler_config(FILE *output,
     if (configuration->codegen.print_details != NULL) {
         fprintf(output, " --codegen-details %s", configuration->codegen.print_details);
     }
+    if (configuration->codegen.runtime_cache_directory != NULL) {
+        fprintf(output, " --codegen-runtime-cache %s", configuration->codegen.runtime_cache_directory);
+    }
     if (configuration->codegen.optimization == KEFIR_CODEGEN_OPTIMIZATION_NONE) {
         fprintf(output, " --codegen-no-optimize");
     } else if (configuration->codegen.optimization == KEFIR_CODEGEN_OPTIMIZATION_FULL) {
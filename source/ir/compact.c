@@ -269,6 +269,7 @@ static kefir_result_t compact_data(struct kefir_mem *mem, struct kefir_ir_data *
             case KEFIR_IR_DATA_VALUE_RAW:
             case KEFIR_IR_DATA_VALUE_AGGREGATE:
             case KEFIR_IR_DATA_VALUE_BITS:
+            case KEFIR_IR_DATA_VALUE_PACKED:
             case KEFIR_IR_DATA_VALUE_STRING_POINTER:
                 // Intentionally left blank
                 break;
@@ -25,6 +25,7 @@
 
 #define BLOCK_CAPACITY 128
 #define BLOCK_SIZE (BLOCK_CAPACITY * sizeof(struct kefir_ir_data_value))
+#define PACKED_ARRAY_MIN_LENGTH 32
 
 static kefir_result_t on_block_init(struct kefir_mem *mem, struct kefir_block_tree *tree, kefir_size_t block_id,
                                     void *block, void *payload) {
@@ -53,6 +54,8 @@ static kefir_result_t on_block_removal(struct kefir_mem *mem, struct kefir_block
     for (kefir_size_t i = 0; i < BLOCK_CAPACITY; i++) {
         if (value_block[i].type == KEFIR_IR_DATA_VALUE_BITS) {
             KEFIR_FREE(mem, value_block[i].value.bits.bits);
+        } else if (value_block[i].type == KEFIR_IR_DATA_VALUE_PACKED) {
+            KEFIR_FREE(mem, (void *) value_block[i].value.raw.data);
         }
     }
 
@@ -473,6 +476,133 @@ static kefir_result_t finalize_struct_union(const struct kefir_ir_type *type, ke
     return KEFIR_OK;
 }
 
+static kefir_size_t packed_element_size(const struct kefir_ir_typeentry *typeentry) {
+    kefir_size_t size = 0;
+    switch (typeentry->typecode) {
+        case KEFIR_IR_TYPE_INT8:
+            size = 1;
+            break;
+
+        case KEFIR_IR_TYPE_INT16:
+            size = 2;
+            break;
+
+        case KEFIR_IR_TYPE_INT32:
+        case KEFIR_IR_TYPE_FLOAT32:
+            size = 4;
+            break;
+
+        case KEFIR_IR_TYPE_INT64:
+        case KEFIR_IR_TYPE_FLOAT64:
+            size = 8;
+            break;
+
+        default:
+            return 0;
+    }
+    return typeentry->alignment <= size ? size : 0;
+}
+
+static kefir_result_t pack_array_element(const struct kefir_ir_typeentry *element_typeentry,
+                                         const struct kefir_ir_data_value *value, void *target, kefir_bool_t *packed) {
+    switch (element_typeentry->typecode) {
+        case KEFIR_IR_TYPE_INT8:
+            REQUIRE(value->type == KEFIR_IR_DATA_VALUE_INTEGER, KEFIR_OK);
+            *(kefir_uint8_t *) target = (kefir_uint8_t) value->value.integer;
+            break;
+
+        case KEFIR_IR_TYPE_INT16:
+            REQUIRE(value->type == KEFIR_IR_DATA_VALUE_INTEGER, KEFIR_OK);
+            *(kefir_uint16_t *) target = (kefir_uint16_t) value->value.integer;
+            break;
+
+        case KEFIR_IR_TYPE_INT32:
+            REQUIRE(value->type == KEFIR_IR_DATA_VALUE_INTEGER, KEFIR_OK);
+            *(kefir_uint32_t *) target = (kefir_uint32_t) value->value.integer;
+            break;
+
+        case KEFIR_IR_TYPE_INT64:
+            REQUIRE(value->type == KEFIR_IR_DATA_VALUE_INTEGER, KEFIR_OK);
+            *(kefir_uint64_t *) target = (kefir_uint64_t) value->value.integer;
+            break;
+
+        case KEFIR_IR_TYPE_FLOAT32:
+            REQUIRE(value->type == KEFIR_IR_DATA_VALUE_FLOAT32, KEFIR_OK);
+            *(kefir_float32_t *) target = value->value.float32;
+            break;
+
+        case KEFIR_IR_TYPE_FLOAT64:
+            REQUIRE(value->type == KEFIR_IR_DATA_VALUE_FLOAT64, KEFIR_OK);
+            *(kefir_float64_t *) target = value->value.float64;
+            break;
+
+        default:
+            return KEFIR_OK;
+    }
+    *packed = true;
+    return KEFIR_OK;
+}
+
+static kefir_result_t pack_array(struct kefir_mem *mem, struct kefir_ir_data *data,
+                                 const struct kefir_ir_typeentry *element_typeentry, kefir_size_t array_slot,
+                                 kefir_size_t length) {
+    const kefir_size_t element_size = packed_element_size(element_typeentry);
+    REQUIRE(element_size > 0, KEFIR_OK);
+
+    // Sparse arrays are left as is, so that undefined ranges are still emitted as zero fill
+    kefir_size_t defined_elements = 0;
+    for (kefir_size_t i = 0; i < length; i++) {
+        struct kefir_ir_data_value *value;
+        REQUIRE_OK(value_get_entry(data, array_slot + 1 + i, &value));
+        if (value != NULL && value->type != KEFIR_IR_DATA_VALUE_UNDEFINED) {
+            defined_elements++;
+        }
+    }
+    REQUIRE(defined_elements * 2 >= length, KEFIR_OK);
+
+    kefir_uint8_t *content = KEFIR_MALLOC(mem, element_size * length);
+    REQUIRE(content != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate packed IR data"));
+    memset(content, 0, element_size * length);
+
+    for (kefir_size_t i = 0; i < length; i++) {
+        struct kefir_ir_data_value *value;
+        kefir_result_t res = value_get_entry(data, array_slot + 1 + i, &value);
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            KEFIR_FREE(mem, content);
+            return res;
+        });
+        if (value == NULL || value->type == KEFIR_IR_DATA_VALUE_UNDEFINED) {
+            continue;
+        }
+
+        kefir_bool_t packed = false;
+        res = pack_array_element(element_typeentry, value, &content[i * element_size], &packed);
+        REQUIRE_ELSE(res == KEFIR_OK && packed, {
+            KEFIR_FREE(mem, content);
+            return res;
+        });
+    }
+
+    for (kefir_size_t i = 0; i < length; i++) {
+        struct kefir_ir_data_value *value;
+        REQUIRE_OK(value_get_entry(data, array_slot + 1 + i, &value));
+        if (value != NULL) {
+            *value = (struct kefir_ir_data_value) {.type = KEFIR_IR_DATA_VALUE_UNDEFINED};
+        }
+    }
+
+    struct kefir_ir_data_value *entry;
+    kefir_result_t res = value_entry_at(mem, data, array_slot, &entry);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(mem, content);
+        return res;
+    });
+    entry->type = KEFIR_IR_DATA_VALUE_PACKED;
+    entry->value.raw.data = content;
+    entry->value.raw.length = element_size * length;
+    return KEFIR_OK;
+}
+
 static kefir_result_t finalize_array(const struct kefir_ir_type *type, kefir_size_t index,
                                      const struct kefir_ir_typeentry *typeentry, void *payload) {
     REQUIRE(payload != NULL, KEFIR_SET_ERROR(KEFIR_INTERNAL_ERROR, "Expected valid payload"));
@@ -514,6 +644,19 @@ static kefir_result_t finalize_array(const struct kefir_ir_type *type, kefir_siz
     param->slot = subparam.slot;
     param->block_iterator = subparam.block_iterator;
 
+    if (subparam.defined && (entry == NULL || entry->type == KEFIR_IR_DATA_VALUE_UNDEFINED) &&
+        array_element_slots == 1 && (kefir_size_t) typeentry->param >= PACKED_ARRAY_MIN_LENGTH) {
+        // Long arrays of scalars are stored as contiguous byte buffers in target layout rather than as separate values
+        REQUIRE_OK(pack_array(param->mem, param->data, kefir_ir_type_at(type, index + 1), entry_slot,
+                              (kefir_size_t) typeentry->param));
+        REQUIRE_OK(value_get_entry(param->data, entry_slot, &entry));
+        if (entry != NULL && entry->type == KEFIR_IR_DATA_VALUE_PACKED) {
+            entry->defined = true;
+            param->defined = true;
+            return KEFIR_OK;
+        }
+    }
+
     if (subparam.defined && entry == NULL) {
         REQUIRE_OK(value_entry_at(param->mem, param->data, entry_slot, &entry));
     }
@@ -530,6 +673,28 @@ static kefir_result_t finalize_array(const struct kefir_ir_type *type, kefir_siz
     return KEFIR_OK;
 }
 
+static kefir_result_t drop_undefined_blocks(struct kefir_mem *mem, struct kefir_ir_data *data) {
+    const kefir_size_t num_of_blocks = (data->total_length + BLOCK_CAPACITY - 1) / BLOCK_CAPACITY;
+    for (kefir_size_t block_id = 0; block_id < num_of_blocks; block_id++) {
+        void *block;
+        kefir_result_t res = kefir_block_tree_get_block(&data->value_tree, block_id, &block);
+        if (res == KEFIR_NOT_FOUND) {
+            continue;
+        }
+        REQUIRE_OK(res);
+
+        ASSIGN_DECL_CAST(const struct kefir_ir_data_value *, value_block, block);
+        kefir_bool_t undefined_block = true;
+        for (kefir_size_t i = 0; undefined_block && i < BLOCK_CAPACITY; i++) {
+            undefined_block = value_block[i].type == KEFIR_IR_DATA_VALUE_UNDEFINED;
+        }
+        if (undefined_block) {
+            REQUIRE_OK(kefir_block_tree_drop_block(mem, &data->value_tree, block_id));
+        }
+    }
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_ir_data_finalize(struct kefir_mem *mem, struct kefir_ir_data *data) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(data != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR data pointer"));
@@ -545,6 +710,7 @@ kefir_result_t kefir_ir_data_finalize(struct kefir_mem *mem, struct kefir_ir_dat
     visitor.visit[KEFIR_IR_TYPE_UNION] = finalize_struct_union;
     visitor.visit[KEFIR_IR_TYPE_ARRAY] = finalize_array;
     REQUIRE_OK(kefir_ir_type_visitor_list_nodes(data->type, &visitor, &param, 0, kefir_ir_type_length(data->type)));
+    REQUIRE_OK(drop_undefined_blocks(mem, data));
     data->finalized = true;
     data->defined = param.defined;
     return KEFIR_OK;
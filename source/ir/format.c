@@ -1342,6 +1342,16 @@ static kefir_result_t format_datum(struct kefir_json_output *json, const struct
                 }
                 REQUIRE_OK(kefir_json_output_array_end(json));
                 break;
+
+            case KEFIR_IR_DATA_VALUE_PACKED:
+                REQUIRE_OK(kefir_json_output_string(json, "packed"));
+                REQUIRE_OK(kefir_json_output_object_key(json, "value"));
+                REQUIRE_OK(kefir_json_output_array_begin(json));
+                for (kefir_size_t i = 0; i < value->value.raw.length; i++) {
+                    REQUIRE_OK(kefir_json_output_uinteger(json, ((const kefir_uint8_t *) value->value.raw.data)[i]));
+                }
+                REQUIRE_OK(kefir_json_output_array_end(json));
+                break;
         }
         if (value->type != KEFIR_IR_DATA_VALUE_UNDEFINED) {
             REQUIRE_OK(kefir_json_output_object_end(json));
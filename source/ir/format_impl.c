@@ -48,6 +48,7 @@ kefir_result_t kefir_ir_format_instr(struct kefir_json_output *json, const struc
 #define TYPE_FMT_typeref typeref
 #define TYPE_FMT_typed_ref2 typeref
 #define TYPE_FMT_branch branch
+#define TYPE_FMT_switch u64_2
 #define TYPE_FMT_call_ref funcref
 #define TYPE_FMT_immediate immediate
 #define TYPE_FMT_none none
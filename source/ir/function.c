@@ -69,10 +69,12 @@ kefir_result_t kefir_ir_function_alloc(struct kefir_mem *mem, struct kefir_ir_fu
     func->flags.constructor = false;
     func->flags.destructor = false;
     func->flags.inline_function = false;
+    func->flags.no_inline = false;
     func->flags.enable_fenv_access = false;
     func->flags.disallow_fp_contract = false;
     func->flags.cx_limited_range = false;
-    kefir_result_t res = kefir_ir_function_debug_info_init(&func->debug_info);
+    kefir_result_t res = kefir_hashtreeset_init(&func->restrict_parameters, &kefir_hashtree_uint_ops);
+    REQUIRE_CHAIN(&res, kefir_ir_function_debug_info_init(&func->debug_info));
     REQUIRE_CHAIN(&res, kefir_irblock_alloc(mem, bodySz, &func->body));
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_ir_function_decl_free(mem, func->declaration);
@@ -85,6 +87,7 @@ kefir_result_t kefir_ir_function_free(struct kefir_mem *mem, struct kefir_ir_fun
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR function pointer"));
     REQUIRE_OK(kefir_ir_function_debug_info_free(mem, &func->debug_info));
+    REQUIRE_OK(kefir_hashtreeset_free(mem, &func->restrict_parameters));
     kefir_irblock_free(mem, &func->body);
     func->declaration = NULL;
     return KEFIR_OK;
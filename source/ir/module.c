@@ -652,6 +652,24 @@ const struct kefir_ir_function *kefir_ir_module_get_function(const struct kefir_
     return (const struct kefir_ir_function *) node->value;
 }
 
+kefir_result_t kefir_ir_module_release_function_body(struct kefir_mem *mem, struct kefir_ir_module *module,
+                                                    const char *identifier) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR module"));
+    REQUIRE(identifier != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR function identifier"));
+
+    struct kefir_hashtree_node *node = NULL;
+    kefir_result_t res = kefir_hashtree_at(&module->functions, (kefir_hashtree_key_t) identifier, &node);
+    if (res == KEFIR_NOT_FOUND) {
+        res = KEFIR_SET_ERROR(KEFIR_NOT_FOUND, "Unable to find requested IR function");
+    }
+    REQUIRE_OK(res);
+
+    ASSIGN_DECL_CAST(struct kefir_ir_function *, func, node->value);
+    REQUIRE_OK(kefir_irblock_free(mem, &func->body));
+    return KEFIR_OK;
+}
+
 struct kefir_ir_type *kefir_ir_module_get_named_type(const struct kefir_ir_module *module, kefir_id_t id) {
     REQUIRE(module != NULL, NULL);
     struct kefir_hashtree_node *node = NULL;
@@ -973,6 +973,18 @@ kefir_result_t kefir_token_format(struct kefir_json_output *json, const struct k
             REQUIRE_OK(format_pragma(json, token->pragma->pragma, token->pragma->pragma_param));
             break;
 
+        case KEFIR_TOKEN_EMBED:
+            REQUIRE_OK(kefir_json_output_string(json, "embed"));
+            REQUIRE_OK(kefir_json_output_object_key(json, "preprocessor"));
+            REQUIRE_OK(kefir_json_output_boolean(json, false));
+            REQUIRE_OK(kefir_json_output_object_key(json, "content"));
+            REQUIRE_OK(kefir_json_output_array_begin(json));
+            for (kefir_size_t i = 0; i < token->embed->length; i++) {
+                REQUIRE_OK(kefir_json_output_uinteger(json, token->embed->content[i]));
+            }
+            REQUIRE_OK(kefir_json_output_array_end(json));
+            break;
+
         case KEFIR_TOKEN_KEYWORD:
             REQUIRE_OK(kefir_json_output_string(json, "keyword"));
             REQUIRE_OK(kefir_json_output_object_key(json, "preprocessor"));
@@ -22,71 +22,203 @@
 #include "kefir/core/util.h"
 #include "kefir/core/error.h"
 #include "kefir/core/string_buffer.h"
+#include "kefir/core/hash.h"
 #include "kefir/util/char32.h"
 #include <string.h>
 
-kefir_result_t kefir_token_macro_expansions_init(struct kefir_token_macro_expansions *expansions) {
-    REQUIRE(expansions != NULL,
-            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to token macro expansions"));
+#define MACRO_EXPANSIONS_SIZEOF(_length) \
+    (sizeof(struct kefir_token_macro_expansions) + (_length) * sizeof(const char *))
+
+static kefir_hashtable_hash_t macro_expansions_hash(kefir_hashtable_key_t key, void *payload) {
+    UNUSED(payload);
+    ASSIGN_DECL_CAST(const struct kefir_token_macro_expansions *, expansions, key);
+    return expansions->hash;
+}
+
+static kefir_bool_t macro_expansions_equal(kefir_hashtable_key_t key1, kefir_hashtable_key_t key2, void *payload) {
+    UNUSED(payload);
+    ASSIGN_DECL_CAST(const struct kefir_token_macro_expansions *, expansions1, key1);
+    ASSIGN_DECL_CAST(const struct kefir_token_macro_expansions *, expansions2, key2);
+    return expansions1->hash == expansions2->hash && expansions1->length == expansions2->length &&
+           memcmp(expansions1->identifiers, expansions2->identifiers,
+                  expansions1->length * sizeof(const char *)) == 0;
+}
+
+static const struct kefir_hashtable_ops macro_expansions_ops = {
+    .hash = macro_expansions_hash, .equal = macro_expansions_equal, .payload = NULL};
+
+kefir_result_t kefir_token_macro_expansions_pool_init(struct kefir_token_macro_expansions_pool *pool) {
+    REQUIRE(pool != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to token macro expansions pool"));
 
-    REQUIRE_OK(kefir_hashtree_init(&expansions->macro_expansions, &kefir_hashtree_str_ops));
+    REQUIRE_OK(kefir_hashtable_init(&pool->macro_expansions, &macro_expansions_ops));
+    pool->scratch = NULL;
+    pool->scratch_capacity = 0;
     return KEFIR_OK;
 }
 
-kefir_result_t kefir_token_macro_expansions_free(struct kefir_mem *mem,
-                                                 struct kefir_token_macro_expansions *expansions) {
+kefir_result_t kefir_token_macro_expansions_pool_free(struct kefir_mem *mem,
+                                                      struct kefir_token_macro_expansions_pool *pool) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
-    REQUIRE(expansions != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected token macro expansions"));
+    REQUIRE(pool != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid token macro expansions pool"));
+
+    // Macro expansion sets still referenced by tokens outlive the pool and are freed on their last release
+    struct kefir_hashtable_iterator iter;
+    kefir_hashtable_key_t key;
+    kefir_result_t res;
+    for (res = kefir_hashtable_iter(&pool->macro_expansions, &iter, &key, NULL); res == KEFIR_OK;
+         res = kefir_hashtable_next(&iter, &key, NULL)) {
+        ASSIGN_DECL_CAST(struct kefir_token_macro_expansions *, expansions, key);
+        expansions->pool = NULL;
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+
+    REQUIRE_OK(kefir_hashtable_free(mem, &pool->macro_expansions));
+    KEFIR_FREE(mem, pool->scratch);
+    pool->scratch = NULL;
+    pool->scratch_capacity = 0;
+    return KEFIR_OK;
+}
 
-    REQUIRE_OK(kefir_hashtree_free(mem, &expansions->macro_expansions));
+static kefir_result_t ensure_scratch_capacity(struct kefir_mem *mem, struct kefir_token_macro_expansions_pool *pool,
+                                              kefir_size_t capacity) {
+    if (capacity > pool->scratch_capacity) {
+        capacity = MAX(capacity, pool->scratch_capacity * 2);
+        struct kefir_token_macro_expansions *scratch =
+            KEFIR_REALLOC(mem, pool->scratch, MACRO_EXPANSIONS_SIZEOF(capacity));
+        REQUIRE(scratch != NULL,
+                KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate token macro expansions buffer"));
+        pool->scratch = scratch;
+        pool->scratch_capacity = capacity;
+    }
     return KEFIR_OK;
 }
 
-kefir_result_t kefir_token_macro_expansions_add(struct kefir_mem *mem, struct kefir_token_macro_expansions **expansions,
-                                                const char *identifier) {
+kefir_result_t kefir_token_macro_expansions_pool_union(struct kefir_mem *mem,
+                                                       struct kefir_token_macro_expansions_pool *pool,
+                                                       const struct kefir_token_macro_expansions *expansions1,
+                                                       const struct kefir_token_macro_expansions *expansions2,
+                                                       const char *identifier,
+                                                       struct kefir_token_macro_expansions **result_ptr) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
-    REQUIRE(expansions != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid token macro expansions"));
-    REQUIRE(identifier != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid identifier"));
-
-    if (*expansions == NULL) {
-        *expansions = KEFIR_MALLOC(mem, sizeof(struct kefir_token_macro_expansions));
-        kefir_result_t res = kefir_token_macro_expansions_init(*expansions);
-        REQUIRE_ELSE(res == KEFIR_OK, {
-            KEFIR_FREE(mem, *expansions);
-            return res;
-        });
+    REQUIRE(pool != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid token macro expansions pool"));
+    REQUIRE(result_ptr != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to token macro expansions"));
+
+    const kefir_size_t length1 = expansions1 != NULL ? expansions1->length : 0;
+    const kefir_size_t length2 = expansions2 != NULL ? expansions2->length : 0;
+    REQUIRE_OK(ensure_scratch_capacity(mem, pool, length1 + length2 + 1));
+
+    // Identifiers are kept sorted by address, so that equal sets have identical representation
+    struct kefir_token_macro_expansions *scratch = pool->scratch;
+    scratch->length = 0;
+    for (kefir_size_t index1 = 0, index2 = 0;;) {
+        const char *next = NULL;
+        if (index1 < length1) {
+            next = expansions1->identifiers[index1];
+        }
+        if (index2 < length2 &&
+            (next == NULL || (kefir_uptr_t) expansions2->identifiers[index2] < (kefir_uptr_t) next)) {
+            next = expansions2->identifiers[index2];
+        }
+        if (identifier != NULL && (next == NULL || (kefir_uptr_t) identifier < (kefir_uptr_t) next)) {
+            next = identifier;
+        }
+        if (next == NULL) {
+            break;
+        }
+
+        scratch->identifiers[scratch->length++] = next;
+        for (; index1 < length1 && expansions1->identifiers[index1] == next; index1++) {}
+        for (; index2 < length2 && expansions2->identifiers[index2] == next; index2++) {}
+        if (identifier == next) {
+            identifier = NULL;
+        }
+    }
+
+    if (scratch->length == 0) {
+        *result_ptr = NULL;
+        return KEFIR_OK;
+    }
+
+    kefir_hashtable_hash_t hash = scratch->length;
+    for (kefir_size_t i = 0; i < scratch->length; i++) {
+        hash = kefir_splitmix64(hash ^ (kefir_uptr_t) scratch->identifiers[i]);
     }
+    scratch->hash = hash;
 
-    kefir_result_t res = kefir_hashtree_insert(mem, &(*expansions)->macro_expansions, (kefir_hashtree_key_t) identifier,
-                                               (kefir_hashtree_value_t) 0);
-    if (res != KEFIR_ALREADY_EXISTS) {
+    kefir_hashtable_key_t existing_key;
+    kefir_result_t res =
+        kefir_hashtable_at2(&pool->macro_expansions, (kefir_hashtable_key_t) scratch, &existing_key, NULL);
+    if (res != KEFIR_NOT_FOUND) {
         REQUIRE_OK(res);
+        ASSIGN_DECL_CAST(struct kefir_token_macro_expansions *, expansions, existing_key);
+        *result_ptr = kefir_token_macro_expansions_retain(expansions);
+        return KEFIR_OK;
     }
+
+    struct kefir_token_macro_expansions *expansions = KEFIR_MALLOC(mem, MACRO_EXPANSIONS_SIZEOF(scratch->length));
+    REQUIRE(expansions != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate token macro expansions"));
+    expansions->pool = pool;
+    expansions->refcount = 1;
+    expansions->hash = hash;
+    expansions->length = scratch->length;
+    memcpy(expansions->identifiers, scratch->identifiers, scratch->length * sizeof(const char *));
+    res = kefir_hashtable_insert(mem, &pool->macro_expansions, (kefir_hashtable_key_t) expansions, 0);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(mem, expansions);
+        return res;
+    });
+    *result_ptr = expansions;
     return KEFIR_OK;
 }
 
-kefir_result_t kefir_token_macro_expansions_merge(struct kefir_mem *mem, struct kefir_token_macro_expansions **dst,
-                                                  const struct kefir_token_macro_expansions *src) {
-    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
-    REQUIRE(dst != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid destination token macro expansions"));
+struct kefir_token_macro_expansions *kefir_token_macro_expansions_retain(
+    struct kefir_token_macro_expansions *expansions) {
+    if (expansions != NULL) {
+        expansions->refcount++;
+    }
+    return expansions;
+}
 
-    if (src != NULL) {
-        struct kefir_hashtree_node_iterator iter;
-        for (const struct kefir_hashtree_node *node = kefir_hashtree_iter(&src->macro_expansions, &iter); node != NULL;
-             node = kefir_hashtree_next(&iter)) {
-            REQUIRE_OK(kefir_token_macro_expansions_add(mem, dst, (const char *) node->key));
+kefir_result_t kefir_token_macro_expansions_release(struct kefir_mem *mem,
+                                                    struct kefir_token_macro_expansions *expansions) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(expansions != NULL, KEFIR_OK);
+    REQUIRE(expansions->refcount > 0,
+            KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unexpected token macro expansions reference count"));
+
+    if (--expansions->refcount == 0) {
+        if (expansions->pool != NULL) {
+            REQUIRE_OK(kefir_hashtable_delete(mem, &expansions->pool->macro_expansions,
+                                              (kefir_hashtable_key_t) expansions));
         }
+        KEFIR_FREE(mem, expansions);
     }
     return KEFIR_OK;
 }
 
 kefir_bool_t kefir_token_macro_expansions_has(const struct kefir_token_macro_expansions *expansions,
                                               const char *identifier) {
-    REQUIRE(identifier != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid identifier"));
-
-    return expansions != NULL && kefir_hashtree_has(&expansions->macro_expansions, (kefir_hashtree_key_t) identifier);
+    REQUIRE(expansions != NULL, false);
+    REQUIRE(identifier != NULL, false);
+
+    kefir_size_t begin = 0, end = expansions->length;
+    while (begin < end) {
+        const kefir_size_t middle = begin + (end - begin) / 2;
+        if ((kefir_uptr_t) expansions->identifiers[middle] < (kefir_uptr_t) identifier) {
+            begin = middle + 1;
+        } else {
+            end = middle;
+        }
+    }
+    return begin < expansions->length && expansions->identifiers[begin] == identifier;
 }
 
+#undef MACRO_EXPANSIONS_SIZEOF
+
 kefir_result_t kefir_token_new_sentinel(struct kefir_token *token) {
     REQUIRE(token != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to token"));
     REQUIRE_OK(kefir_source_location_empty(&token->source_location));
@@ -822,6 +954,25 @@ kefir_result_t kefir_token_new_pragma(struct kefir_mem *mem, kefir_pragma_token_
     return KEFIR_OK;
 }
 
+kefir_result_t kefir_token_new_embed(struct kefir_mem *mem, const kefir_uint8_t *content, kefir_size_t length,
+                                     struct kefir_token *token) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(content != NULL || length == 0, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid embed content"));
+    REQUIRE(token != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to token"));
+    REQUIRE_OK(kefir_source_location_empty(&token->source_location));
+
+    token->embed = KEFIR_MALLOC(mem, sizeof(struct kefir_embed_token) + length);
+    REQUIRE(token->embed != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate embed token"));
+    if (length > 0) {
+        memcpy(token->embed->content, content, length);
+    }
+    token->embed->length = length;
+
+    token->klass = KEFIR_TOKEN_EMBED;
+    token->macro_expansions = NULL;
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_token_new_pp_whitespace(kefir_bool_t newline, struct kefir_token *token) {
     REQUIRE(token != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to token"));
     REQUIRE_OK(kefir_source_location_empty(&token->source_location));
@@ -961,38 +1112,21 @@ kefir_result_t kefir_token_copy(struct kefir_mem *mem, struct kefir_token *dst,
         dst->pragma = KEFIR_MALLOC(mem, sizeof(struct kefir_pragma_token));
         REQUIRE(dst->pragma != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate pragma token"));
         memcpy(dst->pragma, src->pragma, sizeof(struct kefir_pragma_token));
+    } else if (src->klass == KEFIR_TOKEN_EMBED) {
+        dst->embed = KEFIR_MALLOC(mem, sizeof(struct kefir_embed_token) + src->embed->length);
+        REQUIRE(dst->embed != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate embed token"));
+        memcpy(dst->embed, src->embed, sizeof(struct kefir_embed_token) + src->embed->length);
     }
 
-    if (src->macro_expansions != NULL) {
-        dst->macro_expansions = KEFIR_MALLOC(mem, sizeof(struct kefir_token_macro_expansions));
-        REQUIRE(dst->macro_expansions != NULL,
-                KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate token macro expansions"));
-
-        kefir_result_t res = kefir_token_macro_expansions_init(dst->macro_expansions);
-        REQUIRE_ELSE(res == KEFIR_OK, {
-            KEFIR_FREE(mem, dst->macro_expansions);
-            return res;
-        });
-        res = kefir_token_macro_expansions_merge(mem, &dst->macro_expansions, src->macro_expansions);
-        REQUIRE_ELSE(res == KEFIR_OK, {
-            kefir_token_macro_expansions_free(mem, dst->macro_expansions);
-            KEFIR_FREE(mem, dst->macro_expansions);
-            return res;
-        });
-    } else {
-        dst->macro_expansions = NULL;
-    }
+    dst->macro_expansions = kefir_token_macro_expansions_retain(src->macro_expansions);
     return KEFIR_OK;
 }
 
 kefir_result_t kefir_token_free(struct kefir_mem *mem, struct kefir_token *token) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(token != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to token"));
-    if (token->macro_expansions != NULL) {
-        REQUIRE_OK(kefir_token_macro_expansions_free(mem, token->macro_expansions));
-        KEFIR_FREE(mem, token->macro_expansions);
-        token->macro_expansions = NULL;
-    }
+    REQUIRE_OK(kefir_token_macro_expansions_release(mem, token->macro_expansions));
+    token->macro_expansions = NULL;
     switch (token->klass) {
         case KEFIR_TOKEN_STRING_LITERAL:
             token->string_literal->length = 0;
@@ -1031,6 +1165,11 @@ kefir_result_t kefir_token_free(struct kefir_mem *mem, struct kefir_token *token
             KEFIR_FREE(mem, token->pragma);
             break;
 
+        case KEFIR_TOKEN_EMBED:
+            KEFIR_FREE(mem, token->embed);
+            token->embed = NULL;
+            break;
+
         case KEFIR_TOKEN_IDENTIFIER:
         case KEFIR_TOKEN_SENTINEL:
         case KEFIR_TOKEN_KEYWORD:
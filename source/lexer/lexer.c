@@ -39,21 +39,12 @@ kefir_result_t kefir_lexer_init(struct kefir_mem *mem, struct kefir_lexer *lexer
     lexer->context = context;
     lexer->mode = mode;
     lexer->standard_version = standard_version;
-    REQUIRE_OK(kefir_lexer_init_punctuators(mem, lexer));
-    kefir_result_t res = kefir_lexer_init_keywords(mem, lexer);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_trie_free(mem, &lexer->punctuators);
-        return res;
-    });
-
     lexer->extensions = extensions;
     lexer->extension_payload = NULL;
+
+    kefir_result_t res;
     KEFIR_RUN_EXTENSION0(&res, mem, lexer, on_init);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_trie_free(mem, &lexer->keywords);
-        kefir_trie_free(mem, &lexer->punctuators);
-        return res;
-    });
+    REQUIRE_OK(res);
     return KEFIR_OK;
 }
 
@@ -65,8 +56,7 @@ kefir_result_t kefir_lexer_free(struct kefir_mem *mem, struct kefir_lexer *lexer
     KEFIR_RUN_EXTENSION0(&res, mem, lexer, on_free);
     lexer->extensions = NULL;
     lexer->extension_payload = NULL;
-    REQUIRE_OK(kefir_trie_free(mem, &lexer->keywords));
-    REQUIRE_OK(kefir_trie_free(mem, &lexer->punctuators));
+    REQUIRE_OK(res);
     return KEFIR_OK;
 }
 
@@ -23,6 +23,7 @@
 #include "kefir/core/error.h"
 #include "kefir/util/uchar.h"
 #include <string.h>
+#include <wchar.h>
 
 static kefir_result_t next_impl(struct kefir_lexer_source_cursor *, kefir_size_t, kefir_char32_t *);
 
@@ -60,6 +61,13 @@ static kefir_char32_t at_impl(const struct kefir_lexer_source_cursor *cursor, ke
             break;
         }
 
+        const kefir_uint8_t byte = (kefir_uint8_t) cursor->content[index];
+        if (byte < 0x80 && byte != '\\' && mbsinit(&mbstate)) {  // Plain ASCII needs no multibyte decoding
+            character = (kefir_char32_t) byte;
+            index++;
+            continue;
+        }
+
         size_t rc = mbrtoc32(&character, cursor->content + index, cursor->length - index, &mbstate);
         switch (rc) {
             case (size_t) -1:
@@ -137,6 +145,20 @@ static kefir_result_t next_impl(struct kefir_lexer_source_cursor *cursor, kefir_
         if (cursor->length == cursor->index) {
             break;
         }
+
+        const kefir_uint8_t byte = (kefir_uint8_t) cursor->content[cursor->index];
+        if (byte < 0x80 && byte != '\\' && mbsinit(&cursor->mbstate)) {  // Plain ASCII needs no multibyte decoding
+            chr = (kefir_char32_t) byte;
+            cursor->index++;
+            if (chr == U'\n') {
+                cursor->current_location.column = 1;
+                cursor->current_location.line++;
+            } else {
+                cursor->current_location.column++;
+            }
+            continue;
+        }
+
         size_t rc = mbrtoc32(&chr, cursor->content + cursor->index, cursor->length - cursor->index, &cursor->mbstate);
         switch (rc) {
             case (size_t) -1:
@@ -257,6 +279,134 @@ kefir_result_t kefir_lexer_source_cursor_skip(struct kefir_lexer_source_cursor *
     return KEFIR_OK;
 }
 
+static kefir_bool_t ascii_class_contains(kefir_lexer_source_cursor_ascii_class_t klass, kefir_char32_t chr) {
+    switch (klass) {
+        case KEFIR_LEXER_SOURCE_CURSOR_ASCII_IDENTIFIER:
+            return (chr >= U'a' && chr <= U'z') || (chr >= U'A' && chr <= U'Z') || (chr >= U'0' && chr <= U'9') ||
+                   chr == U'_' || chr == U'$';
+
+        case KEFIR_LEXER_SOURCE_CURSOR_ASCII_HORIZONTAL_WHITESPACE:
+            return chr == U' ' || chr == U'\t' || chr == U'\v' || chr == U'\f' || chr == U'\r';
+    }
+    return false;
+}
+
+kefir_result_t kefir_lexer_source_cursor_consume_ascii_run(struct kefir_lexer_source_cursor *cursor,
+                                                           kefir_lexer_source_cursor_ascii_class_t klass,
+                                                           kefir_char32_t *buffer, kefir_size_t buffer_length,
+                                                           kefir_size_t *length_ptr) {
+    REQUIRE(cursor != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid lexer source cursor"));
+    REQUIRE(length_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to run length"));
+
+    const kefir_size_t max_length = buffer != NULL ? buffer_length : (kefir_size_t) -1;
+    kefir_size_t length = 0;
+    for (; length < KEFIR_LEXER_SOURCE_CURSOR_LOOKAHEAD && length < max_length &&
+           ascii_class_contains(klass, cursor->lookahead[length].character);
+         length++) {
+        if (buffer != NULL) {
+            buffer[length] = cursor->lookahead[length].character;
+        }
+    }
+
+    // Past the lookahead window plain ASCII bytes map directly onto characters, unless a backslash starts a line
+    // splice
+    if (length == KEFIR_LEXER_SOURCE_CURSOR_LOOKAHEAD && mbsinit(&cursor->mbstate)) {
+        for (kefir_size_t index = cursor->index; index < cursor->length && length < max_length; index++, length++) {
+            const kefir_uint8_t byte = (kefir_uint8_t) cursor->content[index];
+            if (byte >= 0x80 || byte == '\\' || !ascii_class_contains(klass, (kefir_char32_t) byte)) {
+                break;
+            }
+            if (buffer != NULL) {
+                buffer[length] = (kefir_char32_t) byte;
+            }
+        }
+    }
+
+    if (length > 0) {
+        REQUIRE_OK(do_next(cursor, length));
+    }
+    *length_ptr = length;
+    return KEFIR_OK;
+}
+
+#define SWAR_ONES 0x0101010101010101ull
+#define SWAR_HIGH_BITS 0x8080808080808080ull
+#define SWAR_HAS_ZERO_BYTE(_word) (((_word) - SWAR_ONES) & ~(_word) & SWAR_HIGH_BITS)
+#define SWAR_HAS_BYTE(_word, _byte) SWAR_HAS_ZERO_BYTE((_word) ^ (SWAR_ONES * (kefir_uint8_t) (_byte)))
+
+static kefir_bool_t is_ascii_stop(kefir_char32_t chr, const char *stops) {
+    if (chr >= 0x80 || chr == U'\\' || chr == U'\0') {
+        return true;
+    }
+    for (; *stops != '\0'; stops++) {
+        if (chr == (kefir_char32_t) *stops) {
+            return true;
+        }
+    }
+    return false;
+}
+
+kefir_size_t kefir_lexer_source_cursor_find_ascii(const struct kefir_lexer_source_cursor *cursor, const char *stops) {
+    REQUIRE(cursor != NULL, 0);
+    REQUIRE(stops != NULL, 0);
+
+    kefir_size_t length = 0;
+    for (; length < KEFIR_LEXER_SOURCE_CURSOR_LOOKAHEAD; length++) {
+        if (is_ascii_stop(cursor->lookahead[length].character, stops)) {
+            return length;
+        }
+    }
+    REQUIRE(mbsinit(&cursor->mbstate), length);
+
+    // Scan the raw content a machine word at a time: a word is skipped only if none of its bytes is non-ASCII, a
+    // null character, a backslash or one of the stop characters
+    kefir_size_t index = cursor->index;
+    for (; index + sizeof(kefir_uint64_t) <= cursor->length; index += sizeof(kefir_uint64_t)) {
+        kefir_uint64_t word;
+        memcpy(&word, cursor->content + index, sizeof(kefir_uint64_t));
+        kefir_uint64_t mask = (word & SWAR_HIGH_BITS) | SWAR_HAS_ZERO_BYTE(word) | SWAR_HAS_BYTE(word, '\\');
+        for (const char *stop = stops; *stop != '\0'; stop++) {
+            mask |= SWAR_HAS_BYTE(word, *stop);
+        }
+        if (mask != 0) {
+            break;
+        }
+    }
+    for (; index < cursor->length && !is_ascii_stop((kefir_uint8_t) cursor->content[index], stops); index++) {}
+    return length + (index - cursor->index);
+}
+
+kefir_bool_t kefir_lexer_source_cursor_ascii_contains(const struct kefir_lexer_source_cursor *cursor,
+                                                     kefir_size_t length, const char *substring) {
+    REQUIRE(cursor != NULL, false);
+    REQUIRE(substring != NULL, false);
+
+    // Prefix found by kefir_lexer_source_cursor_find_ascii maps onto raw content bytes past the lookahead window
+    const kefir_size_t substring_length = strlen(substring);
+    for (kefir_size_t i = 0; i + substring_length <= length; i++) {
+        kefir_size_t j = 0;
+        for (; j < substring_length; j++) {
+            const kefir_size_t offset = i + j;
+            const kefir_char32_t chr =
+                offset < KEFIR_LEXER_SOURCE_CURSOR_LOOKAHEAD
+                    ? cursor->lookahead[offset].character
+                    : (kefir_uint8_t) cursor->content[cursor->index + offset - KEFIR_LEXER_SOURCE_CURSOR_LOOKAHEAD];
+            if (chr != (kefir_char32_t) substring[j]) {
+                break;
+            }
+        }
+        if (j == substring_length) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#undef SWAR_HAS_BYTE
+#undef SWAR_HAS_ZERO_BYTE
+#undef SWAR_HIGH_BITS
+#undef SWAR_ONES
+
 kefir_result_t kefir_lexer_source_cursor_save(const struct kefir_lexer_source_cursor *cursor,
                                               struct kefir_lexer_source_cursor_state *state) {
     REQUIRE(cursor != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid lexer source cursor"));
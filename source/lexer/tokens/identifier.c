@@ -56,7 +56,9 @@ struct match_payload {
 
 kefir_result_t kefir_lexer_scan_identifier_or_keyword(struct kefir_mem *mem, struct kefir_lexer_source_cursor *cursor,
                                                       kefir_lexer_mode_t mode, struct kefir_string_pool *symbols,
-                                                      const struct kefir_trie *keywords, struct kefir_token *token) {
+                                                      kefir_bool_t map_keywords,
+                                                      kefir_c_language_standard_version_t standard_version,
+                                                      struct kefir_token *token) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(cursor != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid source cursor"));
     REQUIRE(token != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to token"));
@@ -69,6 +71,12 @@ kefir_result_t kefir_lexer_scan_identifier_or_keyword(struct kefir_mem *mem, str
     kefir_bool_t scan_identifier =
         mode != KEFIR_LEXER_ASSEMBLY_MODE || (identifier[0] != U'$' && identifier[0] != U'@');
     for (; scan_identifier;) {
+        kefir_size_t run_length;
+        REQUIRE_OK(kefir_lexer_source_cursor_consume_ascii_run(cursor, KEFIR_LEXER_SOURCE_CURSOR_ASCII_IDENTIFIER,
+                                                               &identifier[length], MAX_IDENTIFIER_LENGTH - length,
+                                                               &run_length));
+        length += run_length;
+
         if (kefir_lexer_source_cursor_at(cursor, 0) == U'@' && mode == KEFIR_LEXER_ASSEMBLY_MODE) {
             break;
         }
@@ -99,7 +107,8 @@ kefir_result_t kefir_lexer_scan_identifier_or_keyword(struct kefir_mem *mem, str
     }
 
     kefir_keyword_token_t keyword;
-    kefir_result_t res = keywords != NULL ? kefir_lexer_get_keyword(keywords, identifier, &keyword) : KEFIR_NO_MATCH;
+    kefir_result_t res =
+        map_keywords ? kefir_lexer_get_keyword(standard_version, identifier, &keyword) : KEFIR_NO_MATCH;
     if (res == KEFIR_NO_MATCH) {
         REQUIRE_OK(kefir_token_new_identifier(mem, symbols, mb_identifier, token));
     } else {
@@ -119,7 +128,7 @@ static kefir_result_t match_impl(struct kefir_mem *mem, struct kefir_lexer *lexe
     ASSIGN_DECL_CAST(struct match_payload *, param, payload);
 
     REQUIRE_OK(kefir_lexer_scan_identifier_or_keyword(mem, lexer->cursor, lexer->mode, lexer->symbols,
-                                                      param->map_keywords ? &lexer->keywords : NULL, param->token));
+                                                      param->map_keywords, lexer->standard_version, param->token));
     return KEFIR_OK;
 }
 
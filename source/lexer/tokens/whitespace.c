@@ -27,7 +27,17 @@
 enum whitespace_match { WHITESPACE_NO_MATCH = 0, WHITESPACE_MATCH, WHITESPACE_NEWLINE };
 
 static kefir_result_t skip_whitespaces(const struct kefir_lexer_context *context,
-                                       struct kefir_lexer_source_cursor *cursor, enum whitespace_match *match) {
+                                       struct kefir_lexer_source_cursor *cursor, kefir_bool_t consume_run,
+                                       enum whitespace_match *match) {
+    if (consume_run) {
+        kefir_size_t run_length;
+        REQUIRE_OK(kefir_lexer_source_cursor_consume_ascii_run(
+            cursor, KEFIR_LEXER_SOURCE_CURSOR_ASCII_HORIZONTAL_WHITESPACE, NULL, 0, &run_length));
+        if (run_length > 0) {
+            *match = MAX(*match, WHITESPACE_MATCH);
+        }
+    }
+
     kefir_char32_t chr;
     if (kefir_isspace32((chr = kefir_lexer_source_cursor_at(cursor, 0))) || chr == U'\0') {
         if (chr == context->newline) {
@@ -46,6 +56,10 @@ static kefir_result_t skip_multiline_comment(struct kefir_lexer_source_cursor *c
 
         REQUIRE_OK(kefir_lexer_source_cursor_next(cursor, 2));
         for (;;) {
+            const kefir_size_t plain_length = kefir_lexer_source_cursor_find_ascii(cursor, "*");
+            if (plain_length > 0) {
+                REQUIRE_OK(kefir_lexer_source_cursor_skip(cursor, plain_length));
+            }
             if ((kefir_lexer_source_cursor_at(cursor, 0) == U'*' && kefir_lexer_source_cursor_at(cursor, 1) == U'/') ||
                 kefir_lexer_source_cursor_at(cursor, 0) == KEFIR_LEXER_SOURCE_CURSOR_EOF) {
                 break;
@@ -75,6 +89,13 @@ static kefir_result_t skip_oneline_comment(const struct kefir_lexer_context *con
         *match = MAX(*match, WHITESPACE_MATCH);
 
         REQUIRE_OK(kefir_lexer_source_cursor_next(cursor, 2));
+        if (context->newline < 0x80) {
+            const char stops[] = {(char) context->newline, '\0'};
+            const kefir_size_t plain_length = kefir_lexer_source_cursor_find_ascii(cursor, stops);
+            if (plain_length > 0) {
+                REQUIRE_OK(kefir_lexer_source_cursor_skip(cursor, plain_length));
+            }
+        }
         while (kefir_lexer_source_cursor_at(cursor, 0) != context->newline &&
                kefir_lexer_source_cursor_at(cursor, 0) != KEFIR_LEXER_SOURCE_CURSOR_EOF) {
             REQUIRE_OK(kefir_lexer_source_cursor_skip(cursor, 1));
@@ -109,7 +130,7 @@ kefir_result_t kefir_lexer_cursor_match_whitespace(struct kefir_mem *mem, struct
     enum whitespace_match match = WHITESPACE_NO_MATCH;
     while (continue_scan) {
         enum whitespace_match matched = WHITESPACE_NO_MATCH;
-        REQUIRE_OK(skip_whitespaces(lexer->context, lexer->cursor, &matched));
+        REQUIRE_OK(skip_whitespaces(lexer->context, lexer->cursor, token == NULL, &matched));
         if (matched == WHITESPACE_NO_MATCH) {
             REQUIRE_OK(skip_multiline_comment(lexer->cursor, &matched));
         }
@@ -189,6 +189,152 @@ static kefir_result_t may_alias_impl(const struct kefir_opt_code_container *code
     return KEFIR_OK;
 }
 
+#define POINTER_ROOTS_CAPACITY 4
+#define POINTER_ROOTS_MAX_PHIS 8
+#define POINTER_ROOTS_MAX_DEPTH 16
+
+struct pointer_roots {
+    kefir_opt_instruction_ref_t roots[POINTER_ROOTS_CAPACITY];
+    kefir_size_t length;
+    kefir_opt_instruction_ref_t phis[POINTER_ROOTS_MAX_PHIS];
+    kefir_size_t phi_length;
+    kefir_bool_t opaque;
+    kefir_bool_t incomplete;
+};
+
+static void add_pointer_root(struct pointer_roots *roots, kefir_opt_instruction_ref_t instr_ref) {
+    for (kefir_size_t i = 0; i < roots->length; i++) {
+        if (roots->roots[i] == instr_ref) {
+            return;
+        }
+    }
+    if (roots->length < POINTER_ROOTS_CAPACITY) {
+        roots->roots[roots->length++] = instr_ref;
+    } else {
+        roots->incomplete = true;
+    }
+}
+
+static kefir_result_t collect_pointer_roots(const struct kefir_opt_code_container *code,
+                                            kefir_opt_instruction_ref_t instr_ref, kefir_size_t depth,
+                                            struct pointer_roots *roots) {
+    REQUIRE(!roots->incomplete, KEFIR_OK);
+    if (depth >= POINTER_ROOTS_MAX_DEPTH) {
+        roots->incomplete = true;
+        return KEFIR_OK;
+    }
+
+    const struct kefir_opt_instruction *instr;
+    REQUIRE_OK(kefir_opt_code_container_instr(code, instr_ref, &instr));
+    switch (instr->operation.opcode) {
+        case KEFIR_OPT_OPCODE_GET_ARGUMENT:
+        case KEFIR_OPT_OPCODE_GET_GLOBAL:
+        case KEFIR_OPT_OPCODE_GET_THREAD_LOCAL:
+        case KEFIR_OPT_OPCODE_ALLOC_LOCAL:
+            add_pointer_root(roots, instr_ref);
+            break;
+
+        case KEFIR_OPT_OPCODE_REF_LOCAL:
+            REQUIRE_OK(collect_pointer_roots(code, instr->operation.parameters.refs[0], depth + 1, roots));
+            break;
+
+        case KEFIR_OPT_OPCODE_INT64_ADD:
+        case KEFIR_OPT_OPCODE_INT64_SUB:
+            REQUIRE_OK(collect_pointer_roots(code, instr->operation.parameters.refs[0], depth + 1, roots));
+            REQUIRE_OK(collect_pointer_roots(code, instr->operation.parameters.refs[1], depth + 1, roots));
+            break;
+
+        case KEFIR_OPT_OPCODE_INT_CONST:
+        case KEFIR_OPT_OPCODE_UINT_CONST:
+        case KEFIR_OPT_OPCODE_INT64_MUL:
+        case KEFIR_OPT_OPCODE_UINT64_MUL:
+        case KEFIR_OPT_OPCODE_INT64_LSHIFT:
+        case KEFIR_OPT_OPCODE_INT64_ZERO_EXTEND_8BITS:
+        case KEFIR_OPT_OPCODE_INT64_ZERO_EXTEND_16BITS:
+        case KEFIR_OPT_OPCODE_INT64_ZERO_EXTEND_32BITS:
+        case KEFIR_OPT_OPCODE_INT64_SIGN_EXTEND_8BITS:
+        case KEFIR_OPT_OPCODE_INT64_SIGN_EXTEND_16BITS:
+        case KEFIR_OPT_OPCODE_INT64_SIGN_EXTEND_32BITS:
+            // Scaled indices and constant offsets do not contribute pointer roots
+            break;
+
+        case KEFIR_OPT_OPCODE_PHI: {
+            for (kefir_size_t i = 0; i < roots->phi_length; i++) {
+                if (roots->phis[i] == instr_ref) {
+                    return KEFIR_OK;
+                }
+            }
+            if (roots->phi_length == POINTER_ROOTS_MAX_PHIS) {
+                roots->incomplete = true;
+                return KEFIR_OK;
+            }
+            roots->phis[roots->phi_length++] = instr_ref;
+
+            struct kefir_opt_phi_node_link_iterator iter;
+            kefir_opt_instruction_ref_t link_ref;
+            kefir_result_t res;
+            for (res = kefir_opt_phi_node_link_iter(code, instr_ref, &iter, NULL, &link_ref); res == KEFIR_OK;
+                 res = kefir_opt_phi_node_link_next(&iter, NULL, &link_ref)) {
+                REQUIRE_OK(collect_pointer_roots(code, link_ref, depth + 1, roots));
+            }
+            if (res != KEFIR_ITERATOR_END) {
+                REQUIRE_OK(res);
+            }
+        } break;
+
+        default:
+            roots->opaque = true;
+            break;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t restrict_pointer_may_alias(const struct kefir_opt_code_container *code,
+                                                 const struct kefir_opt_code_escape_analysis *escapes,
+                                                 const struct pointer_roots *restrict_roots,
+                                                 const struct pointer_roots *other_roots, kefir_bool_t *may_alias) {
+    REQUIRE(!restrict_roots->incomplete && !restrict_roots->opaque && restrict_roots->length == 1 &&
+                !other_roots->incomplete,
+            KEFIR_OK);
+
+    const struct kefir_opt_instruction *restrict_instr;
+    REQUIRE_OK(kefir_opt_code_container_instr(code, restrict_roots->roots[0], &restrict_instr));
+    REQUIRE(restrict_instr->operation.opcode == KEFIR_OPT_OPCODE_GET_ARGUMENT &&
+                restrict_instr->operation.parameters.argument.restrict_pointer,
+            KEFIR_OK);
+
+    for (kefir_size_t i = 0; i < other_roots->length; i++) {
+        const struct kefir_opt_instruction *root_instr;
+        REQUIRE_OK(kefir_opt_code_container_instr(code, other_roots->roots[i], &root_instr));
+        REQUIRE(root_instr->operation.opcode != KEFIR_OPT_OPCODE_GET_ARGUMENT ||
+                    root_instr->operation.parameters.argument.index !=
+                        restrict_instr->operation.parameters.argument.index,
+                KEFIR_OK);
+    }
+
+    // Object accessed through restrict-qualified argument cannot be accessed through a pointer not based on that
+    // argument. Unless the argument escapes, even pointers of unknown origin cannot be based on it.
+    if (!other_roots->opaque || !kefir_opt_code_escape_analysis_has_escapes(escapes, restrict_instr->id)) {
+        *may_alias = false;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t restrict_may_alias(const struct kefir_opt_code_container *code,
+                                         const struct kefir_opt_code_escape_analysis *escapes,
+                                         kefir_opt_instruction_ref_t location_ref1,
+                                         kefir_opt_instruction_ref_t location_ref2, kefir_bool_t *may_alias) {
+    struct pointer_roots roots1 = {0}, roots2 = {0};
+    REQUIRE_OK(collect_pointer_roots(code, location_ref1, 0, &roots1));
+    REQUIRE_OK(collect_pointer_roots(code, location_ref2, 0, &roots2));
+
+    REQUIRE_OK(restrict_pointer_may_alias(code, escapes, &roots1, &roots2, may_alias));
+    if (*may_alias) {
+        REQUIRE_OK(restrict_pointer_may_alias(code, escapes, &roots2, &roots1, may_alias));
+    }
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_opt_code_may_alias(const struct kefir_opt_code_container *code,
                                         const struct kefir_opt_code_escape_analysis *escapes,
                                         const struct kefir_ir_module *ir_module,
@@ -202,6 +348,9 @@ kefir_result_t kefir_opt_code_may_alias(const struct kefir_opt_code_container *c
 
     REQUIRE_OK(may_alias_impl(code, escapes, ir_module, location_ref1, size1, offset1, location_ref2, size2, offset2,
                               false, may_alias));
+    if (*may_alias) {
+        REQUIRE_OK(restrict_may_alias(code, escapes, location_ref1, location_ref2, may_alias));
+    }
     return KEFIR_OK;
 }
 
@@ -309,3 +458,54 @@ kefir_result_t kefir_opt_code_must_alias(const struct kefir_opt_code_container *
     }
     return KEFIR_OK;
 }
+
+static kefir_uint8_t memory_access_alias_tag(const struct kefir_opt_instruction *instr) {
+    switch (instr->operation.opcode) {
+        case KEFIR_OPT_OPCODE_INT8_LOAD:
+        case KEFIR_OPT_OPCODE_INT8_STORE:
+        case KEFIR_OPT_OPCODE_INT16_LOAD:
+        case KEFIR_OPT_OPCODE_INT16_STORE:
+        case KEFIR_OPT_OPCODE_INT32_LOAD:
+        case KEFIR_OPT_OPCODE_INT32_STORE:
+        case KEFIR_OPT_OPCODE_INT64_LOAD:
+        case KEFIR_OPT_OPCODE_INT64_STORE:
+        case KEFIR_OPT_OPCODE_INT128_LOAD:
+        case KEFIR_OPT_OPCODE_INT128_STORE:
+        case KEFIR_OPT_OPCODE_FLOAT32_LOAD:
+        case KEFIR_OPT_OPCODE_FLOAT32_STORE:
+        case KEFIR_OPT_OPCODE_FLOAT64_LOAD:
+        case KEFIR_OPT_OPCODE_FLOAT64_STORE:
+        case KEFIR_OPT_OPCODE_LONG_DOUBLE_LOAD:
+        case KEFIR_OPT_OPCODE_LONG_DOUBLE_STORE:
+        case KEFIR_OPT_OPCODE_DECIMAL32_LOAD:
+        case KEFIR_OPT_OPCODE_DECIMAL32_STORE:
+        case KEFIR_OPT_OPCODE_DECIMAL64_LOAD:
+        case KEFIR_OPT_OPCODE_DECIMAL64_STORE:
+        case KEFIR_OPT_OPCODE_DECIMAL128_LOAD:
+        case KEFIR_OPT_OPCODE_DECIMAL128_STORE:
+        case KEFIR_OPT_OPCODE_COMPLEX_FLOAT32_LOAD:
+        case KEFIR_OPT_OPCODE_COMPLEX_FLOAT32_STORE:
+        case KEFIR_OPT_OPCODE_COMPLEX_FLOAT64_LOAD:
+        case KEFIR_OPT_OPCODE_COMPLEX_FLOAT64_STORE:
+        case KEFIR_OPT_OPCODE_COMPLEX_LONG_DOUBLE_LOAD:
+        case KEFIR_OPT_OPCODE_COMPLEX_LONG_DOUBLE_STORE:
+            return instr->operation.parameters.memory_access.flags.alias_tag;
+
+        default:
+            return KEFIR_IR_MEMORY_ALIAS_TAG_ANY;
+    }
+}
+
+kefir_result_t kefir_opt_code_may_alias_by_type(const struct kefir_opt_instruction *instr1,
+                                                const struct kefir_opt_instruction *instr2, kefir_bool_t *may_alias) {
+    REQUIRE(instr1 != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer instruction"));
+    REQUIRE(instr2 != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer instruction"));
+    REQUIRE(may_alias != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to boolean flag"));
+
+    // Accesses through lvalues of incompatible non-character types cannot refer to the same object; accesses
+    // without alias tag (character types, aggregates, unions, non-C sources) may alias anything.
+    const kefir_uint8_t tag1 = memory_access_alias_tag(instr1);
+    const kefir_uint8_t tag2 = memory_access_alias_tag(instr2);
+    *may_alias = tag1 == KEFIR_IR_MEMORY_ALIAS_TAG_ANY || tag2 == KEFIR_IR_MEMORY_ALIAS_TAG_ANY || tag1 == tag2;
+    return KEFIR_OK;
+}
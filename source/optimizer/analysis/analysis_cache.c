@@ -0,0 +1,115 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "kefir/optimizer/analysis_cache.h"
+#include "kefir/core/error.h"
+#include "kefir/core/util.h"
+
+kefir_result_t kefir_opt_code_analysis_cache_init(struct kefir_opt_code_analysis_cache *cache,
+                                                  const struct kefir_opt_code_container *code) {
+    REQUIRE(cache != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer code analysis cache"));
+    REQUIRE(code != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code container"));
+
+    cache->code = code;
+    cache->control_flow.revision.valid = false;
+    cache->liveness.revision.valid = false;
+    REQUIRE_OK(kefir_opt_code_control_flow_init(&cache->control_flow.control_flow));
+    REQUIRE_OK(kefir_opt_code_liveness_init(&cache->liveness.liveness));
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_code_analysis_cache_free(struct kefir_mem *mem, struct kefir_opt_code_analysis_cache *cache) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(cache != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code analysis cache"));
+
+    REQUIRE_OK(kefir_opt_code_liveness_free(mem, &cache->liveness.liveness));
+    REQUIRE_OK(kefir_opt_code_control_flow_free(mem, &cache->control_flow.control_flow));
+    cache->control_flow.revision.valid = false;
+    cache->liveness.revision.valid = false;
+    cache->code = NULL;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_code_analysis_cache_invalidate(struct kefir_opt_code_analysis_cache *cache) {
+    REQUIRE(cache != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code analysis cache"));
+
+    cache->control_flow.revision.valid = false;
+    cache->liveness.revision.valid = false;
+    return KEFIR_OK;
+}
+
+static void revision_stamp(const struct kefir_opt_code_container *code,
+                           struct kefir_opt_code_analysis_revision *revision) {
+    revision->valid = true;
+    revision->code = code->revision.code;
+    revision->control_flow = code->revision.control_flow;
+}
+
+kefir_result_t kefir_opt_code_analysis_cache_control_flow(struct kefir_mem *mem,
+                                                          struct kefir_opt_code_analysis_cache *cache,
+                                                          struct kefir_opt_code_control_flow **control_flow_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(cache != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code analysis cache"));
+    REQUIRE(control_flow_ptr != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer code control flow"));
+
+    const struct kefir_opt_code_container *code = cache->code;
+    const struct kefir_opt_code_analysis_revision *revision = &cache->control_flow.revision;
+    // Block label instructions contribute indirect jump targets only while they are reachable from the
+    // control flow, thus any code mutation might affect control flow of functions that contain them
+    kefir_bool_t up_to_date = revision->valid && revision->control_flow == code->revision.control_flow &&
+                              (!code->revision.has_block_labels || revision->code == code->revision.code);
+    if (!up_to_date) {
+        cache->control_flow.revision.valid = false;
+        cache->liveness.revision.valid = false;
+        REQUIRE_OK(kefir_opt_code_liveness_reset(mem, &cache->liveness.liveness));
+        REQUIRE_OK(kefir_opt_code_control_flow_free(mem, &cache->control_flow.control_flow));
+        REQUIRE_OK(kefir_opt_code_control_flow_init(&cache->control_flow.control_flow));
+        REQUIRE_OK(kefir_opt_code_control_flow_build(mem, &cache->control_flow.control_flow, code));
+        revision_stamp(code, &cache->control_flow.revision);
+    }
+
+    *control_flow_ptr = &cache->control_flow.control_flow;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_code_analysis_cache_liveness(struct kefir_mem *mem,
+                                                      struct kefir_opt_code_analysis_cache *cache,
+                                                      struct kefir_opt_code_liveness **liveness_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(cache != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code analysis cache"));
+    REQUIRE(liveness_ptr != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer code liveness"));
+
+    struct kefir_opt_code_control_flow *control_flow;
+    REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, cache, &control_flow));
+
+    const struct kefir_opt_code_analysis_revision *revision = &cache->liveness.revision;
+    if (!revision->valid || revision->code != cache->code->revision.code) {
+        cache->liveness.revision.valid = false;
+        REQUIRE_OK(kefir_opt_code_liveness_reset(mem, &cache->liveness.liveness));
+        REQUIRE_OK(kefir_opt_code_liveness_build(mem, &cache->liveness.liveness, control_flow));
+        revision_stamp(cache->code, &cache->liveness.revision);
+    }
+
+    *liveness_ptr = &cache->liveness.liveness;
+    return KEFIR_OK;
+}
@@ -67,8 +67,8 @@ static kefir_result_t record_escape(struct kefir_mem *mem, struct kefir_opt_code
 
 static kefir_result_t record_escapes(struct kefir_mem *mem, struct kefir_opt_code_escape_analysis *escape,
                                      const struct kefir_opt_code_container *code,
-                                     kefir_opt_instruction_ref_t alloc_instr_ref,
-                                     kefir_opt_instruction_ref_t instr_ref) {
+                                     kefir_opt_instruction_ref_t alloc_instr_ref, kefir_opt_instruction_ref_t instr_ref,
+                                     kefir_bool_t follow_pointer_arithmetics) {
     kefir_result_t res;
     struct kefir_opt_instruction_use_iterator use_iter;
     for (res = kefir_opt_code_container_instruction_use_instr_iter(code, instr_ref, &use_iter); res == KEFIR_OK;
@@ -135,7 +135,18 @@ static kefir_result_t record_escapes(struct kefir_mem *mem, struct kefir_opt_cod
                 break;
 
             case KEFIR_OPT_OPCODE_REF_LOCAL:
-                REQUIRE_OK(record_escapes(mem, escape, code, alloc_instr_ref, use_iter.use_instr_ref));
+                REQUIRE_OK(record_escapes(mem, escape, code, alloc_instr_ref, use_iter.use_instr_ref,
+                                          follow_pointer_arithmetics));
+                break;
+
+            case KEFIR_OPT_OPCODE_INT64_ADD:
+            case KEFIR_OPT_OPCODE_INT64_SUB:
+                if (follow_pointer_arithmetics) {
+                    REQUIRE_OK(record_escapes(mem, escape, code, alloc_instr_ref, use_iter.use_instr_ref,
+                                              follow_pointer_arithmetics));
+                } else {
+                    REQUIRE_OK(record_escape(mem, escape, alloc_instr_ref, use_iter.use_instr_ref));
+                }
                 break;
 
             default:
@@ -166,7 +177,12 @@ kefir_result_t kefir_opt_code_escape_analysis_build(struct kefir_mem *mem,
             REQUIRE_OK(kefir_opt_code_container_instr(code, instr_ref, &instr));
 
             if (instr->operation.opcode == KEFIR_OPT_OPCODE_ALLOC_LOCAL) {
-                REQUIRE_OK(record_escapes(mem, escape, code, instr_ref, instr_ref));
+                REQUIRE_OK(record_escapes(mem, escape, code, instr_ref, instr_ref, false));
+            } else if (instr->operation.opcode == KEFIR_OPT_OPCODE_GET_ARGUMENT &&
+                       instr->operation.parameters.argument.restrict_pointer) {
+                // Pointers based on restrict-qualified argument do not escape as long as they are only used for
+                // address computation and memory access.
+                REQUIRE_OK(record_escapes(mem, escape, code, instr_ref, instr_ref, true));
             }
         }
         if (res != KEFIR_ITERATOR_END) {
@@ -61,6 +61,18 @@ static kefir_result_t link_block(struct kefir_mem *mem, struct kefir_opt_code_co
                                      tail_instr->operation.parameters.branch.alternative_block));
             break;
 
+        case KEFIR_OPT_OPCODE_SWITCH: {
+            REQUIRE_OK(
+                add_successor(mem, control_flow, successors, tail_instr->operation.parameters.branch.target_block));
+
+            const struct kefir_opt_switch_table *switch_table;
+            REQUIRE_OK(kefir_opt_code_container_switch_table(
+                control_flow->code, tail_instr->operation.parameters.branch.switch_table_ref, &switch_table));
+            for (kefir_size_t i = 0; i < switch_table->length; i++) {
+                REQUIRE_OK(add_successor(mem, control_flow, successors, switch_table->targets[i]));
+            }
+        } break;
+
         case KEFIR_OPT_OPCODE_IJUMP:
             REQUIRE(control_flow->code->gate_block != KEFIR_ID_NONE,
                     KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected optimizer code gate block to exist"));
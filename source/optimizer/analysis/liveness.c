@@ -34,6 +34,9 @@ struct verify_use_def_payload {
     struct kefir_opt_code_control_flow *control_flow;
     struct kefir_opt_code_sequencing *sequencing;
     kefir_opt_instruction_ref_t instr_ref;
+    kefir_opt_instruction_ref_t *traced;
+    kefir_size_t traced_length;
+    kefir_size_t traced_capacity;
 };
 
 static kefir_result_t verify_use_def_impl(kefir_opt_instruction_ref_t instr_ref, void *payload) {
@@ -57,36 +60,53 @@ static kefir_result_t verify_use_def(kefir_opt_instruction_ref_t instr_ref, void
     const struct kefir_opt_instruction *instr;
     REQUIRE_OK(kefir_opt_code_container_instr(param->control_flow->code, instr_ref, &instr));
 
-    REQUIRE_OK(kefir_hashset_add(param->mem, &param->liveness->blocks[instr->block_id].alive_instr,
-                                 (kefir_hashset_key_t) instr_ref));
+    if (param->traced_length == param->traced_capacity) {
+        kefir_size_t new_capacity = MAX(param->traced_capacity * 2, 128);
+        kefir_opt_instruction_ref_t *new_traced =
+            KEFIR_REALLOC(param->mem, param->traced, sizeof(kefir_opt_instruction_ref_t) * new_capacity);
+        REQUIRE(new_traced != NULL,
+                KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate optimizer code liveness trace"));
+        param->traced = new_traced;
+        param->traced_capacity = new_capacity;
+    }
+    param->traced[param->traced_length++] = instr_ref;
 
     param->instr_ref = instr_ref;
     REQUIRE_OK(
         kefir_opt_instruction_extract_inputs(param->control_flow->code, instr, true, verify_use_def_impl, payload));
+    return KEFIR_OK;
+}
+
+static kefir_result_t mark_sparse_uses(struct kefir_mem *mem, struct kefir_opt_code_liveness *liveness,
+                                       kefir_opt_instruction_ref_t instr_ref) {
+    const struct kefir_opt_instruction *instr;
+    REQUIRE_OK(kefir_opt_code_container_instr(liveness->code, instr_ref, &instr));
+
+    REQUIRE_OK(
+        kefir_hashset_add(mem, &liveness->blocks[instr->block_id].alive_instr, (kefir_hashset_key_t) instr_ref));
 
     struct kefir_opt_instruction_use_iterator use_iter;
     kefir_result_t res;
-    for (res = kefir_opt_code_container_instruction_use_instr_iter(param->control_flow->code, instr_ref, &use_iter);
+    for (res = kefir_opt_code_container_instruction_use_instr_iter(liveness->code, instr_ref, &use_iter);
          res == KEFIR_OK; res = kefir_opt_code_container_instruction_use_next(&use_iter)) {
         const struct kefir_opt_instruction *use_instr;
-        REQUIRE_OK(kefir_opt_code_container_instr(param->control_flow->code, use_iter.use_instr_ref, &use_instr));
+        REQUIRE_OK(kefir_opt_code_container_instr(liveness->code, use_iter.use_instr_ref, &use_instr));
 
         if (use_instr->operation.opcode == KEFIR_OPT_OPCODE_PHI) {
             const struct kefir_opt_phi_node *use_phi;
-            REQUIRE_OK(kefir_opt_code_container_phi(param->control_flow->code, use_instr->operation.parameters.phi_ref,
-                                                    &use_phi));
+            REQUIRE_OK(kefir_opt_code_container_phi(liveness->code, use_instr->operation.parameters.phi_ref, &use_phi));
             struct kefir_hashtree_node_iterator iter;
             for (struct kefir_hashtree_node *node = kefir_hashtree_iter(&use_phi->links, &iter); node != NULL;
                  node = kefir_hashtree_next(&iter)) {
                 ASSIGN_DECL_CAST(kefir_opt_block_id_t, src_block_id, node->key);
                 ASSIGN_DECL_CAST(kefir_opt_instruction_ref_t, src_instr_ref, node->value);
                 if (src_instr_ref == instr_ref) {
-                    REQUIRE_OK(kefir_hashset_add(param->mem, &param->liveness->blocks[src_block_id].alive_instr,
+                    REQUIRE_OK(kefir_hashset_add(mem, &liveness->blocks[src_block_id].alive_instr,
                                                  (kefir_hashset_key_t) instr_ref));
                 }
             }
         } else {
-            REQUIRE_OK(kefir_hashset_add(param->mem, &param->liveness->blocks[use_instr->block_id].alive_instr,
+            REQUIRE_OK(kefir_hashset_add(mem, &liveness->blocks[use_instr->block_id].alive_instr,
                                          (kefir_hashset_key_t) instr_ref));
         }
     }
@@ -189,6 +209,309 @@ static kefir_result_t propagate_alive_instructions(struct kefir_mem *mem, struct
     return KEFIR_OK;
 }
 
+static int compare_instruction_refs(const void *lhs_ptr, const void *rhs_ptr) {
+    const kefir_opt_instruction_ref_t lhs = *(const kefir_opt_instruction_ref_t *) lhs_ptr;
+    const kefir_opt_instruction_ref_t rhs = *(const kefir_opt_instruction_ref_t *) rhs_ptr;
+    if (lhs < rhs) {
+        return -1;
+    } else if (lhs > rhs) {
+        return 1;
+    } else {
+        return 0;
+    }
+}
+
+static kefir_result_t fill_alive_set(struct kefir_mem *mem, struct kefir_hashset *alive_instr,
+                                     kefir_opt_instruction_ref_t *instr_refs, kefir_size_t length) {
+    // Alive sets are filled in ascending instruction order, so that their iteration order only depends on the set
+    // contents and not on the method liveness has been computed with
+    if (length > 0) {
+        qsort(instr_refs, length, sizeof(kefir_opt_instruction_ref_t), compare_instruction_refs);
+    }
+    for (kefir_size_t i = 0; i < length; i++) {
+        REQUIRE_OK(kefir_hashset_add(mem, alive_instr, (kefir_hashset_key_t) instr_refs[i]));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t reorder_sparse_alive_sets(struct kefir_mem *mem, struct kefir_opt_code_liveness *liveness) {
+    kefir_size_t max_length = 0;
+    for (kefir_size_t i = 0; i < liveness->num_of_blocks; i++) {
+        max_length = MAX(max_length, kefir_hashset_size(&liveness->blocks[i].alive_instr));
+    }
+    REQUIRE(max_length > 0, KEFIR_OK);
+
+    kefir_opt_instruction_ref_t *instr_refs = KEFIR_MALLOC(mem, sizeof(kefir_opt_instruction_ref_t) * max_length);
+    REQUIRE(instr_refs != NULL,
+            KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate optimizer code liveness buffer"));
+
+    kefir_result_t res = KEFIR_OK;
+    for (kefir_size_t i = 0; res == KEFIR_OK && i < liveness->num_of_blocks; i++) {
+        kefir_size_t length = 0;
+        struct kefir_hashset_iterator iter;
+        kefir_hashset_key_t entry;
+        for (res = kefir_hashset_iter(&liveness->blocks[i].alive_instr, &iter, &entry); res == KEFIR_OK;
+             res = kefir_hashset_next(&iter, &entry)) {
+            instr_refs[length++] = (kefir_opt_instruction_ref_t) entry;
+        }
+        if (res == KEFIR_ITERATOR_END) {
+            res = KEFIR_OK;
+        }
+        REQUIRE_CHAIN(&res, kefir_hashset_free(mem, &liveness->blocks[i].alive_instr));
+        REQUIRE_CHAIN(&res, kefir_hashset_init(&liveness->blocks[i].alive_instr, &kefir_hashtable_uint_ops));
+        REQUIRE_CHAIN(&res, fill_alive_set(mem, &liveness->blocks[i].alive_instr, instr_refs, length));
+    }
+    KEFIR_FREE(mem, instr_refs);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
+static kefir_result_t build_sparse(struct kefir_mem *mem, struct kefir_opt_code_liveness *liveness,
+                                   struct kefir_opt_code_control_flow *control_flow,
+                                   const struct verify_use_def_payload *trace) {
+    for (kefir_size_t i = 0; i < trace->traced_length; i++) {
+        REQUIRE_OK(mark_sparse_uses(mem, liveness, trace->traced[i]));
+    }
+    REQUIRE_OK(propagate_alive_instructions(mem, liveness, control_flow));
+    REQUIRE_OK(reorder_sparse_alive_sets(mem, liveness));
+    return KEFIR_OK;
+}
+
+struct dense_liveness {
+    kefir_size_t num_of_values;
+    kefir_opt_instruction_ref_t *values;
+    kefir_opt_instruction_ref_t *buffer;
+    kefir_size_t *block_value_offsets;
+    struct kefir_bitset *alive_values;
+    struct kefir_bitset *live_in;
+};
+
+static kefir_result_t number_values(const struct kefir_opt_code_liveness *liveness, struct dense_liveness *dense,
+                                    const struct verify_use_def_payload *trace) {
+    // Values are numbered block-wise, so that definitions of each block occupy a contiguous index range
+    dense->num_of_values = trace->traced_length;
+    memset(dense->block_value_offsets, 0, sizeof(kefir_size_t) * (liveness->num_of_blocks + 1));
+    for (kefir_size_t i = 0; i < trace->traced_length; i++) {
+        const struct kefir_opt_instruction *instr;
+        REQUIRE_OK(kefir_opt_code_container_instr(liveness->code, trace->traced[i], &instr));
+        dense->block_value_offsets[instr->block_id + 1]++;
+    }
+    for (kefir_size_t i = 0; i < liveness->num_of_blocks; i++) {
+        dense->block_value_offsets[i + 1] += dense->block_value_offsets[i];
+    }
+    for (kefir_size_t i = 0; i < trace->traced_length; i++) {
+        const struct kefir_opt_instruction *instr;
+        REQUIRE_OK(kefir_opt_code_container_instr(liveness->code, trace->traced[i], &instr));
+        // Block offsets serve as insertion cursors and are shifted back afterwards
+        const kefir_size_t index = dense->block_value_offsets[instr->block_id]++;
+        dense->values[index] = trace->traced[i];
+    }
+    for (kefir_size_t i = liveness->num_of_blocks; i > 0; i--) {
+        dense->block_value_offsets[i] = dense->block_value_offsets[i - 1];
+    }
+    dense->block_value_offsets[0] = 0;
+    return KEFIR_OK;
+}
+
+static kefir_result_t mark_dense_uses(const struct kefir_opt_code_liveness *liveness, struct dense_liveness *dense,
+                                      kefir_size_t value_index) {
+    const kefir_opt_instruction_ref_t instr_ref = dense->values[value_index];
+    const struct kefir_opt_instruction *instr;
+    REQUIRE_OK(kefir_opt_code_container_instr(liveness->code, instr_ref, &instr));
+
+    struct kefir_opt_instruction_use_iterator use_iter;
+    kefir_result_t res;
+    for (res = kefir_opt_code_container_instruction_use_instr_iter(liveness->code, instr_ref, &use_iter);
+         res == KEFIR_OK; res = kefir_opt_code_container_instruction_use_next(&use_iter)) {
+        const struct kefir_opt_instruction *use_instr;
+        REQUIRE_OK(kefir_opt_code_container_instr(liveness->code, use_iter.use_instr_ref, &use_instr));
+
+        if (use_instr->operation.opcode == KEFIR_OPT_OPCODE_PHI) {
+            // Phi operands are alive at the end of respective predecessor blocks. Until propagation is
+            // complete, per-block alive sets only hold such phi operands.
+            const struct kefir_opt_phi_node *use_phi;
+            REQUIRE_OK(kefir_opt_code_container_phi(liveness->code, use_instr->operation.parameters.phi_ref, &use_phi));
+            struct kefir_hashtree_node_iterator iter;
+            for (struct kefir_hashtree_node *node = kefir_hashtree_iter(&use_phi->links, &iter); node != NULL;
+                 node = kefir_hashtree_next(&iter)) {
+                ASSIGN_DECL_CAST(kefir_opt_block_id_t, src_block_id, node->key);
+                ASSIGN_DECL_CAST(kefir_opt_instruction_ref_t, src_instr_ref, node->value);
+                if (src_instr_ref == instr_ref) {
+                    REQUIRE_OK(kefir_bitset_set(&dense->alive_values[src_block_id], value_index, true));
+                }
+            }
+        } else if (use_instr->block_id != instr->block_id) {
+            REQUIRE_OK(kefir_bitset_set(&dense->live_in[use_instr->block_id], value_index, true));
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t compute_live_out(const struct kefir_opt_code_control_flow *control_flow,
+                                       const struct dense_liveness *dense, kefir_opt_block_id_t block_id,
+                                       struct kefir_bitset *live_out) {
+    REQUIRE_OK(kefir_bitset_clear(live_out));
+    REQUIRE_OK(kefir_bitset_union(live_out, &dense->alive_values[block_id], NULL));
+
+    kefir_result_t res;
+    struct kefir_hashset_iterator iter;
+    kefir_hashset_key_t entry;
+    for (res = kefir_hashset_iter(&control_flow->blocks[block_id].successors, &iter, &entry); res == KEFIR_OK;
+         res = kefir_hashset_next(&iter, &entry)) {
+        ASSIGN_DECL_CAST(kefir_opt_block_id_t, successor_block_id, entry);
+        REQUIRE_OK(kefir_bitset_union(live_out, &dense->live_in[successor_block_id], NULL));
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t propagate_dense(struct kefir_mem *mem, const struct kefir_opt_code_liveness *liveness,
+                                      const struct kefir_opt_code_control_flow *control_flow,
+                                      struct dense_liveness *dense, struct kefir_bitset *live_out,
+                                      struct kefir_bitset *queued_blocks, struct kefir_queue *queue) {
+    REQUIRE_OK(kefir_bitset_ensure(mem, live_out, dense->num_of_values));
+    REQUIRE_OK(kefir_bitset_ensure(mem, queued_blocks, liveness->num_of_blocks));
+    REQUIRE_OK(kefir_bitset_clear(queued_blocks));
+
+    for (kefir_size_t i = liveness->num_of_blocks; i > 0; i--) {
+        REQUIRE_OK(kefir_queue_push(mem, queue, (kefir_queue_entry_t) (i - 1)));
+        REQUIRE_OK(kefir_bitset_set(queued_blocks, i - 1, true));
+    }
+
+    while (!kefir_queue_is_empty(queue)) {
+        kefir_queue_entry_t entry;
+        REQUIRE_OK(kefir_queue_pop_first(mem, queue, &entry));
+        ASSIGN_DECL_CAST(kefir_opt_block_id_t, block_id, entry);
+        REQUIRE_OK(kefir_bitset_set(queued_blocks, block_id, false));
+
+        REQUIRE_OK(compute_live_out(control_flow, dense, block_id, live_out));
+        REQUIRE_OK(kefir_bitset_set_consecutive(
+            live_out, dense->block_value_offsets[block_id],
+            dense->block_value_offsets[block_id + 1] - dense->block_value_offsets[block_id], false));
+        kefir_bool_t changed;
+        REQUIRE_OK(kefir_bitset_union(&dense->live_in[block_id], live_out, &changed));
+        if (!changed) {
+            continue;
+        }
+
+        kefir_result_t res;
+        struct kefir_hashset_iterator iter;
+        kefir_hashset_key_t pred_entry;
+        for (res = kefir_hashset_iter(&control_flow->blocks[block_id].predecessors, &iter, &pred_entry);
+             res == KEFIR_OK; res = kefir_hashset_next(&iter, &pred_entry)) {
+            ASSIGN_DECL_CAST(kefir_opt_block_id_t, pred_block_id, pred_entry);
+            kefir_bool_t queued;
+            REQUIRE_OK(kefir_bitset_get(queued_blocks, pred_block_id, &queued));
+            if (!queued) {
+                REQUIRE_OK(kefir_queue_push(mem, queue, (kefir_queue_entry_t) pred_block_id));
+                REQUIRE_OK(kefir_bitset_set(queued_blocks, pred_block_id, true));
+            }
+        }
+        if (res != KEFIR_ITERATOR_END) {
+            REQUIRE_OK(res);
+        }
+    }
+
+    // Instruction is alive within a block if it is defined there, live on block entry or on block exit
+    for (kefir_size_t i = 0; i < liveness->num_of_blocks; i++) {
+        REQUIRE_OK(compute_live_out(control_flow, dense, i, live_out));
+        REQUIRE_OK(kefir_bitset_union(&dense->alive_values[i], live_out, NULL));
+        REQUIRE_OK(kefir_bitset_union(&dense->alive_values[i], &dense->live_in[i], NULL));
+        REQUIRE_OK(kefir_bitset_set_consecutive(&dense->alive_values[i], dense->block_value_offsets[i],
+                                                dense->block_value_offsets[i + 1] - dense->block_value_offsets[i],
+                                                true));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t fill_dense_alive_sets(struct kefir_mem *mem, struct kefir_opt_code_liveness *liveness,
+                                            const struct dense_liveness *dense) {
+    for (kefir_size_t i = 0; i < liveness->num_of_blocks; i++) {
+        kefir_size_t length = 0;
+        kefir_size_t index;
+        kefir_result_t res;
+        for (res = kefir_bitset_find(&dense->alive_values[i], true, 0, &index); res == KEFIR_OK;
+             res = kefir_bitset_find(&dense->alive_values[i], true, index + 1, &index)) {
+            dense->buffer[length++] = dense->values[index];
+        }
+        if (res != KEFIR_NOT_FOUND) {
+            REQUIRE_OK(res);
+        }
+        REQUIRE_OK(fill_alive_set(mem, &liveness->blocks[i].alive_instr, dense->buffer, length));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t build_dense_impl(struct kefir_mem *mem, struct kefir_opt_code_liveness *liveness,
+                                       const struct kefir_opt_code_control_flow *control_flow,
+                                       const struct verify_use_def_payload *trace, struct dense_liveness *dense) {
+    REQUIRE_OK(number_values(liveness, dense, trace));
+    for (kefir_size_t i = 0; i < liveness->num_of_blocks; i++) {
+        REQUIRE_OK(kefir_bitset_ensure(mem, &dense->alive_values[i], dense->num_of_values));
+        REQUIRE_OK(kefir_bitset_clear(&dense->alive_values[i]));
+        REQUIRE_OK(kefir_bitset_ensure(mem, &dense->live_in[i], dense->num_of_values));
+        REQUIRE_OK(kefir_bitset_clear(&dense->live_in[i]));
+    }
+    for (kefir_size_t i = 0; i < dense->num_of_values; i++) {
+        REQUIRE_OK(mark_dense_uses(liveness, dense, i));
+    }
+
+    struct kefir_bitset live_out, queued_blocks;
+    struct kefir_queue queue;
+    REQUIRE_OK(kefir_bitset_init(&live_out));
+    REQUIRE_OK(kefir_bitset_init(&queued_blocks));
+    REQUIRE_OK(kefir_queue_init(&queue));
+    kefir_result_t res = propagate_dense(mem, liveness, control_flow, dense, &live_out, &queued_blocks, &queue);
+    kefir_bitset_free(mem, &live_out);
+    kefir_bitset_free(mem, &queued_blocks);
+    kefir_queue_free(mem, &queue);
+    REQUIRE_OK(res);
+
+    REQUIRE_OK(fill_dense_alive_sets(mem, liveness, dense));
+    return KEFIR_OK;
+}
+
+static kefir_result_t build_dense(struct kefir_mem *mem, struct kefir_opt_code_liveness *liveness,
+                                  const struct kefir_opt_code_control_flow *control_flow,
+                                  const struct verify_use_def_payload *trace) {
+    // Dense bitsets are used only to solve the dataflow problem. Resulting alive sets are stored in the same form
+    // as in the sparse mode, so that both modes are indistinguishable for liveness users.
+    struct dense_liveness dense = {0};
+    dense.values = KEFIR_MALLOC(mem, sizeof(kefir_opt_instruction_ref_t) * MAX(trace->traced_length, 1));
+    dense.buffer = KEFIR_MALLOC(mem, sizeof(kefir_opt_instruction_ref_t) * MAX(trace->traced_length, 1));
+    dense.block_value_offsets = KEFIR_MALLOC(mem, sizeof(kefir_size_t) * (liveness->num_of_blocks + 1));
+    dense.alive_values = KEFIR_MALLOC(mem, sizeof(struct kefir_bitset) * MAX(liveness->num_of_blocks, 1));
+    dense.live_in = KEFIR_MALLOC(mem, sizeof(struct kefir_bitset) * MAX(liveness->num_of_blocks, 1));
+
+    kefir_result_t res = KEFIR_OK;
+    if (dense.values == NULL || dense.buffer == NULL || dense.block_value_offsets == NULL ||
+        dense.alive_values == NULL || dense.live_in == NULL) {
+        res = KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate optimizer code dense liveness");
+    } else {
+        for (kefir_size_t i = 0; i < liveness->num_of_blocks; i++) {
+            kefir_bitset_init(&dense.alive_values[i]);
+            kefir_bitset_init(&dense.live_in[i]);
+        }
+        res = build_dense_impl(mem, liveness, control_flow, trace, &dense);
+        for (kefir_size_t i = 0; i < liveness->num_of_blocks; i++) {
+            kefir_bitset_free(mem, &dense.alive_values[i]);
+            kefir_bitset_free(mem, &dense.live_in[i]);
+        }
+    }
+    KEFIR_FREE(mem, dense.values);
+    KEFIR_FREE(mem, dense.buffer);
+    KEFIR_FREE(mem, dense.block_value_offsets);
+    KEFIR_FREE(mem, dense.alive_values);
+    KEFIR_FREE(mem, dense.live_in);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
 static kefir_result_t trace_use_def(struct kefir_mem *mem, struct kefir_opt_code_liveness *liveness,
                                     struct kefir_opt_code_control_flow *control_flow,
                                     struct kefir_opt_code_sequencing *sequencing) {
@@ -196,11 +519,25 @@ static kefir_result_t trace_use_def(struct kefir_mem *mem, struct kefir_opt_code
                                              .liveness = liveness,
                                              .control_flow = control_flow,
                                              .sequencing = sequencing,
-                                             .instr_ref = KEFIR_ID_NONE};
+                                             .instr_ref = KEFIR_ID_NONE,
+                                             .traced = NULL,
+                                             .traced_length = 0,
+                                             .traced_capacity = 0};
     struct kefir_opt_code_container_tracer tracer = {.trace_instruction = verify_use_def, .payload = &payload};
-    REQUIRE_OK(kefir_opt_code_container_trace(mem, liveness->code, &tracer));
+    kefir_result_t res = kefir_opt_code_container_trace(mem, liveness->code, &tracer);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(mem, payload.traced);
+        return res;
+    });
 
-    REQUIRE_OK(propagate_alive_instructions(mem, liveness, control_flow));
+    if (payload.traced_length >= KEFIR_OPT_CODE_LIVENESS_DENSE_THRESHOLD &&
+        payload.traced_length * liveness->num_of_blocks <= KEFIR_OPT_CODE_LIVENESS_DENSE_MAX_BITS) {
+        res = build_dense(mem, liveness, control_flow, &payload);
+    } else {
+        res = build_sparse(mem, liveness, control_flow, &payload);
+    }
+    KEFIR_FREE(mem, payload.traced);
+    REQUIRE_OK(res);
     return KEFIR_OK;
 }
 
@@ -208,9 +545,7 @@ kefir_result_t kefir_opt_code_liveness_init(struct kefir_opt_code_liveness *live
     REQUIRE(liveness != NULL,
             KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer code liveness"));
 
-    liveness->code = NULL;
-    liveness->blocks = NULL;
-    liveness->num_of_blocks = 0;
+    memset(liveness, 0, sizeof(struct kefir_opt_code_liveness));
     return KEFIR_OK;
 }
 
@@ -232,16 +567,7 @@ kefir_result_t kefir_opt_code_liveness_reset(struct kefir_mem *mem, struct kefir
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(liveness != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code liveness"));
 
-    if (liveness->code != NULL) {
-        for (kefir_size_t i = 0; i < liveness->num_of_blocks; i++) {
-            REQUIRE_OK(kefir_hashset_free(mem, &liveness->blocks[i].alive_instr));
-        }
-        KEFIR_FREE(mem, liveness->blocks);
-        memset(liveness, 0, sizeof(struct kefir_opt_code_liveness));
-    }
-    liveness->code = NULL;
-    liveness->blocks = NULL;
-    liveness->num_of_blocks = 0;
+    REQUIRE_OK(kefir_opt_code_liveness_free(mem, liveness));
     return KEFIR_OK;
 }
 
@@ -257,19 +583,24 @@ kefir_result_t kefir_opt_code_liveness_build(struct kefir_mem *mem, struct kefir
     struct kefir_opt_code_sequencing sequencing;
     REQUIRE_OK(kefir_opt_code_sequencing_init(&sequencing));
 
-    liveness->code = control_flow->code;
     kefir_result_t res;
-    liveness->num_of_blocks = kefir_opt_code_container_block_count(liveness->code);
+    liveness->num_of_blocks = kefir_opt_code_container_block_count(control_flow->code);
     liveness->blocks = KEFIR_MALLOC(mem, sizeof(struct kefir_opt_code_liveness_block) * liveness->num_of_blocks);
-    REQUIRE(liveness->blocks != NULL,
-            KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate optimizer code liveness blocks"));
+    REQUIRE_ELSE(liveness->blocks != NULL, {
+        kefir_opt_code_sequencing_free(mem, &sequencing);
+        memset(liveness, 0, sizeof(struct kefir_opt_code_liveness));
+        return KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate optimizer code liveness blocks");
+    });
     for (kefir_size_t i = 0; i < liveness->num_of_blocks; i++) {
         res = kefir_hashset_init(&liveness->blocks[i].alive_instr, &kefir_hashtable_uint_ops);
         REQUIRE_ELSE(res == KEFIR_OK, {
             KEFIR_FREE(mem, liveness->blocks);
+            kefir_opt_code_sequencing_free(mem, &sequencing);
             memset(liveness, 0, sizeof(struct kefir_opt_code_liveness));
+            return res;
         });
     }
+    liveness->code = control_flow->code;
 
     res = trace_use_def(mem, liveness, control_flow, &sequencing);
     REQUIRE_ELSE(res == KEFIR_OK, {
@@ -295,3 +626,43 @@ kefir_result_t kefir_opt_code_liveness_instruction_is_alive(const struct kefir_o
     *alive_ptr = kefir_hashset_has(&liveness->blocks[instr->block_id].alive_instr, (kefir_hashset_key_t) instr_ref);
     return KEFIR_OK;
 }
+
+kefir_result_t kefir_opt_code_liveness_instruction_is_alive_in_block(const struct kefir_opt_code_liveness *liveness,
+                                                                     kefir_opt_block_id_t block_id,
+                                                                     kefir_opt_instruction_ref_t instr_ref,
+                                                                     kefir_bool_t *alive_ptr) {
+    REQUIRE(liveness != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code liveness"));
+    REQUIRE(block_id < liveness->num_of_blocks,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Requested optimizer block is out of liveness bounds"));
+    REQUIRE(alive_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to boolean flag"));
+
+    *alive_ptr = kefir_hashset_has(&liveness->blocks[block_id].alive_instr, (kefir_hashset_key_t) instr_ref);
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_code_liveness_block_iter(const struct kefir_opt_code_liveness *liveness,
+                                                  struct kefir_opt_code_liveness_block_iterator *iter,
+                                                  kefir_opt_block_id_t block_id,
+                                                  kefir_opt_instruction_ref_t *instr_ref_ptr) {
+    REQUIRE(liveness != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code liveness"));
+    REQUIRE(iter != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer code liveness iterator"));
+    REQUIRE(block_id < liveness->num_of_blocks,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Requested optimizer block is out of liveness bounds"));
+
+    kefir_hashset_key_t entry;
+    REQUIRE_OK(kefir_hashset_iter(&liveness->blocks[block_id].alive_instr, &iter->iter, &entry));
+    ASSIGN_PTR(instr_ref_ptr, (kefir_opt_instruction_ref_t) entry);
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_code_liveness_block_next(struct kefir_opt_code_liveness_block_iterator *iter,
+                                                  kefir_opt_instruction_ref_t *instr_ref_ptr) {
+    REQUIRE(iter != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code liveness iterator"));
+
+    kefir_hashset_key_t entry;
+    REQUIRE_OK(kefir_hashset_next(&iter->iter, &entry));
+    ASSIGN_PTR(instr_ref_ptr, (kefir_opt_instruction_ref_t) entry);
+    return KEFIR_OK;
+}
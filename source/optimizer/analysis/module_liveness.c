@@ -25,12 +25,30 @@
 #include "kefir/core/util.h"
 #include <string.h>
 
+static kefir_result_t free_function_summary(struct kefir_mem *mem, struct kefir_hashtree *tree,
+                                            kefir_hashtree_key_t key, kefir_hashtree_value_t value, void *payload) {
+    UNUSED(tree);
+    UNUSED(key);
+    UNUSED(payload);
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    ASSIGN_DECL_CAST(struct kefir_opt_module_liveness_function_summary *, summary, value);
+    REQUIRE(summary != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid function liveness summary"));
+
+    REQUIRE_OK(kefir_hashtreeset_free(mem, &summary->string_literals));
+    REQUIRE_OK(kefir_hashtreeset_free(mem, &summary->symbols));
+    KEFIR_FREE(mem, summary);
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_opt_module_liveness_init(struct kefir_opt_module_liveness *liveness) {
     REQUIRE(liveness != NULL,
             KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer module liveness"));
 
     REQUIRE_OK(kefir_hashtreeset_init(&liveness->symbols, &kefir_hashtree_str_ops));
     REQUIRE_OK(kefir_hashtreeset_init(&liveness->string_literals, &kefir_hashtree_uint_ops));
+    REQUIRE_OK(kefir_hashtree_init(&liveness->function_summaries, &kefir_hashtree_str_ops));
+    REQUIRE_OK(kefir_hashtree_on_removal(&liveness->function_summaries, free_function_summary, NULL));
+    REQUIRE_OK(kefir_hashtreeset_init(&liveness->roots, &kefir_hashtree_str_ops));
     return KEFIR_OK;
 }
 
@@ -38,12 +56,14 @@ kefir_result_t kefir_opt_module_liveness_free(struct kefir_mem *mem, struct kefi
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(liveness != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module liveness"));
 
+    REQUIRE_OK(kefir_hashtreeset_free(mem, &liveness->roots));
+    REQUIRE_OK(kefir_hashtree_free(mem, &liveness->function_summaries));
     REQUIRE_OK(kefir_hashtreeset_free(mem, &liveness->string_literals));
     REQUIRE_OK(kefir_hashtreeset_free(mem, &liveness->symbols));
     return KEFIR_OK;
 }
 
-static kefir_result_t trace_inline_asm(struct kefir_mem *mem, struct kefir_opt_module_liveness *liveness,
+static kefir_result_t trace_inline_asm(struct kefir_mem *mem, struct kefir_hashtreeset *string_literals,
                                        struct kefir_queue *symbol_queue,
                                        const struct kefir_ir_inline_assembly *inline_asm) {
     for (const struct kefir_list_entry *iter = kefir_list_head(&inline_asm->parameter_list); iter != NULL;
@@ -57,7 +77,7 @@ static kefir_result_t trace_inline_asm(struct kefir_mem *mem, struct kefir_opt_m
                     break;
 
                 case KEFIR_IR_INLINE_ASSEMBLY_IMMEDIATE_LITERAL_BASED:
-                    REQUIRE_OK(kefir_hashtreeset_add(mem, &liveness->string_literals,
+                    REQUIRE_OK(kefir_hashtreeset_add(mem, string_literals,
                                                      (kefir_hashtreeset_entry_t) param->immediate_literal_base));
                     break;
 
@@ -79,7 +99,7 @@ static kefir_result_t trace_inline_asm(struct kefir_mem *mem, struct kefir_opt_m
 
 struct function_trace_payload {
     struct kefir_mem *mem;
-    struct kefir_opt_module_liveness *liveness;
+    struct kefir_hashtreeset *string_literals;
     const struct kefir_opt_module *module;
     const struct kefir_opt_function *function;
     struct kefir_queue *symbol_queue;
@@ -119,7 +139,7 @@ static kefir_result_t trace_instruction(kefir_opt_instruction_ref_t instr_ref, v
         } break;
 
         case KEFIR_OPT_OPCODE_STRING_REF:
-            REQUIRE_OK(kefir_hashtreeset_add(param->mem, &param->liveness->string_literals,
+            REQUIRE_OK(kefir_hashtreeset_add(param->mem, param->string_literals,
                                              (kefir_hashtreeset_entry_t) instr->operation.parameters.imm.string_ref));
             break;
 
@@ -130,7 +150,7 @@ static kefir_result_t trace_instruction(kefir_opt_instruction_ref_t instr_ref, v
             const struct kefir_ir_inline_assembly *inline_asm =
                 kefir_ir_module_get_inline_assembly(param->module->ir_module, opt_inline_asm->inline_asm_id);
             REQUIRE(inline_asm != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unable to find IR inline assembly"));
-            REQUIRE_OK(trace_inline_asm(param->mem, param->liveness, param->symbol_queue, inline_asm));
+            REQUIRE_OK(trace_inline_asm(param->mem, param->string_literals, param->symbol_queue, inline_asm));
         } break;
 
         default:
@@ -140,11 +160,14 @@ static kefir_result_t trace_instruction(kefir_opt_instruction_ref_t instr_ref, v
     return KEFIR_OK;
 }
 
-static kefir_result_t trace_function(struct kefir_mem *mem, struct kefir_opt_module_liveness *liveness,
+static kefir_result_t trace_function(struct kefir_mem *mem, struct kefir_hashtreeset *string_literals,
                                      const struct kefir_opt_module *module, const struct kefir_opt_function *function,
                                      struct kefir_queue *symbol_queue) {
-    struct function_trace_payload payload = {
-        .mem = mem, .liveness = liveness, .module = module, .function = function, .symbol_queue = symbol_queue};
+    struct function_trace_payload payload = {.mem = mem,
+                                             .string_literals = string_literals,
+                                             .module = module,
+                                             .function = function,
+                                             .symbol_queue = symbol_queue};
     struct kefir_opt_code_container_tracer tracer = {.trace_instruction = trace_instruction, .payload = &payload};
     REQUIRE_OK(kefir_opt_code_container_trace(mem, &function->code, &tracer));
     return KEFIR_OK;
@@ -176,6 +199,7 @@ static kefir_result_t trace_data(struct kefir_mem *mem, struct kefir_opt_module_
             case KEFIR_IR_DATA_VALUE_RAW:
             case KEFIR_IR_DATA_VALUE_AGGREGATE:
             case KEFIR_IR_DATA_VALUE_BITS:
+            case KEFIR_IR_DATA_VALUE_PACKED:
                 // Intentionally left blank
                 break;
 
@@ -221,9 +245,34 @@ static kefir_result_t initialize_symbol_queue(struct kefir_mem *mem, struct kefi
          node != NULL; node = kefir_hashtree_next(&iter)) {
 
         ASSIGN_DECL_CAST(struct kefir_ir_inline_assembly *, inline_asm, node->value);
-        REQUIRE_OK(trace_inline_asm(mem, liveness, symbol_queue, inline_asm));
+        REQUIRE_OK(trace_inline_asm(mem, &liveness->string_literals, symbol_queue, inline_asm));
     }
 
+    struct kefir_hashtreeset_iterator roots_iter;
+    kefir_result_t res;
+    for (res = kefir_hashtreeset_iter(&liveness->roots, &roots_iter); res == KEFIR_OK;
+         res = kefir_hashtreeset_next(&roots_iter)) {
+        REQUIRE_OK(kefir_queue_push(mem, symbol_queue, (kefir_queue_entry_t) roots_iter.entry));
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+
+    return KEFIR_OK;
+}
+
+static kefir_result_t trace_function_summary(struct kefir_mem *mem, struct kefir_opt_module_liveness *liveness,
+                                             const struct kefir_opt_module_liveness_function_summary *summary,
+                                             struct kefir_queue *symbol_queue) {
+    struct kefir_hashtreeset_iterator iter;
+    kefir_result_t res;
+    for (res = kefir_hashtreeset_iter(&summary->symbols, &iter); res == KEFIR_OK; res = kefir_hashtreeset_next(&iter)) {
+        REQUIRE_OK(kefir_queue_push(mem, symbol_queue, (kefir_queue_entry_t) iter.entry));
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    REQUIRE_OK(kefir_hashtreeset_merge(mem, &liveness->string_literals, &summary->string_literals, NULL, NULL));
     return KEFIR_OK;
 }
 
@@ -244,10 +293,17 @@ static kefir_result_t liveness_trace(struct kefir_mem *mem, struct kefir_opt_mod
         if (res != KEFIR_NOT_FOUND) {
             REQUIRE_OK(res);
             ASSIGN_DECL_CAST(const struct kefir_ir_function *, func, node->value);
-            struct kefir_opt_function *opt_func;
-            REQUIRE_OK(kefir_opt_module_get_function(module, func->declaration->id, &opt_func));
             REQUIRE_OK(kefir_hashtreeset_add(mem, &liveness->symbols, (kefir_hashtreeset_entry_t) symbol));
-            REQUIRE_OK(trace_function(mem, liveness, module, opt_func, symbol_queue));
+            const struct kefir_opt_module_liveness_function_summary *summary;
+            res = kefir_opt_module_liveness_function_summary(liveness, symbol, &summary);
+            if (res != KEFIR_NOT_FOUND) {
+                REQUIRE_OK(res);
+                REQUIRE_OK(trace_function_summary(mem, liveness, summary, symbol_queue));
+            } else {
+                struct kefir_opt_function *opt_func;
+                REQUIRE_OK(kefir_opt_module_get_function(module, func->declaration->id, &opt_func));
+                REQUIRE_OK(trace_function(mem, &liveness->string_literals, module, opt_func, symbol_queue));
+            }
         }
 
         res = kefir_hashtree_at(&module->ir_module->named_data, (kefir_hashtree_key_t) symbol, &node);
@@ -289,6 +345,84 @@ kefir_result_t kefir_opt_module_liveness_trace(struct kefir_mem *mem, struct kef
     return KEFIR_OK;
 }
 
+static kefir_result_t summarize_function_impl(struct kefir_mem *mem, const struct kefir_opt_module *module,
+                                              const struct kefir_opt_function *function,
+                                              struct kefir_opt_module_liveness_function_summary *summary,
+                                              struct kefir_queue *symbol_queue) {
+    REQUIRE_OK(trace_function(mem, &summary->string_literals, module, function, symbol_queue));
+    while (!kefir_queue_is_empty(symbol_queue)) {
+        kefir_queue_entry_t entry;
+        REQUIRE_OK(kefir_queue_pop_first(mem, symbol_queue, &entry));
+        REQUIRE_OK(kefir_hashtreeset_add(mem, &summary->symbols, (kefir_hashtreeset_entry_t) entry));
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_module_liveness_summarize_function(struct kefir_mem *mem,
+                                                            struct kefir_opt_module_liveness *liveness,
+                                                            const struct kefir_opt_module *module,
+                                                            const struct kefir_opt_function *function) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(liveness != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module liveness"));
+    REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
+    REQUIRE(function != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
+    REQUIRE(!kefir_hashtree_has(&liveness->function_summaries, (kefir_hashtree_key_t) function->ir_func->name),
+            KEFIR_OK);
+
+    struct kefir_opt_module_liveness_function_summary *summary =
+        KEFIR_MALLOC(mem, sizeof(struct kefir_opt_module_liveness_function_summary));
+    REQUIRE(summary != NULL,
+            KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate optimizer function liveness summary"));
+    kefir_result_t res = kefir_hashtreeset_init(&summary->symbols, &kefir_hashtree_str_ops);
+    REQUIRE_CHAIN(&res, kefir_hashtreeset_init(&summary->string_literals, &kefir_hashtree_uint_ops));
+    REQUIRE_CHAIN(&res, kefir_hashtree_insert(mem, &liveness->function_summaries,
+                                              (kefir_hashtree_key_t) function->ir_func->name,
+                                              (kefir_hashtree_value_t) summary));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(mem, summary);
+        return res;
+    });
+
+    struct kefir_queue symbol_queue;
+    REQUIRE_OK(kefir_queue_init(&symbol_queue));
+    res = summarize_function_impl(mem, module, function, summary, &symbol_queue);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_queue_free(mem, &symbol_queue);
+        return res;
+    });
+    REQUIRE_OK(kefir_queue_free(mem, &symbol_queue));
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_module_liveness_function_summary(
+    const struct kefir_opt_module_liveness *liveness, const char *function_name,
+    const struct kefir_opt_module_liveness_function_summary **summary_ptr) {
+    REQUIRE(liveness != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module liveness"));
+    REQUIRE(function_name != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid function name"));
+    REQUIRE(summary_ptr != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to function liveness summary"));
+
+    struct kefir_hashtree_node *node;
+    kefir_result_t res = kefir_hashtree_at(&liveness->function_summaries, (kefir_hashtree_key_t) function_name, &node);
+    if (res == KEFIR_NOT_FOUND) {
+        res = KEFIR_SET_ERROR(KEFIR_NOT_FOUND, "Unable to find requested function liveness summary");
+    }
+    REQUIRE_OK(res);
+
+    *summary_ptr = (const struct kefir_opt_module_liveness_function_summary *) node->value;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_module_liveness_add_root(struct kefir_mem *mem, struct kefir_opt_module_liveness *liveness,
+                                                  const char *symbol) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(liveness != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module liveness"));
+    REQUIRE(symbol != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid symbol"));
+
+    REQUIRE_OK(kefir_hashtreeset_add(mem, &liveness->roots, (kefir_hashtreeset_entry_t) symbol));
+    return KEFIR_OK;
+}
+
 kefir_bool_t kefir_opt_module_is_symbol_alive(const struct kefir_opt_module_liveness *liveness, const char *symbol) {
     REQUIRE(liveness != NULL, false);
     return kefir_hashtreeset_has(&liveness->symbols, (kefir_hashtreeset_entry_t) symbol);
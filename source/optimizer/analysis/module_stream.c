@@ -0,0 +1,487 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "kefir/optimizer/module_stream.h"
+#include "kefir/core/queue.h"
+#include "kefir/core/error.h"
+#include "kefir/core/util.h"
+#include <string.h>
+
+static kefir_result_t free_stream_function(struct kefir_mem *mem, struct kefir_hashtree *tree,
+                                           kefir_hashtree_key_t key, kefir_hashtree_value_t value, void *payload) {
+    UNUSED(tree);
+    UNUSED(key);
+    UNUSED(payload);
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    ASSIGN_DECL_CAST(struct kefir_opt_module_stream_function *, function, value);
+    REQUIRE(function != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer stream function"));
+
+    REQUIRE_OK(kefir_hashtreeset_free(mem, &function->callees));
+    REQUIRE_OK(kefir_hashtreeset_free(mem, &function->callers));
+    KEFIR_FREE(mem, function);
+    return KEFIR_OK;
+}
+
+static kefir_result_t get_function(const struct kefir_opt_module_stream *stream, const char *name,
+                                   struct kefir_opt_module_stream_function **function_ptr) {
+    struct kefir_hashtree_node *node;
+    kefir_result_t res = kefir_hashtree_at(&stream->functions, (kefir_hashtree_key_t) name, &node);
+    if (res == KEFIR_NOT_FOUND) {
+        res = KEFIR_SET_ERROR(KEFIR_NOT_FOUND, "Unable to find requested optimizer stream function");
+    }
+    REQUIRE_OK(res);
+    *function_ptr = (struct kefir_opt_module_stream_function *) node->value;
+    return KEFIR_OK;
+}
+
+static kefir_result_t get_or_new_function(struct kefir_mem *mem, struct kefir_opt_module_stream *stream,
+                                          const struct kefir_ir_function *ir_func,
+                                          struct kefir_opt_module_stream_function **function_ptr) {
+    kefir_result_t res = get_function(stream, ir_func->name, function_ptr);
+    if (res != KEFIR_NOT_FOUND) {
+        REQUIRE_OK(res);
+        return KEFIR_OK;
+    }
+
+    struct kefir_opt_module_stream_function *function =
+        KEFIR_MALLOC(mem, sizeof(struct kefir_opt_module_stream_function));
+    REQUIRE(function != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate optimizer stream function"));
+    function->ir_func = ir_func;
+    function->pending_callers = 0;
+    function->pinned = false;
+    function->constructed = false;
+    function->ready = false;
+    function->dead = false;
+    res = kefir_hashtreeset_init(&function->callers, &kefir_hashtree_str_ops);
+    REQUIRE_CHAIN(&res, kefir_hashtreeset_init(&function->callees, &kefir_hashtree_str_ops));
+    REQUIRE_CHAIN(&res, kefir_hashtree_insert(mem, &stream->functions, (kefir_hashtree_key_t) ir_func->name,
+                                              (kefir_hashtree_value_t) function));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(mem, function);
+        return res;
+    });
+
+    *function_ptr = function;
+    return KEFIR_OK;
+}
+
+struct scan_state {
+    struct kefir_queue symbol_queue;
+    struct kefir_hashtreeset pinned;
+};
+
+static kefir_result_t push_pinned(struct kefir_mem *mem, struct scan_state *state, const char *symbol) {
+    REQUIRE_OK(kefir_queue_push(mem, &state->symbol_queue, (kefir_queue_entry_t) symbol));
+    REQUIRE_OK(kefir_hashtreeset_add(mem, &state->pinned, (kefir_hashtreeset_entry_t) symbol));
+    return KEFIR_OK;
+}
+
+static kefir_result_t scan_inline_asm(struct kefir_mem *mem, struct scan_state *state,
+                                      const struct kefir_ir_inline_assembly *inline_asm) {
+    for (const struct kefir_list_entry *iter = kefir_list_head(&inline_asm->parameter_list); iter != NULL;
+         kefir_list_next(&iter)) {
+        ASSIGN_DECL_CAST(struct kefir_ir_inline_assembly_parameter *, param, iter->value);
+        if (param->klass == KEFIR_IR_INLINE_ASSEMBLY_PARAMETER_IMMEDIATE &&
+            param->immediate_type == KEFIR_IR_INLINE_ASSEMBLY_IMMEDIATE_IDENTIFIER_BASED) {
+            REQUIRE_OK(push_pinned(mem, state, param->immediate_identifier_base));
+        }
+    }
+
+    for (const struct kefir_list_entry *iter = kefir_list_head(&inline_asm->jump_target_list); iter != NULL;
+         kefir_list_next(&iter)) {
+        ASSIGN_DECL_CAST(struct kefir_ir_inline_assembly_jump_target *, jump_target, iter->value);
+        REQUIRE_OK(push_pinned(mem, state, jump_target->target_function));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t scan_function_reference(struct kefir_mem *mem, struct kefir_opt_module_stream *stream,
+                                              struct scan_state *state,
+                                              struct kefir_opt_module_stream_function *function, const char *symbol) {
+    REQUIRE_OK(kefir_queue_push(mem, &state->symbol_queue, (kefir_queue_entry_t) symbol));
+
+    const struct kefir_ir_function *ir_callee = kefir_ir_module_get_function(stream->ir_module, symbol);
+    if (ir_callee != NULL) {
+        struct kefir_opt_module_stream_function *callee;
+        REQUIRE_OK(get_or_new_function(mem, stream, ir_callee, &callee));
+        if (!kefir_hashtreeset_has(&callee->callers, (kefir_hashtreeset_entry_t) function->ir_func->name)) {
+            REQUIRE_OK(kefir_hashtreeset_add(mem, &function->callees, (kefir_hashtreeset_entry_t) ir_callee->name));
+            REQUIRE_OK(
+                kefir_hashtreeset_add(mem, &callee->callers, (kefir_hashtreeset_entry_t) function->ir_func->name));
+            callee->pending_callers++;
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t scan_function(struct kefir_mem *mem, struct kefir_opt_module_stream *stream,
+                                    struct scan_state *state, const struct kefir_ir_function *ir_func) {
+    struct kefir_opt_module_stream_function *function;
+    REQUIRE_OK(get_or_new_function(mem, stream, ir_func, &function));
+
+    for (kefir_size_t i = 0; i < kefir_irblock_length(&ir_func->body); i++) {
+        const struct kefir_irinstr *instr = kefir_irblock_at(&ir_func->body, i);
+        switch (instr->opcode) {
+            case KEFIR_IR_OPCODE_INVOKE:
+            case KEFIR_IR_OPCODE_INVOKE_VIRTUAL:
+            case KEFIR_IR_OPCODE_TAIL_INVOKE:
+            case KEFIR_IR_OPCODE_TAIL_INVOKE_VIRTUAL: {
+                const struct kefir_ir_function_decl *decl =
+                    kefir_ir_module_get_declaration(stream->ir_module, (kefir_id_t) instr->arg.u64);
+                REQUIRE(decl != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unable to find IR function declaration"));
+                if (decl->name != NULL) {
+                    REQUIRE_OK(scan_function_reference(mem, stream, state, function, decl->name));
+                }
+            } break;
+
+            case KEFIR_IR_OPCODE_GET_GLOBAL:
+            case KEFIR_IR_OPCODE_GET_THREAD_LOCAL: {
+                const char *symbol = kefir_ir_module_get_named_symbol(stream->ir_module, (kefir_id_t) instr->arg.u64);
+                REQUIRE(symbol != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unable to find named IR symbol"));
+                REQUIRE_OK(scan_function_reference(mem, stream, state, function, symbol));
+            } break;
+
+            case KEFIR_IR_OPCODE_INLINE_ASSEMBLY: {
+                const struct kefir_ir_inline_assembly *inline_asm =
+                    kefir_ir_module_get_inline_assembly(stream->ir_module, (kefir_id_t) instr->arg.u64);
+                REQUIRE(inline_asm != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unable to find IR inline assembly"));
+                REQUIRE_OK(scan_inline_asm(mem, state, inline_asm));
+            } break;
+
+            default:
+                // Intentionally left blank
+                break;
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t scan_data(struct kefir_mem *mem, struct scan_state *state, const struct kefir_ir_data *data) {
+    for (kefir_size_t i = 0; i < data->total_length; i++) {
+        const struct kefir_ir_data_value *value;
+        REQUIRE_OK(kefir_ir_data_value_at(data, i, &value));
+        if (value->defined && value->type == KEFIR_IR_DATA_VALUE_POINTER) {
+            REQUIRE_OK(push_pinned(mem, state, value->value.pointer.reference));
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t scan_module(struct kefir_mem *mem, struct kefir_opt_module_stream *stream,
+                                  struct scan_state *state) {
+    struct kefir_hashtree_node_iterator iter;
+    for (const struct kefir_hashtree_node *node = kefir_hashtree_iter(&stream->ir_module->identifiers, &iter);
+         node != NULL; node = kefir_hashtree_next(&iter)) {
+        ASSIGN_DECL_CAST(const struct kefir_ir_identifier *, ir_identifier, node->value);
+        if (ir_identifier->scope == KEFIR_IR_IDENTIFIER_SCOPE_EXPORT ||
+            ir_identifier->scope == KEFIR_IR_IDENTIFIER_SCOPE_EXPORT_WEAK) {
+            REQUIRE_OK(push_pinned(mem, state, (const char *) node->key));
+        }
+    }
+
+    for (const struct kefir_ir_function *ir_func = kefir_ir_module_function_iter(stream->ir_module, &iter);
+         ir_func != NULL; ir_func = kefir_ir_module_function_next(&iter)) {
+        if (ir_func->flags.constructor || ir_func->flags.destructor || ir_func->flags.used) {
+            REQUIRE_OK(push_pinned(mem, state, ir_func->name));
+        }
+    }
+
+    for (const struct kefir_hashtree_node *node = kefir_hashtree_iter(&stream->ir_module->global_inline_asm, &iter);
+         node != NULL; node = kefir_hashtree_next(&iter)) {
+        REQUIRE_OK(scan_inline_asm(mem, state, (const struct kefir_ir_inline_assembly *) node->value));
+    }
+
+    while (!kefir_queue_is_empty(&state->symbol_queue)) {
+        kefir_queue_entry_t entry;
+        REQUIRE_OK(kefir_queue_pop_first(mem, &state->symbol_queue, &entry));
+        ASSIGN_DECL_CAST(const char *, symbol, entry);
+        if (kefir_hashtreeset_has(&stream->ir_liveness.symbols, (kefir_hashtreeset_entry_t) symbol)) {
+            continue;
+        }
+        REQUIRE_OK(kefir_hashtreeset_add(mem, &stream->ir_liveness.symbols, (kefir_hashtreeset_entry_t) symbol));
+
+        const struct kefir_ir_function *ir_func = kefir_ir_module_get_function(stream->ir_module, symbol);
+        if (ir_func != NULL) {
+            REQUIRE_OK(scan_function(mem, stream, state, ir_func));
+        }
+
+        struct kefir_hashtree_node *node;
+        kefir_result_t res = kefir_hashtree_at(&stream->ir_module->named_data, (kefir_hashtree_key_t) symbol, &node);
+        if (res != KEFIR_NOT_FOUND) {
+            REQUIRE_OK(res);
+            REQUIRE_OK(scan_data(mem, state, (const struct kefir_ir_data *) node->value));
+        }
+
+        res = kefir_hashtree_at(&stream->ir_module->identifiers, (kefir_hashtree_key_t) symbol, &node);
+        if (res != KEFIR_NOT_FOUND) {
+            REQUIRE_OK(res);
+            ASSIGN_DECL_CAST(const struct kefir_ir_identifier *, ir_identifier, node->value);
+            if (ir_identifier->alias != NULL) {
+                REQUIRE_OK(push_pinned(mem, state, ir_identifier->alias));
+            }
+        }
+    }
+
+    struct kefir_hashtreeset_iterator pinned_iter;
+    kefir_result_t res;
+    for (res = kefir_hashtreeset_iter(&state->pinned, &pinned_iter); res == KEFIR_OK;
+         res = kefir_hashtreeset_next(&pinned_iter)) {
+        struct kefir_opt_module_stream_function *function;
+        res = get_function(stream, (const char *) pinned_iter.entry, &function);
+        if (res != KEFIR_NOT_FOUND) {
+            REQUIRE_OK(res);
+            function->pinned = true;
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t schedule_construction_impl(struct kefir_mem *mem, struct kefir_opt_module_stream *stream,
+                                                 struct kefir_list *stack, struct kefir_hashtreeset *expanded,
+                                                 struct kefir_hashtreeset *scheduled) {
+    struct kefir_hashtree_node_iterator iter;
+    for (const struct kefir_ir_function *root_func = kefir_ir_module_function_iter(stream->ir_module, &iter);
+         root_func != NULL; root_func = kefir_ir_module_function_next(&iter)) {
+        struct kefir_opt_module_stream_function *root;
+        kefir_result_t res = get_function(stream, root_func->name, &root);
+        if (res == KEFIR_NOT_FOUND) {
+            continue;
+        }
+        REQUIRE_OK(res);
+        REQUIRE_OK(kefir_list_insert_after(mem, stack, kefir_list_tail(stack), root));
+
+        // Depth-first post-order walk over the call graph: callees are scheduled for construction ahead of their
+        // callers, so that the inliner observes optimized callee code.
+        for (struct kefir_list_entry *stack_iter = kefir_list_tail(stack); stack_iter != NULL;
+             stack_iter = kefir_list_tail(stack)) {
+            ASSIGN_DECL_CAST(struct kefir_opt_module_stream_function *, function, stack_iter->value);
+            if (kefir_hashtreeset_has(scheduled, (kefir_hashtreeset_entry_t) function->ir_func->name)) {
+                REQUIRE_OK(kefir_list_pop(mem, stack, stack_iter));
+            } else if (!kefir_hashtreeset_has(expanded, (kefir_hashtreeset_entry_t) function->ir_func->name)) {
+                REQUIRE_OK(kefir_hashtreeset_add(mem, expanded, (kefir_hashtreeset_entry_t) function->ir_func->name));
+                struct kefir_hashtreeset_iterator callee_iter;
+                for (res = kefir_hashtreeset_iter(&function->callees, &callee_iter); res == KEFIR_OK;
+                     res = kefir_hashtreeset_next(&callee_iter)) {
+                    if (!kefir_hashtreeset_has(expanded, callee_iter.entry)) {
+                        struct kefir_opt_module_stream_function *callee;
+                        REQUIRE_OK(get_function(stream, (const char *) callee_iter.entry, &callee));
+                        REQUIRE_OK(kefir_list_insert_after(mem, stack, kefir_list_tail(stack), callee));
+                    }
+                }
+                if (res != KEFIR_ITERATOR_END) {
+                    REQUIRE_OK(res);
+                }
+            } else {
+                REQUIRE_OK(kefir_list_pop(mem, stack, stack_iter));
+                REQUIRE_OK(kefir_hashtreeset_add(mem, scheduled, (kefir_hashtreeset_entry_t) function->ir_func->name));
+                REQUIRE_OK(kefir_list_insert_after(mem, &stream->construction_queue,
+                                                   kefir_list_tail(&stream->construction_queue), function));
+            }
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t schedule_construction(struct kefir_mem *mem, struct kefir_opt_module_stream *stream) {
+    struct kefir_list stack;
+    struct kefir_hashtreeset expanded, scheduled;
+    REQUIRE_OK(kefir_list_init(&stack));
+    REQUIRE_OK(kefir_hashtreeset_init(&expanded, &kefir_hashtree_str_ops));
+    REQUIRE_OK(kefir_hashtreeset_init(&scheduled, &kefir_hashtree_str_ops));
+
+    kefir_result_t res = schedule_construction_impl(mem, stream, &stack, &expanded, &scheduled);
+    REQUIRE_CHAIN(&res, kefir_list_free(mem, &stack));
+    REQUIRE_CHAIN(&res, kefir_hashtreeset_free(mem, &expanded));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_hashtreeset_free(mem, &scheduled);
+        return res;
+    });
+    REQUIRE_OK(kefir_hashtreeset_free(mem, &scheduled));
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_module_stream_init(struct kefir_mem *mem, struct kefir_opt_module_stream *stream,
+                                            const struct kefir_ir_module *ir_module) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(stream != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer module stream"));
+    REQUIRE(ir_module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR module"));
+
+    stream->ir_module = ir_module;
+    REQUIRE_OK(kefir_opt_module_liveness_init(&stream->ir_liveness));
+    REQUIRE_OK(kefir_hashtree_init(&stream->functions, &kefir_hashtree_str_ops));
+    REQUIRE_OK(kefir_hashtree_on_removal(&stream->functions, free_stream_function, NULL));
+    REQUIRE_OK(kefir_list_init(&stream->construction_queue));
+    REQUIRE_OK(kefir_list_init(&stream->ready_queue));
+
+    struct scan_state state;
+    REQUIRE_OK(kefir_queue_init(&state.symbol_queue));
+    REQUIRE_OK(kefir_hashtreeset_init(&state.pinned, &kefir_hashtree_str_ops));
+    kefir_result_t res = scan_module(mem, stream, &state);
+    REQUIRE_CHAIN(&res, kefir_queue_free(mem, &state.symbol_queue));
+    REQUIRE_CHAIN(&res, kefir_hashtreeset_free(mem, &state.pinned));
+    REQUIRE_CHAIN(&res, schedule_construction(mem, stream));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_opt_module_stream_free(mem, stream);
+        return res;
+    });
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_module_stream_free(struct kefir_mem *mem, struct kefir_opt_module_stream *stream) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(stream != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module stream"));
+
+    REQUIRE_OK(kefir_list_free(mem, &stream->ready_queue));
+    REQUIRE_OK(kefir_list_free(mem, &stream->construction_queue));
+    REQUIRE_OK(kefir_hashtree_free(mem, &stream->functions));
+    REQUIRE_OK(kefir_opt_module_liveness_free(mem, &stream->ir_liveness));
+    stream->ir_module = NULL;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_module_stream_next_construction(struct kefir_mem *mem, struct kefir_opt_module_stream *stream,
+                                                         const struct kefir_ir_function **ir_func_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(stream != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module stream"));
+    REQUIRE(ir_func_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to IR function"));
+
+    struct kefir_list_entry *head = kefir_list_head(&stream->construction_queue);
+    if (head != NULL) {
+        ASSIGN_DECL_CAST(const struct kefir_opt_module_stream_function *, function, head->value);
+        *ir_func_ptr = function->ir_func;
+        REQUIRE_OK(kefir_list_pop(mem, &stream->construction_queue, head));
+    } else {
+        *ir_func_ptr = NULL;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t try_ready(struct kefir_mem *mem, struct kefir_opt_module_stream *stream,
+                                struct kefir_opt_module_stream_function *function) {
+    if (function->constructed && function->pending_callers == 0 && !function->ready) {
+        function->ready = true;
+        REQUIRE_OK(
+            kefir_list_insert_after(mem, &stream->ready_queue, kefir_list_tail(&stream->ready_queue), function));
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_module_stream_constructed(struct kefir_mem *mem, struct kefir_opt_module_stream *stream,
+                                                   const struct kefir_ir_function *ir_func) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(stream != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module stream"));
+    REQUIRE(ir_func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR function"));
+
+    struct kefir_opt_module_stream_function *function;
+    REQUIRE_OK(get_function(stream, ir_func->name, &function));
+    REQUIRE(!function->constructed,
+            KEFIR_SET_ERROR(KEFIR_INVALID_REQUEST, "Optimizer stream function has already been constructed"));
+    function->constructed = true;
+
+    struct kefir_hashtreeset_iterator iter;
+    kefir_result_t res;
+    for (res = kefir_hashtreeset_iter(&function->callees, &iter); res == KEFIR_OK;
+         res = kefir_hashtreeset_next(&iter)) {
+        struct kefir_opt_module_stream_function *callee;
+        REQUIRE_OK(get_function(stream, (const char *) iter.entry, &callee));
+        REQUIRE(callee->pending_callers > 0,
+                KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unexpected optimizer stream function caller counter"));
+        callee->pending_callers--;
+        REQUIRE_OK(try_ready(mem, stream, callee));
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    REQUIRE_OK(try_ready(mem, stream, function));
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_module_stream_next_ready(struct kefir_mem *mem, struct kefir_opt_module_stream *stream,
+                                                  const struct kefir_ir_function **ir_func_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(stream != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module stream"));
+    REQUIRE(ir_func_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to IR function"));
+
+    struct kefir_list_entry *head = kefir_list_head(&stream->ready_queue);
+    if (head != NULL) {
+        ASSIGN_DECL_CAST(const struct kefir_opt_module_stream_function *, function, head->value);
+        *ir_func_ptr = function->ir_func;
+        REQUIRE_OK(kefir_list_pop(mem, &stream->ready_queue, head));
+    } else {
+        *ir_func_ptr = NULL;
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_module_stream_is_alive(const struct kefir_opt_module_stream *stream,
+                                                const struct kefir_opt_module_liveness *liveness,
+                                                const struct kefir_ir_function *ir_func, kefir_bool_t *alive_ptr) {
+    REQUIRE(stream != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module stream"));
+    REQUIRE(liveness != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module liveness"));
+    REQUIRE(ir_func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR function"));
+    REQUIRE(alive_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to boolean"));
+
+    struct kefir_opt_module_stream_function *function;
+    REQUIRE_OK(get_function(stream, ir_func->name, &function));
+    REQUIRE(function->constructed && function->pending_callers == 0,
+            KEFIR_SET_ERROR(KEFIR_INVALID_REQUEST, "Optimizer stream function callers have not been constructed yet"));
+    if (function->pinned) {
+        *alive_ptr = true;
+        return KEFIR_OK;
+    }
+
+    // Callers have already been optimized, thus their summaries reflect references that survived inlining and dead
+    // code elimination. Callers with unknown liveness are conservatively assumed to be alive.
+    *alive_ptr = false;
+    struct kefir_hashtreeset_iterator iter;
+    kefir_result_t res;
+    for (res = kefir_hashtreeset_iter(&function->callers, &iter); res == KEFIR_OK && !*alive_ptr;
+         res = kefir_hashtreeset_next(&iter)) {
+        struct kefir_opt_module_stream_function *caller;
+        REQUIRE_OK(get_function(stream, (const char *) iter.entry, &caller));
+        if (caller->dead) {
+            continue;
+        }
+
+        const struct kefir_opt_module_liveness_function_summary *summary;
+        REQUIRE_OK(kefir_opt_module_liveness_function_summary(liveness, caller->ir_func->name, &summary));
+        *alive_ptr = kefir_hashtreeset_has(&summary->symbols, (kefir_hashtreeset_entry_t) ir_func->name);
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_module_stream_mark_dead(struct kefir_opt_module_stream *stream,
+                                                 const struct kefir_ir_function *ir_func) {
+    REQUIRE(stream != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module stream"));
+    REQUIRE(ir_func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR function"));
+
+    struct kefir_opt_module_stream_function *function;
+    REQUIRE_OK(get_function(stream, ir_func->name, &function));
+    function->dead = true;
+    return KEFIR_OK;
+}
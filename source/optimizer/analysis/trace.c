@@ -167,6 +167,18 @@ static kefir_result_t trace_instr(struct kefir_mem *mem, const struct kefir_opt_
                                    traced_blocks, pending_instr));
             break;
 
+        case KEFIR_OPT_OPCODE_SWITCH: {
+            const struct kefir_opt_switch_table *switch_table;
+            REQUIRE_OK(kefir_opt_code_container_switch_table(code, instr->operation.parameters.branch.switch_table_ref,
+                                                             &switch_table));
+            REQUIRE_OK(trace_block(mem, code, instr->operation.parameters.branch.target_block, instr_queue,
+                                   traced_blocks, pending_instr));
+            for (kefir_size_t i = switch_table->length; i > 0; i--) {
+                REQUIRE_OK(trace_block(mem, code, switch_table->targets[i - 1], instr_queue, traced_blocks,
+                                       pending_instr));
+            }
+        } break;
+
         case KEFIR_OPT_OPCODE_IJUMP: {
             *has_indirect_jumps = true;
 
@@ -223,11 +223,10 @@ static kefir_result_t scopes_build_impl(struct kefir_mem *mem, struct kefir_opt_
     kefir_result_t res;
     kefir_size_t block_count = kefir_opt_code_container_block_count(liveness->code);
     for (kefir_opt_block_id_t block_id = 0; block_id < block_count; block_id++) {
-        kefir_hashset_key_t entry;
-        struct kefir_hashset_iterator iter;
-        for (res = kefir_hashset_iter(&liveness->blocks[block_id].alive_instr, &iter, &entry); res == KEFIR_OK;
-             res = kefir_hashset_next(&iter, &entry)) {
-            ASSIGN_DECL_CAST(kefir_opt_instruction_ref_t, instr_ref, entry);
+        kefir_opt_instruction_ref_t instr_ref;
+        struct kefir_opt_code_liveness_block_iterator iter;
+        for (res = kefir_opt_code_liveness_block_iter(liveness, &iter, block_id, &instr_ref); res == KEFIR_OK;
+             res = kefir_opt_code_liveness_block_next(&iter, &instr_ref)) {
 
             const struct kefir_opt_instruction *instr;
             REQUIRE_OK(kefir_opt_code_container_instr(liveness->code, instr_ref, &instr));
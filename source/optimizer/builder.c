@@ -78,6 +78,7 @@ kefir_result_t kefir_opt_code_builder_is_finalized(const struct kefir_opt_code_c
             case KEFIR_OPT_OPCODE_JUMP:
             case KEFIR_OPT_OPCODE_IJUMP:
             case KEFIR_OPT_OPCODE_BRANCH:
+            case KEFIR_OPT_OPCODE_SWITCH:
             case KEFIR_OPT_OPCODE_RETURN:
             case KEFIR_OPT_OPCODE_UNREACHABLE:
             case KEFIR_OPT_OPCODE_TAIL_INVOKE:
@@ -199,6 +200,35 @@ kefir_result_t kefir_opt_code_builder_finalize_branch_compare(
     return KEFIR_OK;
 }
 
+kefir_result_t kefir_opt_code_builder_finalize_switch(struct kefir_mem *mem, struct kefir_opt_code_container *code,
+                                                      kefir_opt_block_id_t block_id,
+                                                      kefir_opt_instruction_ref_t index_ref,
+                                                      kefir_opt_block_id_t default_block,
+                                                      kefir_opt_switch_table_id_t switch_table_ref,
+                                                      kefir_opt_instruction_ref_t *instr_id_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(code != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code container"));
+
+    REQUIRE_OK(instr_exists(code, block_id, index_ref, false));
+    REQUIRE_OK(block_exists(code, default_block));
+
+    const struct kefir_opt_switch_table *switch_table;
+    REQUIRE_OK(kefir_opt_code_container_switch_table(code, switch_table_ref, &switch_table));
+    for (kefir_size_t i = 0; i < switch_table->length; i++) {
+        REQUIRE_OK(block_exists(code, switch_table->targets[i]));
+    }
+
+    REQUIRE_OK(kefir_opt_code_builder_add_instruction(
+        mem, code, block_id,
+        &(struct kefir_opt_operation) {.opcode = KEFIR_OPT_OPCODE_SWITCH,
+                                       .parameters = {.branch = {.target_block = default_block,
+                                                                 .alternative_block = KEFIR_ID_NONE,
+                                                                 .switch_table_ref = switch_table_ref},
+                                                      .refs = {index_ref, KEFIR_ID_NONE, KEFIR_ID_NONE}}},
+        true, instr_id_ptr));
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_opt_code_builder_finalize_return(struct kefir_mem *mem, struct kefir_opt_code_container *code,
                                                       kefir_opt_block_id_t block_id,
                                                       kefir_opt_instruction_ref_t arg_instr_id,
@@ -228,14 +258,16 @@ kefir_result_t kefir_opt_code_builder_finalize_unreachable(struct kefir_mem *mem
 
 kefir_result_t kefir_opt_code_builder_get_argument(struct kefir_mem *mem, struct kefir_opt_code_container *code,
                                                    kefir_opt_block_id_t block_id, kefir_size_t index,
+                                                   kefir_bool_t restrict_pointer,
                                                    kefir_opt_instruction_ref_t *instr_id_ptr) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(code != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code container"));
 
     REQUIRE_OK(kefir_opt_code_builder_add_instruction(
         mem, code, block_id,
-        &(struct kefir_opt_operation) {.opcode = KEFIR_OPT_OPCODE_GET_ARGUMENT, .parameters.index = index}, false,
-        instr_id_ptr));
+        &(struct kefir_opt_operation) {.opcode = KEFIR_OPT_OPCODE_GET_ARGUMENT,
+                                       .parameters.argument = {.index = index, .restrict_pointer = restrict_pointer}},
+        false, instr_id_ptr));
     return KEFIR_OK;
 }
 
@@ -469,6 +469,81 @@ kefir_result_t kefir_opt_comparison_operation_reciprocal(kefir_opt_comparison_op
     return KEFIR_OK;
 }
 
+static kefir_result_t instruction_uses_init(struct kefir_opt_instruction_uses *uses) {
+    uses->length = 0;
+    uses->capacity = KEFIR_OPT_INSTRUCTION_USES_INLINE_CAPACITY;
+    return KEFIR_OK;
+}
+
+static kefir_result_t instruction_uses_free(struct kefir_mem *mem, struct kefir_opt_instruction_uses *uses) {
+    if (uses->capacity > KEFIR_OPT_INSTRUCTION_USES_INLINE_CAPACITY) {
+        KEFIR_FREE(mem, uses->refs);
+    }
+    uses->length = 0;
+    uses->capacity = KEFIR_OPT_INSTRUCTION_USES_INLINE_CAPACITY;
+    return KEFIR_OK;
+}
+
+static inline kefir_opt_instruction_ref_t *instruction_uses_content(struct kefir_opt_instruction_uses *uses) {
+    return uses->capacity > KEFIR_OPT_INSTRUCTION_USES_INLINE_CAPACITY ? uses->refs : uses->inline_refs;
+}
+
+static kefir_uint32_t instruction_uses_lower_bound(struct kefir_opt_instruction_uses *uses,
+                                                   kefir_opt_instruction_ref_t ref) {
+    const kefir_opt_instruction_ref_t *content = instruction_uses_content(uses);
+    kefir_uint32_t begin = 0, end = uses->length;
+    while (begin < end) {
+        const kefir_uint32_t middle = begin + (end - begin) / 2;
+        if (content[middle] < ref) {
+            begin = middle + 1;
+        } else {
+            end = middle;
+        }
+    }
+    return begin;
+}
+
+static kefir_result_t instruction_uses_add(struct kefir_mem *mem, struct kefir_opt_instruction_uses *uses,
+                                           kefir_opt_instruction_ref_t ref) {
+    const kefir_uint32_t index = instruction_uses_lower_bound(uses, ref);
+    kefir_opt_instruction_ref_t *content = instruction_uses_content(uses);
+    if (index < uses->length && content[index] == ref) {
+        return KEFIR_OK;
+    }
+
+    if (uses->length == uses->capacity) {
+        const kefir_uint32_t new_capacity = uses->capacity * 2;
+        kefir_opt_instruction_ref_t *new_content =
+            KEFIR_MALLOC(mem, sizeof(kefir_opt_instruction_ref_t) * new_capacity);
+        REQUIRE(new_content != NULL,
+                KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate optimizer instruction use list"));
+        memcpy(new_content, content, sizeof(kefir_opt_instruction_ref_t) * uses->length);
+        if (uses->capacity > KEFIR_OPT_INSTRUCTION_USES_INLINE_CAPACITY) {
+            KEFIR_FREE(mem, uses->refs);
+        }
+        uses->refs = new_content;
+        uses->capacity = new_capacity;
+        content = new_content;
+    }
+
+    memmove(&content[index + 1], &content[index], sizeof(kefir_opt_instruction_ref_t) * (uses->length - index));
+    content[index] = ref;
+    uses->length++;
+    return KEFIR_OK;
+}
+
+static kefir_result_t instruction_uses_delete(struct kefir_opt_instruction_uses *uses,
+                                              kefir_opt_instruction_ref_t ref) {
+    const kefir_uint32_t index = instruction_uses_lower_bound(uses, ref);
+    kefir_opt_instruction_ref_t *content = instruction_uses_content(uses);
+    if (index < uses->length && content[index] == ref) {
+        memmove(&content[index], &content[index + 1],
+                sizeof(kefir_opt_instruction_ref_t) * (uses->length - index - 1));
+        uses->length--;
+    }
+    return KEFIR_OK;
+}
+
 static kefir_result_t free_call_node(struct kefir_mem *mem, struct kefir_hashtree *tree, kefir_hashtree_key_t key,
                                      kefir_hashtree_value_t value, void *payload) {
     UNUSED(tree);
@@ -501,6 +576,21 @@ static kefir_result_t free_inline_assembly(struct kefir_mem *mem, struct kefir_h
     return KEFIR_OK;
 }
 
+static kefir_result_t free_switch_table(struct kefir_mem *mem, struct kefir_hashtree *tree, kefir_hashtree_key_t key,
+                                        kefir_hashtree_value_t value, void *payload) {
+    UNUSED(tree);
+    UNUSED(key);
+    UNUSED(payload);
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    ASSIGN_DECL_CAST(struct kefir_opt_switch_table *, switch_table, value);
+    REQUIRE(switch_table != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer switch table"));
+
+    KEFIR_FREE(mem, switch_table->targets);
+    memset(switch_table, 0, sizeof(struct kefir_opt_switch_table));
+    KEFIR_FREE(mem, switch_table);
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_opt_code_container_init(struct kefir_opt_code_container *code) {
     REQUIRE(code != NULL,
             KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer code container"));
@@ -516,13 +606,19 @@ kefir_result_t kefir_opt_code_container_init(struct kefir_opt_code_container *co
     code->phi_nodes_capacity = 0;
     code->next_call_node_id = 0;
     code->next_inline_assembly_id = 0;
+    code->next_switch_table_id = 0;
     code->entry_point = KEFIR_ID_NONE;
     code->gate_block = KEFIR_ID_NONE;
+    code->revision.code = 0;
+    code->revision.control_flow = 0;
+    code->revision.has_block_labels = false;
     code->event_listener = NULL;
     REQUIRE_OK(kefir_hashtree_init(&code->call_nodes, &kefir_hashtree_uint_ops));
     REQUIRE_OK(kefir_hashtree_on_removal(&code->call_nodes, free_call_node, NULL));
     REQUIRE_OK(kefir_hashtree_init(&code->inline_assembly, &kefir_hashtree_uint_ops));
     REQUIRE_OK(kefir_hashtree_on_removal(&code->inline_assembly, free_inline_assembly, NULL));
+    REQUIRE_OK(kefir_hashtree_init(&code->switch_tables, &kefir_hashtree_uint_ops));
+    REQUIRE_OK(kefir_hashtree_on_removal(&code->switch_tables, free_switch_table, NULL));
     return KEFIR_OK;
 }
 
@@ -534,7 +630,7 @@ kefir_result_t kefir_opt_code_container_free(struct kefir_mem *mem, struct kefir
         REQUIRE_OK(kefir_hashtree_free(mem, &code->phi_nodes[i].links));
     }
     for (kefir_size_t i = 0; i < code->length; i++) {
-        REQUIRE_OK(kefir_hashtreeset_free(mem, &code->code[i].uses.instruction));
+        REQUIRE_OK(instruction_uses_free(mem, &code->code[i].uses));
     }
     for (kefir_size_t i = 0; i < code->blocks_length; i++) {
         REQUIRE_OK(kefir_hashtreeset_free(mem, &code->blocks[i].public_labels));
@@ -542,6 +638,7 @@ kefir_result_t kefir_opt_code_container_free(struct kefir_mem *mem, struct kefir
     KEFIR_FREE(mem, code->blocks);
     REQUIRE_OK(kefir_hashtree_free(mem, &code->call_nodes));
     REQUIRE_OK(kefir_hashtree_free(mem, &code->inline_assembly));
+    REQUIRE_OK(kefir_hashtree_free(mem, &code->switch_tables));
     KEFIR_FREE(mem, code->phi_nodes);
     KEFIR_FREE(mem, code->code);
     memset(code, 0, sizeof(struct kefir_opt_code_container));
@@ -558,6 +655,14 @@ kefir_size_t kefir_opt_code_container_length(const struct kefir_opt_code_contain
     return code->length;
 }
 
+static void code_container_touch(const struct kefir_opt_code_container *code, kefir_bool_t control_flow) {
+    struct kefir_opt_code_container *mutable_code = (struct kefir_opt_code_container *) code;
+    mutable_code->revision.code++;
+    if (control_flow) {
+        mutable_code->revision.control_flow++;
+    }
+}
+
 kefir_result_t kefir_opt_code_container_new_block(struct kefir_mem *mem, struct kefir_opt_code_container *code,
                                                   kefir_bool_t entry_point, kefir_opt_block_id_t *block_id_ptr) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
@@ -595,6 +700,7 @@ kefir_result_t kefir_opt_code_container_new_block(struct kefir_mem *mem, struct
     if (entry_point) {
         code->entry_point = block->id;
     }
+    code_container_touch(code, true);
 
     *block_id_ptr = block->id;
     return KEFIR_OK;
@@ -678,21 +784,15 @@ static kefir_result_t drop_block_impl(struct kefir_mem *mem, struct kefir_opt_co
         struct kefir_opt_instruction *instr = NULL;
         REQUIRE_OK(code_container_instr_mutable(code, instr_ref, &instr));
         if (verify_uses) {
-            struct kefir_hashtreeset_iterator iter;
-            for (res = kefir_hashtreeset_iter(&instr->uses.instruction, &iter); res == KEFIR_OK;
-                 res = kefir_hashtreeset_next(&iter)) {
-                ASSIGN_DECL_CAST(kefir_opt_instruction_ref_t, use_instr_ref, iter.entry);
+            const kefir_opt_instruction_ref_t *uses = instruction_uses_content(&instr->uses);
+            for (kefir_uint32_t i = 0; i < instr->uses.length; i++) {
                 struct kefir_opt_instruction *use_instr = NULL;
-                REQUIRE_OK(code_container_instr_mutable(code, use_instr_ref, &use_instr));
+                REQUIRE_OK(code_container_instr_mutable(code, uses[i], &use_instr));
                 REQUIRE(use_instr->block_id != block_id,
                         KEFIR_SET_ERROR(KEFIR_INVALID_REQUEST, "References from outside the block exist"));
             }
-            if (res != KEFIR_ITERATOR_END) {
-                REQUIRE_OK(res);
-            }
         }
-        res = KEFIR_OK;
-        REQUIRE_OK(kefir_hashtreeset_clean(mem, &instr->uses.instruction));
+        REQUIRE_OK(instruction_uses_free(mem, &instr->uses));
 
         kefir_bool_t is_control_flow;
         REQUIRE_OK(kefir_opt_code_instruction_is_control_flow(code, instr_ref, &is_control_flow));
@@ -714,6 +814,7 @@ kefir_result_t kefir_opt_code_container_drop_block(struct kefir_mem *mem, struct
     REQUIRE(code != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code container"));
 
     REQUIRE_OK(drop_block_impl(mem, code, block_id, true));
+    code_container_touch(code, true);
     return KEFIR_OK;
 }
 
@@ -729,6 +830,7 @@ kefir_result_t kefir_opt_code_container_add_block_public_label(struct kefir_mem
     struct kefir_opt_code_block *block = NULL;
     REQUIRE_OK(code_container_block_mutable(code, block_id, &block));
     REQUIRE_OK(kefir_hashtreeset_add(mem, &block->public_labels, (kefir_hashtreeset_entry_t) alternative_label));
+    code_container_touch(code, true);
     return KEFIR_OK;
 }
 
@@ -791,8 +893,7 @@ static kefir_result_t update_uses_callback(kefir_opt_instruction_ref_t used_inst
 
     struct kefir_opt_instruction *used_instr = NULL;
     REQUIRE_OK(code_container_instr_mutable(param->code, used_instr_ref, &used_instr));
-    REQUIRE_OK(
-        kefir_hashtreeset_add(param->mem, &used_instr->uses.instruction, (kefir_hashtreeset_entry_t) param->user_ref));
+    REQUIRE_OK(instruction_uses_add(param->mem, &used_instr->uses, param->user_ref));
     return KEFIR_OK;
 }
 
@@ -828,7 +929,7 @@ kefir_result_t kefir_opt_code_container_new_instruction(struct kefir_mem *mem, s
     instr->control_flow.next = KEFIR_ID_NONE;
     instr->siblings.prev = block->content.tail;
     instr->siblings.next = KEFIR_ID_NONE;
-    REQUIRE_OK(kefir_hashtreeset_init(&instr->uses.instruction, &kefir_hashtree_uint_ops));
+    REQUIRE_OK(instruction_uses_init(&instr->uses));
 
     if (block->content.tail != KEFIR_ID_NONE) {
         struct kefir_opt_instruction *prev_instr = &code->code[block->content.tail];
@@ -842,6 +943,10 @@ kefir_result_t kefir_opt_code_container_new_instruction(struct kefir_mem *mem, s
 
     code->length++;
     *instr_id = instr->id;
+    if (operation->opcode == KEFIR_OPT_OPCODE_BLOCK_LABEL) {
+        code->revision.has_block_labels = true;
+    }
+    code_container_touch(code, operation->opcode == KEFIR_OPT_OPCODE_BLOCK_LABEL);
 
     REQUIRE_OK(update_used_instructions(mem, code, instr->id));
 
@@ -860,8 +965,7 @@ static kefir_result_t drop_uses_callback(kefir_opt_instruction_ref_t used_instr_
     kefir_result_t res = code_container_instr_mutable(param->code, used_instr_ref, &used_instr);
     if (res != KEFIR_NOT_FOUND) {
         REQUIRE_OK(res);
-        REQUIRE_OK(kefir_hashtreeset_delete(param->mem, &used_instr->uses.instruction,
-                                            (kefir_hashtreeset_entry_t) param->user_ref));
+        REQUIRE_OK(instruction_uses_delete(&used_instr->uses, param->user_ref));
     }
     return KEFIR_OK;
 }
@@ -896,7 +1000,7 @@ kefir_result_t drop_instr_impl(struct kefir_mem *mem, const struct kefir_opt_cod
     if (verify_uses) {
         struct kefir_opt_instruction *used_instr = NULL;
         REQUIRE_OK(code_container_instr_mutable(code, instr_id, &used_instr));
-        REQUIRE(kefir_hashtreeset_empty(&used_instr->uses.instruction),
+        REQUIRE(used_instr->uses.length == 0,
                 KEFIR_SET_ERROR(KEFIR_INVALID_REQUEST, "Instruction with active dependents cannot be dropped"));
     }
 
@@ -933,6 +1037,7 @@ kefir_result_t drop_instr_impl(struct kefir_mem *mem, const struct kefir_opt_cod
     instr->siblings.prev = KEFIR_ID_NONE;
     instr->siblings.next = KEFIR_ID_NONE;
     instr->block_id = KEFIR_ID_NONE;
+    code_container_touch(code, false);
 
     if (instr->operation.opcode == KEFIR_OPT_OPCODE_PHI) {
         REQUIRE_OK(kefir_opt_code_container_drop_phi(mem, code, instr->operation.parameters.phi_ref));
@@ -1090,6 +1195,25 @@ kefir_result_t kefir_opt_code_container_copy_instruction(struct kefir_mem *mem,
             }
         } break;
 
+        case KEFIR_OPT_OPCODE_SWITCH: {
+            const struct kefir_opt_switch_table *src_switch_table;
+            REQUIRE_OK(kefir_opt_code_container_switch_table(code, src_operation.parameters.branch.switch_table_ref,
+                                                             &src_switch_table));
+
+            kefir_opt_switch_table_id_t switch_table_ref;
+            REQUIRE_OK(
+                kefir_opt_code_container_new_switch_table(mem, code, src_switch_table->length, &switch_table_ref));
+            REQUIRE_OK(kefir_opt_code_container_switch_table(code, src_operation.parameters.branch.switch_table_ref,
+                                                             &src_switch_table));
+            for (kefir_size_t i = 0; i < src_switch_table->length; i++) {
+                REQUIRE_OK(kefir_opt_code_container_switch_table_set_target(code, switch_table_ref, i,
+                                                                            src_switch_table->targets[i]));
+            }
+
+            src_operation.parameters.branch.switch_table_ref = switch_table_ref;
+            REQUIRE_OK(kefir_opt_code_container_new_instruction(mem, code, block_id, &src_operation, instr_ref_ptr));
+        } break;
+
         default:
             REQUIRE_OK(kefir_opt_code_container_new_instruction(mem, code, block_id, &src_operation, instr_ref_ptr));
             break;
@@ -1163,6 +1287,7 @@ kefir_result_t kefir_opt_code_container_insert_control(const struct kefir_opt_co
             block->control_flow.tail = instr->id;
         }
     }
+    code_container_touch(code, true);
     return KEFIR_OK;
 }
 
@@ -1192,6 +1317,7 @@ static kefir_result_t control_flow_remove(const struct kefir_opt_code_container
 
     instr->control_flow.prev = KEFIR_ID_NONE;
     instr->control_flow.next = KEFIR_ID_NONE;
+    code_container_touch(code, true);
 
     return KEFIR_OK;
 }
@@ -1345,8 +1471,7 @@ static kefir_result_t kefir_opt_code_container_drop_phi(struct kefir_mem *mem,
         kefir_result_t res = code_container_instr_mutable(code, used_instr_ref, &used_instr);
         if (res != KEFIR_NOT_FOUND) {
             REQUIRE_OK(res);
-            REQUIRE_OK(kefir_hashtreeset_delete(mem, &used_instr->uses.instruction,
-                                                (kefir_hashtreeset_entry_t) phi_node->output_ref));
+            REQUIRE_OK(instruction_uses_delete(&used_instr->uses, phi_node->output_ref));
         }
     }
     return KEFIR_OK;
@@ -1425,8 +1550,7 @@ static kefir_result_t kefir_opt_code_container_drop_call(struct kefir_mem *mem,
         kefir_result_t res = code_container_instr_mutable(code, used_instr_ref, &used_instr);
         if (res != KEFIR_NOT_FOUND) {
             REQUIRE_OK(res);
-            REQUIRE_OK(kefir_hashtreeset_delete(mem, &used_instr->uses.instruction,
-                                                (kefir_hashtreeset_entry_t) call_node->output_ref));
+            REQUIRE_OK(instruction_uses_delete(&used_instr->uses, call_node->output_ref));
         }
     }
     if (call_node->return_space != KEFIR_ID_NONE) {
@@ -1434,8 +1558,7 @@ static kefir_result_t kefir_opt_code_container_drop_call(struct kefir_mem *mem,
         kefir_result_t res = code_container_instr_mutable(code, call_node->return_space, &used_instr);
         if (res != KEFIR_NOT_FOUND) {
             REQUIRE_OK(res);
-            REQUIRE_OK(kefir_hashtreeset_delete(mem, &used_instr->uses.instruction,
-                                                (kefir_hashtreeset_entry_t) call_node->output_ref));
+            REQUIRE_OK(instruction_uses_delete(&used_instr->uses, call_node->output_ref));
         }
     }
     return KEFIR_OK;
@@ -1516,8 +1639,7 @@ static kefir_result_t kefir_opt_code_container_drop_inline_asm(struct kefir_mem
                 code_container_instr_mutable(code, inline_asm_node->parameters[i].location_ref, &used_instr);
             if (res != KEFIR_NOT_FOUND) {
                 REQUIRE_OK(res);
-                REQUIRE_OK(kefir_hashtreeset_delete(mem, &used_instr->uses.instruction,
-                                                    (kefir_hashtreeset_entry_t) inline_asm_node->output_ref));
+                REQUIRE_OK(instruction_uses_delete(&used_instr->uses, inline_asm_node->output_ref));
             }
         }
         if (inline_asm_node->parameters[i].value_ref != KEFIR_ID_NONE) {
@@ -1526,8 +1648,7 @@ static kefir_result_t kefir_opt_code_container_drop_inline_asm(struct kefir_mem
                 code_container_instr_mutable(code, inline_asm_node->parameters[i].value_ref, &used_instr);
             if (res != KEFIR_NOT_FOUND) {
                 REQUIRE_OK(res);
-                REQUIRE_OK(kefir_hashtreeset_delete(mem, &used_instr->uses.instruction,
-                                                    (kefir_hashtreeset_entry_t) inline_asm_node->output_ref));
+                REQUIRE_OK(instruction_uses_delete(&used_instr->uses, inline_asm_node->output_ref));
             }
         }
     }
@@ -1539,7 +1660,7 @@ static kefir_result_t add_used_instructions(struct kefir_mem *mem, const struct
                                             kefir_opt_instruction_ref_t instr_ref) {
     struct kefir_opt_instruction *used_instr = NULL;
     REQUIRE_OK(code_container_instr_mutable(code, instr_ref, &used_instr));
-    REQUIRE_OK(kefir_hashtreeset_add(mem, &used_instr->uses.instruction, (kefir_hashtreeset_entry_t) use_instr_ref));
+    REQUIRE_OK(instruction_uses_add(mem, &used_instr->uses, use_instr_ref));
     return KEFIR_OK;
 }
 
@@ -1548,7 +1669,7 @@ static kefir_result_t remove_used_instructions(struct kefir_mem *mem, const stru
                                                kefir_opt_instruction_ref_t instr_ref) {
     struct kefir_opt_instruction *used_instr = NULL;
     REQUIRE_OK(code_container_instr_mutable(code, instr_ref, &used_instr));
-    REQUIRE_OK(kefir_hashtreeset_delete(mem, &used_instr->uses.instruction, (kefir_hashtreeset_entry_t) use_instr_ref));
+    REQUIRE_OK(instruction_uses_delete(&used_instr->uses, use_instr_ref));
     return KEFIR_OK;
 }
 
@@ -1578,6 +1699,7 @@ kefir_result_t kefir_opt_code_container_phi_attach(struct kefir_mem *mem, struct
     phi_node->number_of_links++;
 
     REQUIRE_OK(add_used_instructions(mem, code, phi_node->output_ref, instr_ref));
+    code_container_touch(code, false);
     return KEFIR_OK;
 }
 
@@ -1637,6 +1759,7 @@ kefir_result_t kefir_opt_code_container_phi_drop_link(struct kefir_mem *mem,
     ASSIGN_DECL_CAST(kefir_opt_instruction_ref_t, link_ref, node->value);
     REQUIRE_OK(kefir_hashtree_delete(mem, &phi_node->links, (kefir_hashtree_key_t) block_id));
     phi_node->number_of_links--;
+    code_container_touch(code, false);
 
     kefir_bool_t drop_use = true;
     struct kefir_hashtree_node_iterator iter;
@@ -1651,7 +1774,7 @@ kefir_result_t kefir_opt_code_container_phi_drop_link(struct kefir_mem *mem,
         struct kefir_opt_instruction *used_instr = NULL;
         REQUIRE_OK(code_container_instr_mutable(code, link_ref, &used_instr));
         REQUIRE_OK(
-            kefir_hashtreeset_delete(mem, &used_instr->uses.instruction, (kefir_hashtreeset_entry_t) phi_instr_ref));
+            instruction_uses_delete(&used_instr->uses, phi_instr_ref));
     }
     return KEFIR_OK;
 }
@@ -1798,6 +1921,7 @@ kefir_result_t kefir_opt_code_container_call_set_argument(struct kefir_mem *mem,
     call_node->arguments[argument_index] = argument_ref;
 
     REQUIRE_OK(add_used_instructions(mem, code, call_node->output_ref, argument_ref));
+    code_container_touch(code, false);
     return KEFIR_OK;
 }
 
@@ -1847,6 +1971,7 @@ kefir_result_t kefir_opt_code_container_call_set_return_space(struct kefir_mem *
     call_node->return_space = return_space_ref;
 
     REQUIRE_OK(add_used_instructions(mem, code, call_node->output_ref, return_space_ref));
+    code_container_touch(code, false);
     return KEFIR_OK;
 }
 
@@ -2046,6 +2171,7 @@ kefir_result_t kefir_opt_code_container_inline_assembly_set_parameter(
     inline_asm_node->parameters[param_index] = *param_ptr;
 
     REQUIRE_OK(inline_asm_update_used_instructions(mem, code, inline_asm_node->output_ref, param_ptr));
+    code_container_touch(code, false);
     return KEFIR_OK;
 }
 
@@ -2067,6 +2193,7 @@ kefir_result_t kefir_opt_code_container_inline_assembly_set_default_jump_target(
             KEFIR_SET_ERROR(KEFIR_INVALID_REQUEST, "Expected empty default jump target of optimizer inline assembly"));
 
     inline_asm_node->default_jump_target = target_block;
+    code_container_touch(code, true);
     return KEFIR_OK;
 }
 
@@ -2094,6 +2221,7 @@ kefir_result_t kefir_opt_code_container_inline_assembly_add_jump_target(
         res = KEFIR_SET_ERROR(KEFIR_ALREADY_EXISTS, "Optimizer inline assembly jump target already exists");
     }
     REQUIRE_OK(res);
+    code_container_touch(code, true);
     return KEFIR_OK;
 }
 
@@ -2126,6 +2254,86 @@ kefir_result_t kefir_opt_code_container_inline_assembly_jump_target(const struct
     return KEFIR_OK;
 }
 
+static kefir_result_t code_container_switch_table_mutable(const struct kefir_opt_code_container *code,
+                                                          kefir_opt_switch_table_id_t switch_table_ref,
+                                                          struct kefir_opt_switch_table **switch_table_ptr) {
+    REQUIRE(code != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code container"));
+    REQUIRE(switch_table_ptr != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer switch table"));
+
+    struct kefir_hashtree_node *node = NULL;
+    kefir_result_t res = kefir_hashtree_at(&code->switch_tables, (kefir_hashtree_key_t) switch_table_ref, &node);
+    if (res == KEFIR_NOT_FOUND) {
+        res = KEFIR_SET_ERROR(KEFIR_NOT_FOUND, "Cannot find requested optimizer switch table");
+    }
+    REQUIRE_OK(res);
+
+    *switch_table_ptr = (struct kefir_opt_switch_table *) node->value;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_code_container_new_switch_table(struct kefir_mem *mem, struct kefir_opt_code_container *code,
+                                                        kefir_size_t length,
+                                                        kefir_opt_switch_table_id_t *switch_table_ref_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(code != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code container"));
+    REQUIRE(length > 0, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected non-empty optimizer switch table"));
+    REQUIRE(switch_table_ref_ptr != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer switch table identifier"));
+
+    struct kefir_opt_switch_table *switch_table = KEFIR_MALLOC(mem, sizeof(struct kefir_opt_switch_table));
+    REQUIRE(switch_table != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate optimizer switch table"));
+
+    switch_table->node_id = code->next_switch_table_id;
+    switch_table->length = length;
+    switch_table->targets = KEFIR_MALLOC(mem, sizeof(kefir_opt_block_id_t) * length);
+    REQUIRE_ELSE(switch_table->targets != NULL, {
+        KEFIR_FREE(mem, switch_table);
+        return KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate optimizer switch table targets");
+    });
+    for (kefir_size_t i = 0; i < length; i++) {
+        switch_table->targets[i] = KEFIR_ID_NONE;
+    }
+
+    kefir_result_t res = kefir_hashtree_insert(mem, &code->switch_tables, (kefir_hashtree_key_t) switch_table->node_id,
+                                               (kefir_hashtree_value_t) switch_table);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(mem, switch_table->targets);
+        KEFIR_FREE(mem, switch_table);
+        return res;
+    });
+
+    *switch_table_ref_ptr = switch_table->node_id;
+    code->next_switch_table_id++;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_code_container_switch_table(const struct kefir_opt_code_container *code,
+                                                    kefir_opt_switch_table_id_t switch_table_ref,
+                                                    const struct kefir_opt_switch_table **switch_table_ptr) {
+    REQUIRE(code != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code container"));
+    REQUIRE(switch_table_ptr != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer switch table"));
+
+    struct kefir_opt_switch_table *switch_table = NULL;
+    REQUIRE_OK(code_container_switch_table_mutable(code, switch_table_ref, &switch_table));
+    *switch_table_ptr = switch_table;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_code_container_switch_table_set_target(const struct kefir_opt_code_container *code,
+                                                               kefir_opt_switch_table_id_t switch_table_ref,
+                                                               kefir_size_t index, kefir_opt_block_id_t block_id) {
+    REQUIRE(code != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code container"));
+
+    struct kefir_opt_switch_table *switch_table = NULL;
+    REQUIRE_OK(code_container_switch_table_mutable(code, switch_table_ref, &switch_table));
+    REQUIRE(index < switch_table->length,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Requested optimizer switch table index is out of bounds"));
+    switch_table->targets[index] = block_id;
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_opt_code_block_instr_head(const struct kefir_opt_code_container *code,
                                                kefir_opt_block_id_t block_id,
                                                kefir_opt_instruction_ref_t *instr_id_ptr) {
@@ -2529,18 +2737,12 @@ static kefir_result_t verify_dead_uses(struct kefir_opt_code_container *code,
                                        kefir_opt_instruction_ref_t instr_ref) {
     struct kefir_opt_instruction *used_instr = NULL;
     REQUIRE_OK(code_container_instr_mutable(code, instr_ref, &used_instr));
-    struct kefir_hashtreeset_iterator iter;
-    kefir_result_t res;
-    for (res = kefir_hashtreeset_iter(&used_instr->uses.instruction, &iter); res == KEFIR_OK;
-         res = kefir_hashtreeset_next(&iter)) {
-        ASSIGN_DECL_CAST(kefir_opt_instruction_ref_t, use_instr_ref, iter.entry);
+    const kefir_opt_instruction_ref_t *uses = instruction_uses_content(&used_instr->uses);
+    for (kefir_uint32_t i = 0; i < used_instr->uses.length; i++) {
         kefir_bool_t use_alive;
-        REQUIRE_OK(index->is_instruction_alive(use_instr_ref, &use_alive, index->payload));
+        REQUIRE_OK(index->is_instruction_alive(uses[i], &use_alive, index->payload));
         REQUIRE(!use_alive, KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Instruction with alive dependents cannot be dead"));
     }
-    if (res != KEFIR_ITERATOR_END) {
-        REQUIRE_OK(res);
-    }
 
     return KEFIR_OK;
 }
@@ -2707,9 +2909,10 @@ kefir_result_t kefir_opt_code_container_instruction_use_instr_iter(const struct
     struct kefir_opt_instruction *used_instr = NULL;
     REQUIRE_OK(code_container_instr_mutable(code, instr_ref, &used_instr));
 
-    kefir_result_t res = kefir_hashtreeset_iter(&used_instr->uses.instruction, &iter->iter);
-    REQUIRE_OK(res);
-    iter->use_instr_ref = (kefir_opt_instruction_ref_t) iter->iter.entry;
+    REQUIRE(used_instr->uses.length > 0, KEFIR_ITERATOR_END);
+    iter->code = code;
+    iter->instr_ref = instr_ref;
+    iter->use_instr_ref = instruction_uses_content(&used_instr->uses)[0];
     return KEFIR_OK;
 }
 
@@ -2717,9 +2920,12 @@ kefir_result_t kefir_opt_code_container_instruction_use_next(struct kefir_opt_in
     REQUIRE(iter != NULL,
             KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer instruction use iterator"));
 
-    kefir_result_t res = kefir_hashtreeset_next(&iter->iter);
-    REQUIRE_OK(res);
-    iter->use_instr_ref = (kefir_opt_instruction_ref_t) iter->iter.entry;
+    struct kefir_opt_instruction *used_instr = NULL;
+    REQUIRE_OK(code_container_instr_mutable(iter->code, iter->instr_ref, &used_instr));
+    // Use list might have been modified since the previous step, thus the position is re-established by value
+    const kefir_uint32_t index = instruction_uses_lower_bound(&used_instr->uses, iter->use_instr_ref + 1);
+    REQUIRE(index < used_instr->uses.length, KEFIR_ITERATOR_END);
+    iter->use_instr_ref = instruction_uses_content(&used_instr->uses)[index];
     return KEFIR_OK;
 }
 
@@ -2746,6 +2952,21 @@ kefir_result_t kefir_opt_code_container_instruction_replace_control_flow_target(
             }
             break;
 
+        case KEFIR_OPT_OPCODE_SWITCH: {
+            if (instr->operation.parameters.branch.target_block == current_target_block_id) {
+                instr->operation.parameters.branch.target_block = desired_target_block_id;
+            }
+
+            struct kefir_opt_switch_table *switch_table;
+            REQUIRE_OK(code_container_switch_table_mutable(code, instr->operation.parameters.branch.switch_table_ref,
+                                                           &switch_table));
+            for (kefir_size_t i = 0; i < switch_table->length; i++) {
+                if (switch_table->targets[i] == current_target_block_id) {
+                    switch_table->targets[i] = desired_target_block_id;
+                }
+            }
+        } break;
+
         case KEFIR_OPT_OPCODE_INLINE_ASSEMBLY: {
             struct kefir_opt_inline_assembly_node *inline_asm;
             REQUIRE_OK(
@@ -2778,6 +2999,7 @@ kefir_result_t kefir_opt_code_container_instruction_replace_control_flow_target(
             return KEFIR_SET_ERROR(KEFIR_INVALID_REQUEST,
                                    "Specified instruction does not have control flow references");
     }
+    code_container_touch(code, true);
 
     return KEFIR_OK;
 }
@@ -2799,6 +3021,12 @@ static kefir_result_t replace_references_branch(struct kefir_opt_instruction *in
     return KEFIR_OK;
 }
 
+static kefir_result_t replace_references_switch(struct kefir_opt_instruction *instr, kefir_opt_instruction_ref_t to_ref,
+                                                kefir_opt_instruction_ref_t from_ref) {
+    REPLACE_REF(&instr->operation.parameters.refs[0], to_ref, from_ref);
+    return KEFIR_OK;
+}
+
 static kefir_result_t replace_references_branch_compare(struct kefir_opt_instruction *instr,
                                                         kefir_opt_instruction_ref_t to_ref,
                                                         kefir_opt_instruction_ref_t from_ref) {
@@ -3128,6 +3356,7 @@ kefir_result_t kefir_opt_code_container_replace_references_in(struct kefir_mem *
 
     REQUIRE_OK(remove_used_instructions(mem, code, user_ref, from_ref));
     REQUIRE_OK(add_used_instructions(mem, code, user_ref, to_ref));
+    code_container_touch(code, false);
     return KEFIR_OK;
 }
 
@@ -3142,11 +3371,11 @@ kefir_result_t kefir_opt_code_container_replace_references(struct kefir_mem *mem
     REQUIRE_OK(code_container_instr_mutable(code, from_ref, &from_instr));
 
     kefir_result_t res;
-    struct kefir_hashtreeset_iterator user_iter;
-    for (res = kefir_hashtreeset_iter(&from_instr->uses.instruction, &user_iter); res == KEFIR_OK;) {
-        ASSIGN_DECL_CAST(kefir_opt_instruction_ref_t, user_ref, user_iter.entry);
-        res = kefir_hashtreeset_next(&user_iter);
-        REQUIRE_OK(kefir_opt_code_container_replace_references_in(mem, code, user_ref, to_ref, from_ref));
+    struct kefir_opt_instruction_use_iterator user_iter;
+    for (res = kefir_opt_code_container_instruction_use_instr_iter(code, from_ref, &user_iter); res == KEFIR_OK;
+         res = kefir_opt_code_container_instruction_use_next(&user_iter)) {
+        REQUIRE_OK(
+            kefir_opt_code_container_replace_references_in(mem, code, user_iter.use_instr_ref, to_ref, from_ref));
     }
     if (res != KEFIR_ITERATOR_END) {
         REQUIRE_OK(res);
@@ -167,6 +167,16 @@ static kefir_result_t extract_inputs_branch(const struct kefir_opt_code_containe
     return KEFIR_OK;
 }
 
+static kefir_result_t extract_inputs_switch(const struct kefir_opt_code_container *code,
+                                            const struct kefir_opt_instruction *instr, kefir_bool_t resolve_phi,
+                                            kefir_result_t (*callback)(kefir_opt_instruction_ref_t, void *),
+                                            void *payload) {
+    UNUSED(code);
+    UNUSED(resolve_phi);
+    INPUT_CALLBACK(instr->operation.parameters.refs[0], callback, payload);
+    return KEFIR_OK;
+}
+
 static kefir_result_t extract_inputs_branch_compare(const struct kefir_opt_code_container *code,
                                                     const struct kefir_opt_instruction *instr, kefir_bool_t resolve_phi,
                                                     kefir_result_t (*callback)(kefir_opt_instruction_ref_t, void *),
@@ -625,13 +635,16 @@ static kefir_result_t collect_instr_after_split(struct kefir_mem *mem, struct ke
 
 static kefir_result_t split_block_after_impl(struct kefir_mem *mem, struct kefir_opt_code_container *code,
                                              struct kefir_opt_code_debug_info *debug_info,
-                                             struct kefir_opt_code_control_flow *control_flow,
+                                             struct kefir_opt_code_analysis_cache *analysis,
                                              struct kefir_opt_code_sequencing *sequencing,
                                              kefir_opt_instruction_ref_t split_instr_ref,
                                              kefir_opt_block_id_t *split_block_id, struct kefir_queue *instr_queue) {
     const struct kefir_opt_instruction *split_instr, *instr;
     REQUIRE_OK(kefir_opt_code_container_instr(code, split_instr_ref, &split_instr));
 
+    struct kefir_opt_code_control_flow *control_flow;
+    REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, analysis, &control_flow));
+
     kefir_opt_block_id_t new_block_id;
     REQUIRE_OK(kefir_opt_code_container_new_block(mem, code, false, &new_block_id));
 
@@ -675,9 +688,6 @@ static kefir_result_t split_block_after_impl(struct kefir_mem *mem, struct kefir
     }
 
     REQUIRE_OK(kefir_opt_code_builder_finalize_jump(mem, code, block->id, new_block_id, NULL));
-    REQUIRE_OK(kefir_opt_code_control_flow_free(mem, control_flow));
-    REQUIRE_OK(kefir_opt_code_control_flow_init(control_flow));
-    REQUIRE_OK(kefir_opt_code_control_flow_build(mem, control_flow, code));
     REQUIRE_OK(kefir_opt_code_sequencing_drop_cache(mem, sequencing));
     *split_block_id = new_block_id;
     return KEFIR_OK;
@@ -685,22 +695,21 @@ static kefir_result_t split_block_after_impl(struct kefir_mem *mem, struct kefir
 
 kefir_result_t kefir_opt_code_split_block_after(struct kefir_mem *mem, struct kefir_opt_code_container *code,
                                                 struct kefir_opt_code_debug_info *debug_info,
-                                                struct kefir_opt_code_control_flow *control_flow,
+                                                struct kefir_opt_code_analysis_cache *analysis,
                                                 struct kefir_opt_code_sequencing *sequencing,
                                                 kefir_opt_instruction_ref_t split_instr_ref,
                                                 kefir_opt_block_id_t *split_block_id) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(code != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code"));
     REQUIRE(debug_info != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code debug info"));
-    REQUIRE(control_flow != NULL,
-            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code control flow"));
+    REQUIRE(analysis != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code analysis cache"));
     REQUIRE(sequencing != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code sequencing"));
     REQUIRE(split_block_id != NULL,
             KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer block identifier"));
 
     struct kefir_queue instr_queue;
     REQUIRE_OK(kefir_queue_init(&instr_queue));
-    kefir_result_t res = split_block_after_impl(mem, code, debug_info, control_flow, sequencing, split_instr_ref,
+    kefir_result_t res = split_block_after_impl(mem, code, debug_info, analysis, sequencing, split_instr_ref,
                                                 split_block_id, &instr_queue);
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_queue_free(mem, &instr_queue);
@@ -11,11 +11,13 @@ kefir_result_t kefir_optimizer_configuration_init(struct kefir_optimizer_configu
     REQUIRE_OK(kefir_optimizer_pipeline_init(&conf->pipeline));
     conf->max_inline_depth = KEFIR_SIZE_MAX;
     conf->max_inlines_per_function = KEFIR_SIZE_MAX;
+    conf->max_inline_cost = 0;
     conf->debug_info = true;
     conf->imprecise_decimal_bitint_conv = false;
     conf->decimal_encoding = KEFIR_DECIMAL_ENCODING_BID;
     conf->target_lowering = NULL;
     conf->target_platform = target_platform;
+    conf->time_report = NULL;
     return KEFIR_OK;
 }
 
@@ -52,6 +54,7 @@ kefir_result_t kefir_optimizer_configuration_copy_from(struct kefir_mem *mem,
     dst_conf->debug_info = src_conf->debug_info;
     dst_conf->max_inline_depth = src_conf->max_inline_depth;
     dst_conf->max_inlines_per_function = src_conf->max_inlines_per_function;
+    dst_conf->max_inline_cost = src_conf->max_inline_cost;
     dst_conf->decimal_encoding = src_conf->decimal_encoding;
     dst_conf->imprecise_decimal_bitint_conv = src_conf->imprecise_decimal_bitint_conv;
     dst_conf->target_lowering = src_conf->target_lowering;
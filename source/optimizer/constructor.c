@@ -56,6 +56,20 @@ static kefir_result_t identify_code_blocks(struct kefir_mem *mem, const struct k
                 start_new_block = true;
                 break;
 
+            case KEFIR_IR_OPCODE_SWITCH: {
+                REQUIRE_OK(kefir_opt_constructor_start_code_block_at(mem, state, instr->arg.u64_2[0]));
+                const kefir_size_t num_of_targets = instr->arg.u64_2[1];
+                for (kefir_size_t j = 0; j < num_of_targets; j++) {
+                    const struct kefir_irinstr *target_instr =
+                        kefir_irblock_at(&state->function->ir_func->body, i + j + 1);
+                    REQUIRE(target_instr != NULL && target_instr->opcode == KEFIR_IR_OPCODE_SWITCH_TARGET,
+                            KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected IR switch to be followed by its targets"));
+                    REQUIRE_OK(kefir_opt_constructor_start_code_block_at(mem, state, target_instr->arg.u64));
+                }
+                i += num_of_targets;
+                start_new_block = true;
+            } break;
+
             case KEFIR_IR_OPCODE_INLINE_ASSEMBLY: {
                 const struct kefir_ir_inline_assembly *inline_asm =
                     kefir_ir_module_get_inline_assembly(module->ir_module, instr->arg.i64);
@@ -410,6 +424,32 @@ static kefir_result_t translate_instruction(struct kefir_mem *mem, const struct
             REQUIRE_OK(kefir_opt_code_builder_finalize_indirect_jump(mem, code, current_block_id, instr_ref, NULL));
             break;
 
+        case KEFIR_IR_OPCODE_SWITCH: {
+            struct kefir_opt_constructor_code_block_state *target_block = NULL;
+            const kefir_size_t num_of_targets = instr->arg.u64_2[1];
+            kefir_opt_switch_table_id_t switch_table_ref;
+            REQUIRE_OK(kefir_opt_code_container_new_switch_table(mem, code, num_of_targets, &switch_table_ref));
+            for (kefir_size_t i = 0; i < num_of_targets; i++) {
+                const struct kefir_irinstr *target_instr =
+                    kefir_irblock_at(&state->function->ir_func->body, state->ir_location + i + 1);
+                REQUIRE(target_instr != NULL && target_instr->opcode == KEFIR_IR_OPCODE_SWITCH_TARGET,
+                        KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected IR switch to be followed by its targets"));
+                REQUIRE_OK(kefir_opt_constructor_find_code_block_for(state, target_instr->arg.u64, &target_block));
+                REQUIRE_OK(kefir_opt_code_container_switch_table_set_target(code, switch_table_ref, i,
+                                                                            target_block->block_id));
+            }
+
+            REQUIRE_OK(kefir_opt_constructor_stack_pop(mem, state, &instr_ref));
+            REQUIRE_OK(kefir_opt_constructor_find_code_block_for(state, instr->arg.u64_2[0], &target_block));
+            REQUIRE_OK(kefir_opt_code_builder_finalize_switch(mem, code, current_block_id, instr_ref,
+                                                              target_block->block_id, switch_table_ref, NULL));
+            // Switch targets are consumed together with the switch itself
+            state->ir_location += num_of_targets;
+        } break;
+
+        case KEFIR_IR_OPCODE_SWITCH_TARGET:
+            return KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Unexpected IR switch target outside of switch");
+
         case KEFIR_IR_OPCODE_RETURN:
             instr_ref = KEFIR_ID_NONE;
             if (kefir_ir_type_length(state->function->ir_func->declaration->result) > 0) {
@@ -1336,11 +1376,13 @@ static kefir_result_t translate_instruction(struct kefir_mem *mem, const struct
     case _opcode: {                                                                                               \
         REQUIRE_OK(kefir_opt_constructor_stack_pop(mem, state, &instr_ref2));                                     \
         kefir_bool_t volatile_access = (instr->arg.u64 & KEFIR_IR_MEMORY_FLAG_VOLATILE) != 0;                     \
-        REQUIRE_OK(                                                                                               \
-            kefir_opt_code_builder_##_id(mem, code, current_block_id, instr_ref2,                                 \
-                                         &(const struct kefir_opt_memory_access_flags) {                          \
-                                             .load_extension = (_extension), .volatile_access = volatile_access}, \
-                                         &instr_ref));                                                            \
+        REQUIRE_OK(kefir_opt_code_builder_##_id(                                                                  \
+            mem, code, current_block_id, instr_ref2,                                                              \
+            &(const struct kefir_opt_memory_access_flags) {                                                       \
+                .load_extension = (_extension),                                                                   \
+                .volatile_access = volatile_access,                                                               \
+                .alias_tag = KEFIR_IR_MEMORY_FLAGS_ALIAS_TAG(instr->arg.u64)},                                    \
+            &instr_ref));                                                                                         \
         REQUIRE_OK(kefir_opt_code_builder_add_control(code, current_block_id, instr_ref));                        \
         REQUIRE_OK(kefir_opt_constructor_stack_push(mem, state, instr_ref));                                      \
     } break;
@@ -1489,7 +1531,9 @@ static kefir_result_t translate_instruction(struct kefir_mem *mem, const struct
         REQUIRE_OK(kefir_opt_code_builder_##_id(                                                             \
             mem, code, current_block_id, instr_ref2, instr_ref3,                                             \
             &(const struct kefir_opt_memory_access_flags) {.load_extension = KEFIR_OPT_MEMORY_LOAD_NOEXTEND, \
-                                                           .volatile_access = volatile_access},              \
+                                                           .volatile_access = volatile_access,               \
+                                                           .alias_tag = KEFIR_IR_MEMORY_FLAGS_ALIAS_TAG(     \
+                                                               instr->arg.u64)},                             \
             &instr_ref));                                                                                    \
         REQUIRE_OK(kefir_opt_code_builder_add_control(code, current_block_id, instr_ref));                   \
     } break;
@@ -1530,7 +1574,11 @@ static kefir_result_t translate_instruction(struct kefir_mem *mem, const struct
 #undef OVERFLOW_ARITH
 
         case KEFIR_IR_OPCODE_GET_ARGUMENT:
-            REQUIRE_OK(kefir_opt_code_builder_get_argument(mem, code, current_block_id, instr->arg.u64, &instr_ref));
+            REQUIRE_OK(kefir_opt_code_builder_get_argument(
+                mem, code, current_block_id, instr->arg.u64,
+                kefir_hashtreeset_has(&state->function->ir_func->restrict_parameters,
+                                      (kefir_hashtreeset_entry_t) instr->arg.u64),
+                &instr_ref));
             REQUIRE_OK(kefir_opt_constructor_stack_push(mem, state, instr_ref));
             break;
 
@@ -1629,6 +1677,17 @@ static kefir_result_t link_blocks_match(struct kefir_mem *mem, struct kefir_opt_
             REQUIRE_OK(link_blocks_impl(mem, state, block->id, instr->operation.parameters.branch.alternative_block));
             break;
 
+        case KEFIR_OPT_OPCODE_SWITCH: {
+            REQUIRE_OK(link_blocks_impl(mem, state, block->id, instr->operation.parameters.branch.target_block));
+
+            const struct kefir_opt_switch_table *switch_table;
+            REQUIRE_OK(kefir_opt_code_container_switch_table(
+                &state->function->code, instr->operation.parameters.branch.switch_table_ref, &switch_table));
+            for (kefir_size_t i = 0; i < switch_table->length; i++) {
+                REQUIRE_OK(link_blocks_impl(mem, state, block->id, switch_table->targets[i]));
+            }
+        } break;
+
         case KEFIR_OPT_OPCODE_IJUMP: {
             kefir_result_t res;
             struct kefir_hashtreeset_iterator iter;
@@ -1724,6 +1783,23 @@ static kefir_result_t link_blocks_traverse(struct kefir_mem *mem, struct kefir_o
             REQUIRE_OK(link_blocks_traverse(mem, state, alternative_block));
         } break;
 
+        case KEFIR_OPT_OPCODE_SWITCH: {
+            const struct kefir_opt_switch_table *switch_table;
+            REQUIRE_OK(kefir_opt_code_container_switch_table(
+                &state->function->code, instr->operation.parameters.branch.switch_table_ref, &switch_table));
+
+            REQUIRE_OK(
+                link_blocks_equalize_stack(mem, state, block_id, instr->operation.parameters.branch.target_block));
+            for (kefir_size_t i = 0; i < switch_table->length; i++) {
+                REQUIRE_OK(link_blocks_equalize_stack(mem, state, block_id, switch_table->targets[i]));
+            }
+
+            REQUIRE_OK(link_blocks_traverse(mem, state, instr->operation.parameters.branch.target_block));
+            for (kefir_size_t i = 0; i < switch_table->length; i++) {
+                REQUIRE_OK(link_blocks_traverse(mem, state, switch_table->targets[i]));
+            }
+        } break;
+
         case KEFIR_OPT_OPCODE_IJUMP:
         case KEFIR_OPT_OPCODE_RETURN:
         case KEFIR_OPT_OPCODE_UNREACHABLE:
@@ -377,6 +377,26 @@ static kefir_result_t format_operation_branch_compare(struct kefir_json_output *
     return KEFIR_OK;
 }
 
+static kefir_result_t format_operation_switch(struct kefir_json_output *json, const struct kefir_opt_module *module,
+                                              const struct kefir_opt_code_container *code,
+                                              const struct kefir_opt_operation *oper) {
+    UNUSED(module);
+    const struct kefir_opt_switch_table *switch_table;
+    REQUIRE_OK(kefir_opt_code_container_switch_table(code, oper->parameters.branch.switch_table_ref, &switch_table));
+
+    REQUIRE_OK(kefir_json_output_object_key(json, "index"));
+    REQUIRE_OK(id_format(json, oper->parameters.refs[0]));
+    REQUIRE_OK(kefir_json_output_object_key(json, "default_block"));
+    REQUIRE_OK(id_format(json, oper->parameters.branch.target_block));
+    REQUIRE_OK(kefir_json_output_object_key(json, "targets"));
+    REQUIRE_OK(kefir_json_output_array_begin(json));
+    for (kefir_size_t i = 0; i < switch_table->length; i++) {
+        REQUIRE_OK(id_format(json, switch_table->targets[i]));
+    }
+    REQUIRE_OK(kefir_json_output_array_end(json));
+    return KEFIR_OK;
+}
+
 static kefir_result_t format_operation_ref1(struct kefir_json_output *json, const struct kefir_opt_module *module,
                                             const struct kefir_opt_code_container *code,
                                             const struct kefir_opt_operation *oper) {
@@ -1266,9 +1286,11 @@ static kefir_result_t code_block_format(
 
         REQUIRE_OK(kefir_json_output_object_key(json, "alive_instructions"));
         REQUIRE_OK(kefir_json_output_array_begin(json));
-        for (res = kefir_hashset_iter(&liveness->blocks[block->id].alive_instr, &iter, &entry); res == KEFIR_OK;
-             res = kefir_hashset_next(&iter, &entry)) {
-            REQUIRE_OK(id_format(json, (kefir_id_t) entry));
+        struct kefir_opt_code_liveness_block_iterator liveness_iter;
+        kefir_opt_instruction_ref_t alive_instr_ref;
+        for (res = kefir_opt_code_liveness_block_iter(liveness, &liveness_iter, block->id, &alive_instr_ref);
+             res == KEFIR_OK; res = kefir_opt_code_liveness_block_next(&liveness_iter, &alive_instr_ref)) {
+            REQUIRE_OK(id_format(json, (kefir_id_t) alive_instr_ref));
         }
         if (res != KEFIR_ITERATOR_END) {
             REQUIRE_OK(res);
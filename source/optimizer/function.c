@@ -53,6 +53,7 @@ kefir_result_t kefir_opt_function_init(const struct kefir_opt_module *module, co
     func->num_of_inlines = 0;
     func->debug_info_mapping.ir_code_length = kefir_irblock_length(&ir_func->body);
     REQUIRE_OK(kefir_opt_code_container_init(&func->code));
+    REQUIRE_OK(kefir_opt_code_analysis_cache_init(&func->analysis, &func->code));
     REQUIRE_OK(kefir_opt_code_debug_info_init(&func->debug_info));
     REQUIRE_OK(kefir_hashtree_init(&func->inlines, &kefir_hashtree_uint_ops));
     REQUIRE_OK(kefir_hashtree_on_removal(&func->inlines, free_block_inline_entry, NULL));
@@ -66,6 +67,7 @@ kefir_result_t kefir_opt_function_free(struct kefir_mem *mem, struct kefir_opt_f
 
     REQUIRE_OK(kefir_hashtree_free(mem, &func->inlines));
     REQUIRE_OK(kefir_opt_code_debug_info_free(mem, &func->debug_info));
+    REQUIRE_OK(kefir_opt_code_analysis_cache_free(mem, &func->analysis));
     REQUIRE_OK(kefir_opt_code_container_free(mem, &func->code));
     func->ir_func = NULL;
     return KEFIR_OK;
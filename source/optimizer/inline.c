@@ -24,6 +24,7 @@
 #include "kefir/optimizer/trace.h"
 #include "kefir/core/error.h"
 #include "kefir/core/util.h"
+#include <string.h>
 
 struct do_inline_param {
     struct kefir_mem *mem;
@@ -271,6 +272,39 @@ static kefir_result_t inline_operation_branch_compare(struct do_inline_param *pa
     return KEFIR_OK;
 }
 
+static kefir_result_t inline_operation_switch(struct do_inline_param *param, const struct kefir_opt_instruction *instr,
+                                              kefir_opt_instruction_ref_t *mapped_instr_ref_ptr) {
+    kefir_opt_block_id_t mapped_block_id, mapped_target_block_id;
+    REQUIRE_OK(map_block(param, instr->block_id, &mapped_block_id));
+    REQUIRE_OK(map_block(param, instr->operation.parameters.branch.target_block, &mapped_target_block_id));
+
+    const struct kefir_opt_switch_table *src_switch_table;
+    REQUIRE_OK(kefir_opt_code_container_switch_table(
+        &param->src_function->code, instr->operation.parameters.branch.switch_table_ref, &src_switch_table));
+
+    kefir_opt_switch_table_id_t mapped_switch_table_ref;
+    REQUIRE_OK(kefir_opt_code_container_new_switch_table(param->mem, param->dst_code, src_switch_table->length,
+                                                         &mapped_switch_table_ref));
+    for (kefir_size_t i = 0; i < src_switch_table->length; i++) {
+        kefir_opt_block_id_t mapped_switch_target_block_id;
+        REQUIRE_OK(map_block(param, src_switch_table->targets[i], &mapped_switch_target_block_id));
+        REQUIRE_OK(kefir_opt_code_container_switch_table_set_target(param->dst_code, mapped_switch_table_ref, i,
+                                                                    mapped_switch_target_block_id));
+    }
+
+    kefir_opt_instruction_ref_t mapped_ref1;
+    REQUIRE_OK(get_instr_ref_mapping(param, instr->operation.parameters.refs[0], &mapped_ref1));
+    REQUIRE_OK(kefir_opt_code_container_new_instruction(
+        param->mem, param->dst_code, mapped_block_id,
+        &(struct kefir_opt_operation) {.opcode = instr->operation.opcode,
+                                       .parameters = {.refs = {mapped_ref1, KEFIR_ID_NONE, KEFIR_ID_NONE},
+                                                      .branch = {.target_block = mapped_target_block_id,
+                                                                 .alternative_block = KEFIR_ID_NONE,
+                                                                 .switch_table_ref = mapped_switch_table_ref}}},
+        mapped_instr_ref_ptr));
+    return KEFIR_OK;
+}
+
 static kefir_result_t inline_operation_call_ref(struct do_inline_param *param,
                                                 const struct kefir_opt_instruction *instr,
                                                 kefir_opt_instruction_ref_t *mapped_instr_ref_ptr) {
@@ -1302,7 +1336,265 @@ static kefir_result_t do_inline(struct kefir_mem *mem, const struct kefir_opt_mo
     return KEFIR_OK;
 }
 
-static kefir_result_t can_inline_function(const struct kefir_opt_function *callee_function,
+#define INLINE_COST_CONSTANT_ARGUMENT_BONUS 2
+#define INLINE_COST_MAX_LOOP_DEPTH 3
+#define INLINE_COST_SINGLE_CALL_SITE_FACTOR 4
+
+static kefir_result_t is_constant_call_argument(const struct kefir_opt_function *callee_function,
+                                                const struct kefir_opt_call_node *call_node, kefir_size_t index,
+                                                kefir_bool_t *constant_ptr) {
+    *constant_ptr = false;
+    REQUIRE(index < call_node->argument_count && call_node->arguments[index] != KEFIR_ID_NONE, KEFIR_OK);
+
+    const struct kefir_opt_instruction *argument;
+    REQUIRE_OK(kefir_opt_code_container_instr(&callee_function->code, call_node->arguments[index], &argument));
+    switch (argument->operation.opcode) {
+        case KEFIR_OPT_OPCODE_INT_CONST:
+        case KEFIR_OPT_OPCODE_UINT_CONST:
+        case KEFIR_OPT_OPCODE_FLOAT32_CONST:
+        case KEFIR_OPT_OPCODE_FLOAT64_CONST:
+            *constant_ptr = true;
+            break;
+
+        default:
+            // Intentionally left blank
+            break;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t estimate_inline_cost(const struct kefir_opt_module *module,
+                                           const struct kefir_opt_function *callee_function,
+                                           const struct kefir_opt_function *called_function,
+                                           const struct kefir_opt_call_node *call_node, kefir_bool_t *inlinable_ptr,
+                                           kefir_size_t *cost_ptr) {
+    kefir_size_t cost = 0;
+    kefir_size_t bonus = 0;
+    kefir_bool_t inlinable = true;
+    kefir_size_t called_func_blocks = kefir_opt_code_container_block_count(&called_function->code);
+    for (kefir_opt_block_id_t block_id = 0; inlinable && block_id < called_func_blocks; block_id++) {
+        kefir_opt_instruction_ref_t instr_ref;
+        kefir_result_t res;
+        for (res = kefir_opt_code_block_instr_head(&called_function->code, block_id, &instr_ref);
+             res == KEFIR_OK && instr_ref != KEFIR_ID_NONE && inlinable;
+             res = kefir_opt_instruction_next_sibling(&called_function->code, instr_ref, &instr_ref)) {
+            const struct kefir_opt_instruction *instruction;
+            REQUIRE_OK(kefir_opt_code_container_instr(&called_function->code, instr_ref, &instruction));
+            switch (instruction->operation.opcode) {
+                case KEFIR_OPT_OPCODE_GET_ARGUMENT: {
+                    kefir_bool_t constant_argument;
+                    REQUIRE_OK(is_constant_call_argument(callee_function, call_node,
+                                                         instruction->operation.parameters.index, &constant_argument));
+                    if (constant_argument) {
+                        struct kefir_opt_instruction_use_iterator use_iter;
+                        kefir_result_t use_res = kefir_opt_code_container_instruction_use_instr_iter(
+                            &called_function->code, instr_ref, &use_iter);
+                        for (; use_res == KEFIR_OK;
+                             use_res = kefir_opt_code_container_instruction_use_next(&use_iter)) {
+                            bonus += INLINE_COST_CONSTANT_ARGUMENT_BONUS;
+                        }
+                        if (use_res != KEFIR_ITERATOR_END) {
+                            REQUIRE_OK(use_res);
+                        }
+                    }
+                } break;
+
+                case KEFIR_OPT_OPCODE_STACK_ALLOC:
+                case KEFIR_OPT_OPCODE_SCOPE_PUSH:
+                    inlinable = false;
+                    break;
+
+                case KEFIR_OPT_OPCODE_INVOKE: {
+                    const struct kefir_opt_call_node *nested_call_node;
+                    REQUIRE_OK(kefir_opt_code_container_call(&called_function->code,
+                                                             instruction->operation.parameters.function_call.call_ref,
+                                                             &nested_call_node));
+                    const struct kefir_ir_function_decl *nested_decl =
+                        kefir_ir_module_get_declaration(module->ir_module, nested_call_node->function_declaration_id);
+                    if (nested_decl == NULL || nested_decl->returns_twice) {
+                        inlinable = false;
+                    }
+                    cost++;
+                } break;
+
+                case KEFIR_OPT_OPCODE_INT_CONST:
+                case KEFIR_OPT_OPCODE_UINT_CONST:
+                case KEFIR_OPT_OPCODE_FLOAT32_CONST:
+                case KEFIR_OPT_OPCODE_FLOAT64_CONST:
+                case KEFIR_OPT_OPCODE_ALLOC_LOCAL:
+                case KEFIR_OPT_OPCODE_REF_LOCAL:
+                case KEFIR_OPT_OPCODE_LOCAL_LIFETIME_MARK:
+                case KEFIR_OPT_OPCODE_PHI:
+                case KEFIR_OPT_OPCODE_JUMP:
+                    // Instructions which are folded into their uses or disappear after inlining
+                    break;
+
+                default:
+                    cost++;
+                    break;
+            }
+        }
+        REQUIRE_OK(res);
+    }
+
+    *inlinable_ptr = inlinable;
+    *cost_ptr = cost > bonus ? cost - bonus : 0;
+    return KEFIR_OK;
+}
+
+static kefir_result_t call_node_function_name(const struct kefir_opt_module *module,
+                                              const struct kefir_opt_function *function, kefir_opt_call_id_t call_ref,
+                                              const char **name_ptr) {
+    *name_ptr = NULL;
+    const struct kefir_opt_call_node *call_node;
+    kefir_result_t res = kefir_opt_code_container_call(&function->code, call_ref, &call_node);
+    REQUIRE(res != KEFIR_NOT_FOUND, KEFIR_OK);
+    REQUIRE_OK(res);
+    REQUIRE(call_node->block_id != KEFIR_ID_NONE, KEFIR_OK);
+
+    const struct kefir_ir_function_decl *decl =
+        kefir_ir_module_get_declaration(module->ir_module, call_node->function_declaration_id);
+    if (decl != NULL) {
+        *name_ptr = decl->name;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t count_function_call_sites(const struct kefir_opt_module *module,
+                                                const struct kefir_opt_function *function, const char *called_name,
+                                                kefir_size_t limit, kefir_size_t *count_ptr) {
+    for (kefir_opt_call_id_t call_ref = 0; call_ref < function->code.next_call_node_id && *count_ptr <= limit;
+         call_ref++) {
+        const char *name;
+        REQUIRE_OK(call_node_function_name(module, function, call_ref, &name));
+        if (name != NULL && strcmp(name, called_name) == 0) {
+            (*count_ptr)++;
+        }
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_inline_collect_call_sites(struct kefir_mem *mem, const struct kefir_opt_module *module,
+                                                   const struct kefir_opt_function *excluded_function,
+                                                   struct kefir_hashtree *call_sites) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
+    REQUIRE(call_sites != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid hashtree"));
+
+    struct kefir_hashtable_iterator iter;
+    kefir_hashtable_key_t key;
+    kefir_hashtable_value_t value;
+    kefir_result_t res;
+    for (res = kefir_hashtable_iter(&module->functions, &iter, &key, &value); res == KEFIR_OK;
+         res = kefir_hashtable_next(&iter, &key, &value)) {
+        ASSIGN_DECL_CAST(const struct kefir_opt_function *, function, value);
+        if (function == excluded_function) {
+            continue;
+        }
+        for (kefir_opt_call_id_t call_ref = 0; call_ref < function->code.next_call_node_id; call_ref++) {
+            const char *name;
+            REQUIRE_OK(call_node_function_name(module, function, call_ref, &name));
+            if (name == NULL) {
+                continue;
+            }
+
+            struct kefir_hashtree_node *node;
+            kefir_result_t node_res = kefir_hashtree_at(call_sites, (kefir_hashtree_key_t) name, &node);
+            if (node_res == KEFIR_NOT_FOUND) {
+                REQUIRE_OK(kefir_hashtree_insert(mem, call_sites, (kefir_hashtree_key_t) name,
+                                                 (kefir_hashtree_value_t) 1));
+            } else {
+                REQUIRE_OK(node_res);
+                node->value++;
+            }
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t count_call_sites(const struct kefir_opt_module *module,
+                                       const struct kefir_opt_function *callee_function,
+                                       const struct kefir_opt_function *called_function,
+                                       const struct kefir_opt_try_inline_function_call_parameters *inline_params,
+                                       kefir_size_t limit, kefir_size_t *count_ptr) {
+    const char *called_name = called_function->ir_func->name;
+    kefir_size_t count = 0;
+    if (inline_params->external_call_sites != NULL) {
+        // Only the function being transformed changes during the pass, thus call sites in other functions are
+        // counted once by the caller
+        struct kefir_hashtree_node *node;
+        kefir_result_t res =
+            kefir_hashtree_at(inline_params->external_call_sites, (kefir_hashtree_key_t) called_name, &node);
+        if (res != KEFIR_NOT_FOUND) {
+            REQUIRE_OK(res);
+            count = (kefir_size_t) node->value;
+        }
+        REQUIRE_OK(count_function_call_sites(module, callee_function, called_name, limit, &count));
+        *count_ptr = count;
+        return KEFIR_OK;
+    }
+
+    struct kefir_hashtable_iterator iter;
+    kefir_hashtable_key_t key;
+    kefir_hashtable_value_t value;
+    kefir_result_t res;
+    for (res = kefir_hashtable_iter(&module->functions, &iter, &key, &value); res == KEFIR_OK && count <= limit;
+         res = kefir_hashtable_next(&iter, &key, &value)) {
+        ASSIGN_DECL_CAST(const struct kefir_opt_function *, function, value);
+        REQUIRE_OK(count_function_call_sites(module, function, called_name, limit, &count));
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+
+    *count_ptr = count;
+    return KEFIR_OK;
+}
+
+static kefir_result_t cost_model_allows_inline(
+    const struct kefir_opt_module *module, const struct kefir_opt_function *callee_function,
+    const struct kefir_opt_function *called_function, const struct kefir_opt_call_node *call_node,
+    const struct kefir_opt_try_inline_function_call_parameters *inline_params, kefir_bool_t *allow_ptr) {
+    *allow_ptr = false;
+    REQUIRE(inline_params != NULL && inline_params->max_inline_cost > 0, KEFIR_OK);
+    REQUIRE(!called_function->ir_func->flags.no_inline, KEFIR_OK);
+
+    // Only functions with internal linkage are considered: other definitions might be interposed at link time
+    const struct kefir_ir_identifier *ir_identifier;
+    kefir_result_t res =
+        kefir_ir_module_get_identifier(module->ir_module, called_function->ir_func->name, &ir_identifier);
+    REQUIRE(res != KEFIR_NOT_FOUND, KEFIR_OK);
+    REQUIRE_OK(res);
+    REQUIRE(ir_identifier->scope == KEFIR_IR_IDENTIFIER_SCOPE_LOCAL, KEFIR_OK);
+
+    kefir_bool_t inlinable;
+    kefir_size_t cost;
+    REQUIRE_OK(estimate_inline_cost(module, callee_function, called_function, call_node, &inlinable, &cost));
+    REQUIRE(inlinable, KEFIR_OK);
+
+    // Call sites nested in loops are assumed to be executed more frequently, thus larger budget is granted
+    const kefir_size_t frequency_factor = 1 + MIN(inline_params->call_site_loop_depth, INLINE_COST_MAX_LOOP_DEPTH);
+    if ((cost + frequency_factor - 1) / frequency_factor <= inline_params->max_inline_cost) {
+        *allow_ptr = true;
+        return KEFIR_OK;
+    }
+
+    // Inlining the only call site of a function with internal linkage does not increase the code size, as the
+    // original function gets eliminated afterwards
+    const kefir_size_t single_call_site_factor = frequency_factor * INLINE_COST_SINGLE_CALL_SITE_FACTOR;
+    if ((cost + single_call_site_factor - 1) / single_call_site_factor <= inline_params->max_inline_cost) {
+        kefir_size_t call_sites;
+        REQUIRE_OK(count_call_sites(module, callee_function, called_function, inline_params, 1, &call_sites));
+        *allow_ptr = call_sites == 1;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t can_inline_function(const struct kefir_opt_module *module,
+                                          const struct kefir_opt_function *callee_function,
                                           const struct kefir_opt_function *called_function,
                                           const struct kefir_opt_call_node *call_node,
                                           const struct kefir_opt_try_inline_function_call_parameters *inline_params,
@@ -1312,8 +1604,7 @@ static kefir_result_t can_inline_function(const struct kefir_opt_function *calle
         callee_function, call_node->block_id, called_function,
         (inline_params == NULL ? KEFIR_SIZE_MAX : inline_params->max_inline_depth), &can_inline));
 
-    if (!called_function->ir_func->flags.inline_function || called_function->ir_func->declaration->vararg ||
-        called_function->ir_func->declaration->returns_twice ||
+    if (called_function->ir_func->declaration->vararg || called_function->ir_func->declaration->returns_twice ||
         called_function->ir_func->declaration->id == callee_function->ir_func->declaration->id ||
         (inline_params == NULL || callee_function->num_of_inlines >= inline_params->max_inlines_per_function)) {
         can_inline = false;
@@ -1344,20 +1635,23 @@ static kefir_result_t can_inline_function(const struct kefir_opt_function *calle
         REQUIRE_OK(res);
     }
 
+    if (can_inline && !called_function->ir_func->flags.inline_function) {
+        REQUIRE_OK(cost_model_allows_inline(module, callee_function, called_function, call_node, inline_params,
+                                            &can_inline));
+    }
+
     *can_inline_ptr = can_inline;
     return KEFIR_OK;
 }
 
 kefir_result_t kefir_opt_try_inline_function_call(
     struct kefir_mem *mem, const struct kefir_opt_module *module, struct kefir_opt_function *func,
-    struct kefir_opt_code_control_flow *control_flow, struct kefir_opt_code_sequencing *sequencing,
+    struct kefir_opt_code_sequencing *sequencing,
     const struct kefir_opt_try_inline_function_call_parameters *inline_params, kefir_opt_instruction_ref_t instr_ref,
     kefir_bool_t *did_inline_ptr) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
-    REQUIRE(control_flow != NULL,
-            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code control flow"));
     REQUIRE(sequencing != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer code sequencing"));
 
     ASSIGN_PTR(did_inline_ptr, false);
@@ -1377,25 +1671,24 @@ kefir_result_t kefir_opt_try_inline_function_call(
     const struct kefir_ir_function *ir_func = kefir_ir_module_get_function(module->ir_module, ir_func_decl->name);
     REQUIRE(ir_func != NULL, KEFIR_OK);
 
+    // Callee might not have optimizer code at the moment when functions are constructed on demand
     struct kefir_opt_function *called_func;
-    REQUIRE_OK(kefir_opt_module_get_function(module, ir_func->declaration->id, &called_func));
+    kefir_result_t res = kefir_opt_module_get_function(module, ir_func->declaration->id, &called_func);
+    REQUIRE(res != KEFIR_NOT_FOUND, KEFIR_OK);
+    REQUIRE_OK(res);
 
     kefir_bool_t can_inline;
-    REQUIRE_OK(can_inline_function(func, called_func, call_node, inline_params, &can_inline));
+    REQUIRE_OK(can_inline_function(module, func, called_func, call_node, inline_params, &can_inline));
 
     if (can_inline) {
         kefir_opt_block_id_t block_id = instr->block_id;
         kefir_opt_block_id_t split_block_id;
-        REQUIRE_OK(kefir_opt_code_split_block_after(mem, &func->code, &func->debug_info, control_flow, sequencing,
+        REQUIRE_OK(kefir_opt_code_split_block_after(mem, &func->code, &func->debug_info, &func->analysis, sequencing,
                                                     instr_ref, &split_block_id));
         REQUIRE_OK(do_inline(mem, module, func, called_func, block_id, split_block_id, call_node->node_id,
                              call_node->output_ref));
         func->num_of_inlines++;
         ASSIGN_PTR(did_inline_ptr, true);
-
-        REQUIRE_OK(kefir_opt_code_control_flow_free(mem, control_flow));
-        REQUIRE_OK(kefir_opt_code_control_flow_init(control_flow));
-        REQUIRE_OK(kefir_opt_code_control_flow_build(mem, control_flow, &func->code));
     }
 
     return KEFIR_OK;
@@ -301,10 +301,10 @@ static kefir_result_t insert_missing_nodes(struct kefir_mem *mem, struct constru
     REQUIRE_OK(kefir_opt_code_block_instr_control_tail(state->code, frame->block_ref, &block_tail_ref));
 
     kefir_result_t res;
-    struct kefir_hashset_iterator iter;
-    kefir_hashset_key_t entry;
-    for (res = kefir_hashset_iter(&state->liveness->blocks[frame->block_ref].alive_instr, &iter, &entry);
-         res == KEFIR_OK; res = kefir_hashset_next(&iter, &entry)) {
+    struct kefir_opt_code_liveness_block_iterator iter;
+    kefir_opt_instruction_ref_t entry;
+    for (res = kefir_opt_code_liveness_block_iter(state->liveness, &iter, frame->block_ref, &entry); res == KEFIR_OK;
+         res = kefir_opt_code_liveness_block_next(&iter, &entry)) {
         if (entry != block_tail_ref && !state->processed_instr[entry]) {
             const struct kefir_opt_instruction *instr;
             REQUIRE_OK(kefir_opt_code_container_instr(state->code, (kefir_opt_instruction_ref_t) entry, &instr));
@@ -122,20 +122,58 @@ kefir_result_t kefir_opt_module_construct(struct kefir_mem *mem, const struct ke
     REQUIRE(target_platform != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR target platform"));
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer module"));
 
+    REQUIRE_OK(kefir_opt_module_construct_types(mem, target_platform, module));
+
     struct kefir_hashtree_node_iterator iter;
+    for (const struct kefir_ir_function *ir_func = kefir_ir_module_function_iter(module->ir_module, &iter);
+         ir_func != NULL; ir_func = kefir_ir_module_function_next(&iter)) {
+
+        REQUIRE_OK(add_func(mem, module, ir_func));
+    }
+    return KEFIR_OK;
+}
 
+kefir_result_t kefir_opt_module_construct_types(struct kefir_mem *mem,
+                                                const struct kefir_ir_target_platform *target_platform,
+                                                struct kefir_opt_module *module) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(target_platform != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR target platform"));
+    REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer module"));
+
+    struct kefir_hashtree_node_iterator iter;
     kefir_id_t ir_type_id;
     for (const struct kefir_ir_type *ir_type = kefir_ir_module_named_type_iter(module->ir_module, &iter, &ir_type_id);
          ir_type != NULL; ir_type = kefir_ir_module_named_type_next(&iter, &ir_type_id)) {
 
         REQUIRE_OK(add_type_descr(mem, module, target_platform, ir_type_id, ir_type));
     }
+    return KEFIR_OK;
+}
 
-    for (const struct kefir_ir_function *ir_func = kefir_ir_module_function_iter(module->ir_module, &iter);
-         ir_func != NULL; ir_func = kefir_ir_module_function_next(&iter)) {
+kefir_result_t kefir_opt_module_construct_function(struct kefir_mem *mem, struct kefir_opt_module *module,
+                                                   const struct kefir_ir_function *ir_func,
+                                                   struct kefir_opt_function **function_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer module"));
+    REQUIRE(ir_func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid IR function"));
 
-        REQUIRE_OK(add_func(mem, module, ir_func));
+    REQUIRE_OK(add_func(mem, module, ir_func));
+    if (function_ptr != NULL) {
+        REQUIRE_OK(kefir_opt_module_get_function(module, ir_func->declaration->id, function_ptr));
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_opt_module_drop_function(struct kefir_mem *mem, struct kefir_opt_module *module,
+                                              kefir_id_t identifier) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to optimizer module"));
+
+    kefir_result_t res = kefir_hashtable_delete(mem, &module->functions, (kefir_hashtable_key_t) identifier);
+    if (res == KEFIR_NOT_FOUND) {
+        res = KEFIR_SET_ERROR(KEFIR_NOT_FOUND, "Unable to find requested optimizer function");
     }
+    REQUIRE_OK(res);
     return KEFIR_OK;
 }
 
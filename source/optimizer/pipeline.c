@@ -117,7 +117,11 @@ kefir_result_t kefir_optimizer_pipeline_apply_function(struct kefir_mem *mem, st
 
         ASSIGN_DECL_CAST(struct kefir_optimizer_pass *, pass, iter->value);
 
+        struct kefir_time_report_span span;
+        REQUIRE_OK(kefir_time_report_begin(config->time_report, &span));
         REQUIRE_OK(pass->apply(mem, module, func, pass, config));
+        REQUIRE_OK(kefir_time_report_end(config->time_report, &span, KEFIR_TIME_REPORT_OPTIMIZER_PASS,
+                                         func->ir_func->name, pass->name));
     }
     return KEFIR_OK;
 }
@@ -62,20 +62,6 @@ static kefir_result_t is_block_predecessor(kefir_opt_block_id_t predecessor_bloc
     return KEFIR_OK;
 }
 
-static kefir_result_t dead_code_elimination_impl(struct kefir_mem *mem, struct kefir_opt_function *func,
-                                                 struct kefir_opt_code_control_flow *control_flow,
-                                                 struct kefir_opt_code_liveness *liveness) {
-    REQUIRE_OK(kefir_opt_code_control_flow_build(mem, control_flow, &func->code));
-    REQUIRE_OK(kefir_opt_code_liveness_build(mem, liveness, control_flow));
-    struct payload_param param = {.control_flow = control_flow, .liveness = liveness};
-    struct kefir_opt_code_container_dead_code_index index = {.is_block_alive = is_block_alive,
-                                                             .is_instruction_alive = is_instruction_alive,
-                                                             .is_block_predecessor = is_block_predecessor,
-                                                             .payload = &param};
-    REQUIRE_OK(kefir_opt_code_container_drop_dead_code(mem, &func->code, &index));
-    return KEFIR_OK;
-}
-
 static kefir_result_t dead_code_elimination_apply(struct kefir_mem *mem, struct kefir_opt_module *module,
                                                   struct kefir_opt_function *func,
                                                   const struct kefir_optimizer_pass *pass,
@@ -86,22 +72,14 @@ static kefir_result_t dead_code_elimination_apply(struct kefir_mem *mem, struct
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
 
-    struct kefir_opt_code_control_flow control_flow;
-    struct kefir_opt_code_liveness liveness;
-    REQUIRE_OK(kefir_opt_code_control_flow_init(&control_flow));
-    REQUIRE_OK(kefir_opt_code_liveness_init(&liveness));
-    kefir_result_t res = dead_code_elimination_impl(mem, func, &control_flow, &liveness);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_liveness_free(mem, &liveness);
-        kefir_opt_code_control_flow_free(mem, &control_flow);
-        return res;
-    });
-    res = kefir_opt_code_liveness_free(mem, &liveness);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_control_flow_free(mem, &control_flow);
-        return res;
-    });
-    REQUIRE_OK(kefir_opt_code_control_flow_free(mem, &control_flow));
+    struct payload_param param;
+    REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, &func->analysis, &param.control_flow));
+    REQUIRE_OK(kefir_opt_code_analysis_cache_liveness(mem, &func->analysis, &param.liveness));
+    struct kefir_opt_code_container_dead_code_index index = {.is_block_alive = is_block_alive,
+                                                             .is_instruction_alive = is_instruction_alive,
+                                                             .is_block_predecessor = is_block_predecessor,
+                                                             .payload = &param};
+    REQUIRE_OK(kefir_opt_code_container_drop_dead_code(mem, &func->code, &index));
     return KEFIR_OK;
 }
 
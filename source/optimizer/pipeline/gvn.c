@@ -29,7 +29,7 @@
 struct gvn_state {
     struct kefir_mem *mem;
     struct kefir_opt_function *func;
-    struct kefir_opt_code_control_flow control_flow;
+    struct kefir_opt_code_control_flow *control_flow;
     struct kefir_opt_code_sequencing sequencing;
     struct kefir_list queue;
     struct kefir_hashtreeset queued_instr;
@@ -847,11 +847,11 @@ static kefir_result_t try_replace_instr(struct gvn_state *state, kefir_opt_instr
     kefir_bool_t can_replace = false;
     if (replacement_instr->block_id == instr->block_id) {
         kefir_bool_t sequenced_before = false;
-        REQUIRE_OK(kefir_opt_code_is_sequenced_before(state->mem, &state->control_flow, &state->sequencing, instr_ref,
+        REQUIRE_OK(kefir_opt_code_is_sequenced_before(state->mem, state->control_flow, &state->sequencing, instr_ref,
                                                       replacement_ref, &sequenced_before));
         can_replace = !sequenced_before;
     } else if (!only_local) {
-        REQUIRE_OK(kefir_opt_code_control_flow_is_dominator(&state->control_flow, instr->block_id,
+        REQUIRE_OK(kefir_opt_code_control_flow_is_dominator(state->control_flow, instr->block_id,
                                                             replacement_instr->block_id, &can_replace));
     }
 
@@ -869,7 +869,7 @@ static kefir_result_t try_replace_instr(struct gvn_state *state, kefir_opt_instr
      (_control_flow)->blocks[(_block_id)].immediate_dominator != KEFIR_ID_NONE)
 
 static kefir_result_t gvn_impl(struct gvn_state *state) {
-    REQUIRE_OK(kefir_opt_code_control_flow_build(state->mem, &state->control_flow, &state->func->code));
+    REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(state->mem, &state->func->analysis, &state->control_flow));
     REQUIRE_OK(gvn_scan_control_flow(state));
 
     for (struct kefir_list_entry *iter = kefir_list_head(&state->queue); iter != NULL;
@@ -880,7 +880,7 @@ static kefir_result_t gvn_impl(struct gvn_state *state) {
 
         const struct kefir_opt_instruction *instr;
         REQUIRE_OK(kefir_opt_code_container_instr(&state->func->code, instr_ref, &instr));
-        if (!IS_BLOCK_REACHABLE(&state->control_flow, instr->block_id)) {
+        if (!IS_BLOCK_REACHABLE(state->control_flow, instr->block_id)) {
             continue;
         }
         enum gvn_replacement_policy replacement_policy = GVN_REPLACEMENT_SKIP;
@@ -940,17 +940,17 @@ static kefir_result_t gvn_impl(struct gvn_state *state) {
                         kefir_opt_code_container_instr(&state->func->code, candidate_instr_ref, &candidate_instr));
 
                     kefir_opt_block_id_t closest_common_dominator_block_id;
-                    REQUIRE_OK(kefir_opt_find_closest_common_dominator(&state->control_flow, instr->block_id,
+                    REQUIRE_OK(kefir_opt_find_closest_common_dominator(state->control_flow, instr->block_id,
                                                                        candidate_instr->block_id,
                                                                        &closest_common_dominator_block_id));
                     if (closest_common_dominator_block_id != KEFIR_ID_NONE &&
-                        closest_common_dominator_block_id == state->control_flow.code->gate_block) {
+                        closest_common_dominator_block_id == state->control_flow->code->gate_block) {
                         closest_common_dominator_block_id =
-                            state->control_flow.blocks[closest_common_dominator_block_id].immediate_dominator;
+                            state->control_flow->blocks[closest_common_dominator_block_id].immediate_dominator;
                     }
 
                     kefir_bool_t can_hoist;
-                    REQUIRE_OK(kefir_opt_can_hoist_instruction(&state->control_flow, instr_ref,
+                    REQUIRE_OK(kefir_opt_can_hoist_instruction(state->control_flow, instr_ref,
                                                                closest_common_dominator_block_id, &can_hoist));
 
                     if (can_hoist) {
@@ -1009,13 +1009,11 @@ static kefir_result_t global_value_numbering_apply(struct kefir_mem *mem, struct
     REQUIRE_OK(kefir_hashtreeset_init(&state.processed_instr, &kefir_hashtree_uint_ops));
     REQUIRE_OK(kefir_hashtree_init(&state.instr_hashes, &instr_ops));
     REQUIRE_OK(kefir_hashtree_on_removal(&state.instr_hashes, free_instr_refs, NULL));
-    REQUIRE_OK(kefir_opt_code_control_flow_init(&state.control_flow));
     REQUIRE_OK(kefir_opt_code_sequencing_init(&state.sequencing));
 
     kefir_result_t res = gvn_impl(&state);
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_opt_code_sequencing_free(mem, &state.sequencing);
-        kefir_opt_code_control_flow_free(mem, &state.control_flow);
         kefir_list_free(mem, &state.queue);
         kefir_hashtreeset_free(mem, &state.processed_instr);
         kefir_hashtreeset_free(mem, &state.queued_instr);
@@ -1023,15 +1021,6 @@ static kefir_result_t global_value_numbering_apply(struct kefir_mem *mem, struct
         return res;
     });
     res = kefir_opt_code_sequencing_free(mem, &state.sequencing);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_control_flow_free(mem, &state.control_flow);
-        kefir_list_free(mem, &state.queue);
-        kefir_hashtreeset_free(mem, &state.processed_instr);
-        kefir_hashtreeset_free(mem, &state.queued_instr);
-        kefir_hashtree_free(mem, &state.instr_hashes);
-        return res;
-    });
-    res = kefir_opt_code_control_flow_free(mem, &state.control_flow);
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_list_free(mem, &state.queue);
         kefir_hashtreeset_free(mem, &state.processed_instr);
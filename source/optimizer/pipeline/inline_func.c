@@ -24,18 +24,53 @@
 #include "kefir/optimizer/code_util.h"
 #include "kefir/optimizer/control_flow.h"
 #include "kefir/optimizer/inline.h"
+#include "kefir/optimizer/loop_nest.h"
 #include "kefir/core/queue.h"
 #include "kefir/core/error.h"
 #include "kefir/core/util.h"
 #include <string.h>
 
+static kefir_result_t call_site_loop_depth(struct kefir_mem *mem, struct kefir_opt_function *func,
+                                           struct kefir_opt_code_loop_collection *loops, kefir_bool_t *loops_built,
+                                           kefir_opt_block_id_t block_id, kefir_size_t *depth_ptr) {
+    if (!*loops_built) {
+        struct kefir_opt_code_control_flow *control_flow;
+        REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, &func->analysis, &control_flow));
+        REQUIRE_OK(kefir_opt_code_loop_collection_build(mem, loops, control_flow));
+        *loops_built = true;
+    }
+
+    kefir_size_t depth = 0;
+    const struct kefir_opt_code_loop *loop;
+    struct kefir_opt_code_loop_collection_iterator iter;
+    kefir_result_t res;
+    for (res = kefir_opt_code_loop_collection_iter(loops, &loop, &iter); res == KEFIR_OK;
+         res = kefir_opt_code_loop_collection_next(&loop, &iter)) {
+        if (kefir_hashtreeset_has(&loop->loop_blocks, (kefir_hashtreeset_entry_t) block_id)) {
+            depth++;
+        }
+    }
+    if (res != KEFIR_ITERATOR_END) {
+        REQUIRE_OK(res);
+    }
+    *depth_ptr = depth;
+    return KEFIR_OK;
+}
+
 static kefir_result_t inline_func_impl(struct kefir_mem *mem, const struct kefir_opt_module *module,
-                                       struct kefir_opt_function *func,
-                                       struct kefir_opt_code_control_flow *control_flow,
-                                       struct kefir_opt_code_sequencing *sequencing,
+                                       struct kefir_opt_function *func, struct kefir_opt_code_sequencing *sequencing,
+                                       struct kefir_opt_code_loop_collection *loops,
                                        const struct kefir_optimizer_configuration *config,
                                        kefir_bool_t *fixpoint_reached) {
-    for (kefir_opt_block_id_t block_id = 0; block_id < control_flow->num_of_blocks; block_id++) {
+    kefir_bool_t loops_built = false;
+    for (kefir_opt_block_id_t block_id = 0;; block_id++) {
+        // Control flow is requested anew for each block, as inlining invalidates it
+        struct kefir_opt_code_control_flow *control_flow;
+        REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, &func->analysis, &control_flow));
+        if (block_id >= control_flow->num_of_blocks) {
+            break;
+        }
+
         kefir_bool_t reachable;
         REQUIRE_OK(kefir_opt_code_control_flow_is_reachable_from_entry(control_flow, block_id, &reachable));
         if (!reachable) {
@@ -53,11 +88,17 @@ static kefir_result_t inline_func_impl(struct kefir_mem *mem, const struct kefir
             REQUIRE_OK(kefir_opt_code_container_instr(&func->code, instr_ref, &instr));
             kefir_bool_t inlined = false;
             if (instr->operation.opcode == KEFIR_OPT_OPCODE_INVOKE) {
+                kefir_size_t loop_depth = 0;
+                if (config->max_inline_cost > 0) {
+                    REQUIRE_OK(call_site_loop_depth(mem, func, loops, &loops_built, block_id, &loop_depth));
+                }
                 REQUIRE_OK(kefir_opt_try_inline_function_call(
-                    mem, module, func, control_flow, sequencing,
+                    mem, module, func, sequencing,
                     &(struct kefir_opt_try_inline_function_call_parameters) {
                         .max_inline_depth = config->max_inline_depth,
-                        .max_inlines_per_function = config->max_inlines_per_function},
+                        .max_inlines_per_function = config->max_inlines_per_function,
+                        .max_inline_cost = config->max_inline_cost,
+                        .call_site_loop_depth = loop_depth},
                     instr_ref, &inlined));
             }
             if (inlined) {
@@ -82,27 +123,23 @@ static kefir_result_t inline_func_apply(struct kefir_mem *mem, struct kefir_opt_
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
     REQUIRE(config != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer configuration"));
 
-    struct kefir_opt_code_control_flow control_flow;
     struct kefir_opt_code_sequencing sequencing;
-    REQUIRE_OK(kefir_opt_code_control_flow_init(&control_flow));
     REQUIRE_OK(kefir_opt_code_sequencing_init(&sequencing));
-    kefir_result_t res = kefir_opt_code_control_flow_build(mem, &control_flow, &func->code);
+    kefir_result_t res = KEFIR_OK;
     kefir_bool_t fixpoint_reached = false;
     while (!fixpoint_reached && res == KEFIR_OK) {
         fixpoint_reached = true;
-        REQUIRE_CHAIN(&res, inline_func_impl(mem, module, func, &control_flow, &sequencing, config, &fixpoint_reached));
+        struct kefir_opt_code_loop_collection loops;
+        res = kefir_opt_code_loop_collection_init(&loops);
+        REQUIRE_CHAIN(&res, inline_func_impl(mem, module, func, &sequencing, &loops, config, &fixpoint_reached));
+        kefir_result_t free_res = kefir_opt_code_loop_collection_free(mem, &loops);
+        REQUIRE_CHAIN(&res, free_res);
     }
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_opt_code_sequencing_free(mem, &sequencing);
-        kefir_opt_code_control_flow_free(mem, &control_flow);
-        return res;
-    });
-    res = kefir_opt_code_sequencing_free(mem, &sequencing);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_control_flow_free(mem, &control_flow);
         return res;
     });
-    REQUIRE_OK(kefir_opt_code_control_flow_free(mem, &control_flow));
+    REQUIRE_OK(kefir_opt_code_sequencing_free(mem, &sequencing));
     return KEFIR_OK;
 }
 
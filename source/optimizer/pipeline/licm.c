@@ -456,6 +456,9 @@ static kefir_result_t hoist_memory_operation(struct licm_state *state, kefir_opt
         kefir_bool_t may_alias;
         REQUIRE_OK(kefir_opt_code_may_alias(&state->func->code, &state->escapes, state->module->ir_module,
                                             location1_ref, size1, offset1, location2_ref, size2, offset2, &may_alias));
+        if (may_alias) {
+            REQUIRE_OK(kefir_opt_code_may_alias_by_type(instr, other_instr, &may_alias));
+        }
         if (may_alias) {
             return KEFIR_OK;
         }
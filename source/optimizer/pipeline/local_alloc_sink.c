@@ -107,18 +107,11 @@ static kefir_result_t local_alloc_sink_apply(struct kefir_mem *mem, struct kefir
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
 
-    struct kefir_opt_code_control_flow control_flow;
-    struct trace_instruction_payload payload = {.mem = mem, .func = func, .control_flow = &control_flow};
+    struct trace_instruction_payload payload = {.mem = mem, .func = func};
     struct kefir_opt_code_container_tracer tracer = {.trace_instruction = trace_instruction_impl, .payload = &payload};
-    REQUIRE_OK(kefir_opt_code_control_flow_init(&control_flow));
-    kefir_result_t res = kefir_opt_code_control_flow_build(mem, &control_flow, &func->code);
-    REQUIRE_CHAIN(&res, kefir_opt_code_container_trace(mem, &func->code, &tracer));
-    REQUIRE_CHAIN(&res, kefir_opt_code_container_trace(mem, &func->code, &tracer));
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_control_flow_free(mem, &control_flow);
-        return res;
-    });
-    REQUIRE_OK(kefir_opt_code_control_flow_free(mem, &control_flow));
+    REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, &func->analysis, &payload.control_flow));
+    REQUIRE_OK(kefir_opt_code_container_trace(mem, &func->code, &tracer));
+    REQUIRE_OK(kefir_opt_code_container_trace(mem, &func->code, &tracer));
     return KEFIR_OK;
 }
 
@@ -31,16 +31,16 @@
 struct licm_state {
     struct kefir_mem *mem;
     struct kefir_opt_function *func;
-    struct kefir_opt_code_control_flow control_flow;
+    struct kefir_opt_code_control_flow *control_flow;
     struct kefir_opt_code_loop_collection loops;
 
     const struct kefir_opt_code_loop *loop;
 };
 
 static kefir_result_t process_loop(struct licm_state *state) {
-    REQUIRE(state->loop->loop_entry_block_id != state->control_flow.code->entry_point &&
-                state->loop->loop_entry_block_id != state->control_flow.code->gate_block &&
-                !kefir_hashset_has(&state->control_flow.indirect_jump_target_blocks,
+    REQUIRE(state->loop->loop_entry_block_id != state->control_flow->code->entry_point &&
+                state->loop->loop_entry_block_id != state->control_flow->code->gate_block &&
+                !kefir_hashset_has(&state->control_flow->indirect_jump_target_blocks,
                                    (kefir_hashset_key_t) state->loop->loop_entry_block_id),
             KEFIR_OK);
 
@@ -72,7 +72,7 @@ static kefir_result_t process_loop(struct licm_state *state) {
 
         struct kefir_hashset_iterator block_iter;
         kefir_hashset_key_t key;
-        for (res = kefir_hashset_iter(&state->control_flow.blocks[block_id].successors, &block_iter, &key);
+        for (res = kefir_hashset_iter(&state->control_flow->blocks[block_id].successors, &block_iter, &key);
              res == KEFIR_OK; res = kefir_hashset_next(&block_iter, &key)) {
             kefir_bool_t in_loop = kefir_hashtreeset_has(&state->loop->loop_blocks, (kefir_hashtreeset_entry_t) key);
             if (block_id == state->loop->loop_entry_block_id && exit_block_ref == KEFIR_ID_NONE && !in_loop) {
@@ -86,7 +86,7 @@ static kefir_result_t process_loop(struct licm_state *state) {
         }
 
         if (block_id != state->loop->loop_entry_block_id) {
-            for (res = kefir_hashset_iter(&state->control_flow.blocks[block_id].predecessors, &block_iter, &key);
+            for (res = kefir_hashset_iter(&state->control_flow->blocks[block_id].predecessors, &block_iter, &key);
                  res == KEFIR_OK; res = kefir_hashset_next(&block_iter, &key)) {
                 REQUIRE(kefir_hashtreeset_has(&state->loop->loop_blocks, (kefir_hashtreeset_entry_t) key), KEFIR_OK);
             }
@@ -158,8 +158,8 @@ static kefir_result_t process_nest(struct licm_state *state, const struct kefir_
 }
 
 static kefir_result_t loop_removal_impl(struct licm_state *state) {
-    REQUIRE_OK(kefir_opt_code_control_flow_build(state->mem, &state->control_flow, &state->func->code));
-    REQUIRE_OK(kefir_opt_code_loop_collection_build(state->mem, &state->loops, &state->control_flow));
+    REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(state->mem, &state->func->analysis, &state->control_flow));
+    REQUIRE_OK(kefir_opt_code_loop_collection_build(state->mem, &state->loops, state->control_flow));
 
     kefir_result_t res;
     const struct kefir_opt_loop_nest *nest;
@@ -185,21 +185,14 @@ static kefir_result_t loop_removal_apply(struct kefir_mem *mem, struct kefir_opt
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
 
     struct licm_state state = {.mem = mem, .func = func};
-    REQUIRE_OK(kefir_opt_code_control_flow_init(&state.control_flow));
     REQUIRE_OK(kefir_opt_code_loop_collection_init(&state.loops));
 
     kefir_result_t res = loop_removal_impl(&state);
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_opt_code_loop_collection_free(mem, &state.loops);
-        kefir_opt_code_control_flow_free(mem, &state.control_flow);
         return res;
     });
-    res = kefir_opt_code_loop_collection_free(mem, &state.loops);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_control_flow_free(mem, &state.control_flow);
-        return res;
-    });
-    REQUIRE_OK(kefir_opt_code_control_flow_free(mem, &state.control_flow));
+    REQUIRE_OK(kefir_opt_code_loop_collection_free(mem, &state.loops));
     return KEFIR_OK;
 }
 
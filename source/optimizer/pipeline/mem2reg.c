@@ -296,21 +296,15 @@ static kefir_result_t mem2reg_apply(struct kefir_mem *mem, struct kefir_opt_modu
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
 
-    struct kefir_opt_code_control_flow control_flow;
+    struct kefir_opt_code_control_flow *control_flow;
+    REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, &func->analysis, &control_flow));
+
     struct kefir_hashset candidates;
-    REQUIRE_OK(kefir_opt_code_control_flow_init(&control_flow));
     REQUIRE_OK(kefir_hashset_init(&candidates, &kefir_hashtable_uint_ops));
 
-    kefir_result_t res = kefir_opt_code_control_flow_build(mem, &control_flow, &func->code);
-    REQUIRE_CHAIN(&res, mem2reg_scan(mem, &func->code, &control_flow, module->ir_module, &candidates));
+    kefir_result_t res = mem2reg_scan(mem, &func->code, control_flow, module->ir_module, &candidates);
     REQUIRE_CHAIN(&res, kefir_opt_code_util_mem2reg_apply(mem, &func->code, &func->debug_info, module->ir_module,
-                                                          &control_flow, &candidates));
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_control_flow_free(mem, &control_flow);
-        kefir_hashset_free(mem, &candidates);
-        return res;
-    });
-    res = kefir_opt_code_control_flow_free(mem, &control_flow);
+                                                          control_flow, &candidates));
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_hashset_free(mem, &candidates);
         return res;
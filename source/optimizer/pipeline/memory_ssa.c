@@ -154,6 +154,9 @@ static kefir_result_t check_clobber(struct kefir_mem *mem, const struct kefir_op
 
     REQUIRE_OK(kefir_opt_code_may_alias(code, escapes, ir_module, location1_ref, size1, offset1, location2_ref, size2,
                                         offset2, do_alias));
+    if (*do_alias) {
+        REQUIRE_OK(kefir_opt_code_may_alias_by_type(instr1, instr2, do_alias));
+    }
     return KEFIR_OK;
 }
 
@@ -441,6 +444,9 @@ static kefir_result_t do_deduplicate_nonvolatile_load(
 
                 REQUIRE_OK(kefir_opt_code_may_alias(&func->code, escapes, ir_module, location1_ref, size1, offset1,
                                                     location2_ref, size2, offset2, &terminate));
+                if (terminate) {
+                    REQUIRE_OK(kefir_opt_code_may_alias_by_type(instr, iter_instr, &terminate));
+                }
             } break;
         }
 
@@ -575,6 +581,9 @@ static kefir_result_t has_downstream_clobbers_impl(struct kefir_mem *mem, const
                             kefir_bool_t may_alias;
                             REQUIRE_OK(kefir_opt_code_may_alias(code, escapes, ir_module, location1_ref, size1, offset1,
                                                                 location2_ref, size2, offset2, &may_alias));
+                            if (may_alias) {
+                                REQUIRE_OK(kefir_opt_code_may_alias_by_type(instr, iter_instr, &may_alias));
+                            }
                             if (may_alias) {
                                 *has_clobbers = false;
                                 return KEFIR_OK;
@@ -608,6 +617,9 @@ static kefir_result_t has_downstream_clobbers_impl(struct kefir_mem *mem, const
                             kefir_bool_t may_alias;
                             REQUIRE_OK(kefir_opt_code_may_alias(code, escapes, ir_module, location1_ref, size1, offset1,
                                                                 location2_ref, size2, offset2, &may_alias));
+                            if (may_alias) {
+                                REQUIRE_OK(kefir_opt_code_may_alias_by_type(instr, iter_instr, &may_alias));
+                            }
                             if (may_alias) {
                                 *has_clobbers = false;
                                 return KEFIR_OK;
@@ -639,6 +651,9 @@ static kefir_result_t has_downstream_clobbers_impl(struct kefir_mem *mem, const
                             kefir_bool_t may_alias;
                             REQUIRE_OK(kefir_opt_code_may_alias(code, escapes, ir_module, location1_ref, size1, offset1,
                                                                 location2_ref, size2, offset2, &may_alias));
+                            if (may_alias) {
+                                REQUIRE_OK(kefir_opt_code_may_alias_by_type(instr, iter_instr, &may_alias));
+                            }
                             if (may_alias) {
                                 *has_clobbers = false;
                                 return KEFIR_OK;
@@ -1264,57 +1279,39 @@ static kefir_result_t memory_ssa_apply(struct kefir_mem *mem, struct kefir_opt_m
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
 
-    struct kefir_opt_code_control_flow control_flow;
+    struct kefir_opt_code_control_flow *control_flow;
+    struct kefir_opt_code_liveness *liveness;
+    REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, &func->analysis, &control_flow));
+    REQUIRE_OK(kefir_opt_code_analysis_cache_liveness(mem, &func->analysis, &liveness));
+
     struct kefir_opt_code_sequencing sequencing;
-    struct kefir_opt_code_liveness liveness;
     struct kefir_opt_code_memssa memssa;
     struct kefir_opt_code_escape_analysis escapes;
-    REQUIRE_OK(kefir_opt_code_control_flow_init(&control_flow));
     REQUIRE_OK(kefir_opt_code_sequencing_init(&sequencing));
-    REQUIRE_OK(kefir_opt_code_liveness_init(&liveness));
     REQUIRE_OK(kefir_opt_code_memssa_init(&memssa));
     REQUIRE_OK(kefir_opt_code_escape_analysis_init(&escapes));
 
-    kefir_result_t res = kefir_opt_code_control_flow_build(mem, &control_flow, &func->code);
-    REQUIRE_CHAIN(&res, kefir_opt_code_liveness_build(mem, &liveness, &control_flow));
-    REQUIRE_CHAIN(&res, kefir_opt_code_memssa_construct(mem, &memssa, &func->code, &control_flow, &liveness));
+    kefir_result_t res = kefir_opt_code_memssa_construct(mem, &memssa, &func->code, control_flow, liveness);
     REQUIRE_CHAIN(&res, kefir_opt_code_escape_analysis_build(mem, &escapes, &func->code));
-    REQUIRE_CHAIN(&res, do_optimize(mem, module, func, config, &control_flow, &sequencing, &memssa, &escapes));
+    REQUIRE_CHAIN(&res, do_optimize(mem, module, func, config, control_flow, &sequencing, &memssa, &escapes));
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_opt_code_escape_analysis_free(mem, &escapes);
         kefir_opt_code_memssa_free(mem, &memssa);
-        kefir_opt_code_liveness_free(mem, &liveness);
         kefir_opt_code_sequencing_free(mem, &sequencing);
-        kefir_opt_code_control_flow_free(mem, &control_flow);
         return res;
     });
     res = kefir_opt_code_escape_analysis_free(mem, &escapes);
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_opt_code_memssa_free(mem, &memssa);
-        kefir_opt_code_liveness_free(mem, &liveness);
         kefir_opt_code_sequencing_free(mem, &sequencing);
-        kefir_opt_code_control_flow_free(mem, &control_flow);
         return res;
     });
     res = kefir_opt_code_memssa_free(mem, &memssa);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_liveness_free(mem, &liveness);
-        kefir_opt_code_sequencing_free(mem, &sequencing);
-        kefir_opt_code_control_flow_free(mem, &control_flow);
-        return res;
-    });
-    res = kefir_opt_code_liveness_free(mem, &liveness);
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_opt_code_sequencing_free(mem, &sequencing);
-        kefir_opt_code_control_flow_free(mem, &control_flow);
-        return res;
-    });
-    res = kefir_opt_code_sequencing_free(mem, &sequencing);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_control_flow_free(mem, &control_flow);
         return res;
     });
-    REQUIRE_OK(kefir_opt_code_control_flow_free(mem, &control_flow));
+    REQUIRE_OK(kefir_opt_code_sequencing_free(mem, &sequencing));
     return KEFIR_OK;
 }
 
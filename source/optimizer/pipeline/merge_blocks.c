@@ -31,7 +31,7 @@ struct merge_entry {
 };
 
 struct merge_state {
-    struct kefir_opt_code_control_flow control_flow;
+    struct kefir_opt_code_control_flow *control_flow;
     struct kefir_hashtable entries;
 };
 
@@ -41,7 +41,7 @@ static kefir_result_t collect_candidates(struct kefir_mem *mem, struct kefir_opt
     kefir_size_t block_count = kefir_opt_code_container_block_count(&func->code);
 
     for (kefir_opt_block_id_t block_ref = 0; block_ref < block_count; block_ref++) {
-        kefir_opt_block_id_t immediate_dominator_ref = state->control_flow.blocks[block_ref].immediate_dominator;
+        kefir_opt_block_id_t immediate_dominator_ref = state->control_flow->blocks[block_ref].immediate_dominator;
 
         const struct kefir_opt_code_block *block;
         REQUIRE_OK(kefir_opt_code_container_block(&func->code, block_ref, &block));
@@ -49,10 +49,10 @@ static kefir_result_t collect_candidates(struct kefir_mem *mem, struct kefir_opt
         REQUIRE_OK(kefir_opt_code_block_phi_head(&func->code, block_ref, &phi_instr_ref));
         if (block_ref != func->code.gate_block && immediate_dominator_ref != KEFIR_ID_NONE &&
             immediate_dominator_ref != func->code.gate_block &&
-            kefir_hashset_size(&state->control_flow.blocks[block_ref].predecessors) == 1 &&
-            kefir_hashset_has(&state->control_flow.blocks[block_ref].predecessors,
+            kefir_hashset_size(&state->control_flow->blocks[block_ref].predecessors) == 1 &&
+            kefir_hashset_has(&state->control_flow->blocks[block_ref].predecessors,
                               (kefir_hashset_key_t) immediate_dominator_ref) &&
-            !kefir_hashset_has(&state->control_flow.indirect_jump_target_blocks, (kefir_hashset_key_t) block_ref) &&
+            !kefir_hashset_has(&state->control_flow->indirect_jump_target_blocks, (kefir_hashset_key_t) block_ref) &&
             phi_instr_ref == KEFIR_ID_NONE) {
 
             const struct kefir_opt_code_block *pred_block;
@@ -73,12 +73,13 @@ static kefir_result_t collect_candidates(struct kefir_mem *mem, struct kefir_opt
                 (block_tail->operation.opcode == KEFIR_OPT_OPCODE_JUMP ||
                  block_tail->operation.opcode == KEFIR_OPT_OPCODE_BRANCH ||
                  block_tail->operation.opcode == KEFIR_OPT_OPCODE_BRANCH_COMPARE ||
+                 block_tail->operation.opcode == KEFIR_OPT_OPCODE_SWITCH ||
                  block_tail->operation.opcode == KEFIR_OPT_OPCODE_INLINE_ASSEMBLY ||
                  block_tail->operation.opcode == KEFIR_OPT_OPCODE_RETURN ||
                  block_tail->operation.opcode == KEFIR_OPT_OPCODE_UNREACHABLE ||
                  block_tail->operation.opcode == KEFIR_OPT_OPCODE_TAIL_INVOKE ||
                  block_tail->operation.opcode == KEFIR_OPT_OPCODE_TAIL_INVOKE_VIRTUAL) &&
-                !kefir_hashset_has(&state->control_flow.blocks[block_ref].successors,
+                !kefir_hashset_has(&state->control_flow->blocks[block_ref].successors,
                                    (kefir_hashset_key_t) func->code.gate_block)) {
                 struct merge_entry *entry;
                 kefir_hashtable_value_t table_value;
@@ -243,6 +244,20 @@ static kefir_result_t do_merge(struct kefir_mem *mem, struct kefir_opt_function
                     (kefir_opt_block_id_t) successor_block_tail->operation.parameters.branch.alternative_block));
                 break;
 
+            case KEFIR_OPT_OPCODE_SWITCH: {
+                REQUIRE_OK(kefir_opt_code_block_redirect_phi_links(
+                    mem, &func->code, successor_block_id, block_id,
+                    (kefir_opt_block_id_t) successor_block_tail->operation.parameters.branch.target_block));
+
+                const struct kefir_opt_switch_table *switch_table;
+                REQUIRE_OK(kefir_opt_code_container_switch_table(
+                    &func->code, successor_block_tail->operation.parameters.branch.switch_table_ref, &switch_table));
+                for (kefir_size_t i = 0; i < switch_table->length; i++) {
+                    REQUIRE_OK(kefir_opt_code_block_redirect_phi_links(mem, &func->code, successor_block_id, block_id,
+                                                                       switch_table->targets[i]));
+                }
+            } break;
+
             case KEFIR_OPT_OPCODE_INLINE_ASSEMBLY: {
                 const struct kefir_opt_inline_assembly_node *inline_asm;
                 REQUIRE_OK(kefir_opt_code_container_inline_assembly(
@@ -284,7 +299,7 @@ static kefir_result_t block_merge_impl(struct kefir_mem *mem, struct kefir_opt_f
 
     kefir_bool_t merged_blocks = true;
     for (; merged_blocks;) {
-        REQUIRE_OK(kefir_opt_code_control_flow_build(mem, &state->control_flow, &func->code));
+        REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, &func->analysis, &state->control_flow));
         REQUIRE_OK(collect_candidates(mem, func, state));
 
         merged_blocks = false;
@@ -324,23 +339,16 @@ static kefir_result_t merge_blocks_apply(struct kefir_mem *mem, struct kefir_opt
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
 
-    struct merge_state state;
-    REQUIRE_OK(kefir_opt_code_control_flow_init(&state.control_flow));
+    struct merge_state state = {.control_flow = NULL};
     REQUIRE_OK(kefir_hashtable_init(&state.entries, &kefir_hashtable_uint_ops));
     REQUIRE_OK(kefir_hashtable_on_removal(&state.entries, free_entry, NULL));
     kefir_result_t res = KEFIR_OK;
     REQUIRE_CHAIN(&res, block_merge_impl(mem, func, &state));
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_hashtable_free(mem, &state.entries);
-        kefir_opt_code_control_flow_free(mem, &state.control_flow);
-        return res;
-    });
-    res = kefir_hashtable_free(mem, &state.entries);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_control_flow_free(mem, &state.control_flow);
         return res;
     });
-    REQUIRE_OK(kefir_opt_code_control_flow_free(mem, &state.control_flow));
+    REQUIRE_OK(kefir_hashtable_free(mem, &state.entries));
     return KEFIR_OK;
 }
 
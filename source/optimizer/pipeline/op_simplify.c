@@ -3608,6 +3608,30 @@ static kefir_result_t simplify_branch_compare(struct kefir_mem *mem, struct kefi
     return KEFIR_OK;
 }
 
+static kefir_result_t simplify_switch(struct kefir_mem *mem, struct kefir_opt_function *func,
+                                      struct kefir_opt_code_sequencing *sequencing,
+                                      const struct kefir_opt_instruction *instr,
+                                      kefir_opt_instruction_ref_t *replacement_ref) {
+    const struct kefir_opt_instruction *arg1;
+    REQUIRE_OK(kefir_opt_code_container_instr(&func->code, instr->operation.parameters.refs[0], &arg1));
+    REQUIRE(
+        arg1->operation.opcode == KEFIR_OPT_OPCODE_INT_CONST || arg1->operation.opcode == KEFIR_OPT_OPCODE_UINT_CONST,
+        KEFIR_OK);
+
+    const struct kefir_opt_switch_table *table;
+    REQUIRE_OK(kefir_opt_code_container_switch_table(&func->code, instr->operation.parameters.branch.switch_table_ref,
+                                                     &table));
+    const kefir_uint64_t index = (kefir_uint64_t) arg1->operation.parameters.imm.integer;
+    const kefir_opt_block_id_t block_id = instr->block_id;
+    const kefir_opt_block_id_t target_block =
+        index < table->length ? table->targets[index] : instr->operation.parameters.branch.target_block;
+
+    REQUIRE_OK(kefir_opt_code_container_drop_control(&func->code, instr->id));
+    REQUIRE_OK(kefir_opt_code_builder_finalize_jump(mem, &func->code, block_id, target_block, replacement_ref));
+    REQUIRE_OK(kefir_opt_code_sequencing_drop_cache(mem, sequencing));
+    return KEFIR_OK;
+}
+
 static kefir_result_t simplify_select(struct kefir_mem *mem, struct kefir_opt_function *func,
                                       const struct kefir_opt_instruction *instr,
                                       kefir_opt_instruction_ref_t *replacement_ref) {
@@ -3696,7 +3720,8 @@ static kefir_result_t simplify_load(struct kefir_mem *mem, struct kefir_opt_func
             mem, &func->code, instr->block_id, instr->operation.parameters.refs[0],
             &(struct kefir_opt_memory_access_flags) {
                 .load_extension = KEFIR_OPT_MEMORY_LOAD_SIGN_EXTEND,
-                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access},
+                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access,
+                .alias_tag = instr->operation.parameters.memory_access.flags.alias_tag},
             replacement_ref));
         REQUIRE_OK(kefir_opt_code_container_replace_references(mem, &func->code, *replacement_ref, use_instr_ref));
     } else if (instr->operation.opcode == KEFIR_OPT_OPCODE_INT8_LOAD &&
@@ -3707,7 +3732,8 @@ static kefir_result_t simplify_load(struct kefir_mem *mem, struct kefir_opt_func
             mem, &func->code, instr->block_id, instr->operation.parameters.refs[0],
             &(struct kefir_opt_memory_access_flags) {
                 .load_extension = KEFIR_OPT_MEMORY_LOAD_ZERO_EXTEND,
-                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access},
+                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access,
+                .alias_tag = instr->operation.parameters.memory_access.flags.alias_tag},
             replacement_ref));
         REQUIRE_OK(kefir_opt_code_container_replace_references(mem, &func->code, *replacement_ref, use_instr_ref));
     } else if (instr->operation.opcode == KEFIR_OPT_OPCODE_INT16_LOAD &&
@@ -3718,7 +3744,8 @@ static kefir_result_t simplify_load(struct kefir_mem *mem, struct kefir_opt_func
             mem, &func->code, instr->block_id, instr->operation.parameters.refs[0],
             &(struct kefir_opt_memory_access_flags) {
                 .load_extension = KEFIR_OPT_MEMORY_LOAD_SIGN_EXTEND,
-                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access},
+                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access,
+                .alias_tag = instr->operation.parameters.memory_access.flags.alias_tag},
             replacement_ref));
         REQUIRE_OK(kefir_opt_code_container_replace_references(mem, &func->code, *replacement_ref, use_instr_ref));
     } else if (instr->operation.opcode == KEFIR_OPT_OPCODE_INT16_LOAD &&
@@ -3729,7 +3756,8 @@ static kefir_result_t simplify_load(struct kefir_mem *mem, struct kefir_opt_func
             mem, &func->code, instr->block_id, instr->operation.parameters.refs[0],
             &(struct kefir_opt_memory_access_flags) {
                 .load_extension = KEFIR_OPT_MEMORY_LOAD_ZERO_EXTEND,
-                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access},
+                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access,
+                .alias_tag = instr->operation.parameters.memory_access.flags.alias_tag},
             replacement_ref));
         REQUIRE_OK(kefir_opt_code_container_replace_references(mem, &func->code, *replacement_ref, use_instr_ref));
     } else if (instr->operation.opcode == KEFIR_OPT_OPCODE_INT32_LOAD &&
@@ -3740,7 +3768,8 @@ static kefir_result_t simplify_load(struct kefir_mem *mem, struct kefir_opt_func
             mem, &func->code, instr->block_id, instr->operation.parameters.refs[0],
             &(struct kefir_opt_memory_access_flags) {
                 .load_extension = KEFIR_OPT_MEMORY_LOAD_SIGN_EXTEND,
-                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access},
+                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access,
+                .alias_tag = instr->operation.parameters.memory_access.flags.alias_tag},
             replacement_ref));
         REQUIRE_OK(kefir_opt_code_container_replace_references(mem, &func->code, *replacement_ref, use_instr_ref));
     } else if (instr->operation.opcode == KEFIR_OPT_OPCODE_INT32_LOAD &&
@@ -3751,7 +3780,8 @@ static kefir_result_t simplify_load(struct kefir_mem *mem, struct kefir_opt_func
             mem, &func->code, instr->block_id, instr->operation.parameters.refs[0],
             &(struct kefir_opt_memory_access_flags) {
                 .load_extension = KEFIR_OPT_MEMORY_LOAD_ZERO_EXTEND,
-                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access},
+                .volatile_access = instr->operation.parameters.memory_access.flags.volatile_access,
+                .alias_tag = instr->operation.parameters.memory_access.flags.alias_tag},
             replacement_ref));
         REQUIRE_OK(kefir_opt_code_container_replace_references(mem, &func->code, *replacement_ref, use_instr_ref));
     }
@@ -4342,6 +4372,10 @@ static kefir_result_t op_simplify_apply_impl(struct kefir_mem *mem, const struct
                         REQUIRE_OK(simplify_branch_compare(mem, func, sequencing, instr, &replacement_ref));
                         break;
 
+                    case KEFIR_OPT_OPCODE_SWITCH:
+                        REQUIRE_OK(simplify_switch(mem, func, sequencing, instr, &replacement_ref));
+                        break;
+
                     case KEFIR_OPT_OPCODE_SELECT:
                         REQUIRE_OK(simplify_select(mem, func, instr, &replacement_ref));
                         break;
@@ -4446,23 +4480,17 @@ static kefir_result_t op_simplify_apply(struct kefir_mem *mem, struct kefir_opt_
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
 
-    struct kefir_opt_code_control_flow control_flow;
+    struct kefir_opt_code_control_flow *control_flow;
+    REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, &func->analysis, &control_flow));
+
     struct kefir_opt_code_sequencing sequencing;
-    REQUIRE_OK(kefir_opt_code_control_flow_init(&control_flow));
     REQUIRE_OK(kefir_opt_code_sequencing_init(&sequencing));
-    kefir_result_t res = kefir_opt_code_control_flow_build(mem, &control_flow, &func->code);
-    REQUIRE_CHAIN(&res, op_simplify_apply_impl(mem, module, func, &control_flow, &sequencing));
+    kefir_result_t res = op_simplify_apply_impl(mem, module, func, control_flow, &sequencing);
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_opt_code_sequencing_free(mem, &sequencing);
-        kefir_opt_code_control_flow_free(mem, &control_flow);
-        return res;
-    });
-    res = kefir_opt_code_sequencing_free(mem, &sequencing);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_control_flow_free(mem, &control_flow);
         return res;
     });
-    REQUIRE_OK(kefir_opt_code_control_flow_free(mem, &control_flow));
+    REQUIRE_OK(kefir_opt_code_sequencing_free(mem, &sequencing));
     return KEFIR_OK;
 }
 
@@ -413,13 +413,6 @@ static kefir_result_t phi_scc_tarjan(struct kefir_mem *mem, struct kefir_opt_cod
     return KEFIR_OK;
 }
 
-static kefir_result_t remove_phis(struct kefir_mem *mem, struct kefir_opt_code_container *code,
-                                  struct kefir_hashset *removal_set, struct kefir_opt_code_control_flow *control_flow) {
-    REQUIRE_OK(kefir_opt_code_control_flow_build(mem, control_flow, code));
-    REQUIRE_OK(phi_scc_tarjan(mem, code, removal_set, control_flow));
-    return KEFIR_OK;
-}
-
 static kefir_result_t phi_removal_apply(struct kefir_mem *mem, struct kefir_opt_module *module,
                                         struct kefir_opt_function *func, const struct kefir_optimizer_pass *pass,
                                         const struct kefir_optimizer_configuration *config) {
@@ -429,19 +422,13 @@ static kefir_result_t phi_removal_apply(struct kefir_mem *mem, struct kefir_opt_
     REQUIRE(module != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer module"));
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
 
+    struct kefir_opt_code_control_flow *control_flow;
+    REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, &func->analysis, &control_flow));
+
     struct kefir_hashset removal_set;
     REQUIRE_OK(kefir_hashset_init(&removal_set, &kefir_hashtable_uint_ops));
 
-    struct kefir_opt_code_control_flow control_flow;
-    REQUIRE_OK(kefir_opt_code_control_flow_init(&control_flow));
-
-    kefir_result_t res = remove_phis(mem, &func->code, &removal_set, &control_flow);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_control_flow_free(mem, &control_flow);
-        kefir_hashset_free(mem, &removal_set);
-        return res;
-    });
-    res = kefir_opt_code_control_flow_free(mem, &control_flow);
+    kefir_result_t res = phi_scc_tarjan(mem, &func->code, &removal_set, control_flow);
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_hashset_free(mem, &removal_set);
         return res;
@@ -33,7 +33,7 @@ struct sroa_state {
     struct kefir_opt_code_container *code;
     struct kefir_opt_code_debug_info *debug_info;
     const struct kefir_ir_module *ir_module;
-    struct kefir_opt_code_control_flow control_flow;
+    struct kefir_opt_code_control_flow *control_flow;
     struct kefir_opt_code_escape_analysis escapes;
 
     struct kefir_hashtable candidate_accesses;
@@ -266,14 +266,13 @@ static kefir_result_t sroa_prepare_locations(struct kefir_mem *mem, struct sroa_
 }
 
 static kefir_result_t sroa_impl(struct kefir_mem *mem, struct sroa_state *state) {
-    REQUIRE_OK(kefir_opt_code_control_flow_build(mem, &state->control_flow, state->code));
     REQUIRE_OK(kefir_opt_code_escape_analysis_build(mem, &state->escapes, state->code));
 
     struct kefir_opt_code_container_iterator iter;
     for (struct kefir_opt_code_block *block = kefir_opt_code_container_iter(state->code, &iter); block != NULL;
          block = kefir_opt_code_container_next(&iter)) {
         kefir_bool_t is_reachable;
-        REQUIRE_OK(kefir_opt_code_control_flow_is_reachable_from_entry(&state->control_flow, block->id, &is_reachable));
+        REQUIRE_OK(kefir_opt_code_control_flow_is_reachable_from_entry(state->control_flow, block->id, &is_reachable));
         if (!is_reachable) {
             continue;
         }
@@ -298,7 +297,7 @@ static kefir_result_t sroa_impl(struct kefir_mem *mem, struct sroa_state *state)
     }
 
     REQUIRE_OK(kefir_opt_code_util_mem2reg_apply(mem, state->code, state->debug_info, state->ir_module,
-                                                 &state->control_flow, &state->candidates));
+                                                 state->control_flow, &state->candidates));
     return KEFIR_OK;
 }
 
@@ -312,7 +311,7 @@ static kefir_result_t sroa_apply(struct kefir_mem *mem, struct kefir_opt_module
     REQUIRE(func != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid optimizer function"));
 
     struct sroa_state state = {.code = &func->code, .debug_info = &func->debug_info, .ir_module = module->ir_module};
-    REQUIRE_OK(kefir_opt_code_control_flow_init(&state.control_flow));
+    REQUIRE_OK(kefir_opt_code_analysis_cache_control_flow(mem, &func->analysis, &state.control_flow));
     REQUIRE_OK(kefir_opt_code_escape_analysis_init(&state.escapes));
     REQUIRE_OK(kefir_hashtable_init(&state.candidate_accesses, &kefir_hashtable_uint_ops));
     REQUIRE_OK(kefir_hashtable_init(&state.candidate_locations, &kefir_hashtable_uint_ops));
@@ -324,7 +323,6 @@ static kefir_result_t sroa_apply(struct kefir_mem *mem, struct kefir_opt_module
         kefir_hashtable_free(mem, &state.candidate_locations);
         kefir_hashtable_free(mem, &state.candidate_accesses);
         kefir_opt_code_escape_analysis_free(mem, &state.escapes);
-        kefir_opt_code_control_flow_free(mem, &state.control_flow);
         return res;
     });
     res = kefir_hashset_free(mem, &state.candidates);
@@ -332,28 +330,20 @@ static kefir_result_t sroa_apply(struct kefir_mem *mem, struct kefir_opt_module
         kefir_hashtable_free(mem, &state.candidate_locations);
         kefir_hashtable_free(mem, &state.candidate_accesses);
         kefir_opt_code_escape_analysis_free(mem, &state.escapes);
-        kefir_opt_code_control_flow_free(mem, &state.control_flow);
         return res;
     });
     res = kefir_hashtable_free(mem, &state.candidate_locations);
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_hashtable_free(mem, &state.candidate_accesses);
         kefir_opt_code_escape_analysis_free(mem, &state.escapes);
-        kefir_opt_code_control_flow_free(mem, &state.control_flow);
         return res;
     });
     res = kefir_hashtable_free(mem, &state.candidate_accesses);
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_opt_code_escape_analysis_free(mem, &state.escapes);
-        kefir_opt_code_control_flow_free(mem, &state.control_flow);
         return res;
     });
-    res = kefir_opt_code_escape_analysis_free(mem, &state.escapes);
-    REQUIRE_ELSE(res == KEFIR_OK, {
-        kefir_opt_code_control_flow_free(mem, &state.control_flow);
-        return res;
-    });
-    REQUIRE_OK(kefir_opt_code_control_flow_free(mem, &state.control_flow));
+    REQUIRE_OK(kefir_opt_code_escape_analysis_free(mem, &state.escapes));
     return KEFIR_OK;
 }
 
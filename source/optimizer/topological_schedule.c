@@ -84,8 +84,10 @@ static kefir_result_t schedule_live_out(struct schedule_instruction_param *param
         for (res = kefir_opt_code_block_phi_head(param->code, successor_block_id, &phi_instr_ref);
              res == KEFIR_OK && phi_instr_ref != KEFIR_ID_NONE;
              kefir_opt_phi_next_sibling(param->code, phi_instr_ref, &phi_instr_ref)) {
-            if (!kefir_hashset_has(&param->liveness->blocks[successor_block_id].alive_instr,
-                                   (kefir_hashset_key_t) phi_instr_ref)) {
+            kefir_bool_t phi_alive;
+            REQUIRE_OK(kefir_opt_code_liveness_instruction_is_alive_in_block(param->liveness, successor_block_id,
+                                                                             phi_instr_ref, &phi_alive));
+            if (!phi_alive) {
                 continue;
             }
             kefir_opt_instruction_ref_t instr_ref2;
@@ -95,12 +97,11 @@ static kefir_result_t schedule_live_out(struct schedule_instruction_param *param
         REQUIRE_OK(res);
 
         if (successor_block_id != block->id) {
-            struct kefir_hashset_iterator alive_instr_iter;
-            kefir_hashset_key_t alive_instr_entry;
-            for (res = kefir_hashset_iter(&param->liveness->blocks[successor_block_id].alive_instr, &alive_instr_iter,
-                                          &alive_instr_entry);
-                 res == KEFIR_OK; res = kefir_hashset_next(&alive_instr_iter, &alive_instr_entry)) {
-                ASSIGN_DECL_CAST(kefir_opt_instruction_ref_t, alive_instr_ref, alive_instr_entry);
+            struct kefir_opt_code_liveness_block_iterator alive_instr_iter;
+            kefir_opt_instruction_ref_t alive_instr_ref;
+            for (res = kefir_opt_code_liveness_block_iter(param->liveness, &alive_instr_iter, successor_block_id,
+                                                          &alive_instr_ref);
+                 res == KEFIR_OK; res = kefir_opt_code_liveness_block_next(&alive_instr_iter, &alive_instr_ref)) {
                 const struct kefir_opt_instruction *alive_instr;
                 REQUIRE_OK(kefir_opt_code_container_instr(param->code, alive_instr_ref, &alive_instr));
                 if (alive_instr->block_id != block->id) {
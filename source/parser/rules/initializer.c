@@ -27,6 +27,22 @@ static kefir_result_t scan_initializer(struct kefir_mem *mem, struct kefir_parse
     REQUIRE(payload != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid payload"));
 
     ASSIGN_DECL_CAST(struct kefir_ast_initializer **, initializer, payload);
+    if (PARSER_TOKEN_IS(parser, 0, KEFIR_TOKEN_EMBED)) {
+        const struct kefir_token *token = PARSER_CURSOR(parser, 0);
+        struct kefir_ast_string_literal *literal =
+            kefir_ast_new_string_literal_embed(mem, token->embed->content, token->embed->length);
+        REQUIRE(literal != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate AST string literal"));
+        literal->base.source_location = token->source_location;
+        *initializer = kefir_ast_new_expression_initializer(mem, KEFIR_AST_NODE_BASE(literal));
+        REQUIRE_ELSE(*initializer != NULL, {
+            KEFIR_AST_NODE_FREE(mem, KEFIR_AST_NODE_BASE(literal));
+            return KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate AST expression initializer");
+        });
+        (*initializer)->source_location = token->source_location;
+        REQUIRE_OK(PARSER_SHIFT(parser));
+        return KEFIR_OK;
+    }
+
     kefir_result_t res = parser->ruleset.initializer_list(mem, parser, initializer);
     if (res == KEFIR_NO_MATCH) {
         struct kefir_ast_node_base *node = NULL;
@@ -29,6 +29,8 @@
 #include "kefir/core/util.h"
 #include "kefir/core/error.h"
 #include "kefir/core/os_error.h"
+#include "kefir/core/hashset.h"
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <limits.h>
@@ -36,7 +38,7 @@
 #include <libgen.h>
 #include <errno.h>
 #include <fcntl.h>
-#include <unistd.h>
+#include <dirent.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 
@@ -45,6 +47,106 @@ struct include_directory_descriptor {
     kefir_bool_t quote_only;
 };
 
+struct include_resolution {
+    const char *root;
+    const char *filepath;
+};
+
+#define DIRECTORY_ENTRY_NAME_MAX 256
+
+static kefir_result_t read_directory_listing(struct kefir_mem *mem,
+                                             struct kefir_preprocessor_filesystem_source_locator *locator,
+                                             DIR *directory, struct kefir_hashset *listing, kefir_bool_t *complete) {
+    *complete = false;
+    for (;;) {
+        errno = 0;
+        struct dirent *entry = readdir(directory);
+        if (entry == NULL) {
+            *complete = errno == 0;
+            break;
+        }
+
+        const char *name = kefir_string_pool_insert(mem, &locator->cache_strings, entry->d_name, NULL);
+        REQUIRE(name != NULL,
+                KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to insert directory entry name into string pool"));
+        REQUIRE_OK(kefir_hashset_add(mem, listing, (kefir_hashset_key_t) name));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t directory_listing(struct kefir_mem *mem,
+                                        struct kefir_preprocessor_filesystem_source_locator *locator,
+                                        const char *root, const struct kefir_hashset **listing_ptr) {
+    root = kefir_string_pool_insert(mem, &locator->cache_strings, root, NULL);
+    REQUIRE(root != NULL, KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to insert directory path into string pool"));
+
+    kefir_hashtable_value_t table_value;
+    kefir_result_t res = kefir_hashtable_at(&locator->directory_listings, (kefir_hashtable_key_t) root, &table_value);
+    if (res != KEFIR_NOT_FOUND) {
+        REQUIRE_OK(res);
+        *listing_ptr = (const struct kefir_hashset *) table_value;
+        return KEFIR_OK;
+    }
+
+    // Directories that cannot be listed are recorded without listing, so that lookups fall back to probing
+    struct kefir_hashset *listing = NULL;
+    DIR *directory = opendir(root);
+    if (directory != NULL) {
+        listing = KEFIR_MALLOC(mem, sizeof(struct kefir_hashset));
+        REQUIRE_ELSE(listing != NULL, {
+            closedir(directory);
+            return KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate directory listing");
+        });
+        kefir_bool_t complete;
+        res = kefir_hashset_init(listing, &kefir_hashtable_str_ops);
+        REQUIRE_CHAIN(&res, read_directory_listing(mem, locator, directory, listing, &complete));
+        closedir(directory);
+        if (res == KEFIR_OK && !complete) {
+            res = kefir_hashset_free(mem, listing);
+            KEFIR_FREE(mem, listing);
+            listing = NULL;
+            REQUIRE_OK(res);
+        }
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            kefir_hashset_free(mem, listing);
+            KEFIR_FREE(mem, listing);
+            return res;
+        });
+    }
+
+    res = kefir_hashtable_insert(mem, &locator->directory_listings, (kefir_hashtable_key_t) root,
+                                 (kefir_hashtable_value_t) listing);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        if (listing != NULL) {
+            kefir_hashset_free(mem, listing);
+            KEFIR_FREE(mem, listing);
+        }
+        return res;
+    });
+    *listing_ptr = listing;
+    return KEFIR_OK;
+}
+
+static kefir_result_t directory_may_contain(struct kefir_mem *mem,
+                                            struct kefir_preprocessor_filesystem_source_locator *locator,
+                                            const char *root, const char *filepath, kefir_bool_t *may_contain) {
+    *may_contain = true;
+    REQUIRE(root != NULL && filepath[0] != '/', KEFIR_OK);
+
+    const kefir_size_t length = strcspn(filepath, "/");
+    REQUIRE(length > 0 && length < DIRECTORY_ENTRY_NAME_MAX, KEFIR_OK);
+    char name[DIRECTORY_ENTRY_NAME_MAX];
+    memcpy(name, filepath, length);
+    name[length] = '\0';
+
+    const struct kefir_hashset *listing;
+    REQUIRE_OK(directory_listing(mem, locator, root, &listing));
+    if (listing != NULL) {
+        *may_contain = kefir_hashset_has(listing, (kefir_hashset_key_t) name);
+    }
+    return KEFIR_OK;
+}
+
 static kefir_result_t close_source(struct kefir_mem *mem, struct kefir_preprocessor_source_file *source_file) {
     REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
     REQUIRE(source_file != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid source file"));
@@ -92,6 +194,10 @@ static kefir_result_t open_file(struct kefir_mem *mem, const char *root, const c
 static kefir_result_t try_open_file(struct kefir_mem *mem, const char *root, const char *filepath, kefir_bool_t system,
                                     struct kefir_preprocessor_source_file *source_file,
                                     struct kefir_preprocessor_filesystem_source_locator *locator) {
+    kefir_bool_t may_contain;
+    REQUIRE_OK(directory_may_contain(mem, locator, root, filepath, &may_contain));
+    REQUIRE(may_contain, KEFIR_SET_ERROR(KEFIR_NOT_FOUND, "Cannot find requested file"));
+
     kefir_size_t path_length = root != NULL ? strlen(root) + strlen(filepath) + 2 : strlen(filepath) + 1;
 
     char *path = KEFIR_MALLOC(mem, path_length);
@@ -111,7 +217,7 @@ static kefir_result_t try_open_file(struct kefir_mem *mem, const char *root, con
         return KEFIR_SET_OS_ERROR("Failed to determine real path");
     }
     kefir_result_t res = open_file(mem, root, resolved_path, system, source_file, locator->symbols);
-    KEFIR_FREE(mem, resolved_path);
+    free(resolved_path);
     if (res != KEFIR_NOT_FOUND) {
         REQUIRE_OK(res);
         return KEFIR_OK;
@@ -120,37 +226,34 @@ static kefir_result_t try_open_file(struct kefir_mem *mem, const char *root, con
     }
 }
 
-static kefir_result_t open_source(struct kefir_mem *mem, const struct kefir_preprocessor_source_locator *source_locator,
-                                  const char *filepath, kefir_bool_t system,
-                                  const struct kefir_preprocessor_source_file_info *current_file,
-                                  kefir_preprocessor_source_locator_mode_t mode,
-                                  struct kefir_preprocessor_source_file *source_file) {
-    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
-    REQUIRE(source_locator != NULL,
-            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid filesystem source locator"));
-    REQUIRE(filepath != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid file path"));
-    REQUIRE(source_file != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to source file"));
-    ASSIGN_DECL_CAST(struct kefir_preprocessor_filesystem_source_locator *, locator, source_locator);
-
-    if (current_file != NULL && current_file->filepath && !system &&
-        mode == KEFIR_PREPROCESSOR_SOURCE_LOCATOR_MODE_NORMAL) {
-        char *current_clone = KEFIR_MALLOC(mem, strlen(current_file->filepath) + 1);
-        REQUIRE(current_clone != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate directory name"));
-        strcpy(current_clone, current_file->filepath);
-        char *directory = dirname(current_clone);
-        REQUIRE_ELSE(directory != NULL, {
-            KEFIR_FREE(mem, current_clone);
-            return KEFIR_SET_OS_ERROR("Failed to obtain dirname");
-        });
+static kefir_result_t current_file_directory(struct kefir_mem *mem,
+                                             struct kefir_preprocessor_filesystem_source_locator *locator,
+                                             const struct kefir_preprocessor_source_file_info *current_file,
+                                             const char **directory_ptr) {
+    char *current_clone = KEFIR_MALLOC(mem, strlen(current_file->filepath) + 1);
+    REQUIRE(current_clone != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate directory name"));
+    strcpy(current_clone, current_file->filepath);
+    char *directory = dirname(current_clone);
+    REQUIRE_ELSE(directory != NULL, {
+        KEFIR_FREE(mem, current_clone);
+        return KEFIR_SET_OS_ERROR("Failed to obtain dirname");
+    });
 
-        const char *directory_copy = kefir_string_pool_insert(mem, locator->symbols, directory, NULL);
-        REQUIRE_ELSE(directory_copy != NULL, {
-            KEFIR_FREE(mem, current_clone);
-            return KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to insert directory path into symbol table");
-        });
+    const char *directory_copy = kefir_string_pool_insert(mem, locator->symbols, directory, NULL);
+    REQUIRE_ELSE(directory_copy != NULL, {
         KEFIR_FREE(mem, current_clone);
+        return KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to insert directory path into symbol table");
+    });
+    KEFIR_FREE(mem, current_clone);
+    *directory_ptr = directory_copy;
+    return KEFIR_OK;
+}
 
-        kefir_result_t res = try_open_file(mem, directory_copy, filepath, system, source_file, locator);
+static kefir_result_t search_source(struct kefir_mem *mem, struct kefir_preprocessor_filesystem_source_locator *locator,
+                                    const char *filepath, kefir_bool_t system, const char *current_directory,
+                                    const char *base_include_dir, struct kefir_preprocessor_source_file *source_file) {
+    if (current_directory != NULL) {
+        kefir_result_t res = try_open_file(mem, current_directory, filepath, system, source_file, locator);
         if (res != KEFIR_NOT_FOUND) {
             REQUIRE_OK(res);
             return KEFIR_OK;
@@ -158,11 +261,10 @@ static kefir_result_t open_source(struct kefir_mem *mem, const struct kefir_prep
     }
 
     const struct kefir_list_entry *iter = kefir_list_head(&locator->include_roots);
-    if (mode == KEFIR_PREPROCESSOR_SOURCE_LOCATOR_MODE_NEXT && current_file != NULL &&
-        current_file->base_include_dir != NULL) {
+    if (base_include_dir != NULL) {
         for (; iter != NULL; kefir_list_next(&iter)) {
             ASSIGN_DECL_CAST(struct include_directory_descriptor *, root, iter->value);
-            if (strcmp(current_file->base_include_dir, root->path) == 0) {
+            if (strcmp(base_include_dir, root->path) == 0) {
                 break;
             }
         }
@@ -195,6 +297,96 @@ static kefir_result_t open_source(struct kefir_mem *mem, const struct kefir_prep
     return KEFIR_SET_ERRORF(KEFIR_NOT_FOUND, "Unable to find requested include file %s", filepath);
 }
 
+static kefir_result_t include_resolution_key(struct kefir_mem *mem,
+                                             struct kefir_preprocessor_filesystem_source_locator *locator,
+                                             const char *filepath, kefir_bool_t system,
+                                             const char *current_directory, const char *base_include_dir,
+                                             const char **key_ptr) {
+    if (current_directory == NULL) {
+        current_directory = "";
+    }
+    if (base_include_dir == NULL) {
+        base_include_dir = "";
+    }
+
+    // Components are prefixed with their lengths to keep the key unambiguous
+    const char *format = "%c%zu:%s%zu:%s%s";
+    const int length = snprintf(NULL, 0, format, system ? 's' : 'q', strlen(current_directory), current_directory,
+                                strlen(base_include_dir), base_include_dir, filepath);
+    REQUIRE(length >= 0, KEFIR_SET_OS_ERROR("Failed to format include resolution key"));
+    char *key = KEFIR_MALLOC(mem, length + 1);
+    REQUIRE(key != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate include resolution key"));
+    snprintf(key, length + 1, format, system ? 's' : 'q', strlen(current_directory), current_directory,
+             strlen(base_include_dir), base_include_dir, filepath);
+
+    *key_ptr = kefir_string_pool_insert(mem, &locator->cache_strings, key, NULL);
+    KEFIR_FREE(mem, key);
+    REQUIRE(*key_ptr != NULL,
+            KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to insert include resolution key into string pool"));
+    return KEFIR_OK;
+}
+
+static kefir_result_t open_source(struct kefir_mem *mem, const struct kefir_preprocessor_source_locator *source_locator,
+                                  const char *filepath, kefir_bool_t system,
+                                  const struct kefir_preprocessor_source_file_info *current_file,
+                                  kefir_preprocessor_source_locator_mode_t mode,
+                                  struct kefir_preprocessor_source_file *source_file) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(source_locator != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid filesystem source locator"));
+    REQUIRE(filepath != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid file path"));
+    REQUIRE(source_file != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to source file"));
+    ASSIGN_DECL_CAST(struct kefir_preprocessor_filesystem_source_locator *, locator, source_locator);
+
+    const char *current_directory = NULL;
+    if (current_file != NULL && current_file->filepath && !system &&
+        mode == KEFIR_PREPROCESSOR_SOURCE_LOCATOR_MODE_NORMAL) {
+        REQUIRE_OK(current_file_directory(mem, locator, current_file, &current_directory));
+    }
+    const char *base_include_dir = NULL;
+    if (mode == KEFIR_PREPROCESSOR_SOURCE_LOCATOR_MODE_NEXT && current_file != NULL) {
+        base_include_dir = current_file->base_include_dir;
+    }
+
+    const char *key;
+    REQUIRE_OK(include_resolution_key(mem, locator, filepath, system, current_directory, base_include_dir, &key));
+    kefir_hashtable_value_t table_value;
+    kefir_result_t res = kefir_hashtable_at(&locator->include_resolutions, (kefir_hashtable_key_t) key, &table_value);
+    if (res != KEFIR_NOT_FOUND) {
+        REQUIRE_OK(res);
+        ASSIGN_DECL_CAST(const struct include_resolution *, resolution, table_value);
+        REQUIRE(resolution->filepath != NULL,
+                KEFIR_SET_ERRORF(KEFIR_NOT_FOUND, "Unable to find requested include file %s", filepath));
+        REQUIRE_OK(open_file(mem, resolution->root, resolution->filepath, system, source_file, locator->symbols));
+        return KEFIR_OK;
+    }
+
+    res = search_source(mem, locator, filepath, system, current_directory, base_include_dir, source_file);
+    if (res != KEFIR_NOT_FOUND) {
+        REQUIRE_OK(res);
+    }
+
+    struct include_resolution *resolution = KEFIR_MALLOC(mem, sizeof(struct include_resolution));
+    REQUIRE_ELSE(resolution != NULL, {
+        if (res == KEFIR_OK) {
+            source_file->close(mem, source_file);
+        }
+        return KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate include resolution");
+    });
+    resolution->root = res == KEFIR_OK ? source_file->info.base_include_dir : NULL;
+    resolution->filepath = res == KEFIR_OK ? source_file->info.filepath : NULL;
+    kefir_result_t insert_res = kefir_hashtable_insert(mem, &locator->include_resolutions, (kefir_hashtable_key_t) key,
+                                                       (kefir_hashtable_value_t) resolution);
+    REQUIRE_ELSE(insert_res == KEFIR_OK, {
+        KEFIR_FREE(mem, resolution);
+        if (res == KEFIR_OK) {
+            source_file->close(mem, source_file);
+        }
+        return insert_res;
+    });
+    return res;
+}
+
 struct embed_file_data {
     char *data;
     kefir_size_t length;
@@ -218,6 +410,24 @@ static kefir_result_t embed_read_next(struct kefir_mem *mem, struct kefir_prepro
     return KEFIR_OK;
 }
 
+static kefir_result_t embed_read_bulk(struct kefir_mem *mem, struct kefir_preprocessor_embed_file *embed_file,
+                                      kefir_size_t limit, const kefir_uint8_t **content_ptr,
+                                      kefir_size_t *length_ptr) {
+    UNUSED(mem);
+    REQUIRE(embed_file != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid embed file"));
+    REQUIRE(content_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to embed content"));
+    REQUIRE(length_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to embed length"));
+
+    ASSIGN_DECL_CAST(struct embed_file_data *, file_data, embed_file->payload);
+    REQUIRE(file_data != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Embed file reader has already been closed"));
+
+    const kefir_size_t length = MIN(limit, file_data->length - file_data->index);
+    *content_ptr = (const kefir_uint8_t *) file_data->data + file_data->index;
+    *length_ptr = length;
+    file_data->index += length;
+    return KEFIR_OK;
+}
+
 static kefir_result_t embed_close(struct kefir_mem *mem, struct kefir_preprocessor_embed_file *embed_file) {
     UNUSED(mem);
     REQUIRE(embed_file != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid embed file"));
@@ -269,6 +479,7 @@ static kefir_result_t open_embed_file(struct kefir_mem *mem, const char *root, c
     embed_file->info.system = system;
     embed_file->info.base_include_dir = root;
     embed_file->read_next = embed_read_next;
+    embed_file->read_bulk = embed_read_bulk;
     embed_file->close = embed_close;
     embed_file->payload = file_data;
     return KEFIR_OK;
@@ -277,6 +488,10 @@ static kefir_result_t open_embed_file(struct kefir_mem *mem, const char *root, c
 static kefir_result_t try_open_embed(struct kefir_mem *mem, const char *root, const char *filepath, kefir_bool_t system,
                                      struct kefir_preprocessor_embed_file *embed_file,
                                      struct kefir_preprocessor_filesystem_source_locator *locator) {
+    kefir_bool_t may_contain;
+    REQUIRE_OK(directory_may_contain(mem, locator, root, filepath, &may_contain));
+    REQUIRE(may_contain, KEFIR_SET_ERROR(KEFIR_NOT_FOUND, "Cannot find requested file"));
+
     kefir_size_t path_length = root != NULL ? strlen(root) + strlen(filepath) + 2 : strlen(filepath) + 1;
 
     char *path = KEFIR_MALLOC(mem, path_length);
@@ -296,7 +511,7 @@ static kefir_result_t try_open_embed(struct kefir_mem *mem, const char *root, co
         return KEFIR_SET_OS_ERROR("Failed to determine real path");
     }
     kefir_result_t res = open_embed_file(mem, root, resolved_path, system, embed_file, locator->symbols);
-    KEFIR_FREE(mem, resolved_path);
+    free(resolved_path);
     if (res != KEFIR_NOT_FOUND) {
         REQUIRE_OK(res);
         return KEFIR_OK;
@@ -317,23 +532,10 @@ static kefir_result_t open_embed(struct kefir_mem *mem, const struct kefir_prepr
     ASSIGN_DECL_CAST(struct kefir_preprocessor_filesystem_source_locator *, locator, source_locator);
 
     if (current_file != NULL && current_file->filepath && !system) {
-        char *current_clone = KEFIR_MALLOC(mem, strlen(current_file->filepath) + 1);
-        REQUIRE(current_clone != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate directory name"));
-        strcpy(current_clone, current_file->filepath);
-        char *directory = dirname(current_clone);
-        REQUIRE_ELSE(directory != NULL, {
-            KEFIR_FREE(mem, current_clone);
-            return KEFIR_SET_OS_ERROR("Failed to obtain dirname");
-        });
+        const char *current_directory;
+        REQUIRE_OK(current_file_directory(mem, locator, current_file, &current_directory));
 
-        const char *directory_copy = kefir_string_pool_insert(mem, locator->symbols, directory, NULL);
-        REQUIRE_ELSE(directory_copy != NULL, {
-            KEFIR_FREE(mem, current_clone);
-            return KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to insert directory path into symbol table");
-        });
-        KEFIR_FREE(mem, current_clone);
-
-        kefir_result_t res = try_open_embed(mem, directory_copy, filepath, system, embed_file, locator);
+        kefir_result_t res = try_open_embed(mem, current_directory, filepath, system, embed_file, locator);
         if (res != KEFIR_NOT_FOUND) {
             REQUIRE_OK(res);
             return KEFIR_OK;
@@ -372,6 +574,35 @@ static kefir_result_t free_include_directory_descr(struct kefir_mem *mem, struct
     return KEFIR_OK;
 }
 
+static kefir_result_t free_include_resolution(struct kefir_mem *mem, struct kefir_hashtable *table,
+                                              kefir_hashtable_key_t key, kefir_hashtable_value_t value,
+                                              void *payload) {
+    UNUSED(table);
+    UNUSED(key);
+    UNUSED(payload);
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    ASSIGN_DECL_CAST(struct include_resolution *, resolution, value);
+    REQUIRE(resolution != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid include resolution"));
+
+    KEFIR_FREE(mem, resolution);
+    return KEFIR_OK;
+}
+
+static kefir_result_t free_directory_listing(struct kefir_mem *mem, struct kefir_hashtable *table,
+                                             kefir_hashtable_key_t key, kefir_hashtable_value_t value, void *payload) {
+    UNUSED(table);
+    UNUSED(key);
+    UNUSED(payload);
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    ASSIGN_DECL_CAST(struct kefir_hashset *, listing, value);
+
+    if (listing != NULL) {
+        REQUIRE_OK(kefir_hashset_free(mem, listing));
+        KEFIR_FREE(mem, listing);
+    }
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_preprocessor_filesystem_source_locator_init(
     struct kefir_preprocessor_filesystem_source_locator *locator, struct kefir_string_pool *symbols) {
     REQUIRE(locator != NULL,
@@ -384,6 +615,11 @@ kefir_result_t kefir_preprocessor_filesystem_source_locator_init(
     REQUIRE_OK(kefir_list_on_remove(&locator->embed_roots, free_include_directory_descr, NULL));
     REQUIRE_OK(kefir_hashtreeset_init(&locator->include_root_set, &kefir_hashtree_str_ops));
     REQUIRE_OK(kefir_hashtreeset_init(&locator->embed_root_set, &kefir_hashtree_str_ops));
+    REQUIRE_OK(kefir_string_pool_init(&locator->cache_strings));
+    REQUIRE_OK(kefir_hashtable_init(&locator->include_resolutions, &kefir_hashtable_uint_ops));
+    REQUIRE_OK(kefir_hashtable_on_removal(&locator->include_resolutions, free_include_resolution, NULL));
+    REQUIRE_OK(kefir_hashtable_init(&locator->directory_listings, &kefir_hashtable_uint_ops));
+    REQUIRE_OK(kefir_hashtable_on_removal(&locator->directory_listings, free_directory_listing, NULL));
     locator->symbols = symbols;
     locator->locator.payload = &locator;
     locator->locator.open = open_source;
@@ -397,6 +633,9 @@ kefir_result_t kefir_preprocessor_filesystem_source_locator_free(
     REQUIRE(locator != NULL,
             KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to filesystem source locator"));
 
+    REQUIRE_OK(kefir_hashtable_free(mem, &locator->directory_listings));
+    REQUIRE_OK(kefir_hashtable_free(mem, &locator->include_resolutions));
+    REQUIRE_OK(kefir_string_pool_free(mem, &locator->cache_strings));
     REQUIRE_OK(kefir_hashtreeset_free(mem, &locator->include_root_set));
     REQUIRE_OK(kefir_hashtreeset_free(mem, &locator->embed_root_set));
     REQUIRE_OK(kefir_list_free(mem, &locator->include_roots));
@@ -18,7 +18,7 @@
     along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#define _POSIX_SOURCE
+#define _XOPEN_SOURCE 700
 #include "kefir/platform/process.h"
 #include "kefir/core/error.h"
 #include "kefir/core/util.h"
@@ -29,6 +29,7 @@
 #include <sys/wait.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <time.h>
 
 static kefir_bool_t process_is_fork = false;
 
@@ -91,6 +92,57 @@ kefir_result_t kefir_process_wait(struct kefir_process *process) {
     return KEFIR_OK;
 }
 
+kefir_result_t kefir_process_wait_any(struct kefir_process *const *processes, kefir_size_t length,
+                                      kefir_size_t *index_ptr) {
+    REQUIRE(processes != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid array of processes"));
+    REQUIRE(length > 0, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected non-empty array of processes"));
+    REQUIRE(index_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to process index"));
+
+    for (;;) {
+        for (kefir_size_t i = 0; i < length; i++) {
+            struct kefir_process *process = processes[i];
+            if (process == NULL || process->pid <= 0) {
+                continue;
+            }
+
+            int status;
+            int pid = waitpid(process->pid, &status, WNOHANG);
+            REQUIRE(pid != -1, KEFIR_SET_OS_ERROR("Failed to wait for process"));
+            if (pid == 0) {
+                continue;
+            }
+
+            if (WIFEXITED(status)) {
+                process->status.exited = true;
+                process->status.exit_code = WEXITSTATUS(status);
+                REQUIRE_OK(close_process(process));
+                *index_ptr = i;
+                return KEFIR_OK;
+            } else if (WIFSIGNALED(status)) {
+                process->status.terminated = true;
+                process->status.termination_signal = WTERMSIG(status);
+                REQUIRE_OK(close_process(process));
+                *index_ptr = i;
+                return KEFIR_OK;
+            }
+        }
+
+        // Block until some child changes state without reaping it, so that statuses of children not owned by the
+        // caller are left intact. If the child in question is not tracked, back off briefly instead of spinning on it.
+        siginfo_t info;
+        info.si_pid = 0;
+        REQUIRE(waitid(P_ALL, 0, &info, WEXITED | WNOWAIT) != -1, KEFIR_SET_OS_ERROR("Failed to wait for process"));
+        kefir_bool_t tracked = false;
+        for (kefir_size_t i = 0; !tracked && i < length; i++) {
+            tracked = processes[i] != NULL && processes[i]->pid == info.si_pid;
+        }
+        if (!tracked) {
+            struct timespec delay = {.tv_sec = 0, .tv_nsec = 1000000};
+            nanosleep(&delay, NULL);
+        }
+    }
+}
+
 kefir_result_t kefir_process_kill(struct kefir_process *process) {
     REQUIRE(process != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to process"));
     if (process->pid > 0) {
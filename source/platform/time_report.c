@@ -0,0 +1,436 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#define _XOPEN_SOURCE 700
+#include "kefir/platform/time_report.h"
+#include "kefir/core/util.h"
+#include "kefir/core/error.h"
+#include "kefir/core/os_error.h"
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+
+union allocation_header {
+    kefir_size_t size;
+    max_align_t align;
+};
+
+static void account_allocation(struct kefir_time_report *report, kefir_size_t size) {
+    report->memory.allocations++;
+    report->memory.allocated_bytes += size;
+    report->memory.live_bytes += size;
+    report->memory.watermark = MAX(report->memory.watermark, report->memory.live_bytes);
+    report->memory.peak_live_bytes = MAX(report->memory.peak_live_bytes, report->memory.live_bytes);
+}
+
+static void *report_malloc(struct kefir_mem *mem, kefir_size_t size) {
+    ASSIGN_DECL_CAST(struct kefir_time_report *, report, mem->data);
+    REQUIRE(size <= KEFIR_SIZE_MAX - sizeof(union allocation_header), NULL);
+    union allocation_header *header = KEFIR_MALLOC(report->underlying_mem, sizeof(union allocation_header) + size);
+    REQUIRE(header != NULL, NULL);
+    header->size = size;
+    account_allocation(report, size);
+    return header + 1;
+}
+
+static void *report_calloc(struct kefir_mem *mem, kefir_size_t num, kefir_size_t size) {
+    ASSIGN_DECL_CAST(struct kefir_time_report *, report, mem->data);
+    REQUIRE(size == 0 || num <= (KEFIR_SIZE_MAX - sizeof(union allocation_header)) / size, NULL);
+    const kefir_size_t total_size = num * size;
+    union allocation_header *header =
+        KEFIR_CALLOC(report->underlying_mem, 1, sizeof(union allocation_header) + total_size);
+    REQUIRE(header != NULL, NULL);
+    header->size = total_size;
+    account_allocation(report, total_size);
+    return header + 1;
+}
+
+static void report_free(struct kefir_mem *mem, void *ptr) {
+    ASSIGN_DECL_CAST(struct kefir_time_report *, report, mem->data);
+    if (ptr != NULL) {
+        union allocation_header *header = ((union allocation_header *) ptr) - 1;
+        report->memory.live_bytes -= header->size;
+        KEFIR_FREE(report->underlying_mem, header);
+    }
+}
+
+static void *report_realloc(struct kefir_mem *mem, void *ptr, kefir_size_t size) {
+    ASSIGN_DECL_CAST(struct kefir_time_report *, report, mem->data);
+    if (ptr == NULL) {
+        return report_malloc(mem, size);
+    }
+    if (size == 0) {
+        report_free(mem, ptr);
+        return NULL;
+    }
+    REQUIRE(size <= KEFIR_SIZE_MAX - sizeof(union allocation_header), NULL);
+
+    union allocation_header *header = ((union allocation_header *) ptr) - 1;
+    const kefir_size_t previous_size = header->size;
+    header = KEFIR_REALLOC(report->underlying_mem, header, sizeof(union allocation_header) + size);
+    REQUIRE(header != NULL, NULL);
+    header->size = size;
+    report->memory.live_bytes -= previous_size;
+    account_allocation(report, size);
+    return header + 1;
+}
+
+static kefir_result_t read_clocks(kefir_uint64_t *wall_time_ns, kefir_uint64_t *cpu_time_ns) {
+    struct timespec timestamp;
+    REQUIRE(clock_gettime(CLOCK_MONOTONIC, &timestamp) == 0, KEFIR_SET_OS_ERROR("Failed to read monotonic clock"));
+    *wall_time_ns = (kefir_uint64_t) timestamp.tv_sec * 1000000000ull + (kefir_uint64_t) timestamp.tv_nsec;
+    REQUIRE(clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &timestamp) == 0,
+            KEFIR_SET_OS_ERROR("Failed to read process CPU time clock"));
+    *cpu_time_ns = (kefir_uint64_t) timestamp.tv_sec * 1000000000ull + (kefir_uint64_t) timestamp.tv_nsec;
+    return KEFIR_OK;
+}
+
+static kefir_result_t free_entry(struct kefir_mem *mem, struct kefir_list *list, struct kefir_list_entry *entry,
+                                 void *payload) {
+    UNUSED(list);
+    UNUSED(payload);
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(entry != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid list entry"));
+
+    KEFIR_FREE(mem, entry->value);
+    return KEFIR_OK;
+}
+
+static kefir_result_t free_function(struct kefir_mem *mem, struct kefir_list *list, struct kefir_list_entry *entry,
+                                    void *payload) {
+    UNUSED(list);
+    UNUSED(payload);
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(entry != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid list entry"));
+    ASSIGN_DECL_CAST(struct kefir_time_report_function *, function, entry->value);
+
+    REQUIRE_OK(kefir_list_free(mem, &function->entries));
+    KEFIR_FREE(mem, function);
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_time_report_init(struct kefir_mem *mem, struct kefir_time_report *report) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(report != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to time report"));
+
+    report->allocator = (struct kefir_mem) {.malloc = report_malloc,
+                                            .calloc = report_calloc,
+                                            .realloc = report_realloc,
+                                            .free = report_free,
+                                            .data = report};
+    report->underlying_mem = mem;
+    memset(&report->memory, 0, sizeof(report->memory));
+    REQUIRE_OK(kefir_string_pool_init(&report->names));
+    REQUIRE_OK(kefir_list_init(&report->entries));
+    REQUIRE_OK(kefir_list_on_remove(&report->entries, free_entry, NULL));
+    REQUIRE_OK(kefir_list_init(&report->functions));
+    REQUIRE_OK(kefir_list_on_remove(&report->functions, free_function, NULL));
+    REQUIRE_OK(kefir_hashtree_init(&report->function_index, &kefir_hashtree_str_ops));
+    REQUIRE_OK(kefir_time_report_begin(report, &report->total));
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_time_report_free(struct kefir_mem *mem, struct kefir_time_report *report) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(report != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid time report"));
+
+    REQUIRE_OK(kefir_hashtree_free(mem, &report->function_index));
+    REQUIRE_OK(kefir_list_free(mem, &report->functions));
+    REQUIRE_OK(kefir_list_free(mem, &report->entries));
+    REQUIRE_OK(kefir_string_pool_free(mem, &report->names));
+    report->underlying_mem = NULL;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_time_report_begin(struct kefir_time_report *report, struct kefir_time_report_span *span) {
+    REQUIRE(span != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to time report span"));
+    REQUIRE(report != NULL, KEFIR_OK);
+
+    REQUIRE_OK(read_clocks(&span->wall_time_ns, &span->cpu_time_ns));
+    span->allocations = report->memory.allocations;
+    span->allocated_bytes = report->memory.allocated_bytes;
+    span->live_bytes = report->memory.live_bytes;
+    span->watermark = report->memory.watermark;
+    report->memory.watermark = report->memory.live_bytes;
+    return KEFIR_OK;
+}
+
+static kefir_result_t record_entry(struct kefir_mem *mem, struct kefir_list *entries,
+                                   kefir_time_report_category_t category, const char *name,
+                                   const struct kefir_time_report_metrics *metrics) {
+    struct kefir_time_report_entry *entry = NULL;
+    for (const struct kefir_list_entry *iter = kefir_list_head(entries); iter != NULL && entry == NULL;
+         kefir_list_next(&iter)) {
+        ASSIGN_DECL_CAST(struct kefir_time_report_entry *, candidate, iter->value);
+        if (candidate->category == category && strcmp(candidate->name, name) == 0) {
+            entry = candidate;
+        }
+    }
+
+    if (entry == NULL) {
+        entry = KEFIR_MALLOC(mem, sizeof(struct kefir_time_report_entry));
+        REQUIRE(entry != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate time report entry"));
+        entry->category = category;
+        entry->name = name;
+        memset(&entry->metrics, 0, sizeof(entry->metrics));
+        kefir_result_t res = kefir_list_insert_after(mem, entries, kefir_list_tail(entries), entry);
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            KEFIR_FREE(mem, entry);
+            return res;
+        });
+    }
+
+    entry->metrics.wall_time_ns += metrics->wall_time_ns;
+    entry->metrics.cpu_time_ns += metrics->cpu_time_ns;
+    entry->metrics.allocations += metrics->allocations;
+    entry->metrics.allocated_bytes += metrics->allocated_bytes;
+    entry->metrics.peak_bytes = MAX(entry->metrics.peak_bytes, metrics->peak_bytes);
+    return KEFIR_OK;
+}
+
+static kefir_result_t get_function(struct kefir_mem *mem, struct kefir_time_report *report, const char *name,
+                                   struct kefir_time_report_function **function_ptr) {
+    struct kefir_hashtree_node *node;
+    kefir_result_t res = kefir_hashtree_at(&report->function_index, (kefir_hashtree_key_t) name, &node);
+    if (res != KEFIR_NOT_FOUND) {
+        REQUIRE_OK(res);
+        *function_ptr = (struct kefir_time_report_function *) node->value;
+        return KEFIR_OK;
+    }
+
+    const char *function_name = kefir_string_pool_insert(mem, &report->names, name, NULL);
+    REQUIRE(function_name != NULL,
+            KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to insert function name into string pool"));
+    struct kefir_time_report_function *function = KEFIR_MALLOC(mem, sizeof(struct kefir_time_report_function));
+    REQUIRE(function != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate time report function"));
+    function->name = function_name;
+    res = kefir_list_init(&function->entries);
+    REQUIRE_CHAIN(&res, kefir_list_on_remove(&function->entries, free_entry, NULL));
+    REQUIRE_CHAIN(&res, kefir_list_insert_after(mem, &report->functions, kefir_list_tail(&report->functions),
+                                                function));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(mem, function);
+        return res;
+    });
+    REQUIRE_OK(kefir_hashtree_insert(mem, &report->function_index, (kefir_hashtree_key_t) function_name,
+                                     (kefir_hashtree_value_t) function));
+    *function_ptr = function;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_time_report_end(struct kefir_time_report *report, const struct kefir_time_report_span *span,
+                                     kefir_time_report_category_t category, const char *function_name,
+                                     const char *name) {
+    REQUIRE(span != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid time report span"));
+    REQUIRE(name != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid time report entry name"));
+    REQUIRE(report != NULL, KEFIR_OK);
+
+    kefir_uint64_t wall_time_ns, cpu_time_ns;
+    REQUIRE_OK(read_clocks(&wall_time_ns, &cpu_time_ns));
+    const struct kefir_time_report_metrics metrics = {
+        .wall_time_ns = wall_time_ns - span->wall_time_ns,
+        .cpu_time_ns = cpu_time_ns - span->cpu_time_ns,
+        .allocations = report->memory.allocations - span->allocations,
+        .allocated_bytes = report->memory.allocated_bytes - span->allocated_bytes,
+        .peak_bytes = report->memory.watermark - span->live_bytes};
+    report->memory.watermark = MAX(report->memory.watermark, span->watermark);
+
+    REQUIRE_OK(record_entry(report->underlying_mem, &report->entries, category, name, &metrics));
+    if (function_name != NULL) {
+        struct kefir_time_report_function *function;
+        REQUIRE_OK(get_function(report->underlying_mem, report, function_name, &function));
+        REQUIRE_OK(record_entry(report->underlying_mem, &function->entries, category, name, &metrics));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t total_metrics(const struct kefir_time_report *report,
+                                    struct kefir_time_report_metrics *metrics) {
+    kefir_uint64_t wall_time_ns, cpu_time_ns;
+    REQUIRE_OK(read_clocks(&wall_time_ns, &cpu_time_ns));
+    metrics->wall_time_ns = wall_time_ns - report->total.wall_time_ns;
+    metrics->cpu_time_ns = cpu_time_ns - report->total.cpu_time_ns;
+    metrics->allocations = report->memory.allocations - report->total.allocations;
+    metrics->allocated_bytes = report->memory.allocated_bytes - report->total.allocated_bytes;
+    metrics->peak_bytes = report->memory.peak_live_bytes;
+    return KEFIR_OK;
+}
+
+static kefir_result_t max_resident_set(kefir_size_t *max_rss_kib) {
+    struct rusage usage;
+    REQUIRE(getrusage(RUSAGE_SELF, &usage) == 0, KEFIR_SET_OS_ERROR("Failed to retrieve process resource usage"));
+    *max_rss_kib = (kefir_size_t) usage.ru_maxrss;
+    return KEFIR_OK;
+}
+
+static const char *category_title(kefir_time_report_category_t category) {
+    switch (category) {
+        case KEFIR_TIME_REPORT_PHASE:
+            return "Compiler phases";
+
+        case KEFIR_TIME_REPORT_OPTIMIZER_PASS:
+            return "Optimizer passes";
+
+        case KEFIR_TIME_REPORT_CODEGEN_STAGE:
+            return "Code generator stages";
+    }
+    return NULL;
+}
+
+static const char *category_key(kefir_time_report_category_t category) {
+    switch (category) {
+        case KEFIR_TIME_REPORT_PHASE:
+            return "phases";
+
+        case KEFIR_TIME_REPORT_OPTIMIZER_PASS:
+            return "optimizer_passes";
+
+        case KEFIR_TIME_REPORT_CODEGEN_STAGE:
+            return "codegen_stages";
+    }
+    return NULL;
+}
+
+static const kefir_time_report_category_t Categories[] = {
+    KEFIR_TIME_REPORT_PHASE, KEFIR_TIME_REPORT_OPTIMIZER_PASS, KEFIR_TIME_REPORT_CODEGEN_STAGE};
+
+static void format_metrics(FILE *output, kefir_size_t indent, const char *name,
+                           const struct kefir_time_report_metrics *metrics) {
+    fprintf(output, "%*s%-*s %12.3f %12.3f %12" KEFIR_SIZE_FMT " %14.1f %12.1f\n", (int) indent, "",
+            (int) (32 - indent), name, metrics->wall_time_ns / 1e6, metrics->cpu_time_ns / 1e6,
+            metrics->allocations, metrics->allocated_bytes / 1024.0, metrics->peak_bytes / 1024.0);
+}
+
+static void format_entries(FILE *output, kefir_size_t indent, const struct kefir_list *entries,
+                           kefir_time_report_category_t category) {
+    kefir_bool_t title = false;
+    for (const struct kefir_list_entry *iter = kefir_list_head(entries); iter != NULL; kefir_list_next(&iter)) {
+        ASSIGN_DECL_CAST(const struct kefir_time_report_entry *, entry, iter->value);
+        if (entry->category == category) {
+            if (!title) {
+                fprintf(output, "%*s%s\n", (int) indent, "", category_title(category));
+                title = true;
+            }
+            format_metrics(output, indent + 2, entry->name, &entry->metrics);
+        }
+    }
+}
+
+kefir_result_t kefir_time_report_format(const struct kefir_time_report *report, FILE *output) {
+    REQUIRE(report != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid time report"));
+    REQUIRE(output != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid output file"));
+
+    struct kefir_time_report_metrics total;
+    kefir_size_t max_rss_kib;
+    REQUIRE_OK(total_metrics(report, &total));
+    REQUIRE_OK(max_resident_set(&max_rss_kib));
+
+    fprintf(output, "%-32s %12s %12s %12s %14s %12s\n", "Time report", "wall ms", "cpu ms", "allocations",
+            "allocated KiB", "peak KiB");
+    for (kefir_size_t i = 0; i < sizeof(Categories) / sizeof(Categories[0]); i++) {
+        format_entries(output, 0, &report->entries, Categories[i]);
+    }
+
+    if (kefir_list_length(&report->functions) > 0) {
+        fprintf(output, "Functions\n");
+    }
+    for (const struct kefir_list_entry *iter = kefir_list_head(&report->functions); iter != NULL;
+         kefir_list_next(&iter)) {
+        ASSIGN_DECL_CAST(const struct kefir_time_report_function *, function, iter->value);
+        fprintf(output, "  %s\n", function->name);
+        for (kefir_size_t i = 0; i < sizeof(Categories) / sizeof(Categories[0]); i++) {
+            format_entries(output, 4, &function->entries, Categories[i]);
+        }
+    }
+
+    format_metrics(output, 0, "Total", &total);
+    fprintf(output, "Maximum resident set size: %" KEFIR_SIZE_FMT " KiB\n", max_rss_kib);
+    return KEFIR_OK;
+}
+
+static kefir_result_t format_metrics_json(struct kefir_json_output *json,
+                                          const struct kefir_time_report_metrics *metrics) {
+    REQUIRE_OK(kefir_json_output_object_key(json, "wall_time_ns"));
+    REQUIRE_OK(kefir_json_output_uinteger(json, metrics->wall_time_ns));
+    REQUIRE_OK(kefir_json_output_object_key(json, "cpu_time_ns"));
+    REQUIRE_OK(kefir_json_output_uinteger(json, metrics->cpu_time_ns));
+    REQUIRE_OK(kefir_json_output_object_key(json, "allocations"));
+    REQUIRE_OK(kefir_json_output_uinteger(json, metrics->allocations));
+    REQUIRE_OK(kefir_json_output_object_key(json, "allocated_bytes"));
+    REQUIRE_OK(kefir_json_output_uinteger(json, metrics->allocated_bytes));
+    REQUIRE_OK(kefir_json_output_object_key(json, "peak_bytes"));
+    REQUIRE_OK(kefir_json_output_uinteger(json, metrics->peak_bytes));
+    return KEFIR_OK;
+}
+
+static kefir_result_t format_entries_json(struct kefir_json_output *json, const struct kefir_list *entries) {
+    for (kefir_size_t i = 0; i < sizeof(Categories) / sizeof(Categories[0]); i++) {
+        REQUIRE_OK(kefir_json_output_object_key(json, category_key(Categories[i])));
+        REQUIRE_OK(kefir_json_output_array_begin(json));
+        for (const struct kefir_list_entry *iter = kefir_list_head(entries); iter != NULL; kefir_list_next(&iter)) {
+            ASSIGN_DECL_CAST(const struct kefir_time_report_entry *, entry, iter->value);
+            if (entry->category == Categories[i]) {
+                REQUIRE_OK(kefir_json_output_object_begin(json));
+                REQUIRE_OK(kefir_json_output_object_key(json, "name"));
+                REQUIRE_OK(kefir_json_output_string(json, entry->name));
+                REQUIRE_OK(format_metrics_json(json, &entry->metrics));
+                REQUIRE_OK(kefir_json_output_object_end(json));
+            }
+        }
+        REQUIRE_OK(kefir_json_output_array_end(json));
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_time_report_format_json(const struct kefir_time_report *report,
+                                             struct kefir_json_output *json) {
+    REQUIRE(report != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid time report"));
+    REQUIRE(json != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid json output"));
+
+    struct kefir_time_report_metrics total;
+    kefir_size_t max_rss_kib;
+    REQUIRE_OK(total_metrics(report, &total));
+    REQUIRE_OK(max_resident_set(&max_rss_kib));
+
+    REQUIRE_OK(kefir_json_output_object_begin(json));
+    REQUIRE_OK(kefir_json_output_object_key(json, "total"));
+    REQUIRE_OK(kefir_json_output_object_begin(json));
+    REQUIRE_OK(format_metrics_json(json, &total));
+    REQUIRE_OK(kefir_json_output_object_key(json, "max_resident_set_kib"));
+    REQUIRE_OK(kefir_json_output_uinteger(json, max_rss_kib));
+    REQUIRE_OK(kefir_json_output_object_end(json));
+    REQUIRE_OK(format_entries_json(json, &report->entries));
+    REQUIRE_OK(kefir_json_output_object_key(json, "functions"));
+    REQUIRE_OK(kefir_json_output_array_begin(json));
+    for (const struct kefir_list_entry *iter = kefir_list_head(&report->functions); iter != NULL;
+         kefir_list_next(&iter)) {
+        ASSIGN_DECL_CAST(const struct kefir_time_report_function *, function, iter->value);
+        REQUIRE_OK(kefir_json_output_object_begin(json));
+        REQUIRE_OK(kefir_json_output_object_key(json, "name"));
+        REQUIRE_OK(kefir_json_output_string(json, function->name));
+        REQUIRE_OK(format_entries_json(json, &function->entries));
+        REQUIRE_OK(kefir_json_output_object_end(json));
+    }
+    REQUIRE_OK(kefir_json_output_array_end(json));
+    REQUIRE_OK(kefir_json_output_object_end(json));
+    return KEFIR_OK;
+}
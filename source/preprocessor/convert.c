@@ -39,9 +39,9 @@ kefir_result_t kefir_preprocessor_token_convert(struct kefir_mem *mem, struct ke
             REQUIRE_OK(kefir_lexer_source_cursor_init(&cursor, src->identifier, strlen(src->identifier), ""));
             cursor.location = src->source_location;
 
-            kefir_result_t res =
-                kefir_lexer_scan_identifier_or_keyword(mem, &cursor, preprocessor->lexer.mode,
-                                                       preprocessor->lexer.symbols, &preprocessor->lexer.keywords, dst);
+            kefir_result_t res = kefir_lexer_scan_identifier_or_keyword(
+                mem, &cursor, preprocessor->lexer.mode, preprocessor->lexer.symbols, true,
+                preprocessor->lexer.standard_version, dst);
             if (res == KEFIR_NO_MATCH) {
                 res = KEFIR_SET_SOURCE_ERROR(KEFIR_LEXER_ERROR, &cursor.location, "Unexpected character in identifier");
             }
@@ -60,6 +60,7 @@ kefir_result_t kefir_preprocessor_token_convert(struct kefir_mem *mem, struct ke
         case KEFIR_TOKEN_STRING_LITERAL:
         case KEFIR_TOKEN_PUNCTUATOR:
         case KEFIR_TOKEN_PRAGMA:
+        case KEFIR_TOKEN_EMBED:
         case KEFIR_TOKEN_EXTENSION:
             REQUIRE_OK(kefir_token_copy(mem, dst, src));
             break;
@@ -72,6 +73,49 @@ kefir_result_t kefir_preprocessor_token_convert(struct kefir_mem *mem, struct ke
     return KEFIR_OK;
 }
 
+static kefir_bool_t embed_is_sole_initializer(const struct kefir_token_buffer *dst,
+                                               const struct kefir_token_buffer *src, kefir_size_t index) {
+    const kefir_size_t dst_length = kefir_token_buffer_length(dst);
+    REQUIRE(dst_length > 0, false);
+    const struct kefir_token *preceding_token = kefir_token_buffer_at(dst, dst_length - 1);
+    REQUIRE(preceding_token->klass == KEFIR_TOKEN_PUNCTUATOR &&
+                preceding_token->punctuator == KEFIR_PUNCTUATOR_LEFT_BRACE,
+            false);
+
+    const kefir_size_t src_length = kefir_token_buffer_length(src);
+    for (index++; index < src_length && kefir_token_buffer_at(src, index)->klass == KEFIR_TOKEN_PP_WHITESPACE;
+         index++)
+        ;
+    REQUIRE(index < src_length, false);
+    const struct kefir_token *following_token = kefir_token_buffer_at(src, index);
+    return following_token->klass == KEFIR_TOKEN_PUNCTUATOR &&
+           following_token->punctuator == KEFIR_PUNCTUATOR_RIGHT_BRACE;
+}
+
+static kefir_result_t expand_embed(struct kefir_mem *mem, struct kefir_token_allocator *token_allocator,
+                                   struct kefir_token_buffer *dst, const struct kefir_token *src_token) {
+    for (kefir_size_t i = 0; i < src_token->embed->length; i++) {
+        struct kefir_token token;
+        const struct kefir_token *allocated_token;
+        if (i > 0) {
+            REQUIRE_OK(kefir_token_new_punctuator(KEFIR_PUNCTUATOR_COMMA, &token));
+            token.source_location = src_token->source_location;
+            REQUIRE_OK(kefir_token_allocator_emplace(mem, token_allocator, &token, &allocated_token));
+            REQUIRE_OK(kefir_token_buffer_emplace(mem, dst, allocated_token));
+        }
+
+        REQUIRE_OK(kefir_token_new_constant_int(mem, src_token->embed->content[i], &token));
+        token.source_location = src_token->source_location;
+        kefir_result_t res = kefir_token_allocator_emplace(mem, token_allocator, &token, &allocated_token);
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            kefir_token_free(mem, &token);
+            return res;
+        });
+        REQUIRE_OK(kefir_token_buffer_emplace(mem, dst, allocated_token));
+    }
+    return KEFIR_OK;
+}
+
 kefir_result_t kefir_preprocessor_token_convert_buffer(struct kefir_mem *mem, struct kefir_preprocessor *preprocessor,
                                                        struct kefir_token_allocator *token_allocator,
                                                        struct kefir_token_buffer *dst,
@@ -133,6 +177,20 @@ kefir_result_t kefir_preprocessor_token_convert_buffer(struct kefir_mem *mem, st
                 REQUIRE_OK(kefir_token_buffer_emplace(mem, dst, allocated_token));
             } break;
 
+            case KEFIR_TOKEN_EMBED:
+                // Embedded resource is kept as a single token only when it constitutes the whole braced initializer,
+                // which is the only position where the parser is able to consume it at once.
+                if (embed_is_sole_initializer(dst, src, i)) {
+                    struct kefir_token *allocated_token;
+                    REQUIRE_OK(kefir_token_allocator_allocate_empty(mem, token_allocator, &allocated_token));
+                    REQUIRE_OK(kefir_preprocessor_token_convert(mem, preprocessor, allocated_token, src_token));
+                    REQUIRE_OK(kefir_token_buffer_emplace(mem, dst, allocated_token));
+                } else {
+                    REQUIRE_OK(expand_embed(mem, token_allocator, dst, src_token));
+                }
+                i++;
+                break;
+
             case KEFIR_TOKEN_PP_WHITESPACE:
                 // Skip whitespaces
                 i++;
@@ -73,6 +73,20 @@ kefir_result_t kefir_preprocessor_directive_scanner_skip_line(
     struct kefir_mem *mem, struct kefir_preprocessor_directive_scanner *directive_scanner) {
     struct kefir_token next_token;
     kefir_result_t scan_tokens = true;
+
+    // Lines without comments, literals, escapes or non-ASCII characters cannot produce tokens spanning past the line
+    // end, so they are skipped without tokenization when the tokenizer state cannot be affected
+    if (directive_scanner->tokenizer_context.state == KEFIR_PREPROCESSOR_TOKENIZER_NORMAL &&
+        directive_scanner->lexer->extensions == NULL && directive_scanner->lexer->context->newline == U'\n') {
+        const kefir_size_t plain_length =
+            kefir_lexer_source_cursor_find_ascii(directive_scanner->lexer->cursor, "\n/\"'");
+        if (kefir_lexer_source_cursor_at(directive_scanner->lexer->cursor, plain_length) == U'\n' &&
+            !kefir_lexer_source_cursor_ascii_contains(directive_scanner->lexer->cursor, plain_length, "__has_")) {
+            REQUIRE_OK(kefir_lexer_source_cursor_skip(directive_scanner->lexer->cursor, plain_length + 1));
+            scan_tokens = false;
+        }
+    }
+
     while (scan_tokens) {
         kefir_result_t res = kefir_preprocessor_tokenize_next(mem, directive_scanner->lexer,
                                                               &directive_scanner->tokenizer_context, &next_token);
@@ -392,15 +406,83 @@ static kefir_result_t next_embed(struct kefir_mem *mem, struct kefir_preprocesso
     return KEFIR_OK;
 }
 
+static kefir_result_t skip_logical_line(struct kefir_lexer_source_cursor *cursor) {
+    kefir_bool_t block_comment = false, line_comment = false;
+    kefir_char32_t literal_delimiter = U'\0';
+    for (kefir_char32_t chr = kefir_lexer_source_cursor_at(cursor, 0); chr != KEFIR_LEXER_SOURCE_CURSOR_EOF;
+         chr = kefir_lexer_source_cursor_at(cursor, 0)) {
+        if (block_comment) {
+            if (chr == U'*' && kefir_lexer_source_cursor_at(cursor, 1) == U'/') {
+                block_comment = false;
+                REQUIRE_OK(kefir_lexer_source_cursor_next(cursor, 1));
+            }
+        } else if (chr == U'\n') {
+            REQUIRE_OK(kefir_lexer_source_cursor_next(cursor, 1));
+            break;
+        } else if (line_comment) {
+            // Skip comment content
+        } else if (literal_delimiter != U'\0') {
+            if (chr == U'\\' && kefir_lexer_source_cursor_at(cursor, 1) != U'\n') {
+                REQUIRE_OK(kefir_lexer_source_cursor_next(cursor, 1));
+            } else if (chr == literal_delimiter) {
+                literal_delimiter = U'\0';
+            }
+        } else if (chr == U'/' && kefir_lexer_source_cursor_at(cursor, 1) == U'*') {
+            block_comment = true;
+            REQUIRE_OK(kefir_lexer_source_cursor_next(cursor, 1));
+        } else if (chr == U'/' && kefir_lexer_source_cursor_at(cursor, 1) == U'/') {
+            line_comment = true;
+        } else if (chr == U'\'' || chr == U'"') {
+            literal_delimiter = chr;
+        }
+        REQUIRE_OK(kefir_lexer_source_cursor_next(cursor, 1));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t defer_define_replacement_list(struct kefir_preprocessor_directive_scanner *directive_scanner,
+                                                    struct kefir_token_allocator *token_allocator,
+                                                    struct kefir_preprocessor_directive *directive) {
+    struct kefir_lexer_source_cursor *cursor = directive_scanner->lexer->cursor;
+    struct kefir_preprocessor_deferred_replacement *deferred_replacement =
+        &directive->define_directive.deferred_replacement;
+    REQUIRE_OK(kefir_lexer_source_cursor_save(cursor, &deferred_replacement->cursor_state));
+    deferred_replacement->content = cursor->content;
+    deferred_replacement->length = cursor->length;
+    deferred_replacement->token_allocator = token_allocator;
+    deferred_replacement->pending = true;
+
+    REQUIRE_OK(skip_logical_line(cursor));
+    directive_scanner->newline_flag = true;
+    return KEFIR_OK;
+}
+
 static kefir_result_t next_define_replacement_list(struct kefir_mem *mem,
                                                    struct kefir_preprocessor_directive_scanner *directive_scanner,
                                                    struct kefir_token_allocator *token_allocator,
                                                    struct kefir_preprocessor_directive *directive,
                                                    struct kefir_token *token) {
+    REQUIRE_OK(kefir_token_buffer_init(&directive->define_directive.replacement));
+    if (directive_scanner->context->defer_macro_replacement && token->klass == KEFIR_TOKEN_PP_WHITESPACE &&
+        !token->pp_whitespace.newline) {
+        // Source content outlives the preprocessor context, thus replacement list lexing can be postponed until
+        // the macro is actually used
+        kefir_result_t res = kefir_token_free(mem, token);
+        REQUIRE_CHAIN(&res, defer_define_replacement_list(directive_scanner, token_allocator, directive));
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            kefir_token_buffer_free(mem, &directive->define_directive.replacement);
+            return res;
+        });
+        return KEFIR_OK;
+    }
+
     if (token->klass == KEFIR_TOKEN_PP_WHITESPACE && !token->pp_whitespace.newline) {
-        REQUIRE_OK(skip_whitespaces(mem, directive_scanner, token));
+        kefir_result_t res = skip_whitespaces(mem, directive_scanner, token);
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            kefir_token_buffer_free(mem, &directive->define_directive.replacement);
+            return res;
+        });
     }
-    REQUIRE_OK(kefir_token_buffer_init(&directive->define_directive.replacement));
     kefir_result_t res;
     while (token->klass != KEFIR_TOKEN_SENTINEL &&
            (token->klass != KEFIR_TOKEN_PP_WHITESPACE || !token->pp_whitespace.newline)) {
@@ -495,7 +577,8 @@ static kefir_result_t scan_define_parameters(struct kefir_mem *mem,
     }
     REQUIRE(token->klass == KEFIR_TOKEN_PUNCTUATOR && token->punctuator == KEFIR_PUNCTUATOR_RIGHT_PARENTHESE,
             KEFIR_SET_SOURCE_ERROR(KEFIR_LEXER_ERROR, &token->source_location, "Expected right parenthese"));
-    REQUIRE_OK(skip_whitespaces(mem, directive_scanner, token));
+    REQUIRE_OK(
+        kefir_preprocessor_tokenize_next(mem, directive_scanner->lexer, &directive_scanner->tokenizer_context, token));
     return KEFIR_OK;
 }
 
@@ -518,6 +601,7 @@ static kefir_result_t next_define(struct kefir_mem *mem, struct kefir_preprocess
                                   struct kefir_token_allocator *token_allocator,
                                   struct kefir_preprocessor_directive *directive) {
     directive->type = KEFIR_PREPROCESSOR_DIRECTIVE_DEFINE;
+    directive->define_directive.deferred_replacement.pending = false;
 
     struct kefir_token token;
     REQUIRE_OK(skip_whitespaces(mem, directive_scanner, &token));
@@ -905,3 +989,67 @@ kefir_result_t kefir_preprocessor_directive_free(struct kefir_mem *mem,
     }
     return KEFIR_OK;
 }
+
+static kefir_result_t load_deferred_replacement_impl(struct kefir_mem *mem, struct kefir_lexer *lexer,
+                                                     struct kefir_token_allocator *token_allocator,
+                                                     struct kefir_token_buffer *replacement) {
+    struct kefir_preprocessor_tokenizer_context tokenizer_context;
+    REQUIRE_OK(kefir_preprocessor_tokenizer_context_init(&tokenizer_context));
+
+    kefir_bool_t leading_whitespace = true;
+    for (;;) {
+        struct kefir_token token;
+        REQUIRE_OK(kefir_preprocessor_tokenize_next(mem, lexer, &tokenizer_context, &token));
+        if (token.klass == KEFIR_TOKEN_SENTINEL ||
+            (token.klass == KEFIR_TOKEN_PP_WHITESPACE && token.pp_whitespace.newline)) {
+            REQUIRE_OK(kefir_token_free(mem, &token));
+            break;
+        }
+        if (leading_whitespace && token.klass == KEFIR_TOKEN_PP_WHITESPACE) {
+            REQUIRE_OK(kefir_token_free(mem, &token));
+            continue;
+        }
+        leading_whitespace = false;
+
+        const struct kefir_token *allocated_token;
+        kefir_result_t res = kefir_token_allocator_emplace(mem, token_allocator, &token, &allocated_token);
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            kefir_token_free(mem, &token);
+            return res;
+        });
+        REQUIRE_OK(kefir_token_buffer_emplace(mem, replacement, allocated_token));
+    }
+
+    while (kefir_token_buffer_length(replacement) > 0 &&
+           kefir_token_buffer_at(replacement, kefir_token_buffer_length(replacement) - 1)->klass ==
+               KEFIR_TOKEN_PP_WHITESPACE) {
+        REQUIRE_OK(kefir_token_buffer_pop(mem, replacement));
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_preprocessor_deferred_replacement_load(
+    struct kefir_mem *mem, struct kefir_lexer *lexer,
+    struct kefir_preprocessor_deferred_replacement *deferred_replacement, struct kefir_token_buffer *replacement) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(lexer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid lexer"));
+    REQUIRE(deferred_replacement != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid deferred replacement list"));
+    REQUIRE(replacement != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid token buffer"));
+    REQUIRE(deferred_replacement->pending, KEFIR_OK);
+
+    struct kefir_lexer_source_cursor cursor;
+    REQUIRE_OK(kefir_lexer_source_cursor_init(&cursor, deferred_replacement->content, deferred_replacement->length,
+                                              deferred_replacement->cursor_state.location.source));
+    REQUIRE_OK(kefir_lexer_source_cursor_restore(&cursor, &deferred_replacement->cursor_state));
+
+    struct kefir_lexer_source_cursor *const lexer_cursor = lexer->cursor;
+    lexer->cursor = &cursor;
+    kefir_result_t res =
+        load_deferred_replacement_impl(mem, lexer, deferred_replacement->token_allocator, replacement);
+    lexer->cursor = lexer_cursor;
+    REQUIRE_OK(res);
+
+    deferred_replacement->pending = false;
+    return KEFIR_OK;
+}
@@ -522,6 +522,17 @@ static kefir_result_t format_token(FILE *out, const struct kefir_token *token,
             REQUIRE_OK(format_pragma(out, token->pragma->pragma, token->pragma->pragma_param));
             break;
 
+        case KEFIR_TOKEN_EMBED:
+            for (kefir_size_t i = 0; i < token->embed->length; i++) {
+                if (i > 0 && i % 16 == 0 && ws_format == KEFIR_PREPROCESSOR_WHITESPACE_FORMAT_ORIGINAL) {
+                    fprintf(out, ",\n");
+                } else if (i > 0) {
+                    fprintf(out, ", ");
+                }
+                fprintf(out, "%" KEFIR_UINT8_FMT, token->embed->content[i]);
+            }
+            break;
+
         case KEFIR_TOKEN_PP_WHITESPACE:
             if (token->pp_whitespace.newline && ws_format == KEFIR_PREPROCESSOR_WHITESPACE_FORMAT_ORIGINAL) {
                 fprintf(out, "\n");
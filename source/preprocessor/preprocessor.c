@@ -59,11 +59,14 @@ kefir_result_t kefir_preprocessor_context_init(struct kefir_mem *mem, struct kef
     REQUIRE_OK(kefir_preprocessor_user_macro_scope_init(NULL, &context->user_macros));
     REQUIRE_OK(kefir_hashtree_init(&context->undefined_macros, &kefir_hashtree_str_ops));
     REQUIRE_OK(kefir_hashtreeset_init(&context->include_once, &kefir_hashtree_str_ops));
+    REQUIRE_OK(kefir_hashtree_init(&context->include_guards, &kefir_hashtree_str_ops));
+    REQUIRE_OK(kefir_token_macro_expansions_pool_init(&context->macro_expansions));
     REQUIRE_OK(kefir_hashtreeset_init(&context->builltin_prefixes, &kefir_hashtree_str_ops));
     context->source_locator = locator;
     context->ast_context = ast_context;
     context->parser_scope = NULL;
     context->warning_output = stderr;
+    context->defer_macro_replacement = false;
 
     // Predefined macros
     context->environment.timestamp = time(NULL);
@@ -139,6 +142,8 @@ kefir_result_t kefir_preprocessor_context_free(struct kefir_mem *mem, struct kef
     context->extensions_payload = NULL;
 
     REQUIRE_OK(kefir_hashtreeset_free(mem, &context->builltin_prefixes));
+    REQUIRE_OK(kefir_token_macro_expansions_pool_free(mem, &context->macro_expansions));
+    REQUIRE_OK(kefir_hashtree_free(mem, &context->include_guards));
     REQUIRE_OK(kefir_hashtreeset_free(mem, &context->include_once));
     REQUIRE_OK(kefir_hashtree_free(mem, &context->environment.supported_std_attributes));
     REQUIRE_OK(kefir_hashtreeset_free(mem, &context->environment.supported_gnu_attributes));
@@ -189,6 +194,8 @@ kefir_result_t kefir_preprocessor_init(struct kefir_mem *mem, struct kefir_prepr
     preprocessor->current_file = current_file;
     preprocessor->parent = NULL;
     preprocessor->mode = KEFIR_PREPROCESSOR_MODE_NORMAL;
+    preprocessor->include_guard.state = KEFIR_PREPROCESSOR_INCLUDE_GUARD_START;
+    preprocessor->include_guard.macro = NULL;
 
     preprocessor->extensions = extensions;
     preprocessor->extension_payload = NULL;
@@ -402,6 +409,44 @@ kefir_result_t kefir_preprocessor_construct_system_header_name_from_buffer(struc
     return KEFIR_OK;
 }
 
+static kefir_result_t is_include_guarded(struct kefir_preprocessor *preprocessor, const char *filepath,
+                                         kefir_bool_t *guarded) {
+    *guarded = false;
+
+    struct kefir_hashtree_node *node;
+    kefir_result_t res =
+        kefir_hashtree_at(&preprocessor->context->include_guards, (kefir_hashtree_key_t) filepath, &node);
+    if (res == KEFIR_NOT_FOUND) {
+        return KEFIR_OK;
+    }
+    REQUIRE_OK(res);
+
+    // Contents of the file are skipped entirely for as long as the guard macro is defined
+    const struct kefir_preprocessor_macro *macro = NULL;
+    res = preprocessor->macros->locate(preprocessor->macros, (const char *) node->value, &macro);
+    if (res != KEFIR_NOT_FOUND) {
+        REQUIRE_OK(res);
+        *guarded = true;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t append_include_newline(struct kefir_mem *mem, struct kefir_token_allocator *token_allocator,
+                                             struct kefir_token_buffer *buffer,
+                                             const struct kefir_preprocessor_directive *directive) {
+    const kefir_size_t buffer_length = kefir_token_buffer_length(buffer);
+    const struct kefir_token *buffer_tail = buffer_length > 0 ? kefir_token_buffer_at(buffer, buffer_length - 1) : NULL;
+    if (buffer_tail == NULL || buffer_tail->klass != KEFIR_TOKEN_PP_WHITESPACE || !buffer_tail->pp_whitespace.newline) {
+        struct kefir_token *newline_token;
+        REQUIRE_OK(kefir_token_allocator_allocate_empty(mem, token_allocator, &newline_token));
+        REQUIRE_OK(kefir_token_new_pp_whitespace(true, newline_token));
+        newline_token->source_location =
+            buffer_tail != NULL ? buffer_tail->source_location : directive->source_location;
+        REQUIRE_OK(kefir_token_buffer_emplace(mem, buffer, newline_token));
+    }
+    return KEFIR_OK;
+}
+
 static kefir_result_t process_include(struct kefir_mem *mem, struct kefir_preprocessor *preprocessor,
                                       struct kefir_token_allocator *token_allocator, struct kefir_token_buffer *buffer,
                                       struct kefir_preprocessor_directive *directive) {
@@ -439,8 +484,20 @@ static kefir_result_t process_include(struct kefir_mem *mem, struct kefir_prepro
         return KEFIR_OK;
     }
 
+    kefir_bool_t guarded;
+    kefir_result_t res = is_include_guarded(preprocessor, source_file.info.filepath, &guarded);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        source_file.close(mem, &source_file);
+        return res;
+    });
+    if (guarded) {
+        REQUIRE_OK(source_file.close(mem, &source_file));
+        REQUIRE_OK(append_include_newline(mem, token_allocator, buffer, directive));
+        return KEFIR_OK;
+    }
+
     struct kefir_preprocessor subpreprocessor;
-    kefir_result_t res = kefir_preprocessor_init(mem, &subpreprocessor, preprocessor->lexer.symbols,
+    res = kefir_preprocessor_init(mem, &subpreprocessor, preprocessor->lexer.symbols,
                                                  &source_file.cursor, preprocessor->lexer.context,
                                                  preprocessor->context, &source_file.info, preprocessor->extensions);
     REQUIRE_ELSE(res == KEFIR_OK, {
@@ -461,22 +518,44 @@ static kefir_result_t process_include(struct kefir_mem *mem, struct kefir_prepro
         return res;
     });
 
+    if (subpreprocessor.include_guard.state == KEFIR_PREPROCESSOR_INCLUDE_GUARD_CLOSED) {
+        res = kefir_hashtree_insert(mem, &preprocessor->context->include_guards,
+                                    (kefir_hashtree_key_t) source_file.info.filepath,
+                                    (kefir_hashtree_value_t) subpreprocessor.include_guard.macro);
+        if (res == KEFIR_ALREADY_EXISTS) {
+            struct kefir_hashtree_node *node;
+            res = kefir_hashtree_at(&preprocessor->context->include_guards,
+                                    (kefir_hashtree_key_t) source_file.info.filepath, &node);
+            if (res == KEFIR_OK) {
+                node->value = (kefir_hashtree_value_t) subpreprocessor.include_guard.macro;
+            }
+        }
+        REQUIRE_ELSE(res == KEFIR_OK, {
+            kefir_preprocessor_free(mem, &subpreprocessor);
+            source_file.close(mem, &source_file);
+            return res;
+        });
+    }
+
     res = kefir_preprocessor_free(mem, &subpreprocessor);
     REQUIRE_ELSE(res == KEFIR_OK, {
         source_file.close(mem, &source_file);
         return res;
     });
     REQUIRE_OK(source_file.close(mem, &source_file));
+    REQUIRE_OK(append_include_newline(mem, token_allocator, buffer, directive));
+    return KEFIR_OK;
+}
 
-    const struct kefir_token *buffer_tail = buffer_length > 0 ? kefir_token_buffer_at(buffer, buffer_length - 1) : NULL;
-    if (buffer_tail == NULL || buffer_tail->klass != KEFIR_TOKEN_PP_WHITESPACE || !buffer_tail->pp_whitespace.newline) {
-        struct kefir_token *newline_token;
-        REQUIRE_OK(kefir_token_allocator_allocate_empty(mem, token_allocator, &newline_token));
-        REQUIRE_OK(kefir_token_new_pp_whitespace(true, newline_token));
-        newline_token->source_location =
-            buffer_tail != NULL ? buffer_tail->source_location : directive->source_location;
-        REQUIRE_OK(kefir_token_buffer_emplace(mem, buffer, newline_token));
-    }
+static kefir_result_t insert_embed_whitespace(struct kefir_mem *mem, struct kefir_token_allocator *token_allocator,
+                                              struct kefir_token_buffer *buffer, kefir_bool_t newline,
+                                              const struct kefir_source_location *source_location) {
+    struct kefir_token token;
+    const struct kefir_token *allocated_token;
+    REQUIRE_OK(kefir_token_new_pp_whitespace(newline, &token));
+    token.source_location = *source_location;
+    REQUIRE_OK(kefir_token_allocator_emplace(mem, token_allocator, &token, &allocated_token));
+    REQUIRE_OK(kefir_token_buffer_emplace(mem, buffer, allocated_token));
     return KEFIR_OK;
 }
 
@@ -485,49 +564,21 @@ static kefir_result_t do_embed(struct kefir_mem *mem, struct kefir_token_allocat
                                kefir_size_t limit, struct kefir_token_buffer *prefix_buffer,
                                struct kefir_token_buffer *suffix_buffer, struct kefir_token_buffer *if_empty_buffer,
                                const struct kefir_source_location *source_location) {
-    char buf[32];
-    struct kefir_token token;
-    const struct kefir_token *allocated_token;
-    kefir_size_t length = 0;
-    for (; length < limit; length++) {
-        kefir_bool_t eof;
-        kefir_uint8_t value;
-        REQUIRE_OK(embed_file->read_next(mem, embed_file, &value, &eof));
-        if (eof) {
-            break;
-        }
-
-        if (length > 0) {
-            REQUIRE_OK(kefir_token_new_punctuator(KEFIR_PUNCTUATOR_COMMA, &token));
-            token.source_location = *source_location;
-            REQUIRE_OK(kefir_token_allocator_emplace(mem, token_allocator, &token, &allocated_token));
-            REQUIRE_OK(kefir_token_buffer_emplace(mem, buffer, allocated_token));
+    // Embedded resource is represented by a single token regardless of its size. The token is expanded into a
+    // comma-separated sequence of integral constants only where the parser cannot consume it as a whole.
+    const kefir_uint8_t *content;
+    kefir_size_t length;
+    REQUIRE_OK(embed_file->read_bulk(mem, embed_file, limit, &content, &length));
 
-            REQUIRE_OK(kefir_token_new_pp_whitespace(length % 16 == 0, &token));
-            token.source_location = *source_location;
-            REQUIRE_OK(kefir_token_allocator_emplace(mem, token_allocator, &token, &allocated_token));
-            REQUIRE_OK(kefir_token_buffer_emplace(mem, buffer, allocated_token));
-        } else {
-            REQUIRE_OK(kefir_token_buffer_copy(mem, buffer, prefix_buffer));
-            if (kefir_token_buffer_length(prefix_buffer) > 0) {
-#define INSERT_WHITESPACE                                                                                   \
-    do {                                                                                                    \
-        REQUIRE_OK(kefir_token_new_pp_whitespace(false, &token));                                           \
-        token.source_location = *source_location;                                                           \
-        kefir_result_t res = kefir_token_allocator_emplace(mem, token_allocator, &token, &allocated_token); \
-        REQUIRE_ELSE(res == KEFIR_OK, {                                                                     \
-            kefir_token_free(mem, &token);                                                                  \
-            return res;                                                                                     \
-        });                                                                                                 \
-        REQUIRE_OK(kefir_token_buffer_emplace(mem, buffer, allocated_token));                               \
-    } while (0)
-                INSERT_WHITESPACE;
-            }
+    if (length > 0) {
+        REQUIRE_OK(kefir_token_buffer_copy(mem, buffer, prefix_buffer));
+        if (kefir_token_buffer_length(prefix_buffer) > 0) {
+            REQUIRE_OK(insert_embed_whitespace(mem, token_allocator, buffer, false, source_location));
         }
 
-        int len = snprintf(buf, sizeof(buf) - 1, "%" KEFIR_UINT8_FMT, value);
-
-        REQUIRE_OK(kefir_token_new_pp_number(mem, buf, len, &token));
+        struct kefir_token token;
+        const struct kefir_token *allocated_token;
+        REQUIRE_OK(kefir_token_new_embed(mem, content, length, &token));
         token.source_location = *source_location;
         kefir_result_t res = kefir_token_allocator_emplace(mem, token_allocator, &token, &allocated_token);
         REQUIRE_ELSE(res == KEFIR_OK, {
@@ -535,21 +586,16 @@ static kefir_result_t do_embed(struct kefir_mem *mem, struct kefir_token_allocat
             return res;
         });
         REQUIRE_OK(kefir_token_buffer_emplace(mem, buffer, allocated_token));
-    }
 
-    if (length > 0) {
         if (kefir_token_buffer_length(suffix_buffer) > 0) {
-            INSERT_WHITESPACE;
+            REQUIRE_OK(insert_embed_whitespace(mem, token_allocator, buffer, false, source_location));
         }
         REQUIRE_OK(kefir_token_buffer_copy(mem, buffer, suffix_buffer));
     } else {
         REQUIRE_OK(kefir_token_buffer_copy(mem, buffer, if_empty_buffer));
     }
 
-    REQUIRE_OK(kefir_token_new_pp_whitespace(true, &token));
-    token.source_location = *source_location;
-    REQUIRE_OK(kefir_token_allocator_emplace(mem, token_allocator, &token, &allocated_token));
-    REQUIRE_OK(kefir_token_buffer_emplace(mem, buffer, allocated_token));
+    REQUIRE_OK(insert_embed_whitespace(mem, token_allocator, buffer, true, source_location));
     return KEFIR_OK;
 }
 
@@ -768,6 +814,7 @@ static kefir_result_t process_define(struct kefir_mem *mem, struct kefir_preproc
         macro = kefir_preprocessor_user_macro_new_object(mem, preprocessor->lexer.symbols,
                                                          directive->define_directive.identifier);
         REQUIRE(macro != NULL, KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to allocate user macro"));
+        macro->deferred_replacement = directive->define_directive.deferred_replacement;
         kefir_result_t res =
             kefir_token_buffer_insert(mem, &macro->replacement, &directive->define_directive.replacement);
         REQUIRE_CHAIN(&res,
@@ -780,6 +827,7 @@ static kefir_result_t process_define(struct kefir_mem *mem, struct kefir_preproc
         macro = kefir_preprocessor_user_macro_new_function(mem, preprocessor->lexer.symbols,
                                                            directive->define_directive.identifier);
         REQUIRE(macro != NULL, KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to allocate user macro"));
+        macro->deferred_replacement = directive->define_directive.deferred_replacement;
         kefir_result_t res =
             kefir_token_buffer_insert(mem, &macro->replacement, &directive->define_directive.replacement);
         REQUIRE_CHAIN(&res, kefir_list_move_all(&macro->parameters, &directive->define_directive.parameters));
@@ -1196,6 +1244,50 @@ static kefir_result_t process_pragma(struct kefir_mem *mem, struct kefir_preproc
     return KEFIR_OK;
 }
 
+static kefir_result_t update_include_guard(struct kefir_preprocessor *preprocessor,
+                                           const struct kefir_preprocessor_directive *directive,
+                                           const struct kefir_list *condition_stack) {
+    // File is considered guarded when it consists of a single #ifndef group surrounded by whitespaces only
+    if (directive->type == KEFIR_PREPROCESSOR_DIRECTIVE_SENTINEL ||
+        directive->type == KEFIR_PREPROCESSOR_DIRECTIVE_EMPTY ||
+        (directive->type == KEFIR_PREPROCESSOR_DIRECTIVE_PP_TOKEN &&
+         directive->pp_token.klass == KEFIR_TOKEN_PP_WHITESPACE)) {
+        return KEFIR_OK;
+    }
+
+    switch (preprocessor->include_guard.state) {
+        case KEFIR_PREPROCESSOR_INCLUDE_GUARD_START:
+            if (directive->type == KEFIR_PREPROCESSOR_DIRECTIVE_IFNDEF) {
+                preprocessor->include_guard.state = KEFIR_PREPROCESSOR_INCLUDE_GUARD_OPEN;
+                preprocessor->include_guard.macro = directive->ifdef_directive.identifier;
+            } else {
+                preprocessor->include_guard.state = KEFIR_PREPROCESSOR_INCLUDE_GUARD_NONE;
+            }
+            break;
+
+        case KEFIR_PREPROCESSOR_INCLUDE_GUARD_OPEN:
+            if (kefir_list_length(condition_stack) == 0) {
+                preprocessor->include_guard.state = KEFIR_PREPROCESSOR_INCLUDE_GUARD_CLOSED;
+            } else if (kefir_list_length(condition_stack) == 1 &&
+                       (directive->type == KEFIR_PREPROCESSOR_DIRECTIVE_ELSE ||
+                        directive->type == KEFIR_PREPROCESSOR_DIRECTIVE_ELIF ||
+                        directive->type == KEFIR_PREPROCESSOR_DIRECTIVE_ELIFDEF ||
+                        directive->type == KEFIR_PREPROCESSOR_DIRECTIVE_ELIFNDEF)) {
+                preprocessor->include_guard.state = KEFIR_PREPROCESSOR_INCLUDE_GUARD_NONE;
+            }
+            break;
+
+        case KEFIR_PREPROCESSOR_INCLUDE_GUARD_CLOSED:
+            preprocessor->include_guard.state = KEFIR_PREPROCESSOR_INCLUDE_GUARD_NONE;
+            break;
+
+        case KEFIR_PREPROCESSOR_INCLUDE_GUARD_NONE:
+            // Intentionally left blank
+            break;
+    }
+    return KEFIR_OK;
+}
+
 static kefir_result_t run_directive(struct kefir_mem *mem, struct kefir_preprocessor *preprocessor,
                                     struct kefir_token_allocator *token_allocator, struct kefir_token_buffer *buffer,
                                     struct kefir_preprocessor_directive *directive, struct kefir_list *condition_stack,
@@ -1365,6 +1457,8 @@ static kefir_result_t run_directive(struct kefir_mem *mem, struct kefir_preproce
             // Intentionally left blank
             break;
     }
+
+    REQUIRE_OK(update_include_guard(preprocessor, directive, condition_stack));
     return KEFIR_OK;
 }
 
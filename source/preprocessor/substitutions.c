@@ -25,38 +25,72 @@
 #include "kefir/core/source_error.h"
 
 static kefir_result_t update_buffer_with_macro_expansions(struct kefir_mem *mem,
+                                                          struct kefir_preprocessor *preprocessor,
                                                           struct kefir_token_allocator *token_allocator,
                                                           struct kefir_token_buffer *src,
                                                           struct kefir_token_buffer *dst, const char *identifier,
                                                           const struct kefir_token_macro_expansions *macro_expansions) {
+    // Macro expansion sets are shared, so tokens with the same own expansions receive the same resulting set
+    const struct kefir_token_macro_expansions *last_token_expansions = NULL;
+    struct kefir_token_macro_expansions *last_expansions = NULL;
+    kefir_result_t res = KEFIR_OK;
     const kefir_size_t buffer_length = kefir_token_buffer_length(src);
-    for (kefir_size_t i = 0; i < buffer_length; i++) {
+    for (kefir_size_t i = 0; res == KEFIR_OK && i < buffer_length; i++) {
         struct kefir_token *dst_token;
         const struct kefir_token *token = kefir_token_buffer_at(src, i);
-        REQUIRE_OK(kefir_token_allocator_allocate_empty(mem, token_allocator, &dst_token));
-        REQUIRE_OK(kefir_token_copy(mem, dst_token, token));
-        REQUIRE_OK(kefir_token_macro_expansions_add(mem, &dst_token->macro_expansions, identifier));
-        REQUIRE_OK(kefir_token_macro_expansions_merge(mem, &dst_token->macro_expansions, macro_expansions));
-        REQUIRE_OK(kefir_token_buffer_emplace(mem, dst, dst_token));
+        res = kefir_token_allocator_allocate_empty(mem, token_allocator, &dst_token);
+        REQUIRE_CHAIN(&res, kefir_token_copy(mem, dst_token, token));
+        if (res == KEFIR_OK && (last_expansions == NULL || token->macro_expansions != last_token_expansions)) {
+            struct kefir_token_macro_expansions *expansions;
+            res = kefir_token_macro_expansions_pool_union(mem, &preprocessor->context->macro_expansions,
+                                                          token->macro_expansions, macro_expansions, identifier,
+                                                          &expansions);
+            if (res == KEFIR_OK) {
+                res = kefir_token_macro_expansions_release(mem, last_expansions);
+                last_token_expansions = token->macro_expansions;
+                last_expansions = expansions;
+            }
+        }
+        if (res == KEFIR_OK) {
+            res = kefir_token_macro_expansions_release(mem, dst_token->macro_expansions);
+            dst_token->macro_expansions = kefir_token_macro_expansions_retain(last_expansions);
+        }
+        REQUIRE_CHAIN(&res, kefir_token_buffer_emplace(mem, dst, dst_token));
     }
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_token_macro_expansions_release(mem, last_expansions);
+        return res;
+    });
+    REQUIRE_OK(kefir_token_macro_expansions_release(mem, last_expansions));
     return KEFIR_OK;
 }
 
+static const char *macro_expansion_identifier(struct kefir_mem *mem, struct kefir_preprocessor *preprocessor,
+                                              const struct kefir_preprocessor_macro *macro) {
+    // Macro expansion sets compare identifiers by address, therefore macro names are interned
+    if (preprocessor->lexer.symbols != NULL) {
+        return kefir_string_pool_insert(mem, preprocessor->lexer.symbols, macro->identifier, NULL);
+    } else {
+        return macro->identifier;
+    }
+}
+
 static kefir_result_t substitute_object_macro(struct kefir_mem *mem, struct kefir_preprocessor *preprocessor,
                                               struct kefir_token_allocator *token_allocator,
                                               struct kefir_preprocessor_token_sequence *seq,
                                               const struct kefir_preprocessor_macro *macro,
+                                              const char *macro_identifier,
                                               const struct kefir_token_macro_expansions *macro_expansions,
                                               const struct kefir_source_location *source_location) {
-    REQUIRE(!kefir_token_macro_expansions_has(macro_expansions, macro->identifier),
+    REQUIRE(!kefir_token_macro_expansions_has(macro_expansions, macro_identifier),
             KEFIR_SET_ERROR(KEFIR_NO_MATCH, "Unable to recursively substitute object macro"));
     struct kefir_token_buffer subst_buf, macro_expanded_buf;
     REQUIRE_OK(kefir_token_buffer_init(&subst_buf));
     REQUIRE_OK(kefir_token_buffer_init(&macro_expanded_buf));
     kefir_result_t res = macro->apply(mem, preprocessor, macro, preprocessor->lexer.symbols, NULL, token_allocator,
                                       &subst_buf, source_location);
-    REQUIRE_CHAIN(&res, update_buffer_with_macro_expansions(mem, token_allocator, &subst_buf, &macro_expanded_buf,
-                                                            macro->identifier, macro_expansions));
+    REQUIRE_CHAIN(&res, update_buffer_with_macro_expansions(mem, preprocessor, token_allocator, &subst_buf,
+                                                            &macro_expanded_buf, macro_identifier, macro_expansions));
     REQUIRE_CHAIN(&res, kefir_preprocessor_token_sequence_push_front(mem, seq, &macro_expanded_buf,
                                                                      KEFIR_PREPROCESSOR_TOKEN_DESTINATION_NORMAL));
     REQUIRE_ELSE(res == KEFIR_OK, {
@@ -138,7 +172,66 @@ static kefir_result_t prepare_function_macro_argument(struct kefir_mem *mem, str
     return KEFIR_OK;
 }
 
+static kefir_result_t emplace_embed_argument_token(struct kefir_mem *mem,
+                                                   struct kefir_token_allocator *token_allocator,
+                                                   struct kefir_token_buffer *buffer, struct kefir_token *token,
+                                                   const struct kefir_source_location *source_location) {
+    const struct kefir_token *allocated_token;
+    token->source_location = *source_location;
+    kefir_result_t res = kefir_token_allocator_emplace(mem, token_allocator, token, &allocated_token);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_token_free(mem, token);
+        return res;
+    });
+    REQUIRE_OK(kefir_token_buffer_emplace(mem, buffer, allocated_token));
+    return KEFIR_OK;
+}
+
+static kefir_result_t expand_embed_argument_impl(struct kefir_mem *mem, struct kefir_token_allocator *token_allocator,
+                                                 struct kefir_token_buffer *buffer,
+                                                 const struct kefir_embed_token *embed,
+                                                 const struct kefir_source_location *source_location) {
+    char buf[32];
+    struct kefir_token token;
+    for (kefir_size_t i = 0; i < embed->length; i++) {
+        if (i > 0) {
+            REQUIRE_OK(kefir_token_new_punctuator(KEFIR_PUNCTUATOR_COMMA, &token));
+            REQUIRE_OK(emplace_embed_argument_token(mem, token_allocator, buffer, &token, source_location));
+            REQUIRE_OK(kefir_token_new_pp_whitespace(i % 16 == 0, &token));
+            REQUIRE_OK(emplace_embed_argument_token(mem, token_allocator, buffer, &token, source_location));
+        }
+
+        int len = snprintf(buf, sizeof(buf) - 1, "%" KEFIR_UINT8_FMT, embed->content[i]);
+        REQUIRE_OK(kefir_token_new_pp_number(mem, buf, len, &token));
+        REQUIRE_OK(emplace_embed_argument_token(mem, token_allocator, buffer, &token, source_location));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t expand_embed_argument(struct kefir_mem *mem, struct kefir_token_allocator *token_allocator,
+                                            struct kefir_preprocessor_token_sequence *seq,
+                                            const struct kefir_token *embed_token) {
+    // Embedded resource within macro arguments is unfolded back into a comma-separated sequence of integral
+    // constants, so that it is split into macro arguments as if #embed produced the sequence directly.
+    const struct kefir_embed_token *embed = embed_token->embed;
+    const struct kefir_source_location source_location = embed_token->source_location;
+    REQUIRE_OK(kefir_preprocessor_token_sequence_next(mem, seq, NULL, NULL));
+
+    struct kefir_token_buffer buffer;
+    REQUIRE_OK(kefir_token_buffer_init(&buffer));
+    kefir_result_t res = expand_embed_argument_impl(mem, token_allocator, &buffer, embed, &source_location);
+    REQUIRE_CHAIN(&res, kefir_preprocessor_token_sequence_push_front(mem, seq, &buffer,
+                                                                     KEFIR_PREPROCESSOR_TOKEN_DESTINATION_NORMAL));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_token_buffer_free(mem, &buffer);
+        return res;
+    });
+    REQUIRE_OK(kefir_token_buffer_free(mem, &buffer));
+    return KEFIR_OK;
+}
+
 static kefir_result_t scan_function_macro_arguments(struct kefir_mem *mem,
+                                                    struct kefir_token_allocator *token_allocator,
                                                     struct kefir_preprocessor_token_sequence *seq,
                                                     struct kefir_list *args, kefir_size_t argc, kefir_bool_t vararg) {
     kefir_size_t nested_parens = 0;
@@ -188,6 +281,8 @@ static kefir_result_t scan_function_macro_arguments(struct kefir_mem *mem,
             }
         } else if (token->klass == KEFIR_TOKEN_SENTINEL) {
             scan_args = false;
+        } else if (token->klass == KEFIR_TOKEN_EMBED) {
+            REQUIRE_OK(expand_embed_argument(mem, token_allocator, seq, token));
         } else {
             REQUIRE_OK(function_macro_argument_buffer_append(mem, seq, args));
         }
@@ -213,7 +308,8 @@ static kefir_result_t scan_function_macro_arguments(struct kefir_mem *mem,
 static kefir_result_t apply_function_macro(struct kefir_mem *mem, struct kefir_preprocessor_token_sequence *seq,
                                            struct kefir_token_allocator *token_allocator,
                                            struct kefir_preprocessor *preprocessor,
-                                           const struct kefir_preprocessor_macro *macro, const struct kefir_list *args,
+                                           const struct kefir_preprocessor_macro *macro, const char *macro_identifier,
+                                           const struct kefir_list *args,
                                            const struct kefir_token_macro_expansions *macro_expansions,
                                            const struct kefir_source_location *source_location) {
     struct kefir_token_buffer subst_buf, macro_expanded_buf;
@@ -221,8 +317,8 @@ static kefir_result_t apply_function_macro(struct kefir_mem *mem, struct kefir_p
     REQUIRE_OK(kefir_token_buffer_init(&macro_expanded_buf));
     kefir_result_t res = macro->apply(mem, preprocessor, macro, preprocessor->lexer.symbols, args, token_allocator,
                                       &subst_buf, source_location);
-    REQUIRE_CHAIN(&res, update_buffer_with_macro_expansions(mem, token_allocator, &subst_buf, &macro_expanded_buf,
-                                                            macro->identifier, macro_expansions));
+    REQUIRE_CHAIN(&res, update_buffer_with_macro_expansions(mem, preprocessor, token_allocator, &subst_buf,
+                                                            &macro_expanded_buf, macro_identifier, macro_expansions));
     REQUIRE_CHAIN(&res, kefir_preprocessor_token_sequence_push_front(mem, seq, &macro_expanded_buf,
                                                                      KEFIR_PREPROCESSOR_TOKEN_DESTINATION_NORMAL));
     REQUIRE_ELSE(res == KEFIR_OK, {
@@ -243,6 +339,7 @@ static kefir_result_t substitute_function_macro_impl(struct kefir_mem *mem, stru
                                                      struct kefir_token_allocator *token_allocator,
                                                      struct kefir_preprocessor_token_sequence *seq,
                                                      const struct kefir_preprocessor_macro *macro,
+                                                     const char *macro_identifier,
                                                      const struct kefir_token_macro_expansions *macro_expansions,
                                                      const struct kefir_source_location *source_location) {
     kefir_size_t argc;
@@ -252,9 +349,9 @@ static kefir_result_t substitute_function_macro_impl(struct kefir_mem *mem, stru
     struct kefir_list arguments;
     REQUIRE_OK(kefir_list_init(&arguments));
     REQUIRE_OK(kefir_list_on_remove(&arguments, free_argument, NULL));
-    kefir_result_t res = scan_function_macro_arguments(mem, seq, &arguments, argc, vararg);
-    REQUIRE_CHAIN(&res, apply_function_macro(mem, seq, token_allocator, preprocessor, macro, &arguments,
-                                             macro_expansions, source_location));
+    kefir_result_t res = scan_function_macro_arguments(mem, token_allocator, seq, &arguments, argc, vararg);
+    REQUIRE_CHAIN(&res, apply_function_macro(mem, seq, token_allocator, preprocessor, macro, macro_identifier,
+                                             &arguments, macro_expansions, source_location));
     REQUIRE_ELSE(res == KEFIR_OK, {
         kefir_list_free(mem, &arguments);
         return res;
@@ -267,6 +364,7 @@ static kefir_result_t substitute_function_macro(struct kefir_mem *mem, struct ke
                                                 struct kefir_token_allocator *token_allocator,
                                                 struct kefir_preprocessor_token_sequence *seq,
                                                 const struct kefir_preprocessor_macro *macro,
+                                                const char *macro_identifier,
                                                 const struct kefir_source_location *source_location) {
     struct kefir_token_buffer buffer;
     REQUIRE_OK(kefir_token_buffer_init(&buffer));
@@ -280,9 +378,9 @@ static kefir_result_t substitute_function_macro(struct kefir_mem *mem, struct ke
 
     if (token != NULL && token->klass == KEFIR_TOKEN_PUNCTUATOR &&
         token->punctuator == KEFIR_PUNCTUATOR_LEFT_PARENTHESE &&
-        !kefir_token_macro_expansions_has(token->macro_expansions, macro->identifier)) {
+        !kefir_token_macro_expansions_has(token->macro_expansions, macro_identifier)) {
         res = kefir_token_buffer_free(mem, &buffer);
-        REQUIRE_OK(substitute_function_macro_impl(mem, preprocessor, token_allocator, seq, macro,
+        REQUIRE_OK(substitute_function_macro_impl(mem, preprocessor, token_allocator, seq, macro, macro_identifier,
                                                   token->macro_expansions, source_location));
     } else {
         kefir_result_t res = kefir_preprocessor_token_sequence_push_front(mem, seq, &buffer,
@@ -407,11 +505,15 @@ static kefir_result_t substitute_identifier(struct kefir_mem *mem, struct kefir_
             return KEFIR_OK;
         }
 
+        const char *macro_identifier = macro_expansion_identifier(mem, preprocessor, macro);
+        REQUIRE(macro_identifier != NULL,
+                KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to insert macro identifier into symbol table"));
         if (macro->type == KEFIR_PREPROCESSOR_MACRO_OBJECT) {
-            res = substitute_object_macro(mem, preprocessor, token_allocator, seq, macro, macro_expansions,
-                                          source_location);
+            res = substitute_object_macro(mem, preprocessor, token_allocator, seq, macro, macro_identifier,
+                                          macro_expansions, source_location);
         } else {
-            res = substitute_function_macro(mem, preprocessor, token_allocator, seq, macro, source_location);
+            res = substitute_function_macro(mem, preprocessor, token_allocator, seq, macro, macro_identifier,
+                                            source_location);
         }
 
         if (res == KEFIR_NO_MATCH && subst_context == KEFIR_PREPROCESSOR_SUBSTITUTION_IF_CONDITION) {
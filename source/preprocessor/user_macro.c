@@ -387,6 +387,9 @@ static kefir_result_t macro_concatenation_impl(struct kefir_mem *mem, struct kef
             case KEFIR_TOKEN_PRAGMA:
                 return KEFIR_SET_SOURCE_ERROR(KEFIR_LEXER_ERROR, &left->source_location, "Unexpected pragma");
 
+            case KEFIR_TOKEN_EMBED:
+                return KEFIR_SET_SOURCE_ERROR(KEFIR_LEXER_ERROR, &left->source_location, "Unexpected embed token");
+
             case KEFIR_TOKEN_STRING_LITERAL:
                 return KEFIR_SET_SOURCE_ERROR(KEFIR_LEXER_ERROR, &left->source_location,
                                               "Unexpected string literal token");
@@ -924,6 +927,7 @@ static kefir_result_t user_macro_apply(struct kefir_mem *mem, struct kefir_prepr
     REQUIRE(token_allocator != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid token allocator"));
     REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid token buffer"));
     ASSIGN_DECL_CAST(struct kefir_preprocessor_user_macro *, user_macro, macro->payload);
+    REQUIRE_OK(kefir_preprocessor_user_macro_load_replacement(mem, &preprocessor->lexer, user_macro));
 
     struct kefir_token_buffer inner_buffer;
     kefir_result_t res;
@@ -970,6 +974,8 @@ static kefir_result_t user_macro_format(const struct kefir_preprocessor *preproc
     REQUIRE(output != NULL,
             KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid preprocessor macro format output"));
     ASSIGN_DECL_CAST(struct kefir_preprocessor_user_macro *, user_macro, macro->payload);
+    REQUIRE(!user_macro->deferred_replacement.pending,
+            KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected preprocessor macro replacement list to be loaded"));
 
     fprintf(output, "#define %s", user_macro->macro.identifier);
     if (user_macro->macro.type == KEFIR_PREPROCESSOR_MACRO_FUNCTION) {
@@ -1020,6 +1026,7 @@ struct kefir_preprocessor_user_macro *kefir_preprocessor_user_macro_new_object(s
         return NULL;
     });
 
+    macro->deferred_replacement.pending = false;
     macro->macro.identifier = identifier;
     macro->macro.type = KEFIR_PREPROCESSOR_MACRO_OBJECT;
     macro->macro.payload = macro;
@@ -1056,6 +1063,7 @@ struct kefir_preprocessor_user_macro *kefir_preprocessor_user_macro_new_function
         return NULL;
     });
 
+    macro->deferred_replacement.pending = false;
     macro->macro.identifier = identifier;
     macro->macro.type = KEFIR_PREPROCESSOR_MACRO_FUNCTION;
     macro->vararg = false;
@@ -1085,6 +1093,19 @@ kefir_result_t kefir_preprocessor_user_macro_free(struct kefir_mem *mem, struct
     return KEFIR_OK;
 }
 
+kefir_result_t kefir_preprocessor_user_macro_load_replacement(struct kefir_mem *mem, struct kefir_lexer *lexer,
+                                                              struct kefir_preprocessor_user_macro *macro) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(lexer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid lexer"));
+    REQUIRE(macro != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid preprocessor macro"));
+
+    if (macro->deferred_replacement.pending) {
+        REQUIRE_OK(
+            kefir_preprocessor_deferred_replacement_load(mem, lexer, &macro->deferred_replacement, &macro->replacement));
+    }
+    return KEFIR_OK;
+}
+
 static kefir_result_t free_macro(struct kefir_mem *mem, struct kefir_hashtreeset *tree, kefir_hashtreeset_entry_t entry,
                                  void *payload) {
     UNUSED(tree);
@@ -1234,3 +1255,18 @@ kefir_result_t kefir_preprocessor_user_macro_scope_remove(struct kefir_mem *mem,
     }
     return KEFIR_OK;
 }
+
+kefir_result_t kefir_preprocessor_user_macro_scope_load_replacements(struct kefir_mem *mem, struct kefir_lexer *lexer,
+                                                                     struct kefir_preprocessor_user_macro_scope *scope) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(lexer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid lexer"));
+    REQUIRE(scope != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid preprocessor macro scope"));
+
+    struct kefir_hashtree_node_iterator iter;
+    for (struct kefir_hashtree_node *node = kefir_hashtree_iter(&scope->macro_index, &iter); node != NULL;
+         node = kefir_hashtree_next(&iter)) {
+        ASSIGN_DECL_CAST(struct kefir_preprocessor_user_macro *, macro, node->value);
+        REQUIRE_OK(kefir_preprocessor_user_macro_load_replacement(mem, lexer, macro));
+    }
+    return KEFIR_OK;
+}
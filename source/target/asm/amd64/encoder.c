@@ -0,0 +1,1887 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "kefir/target/asm/amd64/encoder.h"
+#include "kefir/core/error.h"
+#include "kefir/core/util.h"
+#include <string.h>
+
+// Machine code encoder for the subset of AMD64 instructions produced by the code generator. Encodings follow the
+// choices made by the GNU assembler for the equivalent AT&T syntax, so that objects produced by the integrated
+// assembler are byte-identical to the externally assembled ones. Operand forms outside of that subset are reported
+// as unsupported, and callers are expected to fall back to the external assembler.
+
+#define UNSUPPORTED(_msg) KEFIR_SET_ERROR(KEFIR_NOT_SUPPORTED, (_msg))
+
+typedef enum operand_kind {
+    OPERAND_NONE,
+    OPERAND_GP_REGISTER,
+    OPERAND_XMM_REGISTER,
+    OPERAND_FPU_REGISTER,
+    OPERAND_MEMORY,
+    OPERAND_IMMEDIATE,
+    OPERAND_TARGET
+} operand_kind_t;
+
+struct operand {
+    operand_kind_t kind;
+    kefir_size_t size;
+
+    struct {
+        kefir_uint8_t number;
+        kefir_bool_t high_byte;
+        kefir_bool_t requires_rex;
+    } reg;
+
+    struct {
+        kefir_bool_t fs_segment;
+        kefir_bool_t address_size_prefix;
+        kefir_bool_t rip_relative;
+        kefir_bool_t has_base;
+        kefir_uint8_t base;
+        kefir_bool_t has_index;
+        kefir_uint8_t index;
+        kefir_uint8_t scale;
+        kefir_int64_t displacement;
+        const char *symbol;
+        kefir_asm_amd64_xasmgen_symbol_relocation_t relocation;
+        kefir_bool_t has_pointer_type;
+        kefir_asm_amd64_xasmgen_pointer_type_t pointer_type;
+    } memory;
+
+    kefir_int64_t immediate;
+
+    struct {
+        const char *symbol;
+        kefir_asm_amd64_xasmgen_symbol_relocation_t relocation;
+        kefir_int64_t addend;
+    } target;
+};
+
+static const kefir_uint8_t LEGACY_REGISTER_NUMBERS[] = {0, 3, 1, 2, 6, 7, 4, 5};
+
+static kefir_result_t classify_register(kefir_asm_amd64_xasmgen_register_t reg, struct operand *operand) {
+    if (reg <= KEFIR_AMD64_XASMGEN_REGISTER_R15B) {
+        operand->kind = OPERAND_GP_REGISTER;
+        operand->size = 1;
+        switch (reg) {
+            case KEFIR_AMD64_XASMGEN_REGISTER_AL:
+                operand->reg.number = 0;
+                break;
+
+            case KEFIR_AMD64_XASMGEN_REGISTER_CL:
+                operand->reg.number = 1;
+                break;
+
+            case KEFIR_AMD64_XASMGEN_REGISTER_DL:
+                operand->reg.number = 2;
+                break;
+
+            case KEFIR_AMD64_XASMGEN_REGISTER_BL:
+                operand->reg.number = 3;
+                break;
+
+            case KEFIR_AMD64_XASMGEN_REGISTER_AH:
+                operand->reg.number = 4;
+                operand->reg.high_byte = true;
+                break;
+
+            case KEFIR_AMD64_XASMGEN_REGISTER_CH:
+                operand->reg.number = 5;
+                operand->reg.high_byte = true;
+                break;
+
+            case KEFIR_AMD64_XASMGEN_REGISTER_DH:
+                operand->reg.number = 6;
+                operand->reg.high_byte = true;
+                break;
+
+            case KEFIR_AMD64_XASMGEN_REGISTER_BH:
+                operand->reg.number = 7;
+                operand->reg.high_byte = true;
+                break;
+
+            case KEFIR_AMD64_XASMGEN_REGISTER_SPL:
+                operand->reg.number = 4;
+                operand->reg.requires_rex = true;
+                break;
+
+            case KEFIR_AMD64_XASMGEN_REGISTER_BPL:
+                operand->reg.number = 5;
+                operand->reg.requires_rex = true;
+                break;
+
+            case KEFIR_AMD64_XASMGEN_REGISTER_SIL:
+                operand->reg.number = 6;
+                operand->reg.requires_rex = true;
+                break;
+
+            case KEFIR_AMD64_XASMGEN_REGISTER_DIL:
+                operand->reg.number = 7;
+                operand->reg.requires_rex = true;
+                break;
+
+            default:
+                operand->reg.number = 8 + (reg - KEFIR_AMD64_XASMGEN_REGISTER_R8B);
+                break;
+        }
+    } else if (reg <= KEFIR_AMD64_XASMGEN_REGISTER_R15) {
+        kefir_size_t index;
+        if (reg <= KEFIR_AMD64_XASMGEN_REGISTER_R15W) {
+            operand->size = 2;
+            index = reg - KEFIR_AMD64_XASMGEN_REGISTER_AX;
+        } else if (reg <= KEFIR_AMD64_XASMGEN_REGISTER_R15D) {
+            operand->size = 4;
+            index = reg - KEFIR_AMD64_XASMGEN_REGISTER_EAX;
+        } else {
+            operand->size = 8;
+            index = reg - KEFIR_AMD64_XASMGEN_REGISTER_RAX;
+        }
+        operand->kind = OPERAND_GP_REGISTER;
+        operand->reg.number = index < 8 ? LEGACY_REGISTER_NUMBERS[index] : index;
+    } else if (reg <= KEFIR_AMD64_XASMGEN_REGISTER_XMM15) {
+        operand->kind = OPERAND_XMM_REGISTER;
+        operand->size = 16;
+        operand->reg.number = reg - KEFIR_AMD64_XASMGEN_REGISTER_XMM0;
+    } else {
+        return KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Unexpected AMD64 register");
+    }
+    return KEFIR_OK;
+}
+
+static kefir_size_t pointer_size(kefir_asm_amd64_xasmgen_pointer_type_t type) {
+    switch (type) {
+        case KEFIR_AMD64_XASMGEN_POINTER_BYTE:
+            return 1;
+
+        case KEFIR_AMD64_XASMGEN_POINTER_WORD:
+            return 2;
+
+        case KEFIR_AMD64_XASMGEN_POINTER_DWORD:
+        case KEFIR_AMD64_XASMGEN_POINTER_FP_SINGLE:
+            return 4;
+
+        case KEFIR_AMD64_XASMGEN_POINTER_QWORD:
+        case KEFIR_AMD64_XASMGEN_POINTER_FP_DOUBLE:
+            return 8;
+
+        case KEFIR_AMD64_XASMGEN_POINTER_TBYTE:
+            return 10;
+
+        case KEFIR_AMD64_XASMGEN_POINTER_XMMWORD:
+            return 16;
+    }
+    return 0;
+}
+
+static kefir_result_t classify_operand(const struct kefir_asm_amd64_xasmgen_operand *, kefir_bool_t, struct operand *);
+
+static kefir_result_t classify_memory(const struct kefir_asm_amd64_xasmgen_operand *op, struct operand *operand) {
+    REQUIRE_OK(classify_operand(op, false, operand));
+    if (operand->kind == OPERAND_IMMEDIATE) {
+        const kefir_int64_t address = operand->immediate;
+        memset(operand, 0, sizeof(struct operand));
+        operand->kind = OPERAND_MEMORY;
+        operand->memory.displacement = address;
+    }
+    REQUIRE(operand->kind == OPERAND_MEMORY, UNSUPPORTED("Expected memory operand"));
+    return KEFIR_OK;
+}
+
+static kefir_result_t classify_operand(const struct kefir_asm_amd64_xasmgen_operand *op, kefir_bool_t branch,
+                                       struct operand *operand) {
+    memset(operand, 0, sizeof(struct operand));
+    if (op == NULL) {
+        operand->kind = OPERAND_NONE;
+        return KEFIR_OK;
+    }
+
+    switch (op->klass) {
+        case KEFIR_AMD64_XASMGEN_OPERAND_IMMEDIATE:
+            operand->kind = OPERAND_IMMEDIATE;
+            operand->immediate = op->imm;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_IMMEDIATE_UNSIGNED:
+            operand->kind = OPERAND_IMMEDIATE;
+            operand->immediate = (kefir_int64_t) op->immu;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_REGISTER:
+            REQUIRE_OK(classify_register(op->reg, operand));
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_FPU_REGISTER:
+            REQUIRE(op->fpu_register < 8, UNSUPPORTED("Unexpected FPU stack register"));
+            operand->kind = OPERAND_FPU_REGISTER;
+            operand->reg.number = op->fpu_register;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_LABEL:
+            if (branch) {
+                operand->kind = OPERAND_TARGET;
+                operand->target.symbol = op->label.symbol;
+                operand->target.relocation = op->label.type;
+            } else {
+                operand->kind = OPERAND_MEMORY;
+                operand->memory.symbol = op->label.symbol;
+                operand->memory.relocation = op->label.type;
+            }
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_OFFSET:
+            REQUIRE_OK(classify_operand(op->offset.base, branch, operand));
+            if (operand->kind == OPERAND_TARGET) {
+                operand->target.addend += op->offset.offset;
+            } else if (operand->kind == OPERAND_MEMORY) {
+                operand->memory.displacement += op->offset.offset;
+            } else if (operand->kind == OPERAND_IMMEDIATE) {
+                operand->immediate += op->offset.offset;
+            } else {
+                return UNSUPPORTED("Unexpected offset operand base");
+            }
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_INDIRECTION: {
+            struct operand base;
+            REQUIRE_OK(classify_operand(op->indirection.base, false, &base));
+            if (base.kind == OPERAND_GP_REGISTER) {
+                REQUIRE(base.size == 8 || base.size == 4, UNSUPPORTED("Expected 64-bit or 32-bit base register"));
+                operand->kind = OPERAND_MEMORY;
+                operand->memory.address_size_prefix = base.size == 4;
+                operand->memory.has_base = true;
+                operand->memory.base = base.reg.number;
+            } else if (base.kind == OPERAND_MEMORY && !base.memory.has_base && !base.memory.has_index &&
+                       !base.memory.rip_relative && !base.memory.fs_segment) {
+                *operand = base;
+            } else {
+                return UNSUPPORTED("Unexpected indirection operand base");
+            }
+            operand->memory.displacement += op->indirection.displacement;
+
+            if (op->indirection.index.index != NULL) {
+                struct operand index;
+                REQUIRE_OK(classify_operand(op->indirection.index.index, false, &index));
+                REQUIRE(index.kind == OPERAND_GP_REGISTER && index.reg.number != 4 &&
+                            index.size == (operand->memory.address_size_prefix ? 4 : 8),
+                        UNSUPPORTED("Unexpected indirection operand index"));
+                const kefir_uint8_t scale = op->indirection.index.scale;
+                REQUIRE(scale == 1 || scale == 2 || scale == 4 || scale == 8,
+                        UNSUPPORTED("Unexpected indirection operand scale"));
+                operand->memory.has_index = true;
+                operand->memory.index = index.reg.number;
+                operand->memory.scale = scale == 1 ? 0 : (scale == 2 ? 1 : (scale == 4 ? 2 : 3));
+            }
+        } break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_RIP_INDIRECTION:
+            operand->kind = OPERAND_MEMORY;
+            operand->memory.rip_relative = true;
+            operand->memory.symbol = op->label.symbol;
+            operand->memory.relocation = op->label.type;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_SEGMENT:
+            REQUIRE(op->segment.segment == KEFIR_AMD64_XASMGEN_SEGMENT_FS, UNSUPPORTED("Unexpected segment register"));
+            REQUIRE_OK(classify_memory(op->segment.base, operand));
+            operand->memory.fs_segment = true;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_POINTER:
+            REQUIRE_OK(classify_memory(op->pointer.base, operand));
+            operand->size = pointer_size(op->pointer.type);
+            operand->memory.has_pointer_type = true;
+            operand->memory.pointer_type = op->pointer.type;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_STRING_LITERAL:
+        case KEFIR_AMD64_XASMGEN_OPERAND_SUBTRACT:
+            return UNSUPPORTED("Unexpected instruction operand");
+    }
+    return KEFIR_OK;
+}
+
+static kefir_bool_t fits_int8(kefir_int64_t value) {
+    return value >= -128 && value <= 127;
+}
+
+static kefir_bool_t fits_int32(kefir_int64_t value) {
+    return value >= (kefir_int64_t) KEFIR_INT32_MIN && value <= (kefir_int64_t) KEFIR_INT32_MAX;
+}
+
+// Truncates an immediate to the operand width and sign-extends it back
+static kefir_int64_t immediate_of_size(kefir_int64_t value, kefir_size_t size) {
+    switch (size) {
+        case 1:
+            return (kefir_int8_t) value;
+
+        case 2:
+            return (kefir_int16_t) value;
+
+        case 4:
+            return (kefir_int32_t) value;
+
+        default:
+            return value;
+    }
+}
+
+static kefir_result_t emit_byte(struct kefir_asm_amd64_encoded_instruction *out, kefir_uint8_t byte) {
+    REQUIRE(out->length < KEFIR_AMD64_ENCODER_MAX_INSTRUCTION_LENGTH, UNSUPPORTED("Instruction is too long"));
+    out->bytes[out->length++] = byte;
+    return KEFIR_OK;
+}
+
+static kefir_result_t emit_value(struct kefir_asm_amd64_encoded_instruction *out, kefir_int64_t value,
+                                 kefir_size_t width) {
+    for (kefir_size_t i = 0; i < width; i++) {
+        REQUIRE_OK(emit_byte(out, (kefir_uint8_t) (((kefir_uint64_t) value) >> (i * 8))));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t add_fixup(struct kefir_asm_amd64_encoded_instruction *out,
+                                kefir_asm_amd64_encoder_fixup_kind_t kind, const char *symbol,
+                                kefir_asm_amd64_xasmgen_symbol_relocation_t relocation, kefir_int64_t addend) {
+    REQUIRE(out->fixup_count < KEFIR_AMD64_ENCODER_MAX_FIXUPS, UNSUPPORTED("Too many instruction fixups"));
+    struct kefir_asm_amd64_encoder_fixup *fixup = &out->fixups[out->fixup_count++];
+    fixup->kind = kind;
+    fixup->offset = out->length;
+    fixup->symbol = symbol;
+    fixup->relocation = relocation;
+    fixup->relaxation = KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_NONE;
+    fixup->addend = addend;
+    return KEFIR_OK;
+}
+
+struct encoding {
+    kefir_bool_t operand_size_prefix;
+    kefir_uint8_t mandatory_prefix;
+    kefir_bool_t rex_w;
+    kefir_uint8_t opcode[4];
+    kefir_size_t opcode_length;
+
+    // ModR/M reg field: either register number or opcode extension
+    kefir_uint8_t reg;
+    kefir_bool_t reg_requires_rex;
+    kefir_bool_t reg_high_byte;
+
+    // ModR/M r/m operand, or NULL for instructions which encode register in the opcode
+    const struct operand *rm;
+
+    // Register encoded in the low bits of the last opcode byte
+    const struct operand *opcode_register;
+
+    kefir_size_t immediate_width;
+    kefir_int64_t immediate;
+};
+
+#define ENCODING_OPCODE1(_encoding, _op)        \
+    do {                                        \
+        (_encoding)->opcode[0] = (_op);         \
+        (_encoding)->opcode_length = 1;         \
+    } while (0)
+#define ENCODING_OPCODE2(_encoding, _op1, _op2) \
+    do {                                        \
+        (_encoding)->opcode[0] = (_op1);        \
+        (_encoding)->opcode[1] = (_op2);        \
+        (_encoding)->opcode_length = 2;         \
+    } while (0)
+
+static kefir_result_t encode(const struct encoding *encoding, struct kefir_asm_amd64_encoded_instruction *out) {
+    const struct operand *rm = encoding->rm;
+    const struct operand *opreg = encoding->opcode_register;
+
+    kefir_uint8_t rex = 0;
+    kefir_bool_t force_rex = encoding->reg_requires_rex;
+    kefir_bool_t high_byte = encoding->reg_high_byte;
+    if (encoding->rex_w) {
+        rex |= 0x8;
+    }
+    if (encoding->reg & 0x8) {
+        rex |= 0x4;
+    }
+    if (rm != NULL) {
+        if (rm->kind == OPERAND_MEMORY) {
+            if (rm->memory.has_index && (rm->memory.index & 0x8)) {
+                rex |= 0x2;
+            }
+            if (rm->memory.has_base && (rm->memory.base & 0x8)) {
+                rex |= 0x1;
+            }
+        } else {
+            if (rm->reg.number & 0x8) {
+                rex |= 0x1;
+            }
+            force_rex = force_rex || rm->reg.requires_rex;
+            high_byte = high_byte || rm->reg.high_byte;
+        }
+    }
+    if (opreg != NULL) {
+        if (opreg->reg.number & 0x8) {
+            rex |= 0x1;
+        }
+        force_rex = force_rex || opreg->reg.requires_rex;
+        high_byte = high_byte || opreg->reg.high_byte;
+    }
+    REQUIRE(!high_byte || (rex == 0 && !force_rex), UNSUPPORTED("High byte registers cannot be encoded with REX"));
+
+    if (rm != NULL && rm->kind == OPERAND_MEMORY && rm->memory.fs_segment) {
+        REQUIRE_OK(emit_byte(out, 0x64));
+    }
+    if (rm != NULL && rm->kind == OPERAND_MEMORY && rm->memory.address_size_prefix) {
+        REQUIRE_OK(emit_byte(out, 0x67));
+    }
+    if (encoding->operand_size_prefix) {
+        REQUIRE_OK(emit_byte(out, 0x66));
+    }
+    if (encoding->mandatory_prefix != 0) {
+        REQUIRE_OK(emit_byte(out, encoding->mandatory_prefix));
+    }
+    if (rex != 0 || force_rex) {
+        REQUIRE_OK(emit_byte(out, 0x40 | rex));
+    }
+    for (kefir_size_t i = 0; i < encoding->opcode_length; i++) {
+        kefir_uint8_t byte = encoding->opcode[i];
+        if (opreg != NULL && i + 1 == encoding->opcode_length) {
+            byte += opreg->reg.number & 0x7;
+        }
+        REQUIRE_OK(emit_byte(out, byte));
+    }
+
+    if (rm != NULL && rm->kind != OPERAND_MEMORY) {
+        REQUIRE_OK(emit_byte(out, 0xc0 | ((encoding->reg & 0x7) << 3) | (rm->reg.number & 0x7)));
+    } else if (rm != NULL) {
+        const kefir_uint8_t reg = (encoding->reg & 0x7) << 3;
+        kefir_int64_t displacement = rm->memory.displacement;
+        if (rm->memory.rip_relative) {
+            REQUIRE(rm->memory.symbol != NULL, UNSUPPORTED("Expected RIP-relative symbol"));
+            REQUIRE_OK(emit_byte(out, 0x05 | reg));
+            // Displacement is relative to the end of instruction, which follows the displacement and immediate
+            REQUIRE_OK(add_fixup(out, KEFIR_AMD64_ENCODER_FIXUP_RELATIVE32, rm->memory.symbol, rm->memory.relocation,
+                                 displacement - 4 - (kefir_int64_t) encoding->immediate_width));
+            REQUIRE_OK(emit_value(out, 0, 4));
+        } else if (!rm->memory.has_base) {
+            REQUIRE_OK(emit_byte(out, 0x04 | reg));
+            REQUIRE_OK(emit_byte(out, rm->memory.has_index
+                                          ? ((rm->memory.scale << 6) | ((rm->memory.index & 0x7) << 3) | 0x5)
+                                          : 0x25));
+            if (rm->memory.symbol != NULL) {
+                REQUIRE_OK(add_fixup(out, KEFIR_AMD64_ENCODER_FIXUP_ABSOLUTE32S, rm->memory.symbol,
+                                     rm->memory.relocation, displacement));
+                displacement = 0;
+            } else {
+                REQUIRE(fits_int32(displacement), UNSUPPORTED("Absolute address does not fit into 32 bits"));
+            }
+            REQUIRE_OK(emit_value(out, displacement, 4));
+        } else {
+            const kefir_uint8_t base = rm->memory.base & 0x7;
+            kefir_uint8_t mod;
+            if (rm->memory.symbol != NULL || !fits_int8(displacement)) {
+                REQUIRE(rm->memory.symbol != NULL || fits_int32(displacement),
+                        UNSUPPORTED("Displacement does not fit into 32 bits"));
+                mod = 0x80;
+            } else if (displacement == 0 && base != 5) {
+                mod = 0x00;
+            } else {
+                mod = 0x40;
+            }
+            if (rm->memory.has_index || base == 4) {
+                REQUIRE_OK(emit_byte(out, mod | reg | 0x04));
+                REQUIRE_OK(emit_byte(out, rm->memory.has_index
+                                              ? ((rm->memory.scale << 6) | ((rm->memory.index & 0x7) << 3) | base)
+                                              : (0x20 | base)));
+            } else {
+                REQUIRE_OK(emit_byte(out, mod | reg | base));
+            }
+            if (mod == 0x40) {
+                REQUIRE_OK(emit_value(out, displacement, 1));
+            } else if (mod == 0x80) {
+                if (rm->memory.symbol != NULL) {
+                    REQUIRE_OK(add_fixup(out, KEFIR_AMD64_ENCODER_FIXUP_ABSOLUTE32S, rm->memory.symbol,
+                                         rm->memory.relocation, displacement));
+                    displacement = 0;
+                }
+                REQUIRE_OK(emit_value(out, displacement, 4));
+            }
+        }
+    }
+
+    REQUIRE_OK(emit_value(out, encoding->immediate, encoding->immediate_width));
+    return KEFIR_OK;
+}
+
+static void encoding_set_reg(struct encoding *encoding, const struct operand *reg) {
+    encoding->reg = reg->reg.number;
+    encoding->reg_requires_rex = reg->reg.requires_rex;
+    encoding->reg_high_byte = reg->reg.high_byte;
+}
+
+static kefir_result_t encoding_set_size(struct encoding *encoding, kefir_size_t size) {
+    switch (size) {
+        case 1:
+        case 4:
+            break;
+
+        case 2:
+            encoding->operand_size_prefix = true;
+            break;
+
+        case 8:
+            encoding->rex_w = true;
+            break;
+
+        default:
+            return UNSUPPORTED("Unexpected operand size");
+    }
+    return KEFIR_OK;
+}
+
+static kefir_bool_t is_register_or_memory(const struct operand *operand) {
+    return operand->kind == OPERAND_GP_REGISTER || operand->kind == OPERAND_MEMORY;
+}
+
+static kefir_bool_t is_xmm_or_memory(const struct operand *operand) {
+    return operand->kind == OPERAND_XMM_REGISTER || operand->kind == OPERAND_MEMORY;
+}
+
+static kefir_bool_t is_accumulator(const struct operand *operand) {
+    return operand->kind == OPERAND_GP_REGISTER && operand->reg.number == 0 && !operand->reg.high_byte;
+}
+
+// Width of a general-purpose instruction inferred from its register operands or memory pointer type
+static kefir_result_t operand_size(const struct operand *op1, const struct operand *op2, kefir_size_t *size) {
+    if (op1->kind == OPERAND_GP_REGISTER) {
+        *size = op1->size;
+    } else if (op2 != NULL && op2->kind == OPERAND_GP_REGISTER) {
+        *size = op2->size;
+    } else if (op1->kind == OPERAND_MEMORY && op1->memory.has_pointer_type) {
+        *size = op1->size;
+    } else {
+        return UNSUPPORTED("Unable to determine instruction operand size");
+    }
+    REQUIRE(*size == 1 || *size == 2 || *size == 4 || *size == 8, UNSUPPORTED("Unexpected operand size"));
+    return KEFIR_OK;
+}
+
+static kefir_result_t immediate_for_size(kefir_int64_t immediate, kefir_size_t size, kefir_int64_t *value,
+                                         kefir_size_t *width) {
+    *value = immediate_of_size(immediate, size);
+    if (size == 8) {
+        REQUIRE(fits_int32(*value), UNSUPPORTED("Immediate does not fit into 32 bits"));
+        *width = 4;
+    } else {
+        *width = size;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t encode_alu(kefir_uint8_t digit, const struct operand *op1, const struct operand *op2,
+                                 struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    const kefir_uint8_t base = digit << 3;
+    kefir_size_t size;
+    REQUIRE(is_register_or_memory(op1), UNSUPPORTED("Unexpected instruction operands"));
+    REQUIRE_OK(operand_size(op1, op2, &size));
+    REQUIRE_OK(encoding_set_size(&encoding, size));
+
+    if (op2->kind == OPERAND_IMMEDIATE) {
+        kefir_int64_t value;
+        REQUIRE_OK(immediate_for_size(op2->immediate, size, &value, &encoding.immediate_width));
+        encoding.immediate = value;
+        if (size == 1) {
+            if (is_accumulator(op1)) {
+                ENCODING_OPCODE1(&encoding, base + 4);
+            } else {
+                ENCODING_OPCODE1(&encoding, 0x80);
+                encoding.reg = digit;
+                encoding.rm = op1;
+            }
+        } else if (fits_int8(value)) {
+            ENCODING_OPCODE1(&encoding, 0x83);
+            encoding.reg = digit;
+            encoding.rm = op1;
+            encoding.immediate_width = 1;
+        } else if (is_accumulator(op1)) {
+            ENCODING_OPCODE1(&encoding, base + 5);
+        } else {
+            ENCODING_OPCODE1(&encoding, 0x81);
+            encoding.reg = digit;
+            encoding.rm = op1;
+        }
+    } else if (op2->kind == OPERAND_GP_REGISTER) {
+        REQUIRE(op2->size == size, UNSUPPORTED("Mismatched operand sizes"));
+        ENCODING_OPCODE1(&encoding, base + (size == 1 ? 0 : 1));
+        encoding_set_reg(&encoding, op2);
+        encoding.rm = op1;
+    } else if (op2->kind == OPERAND_MEMORY && op1->kind == OPERAND_GP_REGISTER) {
+        ENCODING_OPCODE1(&encoding, base + (size == 1 ? 2 : 3));
+        encoding_set_reg(&encoding, op1);
+        encoding.rm = op2;
+    } else {
+        return UNSUPPORTED("Unexpected instruction operands");
+    }
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_mov(const struct operand *op1, const struct operand *op2,
+                                 struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    kefir_size_t size;
+    REQUIRE(is_register_or_memory(op1), UNSUPPORTED("Unexpected instruction operands"));
+    REQUIRE_OK(operand_size(op1, op2, &size));
+    REQUIRE_OK(encoding_set_size(&encoding, size));
+
+    if (op2->kind == OPERAND_IMMEDIATE && op1->kind == OPERAND_GP_REGISTER) {
+        const kefir_int64_t value = immediate_of_size(op2->immediate, size);
+        if (size == 8 && fits_int32(value)) {
+            ENCODING_OPCODE1(&encoding, 0xc7);
+            encoding.rm = op1;
+            encoding.immediate_width = 4;
+        } else {
+            ENCODING_OPCODE1(&encoding, size == 1 ? 0xb0 : 0xb8);
+            encoding.opcode_register = op1;
+            encoding.immediate_width = size;
+        }
+        encoding.immediate = value;
+    } else if (op2->kind == OPERAND_IMMEDIATE) {
+        ENCODING_OPCODE1(&encoding, size == 1 ? 0xc6 : 0xc7);
+        encoding.rm = op1;
+        REQUIRE_OK(immediate_for_size(op2->immediate, size, &encoding.immediate, &encoding.immediate_width));
+    } else if (op2->kind == OPERAND_GP_REGISTER) {
+        REQUIRE(op2->size == size, UNSUPPORTED("Mismatched operand sizes"));
+        ENCODING_OPCODE1(&encoding, size == 1 ? 0x88 : 0x89);
+        encoding_set_reg(&encoding, op2);
+        encoding.rm = op1;
+    } else if (op2->kind == OPERAND_MEMORY && op1->kind == OPERAND_GP_REGISTER) {
+        ENCODING_OPCODE1(&encoding, size == 1 ? 0x8a : 0x8b);
+        encoding_set_reg(&encoding, op1);
+        encoding.rm = op2;
+    } else {
+        return UNSUPPORTED("Unexpected instruction operands");
+    }
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_xchg(const struct operand *op1, const struct operand *op2,
+                                  struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    kefir_size_t size;
+    REQUIRE(is_register_or_memory(op1) && is_register_or_memory(op2) &&
+                (op1->kind == OPERAND_GP_REGISTER || op2->kind == OPERAND_GP_REGISTER),
+            UNSUPPORTED("Unexpected instruction operands"));
+    REQUIRE_OK(operand_size(op1, op2, &size));
+    REQUIRE_OK(encoding_set_size(&encoding, size));
+
+    if (op1->kind == OPERAND_GP_REGISTER && op2->kind == OPERAND_GP_REGISTER && size != 1 &&
+        (is_accumulator(op1) || is_accumulator(op2)) && !(size == 4 && is_accumulator(op1) && is_accumulator(op2))) {
+        ENCODING_OPCODE1(&encoding, 0x90);
+        encoding.opcode_register = is_accumulator(op1) ? op2 : op1;
+    } else if (op2->kind == OPERAND_GP_REGISTER) {
+        ENCODING_OPCODE1(&encoding, size == 1 ? 0x86 : 0x87);
+        encoding_set_reg(&encoding, op2);
+        encoding.rm = op1;
+    } else {
+        ENCODING_OPCODE1(&encoding, size == 1 ? 0x86 : 0x87);
+        encoding_set_reg(&encoding, op1);
+        encoding.rm = op2;
+    }
+    return encode(&encoding, out);
+}
+
+// Instructions with a register destination and register or memory source (reg <- r/m)
+static kefir_result_t encode_rm(kefir_uint8_t opcode1, kefir_uint8_t opcode2, kefir_size_t opcode_length,
+                                const struct operand *op1, const struct operand *op2,
+                                struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    REQUIRE(op1->kind == OPERAND_GP_REGISTER && is_register_or_memory(op2),
+            UNSUPPORTED("Unexpected instruction operands"));
+    REQUIRE(op1->size != 1, UNSUPPORTED("Unexpected operand size"));
+    REQUIRE(op2->kind != OPERAND_GP_REGISTER || op2->size == op1->size, UNSUPPORTED("Mismatched operand sizes"));
+    REQUIRE_OK(encoding_set_size(&encoding, op1->size));
+    encoding.opcode[0] = opcode1;
+    encoding.opcode[1] = opcode2;
+    encoding.opcode_length = opcode_length;
+    encoding_set_reg(&encoding, op1);
+    encoding.rm = op2;
+    return encode(&encoding, out);
+}
+
+// Instructions with register or memory destination and register source (r/m <- reg)
+static kefir_result_t encode_mr(kefir_uint8_t opcode8, kefir_uint8_t opcode, kefir_bool_t two_byte,
+                                const struct operand *op1, const struct operand *op2,
+                                struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    REQUIRE(is_register_or_memory(op1) && op2->kind == OPERAND_GP_REGISTER,
+            UNSUPPORTED("Unexpected instruction operands"));
+    REQUIRE(op1->kind != OPERAND_GP_REGISTER || op1->size == op2->size, UNSUPPORTED("Mismatched operand sizes"));
+    REQUIRE_OK(encoding_set_size(&encoding, op2->size));
+    if (two_byte) {
+        ENCODING_OPCODE2(&encoding, 0x0f, op2->size == 1 ? opcode8 : opcode);
+    } else {
+        ENCODING_OPCODE1(&encoding, op2->size == 1 ? opcode8 : opcode);
+    }
+    encoding_set_reg(&encoding, op2);
+    encoding.rm = op1;
+    return encode(&encoding, out);
+}
+
+// Instructions with single register or memory operand and opcode extension in ModR/M reg field
+static kefir_result_t encode_unary(kefir_uint8_t opcode8, kefir_uint8_t opcode, kefir_uint8_t digit,
+                                   const struct operand *op1, struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    kefir_size_t size;
+    REQUIRE(is_register_or_memory(op1), UNSUPPORTED("Unexpected instruction operands"));
+    REQUIRE_OK(operand_size(op1, NULL, &size));
+    REQUIRE_OK(encoding_set_size(&encoding, size));
+    ENCODING_OPCODE1(&encoding, size == 1 ? opcode8 : opcode);
+    encoding.reg = digit;
+    encoding.rm = op1;
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_shift(kefir_uint8_t digit, const struct operand *op1, const struct operand *op2,
+                                   struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    kefir_size_t size;
+    REQUIRE(is_register_or_memory(op1), UNSUPPORTED("Unexpected instruction operands"));
+    REQUIRE_OK(operand_size(op1, NULL, &size));
+    REQUIRE_OK(encoding_set_size(&encoding, size));
+    encoding.reg = digit;
+    encoding.rm = op1;
+    if (op2->kind == OPERAND_IMMEDIATE && op2->immediate == 1) {
+        ENCODING_OPCODE1(&encoding, size == 1 ? 0xd0 : 0xd1);
+    } else if (op2->kind == OPERAND_IMMEDIATE) {
+        ENCODING_OPCODE1(&encoding, size == 1 ? 0xc0 : 0xc1);
+        encoding.immediate = op2->immediate;
+        encoding.immediate_width = 1;
+    } else if (op2->kind == OPERAND_GP_REGISTER && op2->size == 1 && op2->reg.number == 1 && !op2->reg.high_byte) {
+        ENCODING_OPCODE1(&encoding, size == 1 ? 0xd2 : 0xd3);
+    } else {
+        return UNSUPPORTED("Unexpected instruction operands");
+    }
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_double_shift(kefir_uint8_t opcode, const struct operand *op1, const struct operand *op2,
+                                          const struct operand *op3, struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    REQUIRE(is_register_or_memory(op1) && op2->kind == OPERAND_GP_REGISTER && op2->size != 1,
+            UNSUPPORTED("Unexpected instruction operands"));
+    REQUIRE_OK(encoding_set_size(&encoding, op2->size));
+    encoding_set_reg(&encoding, op2);
+    encoding.rm = op1;
+    if (op3->kind == OPERAND_IMMEDIATE) {
+        ENCODING_OPCODE2(&encoding, 0x0f, opcode);
+        encoding.immediate = op3->immediate;
+        encoding.immediate_width = 1;
+    } else if (op3->kind == OPERAND_GP_REGISTER && op3->size == 1 && op3->reg.number == 1 && !op3->reg.high_byte) {
+        ENCODING_OPCODE2(&encoding, 0x0f, opcode + 1);
+    } else {
+        return UNSUPPORTED("Unexpected instruction operands");
+    }
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_plain(struct kefir_asm_amd64_encoded_instruction *out, kefir_size_t length,
+                                   const kefir_uint8_t *bytes) {
+    for (kefir_size_t i = 0; i < length; i++) {
+        REQUIRE_OK(emit_byte(out, bytes[i]));
+    }
+    return KEFIR_OK;
+}
+
+#define PLAIN(...)                                                                       \
+    do {                                                                                 \
+        static const kefir_uint8_t plain_bytes[] = {__VA_ARGS__};                        \
+        REQUIRE_OK(encode_plain(out, sizeof(plain_bytes) / sizeof(plain_bytes[0]), plain_bytes)); \
+    } while (0)
+
+static kefir_result_t encode_branch(kefir_bool_t conditional, kefir_uint8_t condition, const struct operand *op1,
+                                    struct kefir_asm_amd64_encoded_instruction *out) {
+    REQUIRE(op1->kind == OPERAND_TARGET, UNSUPPORTED("Unexpected branch operand"));
+    if (conditional) {
+        REQUIRE_OK(emit_byte(out, 0x0f));
+        REQUIRE_OK(emit_byte(out, 0x80 | condition));
+    } else {
+        REQUIRE_OK(emit_byte(out, 0xe9));
+    }
+    REQUIRE_OK(add_fixup(out, KEFIR_AMD64_ENCODER_FIXUP_BRANCH32, op1->target.symbol, op1->target.relocation,
+                         op1->target.addend - 4));
+    REQUIRE_OK(emit_value(out, 0, 4));
+    out->branch.relaxable = op1->target.relocation == KEFIR_AMD64_XASMGEN_SYMBOL_ABSOLUTE ||
+                            op1->target.relocation == KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_PLT;
+    out->branch.conditional = conditional;
+    out->branch.condition = condition;
+    return KEFIR_OK;
+}
+
+static kefir_result_t encode_indirect_branch(kefir_uint8_t digit, const struct operand *op1,
+                                             struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    REQUIRE(op1->kind == OPERAND_MEMORY || (op1->kind == OPERAND_GP_REGISTER && op1->size == 8),
+            UNSUPPORTED("Unexpected branch operand"));
+    ENCODING_OPCODE1(&encoding, 0xff);
+    encoding.reg = digit;
+    encoding.rm = op1;
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_sse(kefir_uint8_t prefix, kefir_uint8_t opcode, const struct operand *op1,
+                                 const struct operand *op2, struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    REQUIRE(op1->kind == OPERAND_XMM_REGISTER && is_xmm_or_memory(op2), UNSUPPORTED("Unexpected instruction operands"));
+    if (prefix == 0x66) {
+        encoding.operand_size_prefix = true;
+    } else {
+        encoding.mandatory_prefix = prefix;
+    }
+    ENCODING_OPCODE2(&encoding, 0x0f, opcode);
+    encoding_set_reg(&encoding, op1);
+    encoding.rm = op2;
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_sse_imm(kefir_uint8_t prefix, kefir_uint8_t opcode, kefir_int64_t immediate,
+                                     const struct operand *op1, const struct operand *op2,
+                                     struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    REQUIRE(op1->kind == OPERAND_XMM_REGISTER && is_xmm_or_memory(op2), UNSUPPORTED("Unexpected instruction operands"));
+    encoding.operand_size_prefix = prefix == 0x66;
+    ENCODING_OPCODE2(&encoding, 0x0f, opcode);
+    encoding_set_reg(&encoding, op1);
+    encoding.rm = op2;
+    encoding.immediate = immediate;
+    encoding.immediate_width = 1;
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_sse_store(kefir_uint8_t prefix, kefir_uint8_t opcode, const struct operand *op1,
+                                       const struct operand *op2, struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    REQUIRE(is_xmm_or_memory(op1) && op2->kind == OPERAND_XMM_REGISTER, UNSUPPORTED("Unexpected instruction operands"));
+    if (prefix == 0x66) {
+        encoding.operand_size_prefix = true;
+    } else {
+        encoding.mandatory_prefix = prefix;
+    }
+    ENCODING_OPCODE2(&encoding, 0x0f, opcode);
+    encoding_set_reg(&encoding, op2);
+    encoding.rm = op1;
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_movd(const struct operand *op1, const struct operand *op2,
+                                  struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {.operand_size_prefix = true};
+    if (op1->kind == OPERAND_XMM_REGISTER && is_register_or_memory(op2)) {
+        ENCODING_OPCODE2(&encoding, 0x0f, 0x6e);
+        encoding_set_reg(&encoding, op1);
+        encoding.rm = op2;
+    } else if (is_register_or_memory(op1) && op2->kind == OPERAND_XMM_REGISTER) {
+        ENCODING_OPCODE2(&encoding, 0x0f, 0x7e);
+        encoding_set_reg(&encoding, op2);
+        encoding.rm = op1;
+    } else {
+        return UNSUPPORTED("Unexpected instruction operands");
+    }
+    REQUIRE(encoding.rm->kind != OPERAND_GP_REGISTER || encoding.rm->size == 4 || encoding.rm->size == 8,
+            UNSUPPORTED("Unexpected operand size"));
+    encoding.rex_w = encoding.rm->kind == OPERAND_GP_REGISTER && encoding.rm->size == 8;
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_movq(const struct operand *op1, const struct operand *op2,
+                                  struct kefir_asm_amd64_encoded_instruction *out) {
+    if (op1->kind == OPERAND_GP_REGISTER || op2->kind == OPERAND_GP_REGISTER) {
+        const struct operand *gp = op1->kind == OPERAND_GP_REGISTER ? op1 : op2;
+        REQUIRE(gp->size == 8, UNSUPPORTED("Unexpected operand size"));
+        return encode_movd(op1, op2, out);
+    } else if (op1->kind == OPERAND_XMM_REGISTER) {
+        return encode_sse(0xf3, 0x7e, op1, op2, out);
+    } else {
+        return encode_sse_store(0x66, 0xd6, op1, op2, out);
+    }
+}
+
+static kefir_result_t encode_cvtsi2fp(kefir_uint8_t prefix, const struct operand *op1, const struct operand *op2,
+                                      struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {.mandatory_prefix = prefix};
+    REQUIRE(op1->kind == OPERAND_XMM_REGISTER && is_register_or_memory(op2),
+            UNSUPPORTED("Unexpected instruction operands"));
+    REQUIRE(op2->kind == OPERAND_GP_REGISTER || op2->memory.has_pointer_type,
+            UNSUPPORTED("Unable to determine instruction operand size"));
+    REQUIRE(op2->size == 4 || op2->size == 8, UNSUPPORTED("Unexpected operand size"));
+    encoding.rex_w = op2->size == 8;
+    ENCODING_OPCODE2(&encoding, 0x0f, 0x2a);
+    encoding_set_reg(&encoding, op1);
+    encoding.rm = op2;
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_cvtfp2si(kefir_uint8_t prefix, const struct operand *op1, const struct operand *op2,
+                                      struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {.mandatory_prefix = prefix};
+    REQUIRE(op1->kind == OPERAND_GP_REGISTER && is_xmm_or_memory(op2), UNSUPPORTED("Unexpected instruction operands"));
+    REQUIRE(op1->size == 4 || op1->size == 8, UNSUPPORTED("Unexpected operand size"));
+    encoding.rex_w = op1->size == 8;
+    ENCODING_OPCODE2(&encoding, 0x0f, 0x2c);
+    encoding_set_reg(&encoding, op1);
+    encoding.rm = op2;
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_sse_extract_insert(kefir_uint8_t opcode, kefir_bool_t rex_w, const struct operand *reg,
+                                                const struct operand *rm, const struct operand *imm,
+                                                struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {.operand_size_prefix = true, .rex_w = rex_w};
+    REQUIRE(reg->kind == OPERAND_XMM_REGISTER && imm->kind == OPERAND_IMMEDIATE,
+            UNSUPPORTED("Unexpected instruction operands"));
+    encoding.opcode[0] = 0x0f;
+    encoding.opcode[1] = 0x3a;
+    encoding.opcode[2] = opcode;
+    encoding.opcode_length = 3;
+    encoding_set_reg(&encoding, reg);
+    encoding.rm = rm;
+    encoding.immediate = imm->immediate;
+    encoding.immediate_width = 1;
+    return encode(&encoding, out);
+}
+
+// Memory-only instructions with fixed opcode and extension, which do not depend on the operand size
+static kefir_result_t encode_memory(kefir_uint8_t prefix, kefir_uint8_t opcode1, kefir_uint8_t opcode2,
+                                    kefir_size_t opcode_length, kefir_uint8_t digit, const struct operand *op1,
+                                    struct kefir_asm_amd64_encoded_instruction *out) {
+    struct encoding encoding = {0};
+    REQUIRE(op1->kind == OPERAND_MEMORY, UNSUPPORTED("Unexpected instruction operands"));
+    if (prefix != 0) {
+        REQUIRE_OK(emit_byte(out, prefix));
+    }
+    encoding.opcode[0] = opcode1;
+    encoding.opcode[1] = opcode2;
+    encoding.opcode_length = opcode_length;
+    encoding.reg = digit;
+    encoding.rm = op1;
+    return encode(&encoding, out);
+}
+
+static kefir_result_t encode_fpu_register(kefir_uint8_t opcode1, kefir_uint8_t opcode2, const struct operand *op,
+                                          struct kefir_asm_amd64_encoded_instruction *out) {
+    REQUIRE(op->kind == OPERAND_FPU_REGISTER, UNSUPPORTED("Unexpected instruction operands"));
+    REQUIRE_OK(emit_byte(out, opcode1));
+    REQUIRE_OK(emit_byte(out, opcode2 + op->reg.number));
+    return KEFIR_OK;
+}
+
+typedef enum fpu_memory_format {
+    FPU_MEMORY_SINGLE,
+    FPU_MEMORY_DOUBLE,
+    FPU_MEMORY_EXTENDED,
+    FPU_MEMORY_INT32,
+    FPU_MEMORY_INT64
+} fpu_memory_format_t;
+
+// Floating-point memory operand formats differ between assembler syntaxes for plain integral pointer types, thus only
+// unambiguous pointer types are accepted.
+static kefir_result_t fpu_memory_format(const struct operand *op, kefir_bool_t integral, fpu_memory_format_t *format) {
+    REQUIRE(op->kind == OPERAND_MEMORY && op->memory.has_pointer_type, UNSUPPORTED("Unexpected instruction operands"));
+    switch (op->memory.pointer_type) {
+        case KEFIR_AMD64_XASMGEN_POINTER_FP_SINGLE:
+            REQUIRE(!integral, UNSUPPORTED("Unexpected floating-point memory operand"));
+            *format = FPU_MEMORY_SINGLE;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_POINTER_FP_DOUBLE:
+            REQUIRE(!integral, UNSUPPORTED("Unexpected floating-point memory operand"));
+            *format = FPU_MEMORY_DOUBLE;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_POINTER_TBYTE:
+            REQUIRE(!integral, UNSUPPORTED("Unexpected floating-point memory operand"));
+            *format = FPU_MEMORY_EXTENDED;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_POINTER_DWORD:
+            REQUIRE(integral, UNSUPPORTED("Unexpected floating-point memory operand"));
+            *format = FPU_MEMORY_INT32;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_POINTER_QWORD:
+            REQUIRE(integral, UNSUPPORTED("Unexpected floating-point memory operand"));
+            *format = FPU_MEMORY_INT64;
+            break;
+
+        default:
+            return UNSUPPORTED("Unexpected floating-point memory operand");
+    }
+    return KEFIR_OK;
+}
+
+// Floating-point load, store and arithmetic instructions with either stack register or memory operand
+static kefir_result_t encode_fpu_memory(kefir_bool_t integral, const kefir_uint8_t formats[][2],
+                                        kefir_uint8_t register_opcode1, kefir_uint8_t register_opcode2,
+                                        const struct operand *op1, struct kefir_asm_amd64_encoded_instruction *out) {
+    if (op1->kind == OPERAND_FPU_REGISTER) {
+        REQUIRE(register_opcode1 != 0, UNSUPPORTED("Unexpected instruction operands"));
+        return encode_fpu_register(register_opcode1, register_opcode2, op1, out);
+    }
+
+    fpu_memory_format_t format;
+    REQUIRE_OK(fpu_memory_format(op1, integral, &format));
+    const kefir_uint8_t *encoding = formats[format];
+    REQUIRE(encoding[0] != 0, UNSUPPORTED("Unexpected floating-point memory operand"));
+    return encode_memory(0, encoding[0], 0, 1, encoding[1], op1, out);
+}
+
+// Two-operand floating-point arithmetics, where one of the operands is the stack top
+static kefir_result_t encode_fpu_arith2(kefir_uint8_t base, const struct operand *op1, const struct operand *op2,
+                                        struct kefir_asm_amd64_encoded_instruction *out) {
+    REQUIRE(op1->kind == OPERAND_FPU_REGISTER && op2->kind == OPERAND_FPU_REGISTER,
+            UNSUPPORTED("Unexpected instruction operands"));
+    if (op1->reg.number == 0) {
+        return encode_fpu_register(0xd8, base, op2, out);
+    } else {
+        REQUIRE(op2->reg.number == 0, UNSUPPORTED("Unexpected instruction operands"));
+        return encode_fpu_register(0xdc, base, op1, out);
+    }
+}
+
+// Two-operand floating-point instructions with the stack top as the source
+static kefir_result_t encode_fpu_pop2(kefir_uint8_t opcode1, kefir_uint8_t opcode2, const struct operand *op1,
+                                      const struct operand *op2, struct kefir_asm_amd64_encoded_instruction *out) {
+    REQUIRE(op2->kind == OPERAND_FPU_REGISTER && op2->reg.number == 0, UNSUPPORTED("Unexpected instruction operands"));
+    return encode_fpu_register(opcode1, opcode2, op1, out);
+}
+
+// Two-operand floating-point instructions with the stack top as the destination
+static kefir_result_t encode_fpu_top2(kefir_uint8_t opcode1, kefir_uint8_t opcode2, const struct operand *op1,
+                                      const struct operand *op2, struct kefir_asm_amd64_encoded_instruction *out) {
+    REQUIRE(op1->kind == OPERAND_FPU_REGISTER && op1->reg.number == 0, UNSUPPORTED("Unexpected instruction operands"));
+    return encode_fpu_register(opcode1, opcode2, op2, out);
+}
+
+static const kefir_uint8_t FLD_FORMATS[][2] = {{0xd9, 0}, {0xdd, 0}, {0xdb, 5}, {0, 0}, {0, 0}};
+static const kefir_uint8_t FSTP_FORMATS[][2] = {{0xd9, 3}, {0xdd, 3}, {0xdb, 7}, {0, 0}, {0, 0}};
+static const kefir_uint8_t FST_FORMATS[][2] = {{0xd9, 2}, {0xdd, 2}, {0, 0}, {0, 0}, {0, 0}};
+static const kefir_uint8_t FADD_FORMATS[][2] = {{0xd8, 0}, {0xdc, 0}, {0, 0}, {0, 0}, {0, 0}};
+static const kefir_uint8_t FMUL_FORMATS[][2] = {{0xd8, 1}, {0xdc, 1}, {0, 0}, {0, 0}, {0, 0}};
+static const kefir_uint8_t FILD_FORMATS[][2] = {{0, 0}, {0, 0}, {0, 0}, {0xdb, 0}, {0xdf, 5}};
+static const kefir_uint8_t FISTP_FORMATS[][2] = {{0, 0}, {0, 0}, {0, 0}, {0xdb, 3}, {0xdf, 7}};
+
+#define CONDITION_O 0x0
+#define CONDITION_NO 0x1
+#define CONDITION_B 0x2
+#define CONDITION_AE 0x3
+#define CONDITION_E 0x4
+#define CONDITION_NE 0x5
+#define CONDITION_BE 0x6
+#define CONDITION_A 0x7
+#define CONDITION_S 0x8
+#define CONDITION_NS 0x9
+#define CONDITION_P 0xa
+#define CONDITION_NP 0xb
+#define CONDITION_L 0xc
+#define CONDITION_GE 0xd
+#define CONDITION_LE 0xe
+#define CONDITION_G 0xf
+
+static kefir_result_t set_gotpcrel_relaxation(struct kefir_asm_amd64_encoded_instruction *out) {
+    for (kefir_size_t i = 0; i < out->fixup_count; i++) {
+        struct kefir_asm_amd64_encoder_fixup *fixup = &out->fixups[i];
+        if (fixup->kind != KEFIR_AMD64_ENCODER_FIXUP_RELATIVE32 ||
+            fixup->relocation != KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_GOTPCREL) {
+            continue;
+        }
+
+        // Locate the primary opcode byte preceding ModR/M
+        kefir_size_t opcode_index = fixup->offset - 2;
+        kefir_bool_t rex = false;
+        for (kefir_size_t j = 0; j < opcode_index; j++) {
+            if ((out->bytes[j] & 0xf0) == 0x40) {
+                rex = true;
+            }
+        }
+        const kefir_uint8_t opcode = out->bytes[opcode_index];
+        if (opcode == 0xff) {
+            fixup->relaxation = KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_GOTPCRELX;
+        } else if (opcode == 0x8b || opcode == 0x85 || opcode == 0x03 || opcode == 0x0b || opcode == 0x13 ||
+                   opcode == 0x1b || opcode == 0x23 || opcode == 0x2b || opcode == 0x33 || opcode == 0x3b) {
+            fixup->relaxation = rex ? KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_REX_GOTPCRELX
+                                    : KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_GOTPCRELX;
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t encode_instruction(kefir_asm_amd64_encoder_opcode_t opcode, kefir_bool_t rep,
+                                         const struct operand *op1, const struct operand *op2,
+                                         const struct operand *op3, struct kefir_asm_amd64_encoded_instruction *out) {
+    switch (opcode) {
+#define JCC(_opcode, _condition)                                     \
+    case KEFIR_AMD64_ENCODER_OPCODE(_opcode):                        \
+        REQUIRE_OK(encode_branch(true, (_condition), op1, out));     \
+        break
+        JCC(jz, CONDITION_E);
+        JCC(je, CONDITION_E);
+        JCC(jnz, CONDITION_NE);
+        JCC(jne, CONDITION_NE);
+        JCC(jo, CONDITION_O);
+        JCC(jno, CONDITION_NO);
+        JCC(jc, CONDITION_B);
+        JCC(jb, CONDITION_B);
+        JCC(jnc, CONDITION_AE);
+        JCC(jnb, CONDITION_AE);
+        JCC(jae, CONDITION_AE);
+        JCC(js, CONDITION_S);
+        JCC(jns, CONDITION_NS);
+        JCC(jp, CONDITION_P);
+        JCC(jnp, CONDITION_NP);
+        JCC(ja, CONDITION_A);
+        JCC(jbe, CONDITION_BE);
+        JCC(jg, CONDITION_G);
+        JCC(jge, CONDITION_GE);
+        JCC(jl, CONDITION_L);
+        JCC(jle, CONDITION_LE);
+#undef JCC
+
+        case KEFIR_AMD64_ENCODER_OPCODE(jmp):
+            if (op1->kind == OPERAND_TARGET) {
+                REQUIRE_OK(encode_branch(false, 0, op1, out));
+            } else {
+                REQUIRE_OK(encode_indirect_branch(4, op1, out));
+            }
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(call):
+            if (op1->kind == OPERAND_TARGET) {
+                REQUIRE_OK(emit_byte(out, 0xe8));
+                REQUIRE_OK(add_fixup(out, KEFIR_AMD64_ENCODER_FIXUP_BRANCH32, op1->target.symbol,
+                                     op1->target.relocation, op1->target.addend - 4));
+                REQUIRE_OK(emit_value(out, 0, 4));
+            } else {
+                REQUIRE_OK(encode_indirect_branch(2, op1, out));
+            }
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(ret):
+            PLAIN(0xc3);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(ud2):
+            PLAIN(0x0f, 0x0b);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(push):
+        case KEFIR_AMD64_ENCODER_OPCODE(pop): {
+            const kefir_bool_t push = opcode == KEFIR_AMD64_ENCODER_OPCODE(push);
+            struct encoding encoding = {0};
+            if (op1->kind == OPERAND_GP_REGISTER) {
+                REQUIRE(op1->size == 8 || op1->size == 2, UNSUPPORTED("Unexpected operand size"));
+                encoding.operand_size_prefix = op1->size == 2;
+                ENCODING_OPCODE1(&encoding, push ? 0x50 : 0x58);
+                encoding.opcode_register = op1;
+            } else if (op1->kind == OPERAND_MEMORY) {
+                ENCODING_OPCODE1(&encoding, push ? 0xff : 0x8f);
+                encoding.reg = push ? 6 : 0;
+                encoding.rm = op1;
+            } else if (push && op1->kind == OPERAND_IMMEDIATE) {
+                REQUIRE(fits_int32(op1->immediate), UNSUPPORTED("Immediate does not fit into 32 bits"));
+                ENCODING_OPCODE1(&encoding, fits_int8(op1->immediate) ? 0x6a : 0x68);
+                encoding.immediate = op1->immediate;
+                encoding.immediate_width = fits_int8(op1->immediate) ? 1 : 4;
+            } else {
+                return UNSUPPORTED("Unexpected instruction operands");
+            }
+            REQUIRE_OK(encode(&encoding, out));
+        } break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(mov):
+            REQUIRE_OK(encode_mov(op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(movabs): {
+            REQUIRE(op1->kind == OPERAND_GP_REGISTER && (op1->size == 4 || op1->size == 8) &&
+                        op2->kind == OPERAND_IMMEDIATE,
+                    UNSUPPORTED("Unexpected instruction operands"));
+            struct encoding encoding = {.rex_w = op1->size == 8};
+            ENCODING_OPCODE1(&encoding, 0xb8);
+            encoding.opcode_register = op1;
+            encoding.immediate = op2->immediate;
+            encoding.immediate_width = op1->size;
+            REQUIRE_OK(encode(&encoding, out));
+        } break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(xchg):
+            REQUIRE_OK(encode_xchg(op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(movzx):
+        case KEFIR_AMD64_ENCODER_OPCODE(movsx): {
+            const kefir_bool_t sign = opcode == KEFIR_AMD64_ENCODER_OPCODE(movsx);
+            REQUIRE(op1->kind == OPERAND_GP_REGISTER && op1->size > 1 && is_register_or_memory(op2) &&
+                        (op2->kind == OPERAND_GP_REGISTER || op2->memory.has_pointer_type),
+                    UNSUPPORTED("Unexpected instruction operands"));
+            struct encoding encoding = {0};
+            REQUIRE_OK(encoding_set_size(&encoding, op1->size));
+            if (op2->size == 1 || op2->size == 2) {
+                REQUIRE(op2->size < op1->size, UNSUPPORTED("Unexpected operand size"));
+                ENCODING_OPCODE2(&encoding, 0x0f, (sign ? 0xbe : 0xb6) + (op2->size == 2 ? 1 : 0));
+            } else if (sign && op2->size == 4 && op1->size == 8) {
+                ENCODING_OPCODE1(&encoding, 0x63);
+            } else {
+                return UNSUPPORTED("Unexpected operand size");
+            }
+            encoding_set_reg(&encoding, op1);
+            encoding.rm = op2;
+            REQUIRE_OK(encode(&encoding, out));
+        } break;
+
+#define CMOV(_opcode, _condition)                                                    \
+    case KEFIR_AMD64_ENCODER_OPCODE(_opcode):                                        \
+        REQUIRE_OK(encode_rm(0x0f, 0x40 | (_condition), 2, op1, op2, out));          \
+        break
+        CMOV(cmovl, CONDITION_L);
+        CMOV(cmovle, CONDITION_LE);
+        CMOV(cmovg, CONDITION_G);
+        CMOV(cmovge, CONDITION_GE);
+        CMOV(cmove, CONDITION_E);
+        CMOV(cmovz, CONDITION_E);
+        CMOV(cmovne, CONDITION_NE);
+        CMOV(cmovnz, CONDITION_NE);
+        CMOV(cmovbe, CONDITION_BE);
+        CMOV(cmovb, CONDITION_B);
+        CMOV(cmova, CONDITION_A);
+        CMOV(cmovae, CONDITION_AE);
+        CMOV(cmovs, CONDITION_S);
+        CMOV(cmovns, CONDITION_NS);
+#undef CMOV
+
+        case KEFIR_AMD64_ENCODER_OPCODE(lea):
+            REQUIRE(op2->kind == OPERAND_MEMORY, UNSUPPORTED("Unexpected instruction operands"));
+            REQUIRE_OK(encode_rm(0x8d, 0, 1, op1, op2, out));
+            break;
+
+// Operand size prefix precedes the repeat prefix
+#define STRING_OP(_opcode, _operand_size_prefix, ...) \
+    case KEFIR_AMD64_ENCODER_OPCODE(_opcode):         \
+        if (_operand_size_prefix) {                   \
+            REQUIRE_OK(emit_byte(out, 0x66));         \
+        }                                             \
+        if (rep) {                                    \
+            REQUIRE_OK(emit_byte(out, 0xf3));         \
+        }                                             \
+        PLAIN(__VA_ARGS__);                           \
+        break
+        STRING_OP(movsb, false, 0xa4);
+        STRING_OP(movsw, true, 0xa5);
+        STRING_OP(movsl, false, 0xa5);
+        STRING_OP(movsq, false, 0x48, 0xa5);
+        STRING_OP(stosb, false, 0xaa);
+        STRING_OP(stosw, true, 0xab);
+        STRING_OP(stosl, false, 0xab);
+        STRING_OP(stosq, false, 0x48, 0xab);
+#undef STRING_OP
+
+        case KEFIR_AMD64_ENCODER_OPCODE(pushfq):
+            PLAIN(0x9c);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(popfq):
+            PLAIN(0x9d);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cld):
+            PLAIN(0xfc);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(test):
+            if (op2->kind == OPERAND_IMMEDIATE) {
+                struct encoding encoding = {0};
+                kefir_size_t size;
+                REQUIRE(is_register_or_memory(op1), UNSUPPORTED("Unexpected instruction operands"));
+                REQUIRE_OK(operand_size(op1, NULL, &size));
+                REQUIRE_OK(encoding_set_size(&encoding, size));
+                REQUIRE_OK(immediate_for_size(op2->immediate, size, &encoding.immediate, &encoding.immediate_width));
+                if (is_accumulator(op1)) {
+                    ENCODING_OPCODE1(&encoding, size == 1 ? 0xa8 : 0xa9);
+                } else {
+                    ENCODING_OPCODE1(&encoding, size == 1 ? 0xf6 : 0xf7);
+                    encoding.rm = op1;
+                }
+                REQUIRE_OK(encode(&encoding, out));
+            } else if (op2->kind == OPERAND_GP_REGISTER) {
+                REQUIRE_OK(encode_mr(0x84, 0x85, false, op1, op2, out));
+            } else {
+                REQUIRE_OK(encode_mr(0x84, 0x85, false, op2, op1, out));
+            }
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(btc):
+            if (op2->kind == OPERAND_IMMEDIATE) {
+                struct encoding encoding = {0};
+                kefir_size_t size;
+                REQUIRE(is_register_or_memory(op1), UNSUPPORTED("Unexpected instruction operands"));
+                REQUIRE_OK(operand_size(op1, NULL, &size));
+                REQUIRE(size != 1, UNSUPPORTED("Unexpected operand size"));
+                REQUIRE_OK(encoding_set_size(&encoding, size));
+                ENCODING_OPCODE2(&encoding, 0x0f, 0xba);
+                encoding.reg = 7;
+                encoding.rm = op1;
+                encoding.immediate = op2->immediate;
+                encoding.immediate_width = 1;
+                REQUIRE_OK(encode(&encoding, out));
+            } else {
+                REQUIRE(op2->kind == OPERAND_GP_REGISTER && op2->size != 1,
+                        UNSUPPORTED("Unexpected instruction operands"));
+                REQUIRE_OK(encode_mr(0xbb, 0xbb, true, op1, op2, out));
+            }
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(add):
+            REQUIRE_OK(encode_alu(0, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(or):
+            REQUIRE_OK(encode_alu(1, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(adc):
+            REQUIRE_OK(encode_alu(2, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(sbb):
+            REQUIRE_OK(encode_alu(3, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(and):
+            REQUIRE_OK(encode_alu(4, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(sub):
+            REQUIRE_OK(encode_alu(5, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(xor):
+            REQUIRE_OK(encode_alu(6, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cmp):
+            REQUIRE_OK(encode_alu(7, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cmpxchg):
+            REQUIRE_OK(encode_mr(0xb0, 0xb1, true, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(xadd):
+            REQUIRE_OK(encode_mr(0xc0, 0xc1, true, op1, op2, out));
+            break;
+
+#define SETCC(_opcode, _condition)                                                                   \
+    case KEFIR_AMD64_ENCODER_OPCODE(_opcode): {                                                      \
+        struct encoding encoding = {0};                                                              \
+        REQUIRE(is_register_or_memory(op1) && (op1->kind != OPERAND_GP_REGISTER || op1->size == 1),  \
+                UNSUPPORTED("Unexpected instruction operands"));                                     \
+        ENCODING_OPCODE2(&encoding, 0x0f, 0x90 | (_condition));                                      \
+        encoding.rm = op1;                                                                           \
+        REQUIRE_OK(encode(&encoding, out));                                                          \
+    } break
+        SETCC(sete, CONDITION_E);
+        SETCC(setne, CONDITION_NE);
+        SETCC(setnp, CONDITION_NP);
+        SETCC(setp, CONDITION_P);
+        SETCC(setg, CONDITION_G);
+        SETCC(setge, CONDITION_GE);
+        SETCC(setl, CONDITION_L);
+        SETCC(setle, CONDITION_LE);
+        SETCC(seta, CONDITION_A);
+        SETCC(setae, CONDITION_AE);
+        SETCC(setnb, CONDITION_AE);
+        SETCC(setnc, CONDITION_AE);
+        SETCC(setb, CONDITION_B);
+        SETCC(setc, CONDITION_B);
+        SETCC(setbe, CONDITION_BE);
+        SETCC(seto, CONDITION_O);
+        SETCC(setno, CONDITION_NO);
+        SETCC(sets, CONDITION_S);
+        SETCC(setns, CONDITION_NS);
+#undef SETCC
+
+        case KEFIR_AMD64_ENCODER_OPCODE(not):
+            REQUIRE_OK(encode_unary(0xf6, 0xf7, 2, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(neg):
+            REQUIRE_OK(encode_unary(0xf6, 0xf7, 3, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(mul):
+            REQUIRE_OK(encode_unary(0xf6, 0xf7, 4, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(imul1):
+            REQUIRE_OK(encode_unary(0xf6, 0xf7, 5, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(div):
+            REQUIRE_OK(encode_unary(0xf6, 0xf7, 6, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(idiv):
+            REQUIRE_OK(encode_unary(0xf6, 0xf7, 7, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(dec):
+            REQUIRE_OK(encode_unary(0xfe, 0xff, 1, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(imul):
+            REQUIRE_OK(encode_rm(0x0f, 0xaf, 2, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(imul3): {
+            struct encoding encoding = {0};
+            REQUIRE(op1->kind == OPERAND_GP_REGISTER && op1->size != 1 && is_register_or_memory(op2) &&
+                        op3->kind == OPERAND_IMMEDIATE,
+                    UNSUPPORTED("Unexpected instruction operands"));
+            REQUIRE_OK(encoding_set_size(&encoding, op1->size));
+            REQUIRE_OK(
+                immediate_for_size(op3->immediate, op1->size, &encoding.immediate, &encoding.immediate_width));
+            if (fits_int8(encoding.immediate)) {
+                ENCODING_OPCODE1(&encoding, 0x6b);
+                encoding.immediate_width = 1;
+            } else {
+                ENCODING_OPCODE1(&encoding, 0x69);
+            }
+            encoding_set_reg(&encoding, op1);
+            encoding.rm = op2;
+            REQUIRE_OK(encode(&encoding, out));
+        } break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(rol):
+            REQUIRE_OK(encode_shift(0, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(shl):
+            REQUIRE_OK(encode_shift(4, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(shr):
+            REQUIRE_OK(encode_shift(5, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(sar):
+            REQUIRE_OK(encode_shift(7, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(shld):
+            REQUIRE_OK(encode_double_shift(0xa4, op1, op2, op3, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(shrd):
+            REQUIRE_OK(encode_double_shift(0xac, op1, op2, op3, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cwd):
+            PLAIN(0x66, 0x99);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cdq):
+            PLAIN(0x99);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cqo):
+            PLAIN(0x48, 0x99);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(bsf2):
+            if (rep) {
+                REQUIRE_OK(emit_byte(out, 0xf3));
+            }
+            // Fallthrough
+        case KEFIR_AMD64_ENCODER_OPCODE(bsf):
+            REQUIRE_OK(encode_rm(0x0f, 0xbc, 2, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(bsr):
+            REQUIRE_OK(encode_rm(0x0f, 0xbd, 2, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(bswap): {
+            REQUIRE(op1->kind == OPERAND_GP_REGISTER && (op1->size == 4 || op1->size == 8),
+                    UNSUPPORTED("Unexpected instruction operands"));
+            struct encoding encoding = {.rex_w = op1->size == 8};
+            ENCODING_OPCODE2(&encoding, 0x0f, 0xc8);
+            encoding.opcode_register = op1;
+            REQUIRE_OK(encode(&encoding, out));
+        } break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(movd):
+        case KEFIR_AMD64_ENCODER_OPCODE(movd2):
+            REQUIRE_OK(encode_movd(op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(movq):
+        case KEFIR_AMD64_ENCODER_OPCODE(movq2):
+            REQUIRE_OK(encode_movq(op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(movdqu):
+            if (op1->kind == OPERAND_XMM_REGISTER) {
+                REQUIRE_OK(encode_sse(0xf3, 0x6f, op1, op2, out));
+            } else {
+                REQUIRE_OK(encode_sse_store(0xf3, 0x7f, op1, op2, out));
+            }
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(movaps):
+            if (op1->kind == OPERAND_XMM_REGISTER) {
+                REQUIRE_OK(encode_sse(0, 0x28, op1, op2, out));
+            } else {
+                REQUIRE_OK(encode_sse_store(0, 0x29, op1, op2, out));
+            }
+            break;
+
+#define SSE(_opcode, _prefix, _byte)                                 \
+    case KEFIR_AMD64_ENCODER_OPCODE(_opcode):                        \
+        REQUIRE_OK(encode_sse((_prefix), (_byte), op1, op2, out));   \
+        break
+        SSE(unpcklpd, 0x66, 0x14);
+        SSE(unpckhpd, 0x66, 0x15);
+        SSE(cvtss2sd, 0xf3, 0x5a);
+        SSE(cvtsd2ss, 0xf2, 0x5a);
+        SSE(cvtps2pd, 0, 0x5a);
+        SSE(cvtpd2ps, 0x66, 0x5a);
+        SSE(pxor, 0x66, 0xef);
+        SSE(addss, 0xf3, 0x58);
+        SSE(addps, 0, 0x58);
+        SSE(addsd, 0xf2, 0x58);
+        SSE(addpd, 0x66, 0x58);
+        SSE(subss, 0xf3, 0x5c);
+        SSE(subsd, 0xf2, 0x5c);
+        SSE(mulss, 0xf3, 0x59);
+        SSE(mulps, 0, 0x59);
+        SSE(mulsd, 0xf2, 0x59);
+        SSE(mulpd, 0x66, 0x59);
+        SSE(divss, 0xf3, 0x5e);
+        SSE(divsd, 0xf2, 0x5e);
+        SSE(divpd, 0x66, 0x5e);
+        SSE(xorps, 0, 0x57);
+        SSE(xorpd, 0x66, 0x57);
+        SSE(ucomiss, 0, 0x2e);
+        SSE(ucomisd, 0x66, 0x2e);
+        SSE(comiss, 0, 0x2f);
+        SSE(comisd, 0x66, 0x2f);
+        SSE(andps, 0, 0x54);
+        SSE(andpd, 0x66, 0x54);
+        SSE(andnps, 0, 0x55);
+        SSE(andnpd, 0x66, 0x55);
+        SSE(orps, 0, 0x56);
+        SSE(orpd, 0x66, 0x56);
+#undef SSE
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cmpeqps):
+            REQUIRE_OK(encode_sse_imm(0, 0xc2, 0, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cmpeqpd):
+            REQUIRE_OK(encode_sse_imm(0x66, 0xc2, 0, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cmpneqps):
+            REQUIRE_OK(encode_sse_imm(0, 0xc2, 4, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cmpneqpd):
+            REQUIRE_OK(encode_sse_imm(0x66, 0xc2, 4, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(shufps):
+            REQUIRE(op3->kind == OPERAND_IMMEDIATE, UNSUPPORTED("Unexpected instruction operands"));
+            REQUIRE_OK(encode_sse_imm(0, 0xc6, op3->immediate, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(shufpd):
+            REQUIRE(op3->kind == OPERAND_IMMEDIATE, UNSUPPORTED("Unexpected instruction operands"));
+            REQUIRE_OK(encode_sse_imm(0x66, 0xc6, op3->immediate, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cvtsi2ss):
+            REQUIRE_OK(encode_cvtsi2fp(0xf3, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cvtsi2sd):
+            REQUIRE_OK(encode_cvtsi2fp(0xf2, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cvttss2si):
+            REQUIRE_OK(encode_cvtfp2si(0xf3, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(cvttsd2si):
+            REQUIRE_OK(encode_cvtfp2si(0xf2, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(stmxcsr):
+            REQUIRE_OK(encode_memory(0, 0x0f, 0xae, 2, 3, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(ldmxcsr):
+            REQUIRE_OK(encode_memory(0, 0x0f, 0xae, 2, 2, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(pextrq):
+            REQUIRE(is_register_or_memory(op1) && (op1->kind != OPERAND_GP_REGISTER || op1->size == 8),
+                    UNSUPPORTED("Unexpected instruction operands"));
+            REQUIRE_OK(encode_sse_extract_insert(0x16, true, op2, op1, op3, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(pinsrq):
+            REQUIRE(is_register_or_memory(op2) && (op2->kind != OPERAND_GP_REGISTER || op2->size == 8),
+                    UNSUPPORTED("Unexpected instruction operands"));
+            REQUIRE_OK(encode_sse_extract_insert(0x22, true, op1, op2, op3, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(insertps):
+            REQUIRE(is_xmm_or_memory(op2), UNSUPPORTED("Unexpected instruction operands"));
+            REQUIRE_OK(encode_sse_extract_insert(0x21, false, op1, op2, op3, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fld):
+            REQUIRE_OK(encode_fpu_memory(false, FLD_FORMATS, 0xd9, 0xc0, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fild):
+            REQUIRE_OK(encode_fpu_memory(true, FILD_FORMATS, 0, 0, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fistp):
+            REQUIRE_OK(encode_fpu_memory(true, FISTP_FORMATS, 0, 0, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fstp):
+            REQUIRE_OK(encode_fpu_memory(false, FSTP_FORMATS, 0xdd, 0xd8, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fst):
+            REQUIRE_OK(encode_fpu_memory(false, FST_FORMATS, 0xdd, 0xd0, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fadd):
+            REQUIRE_OK(encode_fpu_memory(false, FADD_FORMATS, 0xd8, 0xc0, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fmul1):
+            REQUIRE_OK(encode_fpu_memory(false, FMUL_FORMATS, 0xd8, 0xc8, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fdecstp):
+            PLAIN(0xd9, 0xf6);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fldz):
+            PLAIN(0xd9, 0xee);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fld1):
+            PLAIN(0xd9, 0xe8);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fabs):
+            PLAIN(0xd9, 0xe1);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fchs):
+            PLAIN(0xd9, 0xe0);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fxam):
+            PLAIN(0xd9, 0xe5);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fnclex):
+            PLAIN(0xdb, 0xe2);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(faddp):
+            PLAIN(0xde, 0xc1);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fsubp):
+            PLAIN(0xde, 0xe1);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fmulp):
+            PLAIN(0xde, 0xc9);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fdivp):
+            PLAIN(0xde, 0xf1);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(faddp1):
+            REQUIRE_OK(encode_fpu_register(0xde, 0xc0, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fsubp1):
+            REQUIRE_OK(encode_fpu_register(0xde, 0xe0, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fmulp1):
+            REQUIRE_OK(encode_fpu_register(0xde, 0xc8, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fdivp1):
+            REQUIRE_OK(encode_fpu_register(0xde, 0xf0, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fdivrp1):
+            REQUIRE_OK(encode_fpu_register(0xde, 0xf8, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fxch):
+            REQUIRE_OK(encode_fpu_register(0xd9, 0xc8, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fucomi):
+            REQUIRE_OK(encode_fpu_register(0xdb, 0xe8, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fucomip):
+            REQUIRE_OK(encode_fpu_register(0xdf, 0xe8, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fcomi):
+            REQUIRE_OK(encode_fpu_register(0xdb, 0xf0, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fcomip):
+            REQUIRE_OK(encode_fpu_register(0xdf, 0xf0, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fadd2):
+            REQUIRE_OK(encode_fpu_arith2(0xc0, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fmul2):
+            REQUIRE_OK(encode_fpu_arith2(0xc8, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fdiv2):
+            REQUIRE_OK(encode_fpu_arith2(0xf0, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fdivr2):
+            REQUIRE_OK(encode_fpu_arith2(0xf8, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fsubp2):
+            REQUIRE_OK(encode_fpu_pop2(0xde, 0xe0, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fsubrp2):
+            REQUIRE_OK(encode_fpu_pop2(0xde, 0xe8, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fmulp2):
+            REQUIRE_OK(encode_fpu_pop2(0xde, 0xc8, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fdivp2):
+            REQUIRE_OK(encode_fpu_pop2(0xde, 0xf0, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fdivrp2):
+            REQUIRE_OK(encode_fpu_pop2(0xde, 0xf8, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fcomip2):
+            REQUIRE_OK(encode_fpu_top2(0xdf, 0xf0, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fcmove):
+            REQUIRE_OK(encode_fpu_top2(0xda, 0xc8, op1, op2, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fstcw):
+            REQUIRE_OK(encode_memory(0x9b, 0xd9, 0, 1, 7, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fnstcw):
+            REQUIRE_OK(encode_memory(0, 0xd9, 0, 1, 7, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fldcw):
+            REQUIRE_OK(encode_memory(0, 0xd9, 0, 1, 5, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fnstenv):
+            REQUIRE_OK(encode_memory(0, 0xd9, 0, 1, 6, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fldenv):
+            REQUIRE_OK(encode_memory(0, 0xd9, 0, 1, 4, op1, out));
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(fnstsw):
+            if (op1->kind == OPERAND_GP_REGISTER) {
+                REQUIRE(op1->size == 2 && is_accumulator(op1), UNSUPPORTED("Unexpected instruction operands"));
+                PLAIN(0xdf, 0xe0);
+            } else {
+                REQUIRE_OK(encode_memory(0, 0xdd, 0, 1, 7, op1, out));
+            }
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(lock):
+            PLAIN(0xf0);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(data16):
+            PLAIN(0x66);
+            break;
+
+        case KEFIR_AMD64_ENCODER_OPCODE(rexW):
+            PLAIN(0x48);
+            break;
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_asm_amd64_encode_instruction(kefir_asm_amd64_encoder_opcode_t opcode, kefir_bool_t rep,
+                                                  const struct kefir_asm_amd64_xasmgen_operand *op1,
+                                                  const struct kefir_asm_amd64_xasmgen_operand *op2,
+                                                  const struct kefir_asm_amd64_xasmgen_operand *op3,
+                                                  struct kefir_asm_amd64_encoded_instruction *instruction) {
+    REQUIRE(instruction != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to AMD64 encoded instruction"));
+
+    const kefir_bool_t branch = opcode == KEFIR_AMD64_ENCODER_OPCODE(call) ||
+                                opcode == KEFIR_AMD64_ENCODER_OPCODE(jmp) ||
+                                (opcode >= KEFIR_AMD64_ENCODER_OPCODE(jz) && opcode <= KEFIR_AMD64_ENCODER_OPCODE(jle));
+    struct operand operand1, operand2, operand3;
+    REQUIRE_OK(classify_operand(op1, branch, &operand1));
+    REQUIRE_OK(classify_operand(op2, false, &operand2));
+    REQUIRE_OK(classify_operand(op3, false, &operand3));
+
+    memset(instruction, 0, sizeof(struct kefir_asm_amd64_encoded_instruction));
+    REQUIRE_OK(encode_instruction(opcode, rep, &operand1, &operand2, &operand3, instruction));
+    REQUIRE_OK(set_gotpcrel_relaxation(instruction));
+    return KEFIR_OK;
+}
@@ -2817,6 +2817,8 @@ kefir_result_t kefir_asm_amd64_xasmgen_init(struct kefir_mem *mem, struct kefir_
 
 FILE *kefir_asm_amd64_xasmgen_get_output(const struct kefir_amd64_xasmgen *xasmgen) {
     REQUIRE(xasmgen != NULL, NULL);
+    // Integrated assembler does not provide textual output
+    REQUIRE(!kefir_asm_amd64_xasmgen_is_elf(xasmgen), NULL);
     ASSIGN_DECL_CAST(struct xasmgen_payload *, payload, xasmgen->payload);
     REQUIRE(payload != NULL, NULL);
 
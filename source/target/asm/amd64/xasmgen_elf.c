@@ -0,0 +1,2118 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "kefir/core/platform.h"
+#if defined(KEFIR_LINUX_HOST_PLATFORM)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "kefir/target/asm/amd64/xasmgen.h"
+#include "kefir/target/asm/amd64/encoder.h"
+#include "kefir/target/elf/object.h"
+#include "kefir/core/error.h"
+#include "kefir/core/util.h"
+#include "kefir/core/hashtable.h"
+#include "kefir/core/string_pool.h"
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Integrated assembler backend. Code and data are encoded directly and written out as an ELF relocatable object once
+// the generator is closed. Constructs that cannot be encoded (inline assembly, free-form textual output) are rejected,
+// thus code generator shall select textual output for modules that contain them.
+
+typedef enum elf_chunk_tail {
+    ELF_CHUNK_TAIL_NONE,
+    ELF_CHUNK_TAIL_ALIGN,
+    ELF_CHUNK_TAIL_BRANCH,
+    ELF_CHUNK_TAIL_ULEB128
+} elf_chunk_tail_t;
+
+// Section contents are split into chunks of fixed bytes, each followed by an optional variable-length tail whose
+// length is determined during layout.
+typedef struct elf_chunk {
+    kefir_size_t content_offset;
+    kefir_size_t length;
+    kefir_uint64_t address;
+
+    elf_chunk_tail_t tail;
+    kefir_size_t tail_length;
+    union {
+        kefir_size_t alignment;
+        struct {
+            kefir_size_t target;
+            kefir_int64_t addend;
+            kefir_asm_amd64_xasmgen_symbol_relocation_t relocation;
+            kefir_bool_t conditional;
+            kefir_uint8_t condition;
+            kefir_bool_t near;
+        } branch;
+        struct {
+            kefir_size_t minuend;
+            kefir_size_t subtrahend;
+            kefir_int64_t addend;
+        } uleb128;
+    };
+} elf_chunk_t;
+
+typedef enum elf_fixup_kind {
+    ELF_FIXUP_ABSOLUTE,
+    ELF_FIXUP_SIGNED_ABSOLUTE,
+    ELF_FIXUP_RELATIVE,
+    ELF_FIXUP_BRANCH,
+    ELF_FIXUP_DIFFERENCE
+} elf_fixup_kind_t;
+
+typedef struct elf_fixup {
+    elf_fixup_kind_t kind;
+    kefir_size_t chunk;
+    kefir_size_t offset;
+    kefir_size_t width;
+    kefir_size_t label;
+    kefir_size_t subtrahend;
+    kefir_asm_amd64_xasmgen_symbol_relocation_t relocation;
+    kefir_asm_amd64_encoder_fixup_relaxation_t relaxation;
+    kefir_int64_t addend;
+} elf_fixup_t;
+
+typedef struct elf_line_row {
+    kefir_size_t chunk;
+    kefir_size_t offset;
+    kefir_uint64_t file;
+    kefir_uint64_t line;
+    kefir_uint64_t column;
+} elf_line_row_t;
+
+typedef struct elf_section {
+    const char *name;
+    kefir_uint32_t type;
+    kefir_uint64_t flags;
+    kefir_uint64_t alignment;
+    kefir_uint64_t entry_size;
+
+    struct kefir_elf_buffer content;
+    struct elf_chunk *chunks;
+    kefir_size_t chunk_count;
+    kefir_size_t chunk_capacity;
+    struct elf_fixup *fixups;
+    kefir_size_t fixup_count;
+    kefir_size_t fixup_capacity;
+    struct elf_line_row *rows;
+    kefir_size_t row_count;
+    kefir_size_t row_capacity;
+
+    kefir_uint64_t size;
+    kefir_size_t object_section;
+    kefir_size_t sequence;
+} elf_section_t;
+
+typedef struct elf_label {
+    const char *name;
+    kefir_bool_t defined;
+    kefir_size_t section;
+    kefir_size_t chunk;
+    kefir_size_t offset;
+
+    kefir_bool_t global;
+    kefir_bool_t weak;
+    kefir_bool_t common;
+    kefir_bool_t thread_local_common;
+    kefir_uint64_t common_size;
+    kefir_uint64_t common_alignment;
+    kefir_uint8_t type;
+    kefir_uint8_t visibility;
+    const char *alias;
+
+    kefir_bool_t has_symbol;
+    kefir_size_t symbol;
+    kefir_size_t sequence;
+} elf_label_t;
+
+typedef struct elf_line_relocation {
+    kefir_size_t offset;
+    kefir_size_t section;
+    kefir_uint64_t address;
+} elf_line_relocation_t;
+
+typedef struct xasmgen_elf_payload {
+    struct kefir_mem *mem;
+    FILE *output;
+
+    struct kefir_string_pool strings;
+    struct kefir_hashtable label_index;
+    struct elf_label *labels;
+    kefir_size_t label_count;
+    kefir_size_t label_capacity;
+    struct elf_section *sections;
+    kefir_size_t section_count;
+    kefir_size_t section_capacity;
+    kefir_size_t current_section;
+    // Sections and labels are numbered in order of appearance, which determines the symbol table order
+    kefir_size_t next_sequence;
+
+    const char **files;
+    kefir_size_t file_count;
+    kefir_size_t file_capacity;
+    struct {
+        kefir_bool_t present;
+        kefir_uint64_t file;
+        kefir_uint64_t line;
+        kefir_uint64_t column;
+    } pending_location;
+    struct {
+        kefir_bool_t present;
+        kefir_size_t section;
+        kefir_size_t chunk;
+        kefir_size_t offset;
+    } lock_prefix;
+
+    char *format_buffer;
+    kefir_size_t format_buffer_capacity;
+} xasmgen_elf_payload_t;
+
+#define UNSUPPORTED(_msg) KEFIR_SET_ERROR(KEFIR_NOT_SUPPORTED, (_msg))
+#define LOCAL_LABEL_PREFIX ".L"
+
+static void *grow_array(struct kefir_mem *mem, void *array, kefir_size_t *capacity, kefir_size_t element_size) {
+    const kefir_size_t new_capacity = MAX(*capacity * 2, 16);
+    void *new_array = KEFIR_REALLOC(mem, array, new_capacity * element_size);
+    if (new_array != NULL) {
+        *capacity = new_capacity;
+    }
+    return new_array;
+}
+
+static kefir_result_t format_string(struct xasmgen_elf_payload *payload, const char *format, va_list args) {
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int length = vsnprintf(payload->format_buffer, payload->format_buffer_capacity, format, args_copy);
+    va_end(args_copy);
+    REQUIRE(length >= 0, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Failed to format assembly string"));
+
+    if ((kefir_size_t) length >= payload->format_buffer_capacity) {
+        const kefir_size_t new_capacity = MAX((kefir_size_t) length + 1, payload->format_buffer_capacity * 2);
+        char *new_buffer = KEFIR_REALLOC(payload->mem, payload->format_buffer, new_capacity);
+        REQUIRE(new_buffer != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate format buffer"));
+        payload->format_buffer = new_buffer;
+        payload->format_buffer_capacity = new_capacity;
+        length = vsnprintf(payload->format_buffer, payload->format_buffer_capacity, format, args);
+        REQUIRE(length >= 0, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Failed to format assembly string"));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t get_label(struct xasmgen_elf_payload *payload, const char *name, kefir_size_t *index_ptr) {
+    const char *symbol = kefir_string_pool_insert(payload->mem, &payload->strings, name, NULL);
+    REQUIRE(symbol != NULL, KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to insert symbol into string pool"));
+
+    kefir_hashtable_value_t value;
+    kefir_result_t res = kefir_hashtable_at(&payload->label_index, (kefir_hashtable_key_t) symbol, &value);
+    if (res != KEFIR_NOT_FOUND) {
+        REQUIRE_OK(res);
+        *index_ptr = (kefir_size_t) value;
+        return KEFIR_OK;
+    }
+
+    if (payload->label_count == payload->label_capacity) {
+        struct elf_label *labels =
+            grow_array(payload->mem, payload->labels, &payload->label_capacity, sizeof(struct elf_label));
+        REQUIRE(labels != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate assembly labels"));
+        payload->labels = labels;
+    }
+
+    struct elf_label *label = &payload->labels[payload->label_count];
+    memset(label, 0, sizeof(struct elf_label));
+    label->name = symbol;
+    label->sequence = payload->next_sequence++;
+    label->type = KEFIR_ELF(STT_NOTYPE);
+    label->visibility = KEFIR_ELF(STV_DEFAULT);
+    REQUIRE_OK(kefir_hashtable_insert(payload->mem, &payload->label_index, (kefir_hashtable_key_t) symbol,
+                                      (kefir_hashtable_value_t) payload->label_count));
+    *index_ptr = payload->label_count++;
+    return KEFIR_OK;
+}
+
+// GOT and TLS relocations implicitly reference the global offset table, which the GNU assembler records as an
+// undefined global symbol at the point of first use
+static kefir_result_t get_relocation_label(struct xasmgen_elf_payload *payload, const char *name,
+                                           kefir_asm_amd64_xasmgen_symbol_relocation_t relocation,
+                                           kefir_size_t *index_ptr) {
+    switch (relocation) {
+        case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_GOTPCREL:
+        case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_TPOFF:
+        case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_DTPOFF:
+        case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_GOTTPOFF:
+        case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_TLSGD: {
+            kefir_size_t got_index;
+            REQUIRE_OK(get_label(payload, "_GLOBAL_OFFSET_TABLE_", &got_index));
+            payload->labels[got_index].global = true;
+        } break;
+
+        case KEFIR_AMD64_XASMGEN_SYMBOL_ABSOLUTE:
+        case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_PLT:
+            // Intentionally left blank
+            break;
+    }
+    REQUIRE_OK(get_label(payload, name, index_ptr));
+    return KEFIR_OK;
+}
+
+static kefir_result_t format_label(struct xasmgen_elf_payload *payload, const char *format, va_list args,
+                                   kefir_size_t *index_ptr) {
+    REQUIRE_OK(format_string(payload, format, args));
+    REQUIRE_OK(get_label(payload, payload->format_buffer, index_ptr));
+    return KEFIR_OK;
+}
+
+static kefir_bool_t section_name_matches(const char *name, const char *prefix) {
+    const kefir_size_t length = strlen(prefix);
+    return strncmp(name, prefix, length) == 0 && (name[length] == '\0' || name[length] == '.');
+}
+
+static void classify_section(const char *name, kefir_uint64_t attributes, struct elf_section *section) {
+    section->type = KEFIR_ELF(SHT_PROGBITS);
+    section->flags = 0;
+    section->entry_size = 0;
+    if (section_name_matches(name, ".text")) {
+        section->flags = KEFIR_ELF(SHF_ALLOC) | KEFIR_ELF(SHF_EXECINSTR);
+    } else if (section_name_matches(name, ".data")) {
+        section->flags = KEFIR_ELF(SHF_ALLOC) | KEFIR_ELF(SHF_WRITE);
+    } else if (section_name_matches(name, ".rodata")) {
+        section->flags = KEFIR_ELF(SHF_ALLOC);
+    } else if (section_name_matches(name, ".bss")) {
+        section->type = KEFIR_ELF(SHT_NOBITS);
+        section->flags = KEFIR_ELF(SHF_ALLOC) | KEFIR_ELF(SHF_WRITE);
+    } else if (section_name_matches(name, ".tdata")) {
+        section->flags = KEFIR_ELF(SHF_ALLOC) | KEFIR_ELF(SHF_WRITE) | KEFIR_ELF(SHF_TLS);
+    } else if (section_name_matches(name, ".tbss")) {
+        section->type = KEFIR_ELF(SHT_NOBITS);
+        section->flags = KEFIR_ELF(SHF_ALLOC) | KEFIR_ELF(SHF_WRITE) | KEFIR_ELF(SHF_TLS);
+    } else if (section_name_matches(name, ".init_array")) {
+        section->type = KEFIR_ELF(SHT_INIT_ARRAY);
+        section->flags = KEFIR_ELF(SHF_ALLOC) | KEFIR_ELF(SHF_WRITE);
+        section->entry_size = 8;
+    } else if (section_name_matches(name, ".fini_array")) {
+        section->type = KEFIR_ELF(SHT_FINI_ARRAY);
+        section->flags = KEFIR_ELF(SHF_ALLOC) | KEFIR_ELF(SHF_WRITE);
+        section->entry_size = 8;
+    } else if (strcmp(name, ".debug_line_str") == 0) {
+        section->flags = KEFIR_ELF(SHF_MERGE) | KEFIR_ELF(SHF_STRINGS);
+        section->entry_size = 1;
+    } else if ((attributes & KEFIR_AMD64_XASMGEN_SECTION_TLS) != 0) {
+        section->flags = KEFIR_ELF(SHF_ALLOC) | KEFIR_ELF(SHF_WRITE) | KEFIR_ELF(SHF_TLS);
+    }
+}
+
+static kefir_result_t new_chunk(struct xasmgen_elf_payload *payload, struct elf_section *section) {
+    if (section->chunk_count == section->chunk_capacity) {
+        struct elf_chunk *chunks =
+            grow_array(payload->mem, section->chunks, &section->chunk_capacity, sizeof(struct elf_chunk));
+        REQUIRE(chunks != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate section chunks"));
+        section->chunks = chunks;
+    }
+
+    struct elf_chunk *chunk = &section->chunks[section->chunk_count++];
+    memset(chunk, 0, sizeof(struct elf_chunk));
+    chunk->content_offset = section->content.length;
+    chunk->tail = ELF_CHUNK_TAIL_NONE;
+    return KEFIR_OK;
+}
+
+static kefir_result_t switch_section(struct xasmgen_elf_payload *payload, const char *name,
+                                     kefir_uint64_t attributes) {
+    for (kefir_size_t i = 0; i < payload->section_count; i++) {
+        if (strcmp(payload->sections[i].name, name) == 0) {
+            payload->current_section = i;
+            return KEFIR_OK;
+        }
+    }
+
+    const char *section_name = kefir_string_pool_insert(payload->mem, &payload->strings, name, NULL);
+    REQUIRE(section_name != NULL,
+            KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to insert section name into string pool"));
+    if (payload->section_count == payload->section_capacity) {
+        struct elf_section *sections =
+            grow_array(payload->mem, payload->sections, &payload->section_capacity, sizeof(struct elf_section));
+        REQUIRE(sections != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate assembly sections"));
+        payload->sections = sections;
+    }
+
+    struct elf_section *section = &payload->sections[payload->section_count++];
+    memset(section, 0, sizeof(struct elf_section));
+    section->name = section_name;
+    section->alignment = 1;
+    section->sequence = payload->next_sequence++;
+    classify_section(name, attributes, section);
+    REQUIRE_OK(kefir_elf_buffer_init(&section->content));
+    REQUIRE_OK(new_chunk(payload, section));
+    payload->current_section = payload->section_count - 1;
+    return KEFIR_OK;
+}
+
+static struct elf_section *current_section(struct xasmgen_elf_payload *payload) {
+    return &payload->sections[payload->current_section];
+}
+
+static struct elf_chunk *current_chunk(struct elf_section *section) {
+    return &section->chunks[section->chunk_count - 1];
+}
+
+static kefir_result_t append_bytes(struct xasmgen_elf_payload *payload, const void *bytes, kefir_size_t length) {
+    struct elf_section *section = current_section(payload);
+    if (section->type == KEFIR_ELF(SHT_NOBITS)) {
+        for (kefir_size_t i = 0; i < length; i++) {
+            REQUIRE(((const kefir_uint8_t *) bytes)[i] == 0,
+                    UNSUPPORTED("Unable to emit non-zero data into uninitialized section"));
+        }
+    } else {
+        REQUIRE_OK(kefir_elf_buffer_append(payload->mem, &section->content, bytes, length));
+    }
+    current_chunk(section)->length += length;
+    return KEFIR_OK;
+}
+
+static kefir_result_t append_zeros(struct xasmgen_elf_payload *payload, kefir_size_t length) {
+    struct elf_section *section = current_section(payload);
+    if (section->type != KEFIR_ELF(SHT_NOBITS)) {
+        REQUIRE_OK(kefir_elf_buffer_append_zeros(payload->mem, &section->content, length));
+    }
+    current_chunk(section)->length += length;
+    return KEFIR_OK;
+}
+
+static kefir_result_t append_value(struct xasmgen_elf_payload *payload, kefir_uint64_t value, kefir_size_t width) {
+    kefir_uint8_t bytes[8];
+    for (kefir_size_t i = 0; i < width; i++) {
+        bytes[i] = (kefir_uint8_t) (value >> (i * 8));
+    }
+    REQUIRE_OK(append_bytes(payload, bytes, width));
+    return KEFIR_OK;
+}
+
+static kefir_result_t append_uleb128(struct xasmgen_elf_payload *payload, kefir_uint64_t value) {
+    kefir_uint8_t bytes[10];
+    kefir_size_t length = 0;
+    do {
+        kefir_uint8_t byte = value & 0x7f;
+        value >>= 7;
+        if (value != 0) {
+            byte |= 0x80;
+        }
+        bytes[length++] = byte;
+    } while (value != 0);
+    REQUIRE_OK(append_bytes(payload, bytes, length));
+    return KEFIR_OK;
+}
+
+static kefir_result_t add_fixup(struct xasmgen_elf_payload *payload, elf_fixup_kind_t kind, kefir_size_t width,
+                                kefir_size_t label, kefir_size_t subtrahend,
+                                kefir_asm_amd64_xasmgen_symbol_relocation_t relocation,
+                                kefir_asm_amd64_encoder_fixup_relaxation_t relaxation, kefir_int64_t addend,
+                                kefir_size_t offset) {
+    struct elf_section *section = current_section(payload);
+    REQUIRE(section->type != KEFIR_ELF(SHT_NOBITS),
+            UNSUPPORTED("Unable to emit relocations into uninitialized section"));
+    if (section->fixup_count == section->fixup_capacity) {
+        struct elf_fixup *fixups =
+            grow_array(payload->mem, section->fixups, &section->fixup_capacity, sizeof(struct elf_fixup));
+        REQUIRE(fixups != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate section fixups"));
+        section->fixups = fixups;
+    }
+
+    struct elf_fixup *fixup = &section->fixups[section->fixup_count++];
+    fixup->kind = kind;
+    fixup->chunk = section->chunk_count - 1;
+    fixup->offset = current_chunk(section)->length + offset;
+    fixup->width = width;
+    fixup->label = label;
+    fixup->subtrahend = subtrahend;
+    fixup->relocation = relocation;
+    fixup->relaxation = relaxation;
+    fixup->addend = addend;
+    return KEFIR_OK;
+}
+
+static kefir_result_t close_chunk(struct xasmgen_elf_payload *payload, elf_chunk_tail_t tail,
+                                  struct elf_chunk **chunk_ptr) {
+    struct elf_section *section = current_section(payload);
+    struct elf_chunk *chunk = current_chunk(section);
+    chunk->tail = tail;
+    const kefir_size_t chunk_index = section->chunk_count - 1;
+    REQUIRE_OK(new_chunk(payload, section));
+    *chunk_ptr = &section->chunks[chunk_index];
+    return KEFIR_OK;
+}
+
+static kefir_result_t add_line_row(struct xasmgen_elf_payload *payload) {
+    struct elf_section *section = current_section(payload);
+    if (section->row_count == section->row_capacity) {
+        struct elf_line_row *rows =
+            grow_array(payload->mem, section->rows, &section->row_capacity, sizeof(struct elf_line_row));
+        REQUIRE(rows != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate line number rows"));
+        section->rows = rows;
+    }
+
+    struct elf_line_row *row = &section->rows[section->row_count++];
+    row->chunk = section->chunk_count - 1;
+    row->offset = current_chunk(section)->length;
+    row->file = payload->pending_location.file;
+    row->line = payload->pending_location.line;
+    row->column = payload->pending_location.column;
+    payload->pending_location.present = false;
+    return KEFIR_OK;
+}
+
+static kefir_result_t define_label(struct xasmgen_elf_payload *payload, kefir_size_t index) {
+    struct elf_label *label = &payload->labels[index];
+    REQUIRE(!label->defined && !label->common && label->alias == NULL, UNSUPPORTED("Assembly label is redefined"));
+
+    struct elf_section *section = current_section(payload);
+    label->defined = true;
+    label->section = payload->current_section;
+    label->chunk = section->chunk_count - 1;
+    label->offset = current_chunk(section)->length;
+    return KEFIR_OK;
+}
+
+static kefir_result_t place_instruction(struct xasmgen_elf_payload *payload,
+                                        const struct kefir_asm_amd64_encoded_instruction *instruction) {
+    REQUIRE(current_section(payload)->type != KEFIR_ELF(SHT_NOBITS),
+            UNSUPPORTED("Unable to emit instructions into uninitialized section"));
+    if (payload->pending_location.present) {
+        REQUIRE_OK(add_line_row(payload));
+    }
+
+    // Lock prefix is emitted as a separate instruction, whereas the GNU assembler places it after segment, address
+    // and operand size prefixes of the instruction it precedes
+    struct elf_section *section = current_section(payload);
+    kefir_size_t lock_position = 0;
+    kefir_bool_t reorder_lock_prefix = payload->lock_prefix.present &&
+                                       payload->lock_prefix.section == payload->current_section &&
+                                       payload->lock_prefix.chunk == section->chunk_count - 1 &&
+                                       payload->lock_prefix.offset + 1 == current_chunk(section)->length;
+    payload->lock_prefix.present = false;
+    if (reorder_lock_prefix) {
+        while (lock_position < instruction->length &&
+               (instruction->bytes[lock_position] == 0x64 || instruction->bytes[lock_position] == 0x66 ||
+                instruction->bytes[lock_position] == 0x67)) {
+            lock_position++;
+        }
+        reorder_lock_prefix = lock_position > 0 && !instruction->branch.relaxable;
+    }
+    if (reorder_lock_prefix) {
+        section->content.length--;
+        current_chunk(section)->length--;
+    }
+
+    if (instruction->branch.relaxable) {
+        REQUIRE(instruction->fixup_count == 1, KEFIR_SET_ERROR(KEFIR_INVALID_STATE, "Expected single branch fixup"));
+        kefir_size_t target;
+        REQUIRE_OK(get_label(payload, instruction->fixups[0].symbol, &target));
+
+        struct elf_chunk *chunk;
+        REQUIRE_OK(close_chunk(payload, ELF_CHUNK_TAIL_BRANCH, &chunk));
+        chunk->branch.target = target;
+        // Encoder addend is relative to the displacement field of near branch
+        chunk->branch.addend = instruction->fixups[0].addend + 4;
+        chunk->branch.relocation = instruction->fixups[0].relocation;
+        chunk->branch.conditional = instruction->branch.conditional;
+        chunk->branch.condition = instruction->branch.condition;
+        chunk->branch.near = false;
+        return KEFIR_OK;
+    }
+
+    for (kefir_size_t i = 0; i < instruction->fixup_count; i++) {
+        const struct kefir_asm_amd64_encoder_fixup *fixup = &instruction->fixups[i];
+        kefir_size_t label;
+        REQUIRE_OK(get_relocation_label(payload, fixup->symbol, fixup->relocation, &label));
+
+        elf_fixup_kind_t kind = ELF_FIXUP_ABSOLUTE;
+        kefir_size_t width = 4;
+        switch (fixup->kind) {
+            case KEFIR_AMD64_ENCODER_FIXUP_ABSOLUTE32S:
+                kind = ELF_FIXUP_SIGNED_ABSOLUTE;
+                break;
+
+            case KEFIR_AMD64_ENCODER_FIXUP_ABSOLUTE64:
+                kind = ELF_FIXUP_ABSOLUTE;
+                width = 8;
+                break;
+
+            case KEFIR_AMD64_ENCODER_FIXUP_RELATIVE32:
+                kind = ELF_FIXUP_RELATIVE;
+                break;
+
+            case KEFIR_AMD64_ENCODER_FIXUP_BRANCH32:
+                kind = ELF_FIXUP_BRANCH;
+                break;
+        }
+        REQUIRE_OK(add_fixup(payload, kind, width, label, 0, fixup->relocation, fixup->relaxation, fixup->addend,
+                             fixup->offset + (reorder_lock_prefix ? 1 : 0)));
+    }
+    if (reorder_lock_prefix) {
+        static const kefir_uint8_t lock_prefix = 0xf0;
+        REQUIRE_OK(append_bytes(payload, instruction->bytes, lock_position));
+        REQUIRE_OK(append_bytes(payload, &lock_prefix, 1));
+        REQUIRE_OK(
+            append_bytes(payload, instruction->bytes + lock_position, instruction->length - lock_position));
+    } else {
+        REQUIRE_OK(append_bytes(payload, instruction->bytes, instruction->length));
+    }
+
+    if (instruction->length == 1 && instruction->bytes[0] == 0xf0) {
+        payload->lock_prefix.present = true;
+        payload->lock_prefix.section = payload->current_section;
+        payload->lock_prefix.chunk = section->chunk_count - 1;
+        payload->lock_prefix.offset = current_chunk(section)->length - 1;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t emit_instruction(struct xasmgen_elf_payload *payload, kefir_asm_amd64_encoder_opcode_t opcode,
+                                       kefir_bool_t rep, const struct kefir_asm_amd64_xasmgen_operand *op1,
+                                       const struct kefir_asm_amd64_xasmgen_operand *op2,
+                                       const struct kefir_asm_amd64_xasmgen_operand *op3) {
+    struct kefir_asm_amd64_encoded_instruction instruction;
+    REQUIRE_OK(kefir_asm_amd64_encode_instruction(opcode, rep, op1, op2, op3, &instruction));
+    REQUIRE_OK(place_instruction(payload, &instruction));
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_prologue(struct kefir_amd64_xasmgen *xasmgen) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    REQUIRE_OK(switch_section(payload, ".note.GNU-stack", KEFIR_AMD64_XASMGEN_SECTION_NOATTR));
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_newline(struct kefir_amd64_xasmgen *xasmgen, unsigned int count) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    UNUSED(count);
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_comment(struct kefir_amd64_xasmgen *xasmgen, const char *format, ...) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    UNUSED(format);
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_label(struct kefir_amd64_xasmgen *xasmgen, const char *format, ...) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    kefir_size_t index;
+    va_list args;
+    va_start(args, format);
+    kefir_result_t res = format_label(payload, format, args, &index);
+    va_end(args);
+    REQUIRE_OK(res);
+
+    REQUIRE_OK(define_label(payload, index));
+    return KEFIR_OK;
+}
+
+static kefir_result_t declare_symbol(struct xasmgen_elf_payload *payload, kefir_size_t index, kefir_bool_t weak,
+                                     kefir_amd64_xasmgen_type_attribute_t type,
+                                     kefir_amd64_xasmgen_visibility_attribute_t visibility) {
+    struct elf_label *label = &payload->labels[index];
+    if (weak) {
+        label->weak = true;
+    } else {
+        label->global = true;
+    }
+
+    switch (type) {
+        case KEFIR_AMD64_XASMGEN_TYPE_FUNCTION:
+            label->type = KEFIR_ELF(STT_FUNC);
+            break;
+
+        case KEFIR_AMD64_XASMGEN_TYPE_DATA:
+            label->type = KEFIR_ELF(STT_OBJECT);
+            break;
+    }
+
+    switch (visibility) {
+        case KEFIR_AMD64_XASMGEN_VISIBILITY_DEFAULT:
+            // Intentionally left blank
+            break;
+
+        case KEFIR_AMD64_XASMGEN_VISIBILITY_HIDDEN:
+            label->visibility = KEFIR_ELF(STV_HIDDEN);
+            break;
+
+        case KEFIR_AMD64_XASMGEN_VISIBILITY_INTERNAL:
+            label->visibility = KEFIR_ELF(STV_INTERNAL);
+            break;
+
+        case KEFIR_AMD64_XASMGEN_VISIBILITY_PROTECTED:
+            label->visibility = KEFIR_ELF(STV_PROTECTED);
+            break;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_global(struct kefir_amd64_xasmgen *xasmgen, kefir_amd64_xasmgen_type_attribute_t type,
+                                 kefir_amd64_xasmgen_visibility_attribute_t visibility, const char *format, ...) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    kefir_size_t index;
+    va_list args;
+    va_start(args, format);
+    kefir_result_t res = format_label(payload, format, args, &index);
+    va_end(args);
+    REQUIRE_OK(res);
+
+    REQUIRE_OK(declare_symbol(payload, index, false, type, visibility));
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_weak(struct kefir_amd64_xasmgen *xasmgen, kefir_amd64_xasmgen_type_attribute_t type,
+                               kefir_amd64_xasmgen_visibility_attribute_t visibility, const char *format, ...) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    kefir_size_t index;
+    va_list args;
+    va_start(args, format);
+    kefir_result_t res = format_label(payload, format, args, &index);
+    va_end(args);
+    REQUIRE_OK(res);
+
+    REQUIRE_OK(declare_symbol(payload, index, true, type, visibility));
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_external(struct kefir_amd64_xasmgen *xasmgen, const char *format, ...) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    // Undefined symbols are external implicitly. The label is registered upon first reference, so that
+    // symbol table order is not affected by the declaration
+    UNUSED(payload);
+    UNUSED(format);
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_alias(struct kefir_amd64_xasmgen *xasmgen, const char *alias, const char *original) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    REQUIRE(alias != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid alias"));
+    REQUIRE(original != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid aliased symbol"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    kefir_size_t alias_index, original_index;
+    REQUIRE_OK(get_label(payload, alias, &alias_index));
+    REQUIRE_OK(get_label(payload, original, &original_index));
+    struct elf_label *label = &payload->labels[alias_index];
+    REQUIRE(!label->defined && !label->common && label->alias == NULL,
+            KEFIR_SET_ERRORF(KEFIR_ALREADY_EXISTS, "Unable to redefine symbol '%s' as an alias", alias));
+    label->alias = payload->labels[original_index].name;
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_common(struct kefir_amd64_xasmgen *xasmgen, kefir_bool_t global, kefir_size_t size,
+                                 kefir_size_t alignment, const char *format, ...) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    kefir_size_t index;
+    va_list args;
+    va_start(args, format);
+    kefir_result_t res = format_label(payload, format, args, &index);
+    va_end(args);
+    REQUIRE_OK(res);
+
+    struct elf_label *label = &payload->labels[index];
+    REQUIRE(!label->defined && !label->common && label->alias == NULL,
+            KEFIR_SET_ERRORF(KEFIR_ALREADY_EXISTS, "Unable to redefine symbol '%s' as common", label->name));
+    label->common = true;
+    label->thread_local_common = !global;
+    label->common_size = size;
+    label->common_alignment = alignment;
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_section(struct kefir_amd64_xasmgen *xasmgen, const char *identifier,
+                                  kefir_uint64_t section_attr) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    REQUIRE(identifier != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid section identifier"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    REQUIRE_OK(switch_section(payload, identifier, section_attr));
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_align(struct kefir_amd64_xasmgen *xasmgen, kefir_size_t alignment) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    if (alignment > 1) {
+        REQUIRE((alignment & (alignment - 1)) == 0, UNSUPPORTED("Unable to align to non-power-of-2 boundary"));
+        struct elf_section *section = current_section(payload);
+        section->alignment = MAX(section->alignment, alignment);
+        struct elf_chunk *chunk;
+        REQUIRE_OK(close_chunk(payload, ELF_CHUNK_TAIL_ALIGN, &chunk));
+        chunk->alignment = alignment;
+    }
+    return KEFIR_OK;
+}
+
+typedef struct elf_data_expression {
+    kefir_bool_t has_symbol;
+    kefir_size_t symbol;
+    kefir_bool_t has_subtrahend;
+    kefir_size_t subtrahend;
+    kefir_asm_amd64_xasmgen_symbol_relocation_t relocation;
+    kefir_int64_t addend;
+} elf_data_expression_t;
+
+static kefir_result_t evaluate_data_operand(struct xasmgen_elf_payload *payload,
+                                            const struct kefir_asm_amd64_xasmgen_operand *op,
+                                            struct elf_data_expression *expr) {
+    switch (op->klass) {
+        case KEFIR_AMD64_XASMGEN_OPERAND_IMMEDIATE:
+            expr->addend += op->imm;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_IMMEDIATE_UNSIGNED:
+            expr->addend += (kefir_int64_t) op->immu;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_LABEL:
+            REQUIRE(!expr->has_symbol, UNSUPPORTED("Unsupported data expression"));
+            REQUIRE_OK(get_relocation_label(payload, op->label.symbol, op->label.type, &expr->symbol));
+            expr->has_symbol = true;
+            expr->relocation = op->label.type;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_OFFSET:
+            REQUIRE_OK(evaluate_data_operand(payload, op->offset.base, expr));
+            expr->addend += op->offset.offset;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_OPERAND_SUBTRACT: {
+            struct elf_data_expression subtrahend = {0};
+            REQUIRE_OK(evaluate_data_operand(payload, op->arithmetics.args[0], expr));
+            REQUIRE_OK(evaluate_data_operand(payload, op->arithmetics.args[1], &subtrahend));
+            REQUIRE(!subtrahend.has_subtrahend && !expr->has_subtrahend,
+                    UNSUPPORTED("Unsupported data expression"));
+            if (subtrahend.has_symbol) {
+                REQUIRE(expr->has_symbol && expr->relocation == KEFIR_AMD64_XASMGEN_SYMBOL_ABSOLUTE &&
+                            subtrahend.relocation == KEFIR_AMD64_XASMGEN_SYMBOL_ABSOLUTE,
+                        UNSUPPORTED("Unsupported data expression"));
+                expr->has_subtrahend = true;
+                expr->subtrahend = subtrahend.symbol;
+            }
+            expr->addend -= subtrahend.addend;
+        } break;
+
+        default:
+            return UNSUPPORTED("Unsupported data expression");
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t emit_data(struct xasmgen_elf_payload *payload, kefir_asm_amd64_xasmgen_data_type_t type,
+                                const struct kefir_asm_amd64_xasmgen_operand *op) {
+    kefir_size_t width = 0;
+    switch (type) {
+        case KEFIR_AMD64_XASMGEN_DATA_BYTE:
+            width = 1;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_DATA_WORD:
+            width = 2;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_DATA_DOUBLE:
+            width = 4;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_DATA_QUAD:
+            width = 8;
+            break;
+
+        case KEFIR_AMD64_XASMGEN_DATA_ASCII:
+            REQUIRE(op->klass == KEFIR_AMD64_XASMGEN_OPERAND_STRING_LITERAL,
+                    UNSUPPORTED("Expected string literal operand"));
+            REQUIRE_OK(append_bytes(payload, op->string_literal.content, op->string_literal.length));
+            return KEFIR_OK;
+
+        case KEFIR_AMD64_XASMGEN_DATA_ULEB128:
+            break;
+    }
+
+    struct elf_data_expression expr = {0};
+    REQUIRE_OK(evaluate_data_operand(payload, op, &expr));
+    if (type == KEFIR_AMD64_XASMGEN_DATA_ULEB128) {
+        if (!expr.has_symbol) {
+            REQUIRE_OK(append_uleb128(payload, (kefir_uint64_t) expr.addend));
+        } else {
+            REQUIRE(expr.has_subtrahend, UNSUPPORTED("Unable to encode relocatable ULEB128 value"));
+            REQUIRE(current_section(payload)->type != KEFIR_ELF(SHT_NOBITS),
+                    UNSUPPORTED("Unable to emit data into uninitialized section"));
+            struct elf_chunk *chunk;
+            REQUIRE_OK(close_chunk(payload, ELF_CHUNK_TAIL_ULEB128, &chunk));
+            chunk->uleb128.minuend = expr.symbol;
+            chunk->uleb128.subtrahend = expr.subtrahend;
+            chunk->uleb128.addend = expr.addend;
+            chunk->tail_length = 1;
+        }
+    } else if (!expr.has_symbol) {
+        REQUIRE_OK(append_value(payload, (kefir_uint64_t) expr.addend, width));
+    } else if (expr.has_subtrahend) {
+        REQUIRE_OK(add_fixup(payload, ELF_FIXUP_DIFFERENCE, width, expr.symbol, expr.subtrahend, expr.relocation,
+                             KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_NONE, expr.addend, 0));
+        REQUIRE_OK(append_zeros(payload, width));
+    } else {
+        REQUIRE_OK(add_fixup(payload, ELF_FIXUP_ABSOLUTE, width, expr.symbol, 0, expr.relocation,
+                             KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_NONE, expr.addend, 0));
+        REQUIRE_OK(append_zeros(payload, width));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_data(struct kefir_amd64_xasmgen *xasmgen, kefir_asm_amd64_xasmgen_data_type_t type,
+                               kefir_size_t length, ...) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    va_list args;
+    va_start(args, length);
+    kefir_result_t res = KEFIR_OK;
+    while (res == KEFIR_OK && length--) {
+        const struct kefir_asm_amd64_xasmgen_operand *op = va_arg(args, const struct kefir_asm_amd64_xasmgen_operand *);
+        res = emit_data(payload, type, op);
+    }
+    va_end(args);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_zerodata(struct kefir_amd64_xasmgen *xasmgen, kefir_size_t length) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    REQUIRE_OK(append_zeros(payload, length));
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_uninitdata(struct kefir_amd64_xasmgen *xasmgen, kefir_size_t length) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    REQUIRE_OK(append_zeros(payload, length));
+    return KEFIR_OK;
+}
+
+static kefir_result_t emit_bindata(struct xasmgen_elf_payload *payload, kefir_asm_amd64_xasmgen_data_type_t type,
+                                   const void *ptr, kefir_size_t length) {
+    switch (type) {
+        case KEFIR_AMD64_XASMGEN_DATA_BYTE:
+        case KEFIR_AMD64_XASMGEN_DATA_ASCII:
+            REQUIRE_OK(append_bytes(payload, ptr, length));
+            break;
+
+        case KEFIR_AMD64_XASMGEN_DATA_WORD:
+            for (kefir_size_t i = 0; i < length; i++) {
+                REQUIRE_OK(append_value(payload, ((const kefir_uint16_t *) ptr)[i], 2));
+            }
+            break;
+
+        case KEFIR_AMD64_XASMGEN_DATA_DOUBLE:
+            for (kefir_size_t i = 0; i < length; i++) {
+                REQUIRE_OK(append_value(payload, ((const kefir_uint32_t *) ptr)[i], 4));
+            }
+            break;
+
+        case KEFIR_AMD64_XASMGEN_DATA_QUAD:
+            for (kefir_size_t i = 0; i < length; i++) {
+                REQUIRE_OK(append_value(payload, ((const kefir_uint64_t *) ptr)[i], 8));
+            }
+            break;
+
+        case KEFIR_AMD64_XASMGEN_DATA_ULEB128:
+            for (kefir_size_t i = 0; i < length; i++) {
+                REQUIRE_OK(append_uleb128(payload, ((const kefir_uint64_t *) ptr)[i]));
+            }
+            break;
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_bindata(struct kefir_amd64_xasmgen *xasmgen, kefir_asm_amd64_xasmgen_data_type_t type,
+                                  const void *ptr, kefir_size_t length) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    REQUIRE(ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid binary data"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    REQUIRE_OK(emit_bindata(payload, type, ptr, length));
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_inline_assembly(struct kefir_amd64_xasmgen *xasmgen, const char *text) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    REQUIRE(text != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid inline assembly text"));
+
+    return UNSUPPORTED("Integrated assembler is unable to encode inline assembly");
+}
+
+static kefir_result_t elf_format_operand(struct kefir_amd64_xasmgen *xasmgen,
+                                         const struct kefir_asm_amd64_xasmgen_operand *op, char *buf,
+                                         kefir_size_t buflen) {
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    UNUSED(op);
+    UNUSED(buf);
+    UNUSED(buflen);
+
+    return UNSUPPORTED("Integrated assembler is unable to format textual operands");
+}
+
+typedef struct elf_debug_info_tracker {
+    struct kefir_hashtable files;
+    kefir_uint64_t next_fileno;
+} elf_debug_info_tracker_t;
+
+static kefir_result_t elf_new_debug_info_tracker(struct kefir_mem *mem, struct kefir_amd64_xasmgen *xasmgen,
+                                                 kefir_amd64_xasmgen_debug_info_tracker_t *tracker_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid amd64 xasmgen"));
+    REQUIRE(tracker_ptr != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to amd64 xasmgen debug info tracker"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    struct elf_debug_info_tracker *tracker = KEFIR_MALLOC(mem, sizeof(struct elf_debug_info_tracker));
+    REQUIRE(tracker != NULL,
+            KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate amd64 xasmgen debug info tracker"));
+    tracker->next_fileno = 0;
+    kefir_result_t res = kefir_hashtable_init(&tracker->files, &kefir_hashtable_uint_ops);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        KEFIR_FREE(mem, tracker);
+        return res;
+    });
+
+    *tracker_ptr = (kefir_amd64_xasmgen_debug_info_tracker_t) tracker;
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_free_debug_info_tracker(struct kefir_mem *mem, struct kefir_amd64_xasmgen *xasmgen,
+                                                  kefir_amd64_xasmgen_debug_info_tracker_t tracker) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid amd64 xasmgen"));
+    ASSIGN_DECL_CAST(struct elf_debug_info_tracker *, debug_info_tracker, tracker);
+    REQUIRE(debug_info_tracker != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid amd64 xasmgen debug info tracker"));
+
+    REQUIRE_OK(kefir_hashtable_free(mem, &debug_info_tracker->files));
+    KEFIR_FREE(mem, debug_info_tracker);
+    return KEFIR_OK;
+}
+
+static kefir_result_t register_line_file(struct xasmgen_elf_payload *payload, kefir_uint64_t fileno,
+                                         const char *source) {
+    if (fileno < payload->file_count) {
+        // Line number program has a single file table for all trackers
+        REQUIRE(payload->files[fileno] == source, UNSUPPORTED("Conflicting debug information file numbers"));
+        return KEFIR_OK;
+    }
+    REQUIRE(fileno == payload->file_count, UNSUPPORTED("Non-sequential debug information file numbers"));
+
+    if (payload->file_count == payload->file_capacity) {
+        const char **files = grow_array(payload->mem, payload->files, &payload->file_capacity, sizeof(const char *));
+        REQUIRE(files != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate line number file table"));
+        payload->files = files;
+    }
+    payload->files[payload->file_count++] = source;
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_debug_info_source_location(struct kefir_mem *mem, struct kefir_amd64_xasmgen *xasmgen,
+                                                     kefir_amd64_xasmgen_debug_info_tracker_t tracker,
+                                                     const struct kefir_source_location *source_location) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid amd64 xasmgen"));
+    ASSIGN_DECL_CAST(struct elf_debug_info_tracker *, debug_info_tracker, tracker);
+    REQUIRE(debug_info_tracker != NULL,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid amd64 xasmgen debug info tracker"));
+    REQUIRE(source_location != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid source location"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    // File numbering follows the textual tracker
+    const char *source = kefir_string_pool_insert(mem, &payload->strings, source_location->source, NULL);
+    REQUIRE(source != NULL, KEFIR_SET_ERROR(KEFIR_OBJALLOC_FAILURE, "Failed to insert source into string pool"));
+    kefir_hashtable_value_t value;
+    kefir_result_t res = kefir_hashtable_at(&debug_info_tracker->files, (kefir_hashtable_key_t) source, &value);
+    kefir_uint64_t fileno;
+    if (res == KEFIR_NOT_FOUND) {
+        fileno = debug_info_tracker->next_fileno++;
+        REQUIRE_OK(kefir_hashtable_insert(mem, &debug_info_tracker->files, (kefir_hashtable_key_t) source,
+                                          (kefir_hashtable_value_t) fileno));
+    } else {
+        REQUIRE_OK(res);
+        fileno = (kefir_uint64_t) value;
+    }
+    REQUIRE_OK(register_line_file(payload, fileno, source));
+
+    // Consecutive locations without intervening instructions produce separate rows, same as with .loc directives
+    if (payload->pending_location.present) {
+        REQUIRE_OK(add_line_row(payload));
+    }
+    payload->pending_location.present = true;
+    payload->pending_location.file = fileno;
+    payload->pending_location.line = source_location->line;
+    payload->pending_location.column = source_location->column;
+    return KEFIR_OK;
+}
+
+static kefir_bool_t label_is_local(const struct elf_label *label) {
+    return label->defined && !label->global && !label->weak && !label->common;
+}
+
+static kefir_uint64_t label_address(const struct xasmgen_elf_payload *payload, const struct elf_label *label) {
+    return payload->sections[label->section].chunks[label->chunk].address + label->offset;
+}
+
+static kefir_result_t resolve_aliases(struct xasmgen_elf_payload *payload) {
+    kefir_bool_t changed = true;
+    kefir_bool_t unresolved = false;
+    while (changed) {
+        changed = false;
+        unresolved = false;
+        for (kefir_size_t i = 0; i < payload->label_count; i++) {
+            struct elf_label *label = &payload->labels[i];
+            if (label->alias == NULL) {
+                continue;
+            }
+
+            kefir_size_t original_index;
+            REQUIRE_OK(get_label(payload, label->alias, &original_index));
+            label = &payload->labels[i];
+            const struct elf_label *original = &payload->labels[original_index];
+            if (original->defined) {
+                label->defined = true;
+                label->section = original->section;
+                label->chunk = original->chunk;
+                label->offset = original->offset;
+                if (label->type == KEFIR_ELF(STT_NOTYPE)) {
+                    label->type = original->type;
+                }
+                label->alias = NULL;
+                changed = true;
+            } else {
+                unresolved = true;
+            }
+        }
+    }
+    REQUIRE(!unresolved, UNSUPPORTED("Unable to resolve symbol alias"));
+    return KEFIR_OK;
+}
+
+static kefir_bool_t branch_resolvable(const struct xasmgen_elf_payload *payload, kefir_size_t section_index,
+                                      const struct elf_chunk *chunk) {
+    const struct elf_label *target = &payload->labels[chunk->branch.target];
+    if (!target->defined || target->section != section_index) {
+        return false;
+    }
+    if (chunk->branch.relocation == KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_PLT) {
+        return label_is_local(target);
+    }
+    return !target->weak && !target->common;
+}
+
+static kefir_size_t uleb128_length(kefir_uint64_t value) {
+    kefir_size_t length = 1;
+    for (value >>= 7; value != 0; value >>= 7) {
+        length++;
+    }
+    return length;
+}
+
+static kefir_result_t evaluate_difference(const struct xasmgen_elf_payload *payload, kefir_size_t minuend,
+                                          kefir_size_t subtrahend, kefir_int64_t addend, kefir_int64_t *value_ptr) {
+    const struct elf_label *minuend_label = &payload->labels[minuend];
+    const struct elf_label *subtrahend_label = &payload->labels[subtrahend];
+    REQUIRE(minuend_label->defined && subtrahend_label->defined &&
+                minuend_label->section == subtrahend_label->section,
+            UNSUPPORTED("Unable to evaluate difference of symbols from different sections"));
+    *value_ptr = (kefir_int64_t) (label_address(payload, minuend_label) - label_address(payload, subtrahend_label)) +
+                 addend;
+    return KEFIR_OK;
+}
+
+static kefir_size_t branch_length(const struct elf_chunk *chunk) {
+    if (!chunk->branch.near) {
+        return 2;
+    }
+    return chunk->branch.conditional ? 6 : 5;
+}
+
+static void compute_addresses(struct xasmgen_elf_payload *payload) {
+    for (kefir_size_t i = 0; i < payload->section_count; i++) {
+        struct elf_section *section = &payload->sections[i];
+        kefir_uint64_t address = 0;
+        for (kefir_size_t j = 0; j < section->chunk_count; j++) {
+            struct elf_chunk *chunk = &section->chunks[j];
+            chunk->address = address;
+            address += chunk->length;
+            switch (chunk->tail) {
+                case ELF_CHUNK_TAIL_NONE:
+                    chunk->tail_length = 0;
+                    break;
+
+                case ELF_CHUNK_TAIL_ALIGN:
+                    chunk->tail_length = (chunk->alignment - address % chunk->alignment) % chunk->alignment;
+                    break;
+
+                case ELF_CHUNK_TAIL_BRANCH:
+                    chunk->tail_length = branch_length(chunk);
+                    break;
+
+                case ELF_CHUNK_TAIL_ULEB128:
+                    // Intentionally left blank
+                    break;
+            }
+            address += chunk->tail_length;
+        }
+        section->size = address;
+    }
+}
+
+// Branches start in short form whenever the target might be in range and grow monotonically, which guarantees
+// termination of the layout.
+static kefir_result_t layout_sections(struct xasmgen_elf_payload *payload) {
+    for (kefir_size_t i = 0; i < payload->section_count; i++) {
+        struct elf_section *section = &payload->sections[i];
+        for (kefir_size_t j = 0; j < section->chunk_count; j++) {
+            struct elf_chunk *chunk = &section->chunks[j];
+            if (chunk->tail == ELF_CHUNK_TAIL_BRANCH) {
+                chunk->branch.near = !branch_resolvable(payload, i, chunk);
+            }
+        }
+    }
+
+    kefir_bool_t changed = true;
+    while (changed) {
+        changed = false;
+        compute_addresses(payload);
+        for (kefir_size_t i = 0; i < payload->section_count; i++) {
+            struct elf_section *section = &payload->sections[i];
+            for (kefir_size_t j = 0; j < section->chunk_count; j++) {
+                struct elf_chunk *chunk = &section->chunks[j];
+                if (chunk->tail == ELF_CHUNK_TAIL_BRANCH && !chunk->branch.near) {
+                    const kefir_int64_t target =
+                        (kefir_int64_t) label_address(payload, &payload->labels[chunk->branch.target]) +
+                        chunk->branch.addend;
+                    const kefir_int64_t displacement =
+                        target - (kefir_int64_t) (chunk->address + chunk->length + chunk->tail_length);
+                    if (displacement < KEFIR_INT8_MIN || displacement > KEFIR_INT8_MAX) {
+                        chunk->branch.near = true;
+                        changed = true;
+                    }
+                } else if (chunk->tail == ELF_CHUNK_TAIL_ULEB128) {
+                    kefir_int64_t value;
+                    REQUIRE_OK(evaluate_difference(payload, chunk->uleb128.minuend, chunk->uleb128.subtrahend,
+                                                   chunk->uleb128.addend, &value));
+                    REQUIRE(value >= 0, UNSUPPORTED("Unable to encode negative ULEB128 value"));
+                    const kefir_size_t length = uleb128_length((kefir_uint64_t) value);
+                    if (length > chunk->tail_length) {
+                        chunk->tail_length = length;
+                        changed = true;
+                    }
+                }
+            }
+        }
+    }
+    return KEFIR_OK;
+}
+
+static const kefir_uint8_t NOP_PATTERNS[11][11] = {
+    {0x90},
+    {0x66, 0x90},
+    {0x0f, 0x1f, 0x00},
+    {0x0f, 0x1f, 0x40, 0x00},
+    {0x0f, 0x1f, 0x44, 0x00, 0x00},
+    {0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00},
+    {0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00}};
+#define MAX_NOP_LENGTH (sizeof(NOP_PATTERNS) / sizeof(NOP_PATTERNS[0]))
+
+static kefir_result_t append_nops(struct kefir_mem *mem, struct kefir_elf_buffer *buffer, kefir_size_t length) {
+    for (; length >= MAX_NOP_LENGTH; length -= MAX_NOP_LENGTH) {
+        REQUIRE_OK(kefir_elf_buffer_append(mem, buffer, NOP_PATTERNS[MAX_NOP_LENGTH - 1], MAX_NOP_LENGTH));
+    }
+    if (length > 0) {
+        REQUIRE_OK(kefir_elf_buffer_append(mem, buffer, NOP_PATTERNS[length - 1], length));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t label_symbol(struct xasmgen_elf_payload *payload, struct kefir_elf_object *object,
+                                   kefir_size_t index, kefir_bool_t thread_local, kefir_size_t *symbol_ptr) {
+    struct elf_label *label = &payload->labels[index];
+    if (!label->has_symbol) {
+        kefir_uint8_t binding = KEFIR_ELF(STB_LOCAL);
+        if (label->weak) {
+            binding = KEFIR_ELF(STB_WEAK);
+        } else if (label->global || label->common || !label->defined) {
+            binding = KEFIR_ELF(STB_GLOBAL);
+        }
+
+        kefir_uint8_t type = label->type;
+        if (label->common) {
+            type = label->thread_local_common ? KEFIR_ELF(STT_TLS) : KEFIR_ELF(STT_OBJECT);
+        } else if (label->defined &&
+                   (payload->sections[label->section].flags & KEFIR_ELF(SHF_TLS)) != 0) {
+            type = KEFIR_ELF(STT_TLS);
+        }
+
+        REQUIRE_OK(kefir_elf_object_new_symbol(payload->mem, object, label->name, binding, type, label->visibility,
+                                               &label->symbol));
+        REQUIRE_OK(kefir_elf_object_set_symbol_order(object, label->symbol, label->sequence));
+        label->has_symbol = true;
+        if (label->common) {
+            REQUIRE_OK(kefir_elf_object_define_special_symbol(object, label->symbol, KEFIR_ELF(SHN_COMMON),
+                                                              label->common_alignment, label->common_size));
+        } else if (label->defined) {
+            REQUIRE_OK(kefir_elf_object_define_symbol(object, label->symbol,
+                                                      payload->sections[label->section].object_section,
+                                                      label_address(payload, label), 0));
+        }
+    }
+
+    if (thread_local) {
+        object->symbols[label->symbol].type = KEFIR_ELF(STT_TLS);
+    }
+    *symbol_ptr = label->symbol;
+    return KEFIR_OK;
+}
+
+static kefir_result_t section_symbol(struct xasmgen_elf_payload *payload, struct kefir_elf_object *object,
+                                     kefir_size_t section_index, kefir_size_t *symbol_ptr) {
+    const struct elf_section *section = &payload->sections[section_index];
+    REQUIRE_OK(kefir_elf_object_section_symbol(payload->mem, object, section->object_section, symbol_ptr));
+    REQUIRE_OK(kefir_elf_object_set_symbol_order(object, *symbol_ptr, section->sequence));
+    return KEFIR_OK;
+}
+
+// Relocations against local symbols are expressed relative to the section symbol, same as the GNU assembler does
+static kefir_result_t symbol_reference(struct xasmgen_elf_payload *payload, struct kefir_elf_object *object,
+                                       kefir_size_t index, kefir_int64_t *addend, kefir_size_t *symbol_ptr) {
+    const struct elf_label *label = &payload->labels[index];
+    if (label_is_local(label)) {
+        REQUIRE_OK(section_symbol(payload, object, label->section, symbol_ptr));
+        *addend += (kefir_int64_t) label_address(payload, label);
+    } else {
+        REQUIRE_OK(label_symbol(payload, object, index, false, symbol_ptr));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t branch_relocation(struct xasmgen_elf_payload *payload, struct kefir_elf_object *object,
+                                        kefir_size_t section_index, kefir_uint64_t position, kefir_size_t index,
+                                        kefir_asm_amd64_xasmgen_symbol_relocation_t relocation,
+                                        kefir_int64_t addend) {
+    const struct elf_label *label = &payload->labels[index];
+    const kefir_size_t object_section = payload->sections[section_index].object_section;
+    kefir_size_t symbol;
+    if (relocation == KEFIR_AMD64_XASMGEN_SYMBOL_ABSOLUTE && label_is_local(label)) {
+        REQUIRE_OK(symbol_reference(payload, object, index, &addend, &symbol));
+        REQUIRE_OK(kefir_elf_object_add_relocation(payload->mem, object, object_section, position,
+                                                   KEFIR_ELF(R_X86_64_PC32), symbol, addend));
+    } else {
+        REQUIRE(relocation == KEFIR_AMD64_XASMGEN_SYMBOL_ABSOLUTE ||
+                    relocation == KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_PLT,
+                UNSUPPORTED("Unsupported branch target relocation"));
+        REQUIRE_OK(label_symbol(payload, object, index, false, &symbol));
+        REQUIRE_OK(kefir_elf_object_add_relocation(payload->mem, object, object_section, position,
+                                                   KEFIR_ELF(R_X86_64_PLT32), symbol, addend));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t write_relative(struct kefir_elf_buffer *content, kefir_uint64_t position, kefir_int64_t value,
+                                     kefir_size_t width) {
+    REQUIRE(value >= KEFIR_INT32_MIN && value <= KEFIR_INT32_MAX, UNSUPPORTED("Relative offset is out of range"));
+    kefir_elf_buffer_write_le(content, position, (kefir_uint64_t) value, width);
+    return KEFIR_OK;
+}
+
+static kefir_result_t apply_fixup(struct xasmgen_elf_payload *payload, struct kefir_elf_object *object,
+                                  kefir_size_t section_index, const struct elf_fixup *fixup) {
+    const struct elf_section *section = &payload->sections[section_index];
+    struct kefir_elf_buffer *content = &object->sections[section->object_section].content;
+    const kefir_uint64_t position = section->chunks[fixup->chunk].address + fixup->offset;
+    const struct elf_label *label = &payload->labels[fixup->label];
+    const kefir_bool_t same_section = label->defined && label->section == section_index;
+    kefir_int64_t addend = fixup->addend;
+    kefir_size_t symbol;
+    kefir_uint32_t type = KEFIR_ELF(R_X86_64_NONE);
+
+    switch (fixup->kind) {
+        case ELF_FIXUP_DIFFERENCE: {
+            const struct elf_label *subtrahend_label = &payload->labels[fixup->subtrahend];
+            if (!same_section && subtrahend_label->defined && subtrahend_label->section == section_index) {
+                // Difference between a foreign label and a label of the current section is encoded as
+                // PC-relative relocation adjusted by the distance between the subtrahend and the fixup
+                REQUIRE(fixup->width == 4 || fixup->width == 8,
+                        UNSUPPORTED("Unsupported cross-section label difference width"));
+                type = fixup->width == 8 ? KEFIR_ELF(R_X86_64_PC64) : KEFIR_ELF(R_X86_64_PC32);
+                addend += (kefir_int64_t) position - (kefir_int64_t) label_address(payload, subtrahend_label);
+                REQUIRE_OK(symbol_reference(payload, object, fixup->label, &addend, &symbol));
+                break;
+            }
+
+            kefir_int64_t value;
+            REQUIRE_OK(evaluate_difference(payload, fixup->label, fixup->subtrahend, fixup->addend, &value));
+            kefir_elf_buffer_write_le(content, position, (kefir_uint64_t) value, fixup->width);
+            return KEFIR_OK;
+        }
+
+        case ELF_FIXUP_ABSOLUTE:
+        case ELF_FIXUP_SIGNED_ABSOLUTE:
+            switch (fixup->relocation) {
+                case KEFIR_AMD64_XASMGEN_SYMBOL_ABSOLUTE:
+                    switch (fixup->width) {
+                        case 1:
+                            type = KEFIR_ELF(R_X86_64_8);
+                            break;
+
+                        case 2:
+                            type = KEFIR_ELF(R_X86_64_16);
+                            break;
+
+                        case 4:
+                            type = fixup->kind == ELF_FIXUP_SIGNED_ABSOLUTE ? KEFIR_ELF(R_X86_64_32S)
+                                                                            : KEFIR_ELF(R_X86_64_32);
+                            break;
+
+                        default:
+                            type = KEFIR_ELF(R_X86_64_64);
+                            break;
+                    }
+                    REQUIRE_OK(symbol_reference(payload, object, fixup->label, &addend, &symbol));
+                    break;
+
+                case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_TPOFF:
+                    REQUIRE(fixup->width == 4, UNSUPPORTED("Unsupported thread pointer offset width"));
+                    type = KEFIR_ELF(R_X86_64_TPOFF32);
+                    REQUIRE_OK(label_symbol(payload, object, fixup->label, true, &symbol));
+                    break;
+
+                case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_DTPOFF:
+                    REQUIRE(fixup->width == 4 || fixup->width == 8,
+                            UNSUPPORTED("Unsupported dynamic thread vector offset width"));
+                    type = fixup->width == 8 ? KEFIR_ELF(R_X86_64_DTPOFF64) : KEFIR_ELF(R_X86_64_DTPOFF32);
+                    REQUIRE_OK(label_symbol(payload, object, fixup->label, true, &symbol));
+                    break;
+
+                default:
+                    return UNSUPPORTED("Unsupported absolute symbol relocation");
+            }
+            break;
+
+        case ELF_FIXUP_RELATIVE:
+            switch (fixup->relocation) {
+                case KEFIR_AMD64_XASMGEN_SYMBOL_ABSOLUTE:
+                    if (same_section && label_is_local(label)) {
+                        REQUIRE_OK(write_relative(
+                            content, position,
+                            (kefir_int64_t) label_address(payload, label) + addend - (kefir_int64_t) position, 4));
+                        return KEFIR_OK;
+                    }
+                    type = KEFIR_ELF(R_X86_64_PC32);
+                    REQUIRE_OK(symbol_reference(payload, object, fixup->label, &addend, &symbol));
+                    break;
+
+                case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_GOTPCREL:
+                    switch (fixup->relaxation) {
+                        case KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_NONE:
+                            type = KEFIR_ELF(R_X86_64_GOTPCREL);
+                            break;
+
+                        case KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_GOTPCRELX:
+                            type = KEFIR_ELF(R_X86_64_GOTPCRELX);
+                            break;
+
+                        case KEFIR_AMD64_ENCODER_FIXUP_RELAXATION_REX_GOTPCRELX:
+                            type = KEFIR_ELF(R_X86_64_REX_GOTPCRELX);
+                            break;
+                    }
+                    REQUIRE_OK(label_symbol(payload, object, fixup->label, false, &symbol));
+                    break;
+
+                case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_GOTTPOFF:
+                    type = KEFIR_ELF(R_X86_64_GOTTPOFF);
+                    REQUIRE_OK(label_symbol(payload, object, fixup->label, true, &symbol));
+                    break;
+
+                case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_TLSGD:
+                    type = KEFIR_ELF(R_X86_64_TLSGD);
+                    REQUIRE_OK(label_symbol(payload, object, fixup->label, true, &symbol));
+                    break;
+
+                case KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_PLT:
+                    type = KEFIR_ELF(R_X86_64_PLT32);
+                    REQUIRE_OK(label_symbol(payload, object, fixup->label, false, &symbol));
+                    break;
+
+                default:
+                    return UNSUPPORTED("Unsupported relative symbol relocation");
+            }
+            break;
+
+        case ELF_FIXUP_BRANCH:
+            if (same_section && label_is_local(label)) {
+                REQUIRE(fixup->relocation == KEFIR_AMD64_XASMGEN_SYMBOL_ABSOLUTE ||
+                            fixup->relocation == KEFIR_AMD64_XASMGEN_SYMBOL_RELATIVE_PLT,
+                        UNSUPPORTED("Unsupported branch target relocation"));
+                REQUIRE_OK(write_relative(
+                    content, position,
+                    (kefir_int64_t) label_address(payload, label) + addend - (kefir_int64_t) position, 4));
+                return KEFIR_OK;
+            }
+            REQUIRE_OK(branch_relocation(payload, object, section_index, position, fixup->label, fixup->relocation,
+                                         addend));
+            return KEFIR_OK;
+    }
+
+    REQUIRE_OK(kefir_elf_object_add_relocation(payload->mem, object, section->object_section, position, type, symbol,
+                                               addend));
+    return KEFIR_OK;
+}
+
+static kefir_result_t emit_branch(struct xasmgen_elf_payload *payload, struct kefir_elf_object *object,
+                                  kefir_size_t section_index, const struct elf_chunk *chunk) {
+    struct kefir_elf_buffer *content = &object->sections[payload->sections[section_index].object_section].content;
+    const kefir_uint64_t end = chunk->address + chunk->length + chunk->tail_length;
+    if (!chunk->branch.near) {
+        REQUIRE_OK(kefir_elf_buffer_append_byte(
+            payload->mem, content, chunk->branch.conditional ? (0x70 | chunk->branch.condition) : 0xeb));
+        const kefir_int64_t displacement =
+            (kefir_int64_t) label_address(payload, &payload->labels[chunk->branch.target]) + chunk->branch.addend -
+            (kefir_int64_t) end;
+        REQUIRE_OK(kefir_elf_buffer_append_byte(payload->mem, content, (kefir_uint8_t) displacement));
+        return KEFIR_OK;
+    }
+
+    if (chunk->branch.conditional) {
+        REQUIRE_OK(kefir_elf_buffer_append_byte(payload->mem, content, 0x0f));
+        REQUIRE_OK(kefir_elf_buffer_append_byte(payload->mem, content, 0x80 | chunk->branch.condition));
+    } else {
+        REQUIRE_OK(kefir_elf_buffer_append_byte(payload->mem, content, 0xe9));
+    }
+    const kefir_uint64_t position = content->length;
+    REQUIRE_OK(kefir_elf_buffer_append_zeros(payload->mem, content, 4));
+    if (branch_resolvable(payload, section_index, chunk)) {
+        REQUIRE_OK(write_relative(content, position,
+                                  (kefir_int64_t) label_address(payload, &payload->labels[chunk->branch.target]) +
+                                      chunk->branch.addend - (kefir_int64_t) end,
+                                  4));
+    } else {
+        REQUIRE_OK(branch_relocation(payload, object, section_index, position, chunk->branch.target,
+                                     chunk->branch.relocation, chunk->branch.addend - 4));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t emit_section_content(struct xasmgen_elf_payload *payload, struct kefir_elf_object *object,
+                                           kefir_size_t section_index) {
+    const struct elf_section *section = &payload->sections[section_index];
+    struct kefir_elf_object_section *object_section = &object->sections[section->object_section];
+    if (section->type == KEFIR_ELF(SHT_NOBITS)) {
+        object_section->size = section->size;
+        return KEFIR_OK;
+    }
+
+    REQUIRE_OK(kefir_elf_buffer_reserve(payload->mem, &object_section->content, section->size));
+    for (kefir_size_t i = 0; i < section->chunk_count; i++) {
+        const struct elf_chunk *chunk = &section->chunks[i];
+        REQUIRE_OK(kefir_elf_buffer_append(payload->mem, &object_section->content,
+                                           section->content.content + chunk->content_offset, chunk->length));
+        switch (chunk->tail) {
+            case ELF_CHUNK_TAIL_NONE:
+                // Intentionally left blank
+                break;
+
+            case ELF_CHUNK_TAIL_ALIGN:
+                if ((section->flags & KEFIR_ELF(SHF_EXECINSTR)) != 0) {
+                    REQUIRE_OK(append_nops(payload->mem, &object_section->content, chunk->tail_length));
+                } else {
+                    REQUIRE_OK(kefir_elf_buffer_append_zeros(payload->mem, &object_section->content,
+                                                             chunk->tail_length));
+                }
+                break;
+
+            case ELF_CHUNK_TAIL_BRANCH:
+                REQUIRE_OK(emit_branch(payload, object, section_index, chunk));
+                break;
+
+            case ELF_CHUNK_TAIL_ULEB128: {
+                kefir_int64_t value;
+                REQUIRE_OK(evaluate_difference(payload, chunk->uleb128.minuend, chunk->uleb128.subtrahend,
+                                               chunk->uleb128.addend, &value));
+                kefir_uint64_t uvalue = (kefir_uint64_t) value;
+                for (kefir_size_t j = 0; j < chunk->tail_length; j++) {
+                    kefir_uint8_t byte = uvalue & 0x7f;
+                    uvalue >>= 7;
+                    if (j + 1 < chunk->tail_length) {
+                        byte |= 0x80;
+                    }
+                    REQUIRE_OK(kefir_elf_buffer_append_byte(payload->mem, &object_section->content, byte));
+                }
+            } break;
+        }
+    }
+    return KEFIR_OK;
+}
+
+#define DWARF_LINE_BASE (-5)
+#define DWARF_LINE_RANGE 14
+#define DWARF_OPCODE_BASE 13
+#define DWARF_MAX_SPECIAL_ADDRESS_DELTA ((255 - DWARF_OPCODE_BASE) / DWARF_LINE_RANGE)
+#define DW_LNS_copy 1
+#define DW_LNS_advance_pc 2
+#define DW_LNS_advance_line 3
+#define DW_LNS_set_file 4
+#define DW_LNS_set_column 5
+#define DW_LNS_const_add_pc 8
+#define DW_LNE_end_sequence 1
+#define DW_LNE_set_address 2
+#define DW_LNCT_path 1
+#define DW_LNCT_directory_index 2
+#define DW_FORM_line_strp 0x1f
+#define DW_FORM_udata 0x0f
+
+static const kefir_uint8_t StandardOpcodeLengths[DWARF_OPCODE_BASE - 1] = {0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1};
+
+// Encoding of line and address advance follows the GNU assembler, so that the produced line number programs are
+// identical to the ones generated from .loc directives.
+static kefir_result_t line_advance(struct kefir_mem *mem, struct kefir_elf_buffer *program, kefir_int64_t line_delta,
+                                   kefir_uint64_t address_delta) {
+    kefir_uint64_t opcode = (kefir_uint64_t) (line_delta - DWARF_LINE_BASE);
+    kefir_bool_t need_copy = false;
+    if (opcode >= DWARF_LINE_RANGE) {
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DW_LNS_advance_line));
+        REQUIRE_OK(kefir_elf_buffer_append_sleb128(mem, program, line_delta));
+        line_delta = 0;
+        opcode = -DWARF_LINE_BASE;
+        need_copy = true;
+    }
+
+    if (line_delta == 0 && address_delta == 0) {
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DW_LNS_copy));
+        return KEFIR_OK;
+    }
+
+    opcode += DWARF_OPCODE_BASE;
+    if (address_delta < 256 + DWARF_MAX_SPECIAL_ADDRESS_DELTA) {
+        kefir_uint64_t special_opcode = opcode + address_delta * DWARF_LINE_RANGE;
+        if (special_opcode <= 255) {
+            REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, (kefir_uint8_t) special_opcode));
+            return KEFIR_OK;
+        }
+
+        special_opcode = opcode + (address_delta - DWARF_MAX_SPECIAL_ADDRESS_DELTA) * DWARF_LINE_RANGE;
+        if (special_opcode <= 255) {
+            REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DW_LNS_const_add_pc));
+            REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, (kefir_uint8_t) special_opcode));
+            return KEFIR_OK;
+        }
+    }
+
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DW_LNS_advance_pc));
+    REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, address_delta));
+    REQUIRE_OK(
+        kefir_elf_buffer_append_byte(mem, program, need_copy ? DW_LNS_copy : (kefir_uint8_t) opcode));
+    return KEFIR_OK;
+}
+
+static kefir_result_t end_sequence(struct kefir_mem *mem, struct kefir_elf_buffer *program,
+                                   kefir_uint64_t address_delta) {
+    if (address_delta == DWARF_MAX_SPECIAL_ADDRESS_DELTA) {
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DW_LNS_const_add_pc));
+    } else if (address_delta != 0) {
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DW_LNS_advance_pc));
+        REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, address_delta));
+    }
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 0));
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 1));
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DW_LNE_end_sequence));
+    return KEFIR_OK;
+}
+
+// Line program strings are placed into .debug_line_str and referenced by offset, same as the GNU assembler does
+static kefir_result_t append_line_string(struct xasmgen_elf_payload *payload, struct kefir_elf_object *object,
+                                         kefir_size_t line_section_index, kefir_size_t string_section_index,
+                                         const char *string, kefir_size_t length) {
+    struct kefir_mem *mem = payload->mem;
+    const struct elf_section *line_section = &payload->sections[line_section_index];
+    struct kefir_elf_buffer *program = &object->sections[line_section->object_section].content;
+    struct kefir_elf_buffer *strings =
+        &object->sections[payload->sections[string_section_index].object_section].content;
+
+    kefir_size_t symbol;
+    REQUIRE_OK(section_symbol(payload, object, string_section_index, &symbol));
+    REQUIRE_OK(kefir_elf_object_add_relocation(mem, object, line_section->object_section, program->length,
+                                               KEFIR_ELF(R_X86_64_32), symbol, (kefir_int64_t) strings->length));
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, program, 0, 4));
+    REQUIRE_OK(kefir_elf_buffer_append(mem, strings, string, length));
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, strings, 0));
+    return KEFIR_OK;
+}
+
+static kefir_size_t file_directory_length(const char *filename) {
+    const char *separator = strrchr(filename, '/');
+    return separator != NULL ? (kefir_size_t) (separator - filename) : 0;
+}
+
+static kefir_size_t file_directory_index(const struct xasmgen_elf_payload *payload, kefir_size_t file_index) {
+    const char *filename = payload->files[file_index];
+    const kefir_size_t length = file_directory_length(filename);
+    if (length == 0) {
+        return 0;
+    }
+
+    kefir_size_t directory_index = 1;
+    for (kefir_size_t i = 0; i < file_index; i++) {
+        const char *other = payload->files[i];
+        const kefir_size_t other_length = file_directory_length(other);
+        if (other_length == 0) {
+            continue;
+        }
+        if (other_length == length && strncmp(other, filename, length) == 0) {
+            return file_directory_index(payload, i);
+        }
+        if (file_directory_index(payload, i) == directory_index) {
+            directory_index++;
+        }
+    }
+    return directory_index;
+}
+
+static kefir_result_t emit_line_program(struct xasmgen_elf_payload *payload, struct kefir_elf_object *object,
+                                        kefir_size_t section_index, kefir_size_t string_section_index) {
+    struct kefir_mem *mem = payload->mem;
+    const struct elf_section *line_section = &payload->sections[section_index];
+    struct kefir_elf_buffer *program = &object->sections[line_section->object_section].content;
+    const kefir_size_t base = program->length;
+
+    if (payload->file_count == 0) {
+        // In absence of source locations the GNU assembler produces an empty DWARF 3 line program
+        REQUIRE_OK(kefir_elf_buffer_append_le(mem, program, 0, 4));  // Unit length
+        REQUIRE_OK(kefir_elf_buffer_append_le(mem, program, 3, 2));  // Version
+        const kefir_size_t header_length_offset = program->length;
+        REQUIRE_OK(kefir_elf_buffer_append_le(mem, program, 0, 4));  // Header length
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 1));   // Minimum instruction length
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 1));   // Default is_stmt
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, (kefir_uint8_t) DWARF_LINE_BASE));
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DWARF_LINE_RANGE));
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DWARF_OPCODE_BASE));
+        REQUIRE_OK(kefir_elf_buffer_append(mem, program, StandardOpcodeLengths, sizeof(StandardOpcodeLengths)));
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 0));  // Include directories
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 0));  // File names
+        kefir_elf_buffer_write_le(program, header_length_offset, program->length - header_length_offset - 4, 4);
+        kefir_elf_buffer_write_le(program, base, program->length - base - 4, 4);
+        return KEFIR_OK;
+    }
+
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, program, 0, 4));  // Unit length
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, program, 5, 2));  // Version
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 8));   // Address size
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 0));   // Segment selector size
+    const kefir_size_t header_length_offset = program->length;
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, program, 0, 4));  // Header length
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 1));   // Minimum instruction length
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 1));   // Maximum operations per instruction
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 1));   // Default is_stmt
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, (kefir_uint8_t) DWARF_LINE_BASE));
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DWARF_LINE_RANGE));
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DWARF_OPCODE_BASE));
+    REQUIRE_OK(kefir_elf_buffer_append(mem, program, StandardOpcodeLengths, sizeof(StandardOpcodeLengths)));
+
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 1));
+    REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, DW_LNCT_path));
+    REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, DW_FORM_line_strp));
+    // Directory components of file names are placed into the directory table, like the GNU assembler does
+    kefir_size_t directory_count = 1;
+    for (kefir_size_t i = 0; i < payload->file_count; i++) {
+        if (file_directory_index(payload, i) == directory_count) {
+            directory_count++;
+        }
+    }
+    REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, directory_count));
+    char cwd[4096];
+    const char *current_directory = getcwd(cwd, sizeof(cwd)) != NULL ? cwd : ".";
+    REQUIRE_OK(append_line_string(payload, object, section_index, string_section_index, current_directory,
+                                  strlen(current_directory)));
+    for (kefir_size_t i = 0, directory_index = 1; i < payload->file_count; i++) {
+        if (file_directory_index(payload, i) == directory_index) {
+            REQUIRE_OK(append_line_string(payload, object, section_index, string_section_index, payload->files[i],
+                                          file_directory_length(payload->files[i])));
+            directory_index++;
+        }
+    }
+
+    REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 2));
+    REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, DW_LNCT_path));
+    REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, DW_FORM_line_strp));
+    REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, DW_LNCT_directory_index));
+    REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, DW_FORM_udata));
+    REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, payload->file_count));
+    for (kefir_size_t i = 0; i < payload->file_count; i++) {
+        const kefir_size_t directory_length = file_directory_length(payload->files[i]);
+        const char *basename = payload->files[i] + (directory_length > 0 ? directory_length + 1 : 0);
+        REQUIRE_OK(
+            append_line_string(payload, object, section_index, string_section_index, basename, strlen(basename)));
+        REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, file_directory_index(payload, i)));
+    }
+    kefir_elf_buffer_write_le(program, header_length_offset, program->length - header_length_offset - 4, 4);
+
+    for (kefir_size_t i = 0; i < payload->section_count; i++) {
+        const struct elf_section *section = &payload->sections[i];
+        if (section->row_count == 0) {
+            continue;
+        }
+
+        kefir_uint64_t file = 1;
+        kefir_uint64_t line = 1;
+        kefir_uint64_t column = 0;
+        kefir_uint64_t address = 0;
+        for (kefir_size_t j = 0; j < section->row_count; j++) {
+            const struct elf_line_row *row = &section->rows[j];
+            if (row->file != file) {
+                file = row->file;
+                REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DW_LNS_set_file));
+                REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, file));
+            }
+            if (row->column != column) {
+                column = row->column;
+                REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DW_LNS_set_column));
+                REQUIRE_OK(kefir_elf_buffer_append_uleb128(mem, program, column));
+            }
+
+            const kefir_int64_t line_delta = (kefir_int64_t) row->line - (kefir_int64_t) line;
+            const kefir_uint64_t row_address = section->chunks[row->chunk].address + row->offset;
+            if (j == 0) {
+                kefir_size_t symbol;
+                REQUIRE_OK(section_symbol(payload, object, i, &symbol));
+                REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 0));
+                REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, 9));
+                REQUIRE_OK(kefir_elf_buffer_append_byte(mem, program, DW_LNE_set_address));
+                REQUIRE_OK(kefir_elf_object_add_relocation(mem, object, line_section->object_section,
+                                                           program->length, KEFIR_ELF(R_X86_64_64), symbol,
+                                                           (kefir_int64_t) row_address));
+                REQUIRE_OK(kefir_elf_buffer_append_le(mem, program, 0, 8));
+                REQUIRE_OK(line_advance(mem, program, line_delta, 0));
+            } else {
+                REQUIRE_OK(line_advance(mem, program, line_delta, row_address - address));
+            }
+            line = row->line;
+            address = row_address;
+        }
+        REQUIRE_OK(end_sequence(mem, program, section->size - address));
+    }
+    kefir_elf_buffer_write_le(program, base, program->length - base - 4, 4);
+    return KEFIR_OK;
+}
+
+static kefir_bool_t label_has_symbol(const struct elf_label *label) {
+    if (strncmp(label->name, LOCAL_LABEL_PREFIX, sizeof(LOCAL_LABEL_PREFIX) - 1) == 0) {
+        return false;
+    }
+    return label->defined || label->global || label->weak || label->common;
+}
+
+static int compare_relocations(const void *lhs_ptr, const void *rhs_ptr) {
+    const struct kefir_elf_object_relocation *lhs = lhs_ptr;
+    const struct kefir_elf_object_relocation *rhs = rhs_ptr;
+    if (lhs->offset < rhs->offset) {
+        return -1;
+    } else if (lhs->offset > rhs->offset) {
+        return 1;
+    }
+    return 0;
+}
+
+static kefir_result_t assemble(struct xasmgen_elf_payload *payload, struct kefir_elf_object *object) {
+    kefir_bool_t has_line_info = false;
+    for (kefir_size_t i = 0; i < payload->section_count; i++) {
+        // Debug information may refer to the line program even if no rows were emitted
+        if (payload->sections[i].row_count > 0 || strcmp(payload->sections[i].name, ".debug_line") == 0) {
+            has_line_info = true;
+        }
+    }
+    kefir_size_t line_section = 0, line_string_section = 0;
+    if (has_line_info) {
+        const kefir_size_t current = payload->current_section;
+        REQUIRE_OK(switch_section(payload, ".debug_line", KEFIR_AMD64_XASMGEN_SECTION_NOATTR));
+        line_section = payload->current_section;
+        if (payload->file_count > 0) {
+            REQUIRE_OK(switch_section(payload, ".debug_line_str", KEFIR_AMD64_XASMGEN_SECTION_NOATTR));
+            line_string_section = payload->current_section;
+        }
+        payload->current_section = current;
+    }
+
+    REQUIRE_OK(resolve_aliases(payload));
+    REQUIRE_OK(layout_sections(payload));
+
+    for (kefir_size_t i = 0; i < payload->section_count; i++) {
+        struct elf_section *section = &payload->sections[i];
+        REQUIRE_OK(kefir_elf_object_new_section(payload->mem, object, section->name, section->type, section->flags,
+                                                section->alignment, section->entry_size, &section->object_section));
+    }
+
+    for (kefir_size_t i = 0; i < payload->label_count; i++) {
+        if (label_has_symbol(&payload->labels[i])) {
+            kefir_size_t symbol;
+            REQUIRE_OK(label_symbol(payload, object, i, false, &symbol));
+        }
+    }
+
+    for (kefir_size_t i = 0; i < payload->section_count; i++) {
+        REQUIRE_OK(emit_section_content(payload, object, i));
+    }
+    for (kefir_size_t i = 0; i < payload->section_count; i++) {
+        const struct elf_section *section = &payload->sections[i];
+        for (kefir_size_t j = 0; j < section->fixup_count; j++) {
+            REQUIRE_OK(apply_fixup(payload, object, i, &section->fixups[j]));
+        }
+    }
+    if (has_line_info) {
+        REQUIRE_OK(emit_line_program(payload, object, line_section, line_string_section));
+    }
+    for (kefir_size_t i = 0; i < object->section_count; i++) {
+        struct kefir_elf_object_section *section = &object->sections[i];
+        if (section->relocation_count > 0) {
+            qsort(section->relocations, section->relocation_count, sizeof(struct kefir_elf_object_relocation),
+                  compare_relocations);
+        }
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t free_payload(struct kefir_mem *mem, struct xasmgen_elf_payload *payload) {
+    for (kefir_size_t i = 0; i < payload->section_count; i++) {
+        struct elf_section *section = &payload->sections[i];
+        REQUIRE_OK(kefir_elf_buffer_free(mem, &section->content));
+        KEFIR_FREE(mem, section->chunks);
+        KEFIR_FREE(mem, section->fixups);
+        KEFIR_FREE(mem, section->rows);
+    }
+    KEFIR_FREE(mem, payload->sections);
+    KEFIR_FREE(mem, payload->labels);
+    KEFIR_FREE(mem, payload->files);
+    KEFIR_FREE(mem, payload->format_buffer);
+    REQUIRE_OK(kefir_hashtable_free(mem, &payload->label_index));
+    REQUIRE_OK(kefir_string_pool_free(mem, &payload->strings));
+    KEFIR_FREE(mem, payload);
+    return KEFIR_OK;
+}
+
+static kefir_result_t write_output(struct kefir_mem *mem, struct xasmgen_elf_payload *payload) {
+    struct kefir_elf_object object;
+    REQUIRE_OK(kefir_elf_object_init(&object));
+    kefir_result_t res = assemble(payload, &object);
+    REQUIRE_CHAIN(&res, kefir_elf_object_write(mem, &object, payload->output));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        kefir_elf_object_free(mem, &object);
+        return res;
+    });
+    REQUIRE_OK(kefir_elf_object_free(mem, &object));
+    return KEFIR_OK;
+}
+
+static kefir_result_t elf_close(struct kefir_mem *mem, struct kefir_amd64_xasmgen *xasmgen) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));
+    ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);
+
+    kefir_result_t res = write_output(mem, payload);
+    fflush(payload->output);
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        free_payload(mem, payload);
+        xasmgen->payload = NULL;
+        return res;
+    });
+    REQUIRE_OK(free_payload(mem, payload));
+    xasmgen->payload = NULL;
+    return KEFIR_OK;
+}
+
+kefir_bool_t kefir_asm_amd64_xasmgen_is_elf(const struct kefir_amd64_xasmgen *xasmgen) {
+    return xasmgen != NULL && xasmgen->close == elf_close;
+}
+
+#define INSTR0(_opcode)                                                                                            \
+    static kefir_result_t elf_instr_##_opcode(struct kefir_amd64_xasmgen *xasmgen) {                               \
+        REQUIRE(xasmgen != NULL,                                                                                   \
+                KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));              \
+        ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);                                 \
+        REQUIRE_OK(emit_instruction(payload, KEFIR_AMD64_ENCODER_OPCODE(_opcode), false, NULL, NULL, NULL));       \
+        return KEFIR_OK;                                                                                           \
+    }
+#define INSTR_REPEATED0(_opcode)                                                                                   \
+    static kefir_result_t elf_instr_##_opcode(struct kefir_amd64_xasmgen *xasmgen, kefir_bool_t rep) {             \
+        REQUIRE(xasmgen != NULL,                                                                                   \
+                KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));              \
+        ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);                                 \
+        REQUIRE_OK(emit_instruction(payload, KEFIR_AMD64_ENCODER_OPCODE(_opcode), rep, NULL, NULL, NULL));         \
+        return KEFIR_OK;                                                                                           \
+    }
+#define INSTR1(_opcode)                                                                                            \
+    static kefir_result_t elf_instr_##_opcode(struct kefir_amd64_xasmgen *xasmgen,                                 \
+                                              const struct kefir_asm_amd64_xasmgen_operand *op1) {                 \
+        REQUIRE(xasmgen != NULL,                                                                                   \
+                KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));              \
+        ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);                                 \
+        REQUIRE_OK(emit_instruction(payload, KEFIR_AMD64_ENCODER_OPCODE(_opcode), false, op1, NULL, NULL));        \
+        return KEFIR_OK;                                                                                           \
+    }
+#define INSTR2(_opcode)                                                                                            \
+    static kefir_result_t elf_instr_##_opcode(struct kefir_amd64_xasmgen *xasmgen,                                 \
+                                              const struct kefir_asm_amd64_xasmgen_operand *op1,                   \
+                                              const struct kefir_asm_amd64_xasmgen_operand *op2) {                 \
+        REQUIRE(xasmgen != NULL,                                                                                   \
+                KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));              \
+        ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);                                 \
+        REQUIRE_OK(emit_instruction(payload, KEFIR_AMD64_ENCODER_OPCODE(_opcode), false, op1, op2, NULL));         \
+        return KEFIR_OK;                                                                                           \
+    }
+#define INSTR_REPEATED2(_opcode)                                                                                   \
+    static kefir_result_t elf_instr_##_opcode(struct kefir_amd64_xasmgen *xasmgen,                                 \
+                                              const struct kefir_asm_amd64_xasmgen_operand *op1,                   \
+                                              const struct kefir_asm_amd64_xasmgen_operand *op2, kefir_bool_t rep) { \
+        REQUIRE(xasmgen != NULL,                                                                                   \
+                KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));              \
+        ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);                                 \
+        REQUIRE_OK(emit_instruction(payload, KEFIR_AMD64_ENCODER_OPCODE(_opcode), rep, op1, op2, NULL));           \
+        return KEFIR_OK;                                                                                           \
+    }
+#define INSTR3(_opcode)                                                                                            \
+    static kefir_result_t elf_instr_##_opcode(struct kefir_amd64_xasmgen *xasmgen,                                 \
+                                              const struct kefir_asm_amd64_xasmgen_operand *op1,                   \
+                                              const struct kefir_asm_amd64_xasmgen_operand *op2,                   \
+                                              const struct kefir_asm_amd64_xasmgen_operand *op3) {                 \
+        REQUIRE(xasmgen != NULL,                                                                                   \
+                KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid AMD64 assembly generator"));              \
+        ASSIGN_DECL_CAST(struct xasmgen_elf_payload *, payload, xasmgen->payload);                                 \
+        REQUIRE_OK(emit_instruction(payload, KEFIR_AMD64_ENCODER_OPCODE(_opcode), false, op1, op2, op3));          \
+        return KEFIR_OK;                                                                                           \
+    }
+
+#define DEFINE_OPCODE0_(_opcode) INSTR0(_opcode)
+#define DEFINE_OPCODE0_REPEATABLE(_opcode) INSTR_REPEATED0(_opcode)
+#define DEFINE_OPCODE0_PREFIX(_opcode) INSTR0(_opcode)
+#define DEFINE_OPCODE0(_opcode, _mnemonic, _variant, _flags) DEFINE_OPCODE0_##_variant(_opcode)
+#define DEFINE_OPCODE1(_opcode, _mnemonic, _variant, _flags, _op1) INSTR1(_opcode)
+#define DEFINE_OPCODE2_(_opcode) INSTR2(_opcode)
+#define DEFINE_OPCODE2_REPEATABLE(_opcode) INSTR_REPEATED2(_opcode)
+#define DEFINE_OPCODE2(_opcode, _mnemonic, _variant, _flags, _op1, _op2) DEFINE_OPCODE2_##_variant(_opcode)
+#define DEFINE_OPCODE3(_opcode, _mnemonic, _variant, _flags, _op1, _op2, _op3) INSTR3(_opcode)
+KEFIR_AMD64_INSTRUCTION_DATABASE(DEFINE_OPCODE0, DEFINE_OPCODE1, DEFINE_OPCODE2, DEFINE_OPCODE3, )
+#undef DEFINE_OPCODE0_
+#undef DEFINE_OPCODE0_REPEATABLE
+#undef DEFINE_OPCODE0_PREFIX
+#undef DEFINE_OPCODE0
+#undef DEFINE_OPCODE1
+#undef DEFINE_OPCODE2_
+#undef DEFINE_OPCODE2_REPEATABLE
+#undef DEFINE_OPCODE2
+#undef DEFINE_OPCODE3
+
+#undef INSTR0
+#undef INSTR_REPEATED0
+#undef INSTR1
+#undef INSTR2
+#undef INSTR_REPEATED2
+#undef INSTR3
+
+kefir_result_t kefir_asm_amd64_xasmgen_elf_init(struct kefir_mem *mem, struct kefir_amd64_xasmgen *xasmgen,
+                                                FILE *output, kefir_asm_amd64_xasmgen_syntax_t syntax) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(xasmgen != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to amd64 xasmgen"));
+    REQUIRE(output != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid output FILE"));
+    REQUIRE(syntax != KEFIR_AMD64_XASMGEN_SYNTAX_YASM,
+            KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Integrated assembler does not support Yasm syntax"));
+
+    struct xasmgen_elf_payload *payload = KEFIR_MALLOC(mem, sizeof(struct xasmgen_elf_payload));
+    REQUIRE(payload != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate amd64 xasmgen payload"));
+    memset(payload, 0, sizeof(struct xasmgen_elf_payload));
+    payload->mem = mem;
+    payload->output = output;
+
+    kefir_result_t res = kefir_string_pool_init(&payload->strings);
+    REQUIRE_CHAIN(&res, kefir_hashtable_init(&payload->label_index, &kefir_hashtable_uint_ops));
+    // Default sections are laid out in the same order as the GNU assembler does
+    REQUIRE_CHAIN(&res, switch_section(payload, ".text", KEFIR_AMD64_XASMGEN_SECTION_NOATTR));
+    REQUIRE_CHAIN(&res, switch_section(payload, ".data", KEFIR_AMD64_XASMGEN_SECTION_NOATTR));
+    REQUIRE_CHAIN(&res, switch_section(payload, ".bss", KEFIR_AMD64_XASMGEN_SECTION_NOATTR));
+    REQUIRE_CHAIN(&res, switch_section(payload, ".text", KEFIR_AMD64_XASMGEN_SECTION_NOATTR));
+    REQUIRE_ELSE(res == KEFIR_OK, {
+        free_payload(mem, payload);
+        return res;
+    });
+
+    xasmgen->payload = payload;
+
+    xasmgen->settings.enable_comments = true;
+    xasmgen->settings.enable_identation = true;
+
+    xasmgen->prologue = elf_prologue;
+    xasmgen->close = elf_close;
+    xasmgen->newline = elf_newline;
+    xasmgen->comment = elf_comment;
+    xasmgen->label = elf_label;
+    xasmgen->global = elf_global;
+    xasmgen->external = elf_external;
+    xasmgen->alias = elf_alias;
+    xasmgen->weak = elf_weak;
+    xasmgen->common = elf_common;
+    xasmgen->section = elf_section;
+    xasmgen->align = elf_align;
+    xasmgen->data = elf_data;
+    xasmgen->zerodata = elf_zerodata;
+    xasmgen->uninitdata = elf_uninitdata;
+    xasmgen->bindata = elf_bindata;
+    xasmgen->inline_assembly = elf_inline_assembly;
+    xasmgen->format_operand = elf_format_operand;
+    xasmgen->new_debug_info_tracker = elf_new_debug_info_tracker;
+    xasmgen->free_debug_info_tracker = elf_free_debug_info_tracker;
+    xasmgen->debug_info_source_location = elf_debug_info_source_location;
+
+#define OPCODE_DEF(_id) xasmgen->instr._id = elf_instr_##_id
+#define DEFINE_OPCODE0(_opcode, _mnemonic, _variant, _flags) OPCODE_DEF(_opcode)
+#define DEFINE_OPCODE1(_opcode, _mnemonic, _variant, _flags, _op1) OPCODE_DEF(_opcode)
+#define DEFINE_OPCODE2(_opcode, _mnemonic, _variant, _flags, _op1, _op2) OPCODE_DEF(_opcode)
+#define DEFINE_OPCODE3(_opcode, _mnemonic, _variant, _flags, _op1, _op2, _op3) OPCODE_DEF(_opcode)
+    KEFIR_AMD64_INSTRUCTION_DATABASE(DEFINE_OPCODE0, DEFINE_OPCODE1, DEFINE_OPCODE2, DEFINE_OPCODE3, ;);
+#undef OPCODE_DEF
+#undef DEFINE_OPCODE0
+#undef DEFINE_OPCODE1
+#undef DEFINE_OPCODE2
+#undef DEFINE_OPCODE3
+    return KEFIR_OK;
+}
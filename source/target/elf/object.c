@@ -0,0 +1,673 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "kefir/target/elf/object.h"
+#include "kefir/core/error.h"
+#include "kefir/core/util.h"
+#include "kefir/core/os_error.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define BUFFER_INITIAL_CAPACITY 64
+
+kefir_result_t kefir_elf_buffer_init(struct kefir_elf_buffer *buffer) {
+    REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to ELF buffer"));
+
+    buffer->content = NULL;
+    buffer->length = 0;
+    buffer->capacity = 0;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_buffer_free(struct kefir_mem *mem, struct kefir_elf_buffer *buffer) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF buffer"));
+
+    KEFIR_FREE(mem, buffer->content);
+    buffer->content = NULL;
+    buffer->length = 0;
+    buffer->capacity = 0;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_buffer_reserve(struct kefir_mem *mem, struct kefir_elf_buffer *buffer, kefir_size_t length) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF buffer"));
+    REQUIRE(buffer->length + length > buffer->capacity, KEFIR_OK);
+
+    kefir_size_t new_capacity = MAX(buffer->capacity * 2, BUFFER_INITIAL_CAPACITY);
+    while (new_capacity < buffer->length + length) {
+        new_capacity *= 2;
+    }
+    kefir_uint8_t *new_content = KEFIR_REALLOC(mem, buffer->content, new_capacity);
+    REQUIRE(new_content != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to reallocate ELF buffer"));
+    buffer->content = new_content;
+    buffer->capacity = new_capacity;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_buffer_append(struct kefir_mem *mem, struct kefir_elf_buffer *buffer, const void *content,
+                                       kefir_size_t length) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF buffer"));
+    REQUIRE(content != NULL || length == 0, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid content"));
+    REQUIRE(length > 0, KEFIR_OK);
+
+    REQUIRE_OK(kefir_elf_buffer_reserve(mem, buffer, length));
+    memcpy(buffer->content + buffer->length, content, length);
+    buffer->length += length;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_buffer_append_byte(struct kefir_mem *mem, struct kefir_elf_buffer *buffer,
+                                            kefir_uint8_t byte) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF buffer"));
+
+    REQUIRE_OK(kefir_elf_buffer_reserve(mem, buffer, 1));
+    buffer->content[buffer->length++] = byte;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_buffer_append_zeros(struct kefir_mem *mem, struct kefir_elf_buffer *buffer,
+                                             kefir_size_t length) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF buffer"));
+    REQUIRE(length > 0, KEFIR_OK);
+
+    REQUIRE_OK(kefir_elf_buffer_reserve(mem, buffer, length));
+    memset(buffer->content + buffer->length, 0, length);
+    buffer->length += length;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_buffer_append_uleb128(struct kefir_mem *mem, struct kefir_elf_buffer *buffer,
+                                               kefir_uint64_t value) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF buffer"));
+
+    do {
+        kefir_uint8_t byte = value & 0x7f;
+        value >>= 7;
+        if (value != 0) {
+            byte |= 0x80;
+        }
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, buffer, byte));
+    } while (value != 0);
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_buffer_append_sleb128(struct kefir_mem *mem, struct kefir_elf_buffer *buffer,
+                                               kefir_int64_t value) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF buffer"));
+
+    for (kefir_bool_t more = true; more;) {
+        kefir_uint8_t byte = value & 0x7f;
+        value >>= 7;
+        if ((value == 0 && (byte & 0x40) == 0) || (value == -1 && (byte & 0x40) != 0)) {
+            more = false;
+        } else {
+            byte |= 0x80;
+        }
+        REQUIRE_OK(kefir_elf_buffer_append_byte(mem, buffer, byte));
+    }
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_buffer_append_le(struct kefir_mem *mem, struct kefir_elf_buffer *buffer,
+                                          kefir_uint64_t value, kefir_size_t width) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(buffer != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF buffer"));
+    REQUIRE(width <= sizeof(kefir_uint64_t), KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid value width"));
+
+    REQUIRE_OK(kefir_elf_buffer_reserve(mem, buffer, width));
+    buffer->length += width;
+    kefir_elf_buffer_write_le(buffer, buffer->length - width, value, width);
+    return KEFIR_OK;
+}
+
+void kefir_elf_buffer_write_le(struct kefir_elf_buffer *buffer, kefir_size_t offset, kefir_uint64_t value,
+                               kefir_size_t width) {
+    for (kefir_size_t i = 0; i < width; i++) {
+        buffer->content[offset + i] = (kefir_uint8_t) (value >> (i * 8));
+    }
+}
+
+kefir_result_t kefir_elf_object_init(struct kefir_elf_object *object) {
+    REQUIRE(object != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to ELF object"));
+
+    object->sections = NULL;
+    object->section_count = 0;
+    object->section_capacity = 0;
+    object->symbols = NULL;
+    object->symbol_count = 0;
+    object->symbol_capacity = 0;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_object_free(struct kefir_mem *mem, struct kefir_elf_object *object) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(object != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF object"));
+
+    for (kefir_size_t i = 0; i < object->section_count; i++) {
+        struct kefir_elf_object_section *section = &object->sections[i];
+        KEFIR_FREE(mem, section->name);
+        KEFIR_FREE(mem, section->relocations);
+        REQUIRE_OK(kefir_elf_buffer_free(mem, &section->content));
+    }
+    for (kefir_size_t i = 0; i < object->symbol_count; i++) {
+        KEFIR_FREE(mem, object->symbols[i].name);
+    }
+    KEFIR_FREE(mem, object->sections);
+    KEFIR_FREE(mem, object->symbols);
+    REQUIRE_OK(kefir_elf_object_init(object));
+    return KEFIR_OK;
+}
+
+static char *duplicate_string(struct kefir_mem *mem, const char *string) {
+    const kefir_size_t length = strlen(string);
+    char *copy = KEFIR_MALLOC(mem, length + 1);
+    if (copy != NULL) {
+        memcpy(copy, string, length + 1);
+    }
+    return copy;
+}
+
+kefir_result_t kefir_elf_object_new_section(struct kefir_mem *mem, struct kefir_elf_object *object, const char *name,
+                                            kefir_uint32_t type, kefir_uint64_t flags, kefir_uint64_t alignment,
+                                            kefir_uint64_t entry_size, kefir_size_t *index_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(object != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF object"));
+    REQUIRE(name != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid section name"));
+    REQUIRE(index_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to section index"));
+
+    if (object->section_count == object->section_capacity) {
+        const kefir_size_t new_capacity = MAX(object->section_capacity * 2, 8);
+        struct kefir_elf_object_section *sections =
+            KEFIR_REALLOC(mem, object->sections, sizeof(struct kefir_elf_object_section) * new_capacity);
+        REQUIRE(sections != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to reallocate ELF sections"));
+        object->sections = sections;
+        object->section_capacity = new_capacity;
+    }
+
+    struct kefir_elf_object_section *section = &object->sections[object->section_count];
+    section->name = duplicate_string(mem, name);
+    REQUIRE(section->name != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate ELF section name"));
+    section->type = type;
+    section->flags = flags;
+    section->alignment = alignment;
+    section->entry_size = entry_size;
+    section->size = 0;
+    section->relocations = NULL;
+    section->relocation_count = 0;
+    section->relocation_capacity = 0;
+    section->has_symbol = false;
+    section->symbol = 0;
+    REQUIRE_OK(kefir_elf_buffer_init(&section->content));
+
+    *index_ptr = object->section_count++;
+    return KEFIR_OK;
+}
+
+static kefir_result_t new_symbol(struct kefir_mem *mem, struct kefir_elf_object *object, const char *name,
+                                 kefir_uint8_t binding, kefir_uint8_t type, kefir_uint8_t visibility,
+                                 kefir_size_t *symbol_ptr) {
+    if (object->symbol_count == object->symbol_capacity) {
+        const kefir_size_t new_capacity = MAX(object->symbol_capacity * 2, 32);
+        struct kefir_elf_object_symbol *symbols =
+            KEFIR_REALLOC(mem, object->symbols, sizeof(struct kefir_elf_object_symbol) * new_capacity);
+        REQUIRE(symbols != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to reallocate ELF symbols"));
+        object->symbols = symbols;
+        object->symbol_capacity = new_capacity;
+    }
+
+    struct kefir_elf_object_symbol *symbol = &object->symbols[object->symbol_count];
+    if (name != NULL) {
+        symbol->name = duplicate_string(mem, name);
+        REQUIRE(symbol->name != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate ELF symbol name"));
+    } else {
+        symbol->name = NULL;
+    }
+    symbol->binding = binding;
+    symbol->type = type;
+    symbol->visibility = visibility;
+    symbol->section_index = KEFIR_ELF(SHN_UNDEF);
+    symbol->in_section = false;
+    symbol->section = 0;
+    symbol->value = 0;
+    symbol->size = 0;
+    symbol->order = object->symbol_count;
+
+    *symbol_ptr = object->symbol_count++;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_object_section_symbol(struct kefir_mem *mem, struct kefir_elf_object *object,
+                                               kefir_size_t section_index, kefir_size_t *symbol_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(object != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF object"));
+    REQUIRE(section_index < object->section_count,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Requested ELF section is out of bounds"));
+    REQUIRE(symbol_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to ELF symbol"));
+
+    struct kefir_elf_object_section *section = &object->sections[section_index];
+    if (!section->has_symbol) {
+        kefir_size_t symbol;
+        REQUIRE_OK(new_symbol(mem, object, NULL, KEFIR_ELF(STB_LOCAL), KEFIR_ELF(STT_SECTION),
+                              KEFIR_ELF(STV_DEFAULT), &symbol));
+        object->symbols[symbol].in_section = true;
+        object->symbols[symbol].section = section_index;
+        section->has_symbol = true;
+        section->symbol = symbol;
+    }
+    *symbol_ptr = section->symbol;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_object_new_symbol(struct kefir_mem *mem, struct kefir_elf_object *object, const char *name,
+                                           kefir_uint8_t binding, kefir_uint8_t type, kefir_uint8_t visibility,
+                                           kefir_size_t *symbol_ptr) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(object != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF object"));
+    REQUIRE(name != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF symbol name"));
+    REQUIRE(symbol_ptr != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid pointer to ELF symbol"));
+
+    REQUIRE_OK(new_symbol(mem, object, name, binding, type, visibility, symbol_ptr));
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_object_define_symbol(struct kefir_elf_object *object, kefir_size_t symbol_index,
+                                              kefir_size_t section_index, kefir_uint64_t value, kefir_uint64_t size) {
+    REQUIRE(object != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF object"));
+    REQUIRE(symbol_index < object->symbol_count,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Requested ELF symbol is out of bounds"));
+    REQUIRE(section_index < object->section_count,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Requested ELF section is out of bounds"));
+
+    struct kefir_elf_object_symbol *symbol = &object->symbols[symbol_index];
+    symbol->in_section = true;
+    symbol->section = section_index;
+    symbol->value = value;
+    symbol->size = size;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_object_define_special_symbol(struct kefir_elf_object *object, kefir_size_t symbol_index,
+                                                      kefir_uint16_t section_index, kefir_uint64_t value,
+                                                      kefir_uint64_t size) {
+    REQUIRE(object != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF object"));
+    REQUIRE(symbol_index < object->symbol_count,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Requested ELF symbol is out of bounds"));
+
+    struct kefir_elf_object_symbol *symbol = &object->symbols[symbol_index];
+    symbol->in_section = false;
+    symbol->section_index = section_index;
+    symbol->value = value;
+    symbol->size = size;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_object_set_symbol_order(struct kefir_elf_object *object, kefir_size_t symbol_index,
+                                                 kefir_size_t order) {
+    REQUIRE(object != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF object"));
+    REQUIRE(symbol_index < object->symbol_count,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Requested ELF symbol is out of bounds"));
+
+    object->symbols[symbol_index].order = order;
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_object_add_relocation(struct kefir_mem *mem, struct kefir_elf_object *object,
+                                               kefir_size_t section_index, kefir_uint64_t offset,
+                                               kefir_uint32_t type, kefir_size_t symbol, kefir_int64_t addend) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(object != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF object"));
+    REQUIRE(section_index < object->section_count,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Requested ELF section is out of bounds"));
+    REQUIRE(symbol < object->symbol_count,
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Requested ELF symbol is out of bounds"));
+
+    struct kefir_elf_object_section *section = &object->sections[section_index];
+    if (section->relocation_count == section->relocation_capacity) {
+        const kefir_size_t new_capacity = MAX(section->relocation_capacity * 2, 32);
+        struct kefir_elf_object_relocation *relocations =
+            KEFIR_REALLOC(mem, section->relocations, sizeof(struct kefir_elf_object_relocation) * new_capacity);
+        REQUIRE(relocations != NULL,
+                KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to reallocate ELF section relocations"));
+        section->relocations = relocations;
+        section->relocation_capacity = new_capacity;
+    }
+
+    struct kefir_elf_object_relocation *relocation = &section->relocations[section->relocation_count++];
+    relocation->offset = offset;
+    relocation->type = type;
+    relocation->symbol = symbol;
+    relocation->addend = addend;
+    return KEFIR_OK;
+}
+
+struct object_layout {
+    kefir_size_t *symbol_indices;
+    kefir_size_t *section_indices;
+    kefir_size_t *relocation_section_indices;
+    kefir_size_t *section_offsets;
+    kefir_size_t *relocation_section_offsets;
+    kefir_size_t *section_names;
+    kefir_size_t *relocation_section_names;
+    kefir_size_t first_global_symbol;
+    kefir_size_t symtab_index;
+    kefir_size_t strtab_index;
+    kefir_size_t shstrtab_index;
+    kefir_size_t section_header_count;
+
+    struct kefir_elf_buffer strtab;
+    struct kefir_elf_buffer shstrtab;
+    struct kefir_elf_buffer symtab;
+};
+
+static kefir_result_t append_string(struct kefir_mem *mem, struct kefir_elf_buffer *buffer, const char *prefix,
+                                    const char *string, kefir_size_t *offset_ptr) {
+    *offset_ptr = buffer->length;
+    if (prefix != NULL) {
+        REQUIRE_OK(kefir_elf_buffer_append(mem, buffer, prefix, strlen(prefix)));
+    }
+    REQUIRE_OK(kefir_elf_buffer_append(mem, buffer, string, strlen(string) + 1));
+    return KEFIR_OK;
+}
+
+static kefir_result_t symbol_section_index(const struct kefir_elf_object *object, const struct object_layout *layout,
+                                           const struct kefir_elf_object_symbol *symbol, kefir_uint16_t *index_ptr) {
+    if (symbol->in_section) {
+        REQUIRE(layout->section_indices[symbol->section] < KEFIR_ELF(SHN_ABS),
+                KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "ELF section index exceeds supported range"));
+        *index_ptr = (kefir_uint16_t) layout->section_indices[symbol->section];
+    } else {
+        *index_ptr = symbol->section_index;
+    }
+    UNUSED(object);
+    return KEFIR_OK;
+}
+
+struct symbol_order_entry {
+    kefir_size_t order;
+    kefir_size_t index;
+};
+
+static int compare_symbol_order(const void *lhs_ptr, const void *rhs_ptr) {
+    const struct symbol_order_entry *lhs = lhs_ptr;
+    const struct symbol_order_entry *rhs = rhs_ptr;
+    if (lhs->order != rhs->order) {
+        return lhs->order < rhs->order ? -1 : 1;
+    }
+    if (lhs->index != rhs->index) {
+        return lhs->index < rhs->index ? -1 : 1;
+    }
+    return 0;
+}
+
+static kefir_result_t write_symbol_table(struct kefir_mem *mem, const struct kefir_elf_object *object,
+                                         struct object_layout *layout, struct symbol_order_entry *entries) {
+    // Local symbols precede global ones; within each group symbols are ordered by their requested order
+    kefir_size_t local_count = 0;
+    for (kefir_size_t i = 0; i < object->symbol_count; i++) {
+        if (object->symbols[i].binding == KEFIR_ELF(STB_LOCAL)) {
+            local_count++;
+        }
+    }
+    for (kefir_size_t i = 0, local_index = 0, global_index = local_count; i < object->symbol_count; i++) {
+        const kefir_size_t position =
+            object->symbols[i].binding == KEFIR_ELF(STB_LOCAL) ? local_index++ : global_index++;
+        entries[position].order = object->symbols[i].order;
+        entries[position].index = i;
+    }
+    if (local_count > 0) {
+        qsort(entries, local_count, sizeof(struct symbol_order_entry), compare_symbol_order);
+    }
+    if (object->symbol_count > local_count) {
+        qsort(entries + local_count, object->symbol_count - local_count, sizeof(struct symbol_order_entry),
+              compare_symbol_order);
+    }
+    layout->first_global_symbol = local_count + 1;
+    for (kefir_size_t i = 0; i < object->symbol_count; i++) {
+        layout->symbol_indices[entries[i].index] = i + 1;
+    }
+
+    const kefir_size_t symtab_length = object->symbol_count + 1;
+    REQUIRE_OK(kefir_elf_buffer_append_zeros(mem, &layout->strtab, 1));
+    REQUIRE_OK(kefir_elf_buffer_reserve(mem, &layout->symtab, symtab_length * KEFIR_ELF64_SYM_SIZE));
+    REQUIRE_OK(kefir_elf_buffer_append_zeros(mem, &layout->symtab, symtab_length * KEFIR_ELF64_SYM_SIZE));
+    for (kefir_size_t i = 0; i < object->symbol_count; i++) {
+        const struct kefir_elf_object_symbol *symbol = &object->symbols[entries[i].index];
+        kefir_size_t name_offset = 0;
+        if (symbol->name != NULL) {
+            REQUIRE_OK(append_string(mem, &layout->strtab, NULL, symbol->name, &name_offset));
+        }
+        kefir_uint16_t section_index;
+        REQUIRE_OK(symbol_section_index(object, layout, symbol, &section_index));
+
+        const kefir_size_t offset = (i + 1) * KEFIR_ELF64_SYM_SIZE;
+        kefir_elf_buffer_write_le(&layout->symtab, offset, name_offset, 4);
+        kefir_elf_buffer_write_le(&layout->symtab, offset + 4, KEFIR_ELF64_ST_INFO(symbol->binding, symbol->type), 1);
+        kefir_elf_buffer_write_le(&layout->symtab, offset + 5, symbol->visibility, 1);
+        kefir_elf_buffer_write_le(&layout->symtab, offset + 6, section_index, 2);
+        kefir_elf_buffer_write_le(&layout->symtab, offset + 8, symbol->value, 8);
+        kefir_elf_buffer_write_le(&layout->symtab, offset + 16, symbol->size, 8);
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t build_symbol_table(struct kefir_mem *mem, const struct kefir_elf_object *object,
+                                         struct object_layout *layout) {
+    struct symbol_order_entry *entries = NULL;
+    if (object->symbol_count > 0) {
+        entries = KEFIR_MALLOC(mem, sizeof(struct symbol_order_entry) * object->symbol_count);
+        REQUIRE(entries != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate ELF symbol order"));
+    }
+    kefir_result_t res = write_symbol_table(mem, object, layout, entries);
+    if (entries != NULL) {
+        KEFIR_FREE(mem, entries);
+    }
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
+
+static kefir_result_t align_buffer(struct kefir_mem *mem, struct kefir_elf_buffer *buffer, kefir_size_t alignment) {
+    if (alignment > 1 && buffer->length % alignment != 0) {
+        REQUIRE_OK(kefir_elf_buffer_append_zeros(mem, buffer, alignment - buffer->length % alignment));
+    }
+    return KEFIR_OK;
+}
+
+static kefir_result_t write_section_header(struct kefir_mem *mem, struct kefir_elf_buffer *buffer,
+                                           kefir_size_t name, kefir_uint32_t type, kefir_uint64_t flags,
+                                           kefir_size_t offset, kefir_size_t size, kefir_uint32_t link,
+                                           kefir_uint32_t info, kefir_uint64_t alignment, kefir_uint64_t entry_size) {
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, buffer, name, 4));
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, buffer, type, 4));
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, buffer, flags, 8));
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, buffer, 0, 8));
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, buffer, offset, 8));
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, buffer, size, 8));
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, buffer, link, 4));
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, buffer, info, 4));
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, buffer, alignment, 8));
+    REQUIRE_OK(kefir_elf_buffer_append_le(mem, buffer, entry_size, 8));
+    return KEFIR_OK;
+}
+
+static kefir_result_t write_object(struct kefir_mem *mem, const struct kefir_elf_object *object,
+                                   struct object_layout *layout, struct kefir_elf_buffer *image) {
+    kefir_size_t next_index = 1;
+    for (kefir_size_t i = 0; i < object->section_count; i++) {
+        layout->section_indices[i] = next_index++;
+        if (object->sections[i].relocation_count > 0) {
+            layout->relocation_section_indices[i] = next_index++;
+        }
+    }
+    // Symbol table is omitted for objects without symbols, same as the GNU assembler does. Relocations always
+    // reference symbols, thus are not possible in such objects
+    const kefir_bool_t has_symtab = object->symbol_count > 0;
+    if (has_symtab) {
+        layout->symtab_index = next_index++;
+        layout->strtab_index = next_index++;
+    }
+    layout->shstrtab_index = next_index++;
+    layout->section_header_count = next_index;
+    REQUIRE(layout->section_header_count < KEFIR_ELF(SHN_ABS),
+            KEFIR_SET_ERROR(KEFIR_OUT_OF_BOUNDS, "Number of ELF sections exceeds supported range"));
+
+    if (has_symtab) {
+        REQUIRE_OK(build_symbol_table(mem, object, layout));
+    }
+
+    kefir_size_t symtab_name = 0, strtab_name = 0, shstrtab_name;
+    REQUIRE_OK(kefir_elf_buffer_append_zeros(mem, &layout->shstrtab, 1));
+    for (kefir_size_t i = 0; i < object->section_count; i++) {
+        REQUIRE_OK(append_string(mem, &layout->shstrtab, NULL, object->sections[i].name, &layout->section_names[i]));
+        if (object->sections[i].relocation_count > 0) {
+            REQUIRE_OK(append_string(mem, &layout->shstrtab, ".rela", object->sections[i].name,
+                                     &layout->relocation_section_names[i]));
+        }
+    }
+    if (has_symtab) {
+        REQUIRE_OK(append_string(mem, &layout->shstrtab, NULL, ".symtab", &symtab_name));
+        REQUIRE_OK(append_string(mem, &layout->shstrtab, NULL, ".strtab", &strtab_name));
+    }
+    REQUIRE_OK(append_string(mem, &layout->shstrtab, NULL, ".shstrtab", &shstrtab_name));
+
+    REQUIRE_OK(kefir_elf_buffer_append_zeros(mem, image, KEFIR_ELF64_EHDR_SIZE));
+    for (kefir_size_t i = 0; i < object->section_count; i++) {
+        const struct kefir_elf_object_section *section = &object->sections[i];
+        REQUIRE_OK(align_buffer(mem, image, MAX(section->alignment, 1)));
+        layout->section_offsets[i] = image->length;
+        if (section->type != KEFIR_ELF(SHT_NOBITS)) {
+            REQUIRE_OK(kefir_elf_buffer_append(mem, image, section->content.content, section->content.length));
+        }
+
+        if (section->relocation_count > 0) {
+            REQUIRE_OK(align_buffer(mem, image, 8));
+            layout->relocation_section_offsets[i] = image->length;
+            for (kefir_size_t j = 0; j < section->relocation_count; j++) {
+                const struct kefir_elf_object_relocation *relocation = &section->relocations[j];
+                REQUIRE_OK(kefir_elf_buffer_append_le(mem, image, relocation->offset, 8));
+                REQUIRE_OK(kefir_elf_buffer_append_le(
+                    mem, image, KEFIR_ELF64_R_INFO(layout->symbol_indices[relocation->symbol], relocation->type), 8));
+                REQUIRE_OK(kefir_elf_buffer_append_le(mem, image, (kefir_uint64_t) relocation->addend, 8));
+            }
+        }
+    }
+
+    kefir_size_t symtab_offset = 0, strtab_offset = 0;
+    if (has_symtab) {
+        REQUIRE_OK(align_buffer(mem, image, 8));
+        symtab_offset = image->length;
+        REQUIRE_OK(kefir_elf_buffer_append(mem, image, layout->symtab.content, layout->symtab.length));
+        strtab_offset = image->length;
+        REQUIRE_OK(kefir_elf_buffer_append(mem, image, layout->strtab.content, layout->strtab.length));
+    }
+    const kefir_size_t shstrtab_offset = image->length;
+    REQUIRE_OK(kefir_elf_buffer_append(mem, image, layout->shstrtab.content, layout->shstrtab.length));
+
+    REQUIRE_OK(align_buffer(mem, image, 8));
+    const kefir_size_t section_headers_offset = image->length;
+    REQUIRE_OK(write_section_header(mem, image, 0, KEFIR_ELF(SHT_NULL), 0, 0, 0, 0, 0, 0, 0));
+    for (kefir_size_t i = 0; i < object->section_count; i++) {
+        const struct kefir_elf_object_section *section = &object->sections[i];
+        const kefir_size_t size =
+            section->type == KEFIR_ELF(SHT_NOBITS) ? section->size : section->content.length;
+        REQUIRE_OK(write_section_header(mem, image, layout->section_names[i], section->type, section->flags,
+                                        layout->section_offsets[i], size, 0, 0, MAX(section->alignment, 1),
+                                        section->entry_size));
+        if (section->relocation_count > 0) {
+            REQUIRE_OK(write_section_header(
+                mem, image, layout->relocation_section_names[i], KEFIR_ELF(SHT_RELA), KEFIR_ELF(SHF_INFO_LINK),
+                layout->relocation_section_offsets[i], section->relocation_count * KEFIR_ELF64_RELA_SIZE,
+                (kefir_uint32_t) layout->symtab_index, (kefir_uint32_t) layout->section_indices[i], 8,
+                KEFIR_ELF64_RELA_SIZE));
+        }
+    }
+    if (has_symtab) {
+        REQUIRE_OK(write_section_header(mem, image, symtab_name, KEFIR_ELF(SHT_SYMTAB), 0, symtab_offset,
+                                        layout->symtab.length, (kefir_uint32_t) layout->strtab_index,
+                                        (kefir_uint32_t) layout->first_global_symbol, 8, KEFIR_ELF64_SYM_SIZE));
+        REQUIRE_OK(write_section_header(mem, image, strtab_name, KEFIR_ELF(SHT_STRTAB), 0, strtab_offset,
+                                        layout->strtab.length, 0, 0, 1, 0));
+    }
+    REQUIRE_OK(write_section_header(mem, image, shstrtab_name, KEFIR_ELF(SHT_STRTAB), 0, shstrtab_offset,
+                                    layout->shstrtab.length, 0, 0, 1, 0));
+
+    static const kefir_uint8_t Identification[] = {0x7f,
+                                                   'E',
+                                                   'L',
+                                                   'F',
+                                                   KEFIR_ELF(ELFCLASS64),
+                                                   KEFIR_ELF(ELFDATA2LSB),
+                                                   KEFIR_ELF(EV_CURRENT),
+                                                   KEFIR_ELF(ELFOSABI_SYSV)};
+    memcpy(image->content, Identification, sizeof(Identification));
+    kefir_elf_buffer_write_le(image, 16, KEFIR_ELF(ET_REL), 2);
+    kefir_elf_buffer_write_le(image, 18, KEFIR_ELF(EM_X86_64), 2);
+    kefir_elf_buffer_write_le(image, 20, KEFIR_ELF(EV_CURRENT), 4);
+    kefir_elf_buffer_write_le(image, 40, section_headers_offset, 8);
+    kefir_elf_buffer_write_le(image, 52, KEFIR_ELF64_EHDR_SIZE, 2);
+    kefir_elf_buffer_write_le(image, 58, KEFIR_ELF64_SHDR_SIZE, 2);
+    kefir_elf_buffer_write_le(image, 60, layout->section_header_count, 2);
+    kefir_elf_buffer_write_le(image, 62, layout->shstrtab_index, 2);
+    return KEFIR_OK;
+}
+
+kefir_result_t kefir_elf_object_write(struct kefir_mem *mem, const struct kefir_elf_object *object, FILE *output) {
+    REQUIRE(mem != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid memory allocator"));
+    REQUIRE(object != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid ELF object"));
+    REQUIRE(output != NULL, KEFIR_SET_ERROR(KEFIR_INVALID_PARAMETER, "Expected valid output file"));
+
+    struct object_layout layout = {0};
+    const kefir_size_t section_arrays = 7;
+    const kefir_size_t index_count = object->symbol_count + section_arrays * object->section_count;
+    kefir_size_t *indices = KEFIR_MALLOC(mem, sizeof(kefir_size_t) * MAX(index_count, 1));
+    REQUIRE(indices != NULL, KEFIR_SET_ERROR(KEFIR_MEMALLOC_FAILURE, "Failed to allocate ELF object layout"));
+    memset(indices, 0, sizeof(kefir_size_t) * MAX(index_count, 1));
+    layout.symbol_indices = indices;
+    layout.section_indices = indices + object->symbol_count;
+    layout.relocation_section_indices = layout.section_indices + object->section_count;
+    layout.section_offsets = layout.relocation_section_indices + object->section_count;
+    layout.relocation_section_offsets = layout.section_offsets + object->section_count;
+    layout.section_names = layout.relocation_section_offsets + object->section_count;
+    layout.relocation_section_names = layout.section_names + object->section_count;
+
+    struct kefir_elf_buffer image;
+    REQUIRE_OK(kefir_elf_buffer_init(&image));
+    REQUIRE_OK(kefir_elf_buffer_init(&layout.strtab));
+    REQUIRE_OK(kefir_elf_buffer_init(&layout.shstrtab));
+    REQUIRE_OK(kefir_elf_buffer_init(&layout.symtab));
+
+    kefir_result_t res = write_object(mem, object, &layout, &image);
+    if (res == KEFIR_OK && fwrite(image.content, 1, image.length, output) != image.length) {
+        res = KEFIR_SET_OS_ERROR("Failed to write ELF object file");
+    }
+    kefir_elf_buffer_free(mem, &layout.symtab);
+    kefir_elf_buffer_free(mem, &layout.shstrtab);
+    kefir_elf_buffer_free(mem, &layout.strtab);
+    kefir_elf_buffer_free(mem, &image);
+    KEFIR_FREE(mem, indices);
+    REQUIRE_OK(res);
+    return KEFIR_OK;
+}
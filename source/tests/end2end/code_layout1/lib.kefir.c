@@ -0,0 +1,67 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "./definitions.h"
+
+int failures;
+
+_Noreturn void abort(void);
+
+static void check(int condition) {
+    if (!condition) {
+        failures++;
+        __builtin_trap();
+    }
+}
+
+long buffer_sum(const struct buffer *buf) {
+    check(buf != 0 && buf->data != 0);
+    long sum = 0;
+    for (long i = 0; i < buf->length; i++) {
+        if (buf->data[i] < 0) {
+            abort();
+        }
+        sum += buf->data[i];
+    }
+    return sum;
+}
+
+long buffer_max(const struct buffer *buf) {
+    long max = buf->data[0];
+    for (long i = 1; i < buf->length; i++) {
+        if (buf->data[i] > max) {
+            max = buf->data[i];
+        }
+    }
+    return max;
+}
+
+__attribute__((noinline)) static long buffer_count_even(const struct buffer *buf) {
+    long count = 0;
+    for (long i = 0; i < buf->length; i++) {
+        count += (buf->data[i] & 1) == 0;
+    }
+    return count;
+}
+
+long buffer_stats(const struct buffer *buf) {
+    return buffer_count_even(buf) * 1000 + buffer_max(buf);
+}
@@ -0,0 +1,39 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <assert.h>
+#include "./definitions.h"
+
+int main(void) {
+    static const int values[] = {3, 8, -0, 12, 7, 6, 1, 10};
+    struct buffer buf = {.data = values, .length = sizeof(values) / sizeof(values[0])};
+    assert(buffer_sum(&buf) == 47);
+    assert(buffer_max(&buf) == 12);
+    assert(buffer_stats(&buf) == 5012);
+
+    struct buffer single = {.data = values + 3, .length = 1};
+    assert(buffer_sum(&single) == 12);
+    assert(buffer_max(&single) == 12);
+    assert(buffer_stats(&single) == 1012);
+    assert(failures == 0);
+    return EXIT_SUCCESS;
+}
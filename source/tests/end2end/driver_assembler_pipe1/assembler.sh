@@ -0,0 +1,28 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0
+# 
+# Copyright (C) 2020-2026  Jevgenijs Protopopovs
+# 
+# This file is part of Kefir project.
+# 
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3.
+# # 
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+# Assembler wrapper recording whether the driver feeds it through a pipe
+set -e
+ASSEMBLER_LOG="$KEFIR_DRIVER_ASSEMBLER_PIPE1_LOG"
+if [[ -p /dev/stdin ]]; then
+    echo "pipe" >>"$ASSEMBLER_LOG"
+else
+    echo "file" >>"$ASSEMBLER_LOG"
+fi
+exec $KEFIR_DRIVER_ASSEMBLER_PIPE1_AS "$@"
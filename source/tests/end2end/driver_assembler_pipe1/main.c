@@ -0,0 +1,40 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <assert.h>
+#include "./definitions.h"
+
+int main(void) {
+    long values[128];
+    long sum = 0;
+    for (long i = 0; i < 128; i++) {
+        values[i] = i * i - 7;
+        sum += values[i];
+    }
+    assert(pipe_sum(values, 128) == sum);
+    for (long x = -100; x < 100; x++) {
+        assert(pipe_select(0, x) == x + 1);
+        assert(pipe_select(1, x) == x * 3);
+        assert(pipe_select(2, x) == -x);
+        assert(pipe_select(3, x) == x);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,79 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0
+# 
+# Copyright (C) 2020-2026  Jevgenijs Protopopovs
+# 
+# This file is part of Kefir project.
+# 
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3.
+# # 
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+set -e
+
+KEFIR_BIN_DIR="$(realpath "$1")"
+WORK_DIR="$(realpath -m "$2")"
+SRC_DIR="$(realpath "$(dirname "$0")")"
+KEFIRCC="$KEFIR_BIN_DIR/kefir"
+export LD_LIBRARY_PATH="$KEFIR_BIN_DIR/libs"
+export KEFIR_RTINC="$SRC_DIR/../../../../headers/kefir/runtime"
+export KEFIR_DRIVER_ASSEMBLER_PIPE1_AS="${AS:-as}"
+export KEFIR_DRIVER_ASSEMBLER_PIPE1_LOG="$WORK_DIR/assembler.log"
+export KEFIR_AS="$SRC_DIR/assembler.sh"
+unset KEFIR_JOBS
+KEFIR_CFLAGS="--target host-none -fPIC -I $SRC_DIR"
+
+fail () {
+    echo "$SRC_DIR: $1" >&2
+    exit 1
+}
+
+expect_failure () {
+    local exit_code=0
+    "$KEFIRCC" $KEFIR_CFLAGS "$@" 2>stderr.log || exit_code=$?
+    [[ "$exit_code" == "1" ]] || fail "Expected exit status 1 for '$*', got $exit_code"
+}
+
+rm -rf "$WORK_DIR"
+mkdir -p "$WORK_DIR"
+cd "$WORK_DIR"
+
+# Successful compilation streams assembly into the assembler
+for OPT in "-O0" "-O1"; do
+    rm -f valid.o test assembler.log
+    "$KEFIRCC" $KEFIR_CFLAGS $OPT -c "$SRC_DIR/valid.c" -o valid.o
+    [[ "$(cat assembler.log)" == "pipe" ]] || fail "Expected assembler input to be a pipe with '$OPT'"
+    $CC $TEST_CFLAGS valid.o "$SRC_DIR/main.c" -o test
+    ./test || fail "Piped compilation with '$OPT' produced incorrect object"
+done
+
+# Assembler failure is reported with the source file name and leaves no object behind
+rm -f invalid_asm.o assembler.log
+expect_failure -c "$SRC_DIR/invalid_asm.c" -o invalid_asm.o
+[[ "$(cat assembler.log)" == "pipe" ]] || fail "Expected assembler input to be a pipe"
+grep -q "kefir_driver_assembler_pipe1_invalid_mnemonic" stderr.log || fail "Expected assembler diagnostics"
+grep -q "Failed to assemble '$SRC_DIR/invalid_asm.c'" stderr.log || fail "Expected assembler failure report"
+[[ ! -f invalid_asm.o ]] || fail "Unexpected object file after assembler failure"
+
+# Compiler failure is reported by the compiler only: the assembler never observes end of partial input
+rm -f invalid_c.o assembler.log
+expect_failure -c "$SRC_DIR/invalid_c.c" -o invalid_c.o
+grep -q "invalid_c.c" stderr.log || fail "Expected compiler diagnostics"
+if grep -q "Failed to assemble" stderr.log; then
+    fail "Unexpected assembler failure report after compiler failure"
+fi
+[[ ! -f invalid_c.o ]] || fail "Unexpected object file after compiler failure"
+
+# Assembler exiting before consuming the complete compiler output does not hang the driver
+rm -f valid.o
+KEFIR_DRIVER_ASSEMBLER_PIPE1_AS=false expect_failure -c "$SRC_DIR/valid.c" -o valid.o
+grep -q "Failed to assemble '$SRC_DIR/valid.c'" stderr.log || fail "Expected assembler failure report"
+[[ ! -f valid.o ]] || fail "Unexpected object file after early assembler exit"
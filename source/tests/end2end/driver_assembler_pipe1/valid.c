@@ -0,0 +1,45 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "./definitions.h"
+
+long pipe_sum(const long *values, unsigned long length) {
+    long sum = 0;
+    for (unsigned long i = 0; i < length; i++) {
+        sum += values[i];
+    }
+    return sum;
+}
+
+long pipe_select(int selector, long value) {
+    switch (selector) {
+        case 0:
+            return value + 1;
+
+        case 1:
+            return value * 3;
+
+        case 2:
+            return -value;
+
+        default:
+            return value;
+    }
+}
@@ -0,0 +1,10 @@
+KEFIR_END2END_TEST_NAME := $(patsubst source/tests/end2end/%/Makefile.mk,%,$(lastword $(MAKEFILE_LIST)))
+$(KEFIR_END2END_BIN_PATH)/$(KEFIR_END2END_TEST_NAME).test.done: KEFIR_END2END_TEST_NAME := $(KEFIR_END2END_TEST_NAME)
+$(KEFIR_END2END_BIN_PATH)/$(KEFIR_END2END_TEST_NAME).test.done: $(KEFIR_BIN_DIR)/kefir $(wildcard $(SOURCE_DIR)/tests/end2end/$(KEFIR_END2END_TEST_NAME)/*)
+	@mkdir -p $(shell dirname "$@")
+	@echo "Running $(KEFIR_END2END_TEST_NAME)"
+	@CC="$(CC)" TEST_CFLAGS="$(TEST_CFLAGS)" \
+		$(SOURCE_DIR)/tests/end2end/$(KEFIR_END2END_TEST_NAME)/test.sh $(KEFIR_BIN_DIR) $(KEFIR_END2END_BIN_PATH)/$(KEFIR_END2END_TEST_NAME)
+	@touch $@
+
+TESTS += $(KEFIR_END2END_BIN_PATH)/$(KEFIR_END2END_TEST_NAME).test.done
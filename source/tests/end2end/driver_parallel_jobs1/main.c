@@ -0,0 +1,34 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <assert.h>
+#include "./definitions.h"
+
+int main(void) {
+    for (long x = -100; x < 100; x++) {
+        for (long y = -100; y < 100; y++) {
+            assert(unit1_sum(x, y) == x + y);
+            assert(unit2_mul(x, y) == x * y);
+        }
+    }
+    assert(unit3_fact(10) == 3628800l);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0
+# 
+# Copyright (C) 2020-2026  Jevgenijs Protopopovs
+# 
+# This file is part of Kefir project.
+# 
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3.
+# # 
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+set -e
+
+KEFIR_BIN_DIR="$(realpath "$1")"
+WORK_DIR="$(realpath -m "$2")"
+SRC_DIR="$(realpath "$(dirname "$0")")"
+KEFIRCC="$KEFIR_BIN_DIR/kefir"
+export LD_LIBRARY_PATH="$KEFIR_BIN_DIR/libs"
+export KEFIR_RTINC="$SRC_DIR/../../../../headers/kefir/runtime"
+unset KEFIR_JOBS
+KEFIR_CFLAGS="--target host-none -fPIC -I $SRC_DIR"
+
+fail () {
+    echo "$SRC_DIR: $1" >&2
+    exit 1
+}
+
+rm -rf "$WORK_DIR"
+mkdir -p "$WORK_DIR"
+cd "$WORK_DIR"
+
+# Successful compilation with the job count supplied via every accepted spelling
+for JOBS in "-j4" "-j 3" "--jobs=2" "--jobs 4" "KEFIR_JOBS=3"; do
+    rm -f *.o test
+    if [[ "$JOBS" == KEFIR_JOBS=* ]]; then
+        env "$JOBS" "$KEFIRCC" $KEFIR_CFLAGS -c "$SRC_DIR/unit1.c" "$SRC_DIR/unit2.c" "$SRC_DIR/unit3.c"
+    else
+        "$KEFIRCC" $KEFIR_CFLAGS $JOBS -c "$SRC_DIR/unit1.c" "$SRC_DIR/unit2.c" "$SRC_DIR/unit3.c"
+    fi
+    $CC $TEST_CFLAGS unit1.o unit2.o unit3.o "$SRC_DIR/main.c" -o test
+    ./test || fail "Parallel compilation with '$JOBS' produced incorrect objects"
+done
+
+# Failing input: the driver reports the first failure in submission order, discards diagnostics of later inputs and
+# leaves exactly the same objects behind as sequential compilation does
+for JOBS in "-j1" "-j4"; do
+    rm -f *.o
+    if "$KEFIRCC" $KEFIR_CFLAGS $JOBS -c "$SRC_DIR/unit1.c" "$SRC_DIR/broken1.c" "$SRC_DIR/unit2.c" \
+            "$SRC_DIR/broken2.c" "$SRC_DIR/unit3.c" 2>stderr.log; then
+        fail "Expected compilation with '$JOBS' to fail"
+    fi
+    grep -q "undeclared_identifier1" stderr.log || fail "Expected diagnostics for broken1.c with '$JOBS'"
+    if grep -q "undeclared_identifier2" stderr.log; then
+        fail "Unexpected diagnostics for broken2.c with '$JOBS'"
+    fi
+    [[ -f unit1.o ]] || fail "Expected unit1.o to be produced with '$JOBS'"
+    [[ ! -f broken1.o && ! -f unit2.o && ! -f broken2.o && ! -f unit3.o ]] ||
+        fail "Unexpected objects left after failed compilation with '$JOBS'"
+done
+
+# Invalid job counts are rejected
+for JOBS in "-j0" "-j 0" "-j2x" "--jobs=" "--jobs=abc" "--jobs=-1" "--jobs=99999999999999999999999" \
+        "KEFIR_JOBS=0" "KEFIR_JOBS=four"; do
+    if [[ "$JOBS" == KEFIR_JOBS=* ]]; then
+        if env "$JOBS" "$KEFIRCC" $KEFIR_CFLAGS -c "$SRC_DIR/unit1.c" 2>stderr.log; then
+            fail "Expected '$JOBS' to be rejected"
+        fi
+    elif "$KEFIRCC" $KEFIR_CFLAGS $JOBS -c "$SRC_DIR/unit1.c" 2>stderr.log; then
+        fail "Expected '$JOBS' to be rejected"
+    fi
+    grep -q "number of parallel jobs" stderr.log || fail "Expected job count diagnostic for '$JOBS'"
+done
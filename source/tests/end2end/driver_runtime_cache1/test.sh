@@ -0,0 +1,105 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0
+# 
+# Copyright (C) 2020-2026  Jevgenijs Protopopovs
+# 
+# This file is part of Kefir project.
+# 
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3.
+# # 
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+set -e
+
+KEFIR_BIN_DIR="$(realpath "$1")"
+WORK_DIR="$(realpath -m "$2")"
+SRC_DIR="$(realpath "$(dirname "$0")")"
+KEFIRCC="$KEFIR_BIN_DIR/kefir"
+export LD_LIBRARY_PATH="$KEFIR_BIN_DIR/libs"
+export KEFIR_RTINC="$SRC_DIR/../../../../headers/kefir/runtime"
+unset KEFIR_RUNTIME_CACHE
+KEFIR_CFLAGS="--target host-none -fPIC -O1 -I $SRC_DIR"
+CACHE_DIR="$WORK_DIR/cache"
+HIT_MARKER="# runtime cache hit"
+
+fail () {
+    echo "$SRC_DIR: $1" >&2
+    exit 1
+}
+
+cached_kefir () {
+    KEFIR_RUNTIME_CACHE="$CACHE_DIR" "$KEFIRCC" $KEFIR_CFLAGS "$@"
+}
+
+function_entry () {
+    grep -l -x "entry function $1" "$CACHE_DIR"/runtime-*.s
+}
+
+# Appends an assembly comment to the cached function code and adjusts the entry content length
+mark_entry () {
+    local LENGTH="$(grep -m 1 '^content ' "$1" | cut -d' ' -f2)"
+    sed -i "0,/^content $LENGTH\$/s//content $((LENGTH + ${#HIT_MARKER} + 1))/" "$1"
+    printf '%s\n' "$HIT_MARKER" >> "$1"
+}
+
+link_and_run () {
+    $CC $TEST_CFLAGS unit1.o unit2.o "$SRC_DIR/main.c" -o test
+    ./test || fail "$1"
+}
+
+rm -rf "$WORK_DIR"
+mkdir -p "$WORK_DIR"
+cd "$WORK_DIR"
+
+"$KEFIRCC" $KEFIR_CFLAGS -S "$SRC_DIR/unit1.c" -o uncached1.s
+"$KEFIRCC" $KEFIR_CFLAGS -S "$SRC_DIR/unit2.c" -o uncached2.s
+
+# Cache miss: the runtime is generated as without cache, and each generated function is stored in a separate entry
+cached_kefir -S "$SRC_DIR/unit1.c" -o miss1.s
+cmp -s uncached1.s miss1.s || fail "Expected cache miss to produce the same code as uncached compilation"
+[[ "$(grep -l -x "entry prologue" "$CACHE_DIR"/runtime-*.s | wc -l)" == "1" ]] || fail "Expected single prologue entry"
+DIVIDE_ENTRY="$(function_entry __kefir_bigint_signed_divide)"
+MULTIPLY_ENTRY="$(function_entry __kefir_bigint_signed_multiply)"
+[[ -n "$DIVIDE_ENTRY" && -n "$MULTIPLY_ENTRY" && "$DIVIDE_ENTRY" != "$MULTIPLY_ENTRY" ]] ||
+    fail "Expected separate cache entries for runtime functions"
+
+# Cache hit: cached function code is reused by other translation units requiring any subset of cached functions
+mark_entry "$DIVIDE_ENTRY"
+cached_kefir -S "$SRC_DIR/unit1.c" -o hit1.s
+cached_kefir -S "$SRC_DIR/unit2.c" -o hit2.s
+grep -q -x "$HIT_MARKER" hit1.s || fail "Expected cache hit for unit1.c"
+grep -q -x "$HIT_MARKER" hit2.s || fail "Expected cache hit for unit2.c"
+cached_kefir -c "$SRC_DIR/unit1.c" -o unit1.o
+cached_kefir -c "$SRC_DIR/unit2.c" -o unit2.o
+link_and_run "Cached runtime functions produced incorrect objects"
+
+# Corrupt entry: truncated entry is ignored and regenerated
+head -c -16 "$DIVIDE_ENTRY" > truncated.s
+mv truncated.s "$DIVIDE_ENTRY"
+cached_kefir -S "$SRC_DIR/unit2.c" -o corrupt2.s
+cmp -s uncached2.s corrupt2.s || fail "Expected truncated cache entry to be regenerated"
+grep -q -x "$HIT_MARKER" "$(function_entry __kefir_bigint_signed_divide)" &&
+    fail "Expected truncated entry to be replaced"
+
+# Stale entry: entries produced by a different compiler version or configuration are ignored
+mark_entry "$MULTIPLY_ENTRY"
+sed -i '1s/.*/kefir 0.0.0/' "$MULTIPLY_ENTRY"
+cached_kefir -S "$SRC_DIR/unit1.c" -o stale1.s
+cmp -s uncached1.s stale1.s || fail "Expected stale cache entry to be regenerated"
+mark_entry "$(function_entry __kefir_bigint_signed_multiply)"
+cached_kefir -O0 -S "$SRC_DIR/unit1.c" -o config1.s
+grep -q -x "$HIT_MARKER" config1.s && fail "Unexpected cache hit with different optimization level"
+cached_kefir -S "$SRC_DIR/unit1.c" -o hit1.s
+grep -q -x "$HIT_MARKER" hit1.s || fail "Expected cache hit for regenerated entries"
+
+cached_kefir -c "$SRC_DIR/unit1.c" -o unit1.o
+cached_kefir -c "$SRC_DIR/unit2.c" -o unit2.o
+link_and_run "Regenerated runtime functions produced incorrect objects"
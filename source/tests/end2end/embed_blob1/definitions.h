@@ -0,0 +1,58 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef DEFINITIONS_H_
+#define DEFINITIONS_H_
+
+#define BLOB_CONTENT "Embedded blob \xc3\xa9\xc3\xa0 with some high bytes \xff\x80 and a tail\n"
+#define BLOB_LENGTH (sizeof(BLOB_CONTENT) - 1)
+
+struct S1 {
+    int tag;
+    char payload[8];
+    long tail;
+};
+
+struct S2 {
+    short a;
+    char b[2];
+    long c;
+    float d;
+};
+
+extern const unsigned char blob[];
+extern const unsigned long blob_length;
+extern const int blob_ints[];
+extern const unsigned long blob_ints_length;
+extern struct S1 s1;
+extern const char blob_suffixed[];
+extern const unsigned long blob_suffixed_length;
+extern const signed char blob_limited[];
+extern const unsigned long blob_limited_length;
+extern int blob_first;
+extern const unsigned long blob_arg_count;
+extern struct S2 s2;
+
+unsigned long blob_checksum(void);
+int blob_local_at(int);
+struct S2 blob_local_s2(void);
+
+#endif
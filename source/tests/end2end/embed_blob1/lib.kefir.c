@@ -0,0 +1,88 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "./definitions.h"
+
+const unsigned char blob[] = {
+#embed "data.bin"
+};
+const unsigned long blob_length = sizeof(blob);
+
+const int blob_ints[] = {
+#embed "data.bin"
+};
+const unsigned long blob_ints_length = sizeof(blob_ints) / sizeof(blob_ints[0]);
+
+struct S1 s1 = {.tag = 1,
+                .payload = {
+#embed "data.bin" limit(8)
+                },
+                .tail = -1};
+
+const char blob_suffixed[] = {
+#embed "data.bin" suffix(, 0)
+};
+const unsigned long blob_suffixed_length = sizeof(blob_suffixed);
+
+const signed char blob_limited[] = {
+#embed "data.bin" limit(4)
+};
+const unsigned long blob_limited_length = sizeof(blob_limited);
+
+#define FIRST(x, ...) x
+#define COUNT(...) (sizeof((int[]) {__VA_ARGS__}) / sizeof(int))
+
+int blob_first = FIRST(
+#embed "data.bin"
+);
+
+const unsigned long blob_arg_count = COUNT(
+#embed "data.bin"
+);
+
+struct S2 s2 = {
+#embed "data.bin" limit(5)
+};
+
+unsigned long blob_checksum(void) {
+    const unsigned char local[] = {
+#embed "data.bin"
+    };
+    unsigned long checksum = 0;
+    for (unsigned long i = 0; i < sizeof(local); i++) {
+        checksum = checksum * 31 + local[i];
+    }
+    return checksum;
+}
+
+int blob_local_at(int index) {
+    unsigned short local[] = {
+#embed "data.bin"
+    };
+    return local[index];
+}
+
+struct S2 blob_local_s2(void) {
+    struct S2 local = {
+#embed "data.bin" limit(5)
+    };
+    return local;
+}
@@ -0,0 +1 @@
+KEFIR_CFLAGS="$KEFIR_CFLAGS -O2 --embed-dir=$(dirname $SRC_FILE)"
\ No newline at end of file
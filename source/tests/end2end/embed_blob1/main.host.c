@@ -0,0 +1,76 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include "./definitions.h"
+
+int main(void) {
+    const unsigned char *content = (const unsigned char *) BLOB_CONTENT;
+
+    assert(blob_length == BLOB_LENGTH);
+    assert(memcmp(blob, content, BLOB_LENGTH) == 0);
+
+    assert(blob_ints_length == BLOB_LENGTH);
+    for (unsigned long i = 0; i < BLOB_LENGTH; i++) {
+        assert(blob_ints[i] == content[i]);
+    }
+
+    assert(s1.tag == 1);
+    assert(memcmp(s1.payload, content, sizeof(s1.payload)) == 0);
+    assert(s1.tail == -1);
+
+    assert(blob_suffixed_length == BLOB_LENGTH + 1);
+    assert(memcmp(blob_suffixed, content, BLOB_LENGTH) == 0);
+    assert(blob_suffixed[BLOB_LENGTH] == 0);
+
+    assert(blob_limited_length == 4);
+    assert(memcmp(blob_limited, content, 4) == 0);
+
+    assert(blob_first == content[0]);
+    assert(blob_arg_count == BLOB_LENGTH);
+
+    assert(s2.a == content[0]);
+    assert(s2.b[0] == (char) content[1]);
+    assert(s2.b[1] == (char) content[2]);
+    assert(s2.c == content[3]);
+    assert(s2.d == content[4]);
+
+    struct S2 local_s2 = blob_local_s2();
+    assert(local_s2.a == content[0]);
+    assert(local_s2.b[0] == (char) content[1]);
+    assert(local_s2.b[1] == (char) content[2]);
+    assert(local_s2.c == content[3]);
+    assert(local_s2.d == content[4]);
+
+    unsigned long checksum = 0;
+    for (unsigned long i = 0; i < BLOB_LENGTH; i++) {
+        checksum = checksum * 31 + content[i];
+    }
+    assert(blob_checksum() == checksum);
+
+    for (unsigned long i = 0; i < BLOB_LENGTH; i++) {
+        assert(blob_local_at(i) == content[i]);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1 @@
+KEFIR_CFLAGS="$KEFIR_CFLAGS -E"
\ No newline at end of file
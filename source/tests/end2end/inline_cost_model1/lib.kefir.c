@@ -0,0 +1,62 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "./definitions.h"
+
+static long get_x(const struct point *pt) {
+    return pt->x;
+}
+
+static long get_y(const struct point *pt) {
+    return pt->y;
+}
+
+static long scale(long value, long factor) {
+    if (factor == 1) {
+        return value;
+    }
+    return value * factor;
+}
+
+static long norm1(const struct point *pt) {
+    long x = get_x(pt);
+    long y = get_y(pt);
+    return (x < 0 ? -x : x) + (y < 0 ? -y : y);
+}
+
+__attribute__((noinline)) static long triple(long value) {
+    return value * 3;
+}
+
+long sum_points(const struct point *points, unsigned long length) {
+    long sum = 0;
+    for (unsigned long i = 0; i < length; i++) {
+        sum += scale(get_x(&points[i]), 1) + scale(get_y(&points[i]), 2);
+    }
+    return sum;
+}
+
+long scaled_norm(const struct point *pt, long factor) {
+    return scale(norm1(pt), factor);
+}
+
+long tripled(long value) {
+    return triple(value);
+}
@@ -0,0 +1,44 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include "./definitions.h"
+
+int main(void) {
+    struct point points[64];
+    long expected_sum = 0;
+    for (long i = 0; i < 64; i++) {
+        points[i].x = i * 7 - 200;
+        points[i].y = 100 - i * 3;
+        expected_sum += points[i].x + points[i].y * 2;
+    }
+    assert(sum_points(points, 64) == expected_sum);
+    assert(sum_points(points, 0) == 0);
+
+    for (long i = 0; i < 64; i++) {
+        long norm = labs(points[i].x) + labs(points[i].y);
+        assert(scaled_norm(&points[i], 1) == norm);
+        assert(scaled_norm(&points[i], -5) == norm * -5);
+        assert(tripled(i - 32) == (i - 32) * 3);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,128 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "./definitions.h"
+
+static int scale(int x) {
+    return x * 3 + 1;
+}
+
+static double dscale(double x) {
+    return x * 2.5;
+}
+
+int (*scale_ptr)(int) = scale;
+int counter;
+int initialized_counter = 42;
+static int local_counter;
+_Thread_local int thread_value = 5;
+static _Thread_local long thread_local_value;
+extern _Thread_local int external_thread_value;
+extern int external_value;
+static const char *const strings[] = {"hello", "world", "integrated", "assembler"};
+const struct structure constant_structure = {1, 2.0f, {3, 4, 5}};
+
+__attribute__((weak)) int weak_fn(int x) {
+    return x + 1;
+}
+
+__attribute__((visibility("hidden"))) int hidden_fn(int x) {
+    return x - 1;
+}
+
+int alias_fn(int) __attribute__((alias("hidden_fn")));
+
+double dfn(double y) {
+    return dscale(y) + 1.25;
+}
+
+int get_thread_values(int a) {
+    thread_local_value += a;
+    return scale(a) + thread_value + external_thread_value + (int) thread_local_value;
+}
+
+const char *get_string(int i) {
+    return strings[i & 3];
+}
+
+int classify(int x) {
+    switch (x) {
+        case 0:
+            return 10;
+        case 1:
+            return 20;
+        case 2:
+            return 30;
+        case 3:
+            return 40;
+        case 100:
+            return 50;
+        case 1000:
+            return 60;
+        default:
+            return -1;
+    }
+}
+
+long loop_sum(const long *array, unsigned long length) {
+    long sum = 0;
+    for (unsigned long i = 0; i < length; i++) {
+        if (array[i] > 0) {
+            sum += array[i] << 2;
+        } else {
+            sum -= array[i] / 3;
+        }
+    }
+    return sum + external_value + counter++ + local_counter++;
+}
+
+long double ldmix(long double x, float y, unsigned char z) {
+    return x * y - z;
+}
+
+int atomic_increment(_Atomic int *value) {
+    return ++*value;
+}
+
+int variadic_sum(int count, ...) {
+    __builtin_va_list args;
+    __builtin_va_start(args, count);
+    int sum = 0;
+    while (count-- > 0) {
+        sum += __builtin_va_arg(args, int);
+    }
+    __builtin_va_end(args);
+    return sum;
+}
+
+struct structure copy_structure(struct structure s) {
+    s.values[0] += s.a;
+    return s;
+}
+
+static int constructor_value;
+
+__attribute__((constructor)) static void init_constructor_value(void) {
+    constructor_value = 7;
+}
+
+int get_constructor_value(void) {
+    return constructor_value + initialized_counter;
+}
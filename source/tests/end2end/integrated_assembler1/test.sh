@@ -0,0 +1,96 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0
+# 
+# Copyright (C) 2020-2026  Jevgenijs Protopopovs
+# 
+# This file is part of Kefir project.
+# 
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, version 3.
+# # 
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+# 
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+set -e
+
+KEFIR_BIN_DIR="$(realpath "$1")"
+WORK_DIR="$(realpath -m "$2")"
+SRC_DIR="$(realpath "$(dirname "$0")")"
+KEFIRCC="$KEFIR_BIN_DIR/kefir"
+export LD_LIBRARY_PATH="$KEFIR_BIN_DIR/libs"
+export KEFIR_RTINC="$SRC_DIR/../../../../headers/kefir/runtime"
+export KEFIR_AS="${AS:-as}"
+unset KEFIR_JOBS
+KEFIR_CFLAGS="--target host-none -fPIC -I $SRC_DIR"
+
+fail () {
+    echo "$SRC_DIR: $1" >&2
+    exit 1
+}
+
+# Prints a representation of the object file that does not depend on file layout
+normalize () {
+    local kind="$1"
+    local object="$2"
+    case "$kind" in
+        disassembly)
+            objdump -dr -w "$object" | tail -n +3
+            ;;
+
+        relocations)
+            readelf -rW "$object" | awk '/^Relocation section/ { print $3; next } NF >= 4 && $1 ~ /^[0-9a-f]+$/ { $2 = ""; print }' | sort
+            ;;
+
+        symbols)
+            readelf -sW "$object" | awk 'NF >= 7 && $1 ~ /^[0-9]+:$/ { $1 = ""; print }'
+            ;;
+
+        sections)
+            readelf -SW "$object" | awk '/^  \[ *[0-9]+\]/ { sub(/^  \[ *[0-9]+\] */, ""); if ($1 != ".symtab" && $1 != ".strtab" && $1 != ".shstrtab") { $3 = ""; $4 = ""; print } }'
+            ;;
+
+        lines)
+            readelf --debug-dump=decodedline "$object" 2>/dev/null | tail -n +3
+            ;;
+
+        data)
+            for section in $(readelf -SW "$object" | awk '/^  \[ *[0-9]+\]/ { sub(/^  \[ *[0-9]+\] */, ""); if ($1 != "NULL" && $2 != "NOBITS" && $2 != "RELA" && $2 != "SYMTAB" && $2 != "STRTAB" && $1 !~ /^\.text/) print $1 }'); do
+                echo "$section"
+                readelf -x "$section" "$object" 2>/dev/null | tail -n +2
+            done
+            ;;
+    esac
+}
+
+rm -rf "$WORK_DIR"
+mkdir -p "$WORK_DIR"
+cd "$WORK_DIR"
+
+# Objects produced by the integrated assembler are equivalent to the ones produced by the GNU assembler
+for OPT in "-O0" "-O1" "-O1 -fcommon" "-O0 -g" "-O1 -g"; do
+    rm -f gnu.o integrated.o
+    "$KEFIRCC" $KEFIR_CFLAGS $OPT -fno-integrated-as -c "$SRC_DIR/code.c" -o gnu.o
+    KEFIR_AS=false "$KEFIRCC" $KEFIR_CFLAGS $OPT -fintegrated-as -c "$SRC_DIR/code.c" -o integrated.o || \
+        fail "Expected integrated assembler to produce object with '$OPT'"
+    for KIND in disassembly relocations symbols sections lines data; do
+        normalize "$KIND" gnu.o > "gnu.$KIND"
+        normalize "$KIND" integrated.o > "integrated.$KIND"
+        diff -u "gnu.$KIND" "integrated.$KIND" >&2 || fail "Integrated assembler output differs in $KIND with '$OPT'"
+    done
+done
+
+# Output kind is reported explicitly: modules containing inline assembly are emitted as textual assembly
+"$KEFIRCC" -cc1 --codegen-integrated-as --output-kind code.kind -o code.out "$SRC_DIR/code.c"
+[[ "$(cat code.kind)" == "object" ]] || fail "Expected object output kind"
+[[ "$(head -c 4 code.out)" == $'\x7fELF' ]] || fail "Expected ELF object output"
+"$KEFIRCC" -cc1 --codegen-integrated-as --output-kind inline_asm.kind -o inline_asm.out \
+    "$SRC_DIR/inline_asm.c"
+[[ "$(cat inline_asm.kind)" == "assembly" ]] || fail "Expected assembly output kind for inline assembly"
+"$KEFIRCC" $KEFIR_CFLAGS -fintegrated-as -c "$SRC_DIR/inline_asm.c" -o inline_asm.o
+objdump -d inline_asm.o | grep -q "lea" || fail "Expected inline assembly to be assembled externally"
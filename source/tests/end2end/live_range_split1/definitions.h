@@ -0,0 +1,35 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef DEFINITIONS_H_
+#define DEFINITIONS_H_
+
+extern double reported;
+void report(double);
+long cold(long);
+double transform(double);
+
+double scale_sum(const double *, long, double);
+long mixed(const long *, long, long, long, long, long, long);
+double grid_sum(const double *, long, long, double);
+double call_sum(const double *, long, double, double);
+
+#endif
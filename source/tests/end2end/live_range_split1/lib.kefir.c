@@ -0,0 +1,67 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "./definitions.h"
+
+double scale_sum(const double *arr, long n, double factor) {
+    double sum = 0.0;
+    for (long i = 0; i < n; i++) {
+        sum += arr[i] * factor;
+    }
+    report(sum);
+    return sum * factor;
+}
+
+long mixed(const long *arr, long n, long a, long b, long c, long d, long e) {
+    long acc = 0;
+    for (long i = 0; i < n; i++) {
+        acc += arr[i] * a + b;
+        acc ^= c;
+        if (acc > d) {
+            acc -= e;
+        }
+    }
+    long x = cold(acc);
+    return x + a + b + c + d + e + acc;
+}
+
+double grid_sum(const double *grid, long rows, long cols, double weight) {
+    double total = 0.0;
+    for (long i = 0; i < rows; i++) {
+        double row = 0.0;
+        for (long j = 0; j < cols; j++) {
+            row += grid[i * cols + j] * weight;
+        }
+        total += row;
+    }
+    report(total);
+    return total + weight;
+}
+
+double call_sum(const double *arr, long n, double factor, double bias) {
+    double sum = 0.0;
+    for (long i = 0; i < n; i++) {
+        double value = arr[i] * factor + bias;
+        sum += transform(value) * factor;
+        sum -= bias * factor;
+    }
+    return sum + factor + bias;
+}
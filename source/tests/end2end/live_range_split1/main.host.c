@@ -0,0 +1,98 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <assert.h>
+#include <math.h>
+#include "./definitions.h"
+
+double reported = 0.0;
+
+void report(double value) {
+    reported = value;
+}
+
+long cold(long value) {
+    return value * 3 + 1;
+}
+
+double transform(double value) {
+    return value * 0.5 - 1.0;
+}
+
+static long mixed_ref(const long *arr, long n, long a, long b, long c, long d, long e) {
+    long acc = 0;
+    for (long i = 0; i < n; i++) {
+        acc += arr[i] * a + b;
+        acc ^= c;
+        if (acc > d) {
+            acc -= e;
+        }
+    }
+    return cold(acc) + a + b + c + d + e + acc;
+}
+
+int main(void) {
+    double values[16];
+    long ivalues[16];
+    for (int i = 0; i < 16; i++) {
+        values[i] = i * 0.5 - 3.0;
+        ivalues[i] = i * 7 - 40;
+    }
+
+    for (long n = 0; n <= 16; n++) {
+        double expected = 0.0;
+        for (long i = 0; i < n; i++) {
+            expected += values[i] * 1.5;
+        }
+        double result = scale_sum(values, n, 1.5);
+        assert(fabs(reported - expected) < 1e-9);
+        assert(fabs(result - expected * 1.5) < 1e-9);
+
+        for (long d = -50; d <= 50; d += 25) {
+            assert(mixed(ivalues, n, 3, -2, 0x55, d, 17) == mixed_ref(ivalues, n, 3, -2, 0x55, d, 17));
+        }
+
+        expected = 0.0;
+        for (long i = 0; i < n; i++) {
+            expected += transform(values[i] * 2.5 + 0.75) * 2.5;
+            expected -= 0.75 * 2.5;
+        }
+        assert(fabs(call_sum(values, n, 2.5, 0.75) - (expected + 2.5 + 0.75)) < 1e-9);
+    }
+
+    for (long rows = 0; rows <= 4; rows++) {
+        for (long cols = 0; cols <= 4; cols++) {
+            double expected = 0.0;
+            for (long i = 0; i < rows; i++) {
+                double row = 0.0;
+                for (long j = 0; j < cols; j++) {
+                    row += values[i * cols + j] * -0.25;
+                }
+                expected += row;
+            }
+            double result = grid_sum(values, rows, cols, -0.25);
+            assert(fabs(reported - expected) < 1e-9);
+            assert(fabs(result - (expected - 0.25)) < 1e-9);
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,69 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef DEFINITIONS_H_
+#define DEFINITIONS_H_
+
+struct S3 {
+    char arr[3];
+};
+
+struct S24 {
+    long arr[3];
+};
+
+struct S37 {
+    char arr[37];
+};
+
+struct S100 {
+    int arr[25];
+};
+
+struct S300 {
+    char arr[300];
+};
+
+void copy1(char *, const char *);
+void copy7(char *, const char *);
+void copy12(char *, const char *);
+void *copy16(char *, const char *);
+void copy37(char *, const char *);
+void copy64(char *, const char *);
+void copy256(char *, const char *);
+void copy300(char *, const char *);
+
+void set0_5(char *);
+void set0_40(char *);
+void set0_257(char *);
+void set_a5_3(char *);
+void set_a5_13(char *);
+void set_a5_40(char *);
+void set_var(char *, int);
+
+void assign3(struct S3 *, const struct S3 *);
+void assign24(struct S24 *, const struct S24 *);
+struct S37 get37(const struct S37 *);
+void assign100(struct S100 *, const struct S100 *);
+void assign300(struct S300 *, const struct S300 *);
+struct S100 zero100(void);
+
+#endif
@@ -0,0 +1,109 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "./definitions.h"
+
+void *memcpy(void *, const void *, unsigned long);
+void *memset(void *, int, unsigned long);
+
+void copy1(char *dst, const char *src) {
+    memcpy(dst, src, 1);
+}
+
+void copy7(char *dst, const char *src) {
+    memcpy(dst, src, 7);
+}
+
+void copy12(char *dst, const char *src) {
+    memcpy(dst, src, 12);
+}
+
+void *copy16(char *dst, const char *src) {
+    return memcpy(dst, src, 16);
+}
+
+void copy37(char *dst, const char *src) {
+    memcpy(dst, src, 37);
+}
+
+void copy64(char *dst, const char *src) {
+    memcpy(dst, src, 64);
+}
+
+void copy256(char *dst, const char *src) {
+    memcpy(dst, src, 256);
+}
+
+void copy300(char *dst, const char *src) {
+    memcpy(dst, src, 300);
+}
+
+void set0_5(char *dst) {
+    memset(dst, 0, 5);
+}
+
+void set0_40(char *dst) {
+    memset(dst, 0, 40);
+}
+
+void set0_257(char *dst) {
+    memset(dst, 0, 257);
+}
+
+void set_a5_3(char *dst) {
+    memset(dst, 0xa5, 3);
+}
+
+void set_a5_13(char *dst) {
+    memset(dst, 0xa5, 13);
+}
+
+void set_a5_40(char *dst) {
+    memset(dst, 0x1a5, 40);
+}
+
+void set_var(char *dst, int value) {
+    memset(dst, value, 13);
+}
+
+void assign3(struct S3 *dst, const struct S3 *src) {
+    *dst = *src;
+}
+
+void assign24(struct S24 *dst, const struct S24 *src) {
+    *dst = *src;
+}
+
+struct S37 get37(const struct S37 *src) {
+    return *src;
+}
+
+void assign100(struct S100 *dst, const struct S100 *src) {
+    *dst = *src;
+}
+
+void assign300(struct S300 *dst, const struct S300 *src) {
+    *dst = *src;
+}
+
+struct S100 zero100(void) {
+    return (struct S100) {0};
+}
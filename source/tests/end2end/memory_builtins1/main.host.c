@@ -0,0 +1,120 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include "./definitions.h"
+
+#define GUARD 16
+#define BUFSZ (320 + 2 * GUARD)
+
+static char src[BUFSZ];
+static char dst[BUFSZ];
+static char ref[BUFSZ];
+
+static void reset(void) {
+    for (int i = 0; i < BUFSZ; i++) {
+        src[i] = (char) (i * 7 + 3);
+        dst[i] = (char) (0x5a ^ i);
+    }
+    memcpy(ref, dst, BUFSZ);
+}
+
+#define CHECK_COPY(_fn, _size)                               \
+    do {                                                     \
+        reset();                                             \
+        _fn(dst + GUARD, src + GUARD);                       \
+        memcpy(ref + GUARD, src + GUARD, (_size));           \
+        assert(memcmp(dst, ref, BUFSZ) == 0);                \
+    } while (0)
+
+#define CHECK_SET(_fn, _value, _size)                        \
+    do {                                                     \
+        reset();                                             \
+        _fn(dst + GUARD);                                    \
+        memset(ref + GUARD, (_value), (_size));              \
+        assert(memcmp(dst, ref, BUFSZ) == 0);                \
+    } while (0)
+
+int main(void) {
+    CHECK_COPY(copy1, 1);
+    CHECK_COPY(copy7, 7);
+    CHECK_COPY(copy12, 12);
+    CHECK_COPY(copy37, 37);
+    CHECK_COPY(copy64, 64);
+    CHECK_COPY(copy256, 256);
+    CHECK_COPY(copy300, 300);
+
+    reset();
+    assert(copy16(dst + GUARD, src + GUARD) == dst + GUARD);
+    memcpy(ref + GUARD, src + GUARD, 16);
+    assert(memcmp(dst, ref, BUFSZ) == 0);
+
+    CHECK_SET(set0_5, 0, 5);
+    CHECK_SET(set0_40, 0, 40);
+    CHECK_SET(set0_257, 0, 257);
+    CHECK_SET(set_a5_3, 0xa5, 3);
+    CHECK_SET(set_a5_13, 0xa5, 13);
+    CHECK_SET(set_a5_40, 0xa5, 40);
+
+    for (int value = -2; value < 260; value += 37) {
+        reset();
+        set_var(dst + GUARD, value);
+        memset(ref + GUARD, value, 13);
+        assert(memcmp(dst, ref, BUFSZ) == 0);
+    }
+
+    struct S3 s3a = {{1, 2, 3}}, s3b = {{0}};
+    assign3(&s3b, &s3a);
+    assert(memcmp(&s3a, &s3b, sizeof(s3a)) == 0);
+
+    struct S24 s24a = {{-1, 2, -3}}, s24b = {{0}};
+    assign24(&s24b, &s24a);
+    assert(memcmp(&s24a, &s24b, sizeof(s24a)) == 0);
+
+    struct S37 s37a;
+    for (int i = 0; i < 37; i++) {
+        s37a.arr[i] = (char) (i * 5 + 1);
+    }
+    struct S37 s37b = get37(&s37a);
+    assert(memcmp(&s37a, &s37b, sizeof(s37a)) == 0);
+
+    struct S100 s100a, s100b = {{0}};
+    for (int i = 0; i < 25; i++) {
+        s100a.arr[i] = i * i - 100;
+    }
+    assign100(&s100b, &s100a);
+    assert(memcmp(&s100a, &s100b, sizeof(s100a)) == 0);
+
+    s100b = zero100();
+    for (int i = 0; i < 25; i++) {
+        assert(s100b.arr[i] == 0);
+    }
+
+    static struct S300 s300a, s300b;
+    for (int i = 0; i < 300; i++) {
+        s300a.arr[i] = (char) (i ^ 0x33);
+    }
+    assign300(&s300b, &s300a);
+    assert(memcmp(&s300a, &s300b, sizeof(s300a)) == 0);
+    return EXIT_SUCCESS;
+}
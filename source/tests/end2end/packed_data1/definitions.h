@@ -0,0 +1,45 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef DEFINITIONS_H_
+#define DEFINITIONS_H_
+
+#define TABLE_LENGTH 40
+
+extern const unsigned char bytes[TABLE_LENGTH];
+extern short shorts[TABLE_LENGTH];
+extern const int ints[TABLE_LENGTH];
+extern long longs[TABLE_LENGTH];
+extern const float floats[TABLE_LENGTH];
+extern const double doubles[TABLE_LENGTH];
+extern const int matrix[3][TABLE_LENGTH];
+extern long mixed[TABLE_LENGTH];
+extern int sparse[1024];
+
+struct S1 {
+    char tag;
+    int values[TABLE_LENGTH];
+    double tail;
+};
+
+extern struct S1 s1;
+
+#endif
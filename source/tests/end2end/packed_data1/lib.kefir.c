@@ -0,0 +1,37 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "./definitions.h"
+
+#define SEQ8(_x) (_x), (_x) + 1, (_x) + 2, (_x) + 3, (_x) + 4, (_x) + 5, (_x) + 6, (_x) + 7
+#define SEQ40(_x) SEQ8(_x), SEQ8((_x) + 8), SEQ8((_x) + 16), SEQ8((_x) + 24), SEQ8((_x) + 32)
+
+const unsigned char bytes[TABLE_LENGTH] = {SEQ40(250)};
+short shorts[TABLE_LENGTH] = {SEQ40(-20)};
+const int ints[TABLE_LENGTH] = {SEQ40(-100000), [10] = 7, [39] = 0x7fffffff};
+long longs[TABLE_LENGTH] = {SEQ40(-5000000000l)};
+const float floats[TABLE_LENGTH] = {SEQ40(0.5f)};
+const double doubles[TABLE_LENGTH] = {SEQ40(-3.25), [20] = 1e300};
+const int matrix[3][TABLE_LENGTH] = {{SEQ40(1)}, {SEQ40(100)}, {SEQ8(-8), SEQ8(-16), SEQ8(-24), SEQ8(-32)}};
+long mixed[TABLE_LENGTH] = {SEQ8(1), SEQ8(9), (long) &s1, SEQ8(100), SEQ8(200), 1, 2, 3, 4, 5, 6, 7};
+int sparse[1024] = {1, [1023] = 2};
+
+struct S1 s1 = {'X', {SEQ40(1000)}, 2.5};
@@ -0,0 +1 @@
+KEFIR_CFLAGS="$KEFIR_CFLAGS -O2"
\ No newline at end of file
@@ -0,0 +1,74 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include "./definitions.h"
+
+int main(void) {
+    for (int i = 0; i < TABLE_LENGTH; i++) {
+        assert(bytes[i] == (unsigned char) (250 + i));
+        assert(shorts[i] == -20 + i);
+        if (i == 10) {
+            assert(ints[i] == 7);
+        } else if (i == 39) {
+            assert(ints[i] == 0x7fffffff);
+        } else {
+            assert(ints[i] == -100000 + i);
+        }
+        assert(longs[i] == -5000000000l + i);
+        assert(floats[i] == 0.5f + i);
+        if (i == 20) {
+            assert(doubles[i] == 1e300);
+        } else {
+            assert(doubles[i] == -3.25 + i);
+        }
+        assert(matrix[0][i] == 1 + i);
+        assert(matrix[1][i] == 100 + i);
+        if (i < 32) {
+            assert(matrix[2][i] == -8 * (i / 8 + 1) + i % 8);
+        } else {
+            assert(matrix[2][i] == 0);
+        }
+        assert(s1.values[i] == 1000 + i);
+    }
+    assert(s1.tag == 'X');
+    assert(s1.tail == 2.5);
+
+    for (int i = 0; i < 8; i++) {
+        assert(mixed[i] == 1 + i);
+        assert(mixed[8 + i] == 9 + i);
+        assert(mixed[17 + i] == 100 + i);
+        assert(mixed[25 + i] == 200 + i);
+    }
+    assert(mixed[16] == (long) &s1);
+    for (int i = 0; i < 7; i++) {
+        assert(mixed[33 + i] == 1 + i);
+    }
+
+    assert(sparse[0] == 1);
+    assert(sparse[1023] == 2);
+    for (int i = 1; i < 1023; i++) {
+        assert(sparse[i] == 0);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,54 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "./definitions.h"
+
+int gi;
+
+void scale(int *restrict a, const int *restrict b, long n) {
+    for (long i = 0; i < n; i++) {
+        a[i] = b[0] * 2;
+        a[i] += b[0];
+    }
+}
+
+int restrict_global(int *restrict p) {
+    int x = gi;
+    *p = 3;
+    return x + gi;
+}
+
+int restrict_self(int *restrict p) {
+    int *q = p + 1;
+    int x = q[-1];
+    p[0] = 7;
+    return x + q[-1];
+}
+
+int restrict_loop(int *restrict a, int *restrict b, long n) {
+    int sum = 0;
+    for (long i = 0; i < n; i++) {
+        int x = b[i];
+        a[i] = x + 1;
+        sum += b[i];
+    }
+    return sum;
+}
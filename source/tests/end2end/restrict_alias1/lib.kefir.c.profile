@@ -0,0 +1 @@
+KEFIR_CFLAGS="$KEFIR_CFLAGS -O1"
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include "./definitions.h"
+
+int main(void) {
+    int a[16];
+    int b = 5;
+    scale(a, &b, 16);
+    for (int i = 0; i < 16; i++) {
+        assert(a[i] == 15);
+    }
+
+    int x = 0;
+    gi = 10;
+    assert(restrict_global(&x) == 20);
+    assert(x == 3);
+
+    int y[2] = {1, 2};
+    assert(restrict_self(y) == 8);
+    assert(y[0] == 7);
+
+    int c[8], d[8];
+    for (int i = 0; i < 8; i++) {
+        d[i] = i;
+    }
+    assert(restrict_loop(c, d, 8) == 28);
+    for (int i = 0; i < 8; i++) {
+        assert(c[i] == i + 1);
+    }
+    return EXIT_SUCCESS;
+}
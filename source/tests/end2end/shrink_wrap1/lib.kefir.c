@@ -0,0 +1,72 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "./definitions.h"
+
+long list_sum(const struct node *list) {
+    if (!list) {
+        return 0;
+    }
+    return transform(list->value) + list_sum(list->next);
+}
+
+long list_length_or(const struct node *list, long fallback) {
+    if (list == 0) {
+        return fallback;
+    }
+    long length = 0;
+    for (; list != 0; list = list->next) {
+        length += transform(1);
+    }
+    return length;
+}
+
+long count_positive(const long *values, int length) {
+    if (length <= 0) {
+        return -1;
+    }
+    long count = 0;
+    for (int i = 0; i < length; i++) {
+        if (transform(values[i]) > 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+long forward_transform(const long *value) {
+    if (value != 0) {
+        return transform(*value);
+    }
+    return transform(-1) + 1;
+}
+
+long mix_table(long seed, long step) {
+    long table[12];
+    for (int i = 0; i < 12; i++) {
+        table[i] = seed + step * i;
+    }
+    long result = 0;
+    for (int i = 0; i < 12; i++) {
+        result ^= table[(i * 5) % 12] + i;
+    }
+    return result;
+}
@@ -0,0 +1,68 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <assert.h>
+#include "./definitions.h"
+
+long transform(long x) {
+    return x * 2 - 1;
+}
+
+static long mix_table_ref(long seed, long step) {
+    long table[12];
+    for (int i = 0; i < 12; i++) {
+        table[i] = seed + step * i;
+    }
+    long result = 0;
+    for (int i = 0; i < 12; i++) {
+        result ^= table[(i * 5) % 12] + i;
+    }
+    return result;
+}
+
+int main(void) {
+    struct node nodes[3] = {{5, &nodes[1]}, {-2, &nodes[2]}, {10, NULL}};
+    assert(list_sum(NULL) == 0);
+    assert(list_sum(&nodes[2]) == 19);
+    assert(list_sum(nodes) == 9 - 5 + 19);
+
+    assert(list_length_or(NULL, 42) == 42);
+    assert(list_length_or(nodes, 42) == 3);
+    assert(list_length_or(&nodes[1], -7) == 2);
+
+    static const long values[] = {1, 0, -3, 7, 2};
+    assert(count_positive(values, 0) == -1);
+    assert(count_positive(values, -5) == -1);
+    assert(count_positive(values, 5) == 3);
+    assert(count_positive(values + 1, 2) == 0);
+
+    long value = 21;
+    assert(forward_transform(&value) == 41);
+    assert(forward_transform(NULL) == -2);
+
+    for (long seed = -100; seed < 100; seed += 7) {
+        for (long step = -3; step < 4; step++) {
+            assert(mix_table(seed, step) == mix_table_ref(seed, step));
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,82 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "./definitions.h"
+
+int counter = 0;
+
+static int square(int x) {
+    return x * x;
+}
+
+static int unused_helper(int x) {
+    return square(x) + 1;
+}
+
+static int add_square(int x, int y) {
+    return square(x) + y;
+}
+
+int compute(int x) {
+    return add_square(x, 1) + square(x + 1);
+}
+
+int fib(int n) {
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+static int op_add(int x) {
+    counter++;
+    return x + 100;
+}
+
+static int op_sub(int x) {
+    counter++;
+    return x - 100;
+}
+
+static int (*const ops[])(int) = {op_add, op_sub};
+
+int dispatch(int index, int x) {
+    return ops[index & 1](x);
+}
+
+static const char *message(void) {
+    return "hello, world";
+}
+
+const char *greeting(void) {
+    return message();
+}
+
+static long table[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+static long sum_impl(const long *values, int length) {
+    long sum = 0;
+    for (int i = 0; i < length; i++) {
+        sum += values[i];
+    }
+    return sum;
+}
+
+long sum_table(void) {
+    return sum_impl(table, sizeof(table) / sizeof(table[0]));
+}
@@ -0,0 +1,45 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include "./definitions.h"
+
+static int fib_ref(int n) {
+    return n < 2 ? n : fib_ref(n - 1) + fib_ref(n - 2);
+}
+
+int main(void) {
+    for (int i = -100; i < 100; i++) {
+        assert(compute(i) == i * i + 1 + (i + 1) * (i + 1));
+        assert(dispatch(0, i) == i + 100);
+        assert(dispatch(1, i) == i - 100);
+    }
+    assert(counter == 400);
+    for (int i = 0; i < 20; i++) {
+        assert(fib(i) == fib_ref(i));
+    }
+    assert(strcmp(greeting(), "hello, world") == 0);
+    assert(sum_table() == 36);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,41 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef DEFINITIONS_H_
+#define DEFINITIONS_H_
+
+union pun {
+    int i;
+    float f;
+    struct {
+        unsigned short lo;
+        unsigned short hi;
+    } halves;
+};
+
+extern double g;
+
+extern double reload_double(double *, int *);
+extern double sum_global(int *, long);
+extern float pun_value(union pun *, int);
+extern unsigned short pun_halves(union pun *, int);
+extern int byte_update(int *, unsigned char *);
+
+#endif
@@ -0,0 +1,54 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "./definitions.h"
+
+double g;
+
+double reload_double(double *d, int *i) {
+    double x = *d;
+    *i = 5;
+    return x + *d;
+}
+
+double sum_global(int *n, long count) {
+    double sum = 0;
+    for (long i = 0; i < count; i++) {
+        n[i] = 1;
+        sum += g;
+    }
+    return sum;
+}
+
+float pun_value(union pun *u, int value) {
+    u->i = value;
+    return u->f;
+}
+
+unsigned short pun_halves(union pun *u, int value) {
+    u->i = value;
+    return u->halves.hi;
+}
+
+int byte_update(int *p, unsigned char *c) {
+    int x = *p;
+    *c = 0xff;
+    return x + *p;
+}
@@ -0,0 +1,53 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include <math.h>
+#include "./definitions.h"
+
+int main(void) {
+    double d = 3.5;
+    int i = 0;
+    assert(fabs(reload_double(&d, &i) - 7.0) < 1e-6);
+    assert(i == 5);
+
+    int n[16];
+    g = 1.5;
+    assert(fabs(sum_global(n, 16) - 24.0) < 1e-6);
+    for (int k = 0; k < 16; k++) {
+        assert(n[k] == 1);
+    }
+    assert(fabs(sum_global(n, 0)) < 1e-6);
+
+    union pun u;
+    float f = 2.75f;
+    int bits;
+    memcpy(&bits, &f, sizeof(bits));
+    assert(pun_value(&u, bits) == 2.75f);
+    assert(pun_halves(&u, 0x12345678) == 0x1234);
+
+    int value = 0x100;
+    unsigned char *bytes = (unsigned char *) &value;
+    assert(byte_update(&value, &bytes[0]) == 0x100 + 0x1ff);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,97 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "./definitions.h"
+
+int classify_int(int x) {
+    switch (x) {
+        case -2147483647 - 1:
+            return 1;
+        case -1000:
+            return 2;
+        case -5 ... -3:
+            return 3;
+        case 0:
+            return 4;
+        case 3:
+            return 5;
+        case 7 ... 9:
+            return 6;
+        case 12:
+            return 7;
+        case 100:
+            return 8;
+        case 101:
+            return 9;
+        case 2000:
+            return 10;
+        case 2147483647:
+            return 11;
+        default:
+            return 0;
+    }
+}
+
+int classify_uchar(unsigned char x) {
+    switch (x) {
+        case 'a':
+            return 1;
+        case 'b':
+            return 2;
+        case 'c':
+            return 3;
+        case 'x' ... 'z':
+            return 4;
+        case 0:
+            return 5;
+        case 200:
+            return 6;
+        case 255:
+            return 7;
+        case 256 + 'd':
+            return 8;
+    }
+    return 0;
+}
+
+int classify_ulong(unsigned long x) {
+    switch (x) {
+        case 0:
+            return 1;
+        case 1:
+            return 2;
+        case 2 ... 4:
+            return 3;
+        case 1000:
+            return 4;
+        case 0x7fffffffffffffffull:
+            return 5;
+        case 0x8000000000000000ull:
+            return 6;
+        case -1ull:
+            return 7;
+        case 77:
+            return 8;
+        case -2:
+            return 9;
+    }
+    return 0;
+}
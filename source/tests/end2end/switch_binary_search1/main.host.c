@@ -0,0 +1,108 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <limits.h>
+#include "./definitions.h"
+
+static int classify_int_ref(int x) {
+    if (x == INT_MIN) {
+        return 1;
+    } else if (x == -1000) {
+        return 2;
+    } else if (x >= -5 && x <= -3) {
+        return 3;
+    } else if (x == 0) {
+        return 4;
+    } else if (x == 3) {
+        return 5;
+    } else if (x >= 7 && x <= 9) {
+        return 6;
+    } else if (x == 12) {
+        return 7;
+    } else if (x == 100) {
+        return 8;
+    } else if (x == 101) {
+        return 9;
+    } else if (x == 2000) {
+        return 10;
+    } else if (x == INT_MAX) {
+        return 11;
+    } else {
+        return 0;
+    }
+}
+
+static int classify_uchar_ref(unsigned char x) {
+    switch (x) {
+        case 'a':
+            return 1;
+        case 'b':
+            return 2;
+        case 'c':
+            return 3;
+        case 'x':
+        case 'y':
+        case 'z':
+            return 4;
+        case 0:
+            return 5;
+        case 200:
+            return 6;
+        case 255:
+            return 7;
+    }
+    return 0;
+}
+
+int main(void) {
+    for (int i = -3000; i <= 3000; i++) {
+        assert(classify_int(i) == classify_int_ref(i));
+    }
+    assert(classify_int(INT_MIN) == 1);
+    assert(classify_int(INT_MAX) == 11);
+    assert(classify_int(INT_MIN + 1) == 0);
+    assert(classify_int(INT_MAX - 1) == 0);
+
+    for (int i = 0; i <= UCHAR_MAX; i++) {
+        assert(classify_uchar((unsigned char) i) == classify_uchar_ref((unsigned char) i));
+    }
+
+    assert(classify_ulong(0) == 1);
+    assert(classify_ulong(1) == 2);
+    assert(classify_ulong(2) == 3);
+    assert(classify_ulong(3) == 3);
+    assert(classify_ulong(4) == 3);
+    assert(classify_ulong(5) == 0);
+    assert(classify_ulong(76) == 0);
+    assert(classify_ulong(77) == 8);
+    assert(classify_ulong(78) == 0);
+    assert(classify_ulong(1000) == 4);
+    assert(classify_ulong(0x7fffffffffffffffull) == 5);
+    assert(classify_ulong(0x8000000000000000ull) == 6);
+    assert(classify_ulong(0x8000000000000001ull) == 0);
+    assert(classify_ulong(-1ull) == 7);
+    assert(classify_ulong(-2ull) == 9);
+    assert(classify_ulong(-3ull) == 0);
+    return EXIT_SUCCESS;
+}
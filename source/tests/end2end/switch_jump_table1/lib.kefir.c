@@ -0,0 +1,175 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "./definitions.h"
+
+int dense(int x) {
+    switch (x) {
+        case 0:
+            return 10;
+        case 1:
+            return 11;
+        case 2:
+            return 12;
+        case 3:
+            return 13;
+        case 5:
+            return 15;
+        case 6:
+            return 16;
+        case 7:
+            return 17;
+        case 8:
+            return 18;
+        case 9:
+            return 19;
+        default:
+            return -1;
+    }
+}
+
+int negative(signed char x) {
+    switch (x) {
+        case -8:
+            return 1;
+        case -7:
+            return 2;
+        case -6:
+            return 3;
+        case -5:
+            return 4;
+        case -4:
+            return 5;
+        case -3:
+            return 6;
+        case -2:
+            return 7;
+        case -1:
+            return 8;
+        case 0:
+            return 9;
+        case 1 ... 3:
+            return 10;
+    }
+    return 0;
+}
+
+unsigned long fallthrough(unsigned long x, unsigned long acc) {
+    switch (x) {
+        case 100:
+            acc += 1;
+            // Fallthrough
+        case 101:
+            acc *= 3;
+            break;
+        case 102:
+            acc -= 7;
+            break;
+        case 103:
+            acc ^= 0xff;
+            break;
+        case 104:
+            acc <<= 2;
+            break;
+        case 105:
+            acc = 1;
+            break;
+        case 107:
+            acc += x;
+            break;
+        case 108:
+            acc -= x;
+            break;
+        case 110:
+            acc = 42;
+            break;
+        case 111:
+            acc += 2;
+            break;
+        default:
+            acc = ~acc;
+            break;
+    }
+    return acc;
+}
+
+int sparse(long x) {
+    switch (x) {
+        case 1:
+            return 1;
+        case 1000:
+            return 2;
+        case 100000:
+            return 3;
+        case -5:
+            return 4;
+        case -0x7fffffffffffffffl - 1:
+            return 5;
+        case 0x7fffffffffffffffl:
+            return 6;
+        case 77:
+            return 7;
+        case 99999999:
+            return 8;
+        case 3:
+            return 9;
+        default:
+            return 0;
+    }
+}
+
+int loop(int n) {
+    int s = 0;
+    for (int i = 0; i < n; i++) {
+        switch (i % 12) {
+            case 0:
+                s += 1;
+                break;
+            case 1:
+                s += 2;
+                break;
+            case 2:
+                s -= 3;
+                break;
+            case 3:
+                s *= 2;
+                break;
+            case 4:
+                s ^= 5;
+                break;
+            case 5:
+                s %= 1000;
+                break;
+            case 6:
+                s += i;
+                break;
+            case 7:
+                s -= 1;
+                break;
+            case 9:
+                s += 9;
+                break;
+            case 10:
+                s -= i;
+                break;
+        }
+    }
+    return s;
+}
@@ -0,0 +1,123 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <assert.h>
+#include <limits.h>
+#include "./definitions.h"
+
+int main(void) {
+    for (int i = -100; i < 100; i++) {
+        assert(dense(i) == (i >= 0 && i <= 9 && i != 4 ? 10 + i : -1));
+    }
+    assert(dense(INT_MIN) == -1);
+    assert(dense(INT_MAX) == -1);
+
+    for (int i = SCHAR_MIN; i <= SCHAR_MAX; i++) {
+        assert(negative((signed char) i) == (i >= -8 && i <= 0 ? i + 9 : (i >= 1 && i <= 3 ? 10 : 0)));
+    }
+
+    for (unsigned long i = 0; i < 200; i++) {
+        const unsigned long acc = i * 7;
+        unsigned long expected;
+        switch (i) {
+            case 100:
+                expected = (acc + 1) * 3;
+                break;
+            case 101:
+                expected = acc * 3;
+                break;
+            case 102:
+                expected = acc - 7;
+                break;
+            case 103:
+                expected = acc ^ 0xff;
+                break;
+            case 104:
+                expected = acc << 2;
+                break;
+            case 105:
+                expected = 1;
+                break;
+            case 107:
+                expected = acc + i;
+                break;
+            case 108:
+                expected = acc - i;
+                break;
+            case 110:
+                expected = 42;
+                break;
+            case 111:
+                expected = acc + 2;
+                break;
+            default:
+                expected = ~acc;
+                break;
+        }
+        assert(fallthrough(i, acc) == expected);
+    }
+    assert(fallthrough(~0ul, 5) == ~5ul);
+    assert(fallthrough(~0ul - 100, 5) == ~5ul);
+
+    assert(sparse(1) == 1);
+    assert(sparse(1000) == 2);
+    assert(sparse(100000) == 3);
+    assert(sparse(-5) == 4);
+    assert(sparse(LONG_MIN) == 5);
+    assert(sparse(LONG_MAX) == 6);
+    assert(sparse(77) == 7);
+    assert(sparse(99999999) == 8);
+    assert(sparse(3) == 9);
+    assert(sparse(0) == 0);
+    assert(sparse(2) == 0);
+    assert(sparse(-1) == 0);
+    assert(sparse(LONG_MIN + 1) == 0);
+
+    int s = 0;
+    for (int i = 0; i < 1000; i++) {
+        const int r = i % 12;
+        if (r == 0) {
+            s += 1;
+        } else if (r == 1) {
+            s += 2;
+        } else if (r == 2) {
+            s -= 3;
+        } else if (r == 3) {
+            s *= 2;
+        } else if (r == 4) {
+            s ^= 5;
+        } else if (r == 5) {
+            s %= 1000;
+        } else if (r == 6) {
+            s += i;
+        } else if (r == 7) {
+            s -= 1;
+        } else if (r == 9) {
+            s += 9;
+        } else if (r == 10) {
+            s -= i;
+        }
+    }
+    assert(loop(1000) == s);
+    assert(loop(0) == 0);
+    return EXIT_SUCCESS;
+}
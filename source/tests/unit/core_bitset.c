@@ -0,0 +1,79 @@
+/*
+    SPDX-License-Identifier: GPL-3.0
+
+    Copyright (C) 2020-2026  Jevgenijs Protopopovs
+
+    This file is part of Kefir project.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, version 3.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "kefir/test/unit_test.h"
+#include "kefir/core/bitset.h"
+#include "kefir/test/util.h"
+
+DEFINE_CASE(core_bitset1, "Core - Bitset #1") {
+    struct kefir_bitset bitset, other;
+    ASSERT_OK(kefir_bitset_init(&bitset));
+    ASSERT_OK(kefir_bitset_init(&other));
+
+    const kefir_size_t Length = 1000;
+    ASSERT_OK(kefir_bitset_ensure(&kft_mem, &bitset, Length));
+    ASSERT_OK(kefir_bitset_ensure(&kft_mem, &other, Length - 7));
+    ASSERT_OK(kefir_bitset_clear(&bitset));
+    ASSERT_OK(kefir_bitset_clear(&other));
+
+    for (kefir_size_t i = 0; i < Length; i += 3) {
+        ASSERT_OK(kefir_bitset_set(&bitset, i, true));
+    }
+    for (kefir_size_t i = 0; i < Length - 7; i += 5) {
+        ASSERT_OK(kefir_bitset_set(&other, i, true));
+    }
+
+    kefir_size_t index = 0, count = 0;
+    kefir_result_t res;
+    for (res = kefir_bitset_find(&bitset, true, 0, &index); res == KEFIR_OK;
+         res = kefir_bitset_find(&bitset, true, index + 1, &index)) {
+        ASSERT(index % 3 == 0);
+        count++;
+    }
+    ASSERT(res == KEFIR_NOT_FOUND);
+    ASSERT(count == (Length + 2) / 3);
+    ASSERT_OK(kefir_bitset_find(&bitset, false, 0, &index));
+    ASSERT(index == 1);
+    ASSERT(kefir_bitset_find(&bitset, true, Length, &index) == KEFIR_NOT_FOUND);
+
+    kefir_bool_t changed;
+    ASSERT_OK(kefir_bitset_union(&bitset, &other, &changed));
+    ASSERT(changed);
+    ASSERT_OK(kefir_bitset_union(&bitset, &other, &changed));
+    ASSERT(!changed);
+    for (kefir_size_t i = 0; i < Length; i++) {
+        kefir_bool_t value;
+        ASSERT_OK(kefir_bitset_get(&bitset, i, &value));
+        ASSERT(value == (i % 3 == 0 || (i < Length - 7 && i % 5 == 0)));
+    }
+
+    ASSERT_OK(kefir_bitset_subtract(&bitset, &other));
+    for (kefir_size_t i = 0; i < Length; i++) {
+        kefir_bool_t value;
+        ASSERT_OK(kefir_bitset_get(&bitset, i, &value));
+        ASSERT(value == (i % 3 == 0 && (i >= Length - 7 || i % 5 != 0)));
+    }
+
+    ASSERT(kefir_bitset_union(&other, &bitset, NULL) == KEFIR_OUT_OF_BOUNDS);
+
+    ASSERT_OK(kefir_bitset_free(&kft_mem, &other));
+    ASSERT_OK(kefir_bitset_free(&kft_mem, &bitset));
+}
+END_CASE
@@ -37,6 +37,7 @@ kefir_result_t kefir_test_codegen_init(struct kefir_mem *mem, struct kefir_test_
         kefir_codegen_amd64_init(mem, &codegen->new_codegen, output, KEFIR_ABI_AMD64_VARIANT_SYSTEM_V, NULL, config));
 
     codegen->iface.translate_optimized = translate_impl;
+    codegen->iface.translate_streaming = NULL;
     codegen->iface.close = close_impl;
     codegen->iface.data = codegen;
     codegen->iface.self = codegen;